@@ -16,6 +16,7 @@ static int attestation_responder_get_digests (struct attestation_responder *atte
 	const struct der_cert *int_ca;
 	const struct der_cert *aux_cert = NULL;
 	size_t offset = 0;
+	uint32_t generation = 0;
 	int status;
 
 	if ((attestation == NULL) || (buf == NULL) || (num_cert == NULL)) {
@@ -38,6 +39,16 @@ static int attestation_responder_get_digests (struct attestation_responder *atte
 		}
 	}
 
+	/* The auxiliary certificate is not managed by the RIoT key manager, so only digests for the
+	 * RIoT certificate chain can be cached. */
+	if (slot_num == ATTESTATION_RIOT_SLOT_NUM) {
+		status = riot_key_manager_get_cached_digest (attestation->riot, slot_num, HASH_TYPE_SHA256,
+			RIOT_KEY_MANAGER_DIGEST_CERT_LIST, buf, buf_len, num_cert, &generation);
+		if (!ROT_IS_ERROR (status)) {
+			return status;
+		}
+	}
+
 	keys = riot_key_manager_get_riot_keys (attestation->riot);
 	if ((keys->devid_cert == NULL) || (keys->devid_cert_length == 0)) {
 		status = ATTESTATION_CERT_NOT_AVAILABLE;
@@ -111,6 +122,11 @@ static int attestation_responder_get_digests (struct attestation_responder *atte
 
 	status = offset + SHA256_HASH_LENGTH;
 
+	if (slot_num == ATTESTATION_RIOT_SLOT_NUM) {
+		riot_key_manager_cache_digest (attestation->riot, slot_num, HASH_TYPE_SHA256,
+			RIOT_KEY_MANAGER_DIGEST_CERT_LIST, buf, status, *num_cert, generation);
+	}
+
 unlock:
 	platform_mutex_unlock (&attestation->lock);
 exit:
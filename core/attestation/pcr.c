@@ -180,6 +180,7 @@ int pcr_set_tcg_event_type (struct pcr_bank *pcr, uint8_t measurement_index, uin
 	platform_mutex_lock (&pcr->lock);
 
 	pcr->measurement_list[measurement_index].event_type = event_type;
+	pcr->generation++;
 
 	platform_mutex_unlock (&pcr->lock);
 
@@ -292,6 +293,23 @@ int pcr_is_measurement_in_tcb (struct pcr_bank *pcr, uint8_t measurement_index)
 	return !pcr->measurement_list[measurement_index].spdm_not_tcb;
 }
 
+/**
+ * Track that a measurement digest has changed, so the extended value for that measurement and all
+ * measurements after it need to be recalculated the next time the PCR is computed.  The PCR
+ * generation is also updated.  The PCR lock must be held by the caller.
+ *
+ * @param pcr The PCR containing the modified measurement.
+ * @param measurement_index The index of the measurement that was modified.
+ */
+static void pcr_mark_dirty (struct pcr_bank *pcr, uint8_t measurement_index)
+{
+	if (measurement_index < pcr->dirty_index) {
+		pcr->dirty_index = measurement_index;
+	}
+
+	pcr->generation++;
+}
+
 /**
  * Update the current digest for a single measurement.
  *
@@ -331,6 +349,7 @@ static int pcr_update_digest_common (struct pcr_bank *pcr, uint8_t measurement_i
 		memcpy (pcr->measurement_list[measurement_index].digest, digest, digest_len);
 		pcr->measurement_list[measurement_index].measurement_config = measurement_config;
 		pcr->measurement_list[measurement_index].version = version;
+		pcr_mark_dirty (pcr, measurement_index);
 	}
 	else {
 		status = PCR_CONSTANT_MEASUREMENT;
@@ -591,6 +610,7 @@ int pcr_invalidate_measurement (struct pcr_bank *pcr, uint8_t measurement_index)
 	if (!is_constant) {
 		memset (pcr->measurement_list[measurement_index].digest, 0,
 			sizeof (pcr->measurement_list[measurement_index].digest));
+		pcr_mark_dirty (pcr, measurement_index);
 	}
 	else {
 		status = PCR_CONSTANT_MEASUREMENT;
@@ -606,6 +626,10 @@ int pcr_invalidate_measurement (struct pcr_bank *pcr, uint8_t measurement_index)
  * included in the PCR calculation, even if they have not been updated with a value or if they have
  * been invalidated.
  *
+ * Extended values are cached for each measurement.  Only measurements at or after the first one
+ * that has changed since the last calculation will be extended again.  If no measurements have
+ * changed, the cached PCR value is returned without any hashing.
+ *
  * @param pcr The PCR to calculate.
  * @param hash Hashing engine to use for the calculation.
  * @param lock true to acquire the PCR mutex during the calculation.  If this is false, it is
@@ -640,7 +664,12 @@ int pcr_compute (struct pcr_bank *pcr, struct hash_engine *hash, bool lock, uint
 	}
 
 	if (!pcr->explicit_measurement) {
-		for (i = 0; i < pcr->config.num_measurements; ++i) {
+		if (pcr->dirty_index != 0) {
+			memcpy (prev_measurement, pcr->measurement_list[pcr->dirty_index - 1].measurement,
+				hash_length);
+		}
+
+		for (i = pcr->dirty_index; i < pcr->config.num_measurements; ++i) {
 			status = hash_start_new_hash (hash, pcr->config.measurement_algo);
 			if (status != 0) {
 				goto exit;
@@ -663,10 +692,12 @@ int pcr_compute (struct pcr_bank *pcr, struct hash_engine *hash, bool lock, uint
 
 			memcpy (pcr->measurement_list[i].measurement, prev_measurement,
 				sizeof (prev_measurement));
+			pcr->dirty_index = i + 1;
 		}
 
 		if (measurement != NULL) {
-			memcpy (measurement, prev_measurement, hash_length);
+			memcpy (measurement,
+				pcr->measurement_list[pcr->config.num_measurements - 1].measurement, hash_length);
 		}
 	}
 	else if (measurement != NULL) {
@@ -804,6 +835,7 @@ int pcr_set_measurement_data (struct pcr_bank *pcr, uint8_t measurement_index,
 	platform_mutex_lock (&pcr->lock);
 
 	pcr->measurement_list[measurement_index].measured_data = measurement_data;
+	pcr->generation++;
 
 	platform_mutex_unlock (&pcr->lock);
 
@@ -1180,21 +1212,28 @@ exit:
 }
 
 /**
- * Generate TCG formatted log entries for all measurements in the PCR.
+ * Generate TCG formatted log entries for the measurements in the PCR, starting from a specific
+ * measurement.  Log entries for measurements before the starting measurement are not generated.
  *
  * @param pcr The PCR to query.
  * @param pcr_num Number assigned to this PCR.
- * @param offset Offset within the PCR log to start reading data.
+ * @param position On input, this identifies the first measurement that should be added to the log.
+ * If any log data was read, this will be updated with the measurement and offset of the last log
+ * entry that provided data.  The offset is relative to the log entry for the starting measurement.
+ * If no data was read, this will not be modified.
+ * @param offset Offset from the start of the log entry for the starting measurement to start reading
+ * data.
  * @param buffer Output buffer to populate with the requested log entries.
  * @param length Maximum number of bytes to read from the log.
- * @param total_len Total length of all log entries for the PCR.  This is only valid if the call is
- * successful and 0 bytes are read from the log.  This would happen if the offset was large enough
- * to skip over all the log data.
+ * @param total_len Total length of all log entries for the PCR, starting from the starting
+ * measurement.  This is only valid if the call is successful and either 0 bytes are read from the
+ * log or the output buffer was not filled.
  *
  * @return The number of bytes read from the log or an error code.
  */
-int pcr_get_tcg_log (struct pcr_bank *pcr, uint32_t pcr_num, size_t offset, uint8_t *buffer,
-	size_t length, size_t *total_len)
+int pcr_get_tcg_log_from_position (struct pcr_bank *pcr, uint32_t pcr_num,
+	struct pcr_tcg_log_position *position, size_t offset, uint8_t *buffer, size_t length,
+	size_t *total_len)
 {
 	union {
 		struct pcr_tcg_event2_header header;
@@ -1203,7 +1242,8 @@ int pcr_get_tcg_log (struct pcr_bank *pcr, uint32_t pcr_num, size_t offset, uint
 		struct pcr_tcg_event2_sha512 sha512;
 	} entry;
 	size_t num_bytes = 0;
-	size_t i = 0;
+	size_t i;
+	size_t entry_start;
 	uint8_t *entry_digest;
 	uint32_t *entry_event_size;
 	size_t entry_digest_len;
@@ -1214,7 +1254,7 @@ int pcr_get_tcg_log (struct pcr_bank *pcr, uint32_t pcr_num, size_t offset, uint
 	size_t event_size;
 	int status = 0;
 
-	if ((pcr == NULL) || (buffer == NULL) || (total_len == NULL)) {
+	if ((pcr == NULL) || (position == NULL) || (buffer == NULL) || (total_len == NULL)) {
 		return PCR_INVALID_ARGUMENT;
 	}
 
@@ -1262,11 +1302,13 @@ int pcr_get_tcg_log (struct pcr_bank *pcr, uint32_t pcr_num, size_t offset, uint
 
 	platform_mutex_lock (&pcr->lock);
 
+	i = position->measurement;
 	while ((i < pcr->config.num_measurements) && (length > 0)) {
 		entry.header.event_type = pcr->measurement_list[i].event_type;
 
 		memcpy (entry_digest, pcr->measurement_list[i].digest, entry_digest_len);
 
+		entry_start = *total_len;
 		*total_len += entry_total_len;
 
 		if (offset >= entry_total_len) {
@@ -1296,6 +1338,9 @@ int pcr_get_tcg_log (struct pcr_bank *pcr, uint32_t pcr_num, size_t offset, uint
 		if (entry_ptr != NULL) {
 			memcpy (entry_ptr, ((uint8_t*) &entry) + entry_offset, entry_len);
 			entry_ptr = NULL;
+
+			position->measurement = i;
+			position->offset = entry_start;
 		}
 
 		*total_len += event_size;
@@ -1303,6 +1348,9 @@ int pcr_get_tcg_log (struct pcr_bank *pcr, uint32_t pcr_num, size_t offset, uint
 		length -= status;
 
 		if (status > 0) {
+			position->measurement = i;
+			position->offset = entry_start;
+
 			offset = 0;
 			num_bytes += status;
 		}
@@ -1324,6 +1372,55 @@ exit:
 	}
 }
 
+/**
+ * Generate TCG formatted log entries for all measurements in the PCR.
+ *
+ * @param pcr The PCR to query.
+ * @param pcr_num Number assigned to this PCR.
+ * @param offset Offset within the PCR log to start reading data.
+ * @param buffer Output buffer to populate with the requested log entries.
+ * @param length Maximum number of bytes to read from the log.
+ * @param total_len Total length of all log entries for the PCR.  This is only valid if the call is
+ * successful and 0 bytes are read from the log.  This would happen if the offset was large enough
+ * to skip over all the log data.
+ *
+ * @return The number of bytes read from the log or an error code.
+ */
+int pcr_get_tcg_log (struct pcr_bank *pcr, uint32_t pcr_num, size_t offset, uint8_t *buffer,
+	size_t length, size_t *total_len)
+{
+	struct pcr_tcg_log_position position = {
+		.measurement = 0,
+		.offset = 0
+	};
+
+	return pcr_get_tcg_log_from_position (pcr, pcr_num, &position, offset, buffer, length,
+		total_len);
+}
+
+/**
+ * Get the current generation of the PCR measurements.  The generation changes any time there is a
+ * modification to a measurement that would affect the PCR value or log contents.
+ *
+ * @param pcr The PCR to query.
+ *
+ * @return The current PCR generation.  If the PCR is null, this will always be 0.
+ */
+uint32_t pcr_get_generation (struct pcr_bank *pcr)
+{
+	uint32_t generation;
+
+	if (pcr == NULL) {
+		return 0;
+	}
+
+	platform_mutex_lock (&pcr->lock);
+	generation = pcr->generation;
+	platform_mutex_unlock (&pcr->lock);
+
+	return generation;
+}
+
 /**
  * Acquire the lock for accessing the PCR measurements.
  *
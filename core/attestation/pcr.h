@@ -91,9 +91,19 @@ struct pcr_bank {
 	struct pcr_measurement *measurement_list;	/**< List of measurements in the PCR. */
 	struct pcr_config config;					/**< Configuration for the PCR and measurements. */
 	bool explicit_measurement;					/**< Flag to indicate that the PCR is an explicit measurement. */
+	uint8_t dirty_index;						/**< Index of the first measurement that must be re-extended. */
+	uint32_t generation;						/**< Counter updated on every change to the measurements. */
 	platform_mutex lock;						/**< Synchronization lock. */
 };
 
+/**
+ * Location of a single measurement entry in the TCG log for a PCR.
+ */
+struct pcr_tcg_log_position {
+	uint8_t measurement;	/**< Index of the measurement for the log entry. */
+	size_t offset;			/**< Offset of the log entry relative to a starting entry. */
+};
+
 #pragma pack(push, 1)
 /**
  * Header for the TCG_PCR_EVENT2 log structure.
@@ -225,6 +235,11 @@ int pcr_hash_measurement_data (struct pcr_bank *pcr, uint8_t measurement_index,
 
 int pcr_get_tcg_log (struct pcr_bank *pcr, uint32_t pcr_num, size_t offset, uint8_t *buffer,
 	size_t length, size_t *total_len);
+int pcr_get_tcg_log_from_position (struct pcr_bank *pcr, uint32_t pcr_num,
+	struct pcr_tcg_log_position *position, size_t offset, uint8_t *buffer, size_t length,
+	size_t *total_len);
+
+uint32_t pcr_get_generation (struct pcr_bank *pcr);
 
 int pcr_lock (struct pcr_bank *pcr);
 int pcr_unlock (struct pcr_bank *pcr);
@@ -42,6 +42,8 @@ int pcr_store_init (struct pcr_store *store, const struct pcr_config *pcr_config
 		return PCR_INVALID_ARGUMENT;
 	}
 
+	memset (store, 0, sizeof (struct pcr_store));
+
 	store->pcrs = platform_malloc (sizeof (struct pcr_bank) * num_pcrs);
 	if (store->pcrs == NULL) {
 		return PCR_NO_MEMORY;
@@ -49,6 +51,13 @@ int pcr_store_init (struct pcr_store *store, const struct pcr_config *pcr_config
 
 	store->num_pcrs = num_pcrs;
 
+	status = platform_mutex_init (&store->lock);
+	if (status != 0) {
+		platform_free (store->pcrs);
+
+		return status;
+	}
+
 	for (i = 0; i < num_pcrs; ++i) {
 		status = pcr_init (&store->pcrs[i], &pcr_config[i]);
 		if (status != 0) {
@@ -56,6 +65,7 @@ int pcr_store_init (struct pcr_store *store, const struct pcr_config *pcr_config
 				pcr_release (&store->pcrs[--i]);
 			}
 
+			platform_mutex_free (&store->lock);
 			platform_free (store->pcrs);
 
 			return status;
@@ -79,10 +89,31 @@ void pcr_store_release (struct pcr_store *store)
 			pcr_release (&store->pcrs[i]);
 		}
 
+		platform_mutex_free (&store->lock);
 		platform_free (store->pcrs);
 	}
 }
 
+/**
+ * Get the combined generation of all PCRs in the store.  Any change to a measurement in any PCR
+ * will cause this value to change.
+ *
+ * @param store The PCR store to query.
+ *
+ * @return The current generation of the PCR store.
+ */
+static uint32_t pcr_store_get_generation (struct pcr_store *store)
+{
+	uint32_t generation = 0;
+	size_t i;
+
+	for (i = 0; i < store->num_pcrs; i++) {
+		generation += pcr_get_generation (&store->pcrs[i]);
+	}
+
+	return generation;
+}
+
 /**
  * Indicate if a measurement type is valid for the PCR store.
  *
@@ -924,7 +955,12 @@ int pcr_store_get_attestation_log (struct pcr_store *store, struct hash_engine *
 #endif
 		}
 
-		i = 0;
+		/* Every entry for the PCR is the same length, so skip directly to the first entry that
+		 * contains data at the requested offset. */
+		i = min (offset / entry_length, (size_t) num_measurements);
+		offset -= i * entry_length;
+		entry_id += i;
+
 		while ((i < num_measurements) && (length > 0)) {
 			log_entry.base.header.log_magic = LOGGING_MAGIC_START;
 			log_entry.base.header.length = entry_length;
@@ -960,6 +996,10 @@ int pcr_store_get_attestation_log (struct pcr_store *store, struct hash_engine *
  * Only data that will fit into the provided buffer will be returned.  Additional calls with
  * different length/offset values would be needed to get the remaining data.
  *
+ * The location of the last read is saved.  If the next read is at a later offset and no
+ * measurements have changed, log generation resumes from the saved location rather than
+ * regenerating the log from the beginning.
+ *
  * @param store The PCR store to query for log data.
  * @param offset Offset within the log to start reading data.
  * @param buffer Output buffer to populate with requested log contents.
@@ -971,7 +1011,11 @@ int pcr_store_get_tcg_log (struct pcr_store *store, size_t offset, uint8_t *buff
 {
 	struct pcr_tcg_event v1_event;
 	struct pcr_tcg_log_header header;
+	struct pcr_store_tcg_log_cursor cursor;
+	struct pcr_tcg_log_position position;
 	size_t header_length;
+	size_t entry_offset;
+	uint32_t generation;
 	uint8_t algo_added = 0;
 	size_t num_bytes = 0;
 	size_t v1_length;
@@ -1050,20 +1094,41 @@ int pcr_store_get_tcg_log (struct pcr_store *store, size_t offset, uint8_t *buff
 
 	memset (v1_event.digest, 0, sizeof (v1_event.digest));
 
-	/* Add the v1 event header to the output buffer. */
-	v1_length = buffer_copy ((uint8_t*) &v1_event, sizeof (v1_event), &offset, &length, buffer);
-	num_bytes += v1_length;
-	buffer += v1_length;
+	generation = pcr_store_get_generation (store);
+
+	platform_mutex_lock (&store->lock);
+	cursor = store->tcg_cursor;
+	platform_mutex_unlock (&store->lock);
 
-	/* Add the TCG log header to the v1 event. */
-	v1_length = buffer_copy ((uint8_t*) &header, header_length, &offset, &length, buffer);
-	num_bytes += v1_length;
-	buffer += v1_length;
+	if (cursor.valid && (cursor.generation == generation) && (offset >= cursor.offset)) {
+		/* No measurements have changed since the last read, so resume from where it stopped. */
+		i = cursor.pcr;
+		position.measurement = cursor.measurement;
+		entry_offset = cursor.offset;
+		offset -= cursor.offset;
+	}
+	else {
+		/* Add the v1 event header to the output buffer. */
+		v1_length = buffer_copy ((uint8_t*) &v1_event, sizeof (v1_event), &offset, &length,
+			buffer);
+		num_bytes += v1_length;
+		buffer += v1_length;
+
+		/* Add the TCG log header to the v1 event. */
+		v1_length = buffer_copy ((uint8_t*) &header, header_length, &offset, &length, buffer);
+		num_bytes += v1_length;
+		buffer += v1_length;
+
+		i = 0;
+		position.measurement = 0;
+		entry_offset = sizeof (v1_event) + header_length;
+	}
 
 	/* Add measurements for each PCR. */
-	i = 0;
+	cursor.valid = false;
 	while ((i < store->num_pcrs) && (length > 0)) {
-		status = pcr_get_tcg_log (&store->pcrs[i], i, offset, buffer, length, &measurement_length);
+		status = pcr_get_tcg_log_from_position (&store->pcrs[i], i, &position, offset, buffer,
+			length, &measurement_length);
 		if (ROT_IS_ERROR (status)) {
 			return status;
 		}
@@ -1072,14 +1137,29 @@ int pcr_store_get_tcg_log (struct pcr_store *store, size_t offset, uint8_t *buff
 			offset -= measurement_length;
 		}
 		else {
+			cursor.pcr = i;
+			cursor.measurement = position.measurement;
+			cursor.offset = entry_offset + position.offset;
+			cursor.valid = true;
+
 			num_bytes += status;
 			buffer += status;
 			length -= status;
 			offset = 0;
 		}
 
+		entry_offset += measurement_length;
+		position.measurement = 0;
 		i++;
 	}
 
+	if (cursor.valid) {
+		cursor.generation = generation;
+
+		platform_mutex_lock (&store->lock);
+		store->tcg_cursor = cursor;
+		platform_mutex_unlock (&store->lock);
+	}
+
 	return num_bytes;
 }
@@ -4,9 +4,11 @@
 #ifndef PCR_STORE_H_
 #define PCR_STORE_H_
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "pcr.h"
 #include "pcr_data.h"
+#include "platform_api.h"
 #include "crypto/hash.h"
 #include "logging/logging.h"
 
@@ -20,12 +22,26 @@
 #define	PCR_MEASUREMENT(pcr, measurement)				(((pcr) << 8) | (measurement))
 
 
+/**
+ * Location in the TCG log where the last read stopped.  Sequential reads of the log resume from this
+ * location instead of regenerating all preceding log entries.
+ */
+struct pcr_store_tcg_log_cursor {
+	size_t offset;			/**< Log offset for the start of the entry at the cursor. */
+	uint32_t generation;	/**< Measurement generation for which the cursor is valid. */
+	uint8_t pcr;			/**< PCR containing the entry at the cursor. */
+	uint8_t measurement;	/**< Index of the measurement for the entry at the cursor. */
+	bool valid;				/**< Flag indicating the cursor contains a valid location. */
+};
+
 /**
  * Storage for all PCRs maintained by the device.
  */
 struct pcr_store {
-	struct pcr_bank *pcrs;	/**< List of individual PCRs for the device.*/
-	uint8_t num_pcrs;		/**< The number of PCRs in the list. */
+	struct pcr_bank *pcrs;							/**< List of individual PCRs for the device.*/
+	uint8_t num_pcrs;								/**< The number of PCRs in the list. */
+	struct pcr_store_tcg_log_cursor tcg_cursor;		/**< Location of the last TCG log read. */
+	platform_mutex lock;							/**< Synchronization for the log cursor. */
 };
 
 #pragma pack(push, 1)
@@ -7,6 +7,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include "common/authorized_execution.h"
+#include "crypto/ecc.h"
 #include "status/rot_status.h"
 
 
@@ -27,6 +28,18 @@ enum riot_cert_state {
 	RIOT_CERT_STATE_VALIDATING,			/**< The stored certificates are being authenticated. */
 };
 
+/**
+ * Status codes that will be reported for signing requests using the alias key.
+ */
+enum cmd_background_sign_status {
+	CMD_BACKGROUND_SIGN_STATUS_SUCCESS = 0,			/**< The signature was generated successfully. */
+	CMD_BACKGROUND_SIGN_STATUS_RUNNING,				/**< A signature is being generated. */
+	CMD_BACKGROUND_SIGN_STATUS_FAILURE,				/**< Signature generation failed. */
+	CMD_BACKGROUND_SIGN_STATUS_NONE_STARTED,		/**< No signing request has been made. */
+	CMD_BACKGROUND_SIGN_STATUS_TASK_NOT_RUNNING,	/**< The task servicing signing requests is not running. */
+	CMD_BACKGROUND_SIGN_STATUS_INTERNAL_ERROR,		/**< An unspecified, internal error occurred. */
+};
+
 
 /**
  * Interface for executing background operations from the command handler.
@@ -129,6 +142,39 @@ struct cmd_background {
 	 */
 	int (*get_riot_cert_chain_state) (const struct cmd_background *cmd);
 
+	/**
+	 * Sign a digest with the alias key.  The signature is generated in the background and can be
+	 * retrieved once signing has completed.
+	 *
+	 * @param cmd The background context for executing the operation.
+	 * @param ecc The ECC engine to use for signing.  The engine will be used from the background
+	 * task, so it must be safe to use concurrently with any other users of the engine.
+	 * @param digest The digest to sign.
+	 * @param length Length of the digest.
+	 *
+	 * @return 0 if the operation was successfully scheduled or an error code.
+	 */
+	int (*alias_sign_start) (const struct cmd_background *cmd, struct ecc_engine *ecc,
+		const uint8_t *digest, size_t length);
+
+	/**
+	 * Get the result of the last signing request for the alias key.
+	 *
+	 * @param cmd The background context for executing the operation.
+	 * @param signature Output for the DER encoded ECDSA signature.
+	 * @param sig_length Length of the signature buffer as input, then signature length as output.
+	 * This will be 0 if the signing operation has not successfully completed.
+	 * @param sign_status Output buffer with the signing status.  The lower 8 bits will be the status
+	 * as per {@link enum cmd_background_sign_status}.  The rest of the bits will be the return code
+	 * from the operation.
+	 * @param sign_time Optional output for the time, in milliseconds, it took to generate the
+	 * signature.  This is only updated when a signature is returned.
+	 *
+	 * @return 0 if completed successfully or an error code.
+	 */
+	int (*alias_sign_result) (const struct cmd_background *cmd, uint8_t *signature,
+		size_t *sig_length, uint32_t *sign_status, uint32_t *sign_time);
+
 	/**
 	 * Execute a warm reset of the device.  The reset will be delayed in order for any necessary
 	 * command response data to be sent.
@@ -9,6 +9,7 @@
 #include "cerberus_protocol_optional_commands.h"
 #include "cmd_background_handler.h"
 #include "cmd_logging.h"
+#include "platform_api.h"
 #include "common/buffer_util.h"
 #include "common/type_cast.h"
 #include "common/unused.h"
@@ -229,6 +230,68 @@ int cmd_background_handler_get_riot_cert_chain_state (const struct cmd_backgroun
 	return status;
 }
 
+int cmd_background_handler_alias_sign_start (const struct cmd_background *cmd,
+	struct ecc_engine *ecc, const uint8_t *digest, size_t length)
+{
+	const struct cmd_background_handler *handler = (const struct cmd_background_handler*) cmd;
+	struct cmd_background_handler_alias_sign sign;
+
+	if ((handler == NULL) || (ecc == NULL) || (digest == NULL) || (length == 0)) {
+		return CMD_BACKGROUND_INVALID_ARGUMENT;
+	}
+
+	if (length > sizeof (sign.digest)) {
+		return CMD_BACKGROUND_INPUT_TOO_BIG;
+	}
+
+	memset (&sign, 0, sizeof (sign));
+	sign.ecc = ecc;
+	sign.length = length;
+	memcpy (sign.digest, digest, length);
+
+	return cmd_background_handler_submit_event (handler, CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN,
+		(uint8_t*) &sign, sizeof (sign), CMD_BACKGROUND_SIGN_STATUS_RUNNING,
+		CMD_BACKGROUND_SIGN_STATUS_TASK_NOT_RUNNING, CMD_BACKGROUND_SIGN_STATUS_INTERNAL_ERROR,
+		&handler->state->sign_status);
+}
+
+int cmd_background_handler_alias_sign_result (const struct cmd_background *cmd,
+	uint8_t *signature, size_t *sig_length, uint32_t *sign_status, uint32_t *sign_time)
+{
+	const struct cmd_background_handler *handler = (const struct cmd_background_handler*) cmd;
+	int status = 0;
+
+	if ((handler == NULL) || (signature == NULL) || (sig_length == NULL) || (sign_status == NULL)) {
+		return CMD_BACKGROUND_INVALID_ARGUMENT;
+	}
+
+	handler->task->lock (handler->task);
+
+	buffer_unaligned_write32 (sign_status, handler->state->sign_status);
+
+	if (handler->state->sign_status == CMD_BACKGROUND_SIGN_STATUS_SUCCESS) {
+		if (*sig_length < handler->state->sig_length) {
+			status = CMD_BACKGROUND_BUF_TOO_SMALL;
+		}
+		else {
+			memcpy (signature, handler->state->signature, handler->state->sig_length);
+			*sig_length = handler->state->sig_length;
+			if (sign_time != NULL) {
+				buffer_unaligned_write32 (sign_time, handler->state->sign_time);
+			}
+
+			handler->state->sign_status = CMD_BACKGROUND_SIGN_STATUS_NONE_STARTED;
+		}
+	}
+	else {
+		*sig_length = 0;
+	}
+
+	handler->task->unlock (handler->task);
+
+	return status;
+}
+
 int cmd_background_handler_reboot_device (const struct cmd_background *cmd)
 {
 	const struct cmd_background_handler *handler = (const struct cmd_background_handler*) cmd;
@@ -241,6 +304,38 @@ int cmd_background_handler_reboot_device (const struct cmd_background *cmd)
 		CMD_BACKGROUND_HANDLER_ACTION_REBOOT_DEVICE, NULL, 0, 0, 0, 0, NULL);
 }
 
+/**
+ * Sign a digest with the alias key.  The RIoT keys are only held while the key is loaded, so
+ * signing does not block other users of the device keys.
+ *
+ * @param handler The background handler executing the request.
+ * @param sign The signing request to execute.
+ *
+ * @return Length of the DER encoded signature or an error code.
+ */
+static int cmd_background_handler_sign_with_alias_key (const struct cmd_background_handler *handler,
+	const struct cmd_background_handler_alias_sign *sign)
+{
+	const struct riot_keys *keys;
+	struct ecc_private_key alias_key;
+	int status;
+
+	keys = riot_key_manager_get_riot_keys (handler->keys);
+	status = sign->ecc->init_key_pair (sign->ecc, keys->alias_key, keys->alias_key_length,
+		&alias_key, NULL);
+	riot_key_manager_release_riot_keys (handler->keys, keys);
+	if (status != 0) {
+		return status;
+	}
+
+	status = sign->ecc->sign (sign->ecc, &alias_key, sign->digest, sign->length,
+		handler->state->signature, sizeof (handler->state->signature));
+
+	sign->ecc->release_key_pair (sign->ecc, &alias_key, NULL);
+
+	return status;
+}
+
 void cmd_background_handler_execute (const struct event_task_handler *handler,
 	struct event_task_context *context, bool *reset)
 {
@@ -350,6 +445,30 @@ void cmd_background_handler_execute (const struct event_task_handler *handler,
 			}
 			break;
 
+		case CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN: {
+			const struct cmd_background_handler_alias_sign *sign =
+				(const struct cmd_background_handler_alias_sign*) context->event_buffer;
+			platform_clock start;
+			platform_clock end;
+
+			op_status = &cmd->state->sign_status;
+
+			platform_init_current_tick (&start);
+			status = cmd_background_handler_sign_with_alias_key (cmd, sign);
+			platform_init_current_tick (&end);
+
+			if (ROT_IS_ERROR (status)) {
+				cmd->state->sig_length = 0;
+				status = CMD_BACKGROUND_STATUS (CMD_BACKGROUND_SIGN_STATUS_FAILURE, status);
+			}
+			else {
+				cmd->state->sig_length = status;
+				cmd->state->sign_time = platform_get_duration (&start, &end);
+				status = CMD_BACKGROUND_SIGN_STATUS_SUCCESS;
+			}
+			break;
+		}
+
 #ifdef ATTESTATION_SUPPORT_RSA_UNSEAL
 		case CMD_BACKGROUND_HANDLER_ACTION_AUX_KEY_GEN:
 			status =
@@ -387,6 +506,10 @@ void cmd_background_handler_execute (const struct event_task_handler *handler,
 				op_status = &cmd->state->cert_state;
 				status = CMD_BACKGROUND_STATUS (RIOT_CERT_STATE_CHAIN_INVALID, status);
 			}
+			if (cmd->state->sign_status == CMD_BACKGROUND_SIGN_STATUS_RUNNING) {
+				op_status = &cmd->state->sign_status;
+				status = CMD_BACKGROUND_STATUS (CMD_BACKGROUND_SIGN_STATUS_INTERNAL_ERROR, status);
+			}
 			break;
 	}
 
@@ -452,6 +575,8 @@ int cmd_background_handler_init (struct cmd_background_handler *handler,
 	/* RIoT operations. */
 	handler->base_cmd.authenticate_riot_certs = cmd_background_handler_authenticate_riot_certs;
 	handler->base_cmd.get_riot_cert_chain_state = cmd_background_handler_get_riot_cert_chain_state;
+	handler->base_cmd.alias_sign_start = cmd_background_handler_alias_sign_start;
+	handler->base_cmd.alias_sign_result = cmd_background_handler_alias_sign_result;
 
 	/* Device operations */
 	handler->base_cmd.reboot_device = cmd_background_handler_reboot_device;
@@ -483,6 +608,7 @@ int cmd_background_handler_init_state (const struct cmd_background_handler *hand
 
 	handler->state->cert_state = (riot_key_manager_get_root_ca (handler->keys) == NULL) ?
 			RIOT_CERT_STATE_CHAIN_INVALID : RIOT_CERT_STATE_CHAIN_VALID;
+	handler->state->sign_status = CMD_BACKGROUND_SIGN_STATUS_NONE_STARTED;
 
 #ifdef CMD_ENABLE_UNSEAL
 	handler->state->attestation_status = ATTESTATION_CMD_STATUS_NONE_STARTED;
@@ -5,6 +5,7 @@
 #define CMD_BACKGROUND_HANDLER_H_
 
 #include <stdbool.h>
+#include "asn1/ecc_der_util.h"
 #include "attestation/attestation_responder.h"
 #include "cmd_interface/cmd_background.h"
 #include "cmd_interface/config_reset.h"
@@ -24,6 +25,16 @@ enum {
 	CMD_BACKGROUND_HANDLER_ACTION_AUX_KEY_GEN,		/**< Generate the aux attestation key. */
 	CMD_BACKGROUND_HANDLER_ACTION_REBOOT_DEVICE,	/**< Warm reset the device. */
 	CMD_BACKGROUND_HANDLER_ACTION_AUTHORIZED_OP,	/**< Execute an arbitrary authorized operation. */
+	CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN,		/**< Sign a digest with the alias key. */
+};
+
+/**
+ * Event data for a signing request using the alias key.
+ */
+struct cmd_background_handler_alias_sign {
+	struct ecc_engine *ecc;				/**< ECC engine to use for signing. */
+	size_t length;						/**< Length of the digest. */
+	uint8_t digest[HASH_MAX_HASH_LEN];	/**< Digest to sign. */
 };
 
 
@@ -31,14 +42,18 @@ enum {
  * Variable context for background command processing.
  */
 struct cmd_background_handler_state {
-	int cert_state;								/**< Certificate authentication state. */
+	int cert_state;									/**< Certificate authentication state. */
+	int sign_status;								/**< Status of the alias key signing request. */
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];	/**< Buffer for the alias key signature. */
+	size_t sig_length;								/**< Length of the alias key signature. */
+	uint32_t sign_time;								/**< Time taken to generate the signature, in milliseconds. */
 #ifdef CMD_ENABLE_UNSEAL
-	int attestation_status;						/**< The attestation operation status. */
-	uint8_t *unseal_request;					/**< The current unseal request. */
-	uint8_t key[AUX_ATTESTATION_KEY_256BIT];	/**< Buffer for the unsealed key. */
+	int attestation_status;							/**< The attestation operation status. */
+	uint8_t *unseal_request;						/**< The current unseal request. */
+	uint8_t key[AUX_ATTESTATION_KEY_256BIT];		/**< Buffer for the unsealed key. */
 #endif
 #ifdef CMD_ENABLE_RESET_CONFIG
-	int config_status;							/**< Status for configuration operations. */
+	int config_status;								/**< Status for configuration operations. */
 #endif
 };
 
@@ -19,6 +19,10 @@ int cmd_background_handler_debug_log_clear (const struct cmd_background *cmd);
 int cmd_background_handler_debug_log_fill (const struct cmd_background *cmd);
 int cmd_background_handler_authenticate_riot_certs (const struct cmd_background *cmd);
 int cmd_background_handler_get_riot_cert_chain_state (const struct cmd_background *cmd);
+int cmd_background_handler_alias_sign_start (const struct cmd_background *cmd,
+	struct ecc_engine *ecc, const uint8_t *digest, size_t length);
+int cmd_background_handler_alias_sign_result (const struct cmd_background *cmd,
+	uint8_t *signature, size_t *sig_length, uint32_t *sign_status, uint32_t *sign_time);
 int cmd_background_handler_reboot_device (const struct cmd_background *cmd);
 
 
@@ -76,6 +80,8 @@ int cmd_background_handler_reboot_device (const struct cmd_background *cmd);
 		CMD_BACKGROUND_HANDLER_DEBUG_LOG_API \
 		.authenticate_riot_certs = cmd_background_handler_authenticate_riot_certs, \
 		.get_riot_cert_chain_state = cmd_background_handler_get_riot_cert_chain_state, \
+		.alias_sign_start = cmd_background_handler_alias_sign_start, \
+		.alias_sign_result = cmd_background_handler_alias_sign_result, \
 		.reboot_device = cmd_background_handler_reboot_device, \
 	}
 
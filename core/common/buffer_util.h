@@ -20,8 +20,10 @@
  * @return 0 if the buffers do not overlap, 1 if they do.
  */
 #define buffer_are_overlapping(buf1, buf1_len, buf2, buf2_len) \
-	(((buf1 >= buf2) && (buf1 < (buf2 + buf2_len))) || \
-		((buf2 >= buf1) && (buf2 < (buf1 + buf1_len))))
+	((((const uint8_t*) (buf1) >= (const uint8_t*) (buf2)) && \
+		((const uint8_t*) (buf1) < ((const uint8_t*) (buf2) + (buf2_len)))) || \
+		(((const uint8_t*) (buf2) >= (const uint8_t*) (buf1)) && \
+		((const uint8_t*) (buf2) < ((const uint8_t*) (buf1) + (buf1_len)))))
 
 
 size_t buffer_copy (const uint8_t *src, size_t src_length, size_t *offset, size_t *dest_length,
@@ -19,6 +19,21 @@
  */
 #define	AES256_KEY_LENGTH		32
 
+/**
+ * The AES block size.  Data provided to streaming operations should be aligned to this size.
+ */
+#define	AES_BLOCK_SIZE			16
+
+
+/**
+ * The type of streaming AES-GCM operation active on an engine.
+ */
+enum aes_stream_type {
+	AES_STREAM_NONE = 0,	/**< No streaming operation is active. */
+	AES_STREAM_ENCRYPT,		/**< A streaming encryption operation is active. */
+	AES_STREAM_DECRYPT,		/**< A streaming decryption operation is active. */
+};
+
 
 /**
  * A platform-independent API for encrypting data using AES.  AES engine instances are not
@@ -127,6 +142,111 @@ struct aes_engine {
 		size_t length, const uint8_t *tag, const uint8_t *iv, size_t iv_length,
 		const uint8_t *additional_data, size_t additional_data_length, uint8_t *plaintext,
 		size_t out_length);
+
+	/**
+	 * Start a streaming AES-GCM encryption.  This allows data that is not contiguous in memory to
+	 * be encrypted as a single message.  The operation must be initialized with a key prior to
+	 * calling this function.
+	 *
+	 * Only one streaming operation can be active at a time.  While an operation is active, the key
+	 * cannot be changed and single-call encryption and decryption are not available.  The operation
+	 * must be completed with finish_encrypt or discarded with cancel.
+	 *
+	 * @param engine The AES engine to use for encryption.
+	 * @param iv The initialization vector to use for encryption.  The IV does not need to remain in
+	 * scope for the rest of the operation.
+	 * @param iv_length The length of the IV.  A 12-byte IV is best.
+	 *
+	 * @return 0 if the encryption was started successfully or an error code.
+	 */
+	int (*start_encrypt) (struct aes_engine *engine, const uint8_t *iv, size_t iv_length);
+
+	/**
+	 * Start a streaming AES-GCM decryption.  This allows data that is not contiguous in memory to
+	 * be decrypted as a single message.  The operation must be initialized with a key prior to
+	 * calling this function.
+	 *
+	 * The same restrictions apply as for streaming encryption.  The operation must be completed with
+	 * finish_decrypt or discarded with cancel.
+	 *
+	 * @param engine The AES engine to use for decryption.
+	 * @param iv The initialization vector used to generate the ciphertext.  The IV does not need to
+	 * remain in scope for the rest of the operation.
+	 * @param iv_length The length of the IV.
+	 *
+	 * @return 0 if the decryption was started successfully or an error code.
+	 */
+	int (*start_decrypt) (struct aes_engine *engine, const uint8_t *iv, size_t iv_length);
+
+	/**
+	 * Provide data to include in MAC generation or validation for the active streaming operation.
+	 * All additional data must be provided before any data is encrypted or decrypted.
+	 *
+	 * Some implementations only support providing additional data in a single call.
+	 * AES_UNSUPPORTED_OPERATION will be reported by these implementations for subsequent calls.
+	 *
+	 * @param engine The AES engine to update.
+	 * @param additional_data The data to be included in MAC calculation.
+	 * @param length The length of the additional data.
+	 *
+	 * @return 0 if the additional data was processed successfully or an error code.
+	 */
+	int (*update_add_data) (struct aes_engine *engine, const uint8_t *additional_data,
+		size_t length);
+
+	/**
+	 * Encrypt or decrypt the next block of data for the active streaming operation.  Output is
+	 * generated for all input data, so the output will be the same length as the input.
+	 *
+	 * Every call except the last one must provide data that is a multiple of AES_BLOCK_SIZE.  Some
+	 * implementations will not generate the correct output if this requirement is not met.
+	 *
+	 * @param engine The AES engine to update.
+	 * @param input The data to encrypt or decrypt.
+	 * @param length The amount of data to process.
+	 * @param output The buffer to hold the processed data.  This buffer may be the same as the
+	 * input buffer.
+	 * @param out_length The size of the output buffer.
+	 *
+	 * @return 0 if the data was processed successfully or an error code.
+	 */
+	int (*update) (struct aes_engine *engine, const uint8_t *input, size_t length,
+		uint8_t *output, size_t out_length);
+
+	/**
+	 * Complete the active streaming encryption and generate the GCM authentication tag.  If the
+	 * parameters are not valid, the operation remains active.
+	 *
+	 * @param engine The AES engine to finish.
+	 * @param tag The buffer to hold the GCM authentication tag.  All tags will be 16 bytes.
+	 * @param tag_length The size of the tag output buffer.
+	 *
+	 * @return 0 if the encryption completed successfully or an error code.
+	 */
+	int (*finish_encrypt) (struct aes_engine *engine, uint8_t *tag, size_t tag_length);
+
+	/**
+	 * Complete the active streaming decryption and authenticate the data.  If no tag is
+	 * provided, the operation remains active.  Otherwise, the operation will no longer be active
+	 * after authentication, whether or not it succeeded.
+	 *
+	 * Decrypted data has been generated before the tag is checked, so output from update calls must
+	 * not be used unless this call succeeds.
+	 *
+	 * @param engine The AES engine to finish.
+	 * @param tag The GCM tag for the ciphertext.  This must be 16 bytes.
+	 *
+	 * @return 0 if the decrypted data was authenticated or an error code.
+	 */
+	int (*finish_decrypt) (struct aes_engine *engine, const uint8_t *tag);
+
+	/**
+	 * Discard the active streaming operation.  The engine will be ready for new operations using
+	 * the current key.
+	 *
+	 * @param engine The AES engine to cancel.
+	 */
+	void (*cancel) (struct aes_engine *engine);
 };
 
 
@@ -149,6 +269,9 @@ enum {
 	AES_ENGINE_HW_NOT_INIT = AES_ENGINE_ERROR (0x0a),				/**< The AES hardware has not been initialized. */
 	AES_ENGINE_SELF_TEST_FAILED = AES_ENGINE_ERROR (0x0b),			/**< An internal self-test of the AES engine failed. */
 	AES_UNSUPPORTED_OPERATION = AES_ENGINE_ERROR (0x0c),			/**< The requested operation is not supported. */
+	AES_ENGINE_NO_ACTIVE_OPERATION = AES_ENGINE_ERROR (0x0d),		/**< No streaming operation of the requested type has been started. */
+	AES_ENGINE_OPERATION_IN_PROGRESS = AES_ENGINE_ERROR (0x0e),		/**< A streaming operation is active on the engine. */
+	AES_ENGINE_UNALIGNED_DATA = AES_ENGINE_ERROR (0x0f),			/**< Streaming data was provided after an update that was not block aligned. */
 };
 
 
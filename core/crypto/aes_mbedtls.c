@@ -18,6 +18,10 @@ static int aes_mbedtls_set_key (struct aes_engine *engine, const uint8_t *key, s
 		return AES_ENGINE_INVALID_ARGUMENT;
 	}
 
+	if (mbedtls->stream != AES_STREAM_NONE) {
+		return AES_ENGINE_OPERATION_IN_PROGRESS;
+	}
+
 	switch (length) {
 		case (128 / 8):
 		case (192 / 8):
@@ -59,6 +63,10 @@ static int aes_mbedtls_encrypt_with_add_data (struct aes_engine *engine, const u
 		return AES_ENGINE_OUT_BUFFER_TOO_SMALL;
 	}
 
+	if (mbedtls->stream != AES_STREAM_NONE) {
+		return AES_ENGINE_OPERATION_IN_PROGRESS;
+	}
+
 	if (mbedtls->context.cipher_ctx.key_bitlen == 0) {
 		return AES_ENGINE_NO_KEY;
 	}
@@ -100,6 +108,10 @@ static int aes_mbedtls_decrypt_with_add_data (struct aes_engine *engine, const u
 		return AES_ENGINE_OUT_BUFFER_TOO_SMALL;
 	}
 
+	if (mbedtls->stream != AES_STREAM_NONE) {
+		return AES_ENGINE_OPERATION_IN_PROGRESS;
+	}
+
 	if (mbedtls->context.cipher_ctx.key_bitlen == 0) {
 		return AES_ENGINE_NO_KEY;
 	}
@@ -127,6 +139,247 @@ static int aes_mbedtls_decrypt_data (struct aes_engine *engine, const uint8_t *c
 		0, plaintext, out_length);
 }
 
+/**
+ * Start a streaming AES-GCM operation.  mbedTLS requires all additional data to be provided when
+ * the GCM context is started, so starting the context is deferred until the first update.
+ *
+ * @param engine The AES engine to start.
+ * @param iv The IV for the operation.
+ * @param iv_length Length of the IV.
+ * @param type The type of operation to start.
+ *
+ * @return 0 if the operation was started successfully or an error code.
+ */
+static int aes_mbedtls_start (struct aes_engine *engine, const uint8_t *iv, size_t iv_length,
+	enum aes_stream_type type)
+{
+	struct aes_engine_mbedtls *mbedtls = (struct aes_engine_mbedtls*) engine;
+
+	if ((mbedtls == NULL) || (iv == NULL) || (iv_length == 0) ||
+		(iv_length > sizeof (mbedtls->stream_iv))) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (mbedtls->stream != AES_STREAM_NONE) {
+		return AES_ENGINE_OPERATION_IN_PROGRESS;
+	}
+
+	if (mbedtls->context.cipher_ctx.key_bitlen == 0) {
+		return AES_ENGINE_NO_KEY;
+	}
+
+	memcpy (mbedtls->stream_iv, iv, iv_length);
+	mbedtls->stream_iv_length = iv_length;
+	mbedtls->stream_started = false;
+	mbedtls->stream_unaligned = false;
+	mbedtls->stream = type;
+
+	return 0;
+}
+
+static int aes_mbedtls_start_encrypt (struct aes_engine *engine, const uint8_t *iv,
+	size_t iv_length)
+{
+	return aes_mbedtls_start (engine, iv, iv_length, AES_STREAM_ENCRYPT);
+}
+
+static int aes_mbedtls_start_decrypt (struct aes_engine *engine, const uint8_t *iv,
+	size_t iv_length)
+{
+	return aes_mbedtls_start (engine, iv, iv_length, AES_STREAM_DECRYPT);
+}
+
+/**
+ * Start the GCM context for the active streaming operation.
+ *
+ * @param mbedtls The AES engine to start.
+ * @param additional_data Additional data to include in the MAC.  Null if there is no data.
+ * @param length Length of the additional data.
+ *
+ * @return 0 if the context was started successfully or an error code.
+ */
+static int aes_mbedtls_start_context (struct aes_engine_mbedtls *mbedtls,
+	const uint8_t *additional_data, size_t length)
+{
+	int mode = (mbedtls->stream == AES_STREAM_ENCRYPT) ? MBEDTLS_GCM_ENCRYPT : MBEDTLS_GCM_DECRYPT;
+	int status;
+
+	status = mbedtls_gcm_starts (&mbedtls->context, mode, mbedtls->stream_iv,
+		mbedtls->stream_iv_length, additional_data, length);
+	if (status != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_CRYPTO,
+			CRYPTO_LOG_MSG_MBEDTLS_AES_GCM_CRYPT_EC, status, 0);
+
+		return status;
+	}
+
+	mbedtls->stream_started = true;
+
+	return 0;
+}
+
+static int aes_mbedtls_update_add_data (struct aes_engine *engine, const uint8_t *additional_data,
+	size_t length)
+{
+	struct aes_engine_mbedtls *mbedtls = (struct aes_engine_mbedtls*) engine;
+
+	if ((mbedtls == NULL) || (additional_data == NULL)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (mbedtls->stream == AES_STREAM_NONE) {
+		return AES_ENGINE_NO_ACTIVE_OPERATION;
+	}
+
+	if (mbedtls->stream_started) {
+		return AES_UNSUPPORTED_OPERATION;
+	}
+
+	return aes_mbedtls_start_context (mbedtls, additional_data, length);
+}
+
+static int aes_mbedtls_update (struct aes_engine *engine, const uint8_t *input, size_t length,
+	uint8_t *output, size_t out_length)
+{
+	struct aes_engine_mbedtls *mbedtls = (struct aes_engine_mbedtls*) engine;
+	int status;
+
+	if ((mbedtls == NULL) || (input == NULL) || (output == NULL)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (out_length < length) {
+		return AES_ENGINE_OUT_BUFFER_TOO_SMALL;
+	}
+
+	if (mbedtls->stream == AES_STREAM_NONE) {
+		return AES_ENGINE_NO_ACTIVE_OPERATION;
+	}
+
+	if (length == 0) {
+		return 0;
+	}
+
+	/* mbedTLS can only process a partial block at the end of the data. */
+	if (mbedtls->stream_unaligned) {
+		return AES_ENGINE_UNALIGNED_DATA;
+	}
+
+	if (!mbedtls->stream_started) {
+		status = aes_mbedtls_start_context (mbedtls, NULL, 0);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	status = mbedtls_gcm_update (&mbedtls->context, length, input, output);
+	if (status != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_CRYPTO,
+			CRYPTO_LOG_MSG_MBEDTLS_AES_GCM_CRYPT_EC, status, 0);
+
+		return status;
+	}
+
+	mbedtls->stream_unaligned = ((length % AES_BLOCK_SIZE) != 0);
+
+	return 0;
+}
+
+/**
+ * Generate the GCM tag for the active streaming operation.  The operation is no longer active after
+ * the tag has been generated.
+ *
+ * @param mbedtls The AES engine to finish.
+ * @param tag Output for the GCM tag.
+ *
+ * @return 0 if the tag was generated successfully or an error code.
+ */
+static int aes_mbedtls_finish (struct aes_engine_mbedtls *mbedtls, uint8_t *tag)
+{
+	int status = 0;
+
+	if (!mbedtls->stream_started) {
+		status = aes_mbedtls_start_context (mbedtls, NULL, 0);
+	}
+
+	mbedtls->stream = AES_STREAM_NONE;
+	if (status != 0) {
+		return status;
+	}
+
+	status = mbedtls_gcm_finish (&mbedtls->context, tag, AES_TAG_LENGTH);
+	if (status != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_CRYPTO,
+			CRYPTO_LOG_MSG_MBEDTLS_AES_GCM_CRYPT_EC, status, 0);
+	}
+
+	return status;
+}
+
+static int aes_mbedtls_finish_encrypt (struct aes_engine *engine, uint8_t *tag, size_t tag_length)
+{
+	struct aes_engine_mbedtls *mbedtls = (struct aes_engine_mbedtls*) engine;
+
+	if ((mbedtls == NULL) || (tag == NULL)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (tag_length < AES_TAG_LENGTH) {
+		return AES_ENGINE_OUT_BUFFER_TOO_SMALL;
+	}
+
+	if (mbedtls->stream != AES_STREAM_ENCRYPT) {
+		return AES_ENGINE_NO_ACTIVE_OPERATION;
+	}
+
+	return aes_mbedtls_finish (mbedtls, tag);
+}
+
+static int aes_mbedtls_finish_decrypt (struct aes_engine *engine, const uint8_t *tag)
+{
+	struct aes_engine_mbedtls *mbedtls = (struct aes_engine_mbedtls*) engine;
+	uint8_t check[AES_TAG_LENGTH];
+	uint8_t diff = 0;
+	size_t i;
+	int status;
+
+	if ((mbedtls == NULL) || (tag == NULL)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (mbedtls->stream != AES_STREAM_DECRYPT) {
+		return AES_ENGINE_NO_ACTIVE_OPERATION;
+	}
+
+	status = aes_mbedtls_finish (mbedtls, check);
+	if (status != 0) {
+		return status;
+	}
+
+	/* Compare the tag in constant time. */
+	for (i = 0; i < sizeof (check); i++) {
+		diff |= check[i] ^ tag[i];
+	}
+
+	if (diff != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_CRYPTO,
+			CRYPTO_LOG_MSG_MBEDTLS_AES_GCM_AUTH_DECRYPT_EC, MBEDTLS_ERR_GCM_AUTH_FAILED, 0);
+
+		return AES_ENGINE_GCM_AUTH_FAILED;
+	}
+
+	return 0;
+}
+
+static void aes_mbedtls_cancel (struct aes_engine *engine)
+{
+	struct aes_engine_mbedtls *mbedtls = (struct aes_engine_mbedtls*) engine;
+
+	if (mbedtls) {
+		mbedtls->stream = AES_STREAM_NONE;
+	}
+}
+
 /**
  * Initialize an instance for run AES operations using mbedTLS.
  *
@@ -149,6 +402,13 @@ int aes_mbedtls_init (struct aes_engine_mbedtls *engine)
 	engine->base.decrypt_data = aes_mbedtls_decrypt_data;
 	engine->base.decrypt_with_add_data = aes_mbedtls_decrypt_with_add_data;
 	engine->base.encrypt_with_add_data = aes_mbedtls_encrypt_with_add_data;
+	engine->base.start_encrypt = aes_mbedtls_start_encrypt;
+	engine->base.start_decrypt = aes_mbedtls_start_decrypt;
+	engine->base.update_add_data = aes_mbedtls_update_add_data;
+	engine->base.update = aes_mbedtls_update;
+	engine->base.finish_encrypt = aes_mbedtls_finish_encrypt;
+	engine->base.finish_decrypt = aes_mbedtls_finish_decrypt;
+	engine->base.cancel = aes_mbedtls_cancel;
 
 	return 0;
 }
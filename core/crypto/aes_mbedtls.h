@@ -4,16 +4,28 @@
 #ifndef AES_MBEDTLS_H_
 #define AES_MBEDTLS_H_
 
+#include <stdbool.h>
 #include "aes.h"
 #include "mbedtls/gcm.h"
 
 
+/**
+ * The longest IV that can be used for streaming operations.
+ */
+#define	AES_MBEDTLS_MAX_STREAM_IV_LENGTH		16
+
+
 /**
  * An mbedTLS context for AES operations.
  */
 struct aes_engine_mbedtls {
 	struct aes_engine base;			/**< The base AES engine. */
 	mbedtls_gcm_context context;	/**< Context for AES-GCM operations. */
+	enum aes_stream_type stream;	/**< The type of active streaming operation. */
+	bool stream_started;			/**< Flag indicating the GCM context has been started. */
+	bool stream_unaligned;			/**< Flag indicating the last update was not block aligned. */
+	uint8_t stream_iv[AES_MBEDTLS_MAX_STREAM_IV_LENGTH];	/**< IV for the active stream. */
+	size_t stream_iv_length;		/**< Length of the IV for the active stream. */
 };
 
 
@@ -4,13 +4,37 @@
 #ifndef CHECKSUM_H_
 #define CHECKSUM_H_
 
+#include <stddef.h>
 #include <stdint.h>
 
 
+/* Available implementations for CRC calculations. */
+#define	CHECKSUM_CRC_BITWISE		0	/**< Process one bit at a time.  Smallest code size. */
+#define	CHECKSUM_CRC_TABLE			1	/**< Process one byte at a time using a 256-entry table. */
+#define	CHECKSUM_CRC_SLICE_BY_4		2	/**< Process four bytes at a time using four tables. */
+
+/**
+ * The implementation to use for all CRC calculations.  Table-driven implementations trade read-only
+ * memory for speed.  The CRC8 tables need 256 bytes each and the CRC-32C tables need 1kB each.
+ */
+#ifndef CHECKSUM_CRC_IMPLEMENTATION
+#define	CHECKSUM_CRC_IMPLEMENTATION		CHECKSUM_CRC_TABLE
+#endif
+
+#if ((CHECKSUM_CRC_IMPLEMENTATION != CHECKSUM_CRC_BITWISE) && \
+	(CHECKSUM_CRC_IMPLEMENTATION != CHECKSUM_CRC_TABLE) && \
+	(CHECKSUM_CRC_IMPLEMENTATION != CHECKSUM_CRC_SLICE_BY_4))
+#error "Invalid CRC implementation."
+#endif
+
+
 uint8_t checksum_crc8 (uint8_t smbus_addr, const uint8_t *data, uint8_t len);
 
 uint8_t checksum_init_smbus_crc8 (uint8_t smbus_addr);
 uint8_t checksum_update_smbus_crc8 (uint8_t crc, const uint8_t *data, uint8_t len);
 
+uint32_t checksum_crc32c (const uint8_t *data, size_t len);
+uint32_t checksum_update_crc32c (uint32_t crc, const uint8_t *data, size_t len);
+
 
 #endif	//CHECKSUM_H_
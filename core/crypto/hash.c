@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "hash.h"
+#include "common/buffer_util.h"
 
 
 /**
@@ -129,6 +130,38 @@ int hash_calculate (struct hash_engine *engine, enum hash_type type, const uint8
 	return status;
 }
 
+/**
+ * Start a hash operation on one engine that continues from the current state of a hash operation
+ * on another engine.  After the clone, the two hash operations are independent and each must be
+ * either finished or canceled.
+ *
+ * Both engines must be the same type of hash implementation.
+ *
+ * @param engine The hash engine with the active hash operation to clone.
+ * @param clone The hash engine that will start the cloned hash operation.  This cannot be the same
+ * engine as the one being cloned.
+ *
+ * @return 0 if the hash operation was cloned successfully or an error code.
+ */
+int hash_clone_context (struct hash_engine *engine, struct hash_engine *clone)
+{
+	struct hash_context context;
+	int status;
+
+	if ((engine == NULL) || (clone == NULL) || (engine == clone)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	status = engine->save_context (engine, &context);
+	if (status == 0) {
+		status = clone->restore_context (clone, &context);
+	}
+
+	buffer_zeroize (&context, sizeof (context));
+
+	return status;
+}
+
 /**
  * Get the length of the output digest for the indicated hash algorithm.
  *
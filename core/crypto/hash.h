@@ -53,6 +53,25 @@ enum {
 	HASH_ACTIVE_NONE = 0xff,			/**< No hash context is active. */
 };
 
+/**
+ * Maximum size of the intermediate state for a hash operation.  This is large enough to hold the
+ * SHA2-512 state for any of the supported hash implementations.
+ */
+#define	HASH_MAX_CONTEXT_STATE_LENGTH	224
+
+/**
+ * The saved state of an in-progress hash operation.  A saved context allows a hash to be forked or
+ * suspended and resumed later, so a single engine can be used to calculate many interleaved hashes.
+ *
+ * The contents of the state are specific to the hash implementation that saved it.  A context can
+ * only be restored by an engine of the same type.
+ */
+struct hash_context {
+	uint8_t active;									/**< The type of hash saved in the context. */
+	uint16_t length;								/**< Length of the saved hash state. */
+	uint8_t state[HASH_MAX_CONTEXT_STATE_LENGTH];	/**< The intermediate hash state. */
+};
+
 
 /**
  * A platform-independent API for calculating hashes.  Hash engine instances are not guaranteed to
@@ -219,6 +238,32 @@ struct hash_engine {
 	 * @param engine The hash engine to cancel.
 	 */
 	void (*cancel) (struct hash_engine *engine);
+
+	/**
+	 * Save the intermediate state of the current hash operation.
+	 *
+	 * The hash engine is still in-progress after the call and must be either finished or
+	 * canceled later.
+	 *
+	 * @param engine The hash engine to save the state from.
+	 * @param context Output for the saved hash state.
+	 *
+	 * @return 0 if the hash state was saved successfully or an error code.
+	 */
+	int (*save_context) (struct hash_engine *engine, struct hash_context *context);
+
+	/**
+	 * Start a new hash operation that continues from a saved intermediate state.  The saved
+	 * context is not modified and can be restored multiple times.
+	 *
+	 * Every call to restore MUST be followed by either a call to finish or cancel.
+	 *
+	 * @param engine The hash engine to configure.
+	 * @param context The saved hash state to restore.
+	 *
+	 * @return 0 if the hash engine was configured successfully or an error code.
+	 */
+	int (*restore_context) (struct hash_engine *engine, const struct hash_context *context);
 };
 
 
@@ -227,6 +272,8 @@ int hash_start_new_hash (struct hash_engine *engine, enum hash_type type);
 int hash_calculate (struct hash_engine *engine, enum hash_type type, const uint8_t *data,
 	size_t length, uint8_t *hash, size_t hash_length);
 
+int hash_clone_context (struct hash_engine *engine, struct hash_engine *clone);
+
 int hash_get_hash_length (enum hash_type hash_type);
 int hash_get_block_size (enum hash_type hash_type);
 
@@ -312,6 +359,7 @@ enum {
 	HASH_ENGINE_HMAC_SHA256_SELF_TEST_FAILED = HASH_ENGINE_ERROR (0x1a),	/**< A SHA-256 HMAC self-test of the hash engine failed. */
 	HASH_ENGINE_HMAC_SHA384_SELF_TEST_FAILED = HASH_ENGINE_ERROR (0x1b),	/**< A SHA-384 HMAC self-test of the hash engine failed. */
 	HASH_ENGINE_HMAC_SHA512_SELF_TEST_FAILED = HASH_ENGINE_ERROR (0x1c),	/**< A SHA-512 HMAC self-test of the hash engine failed. */
+	HASH_ENGINE_INVALID_CONTEXT = HASH_ENGINE_ERROR (0x1d),					/**< A saved hash context is not valid for the engine. */
 };
 
 
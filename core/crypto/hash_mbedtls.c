@@ -6,6 +6,10 @@
 #include "hash_mbedtls.h"
 
 
+_Static_assert (sizeof (((struct hash_engine_mbedtls*) 0)->context) <= HASH_MAX_CONTEXT_STATE_LENGTH,
+	"Saved hash state is too small for mbedTLS hash contexts");
+
+
 /**
  * Free the active hash context.
  *
@@ -35,6 +39,39 @@ static void hash_mbedtls_free_context (struct hash_engine_mbedtls *engine)
 	engine->active = HASH_ACTIVE_NONE;
 }
 
+/**
+ * Get the length of the hash context for a type of hash.
+ *
+ * @param active The type of hash context.
+ *
+ * @return Length of the context or 0 if the hash type is not supported.
+ */
+static size_t hash_mbedtls_get_context_length (uint8_t active)
+{
+	switch (active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			return sizeof (mbedtls_sha1_context);
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			return sizeof (mbedtls_sha256_context);
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+			return sizeof (mbedtls_sha512_context);
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+			return sizeof (mbedtls_sha512_context);
+#endif
+
+		default:
+			return 0;
+	}
+}
+
 #ifdef HASH_ENABLE_SHA1
 static int hash_mbedtls_calculate_sha1 (struct hash_engine *engine, const uint8_t *data,
 	size_t length, uint8_t *hash, size_t hash_length)
@@ -377,6 +414,53 @@ static void hash_mbedtls_cancel (struct hash_engine *engine)
 	}
 }
 
+static int hash_mbedtls_save_context (struct hash_engine *engine, struct hash_context *context)
+{
+	struct hash_engine_mbedtls *mbedtls = (struct hash_engine_mbedtls*) engine;
+	size_t length;
+
+	if ((mbedtls == NULL) || (context == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	length = hash_mbedtls_get_context_length (mbedtls->active);
+	if (length == 0) {
+		return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	/* The mbedTLS contexts contain no pointers, so a copy of the structure is a complete clone. */
+	context->active = mbedtls->active;
+	context->length = length;
+	memcpy (context->state, &mbedtls->context, length);
+
+	return 0;
+}
+
+static int hash_mbedtls_restore_context (struct hash_engine *engine,
+	const struct hash_context *context)
+{
+	struct hash_engine_mbedtls *mbedtls = (struct hash_engine_mbedtls*) engine;
+	size_t length;
+
+	if ((mbedtls == NULL) || (context == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (mbedtls->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	length = hash_mbedtls_get_context_length (context->active);
+	if ((length == 0) || (context->length != length)) {
+		return HASH_ENGINE_INVALID_CONTEXT;
+	}
+
+	memcpy (&mbedtls->context, context->state, length);
+	mbedtls->active = context->active;
+
+	return 0;
+}
+
 /**
  * Initialize an mbedTLS hash engine.
  *
@@ -410,6 +494,8 @@ int hash_mbedtls_init (struct hash_engine_mbedtls *engine)
 	engine->base.get_hash = hash_mbedtls_get_hash;
 	engine->base.finish = hash_mbedtls_finish;
 	engine->base.cancel = hash_mbedtls_cancel;
+	engine->base.save_context = hash_mbedtls_save_context;
+	engine->base.restore_context = hash_mbedtls_restore_context;
 
 	engine->active = HASH_ACTIVE_NONE;
 
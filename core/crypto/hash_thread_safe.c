@@ -209,6 +209,37 @@ static int hash_thread_safe_get_hash (struct hash_engine *engine, uint8_t *hash,
 	return status;
 }
 
+static int hash_thread_safe_save_context (struct hash_engine *engine,
+	struct hash_context *context)
+{
+	struct hash_engine_thread_safe *sha = (struct hash_engine_thread_safe*) engine;
+
+	if (sha == NULL) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	return sha->engine->save_context (sha->engine, context);
+}
+
+static int hash_thread_safe_restore_context (struct hash_engine *engine,
+	const struct hash_context *context)
+{
+	struct hash_engine_thread_safe *sha = (struct hash_engine_thread_safe*) engine;
+	int status;
+
+	if (sha == NULL) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&sha->lock);
+	status = sha->engine->restore_context (sha->engine, context);
+	if (status != 0) {
+		platform_mutex_unlock (&sha->lock);
+	}
+
+	return status;
+}
+
 /**
  * Initialize a thread-safe wrapper for a hash engine.
  *
@@ -243,6 +274,8 @@ int hash_thread_safe_init (struct hash_engine_thread_safe *engine, struct hash_e
 	engine->base.get_hash = hash_thread_safe_get_hash;
 	engine->base.finish = hash_thread_safe_finish;
 	engine->base.cancel = hash_thread_safe_cancel;
+	engine->base.save_context = hash_thread_safe_save_context;
+	engine->base.restore_context = hash_thread_safe_restore_context;
 
 	engine->engine = target;
 
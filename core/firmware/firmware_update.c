@@ -118,6 +118,10 @@ int firmware_update_init_state (const struct firmware_update *updater, int allow
 		return status;
 	}
 
+	/* Erase staging flash as image data is received so preparing for an update does not block for
+	 * the time needed to erase the entire image. */
+	flash_updater_set_lazy_erase (&updater->state->update_mgr, true);
+
 	status = observable_init (&updater->state->observable);
 	if (status != 0) {
 		flash_updater_release (&updater->state->update_mgr);
@@ -1129,7 +1133,8 @@ int firmware_update_run_revocation (const struct firmware_update *updater,
 }
 
 /**
- * Prepare staging area for incoming FW update file
+ * Prepare staging area for incoming FW update file.  The staging flash is not erased here, but will
+ * be erased as the update data is written.
  *
  * @param updater Updater to use
  * @param size FW update file size to clear in staging area
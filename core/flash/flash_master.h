@@ -30,6 +30,7 @@ enum {
 	FLASH_FLAG_4BYTE_ADDRESS = 0x0001,	/**< The command contains a 4 byte address. */
 	FLASH_FLAG_NO_ADDRESS = 0x0002,		/**< The command contains no address bytes. */
 	FLASH_FLAG_DATA_TX = 0x0004,		/**< The transaction will send data bytes. */
+	FLASH_FLAG_WRITE_SEQUENCE = 0x0008,	/**< Execute the command as a complete write sequence. */
 
 	/*
 	 * Dual/Quad flags are mutually exclusive.  Mixing them on a transaction will have undefined
@@ -45,6 +46,14 @@ enum {
 	FLASH_FLAG_QUAD_DATA = 0x4000,	/**< Command data will be transmitted in quad SPI mode. */
 };
 
+/*
+ * A write sequence transaction is only valid for SPI masters that report FLASH_CAP_WRITE_SEQUENCE.
+ * The SPI master must send WRITE ENABLE (06h) before the flagged command and poll the status
+ * register (05h) until the device is no longer busy before executing any subsequent transaction.
+ * The master may queue the sequence and return before it has completed, allowing the caller to
+ * submit additional write sequences while the device is busy.
+ */
+
 /**
  * Use DPI mode (2-2-2) for the transaction.
  */
@@ -153,6 +162,7 @@ enum {
 
 	FLASH_CAP_3BYTE_ADDR = 0x100,	/**< Commands can be sent with 3-byte addresses. */
 	FLASH_CAP_4BYTE_ADDR = 0x200,	/**< Commands can be sent with 4-byte addresses. */
+	FLASH_CAP_WRITE_SEQUENCE = 0x400,	/**< Supports transactions flagged as write sequences. */
 };
 
 
@@ -17,11 +17,13 @@
  * @param base_addr The starting address for updates.
  * @param max_size The maximum number of bytes that can be written for a single update.
  * @param erase The function to use to erase the flash.
+ * @param sector_erase Flag indicating the erase function operates on sectors instead of blocks.
  *
  * @return 0 if the update manager was initialized successfully or an error code.
  */
 static int flash_updater_init_common (struct flash_updater *updater, const struct flash *flash,
-	uint32_t base_addr, size_t max_size, int (*erase) (const struct flash*, uint32_t, size_t))
+	uint32_t base_addr, size_t max_size, int (*erase) (const struct flash*, uint32_t, size_t),
+	bool sector_erase)
 {
 	if ((updater == NULL) || (flash == NULL)) {
 		return FLASH_UPDATER_INVALID_ARGUMENT;
@@ -33,6 +35,7 @@ static int flash_updater_init_common (struct flash_updater *updater, const struc
 	updater->base_addr = base_addr;
 	updater->max_size = max_size;
 	updater->erase = erase;
+	updater->sector_erase = sector_erase;
 
 	return 0;
 }
@@ -53,7 +56,7 @@ int flash_updater_init (struct flash_updater *updater, const struct flash *flash
 	uint32_t base_addr, size_t max_size)
 {
 	return flash_updater_init_common (updater, flash, base_addr, max_size,
-		flash_erase_region_and_verify);
+		flash_erase_region_and_verify, false);
 }
 
 /**
@@ -72,7 +75,7 @@ int flash_updater_init_sector (struct flash_updater *updater, const struct flash
 	uint32_t base_addr, size_t max_size)
 {
 	return flash_updater_init_common (updater, flash, base_addr, max_size,
-		flash_sector_erase_region_and_verify);
+		flash_sector_erase_region_and_verify, true);
 }
 
 /**
@@ -123,6 +126,45 @@ int flash_updater_check_update_size (struct flash_updater *updater, size_t total
 	}
 }
 
+/**
+ * Erase flash for the current update up to the specified offset.  Erasing will always extend to the
+ * end of an erase unit, but will not exceed the erase limit for the update.
+ *
+ * @param updater The flash updater to erase.
+ * @param offset Offset from the base address that must be erased.
+ *
+ * @return 0 if the flash was erased or an error code.
+ */
+static int flash_updater_erase_to_offset (struct flash_updater *updater, uint32_t offset)
+{
+	uint32_t end;
+	int status;
+
+	if (offset > updater->erase_limit) {
+		offset = updater->erase_limit;
+	}
+
+	if (offset <= updater->erase_offset) {
+		return 0;
+	}
+
+	end = ((updater->base_addr + offset + (updater->erase_unit - 1)) & ~(updater->erase_unit - 1)) -
+		updater->base_addr;
+	if (end > updater->erase_limit) {
+		end = updater->erase_limit;
+	}
+
+	status = updater->erase (updater->flash, updater->base_addr + updater->erase_offset,
+		end - updater->erase_offset);
+	if (status != 0) {
+		return status;
+	}
+
+	updater->erase_offset = end;
+
+	return 0;
+}
+
 /**
  * Prepare the flash to receive update data.
  *
@@ -141,11 +183,31 @@ static int flash_updater_prepare_update_flash (struct flash_updater *updater, si
 		return FLASH_UPDATER_TOO_LARGE;
 	}
 
-	if (erase_length) {
-		status = updater->erase (updater->flash, updater->base_addr, erase_length);
+	if (updater->lazy_erase && (update_length != 0)) {
+		if (updater->sector_erase) {
+			status = updater->flash->get_sector_size (updater->flash, &updater->erase_unit);
+		}
+		else {
+			status = updater->flash->get_block_size (updater->flash, &updater->erase_unit);
+		}
 		if (status != 0) {
 			return status;
 		}
+
+		/* Flash will be erased as data is written. */
+		updater->erase_offset = 0;
+		updater->erase_limit = erase_length;
+	}
+	else {
+		if (erase_length) {
+			status = updater->erase (updater->flash, updater->base_addr, erase_length);
+			if (status != 0) {
+				return status;
+			}
+		}
+
+		updater->erase_offset = erase_length;
+		updater->erase_limit = erase_length;
 	}
 
 	updater->update_size = update_length;
@@ -190,6 +252,88 @@ int flash_updater_prepare_for_update_erase_all (struct flash_updater *updater, s
 	return flash_updater_prepare_update_flash (updater, total_length, updater->max_size);
 }
 
+/**
+ * Configure the flash updater to erase flash as update data is received instead of erasing the
+ * entire update region when preparing for an update.  This greatly reduces the time needed to
+ * prepare for large updates, with the erase time being spread across each write.
+ *
+ * The set of flash that gets erased for an update does not change.  Any flash beyond the update
+ * data that would have been erased during preparation will be erased a little at a time, in
+ * proportion to the amount of update data received, and will be completely erased before the final
+ * write completes.
+ *
+ * The configuration will be applied on the next update preparation.
+ *
+ * @param updater The flash updater to configure.
+ * @param enable true to erase flash as data is written or false to erase during preparation.
+ *
+ * @return 0 if the erase mode was configured successfully or an error code.
+ */
+int flash_updater_set_lazy_erase (struct flash_updater *updater, bool enable)
+{
+	if (updater == NULL) {
+		return FLASH_UPDATER_INVALID_ARGUMENT;
+	}
+
+	updater->lazy_erase = enable;
+
+	return 0;
+}
+
+/**
+ * Erase flash beyond what has already been erased for the current update.  This can be called
+ * while waiting for more update data to reduce the amount of erasing needed during subsequent
+ * writes.  It must not be called concurrently with other calls on the same updater.
+ *
+ * If the updater is not using lazy erase, this does nothing since the flash has already been
+ * erased.
+ *
+ * @param updater The flash updater to erase.
+ * @param length The number of additional bytes to erase.  This will be extended to the end of the
+ * erase unit.
+ *
+ * @return 0 if the flash was erased or an error code.
+ */
+int flash_updater_erase_ahead (struct flash_updater *updater, size_t length)
+{
+	if (updater == NULL) {
+		return FLASH_UPDATER_INVALID_ARGUMENT;
+	}
+
+	if ((length == 0) || (updater->erase_offset >= updater->erase_limit)) {
+		return 0;
+	}
+
+	return flash_updater_erase_to_offset (updater, updater->erase_offset + length);
+}
+
+/**
+ * Determine how much of the flash must be erased before writing the next block of update data.
+ * Flash that is erased beyond the end of the update data is paced against the amount of data
+ * received so that the erase time is spread evenly across all writes, with the region being
+ * completely erased by the time the last of the expected data has been received.
+ *
+ * @param updater The flash updater that will write the data.
+ * @param length The amount of data that will be written.
+ *
+ * @return Offset from the base address that must be erased before writing the data.
+ */
+static uint32_t flash_updater_get_erase_target (const struct flash_updater *updater,
+	size_t length)
+{
+	uint32_t write_end = updater->write_offset + length;
+	uint64_t target;
+
+	if ((int) length >= updater->update_size) {
+		return updater->erase_limit;
+	}
+
+	target = ((uint64_t) updater->erase_limit * write_end) /
+		(updater->write_offset + updater->update_size);
+
+	return (target > write_end) ? target : write_end;
+}
+
 /**
  * Write update data to flash.  The flash must have already been prepared for the update for this
  * data to be written correctly.  No validation of the written data will be performed.
@@ -217,6 +361,14 @@ int flash_updater_write_update_data (struct flash_updater *updater, const uint8_
 		return FLASH_UPDATER_OUT_OF_SPACE;
 	}
 
+	if (updater->erase_offset < updater->erase_limit) {
+		status = flash_updater_erase_to_offset (updater,
+			flash_updater_get_erase_target (updater, length));
+		if (status != 0) {
+			return status;
+		}
+	}
+
 	status = updater->flash->write (updater->flash, updater->base_addr + updater->write_offset,
 		data, length);
 	if (ROT_IS_ERROR (status)) {
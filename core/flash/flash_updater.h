@@ -4,6 +4,7 @@
 #ifndef FLASH_UPDATER_H_
 #define FLASH_UPDATER_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include "flash.h"
@@ -21,6 +22,11 @@ struct flash_updater {
 	int update_size;										/**< Expected size of the current update. */
 	uint32_t write_offset;									/**< Offset from the base for the next write. */
 	int (*erase) (const struct flash*, uint32_t, size_t);	/**< Function for erasing flash. */
+	bool sector_erase;										/**< Flag indicating erase operates on sectors. */
+	bool lazy_erase;										/**< Flag to erase flash as update data is written. */
+	uint32_t erase_unit;									/**< Size of a single erase for lazy erasing. */
+	uint32_t erase_offset;									/**< Offset from the base of the first byte not erased. */
+	uint32_t erase_limit;									/**< Offset from the base to stop erasing the current update. */
 };
 
 
@@ -36,6 +42,9 @@ int flash_updater_check_update_size (struct flash_updater *updater, size_t total
 int flash_updater_prepare_for_update (struct flash_updater *updater, size_t total_length);
 int flash_updater_prepare_for_update_erase_all (struct flash_updater *updater, size_t total_length);
 
+int flash_updater_set_lazy_erase (struct flash_updater *updater, bool enable);
+int flash_updater_erase_ahead (struct flash_updater *updater, size_t length);
+
 int flash_updater_write_update_data (struct flash_updater *updater, const uint8_t *data,
 	size_t length);
 
@@ -2,6 +2,7 @@
 // Licensed under the MIT license.
 
 #include <stdbool.h>
+#include <string.h>
 #include "flash_common.h"
 #include "flash_util.h"
 #include "platform_api.h"
@@ -541,6 +542,37 @@ int flash_sector_erase_region (const struct flash *flash, uint32_t start_addr, s
 		flash->sector_erase);
 }
 
+/**
+ * Check a block of data read from flash for a constant value.  The data is checked one word at a
+ * time, with any trailing bytes checked individually.
+ *
+ * @param block The data to check.
+ * @param length The number of bytes in the block.
+ * @param pattern A word filled with the expected byte value.
+ *
+ * @return true if every byte in the block matches the expected value.
+ */
+static bool flash_check_block_for_value (const size_t *block, size_t length, size_t pattern)
+{
+	const uint8_t *bytes = (const uint8_t*) block;
+	size_t words = length / sizeof (size_t);
+	size_t i;
+
+	for (i = 0; i < words; i++) {
+		if (block[i] != pattern) {
+			return false;
+		}
+	}
+
+	for (i = words * sizeof (size_t); i < length; i++) {
+		if (bytes[i] != (uint8_t) pattern) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 /**
  * Check a region of flash to ensure it contains the expected data.
  *
@@ -556,27 +588,37 @@ int flash_sector_erase_region (const struct flash *flash, uint32_t start_addr, s
 static int flash_check_region_for_data (const struct flash *flash, uint32_t start_addr,
 	const uint8_t *data, size_t length, bool const_byte)
 {
-	uint8_t block[FLASH_VERIFICATION_BLOCK];
-	uint8_t next = (const_byte) ? 0 : 1;
+	size_t block[FLASH_VERIFICATION_BLOCK / sizeof (size_t)];
+	uint8_t *bytes = (uint8_t*) block;
+	size_t pattern = 0;
 	size_t read_len;
 	int flash_good = 0;
-	size_t i;
 
 	if (flash == NULL) {
 		return FLASH_UTIL_INVALID_ARGUMENT;
 	}
 
+	if (const_byte) {
+		memset (&pattern, *data, sizeof (pattern));
+	}
+
 	while ((flash_good == 0) && (length > 0)) {
 		read_len = (length > sizeof (block)) ? sizeof (block) : length;
 
-		flash_good = flash->read (flash, start_addr, block, read_len);
+		flash_good = flash->read (flash, start_addr, bytes, read_len);
 		if (flash_good == 0) {
-			for (i = 0; i < read_len; i++, data += next) {
-				if (*data != block[i]) {
+			if (const_byte) {
+				if (!flash_check_block_for_value (block, read_len, pattern)) {
 					flash_good = FLASH_UTIL_DATA_MISMATCH;
-					break;
 				}
 			}
+			else {
+				if (memcmp (data, bytes, read_len) != 0) {
+					flash_good = FLASH_UTIL_DATA_MISMATCH;
+				}
+
+				data += read_len;
+			}
 
 			start_addr += read_len;
 			length -= read_len;
@@ -910,14 +952,15 @@ static int flash_check_copy_region (uint32_t dest_addr, uint32_t src_addr, size_
  * Copy data stored at one flash location to another flash location that must be blank.  The
  * destination will optionally be verified after the copy.
  *
- * Data will be copied one flash page at a time.
+ * Data will be copied one block at a time, using a stack buffer of FLASH_MAX_COPY_BLOCK bytes.
  *
  * @param dest_flash The flash device to copy data to.
  * @param dest_addr The starting address of the region to copy to.
  * @param src_flash The flash device to copy data from.
  * @param src_addr The starting address of the region to copy from.
  * @param length The size of the region to copy.
- * @param page The size of a flash page.
+ * @param page The size of each block to copy.  This must not be larger than FLASH_MAX_COPY_BLOCK
+ * and must evenly divide the flash page size.
  * @param verify Flag indicating if the copy should be verified after the data has been written to
  * the destination.
  *
@@ -926,16 +969,11 @@ static int flash_check_copy_region (uint32_t dest_addr, uint32_t src_addr, size_
 static int flash_copy_data_to_blank_region (const struct flash *dest_flash, uint32_t dest_addr,
 	const struct flash *src_flash, uint32_t src_addr, size_t length, uint32_t page, uint8_t verify)
 {
-	uint8_t *data;
+	uint8_t data[FLASH_MAX_COPY_BLOCK];
 	size_t block_len;
 	int status = 0;
 	uint32_t page_offset = FLASH_REGION_OFFSET (dest_addr, page);
 
-	data = platform_malloc (page);
-	if (data == NULL) {
-		return FLASH_UTIL_NO_MEMORY;
-	}
-
 	while ((status == 0) && (length != 0)) {
 		block_len = page - page_offset;
 		block_len = (length > block_len) ? block_len : length;
@@ -965,8 +1003,6 @@ static int flash_copy_data_to_blank_region (const struct flash *dest_flash, uint
 		}
 	}
 
-	platform_free (data);
-
 	return status;
 }
 
@@ -1033,8 +1069,10 @@ static int flash_copy_data_region_ext (const struct flash *dest_flash, uint32_t
 		return status;
 	}
 
+	/* Pages larger than the copy buffer are written in smaller blocks.  Page sizes are a power of
+	 * two, so these blocks will never cross a page boundary. */
 	if (page > FLASH_MAX_COPY_BLOCK) {
-		return FLASH_UTIL_UNSUPPORTED_PAGE_SIZE;
+		page = FLASH_MAX_COPY_BLOCK;
 	}
 
 	return flash_copy_data_to_blank_region (dest_flash, dest_addr, src_flash, src_addr, length,
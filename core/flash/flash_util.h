@@ -14,9 +14,13 @@
 
 
 /**
- * The maximum block size read from the flash for verification operations.
+ * The maximum block size read from the flash for verification operations.  Larger blocks reduce
+ * the number of flash transactions needed to verify a region at the cost of additional stack usage.
+ * This must be a multiple of the platform word size.
  */
+#ifndef FLASH_VERIFICATION_BLOCK
 #define	FLASH_VERIFICATION_BLOCK	256
+#endif
 
 /**
  * The maximum block size supported for flash copy operations.
@@ -6,6 +6,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "spi_flash.h"
+#include "common/common_math.h"
 #include "common/unused.h"
 #include "flash/flash_common.h"
 #include "flash/flash_logging.h"
@@ -559,6 +560,7 @@ int spi_flash_init_state (const struct spi_flash *flash)
 	}
 
 	flash->state->device_id[0] = 0xff;
+	flash->state->page_size = FLASH_PAGE_SIZE;
 
 	/* Populate common command codes for basic flash operations. */
 	flash->state->command.read = FLASH_CMD_READ;
@@ -698,6 +700,9 @@ static int spi_flash_simple_command (const struct spi_flash *flash, uint8_t cmd)
  */
 static int spi_flash_write_enable (const struct spi_flash *flash)
 {
+	/* Any write enable could be followed by a program or erase operation. */
+	flash->state->write_idle = false;
+
 	return spi_flash_simple_command (flash, FLASH_CMD_WREN);
 }
 
@@ -710,11 +715,14 @@ static int spi_flash_write_enable (const struct spi_flash *flash)
  */
 static int spi_flash_volatile_write_enable (const struct spi_flash *flash)
 {
+	flash->state->write_idle = false;
+
 	return spi_flash_simple_command (flash, FLASH_CMD_VOLATILE_WREN);
 }
 
 /**
- * Determine if the flash is currently executing a write command.
+ * Determine if the flash is currently executing a write command.  The result is tracked so that
+ * subsequent reads can skip checking the device status until another write could be started.
  *
  * @param flash The flash instance to check.
  *
@@ -736,31 +744,87 @@ static int spi_flash_is_wip_set (const struct spi_flash *flash)
 	status = flash->spi->xfer (flash->spi, &xfer);
 	if (status == 0) {
 		if (!flash->state->use_busy_flag) {
-			return ((reg & FLASH_STATUS_WIP) != 0);
+			status = ((reg & FLASH_STATUS_WIP) != 0);
 		}
 		else {
-			return ((reg & FLASH_FLAG_STATUS_READY) == 0);
+			status = ((reg & FLASH_FLAG_STATUS_READY) == 0);
 		}
+
+		flash->state->write_idle = (status == 0);
 	}
-	else {
-		return status;
+
+	return status;
+}
+
+/**
+ * Identifier for write completion that is not associated with a specific write operation.  These
+ * waits are not tracked in the write statistics.
+ */
+#define	SPI_FLASH_WRITE_OP_UNTRACKED	NUM_SPI_FLASH_WRITE_OPS
+
+/**
+ * Determine if waiting for a write operation should spin on the device status rather than sleep
+ * between status checks.  Page programming and register writes are expected to complete in less
+ * time than the platform sleep resolution.
+ */
+#define	SPI_FLASH_WRITE_OP_NO_SLEEP(op)		\
+	(((op) == SPI_FLASH_WRITE_OP_PAGE_PROGRAM) || ((op) == SPI_FLASH_WRITE_OP_REGISTER))
+
+/**
+ * Update the latency statistics for a completed write operation.
+ *
+ * @param flash The flash instance that executed the write.
+ * @param op The type of write operation that completed.
+ * @param start Time when the operation started waiting for completion.
+ * @param polls The number of status checks needed to detect completion.
+ */
+static void spi_flash_update_write_stats (const struct spi_flash *flash,
+	enum spi_flash_write_op op, const platform_clock *start, uint32_t polls)
+{
+	struct spi_flash_write_stats *stats = &flash->state->stats[op];
+	platform_clock end;
+	uint32_t duration = 0;
+
+	if (platform_init_current_tick (&end) == 0) {
+		duration = platform_get_duration (start, &end);
+	}
+
+	if ((stats->count == 0) || (duration < stats->min_ms)) {
+		stats->min_ms = duration;
+	}
+	if (duration > stats->max_ms) {
+		stats->max_ms = duration;
 	}
+
+	stats->count++;
+	stats->polls += polls;
+	stats->total_ms += duration;
 }
 
 /**
  * Wait for a write operation to complete.
  *
+ * Operations that are expected to take a known amount of time will wait for that long before the
+ * first status check.  Short operations will then poll the device continuously, calling the
+ * registered yield handler between each check, while erase operations will poll with an
+ * exponentially increasing delay up to SPI_FLASH_MAX_POLL_DELAY_MS.
+ *
  * @param flash The flash instance that is executing a write operation.
  * @param timeout The maximum number of milliseconds to wait for completion.  A negative number will
  * wait forever.  0 will return immediately.
- * @param no_sleep Flag indicating no sleep should be inserted between status reads.
+ * @param op The type of write operation being executed.  SPI_FLASH_WRITE_OP_UNTRACKED will poll
+ * every SPI_FLASH_MAX_POLL_DELAY_MS and not update any statistics.
  *
  * @return 0 if the write was completed or an error code.
  */
 static int spi_flash_wait_for_write_completion (const struct spi_flash *flash, int32_t timeout,
-	uint8_t no_sleep)
+	uint32_t op)
 {
 	platform_clock timeout_val;
+	platform_clock start;
+	bool tracked = (op < NUM_SPI_FLASH_WRITE_OPS);
+	uint32_t delay = (tracked) ? 1 : SPI_FLASH_MAX_POLL_DELAY_MS;
+	uint32_t polls = 0;
 	int done = 0;
 	int status;
 
@@ -771,8 +835,18 @@ static int spi_flash_wait_for_write_completion (const struct spi_flash *flash, i
 		}
 	}
 
+	if (tracked) {
+		platform_init_current_tick (&start);
+
+		if ((timeout != 0) && (flash->state->poll_delay_ms[op] != 0)) {
+			platform_msleep (flash->state->poll_delay_ms[op]);
+		}
+	}
+
 	do {
 		status = spi_flash_is_wip_set (flash);
+		polls++;
+
 		if (status == 0) {
 			done = 1;
 		}
@@ -787,13 +861,23 @@ static int spi_flash_wait_for_write_completion (const struct spi_flash *flash, i
 			}
 
 			if (status == 0) {
-				if (!no_sleep) {
-					platform_msleep (10);
+				if (SPI_FLASH_WRITE_OP_NO_SLEEP (op)) {
+					if (flash->state->poll_yield) {
+						flash->state->poll_yield (flash->state->yield_context);
+					}
+				}
+				else {
+					platform_msleep (delay);
+					delay = min (delay * 2, SPI_FLASH_MAX_POLL_DELAY_MS);
 				}
 			}
 		}
 	} while ((status == 0) && !done);
 
+	if (done && tracked) {
+		spi_flash_update_write_stats (flash, op, &start, polls);
+	}
+
 	return status;
 }
 
@@ -832,7 +916,7 @@ static int spi_flash_infineon_write_register (const struct spi_flash *flash, uin
 		return status;
 	}
 
-	return spi_flash_wait_for_write_completion (flash, -1, 1);
+	return spi_flash_wait_for_write_completion (flash, -1, SPI_FLASH_WRITE_OP_REGISTER);
 }
 
 /**
@@ -874,7 +958,7 @@ static int spi_flash_write_register (const struct spi_flash *flash, uint8_t cmd,
 		return status;
 	}
 
-	return spi_flash_wait_for_write_completion (flash, -1, 1);
+	return spi_flash_wait_for_write_completion (flash, -1, SPI_FLASH_WRITE_OP_REGISTER);
 }
 
 /**
@@ -895,8 +979,10 @@ int spi_flash_discover_device_properties (const struct spi_flash *flash,
 	const struct spi_flash_sfdp *sfdp)
 {
 	struct spi_flash_sfdp_basic_table parameters;
+	uint32_t master_capabilities;
 	uint32_t spi_capabilities;
 	struct spi_flash_sfdp_read_commands read;
+	struct spi_flash_sfdp_write_timing timing;
 	int status;
 
 	if ((flash == NULL) || (sfdp == NULL)) {
@@ -913,14 +999,18 @@ int spi_flash_discover_device_properties (const struct spi_flash *flash,
 	spi_flash_sfdp_get_device_capabilities (&parameters, &flash->state->capabilities);
 	spi_flash_sfdp_get_read_commands (&parameters, &read);
 
-	spi_capabilities = flash->spi->capabilities (flash->spi) & flash->state->capabilities;
+	master_capabilities = flash->spi->capabilities (flash->spi);
+	spi_capabilities = master_capabilities & flash->state->capabilities;
 	if ((spi_capabilities & (FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR)) !=
 		(flash->state->capabilities & (FLASH_CAP_3BYTE_ADDR | FLASH_CAP_4BYTE_ADDR))) {
 		status = SPI_FLASH_INCOMPATIBLE_SPI_MASTER;
 		goto exit;
 	}
 
-	flash->state->capabilities = spi_capabilities;
+	/* Write sequences are a feature of the SPI master, not the flash device, so they will never be
+	 * reported through SFDP. */
+	flash->state->capabilities = spi_capabilities |
+		(master_capabilities & FLASH_CAP_WRITE_SEQUENCE);
 	flash->state->reset_3byte = false;
 
 	status = spi_flash_sfdp_get_4byte_mode_switch (&parameters, &flash->state->switch_4byte);
@@ -975,10 +1065,26 @@ int spi_flash_discover_device_properties (const struct spi_flash *flash,
 	}
 
 	flash->state->device_size = status;
+
+	status = spi_flash_sfdp_get_page_size (&parameters);
+	if (ROT_IS_ERROR (status)) {
+		goto exit;
+	}
+
+	flash->state->page_size = status;
 	flash->state->use_busy_flag = spi_flash_sfdp_use_busy_flag_status (&parameters);
 	flash->state->sr1_volatile = spi_flash_sfdp_use_volatile_write_enable (&parameters);
 
-	status = 0;
+	status = spi_flash_sfdp_get_write_timing (&parameters, &timing);
+	if (status != 0) {
+		goto exit;
+	}
+
+	/* Page programming typically completes in less than the sleep resolution, so it will always
+	 * be polled without an initial delay. */
+	flash->state->poll_delay_ms[SPI_FLASH_WRITE_OP_SECTOR_ERASE] = timing.sector_erase_ms;
+	flash->state->poll_delay_ms[SPI_FLASH_WRITE_OP_BLOCK_ERASE] = timing.block_erase_ms;
+	flash->state->poll_delay_ms[SPI_FLASH_WRITE_OP_CHIP_ERASE] = timing.chip_erase_ms;
 
 exit:
 	platform_mutex_unlock (&flash->state->lock);
@@ -1209,6 +1315,9 @@ static int spi_flash_execute_reset_device (const struct spi_flash *flash, uint32
 {
 	int status;
 
+	/* The device may not be ready immediately after the reset. */
+	flash->state->write_idle = false;
+
 	if (flash->state->command.reset == FLASH_CMD_RST) {
 		status = spi_flash_simple_command (flash, FLASH_CMD_RSTEN);
 		if (status != 0) {
@@ -1460,6 +1569,8 @@ int spi_flash_deep_power_down (const struct spi_flash *flash, uint8_t enable)
 
 	platform_mutex_lock (&flash->state->lock);
 
+	flash->state->write_idle = false;
+
 	if (enable) {
 		status = spi_flash_simple_command (flash, flash->state->command.enter_pwrdown);
 	}
@@ -2056,6 +2167,31 @@ int spi_flash_configure_drive_strength (const struct spi_flash *flash)
 	return status;
 }
 
+/**
+ * Check that the flash is not executing a write command before reading from it.  If write state
+ * tracking is enabled, the device status is only queried if a write could have been started since
+ * the last time the flash was known to be idle.
+ *
+ * @param flash The flash that will be read.
+ *
+ * @return 0 if the flash can be read or an error code.
+ */
+static int spi_flash_check_ready_for_read (const struct spi_flash *flash)
+{
+	int status;
+
+	if (flash->state->track_write_state && flash->state->write_idle) {
+		return 0;
+	}
+
+	status = spi_flash_is_wip_set (flash);
+	if (status != 0) {
+		return (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
+	}
+
+	return 0;
+}
+
 /**
  * Read data from the SPI flash.
  *
@@ -2079,9 +2215,8 @@ int spi_flash_read (const struct spi_flash *flash, uint32_t address, uint8_t *da
 
 	platform_mutex_lock (&flash->state->lock);
 
-	status = spi_flash_is_wip_set (flash);
+	status = spi_flash_check_ready_for_read (flash);
 	if (status != 0) {
-		status = (status == 1) ? SPI_FLASH_WRITE_IN_PROGRESS : status;
 		goto exit;
 	}
 
@@ -2096,6 +2231,87 @@ exit:
 	return status;
 }
 
+/**
+ * Read data from multiple regions of the SPI flash.  The flash is locked for the duration of all
+ * reads, and the device status is checked at most once.
+ *
+ * @param flash The flash to read from.
+ * @param regions The list of regions to read.
+ * @param count The number of regions in the list.
+ *
+ * @return 0 if all regions were read from flash or an error code.  If an error is returned, some
+ * of the regions may have been read.
+ */
+int spi_flash_read_regions (const struct spi_flash *flash,
+	const struct spi_flash_read_region *regions, size_t count)
+{
+	struct flash_xfer xfer;
+	size_t i;
+	int status;
+
+	if ((flash == NULL) || ((regions == NULL) && (count != 0))) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (regions[i].data == NULL) {
+			return SPI_FLASH_INVALID_ARGUMENT;
+		}
+
+		SPI_FLASH_BOUNDS_CHECK (flash->state->device_size, regions[i].address, regions[i].length);
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+
+	status = spi_flash_check_ready_for_read (flash);
+
+	for (i = 0; (status == 0) && (i < count); i++) {
+		FLASH_XFER_INIT_READ (xfer, flash->state->command.read, regions[i].address,
+			flash->state->command.read_dummy, flash->state->command.read_mode, regions[i].data,
+			regions[i].length, flash->state->command.read_flags | flash->state->addr_mode);
+		status = flash->spi->xfer (flash->spi, &xfer);
+	}
+
+	platform_mutex_unlock (&flash->state->lock);
+
+	return status;
+}
+
+/**
+ * Configure tracking of the device write state to avoid unnecessary status checks on reads.  When
+ * enabled, the device status will only be checked before a read if a program, erase, or other
+ * write operation could have been started since the last time the device was known to be idle.
+ *
+ * This must only be enabled for devices that are exclusively accessed through this driver.  If
+ * another SPI master can write to the device, the driver has no way to know when a new write has
+ * been started.
+ *
+ * @param flash The flash to configure.
+ * @param enable true to enable write state tracking or false to check the device status before
+ * every read.
+ *
+ * @return 0 if the write state tracking was configured or an error code.
+ */
+int spi_flash_set_write_state_tracking (const struct spi_flash *flash, bool enable)
+{
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+
+	flash->state->track_write_state = enable;
+	flash->state->write_idle = false;
+
+	platform_mutex_unlock (&flash->state->lock);
+
+	return 0;
+}
+
 /**
  * Get the size of a flash page for write operations.
  *
@@ -2110,9 +2326,7 @@ int spi_flash_get_page_size (const struct spi_flash *flash, uint32_t *bytes)
 		return SPI_FLASH_INVALID_ARGUMENT;
 	}
 
-	/* All supported devices use a 256 byte page size.  If necessary, this value can be read from
-	 * the SFDP tables. */
-	*bytes = FLASH_PAGE_SIZE;
+	*bytes = flash->state->page_size;
 
 	return 0;
 }
@@ -2163,9 +2377,10 @@ int spi_flash_write (const struct spi_flash *flash, uint32_t address, const uint
 	size_t length)
 {
 	struct flash_xfer xfer;
-	uint32_t page = FLASH_PAGE_BASE (address);
-	uint32_t next = page + FLASH_PAGE_SIZE;
+	uint32_t page_size;
+	uint16_t write_flags;
 	size_t remaining = length;
+	bool sequence;
 	int status = 0;
 
 	if ((flash == NULL) || (data == NULL)) {
@@ -2182,35 +2397,55 @@ int spi_flash_write (const struct spi_flash *flash, uint32_t address, const uint
 		goto exit;
 	}
 
-	while ((status == 0) && remaining) {
-		uint32_t end = address + remaining;
-		size_t write_len;
+	page_size = flash->state->page_size;
+	write_flags = flash->state->command.write_flags | flash->state->addr_mode;
 
-		if (page != FLASH_PAGE_BASE (end)) {
-			write_len = next - address;
-		}
-		else {
-			write_len = remaining;
-		}
+	/* When the SPI master can execute the complete write sequence for each page, there is no need
+	 * to wait for each page to complete before sending the next one.  The master will handle the
+	 * status polling, so a single check is needed after all pages have been submitted.  Devices that
+	 * report busy status through the flag status register can't use this. */
+	sequence = ((flash->state->capabilities & FLASH_CAP_WRITE_SEQUENCE) &&
+		!flash->state->use_busy_flag);
+	if (sequence) {
+		write_flags |= FLASH_FLAG_WRITE_SEQUENCE;
+		flash->state->write_idle = false;
+	}
 
-		status = spi_flash_write_enable (flash);
-		if (status != 0) {
-			continue;
+	while ((status == 0) && remaining) {
+		size_t write_len = min (remaining, page_size - (address & (page_size - 1)));
+
+		if (!sequence) {
+			status = spi_flash_write_enable (flash);
+			if (status != 0) {
+				continue;
+			}
 		}
 
 		FLASH_XFER_INIT_WRITE (xfer, flash->state->command.write, address, 0, (uint8_t*) data,
-			write_len, flash->state->command.write_flags | flash->state->addr_mode);
+			write_len, write_flags);
 
 		status = flash->spi->xfer (flash->spi, &xfer);
+		if ((status == 0) && !sequence) {
+			status = spi_flash_wait_for_write_completion (flash, -1,
+				SPI_FLASH_WRITE_OP_PAGE_PROGRAM);
+		}
+
 		if (status == 0) {
-			status = spi_flash_wait_for_write_completion (flash, -1, 1);
-			if (status == 0) {
-				remaining -= write_len;
-				data += write_len;
-				page = next;
-				address = next;
-				next += FLASH_PAGE_SIZE;
-			}
+			remaining -= write_len;
+			data += write_len;
+			address += write_len;
+		}
+	}
+
+	if (sequence && (remaining != length)) {
+		int wait_status = spi_flash_wait_for_write_completion (flash, -1,
+			SPI_FLASH_WRITE_OP_PAGE_PROGRAM);
+
+		if (wait_status != 0) {
+			/* None of the submitted pages can be confirmed as written. */
+			address -= (length - remaining);
+			remaining = length;
+			status = wait_status;
 		}
 	}
 
@@ -2250,11 +2485,12 @@ int spi_flash_write_read_only (const struct flash *flash, uint32_t address, cons
  * @param address An address within the region to erase.
  * @param erase_cmd The erase command to use.
  * @param erase_flags Transfer flags for the command.
+ * @param op The type of erase operation being executed.
  *
  * @return 0 if the region was erased or an error code.
  */
 static int spi_flash_erase_region (const struct spi_flash *flash, uint32_t address,
-	uint8_t erase_cmd, uint16_t erase_flags)
+	uint8_t erase_cmd, uint16_t erase_flags, enum spi_flash_write_op op)
 {
 	struct flash_xfer xfer;
 	int status;
@@ -2283,7 +2519,7 @@ static int spi_flash_erase_region (const struct spi_flash *flash, uint32_t addre
 		goto exit;
 	}
 
-	status = spi_flash_wait_for_write_completion (flash, -1, 0);
+	status = spi_flash_wait_for_write_completion (flash, -1, op);
 
 exit:
 	platform_mutex_unlock (&flash->state->lock);
@@ -2327,7 +2563,8 @@ int spi_flash_sector_erase (const struct spi_flash *flash, uint32_t sector_addr)
 	}
 
 	return spi_flash_erase_region (flash, FLASH_SECTOR_BASE (sector_addr),
-		flash->state->command.erase_sector, flash->state->command.sector_flags);
+		flash->state->command.erase_sector, flash->state->command.sector_flags,
+		SPI_FLASH_WRITE_OP_SECTOR_ERASE);
 }
 
 /* API handler for sector_erase and block_erase when statically initialized for read only access. */
@@ -2375,7 +2612,8 @@ int spi_flash_block_erase (const struct spi_flash *flash, uint32_t block_addr)
 	}
 
 	return spi_flash_erase_region (flash, FLASH_BLOCK_BASE (block_addr),
-		flash->state->command.erase_block, flash->state->command.block_flags);
+		flash->state->command.erase_block, flash->state->command.block_flags,
+		SPI_FLASH_WRITE_OP_BLOCK_ERASE);
 }
 
 /**
@@ -2411,7 +2649,7 @@ int spi_flash_chip_erase (const struct spi_flash *flash)
 		goto exit;
 	}
 
-	status = spi_flash_wait_for_write_completion (flash, -1, 0);
+	status = spi_flash_wait_for_write_completion (flash, -1, SPI_FLASH_WRITE_OP_CHIP_ERASE);
 
 exit:
 	platform_mutex_unlock (&flash->state->lock);
@@ -2467,8 +2705,107 @@ int spi_flash_wait_for_write (const struct spi_flash *flash, int32_t timeout)
 	}
 
 	platform_mutex_lock (&flash->state->lock);
-	status = spi_flash_wait_for_write_completion (flash, timeout, 0);
+	status = spi_flash_wait_for_write_completion (flash, timeout, SPI_FLASH_WRITE_OP_UNTRACKED);
 	platform_mutex_unlock (&flash->state->lock);
 
 	return status;
 }
+
+/**
+ * Set the amount of time to wait after starting a write operation before checking the device for
+ * completion.  When the device reports operation timing through SFDP, this will be set
+ * automatically during device detection.
+ *
+ * @param flash The flash interface to configure.
+ * @param op The write operation to configure.
+ * @param delay_ms The number of milliseconds to wait before the first status check.  Set this to 0
+ * to check the status immediately.
+ *
+ * @return 0 if the delay was configured successfully or an error code.
+ */
+int spi_flash_set_write_poll_delay (const struct spi_flash *flash, enum spi_flash_write_op op,
+	uint32_t delay_ms)
+{
+	if ((flash == NULL) || (op >= NUM_SPI_FLASH_WRITE_OPS)) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+	flash->state->poll_delay_ms[op] = delay_ms;
+	platform_mutex_unlock (&flash->state->lock);
+
+	return 0;
+}
+
+/**
+ * Register a handler to call between status checks while waiting for page programming or register
+ * writes to complete.  Without a handler, these operations will poll the device continuously.
+ *
+ * @param flash The flash interface to configure.
+ * @param yield The handler to call between status checks.  Set this to null to remove the current
+ * handler.
+ * @param context Context to pass to the handler.
+ *
+ * @return 0 if the handler was registered successfully or an error code.
+ */
+int spi_flash_set_poll_yield (const struct spi_flash *flash, spi_flash_poll_yield yield,
+	void *context)
+{
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+	flash->state->poll_yield = yield;
+	flash->state->yield_context = context;
+	platform_mutex_unlock (&flash->state->lock);
+
+	return 0;
+}
+
+/**
+ * Get the latency statistics for a type of write operation.
+ *
+ * @param flash The flash interface to query.
+ * @param op The write operation to query.
+ * @param stats Output for the operation statistics.
+ *
+ * @return 0 if the statistics were retrieved successfully or an error code.
+ */
+int spi_flash_get_write_stats (const struct spi_flash *flash, enum spi_flash_write_op op,
+	struct spi_flash_write_stats *stats)
+{
+	if ((flash == NULL) || (op >= NUM_SPI_FLASH_WRITE_OPS) || (stats == NULL)) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+	*stats = flash->state->stats[op];
+	platform_mutex_unlock (&flash->state->lock);
+
+	if (stats->count != 0) {
+		stats->mean_ms = stats->total_ms / stats->count;
+	}
+
+	return 0;
+}
+
+/**
+ * Clear the latency statistics for all write operations.
+ *
+ * @param flash The flash interface to update.
+ *
+ * @return 0 if the statistics were cleared or an error code.
+ */
+int spi_flash_reset_write_stats (const struct spi_flash *flash)
+{
+	if (flash == NULL) {
+		return SPI_FLASH_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash->state->lock);
+	memset (flash->state->stats, 0, sizeof (flash->state->stats));
+	platform_mutex_unlock (&flash->state->lock);
+
+	return 0;
+}
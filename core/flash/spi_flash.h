@@ -33,6 +33,45 @@ struct spi_flash_commands {
 	uint8_t release_pwrdown;	/**< The command to release deep power down. */
 };
 
+/**
+ * The longest time to sleep between status checks while waiting for an erase to complete.
+ */
+#ifndef SPI_FLASH_MAX_POLL_DELAY_MS
+#define	SPI_FLASH_MAX_POLL_DELAY_MS		10
+#endif
+
+/**
+ * Types of write operations that are tracked when waiting for write completion.
+ */
+enum spi_flash_write_op {
+	SPI_FLASH_WRITE_OP_PAGE_PROGRAM = 0,	/**< Program data into a single page. */
+	SPI_FLASH_WRITE_OP_SECTOR_ERASE,		/**< Erase a 4kB sector. */
+	SPI_FLASH_WRITE_OP_BLOCK_ERASE,			/**< Erase a 64kB block. */
+	SPI_FLASH_WRITE_OP_CHIP_ERASE,			/**< Erase the entire device. */
+	SPI_FLASH_WRITE_OP_REGISTER,			/**< Write a device register. */
+	NUM_SPI_FLASH_WRITE_OPS,				/**< Number of tracked write operations. */
+};
+
+/**
+ * Latency statistics for a single type of write operation.
+ */
+struct spi_flash_write_stats {
+	uint32_t count;		/**< Number of completed operations. */
+	uint32_t polls;		/**< Total number of status checks for all operations. */
+	uint32_t min_ms;	/**< Shortest time for an operation to complete. */
+	uint32_t max_ms;	/**< Longest time for an operation to complete. */
+	uint32_t total_ms;	/**< Total time spent waiting for all operations to complete. */
+	uint32_t mean_ms;	/**< Average time for an operation to complete.  Only set when queried. */
+};
+
+/**
+ * Handler called between status checks while waiting for a write that is expected to complete
+ * quickly.  This allows the platform to yield to other tasks rather than spin on the SPI bus.
+ *
+ * @param context The context registered with the handler.
+ */
+typedef void (*spi_flash_poll_yield) (void *context);
+
 /**
  * Variable context for a SPI flash driver instance.
  */
@@ -41,6 +80,7 @@ struct spi_flash_state {
 	uint16_t addr_mode;									/**< The current address mode of the SPI flash device. */
 	uint8_t device_id[3];								/**< Device identification data. */
 	uint32_t device_size;								/**< The total capacity of the flash device. */
+	uint32_t page_size;									/**< The number of bytes that can be programmed at once. */
 	struct spi_flash_commands command;					/**< Commands to use with the flash device. */
 	uint32_t capabilities;								/**< Capabilities of the flash device. */
 	bool use_fast_read;									/**< Flag to use fast read for SPI reads. */
@@ -49,6 +89,21 @@ struct spi_flash_state {
 	bool reset_3byte;									/**< Flag to switch to 3-byte mode on reset. */
 	enum spi_flash_sfdp_quad_enable quad_enable;		/**< Method to enable QSPI. */
 	bool sr1_volatile;									/**< Flag to use volatile write enable for status register 1. */
+	bool track_write_state;								/**< Flag to skip status checks on reads when idle. */
+	bool write_idle;									/**< Flag indicating no write can be in progress. */
+	uint32_t poll_delay_ms[NUM_SPI_FLASH_WRITE_OPS];	/**< Time to wait before checking for write completion. */
+	struct spi_flash_write_stats stats[NUM_SPI_FLASH_WRITE_OPS];	/**< Write completion statistics. */
+	spi_flash_poll_yield poll_yield;					/**< Handler to call between status checks. */
+	void *yield_context;								/**< Context for the poll yield handler. */
+};
+
+/**
+ * A single region of flash to read as part of a batched read request.
+ */
+struct spi_flash_read_region {
+	uint32_t address;	/**< The address to start reading from. */
+	uint8_t *data;		/**< The buffer to hold the data that has been read. */
+	size_t length;		/**< The number of bytes to read. */
 };
 
 /**
@@ -155,6 +210,9 @@ int spi_flash_is_quad_spi_enabled (const struct spi_flash *flash);
 int spi_flash_configure_drive_strength (const struct spi_flash *flash);
 
 int spi_flash_read (const struct spi_flash *flash, uint32_t address, uint8_t *data, size_t length);
+int spi_flash_read_regions (const struct spi_flash *flash,
+	const struct spi_flash_read_region *regions, size_t count);
+int spi_flash_set_write_state_tracking (const struct spi_flash *flash, bool enable);
 
 int spi_flash_get_page_size (const struct spi_flash *flash, uint32_t *bytes);
 int spi_flash_minimum_write_per_page (const struct spi_flash *flash, uint32_t *bytes);
@@ -172,6 +230,14 @@ int spi_flash_chip_erase (const struct spi_flash *flash);
 int spi_flash_is_write_in_progress (const struct spi_flash *flash);
 int spi_flash_wait_for_write (const struct spi_flash *flash, int32_t timeout);
 
+int spi_flash_set_write_poll_delay (const struct spi_flash *flash, enum spi_flash_write_op op,
+	uint32_t delay_ms);
+int spi_flash_set_poll_yield (const struct spi_flash *flash, spi_flash_poll_yield yield,
+	void *context);
+int spi_flash_get_write_stats (const struct spi_flash *flash, enum spi_flash_write_op op,
+	struct spi_flash_write_stats *stats);
+int spi_flash_reset_write_stats (const struct spi_flash *flash);
+
 
 #define	SPI_FLASH_ERROR(code)		ROT_ERROR (ROT_MODULE_SPI_FLASH, code)
 
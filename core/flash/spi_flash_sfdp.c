@@ -88,9 +88,14 @@ struct spi_flash_sfdp_basic_parameter_table_1_0 {
 struct spi_flash_sfdp_basic_parameter_table_1_5 {
 	struct spi_flash_sfdp_basic_parameter_table_1_0 table_1_0;
 	uint32_t erase_time;		/**< 10th DWORD: Erase typical timing. */
+#define	SPI_FLASH_SFDP_ERASE_TIME(x, type)	(((x) >> (4 + (7 * (type)))) & 0x7f)
+#define	SPI_FLASH_SFDP_ERASE_COUNT(x)		(((x) & 0x1f) + 1)
+#define	SPI_FLASH_SFDP_ERASE_UNITS(x)		(((x) >> 5) & 0x3)
 	uint8_t page_size;			/**< 11th DWORD: Page size. */
 #define	SPI_FLASH_SFDP_PAGE_SIZE(x)			(((x) & 0xf0) >> 4)
 	uint16_t program_time;		/**< 11th DWORD: Page programming typical timing. */
+#define	SPI_FLASH_SFDP_PROGRAM_COUNT(x)		(((x) & 0x1f) + 1)
+#define	SPI_FLASH_SFDP_PROGRAM_64US			(1U << 5)
 	uint8_t chip_erase_time;	/**< 11th DWORD: Chip erase typical timing. */
 	uint32_t suspend_attr;		/**< 12th DWORD: Suspend/Resume attributes. */
 	uint8_t program_resume;		/**< 13th DWORD: Program Resume instruction. */
@@ -427,6 +432,64 @@ int spi_flash_sfdp_get_page_size (const struct spi_flash_sfdp_basic_table *table
 	return page;
 }
 
+/**
+ * Determine the typical time needed to complete program and erase operations.  This information is
+ * only available from devices that report at least version 1.5 of the basic parameter table.
+ *
+ * @param table The basic parameters table that will be queried.
+ * @param timing Output for the typical operation timing.
+ *
+ * @return 0 if the timing information was retrieved successfully or an error code.
+ */
+int spi_flash_sfdp_get_write_timing (const struct spi_flash_sfdp_basic_table *table,
+	struct spi_flash_sfdp_write_timing *timing)
+{
+	const uint32_t erase_units[] = {1, 16, 128, 1000};
+	const uint32_t chip_units[] = {16, 256, 4000, 64000};
+	struct spi_flash_sfdp_basic_parameter_table_1_5 *params;
+	uint8_t erase_size[4];
+	uint8_t erase;
+	int i;
+
+	if ((table == NULL) || (timing == NULL)) {
+		return SPI_FLASH_SFDP_INVALID_ARGUMENT;
+	}
+
+	memset (timing, 0, sizeof (struct spi_flash_sfdp_write_timing));
+
+	if (table->sfdp->sfdp_header.parameter0.minor_revision < 5) {
+		return 0;
+	}
+
+	params = (struct spi_flash_sfdp_basic_parameter_table_1_5*) table->data;
+
+	timing->page_program_us = SPI_FLASH_SFDP_PROGRAM_COUNT (params->program_time) *
+		((params->program_time & SPI_FLASH_SFDP_PROGRAM_64US) ? 64 : 8);
+	timing->chip_erase_ms = SPI_FLASH_SFDP_ERASE_COUNT (params->chip_erase_time) *
+		chip_units[SPI_FLASH_SFDP_ERASE_UNITS (params->chip_erase_time)];
+
+	erase_size[0] = params->table_1_0.erase1_size;
+	erase_size[1] = params->table_1_0.erase2_size;
+	erase_size[2] = params->table_1_0.erase3_size;
+	erase_size[3] = params->table_1_0.erase4_size;
+
+	for (i = 0; i < 4; i++) {
+		erase = SPI_FLASH_SFDP_ERASE_TIME (params->erase_time, i);
+
+		/* Erase sizes are reported as a power of 2. */
+		if (erase_size[i] == 12) {
+			timing->sector_erase_ms = SPI_FLASH_SFDP_ERASE_COUNT (erase) *
+				erase_units[SPI_FLASH_SFDP_ERASE_UNITS (erase)];
+		}
+		else if (erase_size[i] == 16) {
+			timing->block_erase_ms = SPI_FLASH_SFDP_ERASE_COUNT (erase) *
+				erase_units[SPI_FLASH_SFDP_ERASE_UNITS (erase)];
+		}
+	}
+
+	return 0;
+}
+
 /**
  * Parse read command information from the SFDP table.
  *
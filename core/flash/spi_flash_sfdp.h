@@ -88,6 +88,17 @@ struct spi_flash_sfdp_read_commands {
 	struct spi_flash_sfdp_read_cmd quad_4_4_4;	/**< QPI (4-4-4) fast read. */
 };
 
+/**
+ * Typical timing for write operations reported by the flash device.  Timing values that are not
+ * reported by the device will be 0.
+ */
+struct spi_flash_sfdp_write_timing {
+	uint32_t page_program_us;	/**< Typical time to program a full page, in microseconds. */
+	uint32_t sector_erase_ms;	/**< Typical time to erase a 4kB sector, in milliseconds. */
+	uint32_t block_erase_ms;	/**< Typical time to erase a 64kB block, in milliseconds. */
+	uint32_t chip_erase_ms;		/**< Typical time to erase the entire device, in milliseconds. */
+};
+
 /**
  * Supported methods for entering and exiting 4-byte addressing mode.
  */
@@ -120,6 +131,8 @@ int spi_flash_sfdp_get_device_capabilities (const struct spi_flash_sfdp_basic_ta
 	uint32_t *capabilities);
 int spi_flash_sfdp_get_device_size (const struct spi_flash_sfdp_basic_table *table);
 int spi_flash_sfdp_get_page_size (const struct spi_flash_sfdp_basic_table *table);
+int spi_flash_sfdp_get_write_timing (const struct spi_flash_sfdp_basic_table *table,
+	struct spi_flash_sfdp_write_timing *timing);
 
 int spi_flash_sfdp_get_read_commands (const struct spi_flash_sfdp_basic_table *table,
 	struct spi_flash_sfdp_read_commands *read);
@@ -190,49 +190,17 @@ int host_flash_manager_validate_offset_flash (struct pfm *pfm, struct hash_engin
 	struct rsa_engine *rsa, bool full_validation, const struct spi_flash *flash, uint32_t offset,
 	struct host_flash_manager_rw_regions *host_rw)
 {
-	struct pfm_firmware host_fw;
-	struct pfm_firmware_versions versions;
-	const struct pfm_firmware_version *version;
-	struct host_flash_manager_images host_img;
-	size_t i;
+	struct host_flash_manager_validation validation;
 	int status;
 
-	status = host_flash_manager_get_firmware_types (pfm, &host_fw, &host_img, host_rw);
+	status = host_flash_manager_prepare_validation (&validation, pfm, NULL, full_validation, flash,
+		offset, host_rw);
 	if (status != 0) {
 		return status;
 	}
 
-	for (i = 0; i < host_fw.count; i++) {
-		status = host_flash_manager_get_image_entry (pfm, flash, offset, host_fw.ids[i], &versions,
-			&version, &host_img.fw_images[i], (host_rw) ? &host_rw->writable[i] : NULL);
-		if (status != 0) {
-			goto free_host;
-		}
-
-		host_img.count++;
-		if (host_rw) {
-			host_rw->count++;
-		}
-
-		pfm->free_fw_versions (pfm, &versions);
-	}
-
-	if (full_validation) {
-		status = host_fw_full_flash_verification_multiple_fw (flash, host_img.fw_images,
-			host_rw->writable, host_fw.count, version->blank_byte, hash, rsa);
-	}
-	else {
-		status = host_fw_verify_offset_images_multiple_fw (flash, host_img.fw_images,
-			host_img.count, offset, hash, rsa);
-	}
-
-free_host:
-	if ((status != 0) && host_rw) {
-		host_flash_manager_free_read_write_regions (NULL, host_rw);
-	}
-
-	host_flash_manager_free_images (&host_img);
-	pfm->free_firmware (pfm, &host_fw);
+	status = host_flash_manager_run_validation (&validation, hash, rsa);
+	host_flash_manager_finish_validation (&validation, status);
 
 	return status;
 }
@@ -255,37 +223,94 @@ int host_flash_manager_validate_pfm (struct pfm *pfm, struct pfm *good_pfm,
 	struct hash_engine *hash, struct rsa_engine *rsa, const struct spi_flash *flash,
 	struct host_flash_manager_rw_regions *host_rw)
 {
-	struct pfm_firmware host_fw;
+	struct host_flash_manager_validation validation;
+	int status;
+
+	status = host_flash_manager_prepare_validation (&validation, pfm, good_pfm, false, flash, 0,
+		host_rw);
+	if (status != 0) {
+		return status;
+	}
+
+	status = host_flash_manager_run_validation (&validation, hash, rsa);
+	host_flash_manager_finish_validation (&validation, status);
+
+	return status;
+}
+
+/**
+ * Query a PFM for all the information necessary to validate a flash device.  No verification of
+ * the flash contents is performed, other than what is needed to find the matching PFM entries.
+ *
+ * Since the PFM is only accessed while preparing and finishing validation, verification of the
+ * flash contents can be executed from a different context than the one that owns the PFM.
+ *
+ * @param validation The validation context to prepare.
+ * @param pfm The PFM to use for validation.
+ * @param good_pfm A PFM known to be good for the flash image.  If the images in both PFMs are
+ * identical, verification of the flash contents will be skipped.  Set this to null to always
+ * verify the flash.  This is ignored if full_validation is set.
+ * @param full_validation Flag to control level of flash validation.
+ * @param flash The flash device to validate.
+ * @param offset An offset in flash for images that will be validated.  Ignored if full_validation
+ * is set.
+ * @param host_rw Output for the read/write regions of the flash.  This will only be valid if the
+ * flash is successfully validated.  This can be null if full_validation is false.
+ *
+ * @return 0 if the validation context was prepared successfully or an error code.  On success,
+ * host_flash_manager_finish_validation must be called to release the context.
+ */
+int host_flash_manager_prepare_validation (struct host_flash_manager_validation *validation,
+	struct pfm *pfm, struct pfm *good_pfm, bool full_validation, const struct spi_flash *flash,
+	uint32_t offset, struct host_flash_manager_rw_regions *host_rw)
+{
 	struct pfm_firmware_versions versions;
 	const struct pfm_firmware_version *version;
-	struct host_flash_manager_images host_img;
 	struct pfm_image_list fw_images_good;
 	size_t i;
 	int status;
 	int match_status = 0;
 
-	status = host_flash_manager_get_firmware_types (pfm, &host_fw, &host_img, host_rw);
+	if (full_validation) {
+		good_pfm = NULL;
+	}
+
+	validation->pfm = pfm;
+	validation->flash = flash;
+	validation->host_rw = host_rw;
+	validation->offset = offset;
+	validation->blank_byte = 0xff;
+	validation->full_validation = full_validation;
+	validation->skip_verify = false;
+
+	status = host_flash_manager_get_firmware_types (pfm, &validation->host_fw,
+		&validation->host_img, host_rw);
 	if (status != 0) {
 		return status;
 	}
 
-	for (i = 0; i < host_fw.count; i++) {
-		status = host_flash_manager_get_image_entry (pfm, flash, 0, host_fw.ids[i], &versions,
-			&version, &host_img.fw_images[i], (host_rw) ? &host_rw->writable[i] : NULL);
+	for (i = 0; i < validation->host_fw.count; i++) {
+		status = host_flash_manager_get_image_entry (pfm, flash, offset,
+			validation->host_fw.ids[i], &versions, &version, &validation->host_img.fw_images[i],
+			(host_rw) ? &host_rw->writable[i] : NULL);
 		if (status != 0) {
-			goto free_host;
+			host_flash_manager_finish_validation (validation, status);
+
+			return status;
 		}
 
-		host_img.count++;
+		validation->host_img.count++;
 		if (host_rw) {
 			host_rw->count++;
 		}
 
-		if (match_status == 0) {
-			match_status = good_pfm->get_firmware_images (good_pfm, host_fw.ids[i],
+		validation->blank_byte = version->blank_byte;
+
+		if (good_pfm && (match_status == 0)) {
+			match_status = good_pfm->get_firmware_images (good_pfm, validation->host_fw.ids[i],
 				version->fw_version_id, &fw_images_good);
 			if (match_status == 0) {
-				match_status = host_fw_are_images_different (&host_img.fw_images[i],
+				match_status = host_fw_are_images_different (&validation->host_img.fw_images[i],
 					&fw_images_good);
 
 				good_pfm->free_firmware_images (good_pfm, &fw_images_good);
@@ -295,20 +320,56 @@ int host_flash_manager_validate_pfm (struct pfm *pfm, struct pfm *good_pfm,
 		pfm->free_fw_versions (pfm, &versions);
 	}
 
-	if (match_status != 0) {
-		status = host_fw_verify_images_multiple_fw (flash, host_img.fw_images, host_img.count, hash,
-			rsa);
+	validation->skip_verify = (good_pfm && (match_status == 0));
+
+	return 0;
+}
+
+/**
+ * Verify the contents of a flash device using a prepared validation context.  The PFM used to
+ * prepare the context is not accessed.
+ *
+ * @param validation The validation context to use for verification.
+ * @param hash The hash to use for image validation.
+ * @param rsa The RSA engine to use for signature verification.
+ *
+ * @return 0 if the validation was successful or an error code.
+ */
+int host_flash_manager_run_validation (const struct host_flash_manager_validation *validation,
+	struct hash_engine *hash, struct rsa_engine *rsa)
+{
+	if (validation->skip_verify) {
+		return 0;
 	}
 
-free_host:
-	if ((status != 0) && host_rw) {
-		host_flash_manager_free_read_write_regions (NULL, host_rw);
+	if (validation->full_validation) {
+		return host_fw_full_flash_verification_multiple_fw (validation->flash,
+			validation->host_img.fw_images, validation->host_rw->writable,
+			validation->host_fw.count, validation->blank_byte, hash, rsa);
 	}
+	else {
+		return host_fw_verify_offset_images_multiple_fw (validation->flash,
+			validation->host_img.fw_images, validation->host_img.count, validation->offset, hash,
+			rsa);
+	}
+}
 
-	host_flash_manager_free_images (&host_img);
-	pfm->free_firmware (pfm, &host_fw);
+/**
+ * Release a validation context.  If validation failed, the read/write regions for the flash will
+ * also be released.
+ *
+ * @param validation The validation context to release.
+ * @param status The result of the flash validation.
+ */
+void host_flash_manager_finish_validation (struct host_flash_manager_validation *validation,
+	int status)
+{
+	if ((status != 0) && validation->host_rw) {
+		host_flash_manager_free_read_write_regions (NULL, validation->host_rw);
+	}
 
-	return status;
+	host_flash_manager_free_images (&validation->host_img);
+	validation->pfm->free_firmware (validation->pfm, &validation->host_fw);
 }
 
 /**
@@ -35,6 +35,22 @@ struct host_flash_manager_images {
 	size_t count;						/**< The number of PFM entries in the list. */
 };
 
+/**
+ * Information from a PFM necessary to verify the contents of a flash device.  Once prepared,
+ * verification only requires access to the flash device and does not access the PFM.
+ */
+struct host_flash_manager_validation {
+	struct pfm *pfm;								/**< The PFM used for validation. */
+	const struct spi_flash *flash;					/**< The flash device being validated. */
+	struct pfm_firmware host_fw;					/**< List of firmware components in the PFM. */
+	struct host_flash_manager_images host_img;		/**< List of images to verify on flash. */
+	struct host_flash_manager_rw_regions *host_rw;	/**< List of read/write regions on flash. */
+	uint32_t offset;								/**< Offset to apply to image addresses. */
+	uint8_t blank_byte;								/**< Expected value for unused flash. */
+	bool full_validation;							/**< Flag to run full flash validation. */
+	bool skip_verify;								/**< Flag indicating images don't need to be verified. */
+};
+
 /**
  * Manager for protected flash devices for a single host processor.
  */
@@ -100,6 +116,37 @@ struct host_flash_manager {
 		struct hash_engine *hash, struct rsa_engine *rsa,
 		struct host_flash_manager_rw_regions *host_rw);
 
+	/**
+	 * Validate both the read/write and read-only flash devices at the same time.  The result is
+	 * the same as calling validate_read_write_flash and validate_read_only_flash, but flash
+	 * verification for each device can run concurrently.
+	 *
+	 * This is optional and will be null if the manager does not support concurrent validation.
+	 *
+	 * @param manager The flash manager to use for validation.
+	 * @param pfm The PFM to validate both flash devices against.
+	 * @param good_pfm A PFM known to validate against the read-only flash.  This has the same
+	 * meaning as for validate_read_only_flash.
+	 * @param hash The hash engine to use for validation.
+	 * @param rsa The RSA engine to use for signature verification.
+	 * @param full_validation Flag indicating if a full validation should be run on the read-only
+	 * flash.  The read/write flash always receives full validation.
+	 * @param rw_host_rw Output for the list of read/write regions for the read/write flash.  This
+	 * will be uninitialized if validation of the read/write flash failed.  On successful return,
+	 * this structure must be freed by the caller.
+	 * @param ro_host_rw Output for the list of read/write regions for the read-only flash.  This
+	 * will be uninitialized if validation of the read-only flash failed.  If ro_status is 0, this
+	 * structure must be freed by the caller.
+	 * @param ro_status Output for the result of validating the read-only flash.
+	 *
+	 * @return 0 if the read/write flash was successfully validated or an error code.  Blank check
+	 * failures will be reported with FLASH_UTIL_UNEXPECTED_VALUE.
+	 */
+	int (*validate_flash_parallel) (struct host_flash_manager *manager, struct pfm *pfm,
+		struct pfm *good_pfm, struct hash_engine *hash, struct rsa_engine *rsa,
+		bool full_validation, struct host_flash_manager_rw_regions *rw_host_rw,
+		struct host_flash_manager_rw_regions *ro_host_rw, int *ro_status);
+
 	/**
 	 * Get the read/write regions defined in a PFM for the firmware on flash.  No validation of the
 	 * flash will be performed other than what is necessary to determine the appropriate read/write
@@ -251,6 +298,14 @@ int host_flash_manager_validate_pfm (struct pfm *pfm, struct pfm *good_pfm,
 	struct hash_engine *hash, struct rsa_engine *rsa, const struct spi_flash *flash,
 	struct host_flash_manager_rw_regions *host_rw);
 
+int host_flash_manager_prepare_validation (struct host_flash_manager_validation *validation,
+	struct pfm *pfm, struct pfm *good_pfm, bool full_validation, const struct spi_flash *flash,
+	uint32_t offset, struct host_flash_manager_rw_regions *host_rw);
+int host_flash_manager_run_validation (const struct host_flash_manager_validation *validation,
+	struct hash_engine *hash, struct rsa_engine *rsa);
+void host_flash_manager_finish_validation (struct host_flash_manager_validation *validation,
+	int status);
+
 int host_flash_manager_get_flash_read_write_regions (const struct spi_flash *flash, struct pfm *pfm,
 	struct host_flash_manager_rw_regions *host_rw);
 
@@ -6,6 +6,7 @@
 #include <string.h>
 #include "host_flash_manager_dual.h"
 #include "host_fw_util.h"
+#include "common/type_cast.h"
 #include "common/unused.h"
 
 
@@ -79,6 +80,84 @@ static int host_flash_manager_dual_validate_read_write_flash (struct host_flash_
 		host_flash_manager_dual_get_read_write_flash (manager), host_rw);
 }
 
+static int host_flash_manager_dual_validate_flash_parallel (struct host_flash_manager *manager,
+	struct pfm *pfm, struct pfm *good_pfm, struct hash_engine *hash, struct rsa_engine *rsa,
+	bool full_validation, struct host_flash_manager_rw_regions *rw_host_rw,
+	struct host_flash_manager_rw_regions *ro_host_rw, int *ro_status)
+{
+	struct host_flash_manager_dual *dual = (struct host_flash_manager_dual*) manager;
+	struct host_flash_manager_validation ro_validation;
+	bool submitted = false;
+	int ro_prepared;
+	int status;
+
+	if ((dual == NULL) || (pfm == NULL) || (hash == NULL) || (rsa == NULL) ||
+		(rw_host_rw == NULL) || (ro_host_rw == NULL) || (ro_status == NULL)) {
+		return HOST_FLASH_MGR_INVALID_ARGUMENT;
+	}
+
+	/* The PFM is not safe to access from multiple contexts, so all PFM queries are done up front.
+	 * Only verification of the read/write flash contents is handed off to the validation task. */
+	status = host_flash_manager_prepare_validation (&dual->task_validation, pfm, NULL, true,
+		host_flash_manager_dual_get_read_write_flash (manager), 0, rw_host_rw);
+	if (status == 0) {
+		platform_semaphore_reset (&dual->task_done);
+
+		if (event_task_submit_event (dual->task, &dual->base_event,
+			HOST_FLASH_MANAGER_DUAL_ACTION_VALIDATE, NULL, 0, 0, NULL) == 0) {
+			submitted = true;
+		}
+		else {
+			/* The task is not available, so validate the flash from this context instead. */
+			dual->task_status = host_flash_manager_run_validation (&dual->task_validation, hash,
+				rsa);
+		}
+	}
+
+	ro_prepared = host_flash_manager_prepare_validation (&ro_validation, pfm, good_pfm,
+		full_validation, host_flash_manager_dual_get_read_only_flash (manager), 0, ro_host_rw);
+	if (ro_prepared == 0) {
+		*ro_status = host_flash_manager_run_validation (&ro_validation, hash, rsa);
+		host_flash_manager_finish_validation (&ro_validation, *ro_status);
+	}
+	else {
+		*ro_status = ro_prepared;
+	}
+
+	if (submitted) {
+		platform_semaphore_wait (&dual->task_done, 0);
+	}
+
+	if (status == 0) {
+		status = dual->task_status;
+		host_flash_manager_finish_validation (&dual->task_validation, status);
+	}
+
+	return status;
+}
+
+/**
+ * Run read/write flash validation from the context of the validation task.
+ *
+ * @param handler The flash manager handler.
+ * @param context The event context for the task.
+ * @param reset Unused.
+ */
+static void host_flash_manager_dual_execute (const struct event_task_handler *handler,
+	struct event_task_context *context, bool *reset)
+{
+	struct host_flash_manager_dual *dual = TO_DERIVED_TYPE (handler,
+		struct host_flash_manager_dual, base_event);
+
+	UNUSED (reset);
+
+	if (context->action == HOST_FLASH_MANAGER_DUAL_ACTION_VALIDATE) {
+		dual->task_status = host_flash_manager_run_validation (&dual->task_validation,
+			dual->task_hash, dual->task_rsa);
+		platform_semaphore_post (&dual->task_done);
+	}
+}
+
 static int host_flash_manager_dual_get_flash_read_write_regions (struct host_flash_manager *manager,
 	struct pfm *pfm, bool rw_flash, struct host_flash_manager_rw_regions *host_rw)
 {
@@ -420,5 +499,47 @@ int host_flash_manager_dual_init_with_managed_flash_initialization (
  */
 void host_flash_manager_dual_release (struct host_flash_manager_dual *manager)
 {
-	UNUSED (manager);
+	if (manager && manager->task) {
+		platform_semaphore_free (&manager->task_done);
+	}
+}
+
+/**
+ * Enable parallel validation of the read/write and read-only flash devices.  Verification of the
+ * read/write flash will be run from a separate task while the read-only flash is verified from the
+ * calling context.  To benefit from this, the two flash devices must be accessible at the same time
+ * and each task must use an independent hash engine.
+ *
+ * @param manager The flash manager to update.
+ * @param task The task that will be used to validate the read/write flash.
+ * @param hash The hash engine to use from the validation task.  This must be a different instance
+ * than the hash engine provided for flash validation calls.
+ * @param rsa The RSA engine to use from the validation task.
+ *
+ * @return 0 if parallel validation was enabled or an error code.
+ */
+int host_flash_manager_dual_enable_parallel_validation (struct host_flash_manager_dual *manager,
+	const struct event_task *task, struct hash_engine *hash, struct rsa_engine *rsa)
+{
+	int status;
+
+	if ((manager == NULL) || (task == NULL) || (hash == NULL) || (rsa == NULL)) {
+		return HOST_FLASH_MGR_INVALID_ARGUMENT;
+	}
+
+	if (manager->task == NULL) {
+		status = platform_semaphore_init (&manager->task_done);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	manager->base.validate_flash_parallel = host_flash_manager_dual_validate_flash_parallel;
+	manager->base_event.execute = host_flash_manager_dual_execute;
+
+	manager->task = task;
+	manager->task_hash = hash;
+	manager->task_rsa = rsa;
+
+	return 0;
 }
@@ -6,6 +6,8 @@
 
 #include "host_flash_manager.h"
 #include "host_state_manager.h"
+#include "platform_api.h"
+#include "system/event_task.h"
 
 
 /**
@@ -19,6 +21,20 @@ struct host_flash_manager_dual {
 	const struct spi_filter_interface *filter;			/**< The SPI filter connected to the flash devices. */
 	const struct flash_mfg_filter_handler *mfg_handler;	/**< The filter handler for flash device types. */
 	struct host_flash_initialization *flash_init;		/**< Host flash initialization manager. */
+	struct event_task_handler base_event;				/**< The base interface for task integration. */
+	const struct event_task *task;						/**< Task for parallel flash validation. */
+	struct hash_engine *task_hash;						/**< Hash engine used by the validation task. */
+	struct rsa_engine *task_rsa;						/**< RSA engine used by the validation task. */
+	struct host_flash_manager_validation task_validation;	/**< Validation being run by the task. */
+	int task_status;									/**< Result of the validation run by the task. */
+	platform_semaphore task_done;						/**< Signal for validation task completion. */
+};
+
+/**
+ * Action identifiers for the parallel validation task.
+ */
+enum {
+	HOST_FLASH_MANAGER_DUAL_ACTION_VALIDATE = 1,	/**< Validate the read/write flash. */
 };
 
 
@@ -32,5 +48,8 @@ int host_flash_manager_dual_init_with_managed_flash_initialization (
 	struct host_flash_initialization *flash_init);
 void host_flash_manager_dual_release (struct host_flash_manager_dual *manager);
 
+int host_flash_manager_dual_enable_parallel_validation (struct host_flash_manager_dual *manager,
+	const struct event_task *task, struct hash_engine *hash, struct rsa_engine *rsa);
+
 
 #endif	/* HOST_FLASH_MANAGER_DUAL_H_ */
@@ -6,10 +6,23 @@
 #include <string.h>
 #include "host_fw_util.h"
 #include "platform_api.h"
+#include "common/array_size.h"
 #include "common/buffer_util.h"
 #include "flash/flash_util.h"
 
 
+/**
+ * A section of the map of flash used by firmware components.  Regions that are contiguous or
+ * overlap are merged into a single entry, and entries are kept in address order.
+ */
+struct host_fw_region_map {
+	struct flash_region regions[HOST_FW_UTIL_REGION_MAP_LEN];	/**< Merged regions in the map. */
+	size_t count;												/**< Number of entries in the map. */
+	uint32_t start;												/**< Regions are only added starting at this address. */
+	uint32_t limit;												/**< All regions starting below this address are in the map. */
+	bool complete;												/**< Flag indicating every remaining region is in the map. */
+};
+
 /**
  * Search a list of host firmware version identifiers to find the longest string.
  *
@@ -69,7 +82,9 @@ int host_fw_determine_version (const struct spi_flash *flash,
 int host_fw_determine_offset_version (const struct spi_flash *flash, uint32_t offset,
 	const struct pfm_firmware_versions *allowed, const struct pfm_firmware_version **version)
 {
-	char *fw_version;
+	char version_buffer[HOST_FW_UTIL_VERSION_BUFFER_LEN];
+	char *fw_version = version_buffer;
+	size_t max_len;
 	size_t version_len;
 	size_t current_len;
 	int status;
@@ -84,9 +99,12 @@ int host_fw_determine_offset_version (const struct spi_flash *flash, uint32_t of
 		return HOST_FW_UTIL_UNSUPPORTED_VERSION;
 	}
 
-	fw_version = platform_malloc (host_fw_find_longest_version_id (allowed));
-	if (fw_version == NULL) {
-		return HOST_FW_UTIL_NO_MEMORY;
+	max_len = host_fw_find_longest_version_id (allowed);
+	if (max_len > sizeof (version_buffer)) {
+		fw_version = platform_malloc (max_len);
+		if (fw_version == NULL) {
+			return HOST_FW_UTIL_NO_MEMORY;
+		}
 	}
 
 	*version = NULL;
@@ -160,7 +178,9 @@ int host_fw_determine_offset_version (const struct spi_flash *flash, uint32_t of
 	}
 
 exit:
-	platform_free (fw_version);
+	if (fw_version != version_buffer) {
+		platform_free (fw_version);
+	}
 
 	return status;
 }
@@ -196,6 +216,242 @@ static const struct flash_region* host_fw_find_next_region (uint32_t last_addr,
 	return next;
 }
 
+/**
+ * Move a region down a max-heap of regions, ordered by start address, until the heap property is
+ * restored.
+ *
+ * @param regions The array of regions that make up the heap.
+ * @param root The index of the region to move down the heap.
+ * @param count The number of regions in the heap.
+ */
+static void host_fw_sift_region_down (struct flash_region *regions, size_t root, size_t count)
+{
+	struct flash_region tmp;
+	size_t child;
+
+	while ((child = (root * 2) + 1) < count) {
+		if (((child + 1) < count) &&
+			(regions[child + 1].start_addr > regions[child].start_addr)) {
+			child++;
+		}
+
+		if (regions[root].start_addr >= regions[child].start_addr) {
+			return;
+		}
+
+		tmp = regions[root];
+		regions[root] = regions[child];
+		regions[child] = tmp;
+		root = child;
+	}
+}
+
+/**
+ * Sort a list of flash regions in place by increasing start address.
+ *
+ * @param regions The list of regions to sort.
+ * @param count The number of regions in the list.
+ */
+static void host_fw_sort_regions (struct flash_region *regions, size_t count)
+{
+	struct flash_region tmp;
+	size_t i;
+
+	if (count < 2) {
+		return;
+	}
+
+	for (i = count / 2; i > 0; i--) {
+		host_fw_sift_region_down (regions, i - 1, count);
+	}
+
+	for (i = count - 1; i > 0; i--) {
+		tmp = regions[0];
+		regions[0] = regions[i];
+		regions[i] = tmp;
+		host_fw_sift_region_down (regions, 0, i);
+	}
+}
+
+/**
+ * Add a flash region to a section of the region map.  Any part of the region before the start of
+ * the section is ignored.  If the map is full, the entries with the highest addresses are left
+ * for a later section.
+ *
+ * @param map The region map section to update.
+ * @param region The flash region to add.
+ */
+static void host_fw_add_region_to_map (struct host_fw_region_map *map,
+	const struct flash_region *region)
+{
+	uint32_t start = region->start_addr;
+	uint32_t end = region->start_addr + region->length;
+	size_t first;
+	size_t last;
+	size_t mid;
+
+	if (start < map->start) {
+		start = map->start;
+	}
+
+	if ((end <= start) || (!map->complete && (start >= map->limit))) {
+		return;
+	}
+
+	/* Find the first entry that ends at or after the start of the region.  This is the first entry
+	 * that could be merged with the region. */
+	first = 0;
+	last = map->count;
+	while (first < last) {
+		mid = (first + last) / 2;
+		if ((map->regions[mid].start_addr + map->regions[mid].length) < start) {
+			first = mid + 1;
+		}
+		else {
+			last = mid;
+		}
+	}
+
+	for (last = first; (last < map->count) && (map->regions[last].start_addr <= end); last++) {
+		if (map->regions[last].start_addr < start) {
+			start = map->regions[last].start_addr;
+		}
+
+		if ((map->regions[last].start_addr + map->regions[last].length) > end) {
+			end = map->regions[last].start_addr + map->regions[last].length;
+		}
+	}
+
+	if (last != first) {
+		/* Merge all entries that overlap or are contiguous with the region into one entry. */
+		map->regions[first].start_addr = start;
+		map->regions[first].length = end - start;
+
+		memmove (&map->regions[first + 1], &map->regions[last],
+			sizeof (struct flash_region) * (map->count - last));
+		map->count -= (last - first) - 1;
+
+		return;
+	}
+
+	if (map->count == ARRAY_SIZE (map->regions)) {
+		map->complete = false;
+
+		if (first == map->count) {
+			/* The region is after every entry in a full map, so it belongs to a later section. */
+			map->limit = start;
+
+			return;
+		}
+
+		/* Make room for the region by leaving the highest entry for a later section. */
+		map->count--;
+		map->limit = map->regions[map->count].start_addr;
+	}
+
+	memmove (&map->regions[first + 1], &map->regions[first],
+		sizeof (struct flash_region) * (map->count - first));
+
+	map->regions[first].start_addr = start;
+	map->regions[first].length = end - start;
+	map->count++;
+}
+
+/**
+ * Build a section of the sorted map of the flash used by firmware components.  Any regions that are
+ * contiguous or overlap are merged into a single entry in the map, so the map can be processed with
+ * a single pass over flash.
+ *
+ * The map section holds at most HOST_FW_UTIL_REGION_MAP_LEN entries.  If the section does not
+ * contain every remaining region, the last entry could still grow to include regions that were
+ * left out and must not be processed.  This entry is carried over to the start of the next
+ * section.
+ *
+ * @param img_list An array of firmware images to add to the map.  This can be null to only generate
+ * a map of read/write regions.
+ * @param writable An array of read/write regions to add to the map.  This can be null to only
+ * generate a map of image regions.
+ * @param fw_count The number of firmware components in the arrays.
+ * @param map The region map section to build.  When building the next section, this contains the
+ * previous section.
+ * @param next true to build the section that follows the current one or false to build the first
+ * section.
+ *
+ * @return The number of entries at the start of the map section that are complete.
+ */
+static size_t host_fw_build_region_map (const struct pfm_image_list *img_list,
+	const struct pfm_read_write_regions *writable, size_t fw_count, struct host_fw_region_map *map,
+	bool next)
+{
+	size_t i;
+	size_t j;
+	size_t k;
+
+	if (next) {
+		/* Every region that starts before the limit of the previous section is already part of its
+		 * last entry, so only regions after the limit need to be added to this entry. */
+		map->regions[0] = map->regions[map->count - 1];
+		map->count = 1;
+		map->start = map->limit;
+	}
+	else {
+		map->count = 0;
+		map->start = 0;
+	}
+
+	map->limit = 0;
+	map->complete = true;
+
+	for (i = 0; i < fw_count; i++) {
+		if (img_list) {
+			for (j = 0; j < img_list[i].count; j++) {
+				if (img_list[i].images_sig) {
+					for (k = 0; k < img_list[i].images_sig[j].count; k++) {
+						host_fw_add_region_to_map (map, &img_list[i].images_sig[j].regions[k]);
+					}
+				}
+				else {
+					for (k = 0; k < img_list[i].images_hash[j].count; k++) {
+						host_fw_add_region_to_map (map, &img_list[i].images_hash[j].regions[k]);
+					}
+				}
+			}
+		}
+
+		if (writable) {
+			for (j = 0; j < writable[i].count; j++) {
+				host_fw_add_region_to_map (map, &writable[i].regions[j]);
+			}
+		}
+	}
+
+	return (map->complete) ? map->count : (map->count - 1);
+}
+
+/**
+ * Count the number of times a region appears in a list of regions.
+ *
+ * @param region The region to search for.
+ * @param list The list of regions to search.
+ * @param count The number of regions in the list.
+ *
+ * @return The number of entries in the list that match the region.
+ */
+static size_t host_fw_count_region (const struct flash_region *region,
+	const struct flash_region *list, size_t count)
+{
+	size_t matches = 0;
+	size_t i;
+
+	for (i = 0; i < count; i++) {
+		if ((list[i].start_addr == region->start_addr) && (list[i].length == region->length)) {
+			matches++;
+		}
+	}
+
+	return matches;
+}
+
 /**
  * Determine if two lists of regions are different.  Ordering of the regions in the list doesn't
  * matter.
@@ -210,34 +466,41 @@ static const struct flash_region* host_fw_find_next_region (uint32_t last_addr,
 static bool host_fw_are_regions_different (const struct flash_region *region1, size_t count1,
 	const struct flash_region *region2, size_t count2)
 {
-	uint32_t last_addr;
-	const struct flash_region *pos1;
-	const struct flash_region *pos2;
+	struct flash_region sorted[HOST_FW_UTIL_REGION_MAP_LEN];
+	bool different = false;
+	size_t i;
 
 	if (count1 != count2) {
 		return true;
 	}
 
-	last_addr = 0;
-	pos1 = host_fw_find_next_region (last_addr, region1, count1);
-	while (pos1) {
-		pos2 = host_fw_find_next_region (last_addr, region2, count2);
-		if (!pos2) {
-			return true;
+	if (count1 > (ARRAY_SIZE (sorted) / 2)) {
+		/* The lists are too long to sort on the stack, so check that every region appears the same
+		 * number of times in both lists. */
+		for (i = 0; (i < count1) && !different; i++) {
+			if (host_fw_count_region (&region1[i], region1, count1) !=
+				host_fw_count_region (&region1[i], region2, count2)) {
+				different = true;
+			}
 		}
 
-		if (pos1->start_addr != pos2->start_addr) {
-			return true;
-		}
-		if (pos1->length != pos2->length) {
-			return true;
-		}
+		return different;
+	}
+
+	memcpy (sorted, region1, sizeof (struct flash_region) * count1);
+	memcpy (&sorted[count1], region2, sizeof (struct flash_region) * count2);
+
+	host_fw_sort_regions (sorted, count1);
+	host_fw_sort_regions (&sorted[count1], count2);
 
-		last_addr = pos1->start_addr + pos1->length;
-		pos1 = host_fw_find_next_region (last_addr, region1, count1);
+	for (i = 0; (i < count1) && !different; i++) {
+		if ((sorted[i].start_addr != sorted[count1 + i].start_addr) ||
+			(sorted[i].length != sorted[count1 + i].length)) {
+			different = true;
+		}
 	}
 
-	return false;
+	return different;
 }
 
 /**
@@ -461,49 +724,6 @@ int host_fw_verify_offset_images_multiple_fw (const struct spi_flash *flash,
 	return 0;
 }
 
-/**
- * Find the next flash region defined to be part of a firmware image.
- *
- * @param last_addr The flash address to start looking for the next region.
- * @param img_list The list of firmware images in flash.
- * @param fw_count The number of image instances.
- *
- * @return The region description for the next defined image region or null if there are no more
- * defined regions.
- */
-static const struct flash_region* host_fw_find_next_img_region (uint32_t last_addr,
-	const struct pfm_image_list *img_list, size_t fw_count)
-{
-	const struct flash_region *next = NULL;
-	const struct flash_region *img_next;
-	size_t i;
-	size_t j;
-
-	for (i = 0; i < fw_count; i++) {
-		for (j = 0; j < img_list[i].count; j++) {
-			if (img_list[i].images_sig) {
-				img_next = host_fw_find_next_region (last_addr, img_list[i].images_sig[j].regions,
-					img_list[i].images_sig[j].count);
-			}
-			else {
-				img_next = host_fw_find_next_region (last_addr, img_list[i].images_hash[j].regions,
-					img_list[i].images_hash[j].count);
-			}
-
-			if (img_next) {
-				if (img_next->start_addr == last_addr) {
-					return img_next;
-				}
-				else if (!next || (img_next->start_addr < next->start_addr)) {
-					next = img_next;
-				}
-			}
-		}
-	}
-
-	return next;
-}
-
 /**
  * Find the next read/write region defined in the flash.
  *
@@ -537,42 +757,6 @@ static const struct flash_region* host_fw_find_next_rw_region (uint32_t last_add
 	return next;
 }
 
-/**
- * Find the next used region of flash.
- *
- * @param last_addr The flash address to start looking for the next region.
- * @param img_list The list of images in the flash.
- * @param writable The list of read/write regions in the flash.
- * @param fw_count The number of different firmware instances.
- *
- * @return The region description for the next used region or null if there are no more used
- * regions.
- */
-static const struct flash_region* host_fw_find_next_flash_region (uint32_t last_addr,
-	const struct pfm_image_list *img_list, const struct pfm_read_write_regions *writable,
-	size_t fw_count)
-{
-	const struct flash_region *next;
-	const struct flash_region *rw_next;
-
-	next = host_fw_find_next_img_region (last_addr, img_list, fw_count);
-	if (next && (next->start_addr == last_addr)) {
-		return next;
-	}
-
-	rw_next = host_fw_find_next_rw_region (last_addr, writable, fw_count);
-	if (rw_next) {
-		if (!next || (rw_next->start_addr == last_addr)) {
-			next = rw_next;
-		}
-		else if (rw_next->start_addr < next->start_addr) {
-			next = rw_next;
-		}
-	}
-
-	return next;
-}
-
 /**
  * Verify that the entire flash contents are good.  All images will be verified and unused regions
  * of read-only flash will be verified to be empty.
@@ -617,7 +801,8 @@ int host_fw_full_flash_verification_multiple_fw (const struct spi_flash *flash,
 	const struct pfm_image_list *img_list, const struct pfm_read_write_regions *writable,
 	size_t fw_count, uint8_t unused_byte, struct hash_engine *hash, struct rsa_engine *rsa)
 {
-	const struct flash_region *pos;
+	struct host_fw_region_map map;
+	size_t map_count;
 	uint32_t flash_size;
 	uint32_t last_addr;
 	int status;
@@ -641,16 +826,23 @@ int host_fw_full_flash_verification_multiple_fw (const struct spi_flash *flash,
 	}
 
 	last_addr = 0;
-	pos = host_fw_find_next_flash_region (last_addr, img_list, writable, fw_count);
-	while (pos) {
-		status = flash_value_check (&flash->base, last_addr, pos->start_addr - last_addr,
-			unused_byte);
-		if (status != 0) {
-			return status;
+	map_count = host_fw_build_region_map (img_list, writable, fw_count, &map, false);
+	while (1) {
+		for (i = 0; i < map_count; i++) {
+			status = flash_value_check (&flash->base, last_addr,
+				map.regions[i].start_addr - last_addr, unused_byte);
+			if (status != 0) {
+				return status;
+			}
+
+			last_addr = map.regions[i].start_addr + map.regions[i].length;
 		}
 
-		last_addr = pos->start_addr + pos->length;
-		pos = host_fw_find_next_flash_region (last_addr, img_list, writable, fw_count);
+		if (map.complete) {
+			break;
+		}
+
+		map_count = host_fw_build_region_map (img_list, writable, fw_count, &map, true);
 	}
 
 	return flash_value_check (&flash->base, last_addr, flash_size - last_addr, unused_byte);
@@ -1036,11 +1228,10 @@ int host_fw_config_spi_filter_read_write_regions_multiple_fw (
 	const struct spi_filter_interface *filter, const struct pfm_read_write_regions *writable,
 	size_t fw_count)
 {
-	uint8_t region_id = 0;
-	uint32_t last_addr = 0;
-	const struct flash_region *next = NULL;
-	const struct flash_region *prev = NULL;
-	size_t total_len;
+	struct host_fw_region_map map;
+	size_t map_count;
+	size_t region = 1;
+	size_t i;
 	int status;
 
 	if ((filter == NULL) || ((writable == NULL) && (fw_count != 0))) {
@@ -1052,38 +1243,20 @@ int host_fw_config_spi_filter_read_write_regions_multiple_fw (
 		return status;
 	}
 
-	do {
-		if (!prev) {
-			prev = next;
-		}
-		next = host_fw_find_next_rw_region (last_addr, writable, fw_count);
-
-		if (prev) {
-			if (next && (next->start_addr == last_addr)) {
-				/* The next region is contiguous with the previous one. */
-				total_len += next->length;
-				last_addr += next->length;
-			}
-			else {
-				/* Found the end of a R/W region. */
-				status = filter->set_filter_rw_region (filter, ++region_id, prev->start_addr,
-					prev->start_addr + total_len);
-				if (status != 0) {
-					return status;
-				}
-
-				prev = NULL;
-				if (next) {
-					total_len = next->length;
-					last_addr = next->start_addr + next->length;
-				}
+	map_count = host_fw_build_region_map (NULL, writable, fw_count, &map, false);
+	while (1) {
+		for (i = 0; i < map_count; i++, region++) {
+			status = filter->set_filter_rw_region (filter, region, map.regions[i].start_addr,
+				map.regions[i].start_addr + map.regions[i].length);
+			if (status != 0) {
+				return status;
 			}
 		}
-		else if (next) {
-			total_len = next->length;
-			last_addr = next->start_addr + next->length;
+
+		if (map.complete) {
+			return 0;
 		}
-	} while (prev || next);
 
-	return 0;
+		map_count = host_fw_build_region_map (NULL, writable, fw_count, &map, true);
+	}
 }
@@ -14,6 +14,30 @@
 #include "status/rot_status.h"
 
 
+/**
+ * The size of the stack buffer used to read version strings from flash when determining the
+ * version of host firmware.  If any allowed version ID is longer than this, a buffer will be
+ * dynamically allocated instead.
+ */
+#ifndef HOST_FW_UTIL_VERSION_BUFFER_LEN
+#define	HOST_FW_UTIL_VERSION_BUFFER_LEN		64
+#endif
+
+/**
+ * The number of merged flash regions kept on the stack while walking the regions used by host
+ * firmware for full flash verification and SPI filter configuration.  Layouts with more disjoint
+ * regions than this are processed in multiple passes over the region lists.  Region lists with up
+ * to half this many entries are sorted on the stack for comparison.
+ */
+#ifndef HOST_FW_UTIL_REGION_MAP_LEN
+#define	HOST_FW_UTIL_REGION_MAP_LEN			32
+#endif
+
+#if HOST_FW_UTIL_REGION_MAP_LEN < 3
+#error "The host firmware region map must hold at least three regions."
+#endif
+
+
 int host_fw_determine_version (const struct spi_flash *flash,
 	const struct pfm_firmware_versions *allowed, const struct pfm_firmware_version **version);
 int host_fw_determine_offset_version (const struct spi_flash *flash, uint32_t offset,
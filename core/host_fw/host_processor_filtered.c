@@ -446,16 +446,31 @@ static int host_processor_filtered_validate_flash (struct host_processor_filtere
 	bool is_validated, bool single, bool *config_fail)
 {
 	struct host_flash_manager_rw_regions rw_list;
+	struct host_flash_manager_rw_regions ro_list;
 	int status = HOST_PROCESSOR_RW_SKIPPED;
+	int ro_status = 0;
 	int dirty_fail = 0;
 	bool checked_rw = true;
 	bool failed_rw = false;
+	bool parallel_ro = false;
 	bool pfm_dirty = host_state_manager_is_pfm_dirty (host->state);
 
 	if (!is_bypass && host_state_manager_is_inactive_dirty (host->state)) {
 		if (!is_validated) {
 			host_state_manager_set_run_time_validation (host->state, HOST_STATE_PREVALIDATED_NONE);
-			status = host->flash->validate_read_write_flash (host->flash, pfm, hash, rsa, &rw_list);
+
+			if (host->flash->validate_flash_parallel && !skip_ro && !single &&
+				(!is_pending || pfm_dirty)) {
+				/* The read-only flash will need to be validated if the read/write flash fails, so
+				 * validate both at the same time. */
+				status = host->flash->validate_flash_parallel (host->flash, pfm, active, hash, rsa,
+					is_bypass, &rw_list, &ro_list, &ro_status);
+				parallel_ro = true;
+			}
+			else {
+				status = host->flash->validate_read_write_flash (host->flash, pfm, hash, rsa,
+					&rw_list);
+			}
 		}
 		else {
 			status = host->flash->get_flash_read_write_regions (host->flash, pfm, true, &rw_list);
@@ -463,6 +478,10 @@ static int host_processor_filtered_validate_flash (struct host_processor_filtere
 		if (status != 0) {
 			failed_rw = true;
 		}
+		else if (parallel_ro && (ro_status == 0)) {
+			/* The read-only flash results are not needed when the read/write flash is good. */
+			host->flash->free_read_write_regions (host->flash, &ro_list);
+		}
 
 		if (is_pending) {
 			debug_log_create_entry ((status ==
@@ -542,8 +561,16 @@ static int host_processor_filtered_validate_flash (struct host_processor_filtere
 
 	if (!skip_ro && (status != 0) && (!is_pending || is_bypass || pfm_dirty) &&
 		(!single || !checked_rw)) {
-		status = host->flash->validate_read_only_flash (host->flash, pfm, active, hash, rsa,
-			is_bypass, &rw_list);
+		if (parallel_ro) {
+			status = ro_status;
+			if (status == 0) {
+				rw_list = ro_list;
+			}
+		}
+		else {
+			status = host->flash->validate_read_only_flash (host->flash, pfm, active, hash, rsa,
+				is_bypass, &rw_list);
+		}
 
 		if (is_pending) {
 			debug_log_create_entry ((status ==
@@ -0,0 +1,901 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "debug_log.h"
+#include "logging_flash_compressed.h"
+#include "logging_flash_compressed_static.h"
+
+
+/**
+ * Marker stored in the header of each sector that contains log data.
+ */
+#define	LOGGING_FLASH_COMPRESSED_MARKER			0x4c43
+
+/**
+ * Format of the data stored in each sector.
+ */
+#define	LOGGING_FLASH_COMPRESSED_FORMAT			1
+
+/**
+ * Value of the first byte of an encoded entry that indicates there are no more entries.
+ */
+#define	LOGGING_FLASH_COMPRESSED_BLANK			0xff
+
+/* Bit definitions for the first byte of an encoded entry. */
+#define	LOGGING_FLASH_COMPRESSED_TYPE_MASK		0x03
+#define	LOGGING_FLASH_COMPRESSED_TYPE_RAW		0x01
+#define	LOGGING_FLASH_COMPRESSED_TYPE_DEBUG		0x02
+#define	LOGGING_FLASH_COMPRESSED_SEVERITY_MASK	0x0c
+#define	LOGGING_FLASH_COMPRESSED_SEVERITY_SHIFT	2
+#define	LOGGING_FLASH_COMPRESSED_ARG1			0x10
+#define	LOGGING_FLASH_COMPRESSED_ARG2			0x20
+#define	LOGGING_FLASH_COMPRESSED_RESERVED		0xc0
+
+/**
+ * The maximum number of bytes in a varint encoded value.
+ */
+#define	LOGGING_FLASH_COMPRESSED_MAX_VARINT		10
+
+
+/**
+ * Destination for decoded entries when reading the log.
+ */
+struct logging_flash_compressed_output {
+	uint32_t offset;	/**< Offset in the decoded log data to start copying. */
+	uint8_t *contents;	/**< Buffer for the decoded log data. */
+	size_t length;		/**< Remaining space in the output buffer. */
+	int bytes_read;		/**< Total number of bytes copied to the output buffer. */
+};
+
+
+/**
+ * Encode an unsigned value using a variable number of bytes.  Each byte holds 7 bits of the value,
+ * least significant bits first, and the high bit is set when more bytes follow.
+ *
+ * @param value The value to encode.
+ * @param data Output for the encoded value.  This must have space for the maximum varint length.
+ *
+ * @return The number of bytes used to encode the value.
+ */
+static size_t logging_flash_compressed_encode_varint (uint64_t value, uint8_t *data)
+{
+	size_t length = 0;
+
+	while (value >= 0x80) {
+		data[length++] = (value & 0x7f) | 0x80;
+		value >>= 7;
+	}
+
+	data[length++] = value;
+
+	return length;
+}
+
+/**
+ * Decode an unsigned value that has been encoded using a variable number of bytes.
+ *
+ * @param data The encoded data.
+ * @param length Length of the encoded data.
+ * @param value Output for the decoded value.
+ *
+ * @return The number of bytes used by the encoded value or 0 if the data is not valid.
+ */
+static size_t logging_flash_compressed_decode_varint (const uint8_t *data, size_t length,
+	uint64_t *value)
+{
+	size_t i;
+
+	*value = 0;
+	for (i = 0; (i < length) && (i < LOGGING_FLASH_COMPRESSED_MAX_VARINT); i++) {
+		*value |= ((uint64_t) (data[i] & 0x7f)) << (7 * i);
+		if (!(data[i] & 0x80)) {
+			return i + 1;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Encode a single log entry.
+ *
+ * @param entry The entry data to encode.
+ * @param length Length of the entry data.
+ * @param context The current encoding context.
+ * @param record Output for the encoded entry.  This must be at least
+ * LOGGING_FLASH_COMPRESSED_MAX_RECORD_LEN bytes.
+ * @param time Output for the timestamp that should be used for encoding the next entry.
+ *
+ * @return Length of the encoded entry.
+ */
+static size_t logging_flash_compressed_encode (const uint8_t *entry, size_t length,
+	const struct logging_flash_compressed_context *context, uint8_t *record, uint64_t *time)
+{
+	const struct debug_log_entry_info *info = (const struct debug_log_entry_info*) entry;
+	uint64_t delta;
+	size_t pos;
+
+	if ((length == sizeof (struct debug_log_entry_info)) &&
+		(info->format == DEBUG_LOG_ENTRY_FORMAT) &&
+		(info->severity <= (LOGGING_FLASH_COMPRESSED_SEVERITY_MASK >>
+			LOGGING_FLASH_COMPRESSED_SEVERITY_SHIFT))) {
+		record[0] = LOGGING_FLASH_COMPRESSED_TYPE_DEBUG |
+			(info->severity << LOGGING_FLASH_COMPRESSED_SEVERITY_SHIFT);
+		record[1] = info->component;
+		record[2] = info->msg_index;
+		pos = 3;
+
+		/* Arguments are frequently 0, so they are only stored when they have some other value. */
+		if (info->arg1 != 0) {
+			record[0] |= LOGGING_FLASH_COMPRESSED_ARG1;
+			pos += logging_flash_compressed_encode_varint (info->arg1, &record[pos]);
+		}
+
+		if (info->arg2 != 0) {
+			record[0] |= LOGGING_FLASH_COMPRESSED_ARG2;
+			pos += logging_flash_compressed_encode_varint (info->arg2, &record[pos]);
+		}
+
+		/* Store the time as a signed difference from the previous entry, since the timestamp will
+		 * restart after a reset. */
+		delta = info->time - context->time;
+		pos += logging_flash_compressed_encode_varint ((delta << 1) ^ (0 - (delta >> 63)),
+			&record[pos]);
+
+		*time = info->time;
+	}
+	else {
+		record[0] = LOGGING_FLASH_COMPRESSED_TYPE_RAW;
+		pos = 1 + logging_flash_compressed_encode_varint (length, &record[1]);
+
+		memcpy (&record[pos], entry, length);
+		pos += length;
+
+		*time = context->time;
+	}
+
+	return pos;
+}
+
+/**
+ * Decode a single log entry to the standard format.  The decoded entry will be stored in the log
+ * state.
+ *
+ * @param logging The log to decode the entry for.
+ * @param record The encoded entry data.
+ * @param length The maximum length of the encoded entry.
+ * @param context The decoding context.  This will be updated for the next entry.
+ * @param entry_len Output for the length of the decoded entry, including the standard header.
+ *
+ * @return The length of the encoded entry or 0 if the data is not a valid entry.
+ */
+static size_t logging_flash_compressed_decode (const struct logging_flash_compressed *logging,
+	const uint8_t *record, size_t length, struct logging_flash_compressed_context *context,
+	size_t *entry_len)
+{
+	struct logging_entry_header *header = (struct logging_entry_header*) logging->state->entry;
+	uint8_t *data = &logging->state->entry[sizeof (struct logging_entry_header)];
+	struct debug_log_entry_info *info = (struct debug_log_entry_info*) data;
+	uint64_t value;
+	size_t value_len;
+	size_t pos;
+
+	if ((length < 2) || (record[0] & LOGGING_FLASH_COMPRESSED_RESERVED)) {
+		return 0;
+	}
+
+	switch (record[0] & LOGGING_FLASH_COMPRESSED_TYPE_MASK) {
+		case LOGGING_FLASH_COMPRESSED_TYPE_DEBUG:
+			if (length < 4) {
+				return 0;
+			}
+
+			info->format = DEBUG_LOG_ENTRY_FORMAT;
+			info->severity = (record[0] & LOGGING_FLASH_COMPRESSED_SEVERITY_MASK) >>
+				LOGGING_FLASH_COMPRESSED_SEVERITY_SHIFT;
+			info->component = record[1];
+			info->msg_index = record[2];
+			pos = 3;
+
+			info->arg1 = 0;
+			if (record[0] & LOGGING_FLASH_COMPRESSED_ARG1) {
+				value_len = logging_flash_compressed_decode_varint (&record[pos], length - pos,
+					&value);
+				if ((value_len == 0) || (value > UINT32_MAX)) {
+					return 0;
+				}
+
+				info->arg1 = value;
+				pos += value_len;
+			}
+
+			info->arg2 = 0;
+			if (record[0] & LOGGING_FLASH_COMPRESSED_ARG2) {
+				value_len = logging_flash_compressed_decode_varint (&record[pos], length - pos,
+					&value);
+				if ((value_len == 0) || (value > UINT32_MAX)) {
+					return 0;
+				}
+
+				info->arg2 = value;
+				pos += value_len;
+			}
+
+			value_len = logging_flash_compressed_decode_varint (&record[pos], length - pos, &value);
+			if (value_len == 0) {
+				return 0;
+			}
+
+			info->time = context->time + ((value >> 1) ^ (0 - (value & 1)));
+			context->time = info->time;
+			pos += value_len;
+
+			*entry_len = sizeof (struct debug_log_entry_info);
+			break;
+
+		case LOGGING_FLASH_COMPRESSED_TYPE_RAW:
+			value_len = logging_flash_compressed_decode_varint (&record[1], length - 1, &value);
+			if ((value_len == 0) || (value == 0) ||
+				(value > LOGGING_FLASH_COMPRESSED_MAX_ENTRY_LEN) ||
+				(value > (length - 1 - value_len))) {
+				return 0;
+			}
+
+			pos = 1 + value_len;
+			memcpy (data, &record[pos], value);
+			pos += value;
+
+			*entry_len = value;
+			break;
+
+		default:
+			return 0;
+	}
+
+	header->log_magic = LOGGING_MAGIC_START;
+	header->length = sizeof (struct logging_entry_header) + *entry_len;
+	header->entry_id = context->entry_id++;
+
+	*entry_len = header->length;
+
+	return pos;
+}
+
+/**
+ * Decode a sequence of encoded entries.  Decoding stops at the end of the data, at blank flash, or
+ * when the output buffer is full.
+ *
+ * @param logging The log that contains the entries.
+ * @param addr Flash address of the encoded entries.  This is ignored if the data is provided.
+ * @param data The encoded entries.  Set this to null to read the entries from flash.
+ * @param length Length of the encoded entries.
+ * @param context The decoding context for the first entry.  This will be updated as entries are
+ * decoded.
+ * @param output Optional output for the decoded entries.
+ * @param sector Optional sector information that will be updated with the decoded entries.
+ *
+ * @return 0 if the entries were decoded successfully, 1 if data that is not a valid entry was
+ * found, or an error code.
+ */
+static int logging_flash_compressed_process_entries (const struct logging_flash_compressed *logging,
+	uint32_t addr, const uint8_t *data, size_t length,
+	struct logging_flash_compressed_context *context,
+	struct logging_flash_compressed_output *output, struct logging_flash_compressed_sector *sector)
+{
+	const uint8_t *window = (data != NULL) ? data : logging->state->read_buffer;
+	size_t window_start = 0;
+	size_t window_len = (data != NULL) ? length : 0;
+	size_t pos = 0;
+	size_t record_len;
+	size_t entry_len;
+	size_t copy_len;
+	int status;
+
+	while ((pos < length) && ((output == NULL) || (output->length != 0))) {
+		if ((data == NULL) &&
+			((pos + LOGGING_FLASH_COMPRESSED_MAX_RECORD_LEN) > (window_start + window_len)) &&
+			((window_start + window_len) < length)) {
+			/* Not enough data has been read to guarantee a complete entry. */
+			window_start = pos;
+			window_len = length - pos;
+			if (window_len > sizeof (logging->state->read_buffer)) {
+				window_len = sizeof (logging->state->read_buffer);
+			}
+
+			status = logging->flash->read (logging->flash, addr + pos,
+				logging->state->read_buffer, window_len);
+			if (status != 0) {
+				return status;
+			}
+		}
+
+		if (window[pos - window_start] == LOGGING_FLASH_COMPRESSED_BLANK) {
+			return 0;
+		}
+
+		record_len = logging_flash_compressed_decode (logging, &window[pos - window_start],
+			window_start + window_len - pos, context, &entry_len);
+		if (record_len == 0) {
+			return 1;
+		}
+
+		pos += record_len;
+
+		if (sector) {
+			sector->used += record_len;
+			sector->log_length += entry_len;
+			sector->entries++;
+		}
+
+		if (output) {
+			if (output->offset >= entry_len) {
+				output->offset -= entry_len;
+			}
+			else {
+				copy_len = entry_len - output->offset;
+				if (copy_len > output->length) {
+					copy_len = output->length;
+				}
+
+				memcpy (output->contents, &logging->state->entry[output->offset], copy_len);
+				output->contents += copy_len;
+				output->length -= copy_len;
+				output->bytes_read += copy_len;
+				output->offset = 0;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Get the flash address of a sector in the log.
+ *
+ * @param logging The log to query.
+ * @param index Index of the sector.
+ *
+ * @return The sector address.
+ */
+static uint32_t logging_flash_compressed_get_sector_addr (
+	const struct logging_flash_compressed *logging, uint32_t index)
+{
+	return logging->base_addr + (index * logging->state->sector_size);
+}
+
+/**
+ * Erase the next sector in the log and prepare it to receive new entries.  Any entries in that
+ * sector will be lost.
+ *
+ * @param logging The log to update.
+ * @param context The context for the first entry that will be written to the sector.
+ *
+ * @return 0 if the sector was prepared successfully or an error code.
+ */
+static int logging_flash_compressed_open_sector (const struct logging_flash_compressed *logging,
+	const struct logging_flash_compressed_context *context)
+{
+	struct logging_flash_compressed_header header;
+	uint32_t next = (logging->state->current + 1) % logging->sector_count;
+	struct logging_flash_compressed_sector *sector = &logging->sectors[next];
+	uint32_t addr = logging_flash_compressed_get_sector_addr (logging, next);
+	int status;
+
+	status = logging->flash->sector_erase (logging->flash, addr);
+	if (status != 0) {
+		return status;
+	}
+
+	sector->sequence = 0;
+	sector->erase_count++;
+	sector->used = 0;
+	sector->log_length = 0;
+	sector->entries = 0;
+
+	header.marker = LOGGING_FLASH_COMPRESSED_MARKER;
+	header.format = LOGGING_FLASH_COMPRESSED_FORMAT;
+	header.reserved = 0xff;
+	header.sequence = logging->state->sequence + 1;
+	header.erase_count = sector->erase_count;
+	header.first_entry_id = context->entry_id;
+	header.base_time = context->time;
+
+	status = logging->flash->write (logging->flash, addr, (uint8_t*) &header, sizeof (header));
+	if (status != (int) sizeof (header)) {
+		return (ROT_IS_ERROR (status)) ? status : LOGGING_INCOMPLETE_FLUSH;
+	}
+
+	sector->sequence = header.sequence;
+	sector->used = sizeof (header);
+
+	logging->state->sequence = header.sequence;
+	logging->state->current = next;
+	logging->state->active = true;
+
+	return 0;
+}
+
+/**
+ * Write the buffered entries to flash.  If there is no active sector, the next sector will be
+ * erased before writing the entries.
+ *
+ * @param logging The log to update.
+ *
+ * @return 0 if the buffered entries were written to flash or an error code.
+ */
+static int logging_flash_compressed_save_buffer (const struct logging_flash_compressed *logging)
+{
+	struct logging_flash_compressed_state *state = logging->state;
+	struct logging_flash_compressed_sector *sector;
+	int status;
+
+	if (state->buffered == 0) {
+		return 0;
+	}
+
+	if (!state->active) {
+		status = logging_flash_compressed_open_sector (logging, &state->buffer_context);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	sector = &logging->sectors[state->current];
+
+	status = logging->flash->write (logging->flash,
+		logging_flash_compressed_get_sector_addr (logging, state->current) + sector->used,
+		state->buffer, state->buffered);
+	if (status != (int) state->buffered) {
+		/* Some of the data could have been written, so nothing else can be added to this sector.
+		 * Keep the buffered entries so they will be written to a new sector on the next attempt. */
+		state->active = false;
+
+		return (ROT_IS_ERROR (status)) ? status : LOGGING_INCOMPLETE_FLUSH;
+	}
+
+	sector->used += state->buffered;
+	sector->log_length += state->buffer_log_length;
+	sector->entries += state->buffer_entries;
+
+	state->buffered = 0;
+	state->buffer_log_length = 0;
+	state->buffer_entries = 0;
+	state->buffer_context = state->context;
+
+	return 0;
+}
+
+/**
+ * Get the amount of space available for a new encoded entry.
+ *
+ * @param logging The log to query.
+ *
+ * @return The number of bytes that can be added to the buffer.
+ */
+static size_t logging_flash_compressed_get_space (const struct logging_flash_compressed *logging)
+{
+	struct logging_flash_compressed_state *state = logging->state;
+	size_t space = sizeof (state->buffer) - state->buffered;
+	size_t sector_space;
+
+	if (state->active) {
+		sector_space = state->sector_size - logging->sectors[state->current].used;
+	}
+	else {
+		sector_space = state->sector_size - sizeof (struct logging_flash_compressed_header);
+	}
+
+	sector_space -= state->buffered;
+
+	return (sector_space < space) ? sector_space : space;
+}
+
+int logging_flash_compressed_create_entry (const struct logging *logging, uint8_t *entry,
+	size_t length)
+{
+	const struct logging_flash_compressed *flash_log =
+		(const struct logging_flash_compressed*) logging;
+	struct logging_flash_compressed_state *state;
+	uint8_t record[LOGGING_FLASH_COMPRESSED_MAX_RECORD_LEN];
+	size_t record_len;
+	uint64_t time;
+	int status = 0;
+
+	if ((flash_log == NULL) || (entry == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	if ((length == 0) || (length > LOGGING_FLASH_COMPRESSED_MAX_ENTRY_LEN)) {
+		return LOGGING_BAD_ENTRY_LENGTH;
+	}
+
+	state = flash_log->state;
+
+	platform_mutex_lock (&state->lock);
+
+	record_len = logging_flash_compressed_encode (entry, length, &state->context, record, &time);
+
+	if (record_len > logging_flash_compressed_get_space (flash_log)) {
+		status = logging_flash_compressed_save_buffer (flash_log);
+		if (status != 0) {
+			goto exit;
+		}
+
+		if (record_len > logging_flash_compressed_get_space (flash_log)) {
+			/* The current sector is full.  The next sector will be used for new entries. */
+			state->active = false;
+		}
+	}
+
+	memcpy (&state->buffer[state->buffered], record, record_len);
+	state->buffered += record_len;
+	state->buffer_log_length += sizeof (struct logging_entry_header) + length;
+	state->buffer_entries++;
+
+	state->context.entry_id++;
+	state->context.time = time;
+
+exit:
+	platform_mutex_unlock (&state->lock);
+
+	return status;
+}
+
+#ifndef LOGGING_DISABLE_FLUSH
+int logging_flash_compressed_flush (const struct logging *logging)
+{
+	const struct logging_flash_compressed *flash_log =
+		(const struct logging_flash_compressed*) logging;
+	int status;
+
+	if (flash_log == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash_log->state->lock);
+	status = logging_flash_compressed_save_buffer (flash_log);
+	platform_mutex_unlock (&flash_log->state->lock);
+
+	return status;
+}
+#endif
+
+int logging_flash_compressed_clear (const struct logging *logging)
+{
+	const struct logging_flash_compressed *flash_log =
+		(const struct logging_flash_compressed*) logging;
+	struct logging_flash_compressed_sector *sector;
+	size_t i;
+	int status = 0;
+
+	if (flash_log == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash_log->state->lock);
+
+	for (i = 0; i < flash_log->sector_count; i++) {
+		sector = &flash_log->sectors[i];
+		if (sector->sequence != 0) {
+			status = flash_log->flash->sector_erase (flash_log->flash,
+				logging_flash_compressed_get_sector_addr (flash_log, i));
+			if (status != 0) {
+				goto exit;
+			}
+
+			sector->sequence = 0;
+			sector->erase_count++;
+			sector->used = 0;
+			sector->log_length = 0;
+			sector->entries = 0;
+		}
+	}
+
+	/* Keep the current sector position so new entries continue to rotate through the sectors. */
+	flash_log->state->active = false;
+	flash_log->state->buffered = 0;
+	flash_log->state->buffer_log_length = 0;
+	flash_log->state->buffer_entries = 0;
+	flash_log->state->buffer_context = flash_log->state->context;
+
+exit:
+	platform_mutex_unlock (&flash_log->state->lock);
+
+	return status;
+}
+
+int logging_flash_compressed_get_size (const struct logging *logging)
+{
+	const struct logging_flash_compressed *flash_log =
+		(const struct logging_flash_compressed*) logging;
+	size_t i;
+	int log_size;
+
+	if (flash_log == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&flash_log->state->lock);
+
+	log_size = flash_log->state->buffer_log_length;
+	for (i = 0; i < flash_log->sector_count; i++) {
+		log_size += flash_log->sectors[i].log_length;
+	}
+
+	platform_mutex_unlock (&flash_log->state->lock);
+
+	return log_size;
+}
+
+int logging_flash_compressed_read_contents (const struct logging *logging, uint32_t offset,
+	uint8_t *contents, size_t length)
+{
+	const struct logging_flash_compressed *flash_log =
+		(const struct logging_flash_compressed*) logging;
+	struct logging_flash_compressed_state *state;
+	struct logging_flash_compressed_header header;
+	struct logging_flash_compressed_context context;
+	struct logging_flash_compressed_output output;
+	struct logging_flash_compressed_sector *sector;
+	uint32_t addr;
+	size_t index;
+	size_t i;
+	int status;
+
+	if ((flash_log == NULL) || (contents == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	state = flash_log->state;
+
+	output.offset = offset;
+	output.contents = contents;
+	output.length = length;
+	output.bytes_read = 0;
+
+	platform_mutex_lock (&state->lock);
+
+	/* The sector after the current one contains the oldest entries. */
+	for (i = 1; (i <= flash_log->sector_count) && (output.length != 0); i++) {
+		index = (state->current + i) % flash_log->sector_count;
+		sector = &flash_log->sectors[index];
+
+		if (sector->sequence == 0) {
+			continue;
+		}
+
+		if (output.offset >= sector->log_length) {
+			output.offset -= sector->log_length;
+			continue;
+		}
+
+		addr = logging_flash_compressed_get_sector_addr (flash_log, index);
+		status = flash_log->flash->read (flash_log->flash, addr, (uint8_t*) &header,
+			sizeof (header));
+		if (status != 0) {
+			goto exit;
+		}
+
+		context.entry_id = header.first_entry_id;
+		context.time = header.base_time;
+
+		status = logging_flash_compressed_process_entries (flash_log, addr + sizeof (header), NULL,
+			sector->used - sizeof (header), &context, &output, NULL);
+		if (ROT_IS_ERROR (status)) {
+			goto exit;
+		}
+	}
+
+	/* After reading all data from flash, read buffered entries that haven't been written yet. */
+	if ((output.length != 0) && (output.offset < state->buffer_log_length)) {
+		context = state->buffer_context;
+		logging_flash_compressed_process_entries (flash_log, 0, state->buffer, state->buffered,
+			&context, &output, NULL);
+	}
+
+	status = output.bytes_read;
+
+exit:
+	platform_mutex_unlock (&state->lock);
+
+	return status;
+}
+
+/**
+ * Initialize a log that stores compressed entries on flash.  Log entries already on flash will be
+ * detected and maintained.
+ *
+ * @param logging The log to initialize.
+ * @param state Variable context for the log.  This must be uninitialized.
+ * @param flash The flash device where log entries are stored.
+ * @param base_addr The starting address for log entries.  This must be aligned to the beginning of
+ * a flash sector.
+ * @param sectors Information for each sector used by the log.  This must be uninitialized.
+ * @param sector_count The number of flash sectors to use for the log.  At least two sectors are
+ * required.
+ *
+ * @return 0 if the log was successfully initialized or an error code.
+ */
+int logging_flash_compressed_init (struct logging_flash_compressed *logging,
+	struct logging_flash_compressed_state *state, const struct flash *flash, uint32_t base_addr,
+	struct logging_flash_compressed_sector *sectors, size_t sector_count)
+{
+	if (logging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	memset (logging, 0, sizeof (struct logging_flash_compressed));
+
+	logging->base.create_entry = logging_flash_compressed_create_entry;
+#ifndef LOGGING_DISABLE_FLUSH
+	logging->base.flush = logging_flash_compressed_flush;
+#endif
+	logging->base.clear = logging_flash_compressed_clear;
+	logging->base.get_size = logging_flash_compressed_get_size;
+	logging->base.read_contents = logging_flash_compressed_read_contents;
+
+	logging->state = state;
+	logging->flash = flash;
+	logging->base_addr = base_addr;
+	logging->sectors = sectors;
+	logging->sector_count = sector_count;
+
+	return logging_flash_compressed_init_state (logging);
+}
+
+/**
+ * Initialize only the variable state for a compressed flash log.  The rest of the log instance is
+ * assumed to have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param logging The log instance that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int logging_flash_compressed_init_state (const struct logging_flash_compressed *logging)
+{
+	struct logging_flash_compressed_state *state;
+	struct logging_flash_compressed_header header;
+	struct logging_flash_compressed_context context;
+	struct logging_flash_compressed_sector *sector;
+	uint32_t addr;
+	size_t i;
+	int status;
+
+	if ((logging == NULL) || (logging->state == NULL) || (logging->flash == NULL) ||
+		(logging->sectors == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	if (logging->sector_count < 2) {
+		return LOGGING_INSUFFICIENT_STORAGE;
+	}
+
+	state = logging->state;
+	memset (state, 0, sizeof (struct logging_flash_compressed_state));
+	memset (logging->sectors, 0, sizeof (struct logging_flash_compressed_sector) *
+		logging->sector_count);
+
+	status = logging->flash->get_sector_size (logging->flash, &state->sector_size);
+	if (status != 0) {
+		return status;
+	}
+
+	if ((state->sector_size == 0) || ((logging->base_addr % state->sector_size) != 0)) {
+		return LOGGING_STORAGE_NOT_ALIGNED;
+	}
+
+	if (state->sector_size < (sizeof (header) + LOGGING_FLASH_COMPRESSED_MAX_RECORD_LEN)) {
+		return LOGGING_INSUFFICIENT_STORAGE;
+	}
+
+	/* With no existing entries, the first sector will be the first one used. */
+	state->current = logging->sector_count - 1;
+
+	for (i = 0; i < logging->sector_count; i++) {
+		sector = &logging->sectors[i];
+		addr = logging_flash_compressed_get_sector_addr (logging, i);
+
+		status = logging->flash->read (logging->flash, addr, (uint8_t*) &header, sizeof (header));
+		if (status != 0) {
+			return status;
+		}
+
+		if ((header.marker != LOGGING_FLASH_COMPRESSED_MARKER) ||
+			(header.format != LOGGING_FLASH_COMPRESSED_FORMAT) || (header.sequence == 0)) {
+			continue;
+		}
+
+		sector->sequence = header.sequence;
+		sector->erase_count = header.erase_count;
+		sector->used = sizeof (header);
+
+		context.entry_id = header.first_entry_id;
+		context.time = header.base_time;
+
+		status = logging_flash_compressed_process_entries (logging, addr + sizeof (header), NULL,
+			state->sector_size - sizeof (header), &context, NULL, sector);
+		if (ROT_IS_ERROR (status)) {
+			return status;
+		}
+
+		if (header.sequence > state->sequence) {
+			state->sequence = header.sequence;
+			state->current = i;
+			state->context = context;
+
+			/* Don't add new entries after data that could not be decoded. */
+			state->active = (status == 0);
+		}
+	}
+
+	state->buffer_context = state->context;
+
+	return platform_mutex_init (&state->lock);
+}
+
+/**
+ * Release the resources used by a compressed flash log.  The contents on flash will remain.  Any
+ * entries not already on flash will be lost.
+ *
+ * @param logging The log to release.
+ */
+void logging_flash_compressed_release (const struct logging_flash_compressed *logging)
+{
+	if (logging) {
+		platform_mutex_free (&logging->state->lock);
+	}
+}
+
+/**
+ * Get statistics about the storage used by the log.
+ *
+ * @param logging The log to query.
+ * @param stats Output for the log statistics.
+ *
+ * @return 0 if the statistics were retrieved successfully or an error code.
+ */
+int logging_flash_compressed_get_stats (const struct logging_flash_compressed *logging,
+	struct logging_flash_compressed_stats *stats)
+{
+	struct logging_flash_compressed_sector *sector;
+	size_t i;
+
+	if ((logging == NULL) || (stats == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&logging->state->lock);
+
+	stats->entries = logging->state->buffer_entries;
+	stats->log_length = logging->state->buffer_log_length;
+	stats->stored_length = logging->state->buffered;
+	stats->min_erase_count = UINT32_MAX;
+	stats->max_erase_count = 0;
+	stats->total_erase_count = 0;
+
+	for (i = 0; i < logging->sector_count; i++) {
+		sector = &logging->sectors[i];
+
+		stats->entries += sector->entries;
+		stats->log_length += sector->log_length;
+		stats->stored_length += sector->used;
+		stats->total_erase_count += sector->erase_count;
+
+		if (sector->erase_count < stats->min_erase_count) {
+			stats->min_erase_count = sector->erase_count;
+		}
+		if (sector->erase_count > stats->max_erase_count) {
+			stats->max_erase_count = sector->erase_count;
+		}
+	}
+
+	platform_mutex_unlock (&logging->state->lock);
+
+	return 0;
+}
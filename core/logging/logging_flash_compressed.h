@@ -0,0 +1,155 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef LOGGING_FLASH_COMPRESSED_H_
+#define LOGGING_FLASH_COMPRESSED_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "logging.h"
+#include "platform_api.h"
+#include "flash/flash.h"
+
+
+/* A log that stores entries on flash in a compact encoding.  The log spans any number of flash
+ * sectors, which are used as a circular buffer so erase cycles are spread evenly across the entire
+ * log area.  Each sector starts with a header that records the number of times it has been erased
+ * along with the context needed to decode the entries in the sector.  Erase counts are only known
+ * for sectors that contain log data, so they will restart if the log is cleared and reloaded.
+ *
+ * Entries are not stored with the standard logging header.  The entry ID is implied by the position
+ * of the entry in the sector, and the length is only stored for entries that are not debug log
+ * entries.  Debug log entries are packed using varint encoding for the arguments and the
+ * timestamp, which is stored as the difference from the previous entry.  Entries are converted back
+ * to the standard format when the log contents are read. */
+
+
+/**
+ * The maximum length of a single log entry.  This does not include the standard logging header.
+ */
+#ifndef LOGGING_FLASH_COMPRESSED_MAX_ENTRY_LEN
+#define	LOGGING_FLASH_COMPRESSED_MAX_ENTRY_LEN		128
+#endif
+
+/**
+ * The amount of encoded entry data that will be buffered before it is written to flash.  The same
+ * amount of memory is used when reading entries from flash.
+ */
+#ifndef LOGGING_FLASH_COMPRESSED_BUFFER_LEN
+#define	LOGGING_FLASH_COMPRESSED_BUFFER_LEN			256
+#endif
+
+/**
+ * The maximum length of a single encoded entry.
+ */
+#define	LOGGING_FLASH_COMPRESSED_MAX_RECORD_LEN		(LOGGING_FLASH_COMPRESSED_MAX_ENTRY_LEN + 4)
+
+#if (LOGGING_FLASH_COMPRESSED_BUFFER_LEN < LOGGING_FLASH_COMPRESSED_MAX_RECORD_LEN)
+#error "The flash log buffer is too small for the maximum entry length."
+#endif
+
+
+#pragma pack(push, 1)
+
+/**
+ * Header stored at the start of each flash sector used by the log.
+ */
+struct logging_flash_compressed_header {
+	uint16_t marker;			/**< Marker to identify a sector that contains log data. */
+	uint8_t format;				/**< Format of the data in the sector. */
+	uint8_t reserved;			/**< Unused. */
+	uint32_t sequence;			/**< Sequence number indicating the order sectors were written. */
+	uint32_t erase_count;		/**< The number of times the sector has been erased. */
+	uint32_t first_entry_id;	/**< ID of the first entry in the sector. */
+	uint64_t base_time;			/**< Timestamp used to decode the first entry in the sector. */
+};
+
+#pragma pack(pop)
+
+/**
+ * Information about a single sector in the log.
+ */
+struct logging_flash_compressed_sector {
+	uint32_t sequence;		/**< Sequence number for the sector.  This is 0 if there is no log data. */
+	uint32_t erase_count;	/**< The number of times the sector has been erased, if known. */
+	uint32_t used;			/**< The number of bytes used on flash, including the header. */
+	uint32_t log_length;	/**< The length of the entries in the sector in the standard format. */
+	uint32_t entries;		/**< The number of entries in the sector. */
+};
+
+/**
+ * Context needed to encode or decode an entry.
+ */
+struct logging_flash_compressed_context {
+	uint32_t entry_id;	/**< ID of the next entry. */
+	uint64_t time;		/**< Timestamp of the previous debug log entry. */
+};
+
+/**
+ * Storage statistics for the log.
+ */
+struct logging_flash_compressed_stats {
+	uint32_t entries;			/**< The number of entries currently in the log. */
+	uint32_t log_length;		/**< The length of the entries in the standard format. */
+	uint32_t stored_length;		/**< The amount of flash and buffer space used for the entries. */
+	uint32_t min_erase_count;	/**< The lowest erase count of any sector in the log. */
+	uint32_t max_erase_count;	/**< The highest erase count of any sector in the log. */
+	uint32_t total_erase_count;	/**< The total number of erase cycles across all sectors. */
+};
+
+/**
+ * Variable context for a compressed flash log.
+ */
+struct logging_flash_compressed_state {
+	platform_mutex lock;								/**< Synchronization for log accesses. */
+	uint32_t sector_size;								/**< Size of each sector used by the log. */
+	uint32_t current;									/**< Index of the sector being written. */
+	uint32_t sequence;									/**< Sequence number of the newest sector. */
+	bool active;										/**< The current sector can accept more data. */
+	struct logging_flash_compressed_context context;	/**< Context for the next entry. */
+	struct logging_flash_compressed_context buffer_context;	/**< Context for buffered entries. */
+	size_t buffered;									/**< The number of bytes in the buffer. */
+	uint32_t buffer_log_length;							/**< Standard length of the buffered entries. */
+	uint32_t buffer_entries;							/**< The number of buffered entries. */
+
+	/**
+	 * Encoded entries waiting to be written to flash.
+	 */
+	uint8_t buffer[LOGGING_FLASH_COMPRESSED_BUFFER_LEN];
+
+	/**
+	 * Buffer for reading encoded entries from flash.
+	 */
+	uint8_t read_buffer[LOGGING_FLASH_COMPRESSED_BUFFER_LEN];
+
+	/**
+	 * A single entry that has been decoded to the standard format.
+	 */
+	uint8_t entry[sizeof (struct logging_entry_header) + LOGGING_FLASH_COMPRESSED_MAX_ENTRY_LEN];
+};
+
+/**
+ * A log that will persistently store compressed entries on flash across multiple sectors.
+ */
+struct logging_flash_compressed {
+	struct logging base;								/**< The base logging instance. */
+	struct logging_flash_compressed_state *state;		/**< Variable context for the log instance. */
+	const struct flash *flash;							/**< The flash where log entries are stored. */
+	uint32_t base_addr;									/**< The base address of the log data on flash. */
+	struct logging_flash_compressed_sector *sectors;	/**< Information for each sector in the log. */
+	size_t sector_count;								/**< The number of sectors used by the log. */
+};
+
+
+int logging_flash_compressed_init (struct logging_flash_compressed *logging,
+	struct logging_flash_compressed_state *state, const struct flash *flash, uint32_t base_addr,
+	struct logging_flash_compressed_sector *sectors, size_t sector_count);
+int logging_flash_compressed_init_state (const struct logging_flash_compressed *logging);
+void logging_flash_compressed_release (const struct logging_flash_compressed *logging);
+
+int logging_flash_compressed_get_stats (const struct logging_flash_compressed *logging,
+	struct logging_flash_compressed_stats *stats);
+
+
+#endif	/* LOGGING_FLASH_COMPRESSED_H_ */
@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef LOGGING_FLASH_COMPRESSED_STATIC_H_
+#define LOGGING_FLASH_COMPRESSED_STATIC_H_
+
+#include "logging/logging_flash_compressed.h"
+
+
+/* Internal functions declared to allow for static initialization. */
+int logging_flash_compressed_create_entry (const struct logging *logging, uint8_t *entry,
+	size_t length);
+int logging_flash_compressed_flush (const struct logging *logging);
+int logging_flash_compressed_clear (const struct logging *logging);
+int logging_flash_compressed_get_size (const struct logging *logging);
+int logging_flash_compressed_read_contents (const struct logging *logging, uint32_t offset,
+	uint8_t *contents, size_t length);
+
+
+/**
+ * Constant initializer for the flush operation.
+ */
+#ifndef LOGGING_DISABLE_FLUSH
+#define	LOGGING_FLASH_COMPRESSED_FLUSH_API	.flush = logging_flash_compressed_flush,
+#else
+#define	LOGGING_FLASH_COMPRESSED_FLUSH_API
+#endif
+
+/**
+ * Constant initializer for the logging API.
+ */
+#define	LOGGING_FLASH_COMPRESSED_API_INIT  { \
+		.create_entry = logging_flash_compressed_create_entry, \
+		LOGGING_FLASH_COMPRESSED_FLUSH_API \
+		.clear = logging_flash_compressed_clear, \
+		.get_size = logging_flash_compressed_get_size, \
+		.read_contents = logging_flash_compressed_read_contents \
+	}
+
+
+/**
+ * Initialize a static instance of a log that stores compressed entries on flash.  This can be a
+ * constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the log.
+ * @param flash_ptr The flash device where log entries are stored.
+ * @param flash_base_addr The starting address for log entries.  This must be aligned to the
+ * beginning of a flash sector.
+ * @param sectors_ptr Information for each sector used by the log.
+ * @param sector_cnt The number of flash sectors to use for the log.  At least two sectors are
+ * required.
+ */
+#define	logging_flash_compressed_static_init(state_ptr, flash_ptr, flash_base_addr, sectors_ptr, \
+	sector_cnt)	{ \
+		.base = LOGGING_FLASH_COMPRESSED_API_INIT, \
+		.state = state_ptr, \
+		.flash = flash_ptr, \
+		.base_addr = flash_base_addr, \
+		.sectors = sectors_ptr, \
+		.sector_count = sector_cnt \
+	}
+
+
+#endif	/* LOGGING_FLASH_COMPRESSED_STATIC_H_ */
@@ -0,0 +1,316 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "logging_ring.h"
+#include "logging_ring_static.h"
+
+
+/**
+ * Get the ring slot for a position in the ring.
+ *
+ * @param logging The log to query.
+ * @param pos The ring position.
+ *
+ * @return The slot for the position.
+ */
+static struct logging_ring_slot* logging_ring_get_slot (const struct logging_ring *logging,
+	uint32_t pos)
+{
+	return (struct logging_ring_slot*) &logging->ring[(pos & (logging->entry_count - 1)) *
+		LOGGING_RING_SLOT_SIZE (logging->entry_size)];
+}
+
+/**
+ * Reserve the next slot in the ring and add an entry to it.  Reserving a slot does not block and
+ * can be done by multiple tasks concurrently.  If the reserved slot still contains an entry from
+ * the previous pass through the ring, buffered entries will be moved to the target log until the
+ * slot is available.
+ *
+ * @param logging The log to update.
+ * @param entry The entry data to add.
+ * @param length Length of the entry data.
+ */
+static void logging_ring_add_entry (const struct logging_ring *logging, const uint8_t *entry,
+	size_t length)
+{
+	struct logging_ring_slot *slot;
+	uint32_t pos;
+
+	pos = platform_atomic_fetch_add (&logging->state->enqueue_pos, 1);
+	slot = logging_ring_get_slot (logging, pos);
+
+	while (platform_atomic_load (&slot->sequence) != pos) {
+		/* Entries are not being consumed fast enough.  Move them to the target log directly to make
+		 * space for the new entry. */
+		logging_ring_drain (logging);
+
+		if (platform_atomic_load (&slot->sequence) != pos) {
+			/* The ring could not be drained far enough, because another task has not finished
+			 * writing an earlier entry.  Give that task a chance to run. */
+			platform_msleep (1);
+		}
+	}
+
+	slot->length = length;
+	memcpy (&slot[1], entry, length);
+
+	/* Commit the entry to make it available to the consumer. */
+	platform_atomic_store (&slot->sequence, pos + 1);
+}
+
+/**
+ * Remove committed entries from the ring.  The drain lock must be held by the caller.
+ *
+ * @param logging The log to update.
+ * @param save Flag to indicate if the entries should be added to the target log or discarded.
+ *
+ * @return 0 if all entries were added to the target log or the first error reported by the target.
+ * Entries that fail to be added are discarded.
+ */
+static int logging_ring_remove_entries (const struct logging_ring *logging, bool save)
+{
+	struct logging_ring_slot *slot;
+	uint32_t pos = logging->state->dequeue_pos;
+	int status = 0;
+	int entry_status;
+
+	while (1) {
+		slot = logging_ring_get_slot (logging, pos);
+		if (platform_atomic_load (&slot->sequence) != (pos + 1)) {
+			/* The next entry is either empty or still being written.  Stop here to preserve the
+			 * order of entries. */
+			break;
+		}
+
+		if (save) {
+			entry_status = logging->target->create_entry (logging->target, (uint8_t*) &slot[1],
+				slot->length);
+			if ((entry_status != 0) && (status == 0)) {
+				status = entry_status;
+			}
+		}
+
+		/* Release the slot for the next pass through the ring. */
+		platform_atomic_store (&slot->sequence, pos + logging->entry_count);
+		pos++;
+	}
+
+	logging->state->dequeue_pos = pos;
+
+	return status;
+}
+
+int logging_ring_create_entry (const struct logging *logging, uint8_t *entry, size_t length)
+{
+	const struct logging_ring *ring_log = (const struct logging_ring*) logging;
+
+	if ((ring_log == NULL) || (entry == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	if ((length == 0) || (length > ring_log->entry_size)) {
+		return LOGGING_BAD_ENTRY_LENGTH;
+	}
+
+	logging_ring_add_entry (ring_log, entry, length);
+
+	return 0;
+}
+
+#ifndef LOGGING_DISABLE_FLUSH
+int logging_ring_flush (const struct logging *logging)
+{
+	const struct logging_ring *ring_log = (const struct logging_ring*) logging;
+	int status;
+
+	if (ring_log == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	status = logging_ring_drain (ring_log);
+	if (status != 0) {
+		return status;
+	}
+
+	return ring_log->target->flush (ring_log->target);
+}
+#endif
+
+int logging_ring_clear (const struct logging *logging)
+{
+	const struct logging_ring *ring_log = (const struct logging_ring*) logging;
+	int status;
+
+	if (ring_log == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&ring_log->state->drain_lock);
+
+	logging_ring_remove_entries (ring_log, false);
+	status = ring_log->target->clear (ring_log->target);
+
+	platform_mutex_unlock (&ring_log->state->drain_lock);
+
+	return status;
+}
+
+int logging_ring_get_size (const struct logging *logging)
+{
+	const struct logging_ring *ring_log = (const struct logging_ring*) logging;
+
+	if (ring_log == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	logging_ring_drain (ring_log);
+
+	return ring_log->target->get_size (ring_log->target);
+}
+
+int logging_ring_read_contents (const struct logging *logging, uint32_t offset, uint8_t *contents,
+	size_t length)
+{
+	const struct logging_ring *ring_log = (const struct logging_ring*) logging;
+
+	if ((ring_log == NULL) || (contents == NULL)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	logging_ring_drain (ring_log);
+
+	return ring_log->target->read_contents (ring_log->target, offset, contents, length);
+}
+
+/**
+ * Initialize a log that buffers entries in a lock-free ring.
+ *
+ * @param logging The log to initialize.
+ * @param state Variable context for the log.  This must be uninitialized.
+ * @param target The log that will store the buffered entries.
+ * @param ring Memory to use for buffering entries.  This must be 32-bit aligned.
+ * @param ring_size Length of the ring memory.  The number of entries that can be buffered will be
+ * the largest power of 2 that fits in this memory.  Use LOGGING_RING_BUFFER_LEN to determine the
+ * memory needed for a specific number of entries.
+ * @param entry_length The maximum length of a single log entry.  This does not include the length
+ * of standard logging overhead.
+ *
+ * @return 0 if the log was successfully initialized or an error code.
+ */
+int logging_ring_init (struct logging_ring *logging, struct logging_ring_state *state,
+	const struct logging *target, uint8_t *ring, size_t ring_size, size_t entry_length)
+{
+	size_t max_entries;
+
+	if ((logging == NULL) || (entry_length == 0)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	memset (logging, 0, sizeof (struct logging_ring));
+
+	logging->base.create_entry = logging_ring_create_entry;
+#ifndef LOGGING_DISABLE_FLUSH
+	logging->base.flush = logging_ring_flush;
+#endif
+	logging->base.clear = logging_ring_clear;
+	logging->base.get_size = logging_ring_get_size;
+	logging->base.read_contents = logging_ring_read_contents;
+
+	logging->state = state;
+	logging->target = target;
+	logging->ring = ring;
+	logging->entry_size = entry_length;
+
+	max_entries = ring_size / LOGGING_RING_SLOT_SIZE (entry_length);
+	if (max_entries != 0) {
+		logging->entry_count = 1;
+		while ((logging->entry_count * 2) <= max_entries) {
+			logging->entry_count *= 2;
+		}
+	}
+
+	return logging_ring_init_state (logging);
+}
+
+/**
+ * Initialize only the variable state for a ring buffered log.  The rest of the log instance is
+ * assumed to have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param logging The log instance that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int logging_ring_init_state (const struct logging_ring *logging)
+{
+	struct logging_ring_slot *slot;
+	size_t i;
+
+	if ((logging == NULL) || (logging->state == NULL) || (logging->target == NULL) ||
+		(logging->ring == NULL) || (logging->entry_size == 0)) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	if (((uintptr_t) logging->ring & 0x3) != 0) {
+		return LOGGING_STORAGE_NOT_ALIGNED;
+	}
+
+	if ((logging->entry_count == 0) || ((logging->entry_count & (logging->entry_count - 1)) != 0)) {
+		return LOGGING_INSUFFICIENT_STORAGE;
+	}
+
+	memset (logging->state, 0, sizeof (struct logging_ring_state));
+
+	for (i = 0; i < logging->entry_count; i++) {
+		slot = logging_ring_get_slot (logging, i);
+		slot->sequence = i;
+		slot->length = 0;
+	}
+
+	return platform_mutex_init (&logging->state->drain_lock);
+}
+
+/**
+ * Release the resources used by a ring buffered log.  Any buffered entries that have not been
+ * moved to the target log will be lost.
+ *
+ * @param logging The log to release.
+ */
+void logging_ring_release (const struct logging_ring *logging)
+{
+	if (logging) {
+		platform_mutex_free (&logging->state->drain_lock);
+	}
+}
+
+/**
+ * Move all buffered entries to the target log.  Only entries that have been completely written to
+ * the ring will be moved.  If there is an entry still being written, it and all entries after it
+ * will remain buffered.
+ *
+ * This does not flush the target log.
+ *
+ * @param logging The log to drain.
+ *
+ * @return 0 if all entries were added to the target log or an error code.  Entries that could not
+ * be added to the target log are discarded.
+ */
+int logging_ring_drain (const struct logging_ring *logging)
+{
+	int status;
+
+	if (logging == NULL) {
+		return LOGGING_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&logging->state->drain_lock);
+	status = logging_ring_remove_entries (logging, true);
+	platform_mutex_unlock (&logging->state->drain_lock);
+
+	return status;
+}
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef LOGGING_RING_H_
+#define LOGGING_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "logging.h"
+#include "platform_api.h"
+
+
+/* A log that buffers new entries in a lock-free ring and moves them to a target log in the
+ * background.  Any number of tasks can create entries concurrently without taking a lock.  Entries
+ * are moved to the target log in the order their slots were reserved when the ring is flushed,
+ * which would normally be done by a log_flush_handler.  Since the target log assigns entry IDs,
+ * entry ordering is preserved.
+ *
+ * Entries are never discarded because the ring is full.  A task that finds its slot still occupied
+ * will move buffered entries to the target log itself, waiting for the target as necessary.  The
+ * target log must not create entries in the ring log, either directly or through debug_log, since
+ * that would deadlock if the ring is full. */
+
+
+/**
+ * Header stored before each entry in the ring.
+ */
+struct logging_ring_slot {
+	uint32_t sequence;	/**< Sequence number tracking if the slot is free or holds an entry. */
+	uint32_t length;	/**< Length of the entry data in the slot. */
+};
+
+/**
+ * Get the amount of ring memory used for a single entry.
+ *
+ * @param entry_len The maximum length of a log entry.
+ */
+#define	LOGGING_RING_SLOT_SIZE(entry_len)	\
+	(sizeof (struct logging_ring_slot) + (((entry_len) + 3) & ~3))
+
+/**
+ * Get the amount of memory necessary for a ring buffer.
+ *
+ * @param entry_count The number of entries the ring can hold.  This must be a power of 2.
+ * @param entry_len The maximum length of a log entry.
+ */
+#define	LOGGING_RING_BUFFER_LEN(entry_count, entry_len)	\
+	(LOGGING_RING_SLOT_SIZE (entry_len) * (entry_count))
+
+
+/**
+ * Variable context for a ring buffered log.
+ */
+struct logging_ring_state {
+	uint32_t enqueue_pos;		/**< Position of the next slot to reserve for a new entry. */
+	uint32_t dequeue_pos;		/**< Position of the next entry to move to the target log. */
+	platform_mutex drain_lock;	/**< Synchronization for moving entries to the target log. */
+};
+
+/**
+ * A log that buffers entries in a lock-free ring before adding them to another log.
+ */
+struct logging_ring {
+	struct logging base;				/**< The base logging instance. */
+	struct logging_ring_state *state;	/**< Variable context for the log instance. */
+	const struct logging *target;		/**< The log that will store the entries. */
+	uint8_t *ring;						/**< Memory for the ring of buffered entries. */
+	size_t entry_count;					/**< The number of entries that can be buffered. */
+	size_t entry_size;					/**< The maximum length of a single entry. */
+};
+
+
+int logging_ring_init (struct logging_ring *logging, struct logging_ring_state *state,
+	const struct logging *target, uint8_t *ring, size_t ring_size, size_t entry_length);
+int logging_ring_init_state (const struct logging_ring *logging);
+void logging_ring_release (const struct logging_ring *logging);
+
+int logging_ring_drain (const struct logging_ring *logging);
+
+
+#endif	/* LOGGING_RING_H_ */
@@ -0,0 +1,64 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef LOGGING_RING_STATIC_H_
+#define LOGGING_RING_STATIC_H_
+
+#include "logging/logging_ring.h"
+
+
+/* Internal functions declared to allow for static initialization. */
+int logging_ring_create_entry (const struct logging *logging, uint8_t *entry, size_t length);
+int logging_ring_flush (const struct logging *logging);
+int logging_ring_clear (const struct logging *logging);
+int logging_ring_get_size (const struct logging *logging);
+int logging_ring_read_contents (const struct logging *logging, uint32_t offset, uint8_t *contents,
+	size_t length);
+
+
+/**
+ * Constant initializer for the flush operation.
+ */
+#ifndef LOGGING_DISABLE_FLUSH
+#define	LOGGING_RING_FLUSH_API	.flush = logging_ring_flush,
+#else
+#define	LOGGING_RING_FLUSH_API
+#endif
+
+/**
+ * Constant initializer for the logging API.
+ */
+#define	LOGGING_RING_API_INIT  { \
+		.create_entry = logging_ring_create_entry, \
+		LOGGING_RING_FLUSH_API \
+		.clear = logging_ring_clear, \
+		.get_size = logging_ring_get_size, \
+		.read_contents = logging_ring_read_contents \
+	}
+
+
+/**
+ * Initialize a static instance of a log that buffers entries in a lock-free ring.  This can be a
+ * constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the log.
+ * @param target_ptr The log that will store the buffered entries.
+ * @param ring_ptr Memory for the ring of buffered entries.  This must be 32-bit aligned and at
+ * least LOGGING_RING_BUFFER_LEN (entry_cnt, entry_len) bytes.
+ * @param entry_cnt The number of entries that can be buffered.  This must be a power of 2.
+ * @param entry_len The maximum length of a single entry.  This does not include the length of
+ * standard logging overhead.
+ */
+#define	logging_ring_static_init(state_ptr, target_ptr, ring_ptr, entry_cnt, entry_len)	{ \
+		.base = LOGGING_RING_API_INIT, \
+		.state = state_ptr, \
+		.target = target_ptr, \
+		.ring = ring_ptr, \
+		.entry_count = entry_cnt, \
+		.entry_size = entry_len \
+	}
+
+
+#endif	/* LOGGING_RING_STATIC_H_ */
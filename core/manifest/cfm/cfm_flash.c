@@ -822,12 +822,46 @@ static void cfm_flash_free_measurement_container_internal (struct cfm *cfm,
 	}
 }
 
+/**
+ * Allocate a measurement iteration context.  Contexts are taken from the CFM context pool, if one
+ * is available.  Otherwise, the context will be allocated from the heap.
+ *
+ * @param cfm The CFM that will use the context.
+ *
+ * @return The zeroized measurement context or null if no memory is available.
+ */
+static struct cfm_flash_measurement_context* cfm_flash_allocate_measurement_context (
+	struct cfm_flash *cfm)
+{
+	struct cfm_flash_measurement_context *context;
+
+	context = object_pool_allocate_zeroize (&cfm->context_pool);
+	if (context == NULL) {
+		context = platform_calloc (1, sizeof (struct cfm_flash_measurement_context));
+	}
+
+	return context;
+}
+
+/**
+ * Free a measurement iteration context.
+ *
+ * @param cfm The CFM that allocated the context.
+ * @param context The context to free.
+ */
+static void cfm_flash_free_measurement_context (struct cfm_flash *cfm, void *context)
+{
+	if (object_pool_free (&cfm->context_pool, context) != 0) {
+		platform_free (context);
+	}
+}
+
 static void cfm_flash_free_measurement_container (struct cfm *cfm,
 	struct cfm_measurement_container *container)
 {
 	if ((cfm != NULL) && (container != NULL)) {
 		cfm_flash_free_measurement_container_internal (cfm, container);
-		platform_free (container->context);
+		cfm_flash_free_measurement_context ((struct cfm_flash*) cfm, container->context);
 		container->context = NULL;
 	}
 }
@@ -1095,16 +1129,6 @@ static int cfm_flash_determine_version_set_element (struct cfm *cfm, uint32_t co
 	return CFM_MEASUREMENT_DATA;
 }
 
-/**
- * Implementation context for the get_next_measurement_or_measurement_data function.
- */
-struct cfm_flash_measurement_context {
-	enum hash_type comp_device_hash_type;	/**< Hash type of component device. */
-	uint8_t element_entry;					/**< Entry for next element to read back. */
-	int version_set_element;				/**< Element type for version set selection. */
-};
-
-
 /**
  * This function assumes all Measurement and Measurement Data entries are contiguous.
  */
@@ -1122,14 +1146,18 @@ static int cfm_flash_get_next_measurement_or_measurement_data (struct cfm *cfm,
 	if (first) {
 		memset (container, 0, sizeof (struct cfm_measurement_container));
 
-		container->context = platform_calloc (sizeof (struct cfm_flash_measurement_context), 1);
-		context = (struct cfm_flash_measurement_context*) container->context;
+		context = cfm_flash_allocate_measurement_context ((struct cfm_flash*) cfm);
+		if (context == NULL) {
+			return CFM_NO_MEMORY;
+		}
+
+		container->context = context;
 
 		context->version_set_element = cfm_flash_determine_version_set_element (cfm, component_id,
 			&comp_device_entry, &context->comp_device_hash_type);
 		if (ROT_IS_ERROR (context->version_set_element)) {
 			status = context->version_set_element;
-			platform_free (container->context);
+			cfm_flash_free_measurement_context ((struct cfm_flash*) cfm, container->context);
 			container->context = NULL;
 
 			return status;
@@ -1454,6 +1482,13 @@ int cfm_flash_init (struct cfm_flash *cfm, const struct flash *flash, struct has
 		return status;
 	}
 
+	status = object_pool_init (&cfm->context_pool, cfm->context_storage,
+		sizeof (cfm->context_storage), sizeof (struct cfm_flash_measurement_context));
+	if (status != 0) {
+		manifest_flash_release (&cfm->base_flash);
+		return status;
+	}
+
 	cfm->base.base.verify = cfm_flash_verify;
 	cfm->base.base.get_id = cfm_flash_get_id;
 	cfm->base.base.get_platform_id = cfm_flash_get_platform_id;
@@ -1490,5 +1525,6 @@ void cfm_flash_release (struct cfm_flash *cfm)
 {
 	if (cfm != NULL) {
 		manifest_flash_release (&cfm->base_flash);
+		object_pool_release (&cfm->context_pool);
 	}
 }
@@ -7,15 +7,42 @@
 #include <stdint.h>
 #include "cfm.h"
 #include "flash/flash.h"
+#include "crypto/hash.h"
 #include "manifest/manifest_flash.h"
+#include "memory_mgmt/object_pool.h"
 
 
+/**
+ * The number of measurement iteration contexts that can be in use at the same time without
+ * requiring dynamic memory allocation.  Additional contexts will be allocated from the heap.
+ */
+#ifndef CFM_FLASH_MEASUREMENT_CONTEXT_COUNT
+#define	CFM_FLASH_MEASUREMENT_CONTEXT_COUNT		2
+#endif
+
+
+/**
+ * Implementation context for the get_next_measurement_or_measurement_data function.
+ */
+struct cfm_flash_measurement_context {
+	enum hash_type comp_device_hash_type;	/**< Hash type of component device. */
+	uint8_t element_entry;					/**< Entry for next element to read back. */
+	int version_set_element;				/**< Element type for version set selection. */
+};
+
 /**
  * Defines a CFM that is stored in flash memory.
  */
 struct cfm_flash {
 	struct cfm base;					/**< The base CFM instance. */
 	struct manifest_flash base_flash;	/**< The base CFM flash instance. */
+	struct object_pool context_pool;	/**< Pool of measurement iteration contexts. */
+
+	/**
+	 * Storage for the measurement context pool.
+	 */
+	void *context_storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct cfm_flash_measurement_context),
+		CFM_FLASH_MEASUREMENT_CONTEXT_COUNT) / sizeof (void*)];
 };
 
 
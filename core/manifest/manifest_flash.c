@@ -115,6 +115,124 @@ void manifest_flash_release (struct manifest_flash *manifest)
 	}
 }
 
+/**
+ * Provide storage for a RAM copy of the manifest table of contents.  When a version 2 manifest is
+ * verified and its table of contents fits within the provided buffers, the entries and element
+ * hashes will be kept in RAM.  Subsequent element lookups will use the cached data instead of
+ * reading and hashing the table of contents from flash for every request.
+ *
+ * If the table of contents for a manifest does not fit in the cache, element access falls back to
+ * reading and validating the table of contents from flash.
+ *
+ * The cache will not be used until the next time the manifest is verified.
+ *
+ * @param manifest The manifest to configure.
+ * @param entry_cache Buffer to hold the table of contents entries.
+ * @param max_entries The maximum number of entries that can be stored in the entry buffer.
+ * @param hash_cache Buffer to hold the table of contents element hashes.  This can be null if
+ * there will be no cached element hashes.
+ * @param hash_cache_length Length of the element hash buffer.
+ *
+ * @return 0 if the cache was configured successfully or an error code.
+ */
+int manifest_flash_enable_toc_cache (struct manifest_flash *manifest,
+	struct manifest_toc_entry *entry_cache, size_t max_entries, uint8_t *hash_cache,
+	size_t hash_cache_length)
+{
+	if ((manifest == NULL) || (entry_cache == NULL) || (max_entries == 0) ||
+		((hash_cache == NULL) && (hash_cache_length != 0))) {
+		return MANIFEST_INVALID_ARGUMENT;
+	}
+
+	manifest->toc_cache = entry_cache;
+	manifest->max_toc_entries = max_entries;
+	manifest->toc_hash_cache = hash_cache;
+	manifest->max_toc_hash_cache = hash_cache_length;
+	manifest->toc_cache_valid = false;
+
+	return 0;
+}
+
+/**
+ * Discard any cached table of contents data for the manifest.  This must be called whenever the
+ * flash contents for the manifest may have been changed.  The cache will be populated again the
+ * next time the manifest is verified.
+ *
+ * @param manifest The manifest to update.
+ */
+void manifest_flash_invalidate_toc_cache (struct manifest_flash *manifest)
+{
+	if (manifest) {
+		manifest->toc_cache_valid = false;
+	}
+}
+
+/**
+ * Determine if the table of contents for the current manifest can be stored in the cache.
+ *
+ * @param manifest The manifest to check.  The table of contents header must have been read.
+ *
+ * @return true if the table of contents will fit in the cache.
+ */
+static bool manifest_flash_is_toc_cacheable (const struct manifest_flash *manifest)
+{
+	return (manifest->toc_cache != NULL) &&
+		(manifest->toc_header.entry_count <= manifest->max_toc_entries) &&
+		((manifest->toc_header.hash_count * manifest->toc_hash_length) <=
+			manifest->max_toc_hash_cache);
+}
+
+/**
+ * Check the cached table of contents against the manifest table of contents hash.  The cache will
+ * only be used if the cached data matches.
+ *
+ * @param manifest The manifest with the cached table of contents.
+ * @param hash The hash engine to use for validation.
+ */
+static void manifest_flash_validate_toc_cache (struct manifest_flash *manifest,
+	struct hash_engine *hash)
+{
+	uint8_t validate_hash[SHA512_HASH_LENGTH];
+	int status;
+
+	status = hash_start_new_hash (hash, manifest->toc_hash_type);
+	if (status != 0) {
+		return;
+	}
+
+	status = hash->update (hash, (uint8_t*) &manifest->toc_header, sizeof (manifest->toc_header));
+	if (status != 0) {
+		goto error;
+	}
+
+	status = hash->update (hash, (uint8_t*) manifest->toc_cache,
+		sizeof (struct manifest_toc_entry) * manifest->toc_header.entry_count);
+	if (status != 0) {
+		goto error;
+	}
+
+	if (manifest->toc_header.hash_count != 0) {
+		status = hash->update (hash, manifest->toc_hash_cache,
+			manifest->toc_hash_length * manifest->toc_header.hash_count);
+		if (status != 0) {
+			goto error;
+		}
+	}
+
+	status = hash->finish (hash, validate_hash, sizeof (validate_hash));
+	if (status != 0) {
+		goto error;
+	}
+
+	manifest->toc_cache_valid =
+		(buffer_compare (validate_hash, manifest->toc_hash, manifest->toc_hash_length) == 0);
+
+	return;
+
+error:
+	hash->cancel (hash);
+}
+
 /**
  * Read the manifest header and run validity checking on the contents:
  * - Check the magic number.
@@ -249,37 +367,81 @@ static int manifest_flash_verify_v2 (struct manifest_flash *manifest, struct has
 		goto error;
 	}
 
-	/* Find the platform ID element, hashing each entry as it is read in. */
 	next_addr += sizeof (manifest->toc_header);
-	i = 0;
-	do {
-		status = manifest->flash->read (manifest->flash, next_addr, (uint8_t*) &entry,
-			sizeof (entry));
+	toc_end = next_addr + (manifest->toc_header.entry_count * sizeof (entry)) +
+		(manifest->toc_header.hash_count * manifest->toc_hash_length);
+
+	if (manifest_flash_is_toc_cacheable (manifest)) {
+		/* Read and hash the entire table of contents into the cache. */
+		status = manifest->flash->read (manifest->flash, next_addr, (uint8_t*) manifest->toc_cache,
+			manifest->toc_header.entry_count * sizeof (entry));
 		if (status != 0) {
 			goto error;
 		}
 
-		status = hash->update (hash, (uint8_t*) &entry, sizeof (entry));
+		status = hash->update (hash, (uint8_t*) manifest->toc_cache,
+			manifest->toc_header.entry_count * sizeof (entry));
 		if (status != 0) {
 			goto error;
 		}
 
-		next_addr += sizeof (entry);
-		i++;
-	} while ((entry.type_id != MANIFEST_PLATFORM_ID) && (i < manifest->toc_header.entry_count));
+		next_addr += manifest->toc_header.entry_count * sizeof (entry);
+		if (manifest->toc_header.hash_count != 0) {
+			status = manifest->flash->read (manifest->flash, next_addr, manifest->toc_hash_cache,
+				toc_end - next_addr);
+			if (status != 0) {
+				goto error;
+			}
 
-	if (entry.type_id != MANIFEST_PLATFORM_ID) {
-		status = MANIFEST_NO_PLATFORM_ID;
-		goto error;
+			status = hash->update (hash, manifest->toc_hash_cache, toc_end - next_addr);
+			if (status != 0) {
+				goto error;
+			}
+		}
+
+		/* Find the platform ID element. */
+		for (i = 0; i < manifest->toc_header.entry_count; i++) {
+			if (manifest->toc_cache[i].type_id == MANIFEST_PLATFORM_ID) {
+				break;
+			}
+		}
+
+		if (i == manifest->toc_header.entry_count) {
+			status = MANIFEST_NO_PLATFORM_ID;
+			goto error;
+		}
+
+		entry = manifest->toc_cache[i];
 	}
+	else {
+		/* Find the platform ID element, hashing each entry as it is read in. */
+		i = 0;
+		do {
+			status = manifest->flash->read (manifest->flash, next_addr, (uint8_t*) &entry,
+				sizeof (entry));
+			if (status != 0) {
+				goto error;
+			}
 
-	/* Hash the flash contents for the rest of the table of contents. */
-	toc_end = manifest->addr + sizeof (manifest->header) + sizeof (manifest->toc_header) +
-		(manifest->toc_header.entry_count * sizeof (entry)) +
-		(manifest->toc_header.hash_count * manifest->toc_hash_length);
-	status = flash_hash_update_contents (manifest->flash, next_addr, toc_end - next_addr, hash);
-	if (status != 0) {
-		goto error;
+			status = hash->update (hash, (uint8_t*) &entry, sizeof (entry));
+			if (status != 0) {
+				goto error;
+			}
+
+			next_addr += sizeof (entry);
+			i++;
+		} while ((entry.type_id != MANIFEST_PLATFORM_ID) && (i < manifest->toc_header.entry_count));
+
+		if (entry.type_id != MANIFEST_PLATFORM_ID) {
+			status = MANIFEST_NO_PLATFORM_ID;
+			goto error;
+		}
+
+		/* Hash the flash contents for the rest of the table of contents. */
+		status = flash_hash_update_contents (manifest->flash, next_addr, toc_end - next_addr, hash);
+		if (status != 0) {
+			goto error;
+		}
 	}
 
 	/* Read and hash the table of contents hash. */
@@ -353,8 +515,13 @@ static int manifest_flash_verify_v2 (struct manifest_flash *manifest, struct has
 		memcpy (hash_out, manifest->hash_cache, manifest->hash_length);
 	}
 
-	return verification->verify_signature (verification, manifest->hash_cache,
+	status = verification->verify_signature (verification, manifest->hash_cache,
 		manifest->hash_length, manifest->signature, manifest->header.sig_length);
+	if ((status == 0) && manifest_flash_is_toc_cacheable (manifest)) {
+		manifest_flash_validate_toc_cache (manifest, hash);
+	}
+
+	return status;
 
 error:
 	hash->cancel (hash);
@@ -391,6 +558,7 @@ int manifest_flash_verify (struct manifest_flash *manifest, struct hash_engine *
 
 	manifest->manifest_valid = false;
 	manifest->cache_valid = false;
+	manifest->toc_cache_valid = false;
 	if (hash_out != NULL) {
 		/* Clear the output hash buffer to indicate no hash was calculated. */
 		memset (hash_out, 0, hash_length);
@@ -639,38 +807,25 @@ int manifest_flash_get_signature (struct manifest_flash *manifest, uint8_t *sign
 }
 
 /**
- * Find the first element of a specified type in the manifest and read the element data.
- * Everything about the operation will be validated, as appropriate.  This includes table of
- * contents and entry data hashing.
+ * Find the first element of a specified type in the table of contents stored in flash.  The table
+ * of contents will be validated against the manifest table of contents hash.
  *
- * @param manifest The manifest to read.
- * @param hash The hash engine to use for element validation.
+ * @param manifest The manifest to search.
+ * @param hash The hash engine to use for table of contents validation.
  * @param type Identifier for the type of element to find.
  * @param start Index of the table of contents entry to start searching for the element.
- * @param parent_type Identifier for the type of the parent element.  If the element has no parent,
- * MANIFEST_NO_PARENT must be provided.
- * @param read_offset Offset into the element data to start reading.  The entire element is still
- * validated, but the buffer will only contain element data starting at the offset.
- * @param found Optional output indicating which TOC entry was used for the element.
- * @param format Optional output for the format version of the element data.
- * @param total_len Optional output for the total length of the element data.
- * @param element Optional pointer to the output buffer for the element data.  If the output buffer
- * is null, a buffer will by dynamically allocated to fit the entire element.  This buffer must be
- * freed by the caller.  If the pointer is null, no element data will be read.
- * @param length Length of the element output buffer, if the buffer is not null.  If the actual
- * element data is longer than the specified length, only the specified length will be read back and
- * no error is generated.  This parameter is ignored when the output buffer is dynamically
- * allocated.
+ * @param parent_type Identifier for the type of the parent element.
+ * @param entry Output for the table of contents entry for the element.
+ * @param entry_hash Output for the element hash.  This will only be valid if the entry indicates
+ * there is a hash for the element.
  *
- * @return The amount of element data read or an error code.  Use ROT_IS_ERROR to check the return
- * value.
+ * @return The index of the table of contents entry for the element or an error code.  Use
+ * ROT_IS_ERROR to check the return value.
  */
-int manifest_flash_read_element_data (struct manifest_flash *manifest, struct hash_engine *hash,
-	uint8_t type, int start, uint8_t parent_type, uint32_t read_offset, uint8_t *found,
-	uint8_t *format, size_t *total_len, uint8_t **element, size_t length)
+static int manifest_flash_find_toc_entry (struct manifest_flash *manifest,
+	struct hash_engine *hash, uint8_t type, int start, uint8_t parent_type,
+	struct manifest_toc_entry *entry, uint8_t *entry_hash)
 {
-	struct manifest_toc_entry entry;
-	uint8_t entry_hash[SHA512_HASH_LENGTH];
 	uint8_t validate_hash[SHA512_HASH_LENGTH];
 	uint32_t entry_addr;
 	uint32_t hash_addr;
@@ -678,22 +833,9 @@ int manifest_flash_read_element_data (struct manifest_flash *manifest, struct ha
 	int i;
 	int status;
 
-	if ((manifest == NULL) || (hash == NULL)) {
-		return MANIFEST_INVALID_ARGUMENT;
-	}
-
-	if (!manifest->manifest_valid) {
-		return MANIFEST_NO_MANIFEST;
-	}
-
-	if (start >= manifest->toc_header.entry_count) {
-		return (parent_type == MANIFEST_NO_PARENT) ?
-				   MANIFEST_ELEMENT_NOT_FOUND : MANIFEST_CHILD_NOT_FOUND;
-	}
-
 	entry_addr =
 		manifest->addr + sizeof (struct manifest_header) + sizeof (struct manifest_toc_header);
-	hash_addr = entry_addr + (sizeof (entry) * manifest->toc_header.entry_count);
+	hash_addr = entry_addr + (sizeof (*entry) * manifest->toc_header.entry_count);
 	toc_end = hash_addr + (manifest->toc_hash_length * manifest->toc_header.hash_count);
 
 	/* Start hashing to verify the TOC contents. */
@@ -708,46 +850,46 @@ int manifest_flash_read_element_data (struct manifest_flash *manifest, struct ha
 	}
 
 	/* Hash the TOC data before the first entry that will be read. */
-	status = flash_hash_update_contents (manifest->flash, entry_addr, sizeof (entry) * start, hash);
+	status = flash_hash_update_contents (manifest->flash, entry_addr, sizeof (*entry) * start, hash);
 	if (status != 0) {
 		goto error;
 	}
 
 	/* Find the TOC entry for the requested element. */
-	entry_addr += sizeof (entry) * start;
+	entry_addr += sizeof (*entry) * start;
 	i = start;
 	do {
-		status = manifest->flash->read (manifest->flash, entry_addr, (uint8_t*) &entry,
-			sizeof (entry));
+		status = manifest->flash->read (manifest->flash, entry_addr, (uint8_t*) entry,
+			sizeof (*entry));
 		if (status != 0) {
 			goto error;
 		}
 
 		/* As soon as we see an element that is not a child, we fail because we have left the
 		 * context of the expected parent. */
-		if ((parent_type != MANIFEST_NO_PARENT) && (entry.parent == MANIFEST_NO_PARENT)) {
+		if ((parent_type != MANIFEST_NO_PARENT) && (entry->parent == MANIFEST_NO_PARENT)) {
 			status = MANIFEST_CHILD_NOT_FOUND;
 			goto error;
 		}
 
-		status = hash->update (hash, (uint8_t*) &entry, sizeof (entry));
+		status = hash->update (hash, (uint8_t*) entry, sizeof (*entry));
 		if (status != 0) {
 			goto error;
 		}
 
 		i++;
-		entry_addr += sizeof (entry);
-	} while ((entry.type_id != type) && (i < manifest->toc_header.entry_count));
+		entry_addr += sizeof (*entry);
+	} while ((entry->type_id != type) && (i < manifest->toc_header.entry_count));
 
-	if (entry.type_id != type) {
+	if (entry->type_id != type) {
 		status = (parent_type == MANIFEST_NO_PARENT) ?
 				MANIFEST_ELEMENT_NOT_FOUND : MANIFEST_CHILD_NOT_FOUND;
 		goto error;
 	}
 
-	if (entry.hash_id < manifest->toc_header.hash_count) {
+	if (entry->hash_id < manifest->toc_header.hash_count) {
 		/* Find the address of the entry hash. */
-		hash_addr += (manifest->toc_hash_length * entry.hash_id);
+		hash_addr += (manifest->toc_hash_length * entry->hash_id);
 
 		/* Hash the unneeded TOC data until the entry hash. */
 		status = flash_hash_update_contents (manifest->flash, entry_addr, hash_addr - entry_addr,
@@ -793,13 +935,132 @@ int manifest_flash_read_element_data (struct manifest_flash *manifest, struct ha
 		return MANIFEST_TOC_INVALID;
 	}
 
+	return i - 1;
+
+error:
+	hash->cancel (hash);
+
+	return status;
+}
+
+/**
+ * Find the first element of a specified type in the cached table of contents.  The cached data has
+ * already been validated, so no flash access or hashing is required.
+ *
+ * @param manifest The manifest to search.
+ * @param type Identifier for the type of element to find.
+ * @param start Index of the table of contents entry to start searching for the element.
+ * @param parent_type Identifier for the type of the parent element.
+ * @param entry Output for the table of contents entry for the element.
+ * @param entry_hash Output for the element hash.  This will only be valid if the entry indicates
+ * there is a hash for the element.
+ *
+ * @return The index of the table of contents entry for the element or an error code.  Use
+ * ROT_IS_ERROR to check the return value.
+ */
+static int manifest_flash_find_cached_toc_entry (const struct manifest_flash *manifest,
+	uint8_t type, int start, uint8_t parent_type, struct manifest_toc_entry *entry,
+	uint8_t *entry_hash)
+{
+	int i;
+
+	for (i = start; i < manifest->toc_header.entry_count; i++) {
+		/* As soon as we see an element that is not a child, we fail because we have left the
+		 * context of the expected parent. */
+		if ((parent_type != MANIFEST_NO_PARENT) &&
+			(manifest->toc_cache[i].parent == MANIFEST_NO_PARENT)) {
+			return MANIFEST_CHILD_NOT_FOUND;
+		}
+
+		if (manifest->toc_cache[i].type_id == type) {
+			break;
+		}
+	}
+
+	if (i == manifest->toc_header.entry_count) {
+		return (parent_type == MANIFEST_NO_PARENT) ?
+				MANIFEST_ELEMENT_NOT_FOUND : MANIFEST_CHILD_NOT_FOUND;
+	}
+
+	*entry = manifest->toc_cache[i];
+	if (entry->hash_id < manifest->toc_header.hash_count) {
+		memcpy (entry_hash, &manifest->toc_hash_cache[manifest->toc_hash_length * entry->hash_id],
+			manifest->toc_hash_length);
+	}
+
+	return i;
+}
+
+/**
+ * Find the first element of a specified type in the manifest and read the element data.
+ * Everything about the operation will be validated, as appropriate.  This includes table of
+ * contents and entry data hashing.
+ *
+ * @param manifest The manifest to read.
+ * @param hash The hash engine to use for element validation.
+ * @param type Identifier for the type of element to find.
+ * @param start Index of the table of contents entry to start searching for the element.
+ * @param parent_type Identifier for the type of the parent element.  If the element has no parent,
+ * MANIFEST_NO_PARENT must be provided.
+ * @param read_offset Offset into the element data to start reading.  The entire element is still
+ * validated, but the buffer will only contain element data starting at the offset.
+ * @param found Optional output indicating which TOC entry was used for the element.
+ * @param format Optional output for the format version of the element data.
+ * @param total_len Optional output for the total length of the element data.
+ * @param element Optional pointer to the output buffer for the element data.  If the output buffer
+ * is null, a buffer will by dynamically allocated to fit the entire element.  This buffer must be
+ * freed by the caller.  If the pointer is null, no element data will be read.
+ * @param length Length of the element output buffer, if the buffer is not null.  If the actual
+ * element data is longer than the specified length, only the specified length will be read back and
+ * no error is generated.  This parameter is ignored when the output buffer is dynamically
+ * allocated.
+ *
+ * @return The amount of element data read or an error code.  Use ROT_IS_ERROR to check the return
+ * value.
+ */
+int manifest_flash_read_element_data (struct manifest_flash *manifest, struct hash_engine *hash,
+	uint8_t type, int start, uint8_t parent_type, uint32_t read_offset, uint8_t *found,
+	uint8_t *format, size_t *total_len, uint8_t **element, size_t length)
+{
+	struct manifest_toc_entry entry;
+	uint8_t entry_hash[SHA512_HASH_LENGTH];
+	uint8_t validate_hash[SHA512_HASH_LENGTH];
+	int i;
+	int status;
+
+	if ((manifest == NULL) || (hash == NULL)) {
+		return MANIFEST_INVALID_ARGUMENT;
+	}
+
+	if (!manifest->manifest_valid) {
+		return MANIFEST_NO_MANIFEST;
+	}
+
+	if (start >= manifest->toc_header.entry_count) {
+		return (parent_type == MANIFEST_NO_PARENT) ?
+				   MANIFEST_ELEMENT_NOT_FOUND : MANIFEST_CHILD_NOT_FOUND;
+	}
+
+	if (manifest->toc_cache_valid) {
+		i = manifest_flash_find_cached_toc_entry (manifest, type, start, parent_type, &entry,
+			entry_hash);
+	}
+	else {
+		i = manifest_flash_find_toc_entry (manifest, hash, type, start, parent_type, &entry,
+			entry_hash);
+	}
+
+	if (ROT_IS_ERROR (i)) {
+		return i;
+	}
+
 	/* Read the element data. */
 	if ((entry.parent != MANIFEST_NO_PARENT) && (entry.parent != parent_type)) {
 		return MANIFEST_WRONG_PARENT;
 	}
 
 	if (found) {
-		*found = i - 1;
+		*found = i;
 	}
 	if (format) {
 		*format = entry.format;
@@ -881,6 +1142,64 @@ error:
 	return status;
 }
 
+/**
+ * Get requested information of child elements using the cached table of contents.  The cached data
+ * has already been validated, so no flash access or hashing is required.
+ *
+ * @param manifest The manifest to read.
+ * @param entry Starting table of contents entry to start processing.
+ * @param type Type of requested parent element.
+ * @param parent_type Type of parent to requested parent element.
+ * @param child_type Type of child element to get count of.
+ * @param child_len Optional output buffer with total length of child elements.
+ * @param child_count Optional output buffer with number of child elements found.
+ * @param first_entry Optional output buffer with entry of first child.
+ *
+ * @return 0 if request completed successfully or an error code.
+ */
+static int manifest_flash_get_cached_child_elements_info (const struct manifest_flash *manifest,
+	int entry, uint8_t type, uint8_t parent_type, uint8_t child_type, size_t *child_len,
+	int *child_count, int *first_entry)
+{
+	const struct manifest_toc_entry *toc_entry;
+	bool only_entry = ((child_len == NULL) && (child_count == NULL));
+
+	for (; entry < manifest->toc_header.entry_count; ++entry) {
+		toc_entry = &manifest->toc_cache[entry];
+
+		if ((toc_entry->parent == parent_type) || (toc_entry->type_id == parent_type)) {
+			if (only_entry) {
+				return MANIFEST_CHILD_NOT_FOUND;
+			}
+
+			break;
+		}
+		if ((toc_entry->parent == type) && (toc_entry->type_id == child_type)) {
+			if ((first_entry != NULL) && (*first_entry == 0)) {
+				*first_entry = entry;
+
+				if (only_entry) {
+					break;
+				}
+			}
+
+			if (child_count != NULL) {
+				*child_count = *child_count + 1;
+			}
+
+			if (child_len != NULL) {
+				*child_len = *child_len + toc_entry->length;
+			}
+		}
+	}
+
+	if (only_entry && (*first_entry == 0)) {
+		return MANIFEST_CHILD_NOT_FOUND;
+	}
+
+	return 0;
+}
+
 /**
  * Get requested information of child elements or requested entry.
  *
@@ -940,6 +1259,11 @@ int manifest_flash_get_child_elements_info (struct manifest_flash *manifest,
 		return 0;
 	}
 
+	if (manifest->toc_cache_valid) {
+		return manifest_flash_get_cached_child_elements_info (manifest, entry, type, parent_type,
+			child_type, child_len, child_count, first_entry);
+	}
+
 	entry_addr = manifest->addr + sizeof (struct manifest_header) +
 		sizeof (struct manifest_toc_header);
 	hash_addr = entry_addr + ((sizeof (struct manifest_toc_entry) + manifest->toc_hash_length) *
@@ -39,6 +39,11 @@ struct manifest_flash {
 	bool cache_valid;						/**< Flag indicating if the cached hash is valid. */
 	bool free_signature;					/**< Flag indicating the signature buffer should be freed. */
 	bool manifest_valid;					/**< Flag indicating there is a validated manifest. */
+	struct manifest_toc_entry *toc_cache;	/**< Optional cache for verified table of contents entries. */
+	size_t max_toc_entries;					/**< Maximum number of entries that can be cached. */
+	uint8_t *toc_hash_cache;				/**< Optional cache for verified element hashes. */
+	size_t max_toc_hash_cache;				/**< Length of the element hash cache buffer. */
+	bool toc_cache_valid;					/**< Flag indicating the table of contents cache is valid. */
 };
 
 
@@ -50,6 +55,11 @@ int manifest_flash_v2_init (struct manifest_flash *manifest, const struct flash
 	size_t max_platform_id);
 void manifest_flash_release (struct manifest_flash *manifest);
 
+int manifest_flash_enable_toc_cache (struct manifest_flash *manifest,
+	struct manifest_toc_entry *entry_cache, size_t max_entries, uint8_t *hash_cache,
+	size_t hash_cache_length);
+void manifest_flash_invalidate_toc_cache (struct manifest_flash *manifest);
+
 int manifest_flash_read_header (struct manifest_flash *manifest, struct manifest_header *header);
 
 int manifest_flash_verify (struct manifest_flash *manifest, struct hash_engine *hash,
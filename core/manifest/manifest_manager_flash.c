@@ -352,6 +352,7 @@ int manifest_manager_flash_activate_pending_manifest (struct manifest_manager_fl
 		manager->state->save_active_manifest (manager->state, manager->manifest_index,
 			MANIFEST_REGION_2);
 		manager->region1.is_valid = false;
+		manifest_flash_invalidate_toc_cache (manager->region1.flash);
 	}
 	else {
 		if (!manager->region1.is_valid) {
@@ -362,6 +363,7 @@ int manifest_manager_flash_activate_pending_manifest (struct manifest_manager_fl
 		manager->state->save_active_manifest (manager->state, manager->manifest_index,
 			MANIFEST_REGION_1);
 		manager->region2.is_valid = false;
+		manifest_flash_invalidate_toc_cache (manager->region2.flash);
 	}
 
 exit:
@@ -397,6 +399,7 @@ int manifest_manager_flash_clear_pending_region (struct manifest_manager_flash *
 
 		manager->updating = &region->updater;
 		region->is_valid = false;
+		manifest_flash_invalidate_toc_cache (region->flash);
 	}
 	else {
 		platform_mutex_unlock (&manager->lock);
@@ -512,6 +515,7 @@ static int manifest_manager_flash_clear_manifest (struct manifest_manager_flash_
 	}
 
 	region->is_valid = false;
+	manifest_flash_invalidate_toc_cache (region->flash);
 
 	return flash_erase_region (region->updater.flash, region->updater.base_addr, FLASH_BLOCK_SIZE);
 }
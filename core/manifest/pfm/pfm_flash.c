@@ -736,7 +736,7 @@ static int pfm_flash_find_version_entry_v1 (struct manifest_flash *pfm, const ch
 {
 	struct manifest_header header;
 	struct pfm_allowable_firmware_header fw_section;
-	char *check;
+	char check[UINT8_MAX + 1];
 	size_t check_len;
 	int i;
 	int status;
@@ -767,25 +767,22 @@ static int pfm_flash_find_version_entry_v1 (struct manifest_flash *pfm, const ch
 		*manifest_addr = *fw_addr + fw_section.length;
 	}
 
-	check = platform_malloc (check_len + 1);
-	if (check == NULL) {
-		return PFM_NO_MEMORY;
-	}
-
 	i = 0;
 	found = 0;
 	*fw_addr += sizeof (struct pfm_allowable_firmware_header);
 	while (!found && (i < fw_section.fw_count)) {
 		status = pfm->flash->read (pfm->flash, *fw_addr, (uint8_t*) fw_header, sizeof (*fw_header));
 		if (status != 0) {
-			goto error;
+			return status;
 		}
 
+		/* The version length is stored in a single byte, so the check buffer can always hold the
+		 * version ID from flash. */
 		if (fw_header->version_length == check_len) {
 			status = pfm->flash->read (pfm->flash, *fw_addr + sizeof (struct pfm_firmware_header),
 				(uint8_t*) check, fw_header->version_length);
 			if (status != 0) {
-				goto error;
+				return status;
 			}
 
 			check[fw_header->version_length] = '\0';
@@ -800,17 +797,11 @@ static int pfm_flash_find_version_entry_v1 (struct manifest_flash *pfm, const ch
 		}
 	}
 
-	platform_free (check);
 	if (!found) {
 		return PFM_UNSUPPORTED_VERSION;
 	}
 
 	return 0;
-
-error:
-	platform_free (check);
-
-	return status;
 }
 
 /**
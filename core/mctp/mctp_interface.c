@@ -84,19 +84,28 @@ static int mctp_interface_generate_packets_from_payload (const struct mctp_inter
 }
 
 /**
- * Reset MCTP message assembly.  This discards previously received packets and begins looking for a
- * new message.
+ * Reset MCTP message assembly for a single message.  This discards previously received packets and
+ * makes the assembly context available for a new message.
  *
- * @param mctp The MCTP layer to reset.
+ * @param mctp The MCTP layer that contains the assembly context.
+ * @param context The message assembly context to reset.
  */
-static void mctp_interface_reset_message_assembly (const struct mctp_interface *mctp)
+static void mctp_interface_reset_message_assembly (const struct mctp_interface *mctp,
+	struct mctp_interface_assembly *context)
 {
-	mctp->state->req_buffer.data = &mctp->state->msg_buffer[sizeof (mctp->state->msg_buffer) -
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS == 1
+	/* A single context shares the transmit buffer.  The message is assembled at the end of the
+	 * buffer so the response can be packetized into the same memory. */
+	context->req_buffer.data = &mctp->state->msg_buffer[sizeof (mctp->state->msg_buffer) -
 			MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
-	mctp->state->resp_buffer.data = mctp->state->msg_buffer;
-	mctp->state->start_packet_len = 0;
+#else
+	UNUSED (mctp);
+
+	context->req_buffer.data = context->msg_buffer;
+#endif
+	context->start_packet_len = 0;
 
-	cmd_interface_msg_new_message (&mctp->state->req_buffer, 0, 0, 0, 0);
+	cmd_interface_msg_new_message (&context->req_buffer, 0, 0, 0, 0);
 }
 
 #ifdef CMD_ENABLE_ISSUE_REQUEST
@@ -179,24 +188,171 @@ int mctp_interface_get_buffer_overhead (const struct msg_transport *transport, u
 	return total_overhead;
 }
 
+/**
+ * Check if a request context is tracking a request that has not received a response.
+ *
+ * @param request The request context to check.
+ */
+#define	mctp_interface_is_request_outstanding(request)	\
+	(((request)->rsp_state == MCTP_INTERFACE_RESPONSE_WAITING) || \
+		((request)->rsp_state == MCTP_INTERFACE_RESPONSE_PENDING) || \
+		((request)->rsp_state == MCTP_INTERFACE_RESPONSE_WAITING_DEPRECATED) || \
+		((request)->rsp_state == MCTP_INTERFACE_RESPONSE_PENDING_DEPRECATED))
+
+/**
+ * Check if a request context is tracking a request that nothing is waiting on.
+ *
+ * @param request The request context to check.
+ */
+#define	mctp_interface_is_request_pending(request)	\
+	(((request)->rsp_state == MCTP_INTERFACE_RESPONSE_PENDING) || \
+		((request)->rsp_state == MCTP_INTERFACE_RESPONSE_PENDING_DEPRECATED))
+
+/**
+ * Find the outstanding request that a response message belongs to.  The response lock must be held
+ * by the caller.
+ *
+ * @param mctp The MCTP handler to query.
+ * @param src_eid EID of the device that sent the response.
+ * @param msg_tag Message tag of the response.
+ *
+ * @return The outstanding request for the response or null if there is no matching request.
+ */
+static struct mctp_interface_request* mctp_interface_find_request (
+	const struct mctp_interface *mctp, uint8_t src_eid, uint8_t msg_tag)
+{
+	struct mctp_interface_request *request;
+	int i;
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+		request = &mctp->state->request[i];
+
+		if (mctp_interface_is_request_outstanding (request) &&
+			(request->response_msg_tag == msg_tag) && (request->response_eid == src_eid)) {
+			return request;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Reserve a context to track a new request.  An unused context is used, if available.  If not,
+ * the oldest request that is not waiting for a response will be discarded.  If every context has a
+ * request waiting for a response, this will block until one of them completes.
+ *
+ * The response lock must be held by the caller.  It will be temporarily released while waiting for
+ * a context to become available.
+ *
+ * @param mctp The MCTP handler sending a request.
+ *
+ * @return The request context to use.  The caller must set the context state to mark it as used.
+ */
+static struct mctp_interface_request* mctp_interface_reserve_request (
+	const struct mctp_interface *mctp)
+{
+	struct mctp_interface_request *request;
+	struct mctp_interface_request *pending;
+	int i;
+
+	while (1) {
+		pending = NULL;
+
+		for (i = 0; i < MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+			request = &mctp->state->request[i];
+
+			if (request->rsp_state == MCTP_INTERFACE_RESPONSE_IDLE) {
+				return request;
+			}
+
+			if (mctp_interface_is_request_pending (request) &&
+				((pending == NULL) ||
+				((mctp->state->request_count - request->sequence) >
+				(mctp->state->request_count - pending->sequence)))) {
+				pending = request;
+			}
+		}
+
+		if (pending != NULL) {
+			/* Nothing is waiting on the response to this request, so it can be dropped. */
+			return pending;
+		}
+
+		platform_mutex_unlock (&mctp->state->response_lock);
+		platform_semaphore_wait (&mctp->state->request_available, 0);
+		platform_mutex_lock (&mctp->state->response_lock);
+	}
+}
+
+/**
+ * Determine the message tag to use for a new request.  Tags used by other outstanding requests will
+ * be skipped.  The response lock must be held by the caller.
+ *
+ * @param mctp The MCTP handler sending the request.
+ * @param new_request The context that will be used for the new request.
+ *
+ * @return The message tag for the request.
+ */
+static uint8_t mctp_interface_get_request_msg_tag (const struct mctp_interface *mctp,
+	const struct mctp_interface_request *new_request)
+{
+	uint8_t msg_tag = mctp->state->next_msg_tag;
+	bool in_use;
+	int i;
+
+	do {
+		in_use = false;
+		for (i = 0; i < MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+			if ((&mctp->state->request[i] != new_request) &&
+				(mctp->state->request[i].rsp_state != MCTP_INTERFACE_RESPONSE_IDLE) &&
+				(mctp->state->request[i].response_msg_tag == msg_tag)) {
+				in_use = true;
+				msg_tag = (msg_tag + 1) % 8;
+				break;
+			}
+		}
+	} while (in_use);
+
+	return msg_tag;
+}
+
+/**
+ * Release a request context so it can be used for a new request.  The response lock must be held
+ * by the caller.
+ *
+ * @param mctp The MCTP handler that sent the request.
+ * @param request The request context to release.
+ */
+static void mctp_interface_release_request (const struct mctp_interface *mctp,
+	struct mctp_interface_request *request)
+{
+	request->rsp_state = MCTP_INTERFACE_RESPONSE_IDLE;
+	request->response_msg = NULL;
+
+	platform_semaphore_post (&mctp->state->request_available);
+}
+
 /**
  * @deprecated Pairs with the deprecated issue_request call and will be removed.
  *
  * Handle a response message for a request issued with issue_request.
  *
  * @param mctp The MCTP handler that has received a response message.
+ * @param request The request context for the response message.
+ * @param context The assembly context that contains the response message.
  *
  * @return 0 if response processing was successful or an error code.
  */
-static int mctp_interface_deprecated_handle_response_message (const struct mctp_interface *mctp)
+static int mctp_interface_deprecated_handle_response_message (const struct mctp_interface *mctp,
+	struct mctp_interface_request *request, struct mctp_interface_assembly *context)
 {
 	int status;
 
 	/* We know the message is one of the three supported types by this point.  If it wasn't,
 	 * it would have failed earlier in packet processing. */
-	if (MCTP_BASE_PROTOCOL_IS_CONTROL_MSG (mctp->state->msg_type)) {
+	if (MCTP_BASE_PROTOCOL_IS_CONTROL_MSG (context->msg_type)) {
 		if (mctp->cmd_mctp) {
-			status = mctp->cmd_mctp->process_response (mctp->cmd_mctp, &mctp->state->req_buffer);
+			status = mctp->cmd_mctp->process_response (mctp->cmd_mctp, &context->req_buffer);
 			if (status == CMD_HANDLER_ERROR_MESSAGE) {
 				debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_MCTP,
 					MCTP_LOGGING_MCTP_CONTROL_RSP_FAIL, status, mctp->state->channel_id);
@@ -207,16 +363,16 @@ static int mctp_interface_deprecated_handle_response_message (const struct mctp_
 			goto exit;
 		}
 	}
-	else if (MCTP_BASE_PROTOCOL_IS_VENDOR_MSG (mctp->state->msg_type)) {
+	else if (MCTP_BASE_PROTOCOL_IS_VENDOR_MSG (context->msg_type)) {
 		status = mctp->cmd_cerberus->process_response (mctp->cmd_cerberus,
-			&mctp->state->req_buffer);
+			&context->req_buffer);
 	}
-	else if (MCTP_BASE_PROTOCOL_IS_SPDM_MSG (mctp->state->msg_type)) {
+	else if (MCTP_BASE_PROTOCOL_IS_SPDM_MSG (context->msg_type)) {
 		if (mctp->cmd_spdm) {
-			cmd_interface_msg_remove_protocol_header (&mctp->state->req_buffer,
+			cmd_interface_msg_remove_protocol_header (&context->req_buffer,
 				sizeof (struct spdm_protocol_mctp_header));
 
-			status = mctp->cmd_spdm->process_response (mctp->cmd_spdm, &mctp->state->req_buffer);
+			status = mctp->cmd_spdm->process_response (mctp->cmd_spdm, &context->req_buffer);
 		}
 		else {
 			status = MCTP_BASE_PROTOCOL_UNSUPPORTED_OPERATION;
@@ -227,21 +383,31 @@ static int mctp_interface_deprecated_handle_response_message (const struct mctp_
 		status = MCTP_BASE_PROTOCOL_UNSUPPORTED_OPERATION;
 	}
 
+	if (request->rsp_state == MCTP_INTERFACE_RESPONSE_PENDING_DEPRECATED) {
+		/* Nothing is waiting for the response, so the request is complete. */
+		if (status == CMD_HANDLER_ERROR_MESSAGE) {
+			status = 0;
+		}
+
+		mctp_interface_release_request (mctp, request);
+		goto exit;
+	}
+
 	if (status == CMD_HANDLER_ERROR_MESSAGE) {
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_ERROR_DEPRECATED;
+		request->rsp_state = MCTP_INTERFACE_RESPONSE_ERROR_DEPRECATED;
 		status = 0;
 	}
 	else if (status != 0) {
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_FAIL_DEPRECATED;
+		request->rsp_state = MCTP_INTERFACE_RESPONSE_FAIL_DEPRECATED;
 	}
 	else {
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_SUCCESS;
+		request->rsp_state = MCTP_INTERFACE_RESPONSE_SUCCESS;
 	}
 
-	platform_semaphore_post (&mctp->state->wait_for_response);
+	platform_semaphore_post (&request->wait_for_response);
 
 exit:
-	mctp_interface_reset_message_assembly (mctp);
+	mctp_interface_reset_message_assembly (mctp, context);
 	platform_mutex_unlock (&mctp->state->response_lock);
 
 	return status;
@@ -252,6 +418,7 @@ int mctp_interface_send_request_message (const struct msg_transport *transport,
 {
 	const struct mctp_interface *mctp = (const struct mctp_interface*) transport;
 	struct mctp_base_protocol_message_header *msg_header;
+	struct mctp_interface_request *entry;
 	struct cmd_message cmd_msg;
 	uint8_t msg_type;
 	int src_eid;
@@ -285,88 +452,98 @@ int mctp_interface_send_request_message (const struct msg_transport *transport,
 	src_addr = device_manager_get_device_addr (mctp->device_manager,
 		DEVICE_MANAGER_SELF_DEVICE_NUM);
 
-	/* The transport needs to be locked before building the message since it uses the next response
-	 * tag as part of the packet construction. */
+	/* Request transmission is serialized, but only until the message has been sent.  Other requests
+	 * can be sent while waiting for the response. */
 	platform_mutex_lock (&mctp->state->request_lock);
-
-	status = mctp_interface_generate_packets_from_payload (mctp, request->payload,
-		request->payload_length, request->target_eid, dest_addr, src_eid, src_addr,
-		mctp->state->next_msg_tag, MCTP_BASE_PROTOCOL_TO_REQUEST, request->data,
-		request->max_response, &cmd_msg.pkt_size);
-	if (ROT_IS_ERROR (status)) {
-		goto unlock_tx;
-	}
-
-	cmd_msg.msg_size = status;
-	cmd_msg.data = request->data;
-	cmd_msg.dest_addr = dest_addr;
-
-	/* Do not manipulate any of the response handling state if the handler is currently processing
-	 * a received response message. */
 	platform_mutex_lock (&mctp->state->response_lock);
 
+	/* Claim a request context before building the message since the message tag depends on the
+	 * other outstanding requests. */
+	entry = mctp_interface_reserve_request (mctp);
 	if (timeout_ms != 0) {
-		status = platform_semaphore_reset (&mctp->state->wait_for_response);
+		status = platform_semaphore_reset (&entry->wait_for_response);
 		if (status != 0) {
 			platform_mutex_unlock (&mctp->state->response_lock);
 			goto unlock_tx;
 		}
 
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_WAITING;
+		entry->rsp_state = MCTP_INTERFACE_RESPONSE_WAITING;
 	}
 	else {
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_PENDING;
+		entry->rsp_state = MCTP_INTERFACE_RESPONSE_PENDING;
 	}
 
-	mctp->state->response_msg_tag = mctp->state->next_msg_tag;
-	mctp->state->response_msg_type = msg_type;
-	mctp->state->response_eid = request->target_eid;
-	mctp->state->response_msg = response;
+	entry->response_msg_tag = mctp_interface_get_request_msg_tag (mctp, entry);
+	entry->response_msg_type = msg_type;
+	entry->response_eid = request->target_eid;
+	entry->response_msg = response;
+	entry->sequence = mctp->state->request_count++;
+
+	platform_mutex_unlock (&mctp->state->response_lock);
+
+	status = mctp_interface_generate_packets_from_payload (mctp, request->payload,
+		request->payload_length, request->target_eid, dest_addr, src_eid, src_addr,
+		entry->response_msg_tag, MCTP_BASE_PROTOCOL_TO_REQUEST, request->data,
+		request->max_response, &cmd_msg.pkt_size);
+	if (ROT_IS_ERROR (status)) {
+		platform_mutex_lock (&mctp->state->response_lock);
+		mctp_interface_release_request (mctp, entry);
+		platform_mutex_unlock (&mctp->state->response_lock);
+
+		goto unlock_tx;
+	}
+
+	cmd_msg.msg_size = status;
+	cmd_msg.data = request->data;
+	cmd_msg.dest_addr = dest_addr;
 
 	/* The message tag has been consumed, regardless of whether the message transaction is
 	 * successful, so increment it for the next message. */
-	mctp->state->next_msg_tag = (mctp->state->next_msg_tag + 1) % 8;
+	platform_mutex_lock (&mctp->state->response_lock);
+	mctp->state->next_msg_tag = (entry->response_msg_tag + 1) % 8;
 	platform_mutex_unlock (&mctp->state->response_lock);
 
 	status = cmd_channel_send_message (mctp->channel, &cmd_msg);
+	platform_mutex_unlock (&mctp->state->request_lock);
+
 	if (status != 0) {
-		/* Reset to the idle state since request transmission failed. */
+		/* Release the request context since request transmission failed. */
 		platform_mutex_lock (&mctp->state->response_lock);
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_IDLE;
+		mctp_interface_release_request (mctp, entry);
 		platform_mutex_unlock (&mctp->state->response_lock);
 
-		goto unlock_tx;
+		return status;
 	}
 
 	if (timeout_ms == 0) {
-		status = MSG_TRANSPORT_NO_WAIT_RESPONSE;
-		goto unlock_tx;
+		return MSG_TRANSPORT_NO_WAIT_RESPONSE;
 	}
 
-	status = platform_semaphore_wait (&mctp->state->wait_for_response, timeout_ms);
+	status = platform_semaphore_wait (&entry->wait_for_response, timeout_ms);
 
 	/* Take the response handling lock again to clear up the response state, particularly to handle
 	 * error cases. */
 	platform_mutex_lock (&mctp->state->response_lock);
 
 	if (status == 0) {
-		if (mctp->state->rsp_state == MCTP_INTERFACE_RESPONSE_TOO_BIG) {
+		if (entry->rsp_state == MCTP_INTERFACE_RESPONSE_TOO_BIG) {
 			status = MSG_TRANSPORT_RESPONSE_TOO_LARGE;
 		}
 	}
 	else if (status == 1) {
 		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_MCTP,
-			MCTP_LOGGING_RSP_TIMEOUT,
-			(mctp->state->response_eid << 8) | mctp->state->response_msg_tag, timeout_ms);
+			MCTP_LOGGING_RSP_TIMEOUT, (entry->response_eid << 8) | entry->response_msg_tag,
+			timeout_ms);
 
 		status = MSG_TRANSPORT_REQUEST_TIMEOUT;
 	}
 
-	mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_IDLE;
+	mctp_interface_release_request (mctp, entry);
 	platform_mutex_unlock (&mctp->state->response_lock);
 
+	return status;
+
 unlock_tx:
-	mctp->state->response_msg = NULL;
 	platform_mutex_unlock (&mctp->state->request_lock);
 
 	return status;
@@ -390,56 +567,71 @@ static bool mctp_interface_is_expected_response (const struct mctp_interface *mc
 	uint8_t source_addr, uint8_t src_eid, uint8_t msg_tag, bool som, uint8_t msg_type)
 {
 #ifdef CMD_ENABLE_ISSUE_REQUEST
+	struct mctp_interface_request *request;
+	struct mctp_interface_request *active = NULL;
+	struct mctp_interface_request *same_tag = NULL;
 	bool expected = true;
+	int i;
 
 	platform_mutex_lock (&mctp->state->response_lock);
 
-	if ((mctp->state->rsp_state != MCTP_INTERFACE_RESPONSE_WAITING) &&
-		(mctp->state->rsp_state != MCTP_INTERFACE_RESPONSE_PENDING) &&
-		(mctp->state->rsp_state != MCTP_INTERFACE_RESPONSE_WAITING_DEPRECATED)) {
-		/* We are not waiting for any response.  Just drop the message. */
-		debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP,
-			MCTP_LOGGING_RSP_DROPPED, MCTP_LOGGING_RSP_DROPPED_UNEXPECTED, mctp->state->channel_id);
+	request = mctp_interface_find_request (mctp, src_eid, msg_tag);
+	if (request == NULL) {
+		/* The response doesn't match any outstanding request.  Find the closest match to report
+		 * why the message is being dropped. */
+		for (i = 0; i < MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+			request = &mctp->state->request[i];
 
-		expected = false;
-		goto exit;
-	}
+			if (!mctp_interface_is_request_outstanding (request)) {
+				continue;
+			}
 
-	if (msg_tag != mctp->state->response_msg_tag) {
-		/* This response message does not match the request that was sent.  Drop it. */
-		debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP,
-			MCTP_LOGGING_RSP_DROPPED, MCTP_LOGGING_RSP_DROPPED_WRONG_TAG,
-			(mctp->state->response_msg_tag << 16) | (msg_tag << 8) |
-				mctp->state->channel_id);
+			/* Report against the most recent request sent to the same endpoint, if there is one. */
+			if ((active == NULL) ||
+				((request->response_eid == src_eid) && ((active->response_eid != src_eid) ||
+				((mctp->state->request_count - request->sequence) <
+				(mctp->state->request_count - active->sequence))))) {
+				active = request;
+			}
 
-		expected = false;
-		goto exit;
-	}
+			if (request->response_msg_tag == msg_tag) {
+				same_tag = request;
+			}
+		}
 
-	if (src_eid != mctp->state->response_eid) {
-		/* This response message came from a different endpoint than expected.  Drop it. */
-		debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP,
-			MCTP_LOGGING_RSP_DROPPED, MCTP_LOGGING_RSP_DROPPED_WRONG_SOURCE,
-			(mctp->state->response_eid << 24) | (source_addr << 16) | (src_eid << 8) |
+		if (active == NULL) {
+			/* We are not waiting for any response.  Just drop the message. */
+			debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP,
+				MCTP_LOGGING_RSP_DROPPED, MCTP_LOGGING_RSP_DROPPED_UNEXPECTED,
 				mctp->state->channel_id);
+		}
+		else if (same_tag == NULL) {
+			/* This response message does not match any request that was sent.  Drop it. */
+			debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP,
+				MCTP_LOGGING_RSP_DROPPED, MCTP_LOGGING_RSP_DROPPED_WRONG_TAG,
+				(active->response_msg_tag << 16) | (msg_tag << 8) | mctp->state->channel_id);
+		}
+		else {
+			/* This response message came from a different endpoint than expected.  Drop it. */
+			debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP,
+				MCTP_LOGGING_RSP_DROPPED, MCTP_LOGGING_RSP_DROPPED_WRONG_SOURCE,
+				(same_tag->response_eid << 24) | (source_addr << 16) | (src_eid << 8) |
+					mctp->state->channel_id);
+		}
 
 		expected = false;
-		goto exit;
 	}
-
-	if (som && (msg_type != mctp->state->response_msg_type)) {
+	else if (som && (msg_type != request->response_msg_type)) {
 		/* MCTP message assembly should not be interrupted by packets for an unsupported message
 		 * type.  The message type is only present in the SOM packet.  For response messages, assume
 		 * the message type should match the request message that was sent. Drop it. */
 		debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP,
 			MCTP_LOGGING_RSP_DROPPED, MCTP_LOGGING_RSP_DROPPED_WRONG_TYPE,
-			(mctp->state->response_msg_type << 16) | (msg_type << 8) |
-				mctp->state->channel_id);
+			(request->response_msg_type << 16) | (msg_type << 8) | mctp->state->channel_id);
 
 		expected = false;
 	}
 
-exit:
 	platform_mutex_unlock (&mctp->state->response_lock);
 
 	return expected;
@@ -462,23 +654,38 @@ exit:
  * Handle a received response message to pair it with any outstanding request.
  *
  * @param mctp The MCTP handler that has received a response message.
+ * @param context The assembly context that contains the response message.
  *
  * @return 0 or the result of any deprecated response processing.
  */
-static int mctp_interface_handle_response_message (const struct mctp_interface *mctp)
+static int mctp_interface_handle_response_message (const struct mctp_interface *mctp,
+	struct mctp_interface_assembly *context)
 {
 #ifdef CMD_ENABLE_ISSUE_REQUEST
+	struct mctp_interface_request *request;
+
 	platform_mutex_lock (&mctp->state->response_lock);
 
+	request = mctp_interface_find_request (mctp, context->req_buffer.source_eid,
+		context->msg_tag);
+	if (request == NULL) {
+		/* The request is no longer outstanding, such as after a timeout.  Drop the response. */
+		mctp_interface_reset_message_assembly (mctp, context);
+		platform_mutex_unlock (&mctp->state->response_lock);
+
+		return 0;
+	}
+
 	/* Handle deprecated response processing. */
-	if (mctp->state->rsp_state == MCTP_INTERFACE_RESPONSE_WAITING_DEPRECATED) {
-		return mctp_interface_deprecated_handle_response_message (mctp);
+	if ((request->rsp_state == MCTP_INTERFACE_RESPONSE_WAITING_DEPRECATED) ||
+		(request->rsp_state == MCTP_INTERFACE_RESPONSE_PENDING_DEPRECATED)) {
+		return mctp_interface_deprecated_handle_response_message (mctp, request, context);
 	}
 
-	if (mctp->state->rsp_state == MCTP_INTERFACE_RESPONSE_PENDING) {
+	if (request->rsp_state == MCTP_INTERFACE_RESPONSE_PENDING) {
 		/* Received the expected response message.  Nothing is waiting for it so drop it. */
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_IDLE;
-		mctp_interface_reset_message_assembly (mctp);
+		mctp_interface_release_request (mctp, request);
+		mctp_interface_reset_message_assembly (mctp, context);
 		platform_mutex_unlock (&mctp->state->response_lock);
 
 		return 0;
@@ -486,28 +693,30 @@ static int mctp_interface_handle_response_message (const struct mctp_interface *
 
 	/* A response was received for the request that was sent.  Copy the response message into the
 	 * response buffer. */
-	if (mctp->state->req_buffer.length <= mctp->state->response_msg->max_response) {
-		cmd_interface_msg_new_message (mctp->state->response_msg,
-			mctp->state->req_buffer.source_eid, mctp->state->req_buffer.source_addr,
-			mctp->state->req_buffer.target_eid, mctp->state->req_buffer.channel_id);
+	if (context->req_buffer.length <= request->response_msg->max_response) {
+		cmd_interface_msg_new_message (request->response_msg, context->req_buffer.source_eid,
+			context->req_buffer.source_addr, context->req_buffer.target_eid,
+			context->req_buffer.channel_id);
 
-		cmd_interface_msg_add_payload_data (mctp->state->response_msg, mctp->state->req_buffer.data,
-			mctp->state->req_buffer.length);
+		cmd_interface_msg_add_payload_data (request->response_msg, context->req_buffer.data,
+			context->req_buffer.length);
 
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_SUCCESS;
+		request->rsp_state = MCTP_INTERFACE_RESPONSE_SUCCESS;
 	}
 	else {
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_TOO_BIG;
+		request->rsp_state = MCTP_INTERFACE_RESPONSE_TOO_BIG;
 	}
 
-	mctp_interface_reset_message_assembly (mctp);
-	platform_semaphore_post (&mctp->state->wait_for_response);
+	mctp_interface_reset_message_assembly (mctp, context);
+	platform_semaphore_post (&request->wait_for_response);
 	platform_mutex_unlock (&mctp->state->response_lock);
 
 	return 0;
 #else
 	UNUSED (mctp);
 
+	mctp_interface_reset_message_assembly (mctp, context);
+
 	return 0;
 #endif
 }
@@ -516,6 +725,7 @@ static int mctp_interface_handle_response_message (const struct mctp_interface *
  * Handle a received request message to generate an appropriate response.
  *
  * @param mctp The MCTP handler that received the message.
+ * @param context The assembly context that contains the request message.
  * @param rx_packet The last received packet in the message.
  * @param tx_message Output for a response message to send.  If this is null, there is was no
  * response generated for the received data.  If this is not null, this will point to the packetized
@@ -524,39 +734,40 @@ static int mctp_interface_handle_response_message (const struct mctp_interface *
  * @return 0 if the request was processed successfully or an error code.
  */
 static int mctp_interface_handle_request_message (const struct mctp_interface *mctp,
-	struct cmd_packet *rx_packet, struct cmd_message **tx_message)
+	struct mctp_interface_assembly *context, struct cmd_packet *rx_packet,
+	struct cmd_message **tx_message)
 {
 	uint8_t response_addr;
 	int status;
 
-	mctp->state->req_buffer.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	context->req_buffer.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
 
 	status = mctp->req_handler->base.process_request (&mctp->req_handler->base,
-		&mctp->state->req_buffer);
+		&context->req_buffer);
 	if (status != 0) {
-		mctp_interface_reset_message_assembly (mctp);
+		mctp_interface_reset_message_assembly (mctp, context);
 
 		return status;
 	}
 
 	/* Check to see if the response requires the message timeout to be adjusted. */
-	if (rx_packet->timeout_valid && mctp->state->req_buffer.crypto_timeout) {
+	if (rx_packet->timeout_valid && context->req_buffer.crypto_timeout) {
 		platform_increase_timeout (MCTP_BASE_PROTOCOL_MAX_CRYPTO_TIMEOUT_MS -
 			MCTP_BASE_PROTOCOL_MAX_RESPONSE_TIMEOUT_MS,	&rx_packet->pkt_timeout);
 	}
 
 	/* If a response was generated during request processing, packetize the message for transmission
 	 * back to the requester. */
-	if (mctp->state->req_buffer.length > 0) {
-		response_addr = mctp->state->req_buffer.source_addr;
+	if (context->req_buffer.length > 0) {
+		response_addr = context->req_buffer.source_addr;
 
-		status = mctp_interface_generate_packets_from_payload (mctp, mctp->state->req_buffer.data,
-			mctp->state->req_buffer.length, mctp->state->req_buffer.source_eid, response_addr,
-			mctp->state->req_buffer.target_eid, rx_packet->dest_addr, mctp->state->msg_tag,
+		status = mctp_interface_generate_packets_from_payload (mctp, context->req_buffer.data,
+			context->req_buffer.length, context->req_buffer.source_eid, response_addr,
+			context->req_buffer.target_eid, rx_packet->dest_addr, context->msg_tag,
 			MCTP_BASE_PROTOCOL_TO_RESPONSE, mctp->state->resp_buffer.data,
 			sizeof (mctp->state->msg_buffer), &mctp->state->resp_buffer.pkt_size);
 
-		mctp_interface_reset_message_assembly (mctp);
+		mctp_interface_reset_message_assembly (mctp, context);
 		if (ROT_IS_ERROR (status)) {
 			return status;
 		}
@@ -567,7 +778,7 @@ static int mctp_interface_handle_request_message (const struct mctp_interface *m
 		*tx_message = &mctp->state->resp_buffer;
 	}
 	else {
-		mctp_interface_reset_message_assembly (mctp);
+		mctp_interface_reset_message_assembly (mctp, context);
 		*tx_message = NULL;
 	}
 
@@ -642,6 +853,7 @@ int mctp_interface_init (struct mctp_interface *mctp, struct mctp_interface_stat
  */
 int mctp_interface_init_state (const struct mctp_interface *mctp)
 {
+	int i;
 #ifdef CMD_ENABLE_ISSUE_REQUEST
 	int status;
 #endif
@@ -654,14 +866,21 @@ int mctp_interface_init_state (const struct mctp_interface *mctp)
 	memset (mctp->state, 0, sizeof (struct mctp_interface_state));
 
 #ifdef CMD_ENABLE_ISSUE_REQUEST
-	status = platform_semaphore_init (&mctp->state->wait_for_response);
+	for (i = 0; i < MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+		status = platform_semaphore_init (&mctp->state->request[i].wait_for_response);
+		if (status != 0) {
+			goto free_rx_wait;
+		}
+	}
+
+	status = platform_semaphore_init (&mctp->state->request_available);
 	if (status != 0) {
-		return status;
+		goto free_rx_wait;
 	}
 
 	status = platform_mutex_init (&mctp->state->request_lock);
 	if (status != 0) {
-		goto free_rx_wait;
+		goto free_request_wait;
 	}
 
 	status = platform_mutex_init (&mctp->state->response_lock);
@@ -670,15 +889,23 @@ int mctp_interface_init_state (const struct mctp_interface *mctp)
 	}
 #endif
 
-	mctp_interface_reset_message_assembly (mctp);
+	mctp->state->resp_buffer.data = mctp->state->msg_buffer;
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		mctp_interface_reset_message_assembly (mctp, &mctp->state->assembly[i]);
+	}
 
 	return 0;
 
 #ifdef CMD_ENABLE_ISSUE_REQUEST
 free_tx_lock:
 	platform_mutex_free (&mctp->state->request_lock);
+free_request_wait:
+	platform_semaphore_free (&mctp->state->request_available);
 free_rx_wait:
-	platform_semaphore_free (&mctp->state->wait_for_response);
+	while (i > 0) {
+		platform_semaphore_free (&mctp->state->request[--i].wait_for_response);
+	}
 
 	return status;
 #endif
@@ -692,8 +919,14 @@ free_rx_wait:
 void mctp_interface_release (const struct mctp_interface *mctp)
 {
 #ifdef CMD_ENABLE_ISSUE_REQUEST
+	int i;
+
 	if (mctp != NULL) {
-		platform_semaphore_free (&mctp->state->wait_for_response);
+		for (i = 0; i < MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+			platform_semaphore_free (&mctp->state->request[i].wait_for_response);
+		}
+
+		platform_semaphore_free (&mctp->state->request_available);
 		platform_mutex_free (&mctp->state->request_lock);
 		platform_mutex_free (&mctp->state->response_lock);
 	}
@@ -811,6 +1044,183 @@ static int mctp_interface_drop_packet (const struct mctp_interface *mctp,
 	return 0;
 }
 
+/**
+ * Generate the log information that identifies the message being assembled in a context.
+ *
+ * @param context The assembly context for the message.
+ */
+#define	mctp_interface_assembly_log_id(context)	\
+	(((context)->req_buffer.source_eid << 24) | ((context)->msg_tag << 16) | \
+		((context)->tag_owner << 8) | (context)->msg_type)
+
+/**
+ * Log that a message being assembled has been discarded because a new message was started.
+ *
+ * @param mctp The MCTP transport layer that is discarding the message.
+ * @param context The assembly context for the message being discarded.
+ * @param src_eid EID of the sender for the new message.
+ * @param msg_tag Message tag for the new message.
+ * @param tag_owner Tag owner for the new message.
+ * @param msg_type Message type of the new message.
+ */
+static void mctp_interface_log_restart_message (const struct mctp_interface *mctp,
+	const struct mctp_interface_assembly *context, uint8_t src_eid, uint8_t msg_tag,
+	uint8_t tag_owner, uint8_t msg_type)
+{
+	debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP, MCTP_LOGGING_CHANNEL,
+		mctp->state->channel_id, 0);
+	debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_MCTP,
+		MCTP_LOGGING_RESTART_MESSAGE, mctp_interface_assembly_log_id (context),
+		((src_eid << 24) | (msg_tag << 16) | (tag_owner << 8) | msg_type));
+}
+
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+/**
+ * Log that a message being assembled has been discarded because the next packet was not received
+ * in time.
+ *
+ * @param mctp The MCTP transport layer that is discarding the message.
+ * @param context The assembly context for the message being discarded.
+ */
+static void mctp_interface_log_assembly_timeout (const struct mctp_interface *mctp,
+	const struct mctp_interface_assembly *context)
+{
+	debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP, MCTP_LOGGING_CHANNEL,
+		mctp->state->channel_id, 0);
+	debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_MCTP,
+		MCTP_LOGGING_ASSEMBLY_TIMEOUT, mctp_interface_assembly_log_id (context),
+		context->req_buffer.length);
+}
+#endif
+
+/**
+ * Find the context assembling a message for a specific message terminus.
+ *
+ * @param mctp The MCTP transport layer to query.
+ * @param src_eid EID of the message sender.
+ * @param msg_tag Message tag for the message.
+ * @param tag_owner Tag owner for the message.
+ *
+ * @return The assembly context for the message or null if no message is being assembled for the
+ * terminus.
+ */
+static struct mctp_interface_assembly* mctp_interface_find_message_assembly (
+	const struct mctp_interface *mctp, uint8_t src_eid, uint8_t msg_tag, uint8_t tag_owner)
+{
+	struct mctp_interface_assembly *context;
+	int i;
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		context = &mctp->state->assembly[i];
+
+		if ((context->start_packet_len != 0) && (context->msg_tag == msg_tag) &&
+			(context->tag_owner == tag_owner) && (context->req_buffer.source_eid == src_eid)) {
+			return context;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Get an assembly context to use for a new message.  An unused context will be used, if one is
+ * available.  Otherwise, a context whose message has timed out will be reclaimed.  If every context
+ * is actively assembling a message, the least recently used context will be discarded.
+ *
+ * With a single assembly context, any message in progress is always discarded.
+ *
+ * @param mctp The MCTP transport layer that is starting a new message.
+ * @param src_eid EID of the sender for the new message.
+ * @param msg_tag Message tag for the new message.
+ * @param tag_owner Tag owner for the new message.
+ * @param msg_type Message type of the new message.
+ *
+ * @return The assembly context to use for the new message.
+ */
+static struct mctp_interface_assembly* mctp_interface_allocate_message_assembly (
+	const struct mctp_interface *mctp, uint8_t src_eid, uint8_t msg_tag, uint8_t tag_owner,
+	uint8_t msg_type)
+{
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+	struct mctp_interface_assembly *context;
+	struct mctp_interface_assembly *oldest = NULL;
+	uint32_t age;
+	uint32_t oldest_age = 0;
+	int i;
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		if (mctp->state->assembly[i].start_packet_len == 0) {
+			return &mctp->state->assembly[i];
+		}
+	}
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		context = &mctp->state->assembly[i];
+
+		if (platform_has_timeout_expired (&context->timeout) == 1) {
+			mctp_interface_log_assembly_timeout (mctp, context);
+
+			return context;
+		}
+
+		age = mctp->state->packet_count - context->last_packet;
+		if ((oldest == NULL) || (age > oldest_age)) {
+			oldest = context;
+			oldest_age = age;
+		}
+	}
+
+	mctp_interface_log_restart_message (mctp, oldest, src_eid, msg_tag, tag_owner, msg_type);
+
+	return oldest;
+#else
+	struct mctp_interface_assembly *context = &mctp->state->assembly[0];
+
+	if (context->start_packet_len != 0) {
+		mctp_interface_log_restart_message (mctp, context, src_eid, msg_tag, tag_owner, msg_type);
+	}
+
+	return context;
+#endif
+}
+
+/**
+ * Determine the error to report for a packet that doesn't start a message and doesn't belong to
+ * any message currently being assembled.
+ *
+ * @param mctp The MCTP transport layer that received the packet.
+ * @param msg_tag Message tag of the received packet.
+ * @param tag_owner Tag owner of the received packet.
+ *
+ * @return The error code to report for the dropped packet.
+ */
+static int mctp_interface_get_unmatched_packet_error (const struct mctp_interface *mctp,
+	uint8_t msg_tag, uint8_t tag_owner)
+{
+	const struct mctp_interface_assembly *context;
+	bool active = false;
+	int i;
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		context = &mctp->state->assembly[i];
+
+		if (context->start_packet_len != 0) {
+			if ((context->msg_tag == msg_tag) && (context->tag_owner == tag_owner)) {
+				/* The packet matches a message in progress except for the source EID.  This is
+				 * reported separately only so that a different error can be logged. */
+				return MCTP_BASE_PROTOCOL_INVALID_EID;
+			}
+
+			active = true;
+		}
+	}
+
+	/* If some message is being assembled, the packet was received for a message terminus that is
+	 * different from any message currently in progress.  This is a special case of the no SOM
+	 * handling. */
+	return (active) ? MCTP_BASE_PROTOCOL_UNEXPECTED_PKT : MCTP_BASE_PROTOCOL_NO_SOM;
+}
+
 /**
  * Process a received MCTP packet using the SMBus transport binding.
  *
@@ -841,6 +1251,7 @@ int mctp_interface_process_packet (const struct mctp_interface *mctp, struct cmd
 	uint8_t tag_owner;
 	uint8_t msg_type;
 	size_t payload_len;
+	struct mctp_interface_assembly *context;
 	bool som;
 	bool eom;
 	int self_eid;
@@ -894,96 +1305,89 @@ int mctp_interface_process_packet (const struct mctp_interface *mctp, struct cmd
 	}
 
 	/* Check message assembly state relative to the new packet that was received. */
+	context = mctp_interface_find_message_assembly (mctp, src_eid, msg_tag, tag_owner);
 	if (som) {
-		if (mctp->state->start_packet_len != 0) {
+		if (context != NULL) {
 			/* A new message is being started before the previous one has completed.  This is
 			 * considered an error scenario by MCTP, so it's logged. */
-			debug_log_create_entry (DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_MCTP,
-				MCTP_LOGGING_CHANNEL, mctp->state->channel_id, 0);
-			debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_MCTP,
-				MCTP_LOGGING_RESTART_MESSAGE,
-				((mctp->state->req_buffer.source_eid << 24) | (mctp->state->msg_tag << 16) |
-							(mctp->state->tag_owner << 8) | mctp->state->msg_type),
-				((src_eid << 24) | (msg_tag << 16) | (tag_owner << 8) | msg_type));
+			mctp_interface_log_restart_message (mctp, context, src_eid, msg_tag, tag_owner,
+				msg_type);
+		}
+		else {
+			context = mctp_interface_allocate_message_assembly (mctp, src_eid, msg_tag, tag_owner,
+				msg_type);
 		}
 
-		cmd_interface_msg_new_message (&mctp->state->req_buffer, src_eid, response_addr, dest_eid,
+		cmd_interface_msg_new_message (&context->req_buffer, src_eid, response_addr, dest_eid,
 			mctp->state->channel_id);
 
-		mctp->state->start_packet_len = payload_len;
-		mctp->state->packet_seq = packet_seq;
-		mctp->state->msg_tag = msg_tag;
-		mctp->state->msg_type = msg_type;
-		mctp->state->tag_owner = tag_owner;
-	}
-	else if (mctp->state->start_packet_len == 0) {
-		/* Drop the packet if this packet is not a SOM and there is no message currently being
-		 * assembled. */
-		return mctp_interface_drop_packet (mctp, rx_packet, MCTP_BASE_PROTOCOL_NO_SOM, src_eid,
-			dest_eid, msg_tag, 0);
-	}
-	else if ((msg_tag != mctp->state->msg_tag) || (tag_owner != mctp->state->tag_owner)) {
-		/* This is a special case of the no SOM handling.  In this case, a packet was received for a
-		 * message terminus that is different from the message currently being assembled.
-		 *
-		 * Drop the packet and do not interrupt message assembly. */
-		return mctp_interface_drop_packet (mctp, rx_packet, MCTP_BASE_PROTOCOL_UNEXPECTED_PKT,
-			src_eid, dest_eid, msg_tag, 0);
-	}
-	else if (src_eid != mctp->state->req_buffer.source_eid) {
-		/* This is the same special case for no SOM handling, but in this case the message terminus
-		 * is different because of the source EID.  This is handled separately only so that a
-		 * different error can be logged.
-		 *
-		 * Drop the packet and do not interrupt message assembly. */
-		return mctp_interface_drop_packet (mctp, rx_packet, MCTP_BASE_PROTOCOL_INVALID_EID,	src_eid,
-			dest_eid, msg_tag, 0);
-	}
-	else if (packet_seq != mctp->state->packet_seq) {
-		/* The packet sequence number is wrong.  Reset message assembly and drop the packet. */
-		mctp_interface_reset_message_assembly (mctp);
-
-		return mctp_interface_drop_packet (mctp, rx_packet, MCTP_BASE_PROTOCOL_OUT_OF_SEQUENCE,
-			src_eid, dest_eid, msg_tag, 0);
-	}
-	else if ((payload_len != mctp->state->start_packet_len) &&
-		!(eom && (payload_len < mctp->state->start_packet_len))) {
-		/* Middle packets must be the same size as the first packet.  Reset message assembly and
-		 * drop the packet.
-		 *
-		 * Last packets can be smaller, but not larger, than the first packet. */
-		mctp_interface_reset_message_assembly (mctp);
-
-		return mctp_interface_drop_packet (mctp, rx_packet, MCTP_BASE_PROTOCOL_MIDDLE_PKT_LENGTH,
-			src_eid, dest_eid, msg_tag, payload_len);
+		context->start_packet_len = payload_len;
+		context->packet_seq = packet_seq;
+		context->msg_tag = msg_tag;
+		context->msg_type = msg_type;
+		context->tag_owner = tag_owner;
+	}
+	else {
+		if (context == NULL) {
+			/* Drop the packet if this packet is not a SOM and there is no matching message
+			 * currently being assembled.  Any other active message assembly is not interrupted. */
+			return mctp_interface_drop_packet (mctp, rx_packet,
+				mctp_interface_get_unmatched_packet_error (mctp, msg_tag, tag_owner), src_eid,
+				dest_eid, msg_tag, 0);
+		}
+		else if (packet_seq != context->packet_seq) {
+			/* The packet sequence number is wrong.  Reset message assembly and drop the packet. */
+			mctp_interface_reset_message_assembly (mctp, context);
+
+			return mctp_interface_drop_packet (mctp, rx_packet, MCTP_BASE_PROTOCOL_OUT_OF_SEQUENCE,
+				src_eid, dest_eid, msg_tag, 0);
+		}
+		else if ((payload_len != context->start_packet_len) &&
+			!(eom && (payload_len < context->start_packet_len))) {
+			/* Middle packets must be the same size as the first packet.  Reset message assembly and
+			 * drop the packet.
+			 *
+			 * Last packets can be smaller, but not larger, than the first packet. */
+			mctp_interface_reset_message_assembly (mctp, context);
+
+			return mctp_interface_drop_packet (mctp, rx_packet,
+				MCTP_BASE_PROTOCOL_MIDDLE_PKT_LENGTH, src_eid, dest_eid, msg_tag, payload_len);
+		}
 	}
 
 	/* Add the new packet data to the message being assembled. */
-	if ((payload_len + mctp->state->req_buffer.length) > MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY) {
+	if ((payload_len + context->req_buffer.length) > MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY) {
 		/* The request has grown too large for the message buffer.  Reset message assembly and
 		 * drop the packet. */
-		payload_len += mctp->state->req_buffer.length;
-		mctp_interface_reset_message_assembly (mctp);
+		payload_len += context->req_buffer.length;
+		mctp_interface_reset_message_assembly (mctp, context);
 
 		return mctp_interface_drop_packet (mctp, rx_packet, MCTP_BASE_PROTOCOL_MSG_TOO_LARGE,
 			src_eid, dest_eid, msg_tag, payload_len);
 	}
 
-	cmd_interface_msg_add_payload_data (&mctp->state->req_buffer, payload, payload_len);
-	mctp->state->packet_seq = (mctp->state->packet_seq + 1) % 4;
+	cmd_interface_msg_add_payload_data (&context->req_buffer, payload, payload_len);
+	context->packet_seq = (context->packet_seq + 1) % 4;
 
 	/* If this is the last packet in the message, process the complete message. */
 	if (eom) {
 		if (tag_owner == MCTP_BASE_PROTOCOL_TO_RESPONSE) {
 			/* The message contains response data. */
-			return mctp_interface_handle_response_message (mctp);
+			return mctp_interface_handle_response_message (mctp, context);
 		}
 		else {
 			/* The message contains request data. */
-			return mctp_interface_handle_request_message (mctp, rx_packet, tx_message);
+			return mctp_interface_handle_request_message (mctp, context, rx_packet, tx_message);
 		}
 	}
 
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+	/* Track activity on the message so stale and least recently used contexts can be identified
+	 * when a new message needs to be assembled. */
+	context->last_packet = mctp->state->packet_count++;
+	platform_init_timeout (MCTP_INTERFACE_ASSEMBLY_TIMEOUT_MS, &context->timeout);
+#endif
+
 	return 0;
 }
 
@@ -1020,6 +1424,7 @@ int mctp_interface_issue_request (const struct mctp_interface *mctp,
 {
 	/* TODO: Delete this function in favor of using the msg_transport interface. */
 	struct mctp_base_protocol_message_header *msg_header;
+	struct mctp_interface_request *entry;
 	struct cmd_message cmd_msg;
 	size_t max_transmission_unit;
 	size_t num_packets;
@@ -1068,12 +1473,30 @@ int mctp_interface_issue_request (const struct mctp_interface *mctp,
 	msg_type = msg_header->msg_type;
 
 	platform_mutex_lock (&mctp->state->request_lock);
+	platform_mutex_lock (&mctp->state->response_lock);
+
+	entry = mctp_interface_reserve_request (mctp);
+	status = platform_semaphore_reset (&entry->wait_for_response);
+	if (status != 0) {
+		platform_mutex_unlock (&mctp->state->response_lock);
+		goto unlock;
+	}
+
+	entry->rsp_state = MCTP_INTERFACE_RESPONSE_WAITING_DEPRECATED;
+	entry->response_msg_tag = mctp_interface_get_request_msg_tag (mctp, entry);
+	entry->response_msg_type = msg_type;
+	entry->response_eid = dest_eid;
+	entry->response_msg = NULL;
+	entry->sequence = mctp->state->request_count++;
+
+	platform_mutex_unlock (&mctp->state->response_lock);
 
 	status = mctp_interface_generate_packets_from_payload (mctp, request, length, dest_eid,
-		dest_addr, src_eid, src_addr, mctp->state->next_msg_tag, MCTP_BASE_PROTOCOL_TO_REQUEST,
+		dest_addr, src_eid, src_addr, entry->response_msg_tag, MCTP_BASE_PROTOCOL_TO_REQUEST,
 		msg_buffer, max_length, &cmd_msg.pkt_size);
 	if (ROT_IS_ERROR (status)) {
-		goto unlock;
+		platform_mutex_lock (&mctp->state->response_lock);
+		goto exit;
 	}
 
 	cmd_msg.msg_size = status;
@@ -1081,55 +1504,43 @@ int mctp_interface_issue_request (const struct mctp_interface *mctp,
 	cmd_msg.dest_addr = dest_addr;
 
 	platform_mutex_lock (&mctp->state->response_lock);
-
-	mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_WAITING_DEPRECATED;
-	mctp->state->response_msg_tag = mctp->state->next_msg_tag;
-	mctp->state->response_msg_type = msg_type;
-	mctp->state->response_eid = dest_eid;
-	mctp->state->response_msg = NULL;
-
-	mctp->state->next_msg_tag = (mctp->state->next_msg_tag + 1) % 8;
-
-	status = platform_semaphore_reset (&mctp->state->wait_for_response);
-	if (status != 0) {
-		goto exit;
-	}
-
+	mctp->state->next_msg_tag = (entry->response_msg_tag + 1) % 8;
 	platform_mutex_unlock (&mctp->state->response_lock);
 
 	status = cmd_channel_send_message (channel, &cmd_msg);
-	if (status != 0) {
+	if ((status != 0) || (timeout_ms == 0)) {
 		platform_mutex_lock (&mctp->state->response_lock);
-		mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_IDLE;
-		platform_mutex_unlock (&mctp->state->response_lock);
+		if (status != 0) {
+			goto exit;
+		}
 
-		goto unlock;
-	}
+		/* Nothing will wait for the response, but it still needs to be processed. */
+		entry->rsp_state = MCTP_INTERFACE_RESPONSE_PENDING_DEPRECATED;
+		platform_mutex_unlock (&mctp->state->response_lock);
 
-	if (timeout_ms == 0) {
 		goto unlock;
 	}
 
-	status = platform_semaphore_wait (&mctp->state->wait_for_response, timeout_ms);
+	status = platform_semaphore_wait (&entry->wait_for_response, timeout_ms);
 
 	platform_mutex_lock (&mctp->state->response_lock);
 
 	if (status == 1) {
 		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_MCTP,
-			MCTP_LOGGING_RSP_TIMEOUT,
-			(mctp->state->response_eid << 8) | mctp->state->response_msg_tag, timeout_ms);
+			MCTP_LOGGING_RSP_TIMEOUT, (entry->response_eid << 8) | entry->response_msg_tag,
+			timeout_ms);
 
 		status = MCTP_BASE_PROTOCOL_RESPONSE_TIMEOUT;
 	}
-	else if (mctp->state->rsp_state == MCTP_INTERFACE_RESPONSE_ERROR_DEPRECATED) {
+	else if (entry->rsp_state == MCTP_INTERFACE_RESPONSE_ERROR_DEPRECATED) {
 		status = MCTP_BASE_PROTOCOL_ERROR_RESPONSE;
 	}
-	else if (mctp->state->rsp_state == MCTP_INTERFACE_RESPONSE_FAIL_DEPRECATED) {
+	else if (entry->rsp_state == MCTP_INTERFACE_RESPONSE_FAIL_DEPRECATED) {
 		status = MCTP_BASE_PROTOCOL_FAIL_RESPONSE;
 	}
 
 exit:
-	mctp->state->rsp_state = MCTP_INTERFACE_RESPONSE_IDLE;
+	mctp_interface_release_request (mctp, entry);
 	platform_mutex_unlock (&mctp->state->response_lock);
 
 unlock:
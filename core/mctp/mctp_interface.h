@@ -26,29 +26,103 @@ enum mctp_interface_response_state {
 	MCTP_INTERFACE_RESPONSE_WAITING_DEPRECATED,	/**< Using the deprecated workflow to wait for a response. */
 	MCTP_INTERFACE_RESPONSE_ERROR_DEPRECATED,	/**< Deprecated indication of an error response. */
 	MCTP_INTERFACE_RESPONSE_FAIL_DEPRECATED,	/**< Deprecated indication of a response processing failure. */
+	MCTP_INTERFACE_RESPONSE_PENDING_DEPRECATED,	/**< Using the deprecated workflow without waiting for a response. */
 };
 
+/**
+ * Maximum number of MCTP messages that can be assembled at the same time.  Messages are tracked by
+ * source EID, message tag, and tag owner, so packets from different endpoints can be interleaved
+ * without interrupting each other.
+ *
+ * With a single context, received messages are assembled in the same buffer used to transmit
+ * responses.  Each additional context needs a separate buffer for a maximum sized message body, so
+ * this directly determines the amount of memory needed by the MCTP handler.
+ */
+#ifndef MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS
+#define	MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS		1
+#endif
+
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS < 1
+#error "At least one MCTP message assembly context is required."
+#endif
+
+/**
+ * Maximum amount of time, in milliseconds, to wait for the next packet of a partially assembled
+ * message.  Once this time has elapsed, the assembly context can be reclaimed for a new message
+ * from a different terminus.  A message that has not been reclaimed can still be completed.
+ *
+ * This is only used when there is more than one assembly context.  With a single context, a new
+ * message always replaces the message in progress.
+ */
+#ifndef MCTP_INTERFACE_ASSEMBLY_TIMEOUT_MS
+#define	MCTP_INTERFACE_ASSEMBLY_TIMEOUT_MS			MCTP_BASE_PROTOCOL_MAX_RESPONSE_TIMEOUT_MS
+#endif
+
+
+/**
+ * Maximum number of requests sent by the device that can be waiting for a response at the same
+ * time.  Outstanding requests are matched to responses by message tag, so no more than 8 requests
+ * can be tracked.
+ */
+#ifndef MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS
+#define	MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS		4
+#endif
+
+#if (MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS < 1) || (MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS > 8)
+#error "The number of outstanding MCTP requests must be between 1 and 8."
+#endif
+
+
+/**
+ * Context for assembling a single MCTP message from received packets.
+ */
+struct mctp_interface_assembly {
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+	uint8_t msg_buffer[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];	/**< Buffer for the message being assembled. */
+#endif
+	struct cmd_interface_msg req_buffer;						/**< Descriptor for the assembled message. */
+	size_t start_packet_len;									/**< Length of MCTP start packet.  0 if the context is not in use. */
+	uint8_t packet_seq;											/**< Expected sequence number of the next packet. */
+	uint8_t msg_tag;											/**< Message tag for the message being assembled. */
+	uint8_t tag_owner;											/**< Tag owner for the message being assembled. */
+	uint8_t msg_type;											/**< Message type for the message being assembled. */
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+	uint32_t last_packet;										/**< Packet counter value when the context was last updated. */
+	platform_clock timeout;										/**< Time after which the context can be reclaimed. */
+#endif
+};
+
+#ifdef CMD_ENABLE_ISSUE_REQUEST
+/**
+ * Context for tracking a request sent by the device until the response has been received.
+ */
+struct mctp_interface_request {
+	uint8_t response_eid;							/**< MCTP EID for device we expect a response from. */
+	uint8_t response_msg_tag;						/**< MCTP message tag for transaction we expect response for. */
+	uint8_t response_msg_type;						/**< Expected message type of the response message. */
+	struct cmd_interface_msg *response_msg;			/**< Descriptor for handling response messages. */
+	enum mctp_interface_response_state rsp_state;	/**< State of the transaction.  Idle if the context is not in use. */
+	uint32_t sequence;								/**< Request counter value when the request was sent. */
+	platform_semaphore wait_for_response;			/**< Semaphore used by requester to wait for response. */
+};
+#endif
+
 /**
  * Variable context for an SMBus MCTP handler.
  */
 struct mctp_interface_state {
 	uint8_t msg_buffer[MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN];	/**< Buffer for MCTP messages */
 	struct cmd_message resp_buffer;							/**< Buffer for transmitting responses */
-	struct cmd_interface_msg req_buffer;					/**< Buffer for request processing */
-	size_t start_packet_len;								/**< Length of MCTP start packet */
-	uint8_t packet_seq;										/**< Current MCTP exchange packet sequence */
-	uint8_t msg_tag;										/**< Current MCTP exchange message tag */
-	uint8_t tag_owner;										/**< Tag owner for the current message. */
-	uint8_t msg_type;										/**< Current MCTP exchange message type */
+	struct mctp_interface_assembly assembly[MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS];	/**< Contexts for message assembly. */
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+	uint32_t packet_count;									/**< Counter of packets added to any message. */
+#endif
 	int channel_id;											/**< Channel ID associated with the interface. */
 #ifdef CMD_ENABLE_ISSUE_REQUEST
-	uint8_t response_eid;									/**< MCTP EID for device we expect a response from. */
-	uint8_t response_msg_tag;								/**< MCTP message tag for transaction we expect response for. */
-	uint8_t response_msg_type;								/**< Expected message type of the response message. */
-	struct cmd_interface_msg *response_msg;					/**< Descriptor for handling response messages. */
+	struct mctp_interface_request request[MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS];	/**< Requests waiting for a response. */
+	uint32_t request_count;									/**< Counter of requests sent by the device. */
 	uint8_t next_msg_tag;									/**< MCTP message tag for the next request. */
-	enum mctp_interface_response_state rsp_state;			/**< State of transactions started by device */
-	platform_semaphore wait_for_response;					/**< Semaphore used by requester to wait for response. */
+	platform_semaphore request_available;					/**< Signal that a request context has been released. */
 	platform_mutex request_lock;							/**< Synchronization te serialize outgoing requests. */
 	platform_mutex response_lock;							/**< Synchronization for internal response handling. */
 #endif
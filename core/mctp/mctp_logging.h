@@ -24,6 +24,7 @@ enum {
 	MCTP_LOGGING_RSP_TIMEOUT,				/**< Timed out while waiting for MCTP response. */
 	MCTP_LOGGING_RSP_DROPPED,				/**< Dropped a received response message. */
 	MCTP_LOGGING_RESTART_MESSAGE,			/**< A new message was started before finishing the previous one. */
+	MCTP_LOGGING_ASSEMBLY_TIMEOUT,			/**< A partially assembled message was discarded after timing out. */
 };
 
 /**
@@ -0,0 +1,607 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <string.h>
+#include "heap_tlsf.h"
+
+
+/* Derived size class parameters. */
+#define	HEAP_TLSF_SL_INDEX_COUNT		(1U << HEAP_TLSF_SL_INDEX_COUNT_LOG2)
+#define	HEAP_TLSF_ALIGN_SIZE			((size_t) 1 << HEAP_TLSF_ALIGN_SIZE_LOG2)
+#define	HEAP_TLSF_FL_INDEX_SHIFT		(HEAP_TLSF_SL_INDEX_COUNT_LOG2 + HEAP_TLSF_ALIGN_SIZE_LOG2)
+#define	HEAP_TLSF_FL_INDEX_COUNT		(HEAP_TLSF_FL_INDEX_MAX - HEAP_TLSF_FL_INDEX_SHIFT + 1)
+#define	HEAP_TLSF_SMALL_BLOCK_SIZE		((size_t) 1 << HEAP_TLSF_FL_INDEX_SHIFT)
+
+/**
+ * Smallest usable block size.  Every block must be able to hold the free list pointers.
+ */
+#define	HEAP_TLSF_BLOCK_SIZE_MIN		\
+	(sizeof (struct heap_tlsf_block) - HEAP_TLSF_BLOCK_HEADER_LEN)
+
+/**
+ * Largest usable block size.  Blocks must be smaller than 2^HEAP_TLSF_FL_INDEX_MAX so that every
+ * block maps to one of the first-level size classes.
+ */
+#define	HEAP_TLSF_BLOCK_SIZE_MAX		\
+	((((size_t) 1 << HEAP_TLSF_FL_INDEX_MAX) - 1) & ~(HEAP_TLSF_ALIGN_SIZE - 1))
+
+/* Flags stored in the low bits of the block size. */
+#define	HEAP_TLSF_BLOCK_FREE			((size_t) 1)
+#define	HEAP_TLSF_BLOCK_FLAGS			(HEAP_TLSF_ALIGN_SIZE - 1)
+
+/**
+ * Get the usable size of a block.
+ *
+ * @param block The block to query.
+ */
+#define	heap_tlsf_block_size(block)		((block)->size & ~HEAP_TLSF_BLOCK_FLAGS)
+
+/**
+ * Check if a block is free.
+ *
+ * @param block The block to query.
+ */
+#define	heap_tlsf_block_is_free(block)	(((block)->size & HEAP_TLSF_BLOCK_FREE) != 0)
+
+/**
+ * Get the block contents from the block header.
+ *
+ * @param block The block header.
+ */
+#define	heap_tlsf_block_to_ptr(block)	((void*) (((uint8_t*) (block)) + HEAP_TLSF_BLOCK_HEADER_LEN))
+
+/**
+ * Get the block header from the block contents.
+ *
+ * @param ptr The block contents.
+ */
+#define	heap_tlsf_ptr_to_block(ptr)		\
+	((struct heap_tlsf_block*) (((uint8_t*) (ptr)) - HEAP_TLSF_BLOCK_HEADER_LEN))
+
+/**
+ * Get the block immediately after a block in memory.  The last block in the heap is always an
+ * allocated sentinel, so every other block has a next block.
+ *
+ * @param block The current block.
+ */
+#define	heap_tlsf_block_next(block)		\
+	((struct heap_tlsf_block*) (((uint8_t*) heap_tlsf_block_to_ptr (block)) + \
+		heap_tlsf_block_size (block)))
+
+/**
+ * Round a size up to the allocation alignment.
+ *
+ * @param size The size to round.
+ */
+#define	heap_tlsf_align_up(size)		\
+	(((size) + (HEAP_TLSF_ALIGN_SIZE - 1)) & ~(HEAP_TLSF_ALIGN_SIZE - 1))
+
+
+/* Bitmap of first-level size classes that have free blocks. */
+static uint32_t fl_bitmap;
+
+/* Bitmaps of second-level size classes that have free blocks, for each first-level class. */
+static uint32_t sl_bitmap[HEAP_TLSF_FL_INDEX_COUNT];
+
+/* Lists of free blocks for each size class. */
+static struct heap_tlsf_block *free_blocks[HEAP_TLSF_FL_INDEX_COUNT][HEAP_TLSF_SL_INDEX_COUNT];
+
+/* The first block in the heap, used for statistics and argument checking. */
+static struct heap_tlsf_block *heap_start = NULL;
+
+/* The sentinel block at the end of the heap. */
+static struct heap_tlsf_block *heap_end = NULL;
+
+
+/**
+ * Find the index of the most significant bit set in a value.
+ *
+ * @param value The value to check.  This must not be 0.
+ *
+ * @return The bit index.
+ */
+static int heap_tlsf_fls (size_t value)
+{
+#if defined (__GNUC__)
+	return (int) ((sizeof (unsigned long) * 8) - 1) - __builtin_clzl ((unsigned long) value);
+#else
+	int bit = 0;
+
+	while (value >>= 1) {
+		bit++;
+	}
+
+	return bit;
+#endif
+}
+
+/**
+ * Find the index of the least significant bit set in a bitmap.
+ *
+ * @param value The bitmap to check.  This must not be 0.
+ *
+ * @return The bit index.
+ */
+static int heap_tlsf_ffs (uint32_t value)
+{
+#if defined (__GNUC__)
+	return __builtin_ctz (value);
+#else
+	int bit = 0;
+
+	while ((value & 1) == 0) {
+		value >>= 1;
+		bit++;
+	}
+
+	return bit;
+#endif
+}
+
+/**
+ * Determine the size class that contains a block size.
+ *
+ * @param size The block size.
+ * @param fl Output for the first-level index.
+ * @param sl Output for the second-level index.
+ */
+static void heap_tlsf_mapping_insert (size_t size, int *fl, int *sl)
+{
+	if (size < HEAP_TLSF_SMALL_BLOCK_SIZE) {
+		/* Small blocks are stored in the first class, with one list per aligned size. */
+		*fl = 0;
+		*sl = (int) (size >> HEAP_TLSF_ALIGN_SIZE_LOG2);
+	}
+	else {
+		*fl = heap_tlsf_fls (size);
+		*sl = (int) ((size >> (*fl - HEAP_TLSF_SL_INDEX_COUNT_LOG2)) ^ HEAP_TLSF_SL_INDEX_COUNT);
+		*fl -= (HEAP_TLSF_FL_INDEX_SHIFT - 1);
+	}
+}
+
+/**
+ * Determine the smallest size class where every block is large enough for an allocation.
+ *
+ * @param size The requested allocation size.
+ * @param fl Output for the first-level index.
+ * @param sl Output for the second-level index.
+ */
+static void heap_tlsf_mapping_search (size_t size, int *fl, int *sl)
+{
+	if (size >= HEAP_TLSF_SMALL_BLOCK_SIZE) {
+		size += ((size_t) 1 << (heap_tlsf_fls (size) - HEAP_TLSF_SL_INDEX_COUNT_LOG2)) - 1;
+	}
+
+	heap_tlsf_mapping_insert (size, fl, sl);
+}
+
+/**
+ * Add a block to the free list for its size class.
+ *
+ * @param block The free block to add.
+ */
+static void heap_tlsf_insert_free_block (struct heap_tlsf_block *block)
+{
+	int fl;
+	int sl;
+
+	heap_tlsf_mapping_insert (heap_tlsf_block_size (block), &fl, &sl);
+
+	block->size |= HEAP_TLSF_BLOCK_FREE;
+	block->prev_free = NULL;
+	block->next_free = free_blocks[fl][sl];
+	if (block->next_free != NULL) {
+		block->next_free->prev_free = block;
+	}
+
+	free_blocks[fl][sl] = block;
+	fl_bitmap |= (1U << fl);
+	sl_bitmap[fl] |= (1U << sl);
+}
+
+/**
+ * Remove a block from the free list for its size class.
+ *
+ * @param block The free block to remove.
+ */
+static void heap_tlsf_remove_free_block (struct heap_tlsf_block *block)
+{
+	int fl;
+	int sl;
+
+	heap_tlsf_mapping_insert (heap_tlsf_block_size (block), &fl, &sl);
+
+	if (block->next_free != NULL) {
+		block->next_free->prev_free = block->prev_free;
+	}
+
+	if (block->prev_free != NULL) {
+		block->prev_free->next_free = block->next_free;
+	}
+	else {
+		free_blocks[fl][sl] = block->next_free;
+		if (block->next_free == NULL) {
+			sl_bitmap[fl] &= ~(1U << sl);
+			if (sl_bitmap[fl] == 0) {
+				fl_bitmap &= ~(1U << fl);
+			}
+		}
+	}
+
+	block->size &= ~HEAP_TLSF_BLOCK_FREE;
+}
+
+/**
+ * Find a free block that is large enough for an allocation and remove it from the free list.
+ *
+ * @param size The aligned allocation size.
+ *
+ * @return The free block or null if there is not enough memory.
+ */
+static struct heap_tlsf_block* heap_tlsf_take_free_block (size_t size)
+{
+	struct heap_tlsf_block *block;
+	uint32_t map;
+	int fl;
+	int sl;
+
+	heap_tlsf_mapping_search (size, &fl, &sl);
+	if (fl >= HEAP_TLSF_FL_INDEX_COUNT) {
+		goto check_exact_class;
+	}
+
+	map = sl_bitmap[fl] & (~0U << sl);
+	if (map == 0) {
+		/* No blocks in this first-level class are large enough.  Use a larger class. */
+		if (fl == (HEAP_TLSF_FL_INDEX_COUNT - 1)) {
+			goto check_exact_class;
+		}
+
+		map = fl_bitmap & (~0U << (fl + 1));
+		if (map == 0) {
+			goto check_exact_class;
+		}
+
+		fl = heap_tlsf_ffs (map);
+		map = sl_bitmap[fl];
+	}
+
+	sl = heap_tlsf_ffs (map);
+	block = free_blocks[fl][sl];
+
+	heap_tlsf_remove_free_block (block);
+
+	return block;
+
+check_exact_class:
+	/* There are no classes where every block is guaranteed to be large enough, but the class that
+	 * contains the requested size may still have a block that fits.  Only the first block in the
+	 * list is checked to keep the search time constant. */
+	heap_tlsf_mapping_insert (size, &fl, &sl);
+	if (fl >= HEAP_TLSF_FL_INDEX_COUNT) {
+		return NULL;
+	}
+
+	block = free_blocks[fl][sl];
+	if ((block == NULL) || (heap_tlsf_block_size (block) < size)) {
+		return NULL;
+	}
+
+	heap_tlsf_remove_free_block (block);
+
+	return block;
+}
+
+/**
+ * Trim an allocated block to a new size, returning any unused space at the end of the block to the
+ * heap.  The block is not changed if the unused space is too small to be a separate block.
+ *
+ * @param block The allocated block to trim.
+ * @param size The aligned size that needs to be kept in the block.
+ */
+static void heap_tlsf_trim_block (struct heap_tlsf_block *block, size_t size)
+{
+	struct heap_tlsf_block *remaining;
+	struct heap_tlsf_block *next;
+	size_t block_size = heap_tlsf_block_size (block);
+
+	if (block_size < (size + HEAP_TLSF_BLOCK_HEADER_LEN + HEAP_TLSF_BLOCK_SIZE_MIN)) {
+		return;
+	}
+
+	block->size = size;
+
+	remaining = heap_tlsf_block_next (block);
+	remaining->prev_phys = block;
+	remaining->size = block_size - size - HEAP_TLSF_BLOCK_HEADER_LEN;
+
+	next = heap_tlsf_block_next (remaining);
+	if (heap_tlsf_block_is_free (next)) {
+		/* Combine the trimmed space with the following free block. */
+		heap_tlsf_remove_free_block (next);
+		remaining->size += heap_tlsf_block_size (next) + HEAP_TLSF_BLOCK_HEADER_LEN;
+		next = heap_tlsf_block_next (remaining);
+	}
+
+	next->prev_phys = remaining;
+	heap_tlsf_insert_free_block (remaining);
+}
+
+/**
+ * Adjust a requested allocation size to a valid block size.
+ *
+ * @param size The requested size.
+ *
+ * @return The block size to allocate or 0 if the request is too large.
+ */
+static size_t heap_tlsf_adjust_size (size_t size)
+{
+	if (size > HEAP_TLSF_BLOCK_SIZE_MAX) {
+		return 0;
+	}
+
+	size = heap_tlsf_align_up (size);
+	if (size < HEAP_TLSF_BLOCK_SIZE_MIN) {
+		size = HEAP_TLSF_BLOCK_SIZE_MIN;
+	}
+
+	return size;
+}
+
+/**
+ * Get the header for an allocated block, checking that it is a valid block.
+ *
+ * @param addr The allocated memory.
+ *
+ * @return The block header or null if the address is not an allocated block.
+ */
+static struct heap_tlsf_block* heap_tlsf_get_allocated_block (void *addr)
+{
+	struct heap_tlsf_block *block;
+
+	if ((addr == NULL) || (heap_start == NULL)) {
+		return NULL;
+	}
+
+	block = heap_tlsf_ptr_to_block (addr);
+	if ((block < heap_start) || (block >= heap_end) || heap_tlsf_block_is_free (block)) {
+		return NULL;
+	}
+
+	return block;
+}
+
+/**
+ * Setup heap allocator
+ *
+ * @param heap_addr Address of heap memory to utilize
+ * @param heap_len Length of heap memory.
+ *
+ * @return 0 if completed successfully, or an error code if not.
+ */
+int heap_tlsf_init (const void *heap_addr, size_t heap_len)
+{
+	struct heap_tlsf_block *block;
+	uintptr_t start;
+	uintptr_t aligned;
+	size_t size;
+
+	if (heap_addr == NULL) {
+		return HEAP_TLSF_INVALID_ARGUMENT;
+	}
+
+	start = (uintptr_t) heap_addr;
+	aligned = heap_tlsf_align_up (start);
+	if (heap_len < ((aligned - start) + (HEAP_TLSF_BLOCK_HEADER_LEN * 2) +
+		HEAP_TLSF_BLOCK_SIZE_MIN)) {
+		return HEAP_TLSF_INVALID_ARGUMENT;
+	}
+
+	size = (heap_len - (aligned - start) - (HEAP_TLSF_BLOCK_HEADER_LEN * 2)) &
+		~(HEAP_TLSF_ALIGN_SIZE - 1);
+	if (size > HEAP_TLSF_BLOCK_SIZE_MAX) {
+		return HEAP_TLSF_HEAP_TOO_LARGE;
+	}
+
+	fl_bitmap = 0;
+	memset (sl_bitmap, 0, sizeof (sl_bitmap));
+	memset (free_blocks, 0, sizeof (free_blocks));
+
+	block = (struct heap_tlsf_block*) aligned;
+	block->prev_phys = NULL;
+	block->size = size;
+
+	/* Terminate the heap with an allocated block with no space so that nothing will try to combine
+	 * with memory outside the heap. */
+	heap_start = block;
+	heap_end = heap_tlsf_block_next (block);
+	heap_end->prev_phys = block;
+	heap_end->size = 0;
+
+	heap_tlsf_insert_free_block (block);
+
+	return 0;
+}
+
+/**
+ * Allocate memory of requested size
+ *
+ * @param size Size of block to allocate
+ *
+ * @return pointer to memory location allocated of at least requested size, or NULL if it fails
+ */
+void* heap_tlsf_allocate (size_t size)
+{
+	struct heap_tlsf_block *block;
+
+	size = heap_tlsf_adjust_size (size);
+	if ((size == 0) || (heap_start == NULL)) {
+		return NULL;
+	}
+
+	block = heap_tlsf_take_free_block (size);
+	if (block == NULL) {
+		return NULL;
+	}
+
+	heap_tlsf_trim_block (block, size);
+
+	return heap_tlsf_block_to_ptr (block);
+}
+
+/**
+ * Allocate then zeroize memory of requested size
+ *
+ * @param num_items Number of elements to allocate
+ * @param size Size each element to allocate
+ *
+ * @return pointer to memory location allocated of at least requested size, or NULL if it fails
+ */
+void* heap_tlsf_allocate_zeroize (size_t num_items, size_t size)
+{
+	size_t total_size = num_items * size;
+	void *block;
+
+	if ((size != 0) && ((total_size / size) != num_items)) {
+		return NULL;
+	}
+
+	block = heap_tlsf_allocate (total_size);
+	if (block != NULL) {
+		memset (block, 0, total_size);
+	}
+
+	return block;
+}
+
+/**
+ * Swap previously allocated block for a block of new size while preserving contents up to new
+ * size.  The existing block will be resized in place when possible.
+ *
+ * @param addr Pointer to previously allocated block, or NULL to allocate new block
+ * @param size Size of new block to allocate.
+ *
+ * @return pointer to memory location allocated of at least requested size, or NULL if it fails
+ */
+void* heap_tlsf_reallocate (void *addr, size_t size)
+{
+	struct heap_tlsf_block *block;
+	struct heap_tlsf_block *next;
+	size_t adjusted;
+	size_t old_size;
+	void *new_addr;
+
+	block = heap_tlsf_get_allocated_block (addr);
+	if (block == NULL) {
+		return heap_tlsf_allocate (size);
+	}
+
+	adjusted = heap_tlsf_adjust_size (size);
+	if (adjusted == 0) {
+		return NULL;
+	}
+
+	old_size = heap_tlsf_block_size (block);
+	next = heap_tlsf_block_next (block);
+
+	if ((adjusted > old_size) && heap_tlsf_block_is_free (next) &&
+		((old_size + HEAP_TLSF_BLOCK_HEADER_LEN + heap_tlsf_block_size (next)) >= adjusted)) {
+		/* Grow into the following free block. */
+		heap_tlsf_remove_free_block (next);
+		block->size = old_size + HEAP_TLSF_BLOCK_HEADER_LEN + heap_tlsf_block_size (next);
+		heap_tlsf_block_next (block)->prev_phys = block;
+	}
+
+	if (adjusted <= heap_tlsf_block_size (block)) {
+		heap_tlsf_trim_block (block, adjusted);
+
+		return addr;
+	}
+
+	new_addr = heap_tlsf_allocate (size);
+	if (new_addr != NULL) {
+		memcpy (new_addr, addr, old_size);
+		heap_tlsf_free (addr);
+	}
+
+	return new_addr;
+}
+
+/**
+ * Free allocated block
+ *
+ * @param addr Address of allocated block to free
+ */
+void heap_tlsf_free (void *addr)
+{
+	struct heap_tlsf_block *block;
+	struct heap_tlsf_block *prev;
+	struct heap_tlsf_block *next;
+
+	block = heap_tlsf_get_allocated_block (addr);
+	if (block == NULL) {
+		return;
+	}
+
+	prev = block->prev_phys;
+	if ((prev != NULL) && heap_tlsf_block_is_free (prev)) {
+		heap_tlsf_remove_free_block (prev);
+		prev->size += heap_tlsf_block_size (block) + HEAP_TLSF_BLOCK_HEADER_LEN;
+		block = prev;
+	}
+
+	next = heap_tlsf_block_next (block);
+	if (heap_tlsf_block_is_free (next)) {
+		heap_tlsf_remove_free_block (next);
+		block->size += heap_tlsf_block_size (next) + HEAP_TLSF_BLOCK_HEADER_LEN;
+		next = heap_tlsf_block_next (block);
+	}
+
+	next->prev_phys = block;
+	heap_tlsf_insert_free_block (block);
+}
+
+/**
+ * Get heap allocator statistics.  Unlike other heap operations, this needs to inspect every block
+ * in the heap.
+ *
+ * @param stats Container to fill up with statistics
+ *
+ * @return 0 if completed successfully, or an error code if not.
+ */
+int heap_tlsf_get_stats (struct heap_with_defrag_stats *stats)
+{
+	struct heap_tlsf_block *block = heap_start;
+	size_t size;
+
+	if (stats == NULL) {
+		return HEAP_TLSF_INVALID_ARGUMENT;
+	}
+
+	memset (stats, 0, sizeof (struct heap_with_defrag_stats));
+
+	while ((block != NULL) && (block != heap_end)) {
+		size = heap_tlsf_block_size (block);
+
+		if (heap_tlsf_block_is_free (block)) {
+			stats->total_free_size += size;
+			stats->total_free_size_w_overhead += (size + HEAP_TLSF_BLOCK_HEADER_LEN);
+			++stats->num_free_blocks;
+
+			if (size > stats->largest_free_block) {
+				stats->largest_free_block = size;
+			}
+		}
+		else {
+			stats->total_allocated_size += size;
+			stats->total_allocated_size_w_overhead += (size + HEAP_TLSF_BLOCK_HEADER_LEN);
+			++stats->num_allocated_blocks;
+		}
+
+		block = heap_tlsf_block_next (block);
+	}
+
+	stats->fragmentation = heap_with_defrag_get_fragmentation (stats);
+
+	return 0;
+}
@@ -0,0 +1,98 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HEAP_TLSF_H_
+#define HEAP_TLSF_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "heap_with_defrag.h"
+#include "status/rot_status.h"
+
+/* Module for a two-level segregated-fit (TLSF) heap memory allocator.  The allocator provides the
+ * same API as heap_with_defrag, but all allocation and free operations execute in constant time,
+ * independent of the number of blocks in the heap.  Free blocks are tracked in lists grouped by
+ * size class, with bitmaps indicating which lists have blocks available.  Allocations use a good
+ * fit from the smallest size class that can satisfy the request, which limits fragmentation.  Freed
+ * blocks are immediately combined with physically adjacent free blocks.  This implementation is not
+ * thread-safe. */
+
+
+/**
+ * Log2 of the number of second-level size classes for each power of two.  More classes reduce the
+ * amount of wasted memory in each allocation at the cost of more memory for list management.
+ */
+#ifndef HEAP_TLSF_SL_INDEX_COUNT_LOG2
+#define	HEAP_TLSF_SL_INDEX_COUNT_LOG2		4
+#endif
+
+#if ((HEAP_TLSF_SL_INDEX_COUNT_LOG2 < 1) || (HEAP_TLSF_SL_INDEX_COUNT_LOG2 > 5))
+#error "Invalid number of second-level size classes."
+#endif
+
+/**
+ * Log2 of the limit for block sizes supported by the allocator.  The usable heap space, excluding
+ * block headers, must be smaller than 2^HEAP_TLSF_FL_INDEX_MAX bytes.
+ */
+#ifndef HEAP_TLSF_FL_INDEX_MAX
+#define	HEAP_TLSF_FL_INDEX_MAX				24
+#endif
+
+/**
+ * Log2 of the alignment for all allocations.  Allocations must be aligned for pointer storage.
+ */
+#if (UINTPTR_MAX > 0xffffffff)
+#define	HEAP_TLSF_ALIGN_SIZE_LOG2			3
+#else
+#define	HEAP_TLSF_ALIGN_SIZE_LOG2			2
+#endif
+
+#if ((HEAP_TLSF_FL_INDEX_MAX <= (HEAP_TLSF_SL_INDEX_COUNT_LOG2 + HEAP_TLSF_ALIGN_SIZE_LOG2)) || \
+	(HEAP_TLSF_FL_INDEX_MAX > 31))
+#error "Invalid maximum size class."
+#endif
+
+
+/**
+ * Heap block header.
+ *
+ * All blocks, allocated or free, start with the physical block information.  The free list pointers
+ * only exist in free blocks and are part of the block contents when it is allocated.
+ */
+struct heap_tlsf_block {
+	struct heap_tlsf_block *prev_phys;	/**< Block immediately before this one in memory. */
+	size_t size;						/**< Usable size of the block.  Low bits are status flags. */
+	struct heap_tlsf_block *next_free;	/**< Next block in the same free list. */
+	struct heap_tlsf_block *prev_free;	/**< Previous block in the same free list. */
+};
+
+
+/**
+ * Overhead for each block in the heap.
+ */
+#define	HEAP_TLSF_BLOCK_HEADER_LEN		(offsetof (struct heap_tlsf_block, next_free))
+
+
+int heap_tlsf_init (const void *heap_addr, size_t heap_len);
+
+void* heap_tlsf_allocate (size_t size);
+void* heap_tlsf_allocate_zeroize (size_t num_items, size_t size);
+void* heap_tlsf_reallocate (void *addr, size_t size);
+void heap_tlsf_free (void *addr);
+
+int heap_tlsf_get_stats (struct heap_with_defrag_stats *stats);
+
+
+#define	HEAP_TLSF_ERROR(code)		ROT_ERROR (ROT_MODULE_HEAP_TLSF, code)
+
+/**
+ * Error codes that can be generated by the TLSF heap.
+ */
+enum {
+	HEAP_TLSF_INVALID_ARGUMENT = HEAP_TLSF_ERROR (0x00),	/**< Input parameter is null or not valid. */
+	HEAP_TLSF_NO_MEMORY = HEAP_TLSF_ERROR (0x01),			/**< Memory allocation failed. */
+	HEAP_TLSF_HEAP_TOO_LARGE = HEAP_TLSF_ERROR (0x02),		/**< The heap exceeds the largest size class. */
+};
+
+
+#endif	/* HEAP_TLSF_H_ */
@@ -364,8 +364,15 @@ int heap_with_defrag_get_stats (struct heap_with_defrag_stats *stats)
 		stats->total_free_size_w_overhead +=
 			(runner->size + HEAP_WITH_DEFRAG_CTRL_BLOCK_HEADER_LEN);
 		++stats->num_free_blocks;
+
+		if (runner->size > stats->largest_free_block) {
+			stats->largest_free_block = runner->size;
+		}
+
 		runner = runner->next;
 	}
 
+	stats->fragmentation = heap_with_defrag_get_fragmentation (stats);
+
 	return 0;
 }
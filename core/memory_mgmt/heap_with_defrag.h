@@ -50,6 +50,8 @@ struct heap_with_defrag_stats {
 	int num_free_blocks;					/**< Number of free blocks. */
 	size_t total_free_size;					/**< Total usable size of free blocks. */
 	size_t total_free_size_w_overhead;		/**< Total size of free blocks including overhead. */
+	size_t largest_free_block;				/**< Usable size of the largest free block. */
+	int fragmentation;						/**< Percentage of free memory not in the largest block. */
 };
 
 
@@ -62,6 +64,16 @@ void heap_with_defrag_free (void *addr);
 
 int heap_with_defrag_get_stats (struct heap_with_defrag_stats *stats);
 
+/**
+ * Determine the fragmentation of free heap memory as the percentage of free memory that cannot be
+ * used for a single allocation.
+ *
+ * @param stats Heap statistics that contain the free memory information.
+ */
+#define	heap_with_defrag_get_fragmentation(stats)	\
+	(((stats)->total_free_size == 0) ? 0 : \
+		(int) (100 - (((stats)->largest_free_block * 100) / (stats)->total_free_size)))
+
 
 #define	HEAP_WITH_DEFRAG_ERROR(\
 	code)									 ROT_ERROR (ROT_MODULE_HEAP_WITH_DEFRAG, code)
@@ -0,0 +1,189 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <string.h>
+#include "object_pool.h"
+
+
+/**
+ * Initialize a pool of fixed-size objects.
+ *
+ * @param pool The object pool to initialize.
+ * @param storage Memory to use for the pool objects.  This memory must remain valid for the
+ * lifetime of the pool.  Use OBJECT_POOL_STORAGE_LEN to determine the amount needed.
+ * @param storage_len Length of the storage memory.
+ * @param object_size The size of each object in the pool.
+ *
+ * @return 0 if the pool was initialized successfully or an error code.
+ */
+int object_pool_init (struct object_pool *pool, void *storage, size_t storage_len,
+	size_t object_size)
+{
+	uintptr_t start;
+	uintptr_t aligned;
+	uint8_t *object;
+	size_t i;
+	int status;
+
+	if ((pool == NULL) || (storage == NULL) || (object_size == 0)) {
+		return OBJECT_POOL_INVALID_ARGUMENT;
+	}
+
+	memset (pool, 0, sizeof (struct object_pool));
+
+	/* Every object must be able to hold the free list link while it is not allocated. */
+	if (object_size < sizeof (void*)) {
+		object_size = sizeof (void*);
+	}
+	object_size = (object_size + (sizeof (void*) - 1)) & ~(sizeof (void*) - 1);
+
+	start = (uintptr_t) storage;
+	aligned = (start + (sizeof (void*) - 1)) & ~((uintptr_t) sizeof (void*) - 1);
+	if (storage_len < ((aligned - start) + object_size)) {
+		return OBJECT_POOL_STORAGE_TOO_SMALL;
+	}
+
+	status = platform_mutex_init (&pool->lock);
+	if (status != 0) {
+		return status;
+	}
+
+	pool->stats.object_size = object_size;
+	pool->stats.num_objects = (storage_len - (aligned - start)) / object_size;
+	pool->storage = (uint8_t*) aligned;
+	pool->storage_end = pool->storage + (pool->stats.num_objects * object_size);
+
+	/* Link the objects in address order so they get allocated from the start of the storage. */
+	object = pool->storage_end;
+	for (i = 0; i < pool->stats.num_objects; i++) {
+		object -= object_size;
+		*((void**) object) = pool->free_list;
+		pool->free_list = object;
+	}
+
+	return 0;
+}
+
+/**
+ * Release the resources used by an object pool.  Any objects still allocated from the pool must no
+ * longer be used.
+ *
+ * @param pool The object pool to release.
+ */
+void object_pool_release (struct object_pool *pool)
+{
+	if (pool) {
+		platform_mutex_free (&pool->lock);
+	}
+}
+
+/**
+ * Allocate an object from the pool.
+ *
+ * @param pool The pool to allocate from.
+ *
+ * @return The allocated object or null if there are no objects available.  The object contents are
+ * not initialized.
+ */
+void* object_pool_allocate (struct object_pool *pool)
+{
+	void *object;
+
+	if (pool == NULL) {
+		return NULL;
+	}
+
+	platform_mutex_lock (&pool->lock);
+
+	object = pool->free_list;
+	if (object != NULL) {
+		pool->free_list = *((void**) object);
+
+		pool->stats.num_allocated++;
+		pool->stats.total_allocations++;
+		if (pool->stats.num_allocated > pool->stats.peak_allocated) {
+			pool->stats.peak_allocated = pool->stats.num_allocated;
+		}
+	}
+	else {
+		pool->stats.failed_allocations++;
+	}
+
+	platform_mutex_unlock (&pool->lock);
+
+	return object;
+}
+
+/**
+ * Allocate an object from the pool and initialize the contents to zero.
+ *
+ * @param pool The pool to allocate from.
+ *
+ * @return The allocated object or null if there are no objects available.
+ */
+void* object_pool_allocate_zeroize (struct object_pool *pool)
+{
+	void *object = object_pool_allocate (pool);
+
+	if (object != NULL) {
+		memset (object, 0, pool->stats.object_size);
+	}
+
+	return object;
+}
+
+/**
+ * Return an object to the pool.
+ *
+ * @param pool The pool the object was allocated from.
+ * @param object The object to free.
+ *
+ * @return 0 if the object was returned to the pool or an error code.  If the object is not part of
+ * the pool, OBJECT_POOL_NOT_POOL_OBJECT is returned and the object is not changed.  This allows
+ * callers that fall back to other memory when the pool is empty to determine how to free an object.
+ */
+int object_pool_free (struct object_pool *pool, void *object)
+{
+	uint8_t *check = (uint8_t*) object;
+
+	if ((pool == NULL) || (object == NULL)) {
+		return OBJECT_POOL_INVALID_ARGUMENT;
+	}
+
+	if ((check < pool->storage) || (check >= pool->storage_end) ||
+		(((size_t) (check - pool->storage) % pool->stats.object_size) != 0)) {
+		return OBJECT_POOL_NOT_POOL_OBJECT;
+	}
+
+	platform_mutex_lock (&pool->lock);
+
+	*((void**) object) = pool->free_list;
+	pool->free_list = object;
+	pool->stats.num_allocated--;
+
+	platform_mutex_unlock (&pool->lock);
+
+	return 0;
+}
+
+/**
+ * Get the usage statistics for an object pool.
+ *
+ * @param pool The pool to query.
+ * @param stats Output for the pool statistics.
+ *
+ * @return 0 if the statistics were retrieved successfully or an error code.
+ */
+int object_pool_get_stats (struct object_pool *pool, struct object_pool_stats *stats)
+{
+	if ((pool == NULL) || (stats == NULL)) {
+		return OBJECT_POOL_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&pool->lock);
+	*stats = pool->stats;
+	platform_mutex_unlock (&pool->lock);
+
+	return 0;
+}
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef OBJECT_POOL_H_
+#define OBJECT_POOL_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "platform_api.h"
+#include "status/rot_status.h"
+
+/* Module for a pool of fixed-size objects.  Objects are allocated from a single slab of memory
+ * provided by the caller, so allocation and free operations are constant time and never use the
+ * heap.  This is intended for objects that are frequently allocated and freed in hot paths, where
+ * the maximum number of objects needed at once is known.  All operations are thread-safe. */
+
+
+/**
+ * Determine the amount of storage needed for a pool of objects.  Objects are padded to pointer
+ * alignment.
+ *
+ * @param object_size The size of each object in the pool.
+ * @param count The number of objects the pool should hold.
+ */
+#define	OBJECT_POOL_STORAGE_LEN(object_size, count)	\
+	(((((object_size) < sizeof (void*)) ? sizeof (void*) : (object_size)) + \
+		(sizeof (void*) - 1)) / sizeof (void*) * sizeof (void*) * (count))
+
+
+/**
+ * Usage statistics for an object pool.
+ */
+struct object_pool_stats {
+	size_t object_size;				/**< Size of each object in the pool, including padding. */
+	size_t num_objects;				/**< Total number of objects in the pool. */
+	size_t num_allocated;			/**< Number of objects currently allocated. */
+	size_t peak_allocated;			/**< Maximum number of objects that have been allocated at once. */
+	uint32_t total_allocations;		/**< Number of successful allocations from the pool. */
+	uint32_t failed_allocations;	/**< Number of allocation requests when the pool was empty. */
+};
+
+/**
+ * A pool of fixed-size objects.
+ */
+struct object_pool {
+	uint8_t *storage;				/**< Memory for the objects in the pool. */
+	uint8_t *storage_end;			/**< End of the memory used for pool objects. */
+	void *free_list;				/**< List of objects that are not allocated. */
+	platform_mutex lock;			/**< Synchronization for pool management. */
+	struct object_pool_stats stats;	/**< Pool usage statistics. */
+};
+
+
+int object_pool_init (struct object_pool *pool, void *storage, size_t storage_len,
+	size_t object_size);
+void object_pool_release (struct object_pool *pool);
+
+void* object_pool_allocate (struct object_pool *pool);
+void* object_pool_allocate_zeroize (struct object_pool *pool);
+int object_pool_free (struct object_pool *pool, void *object);
+
+int object_pool_get_stats (struct object_pool *pool, struct object_pool_stats *stats);
+
+
+#define	OBJECT_POOL_ERROR(code)		ROT_ERROR (ROT_MODULE_OBJECT_POOL, code)
+
+/**
+ * Error codes that can be generated by an object pool.
+ */
+enum {
+	OBJECT_POOL_INVALID_ARGUMENT = OBJECT_POOL_ERROR (0x00),	/**< Input parameter is null or not valid. */
+	OBJECT_POOL_NO_MEMORY = OBJECT_POOL_ERROR (0x01),			/**< Memory allocation failed. */
+	OBJECT_POOL_NOT_POOL_OBJECT = OBJECT_POOL_ERROR (0x02),		/**< The object was not allocated from the pool. */
+	OBJECT_POOL_STORAGE_TOO_SMALL = OBJECT_POOL_ERROR (0x03),	/**< Not enough storage for any objects. */
+};
+
+
+#endif	/* OBJECT_POOL_H_ */
@@ -540,6 +540,46 @@ int platform_semaphore_reset (platform_semaphore *sem);
 #endif
 
 
+/*************************
+ * Atomic operations
+ *************************/
+
+#ifndef platform_atomic_load
+/**
+ * Atomically read a 32-bit value.  The read has acquire semantics, so no memory accesses that
+ * follow the read will be observed before it.
+ *
+ * @param value The value to read.
+ *
+ * @return The current value.
+ */
+uint32_t platform_atomic_load (const uint32_t *value);
+#endif
+
+#ifndef platform_atomic_store
+/**
+ * Atomically write a 32-bit value.  The write has release semantics, so all memory accesses that
+ * precede the write will be observed before it.
+ *
+ * @param value The value to update.
+ * @param new_value The value to write.
+ */
+void platform_atomic_store (uint32_t *value, uint32_t new_value);
+#endif
+
+#ifndef platform_atomic_fetch_add
+/**
+ * Atomically add to a 32-bit value.  The update has acquire and release semantics.
+ *
+ * @param value The value to update.
+ * @param add The amount to add to the value.
+ *
+ * @return The value before it was updated.
+ */
+uint32_t platform_atomic_fetch_add (uint32_t *value, uint32_t add);
+#endif
+
+
 /*************************
  * Task and OS control
  *************************/
@@ -7,6 +7,33 @@
 #include "common/unused.h"
 
 
+_Static_assert (sizeof (((struct hash_engine_riot*) 0)->context) <= HASH_MAX_CONTEXT_STATE_LENGTH,
+	"Saved hash state is too small for riot hash contexts");
+
+
+/**
+ * Get the length of the hash context for a type of hash.
+ *
+ * @param active The type of hash context.
+ *
+ * @return Length of the context or 0 if the hash type is not supported.
+ */
+static size_t hash_riot_get_context_length (uint8_t active)
+{
+	switch (active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			return sizeof (RIOT_SHA1_CONTEXT);
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			return sizeof (RIOT_SHA256_CONTEXT);
+
+		default:
+			return 0;
+	}
+}
+
 #ifdef HASH_ENABLE_SHA1
 static int hash_riot_calculate_sha1 (struct hash_engine *engine, const uint8_t *data, size_t length,
 	uint8_t *hash, size_t hash_length)
@@ -202,6 +229,52 @@ static void hash_riot_cancel (struct hash_engine *engine)
 	}
 }
 
+static int hash_riot_save_context (struct hash_engine *engine, struct hash_context *context)
+{
+	struct hash_engine_riot *riot = (struct hash_engine_riot*) engine;
+	size_t length;
+
+	if ((riot == NULL) || (context == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	length = hash_riot_get_context_length (riot->active);
+	if (length == 0) {
+		return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	context->active = riot->active;
+	context->length = length;
+	memcpy (context->state, &riot->context, length);
+
+	return 0;
+}
+
+static int hash_riot_restore_context (struct hash_engine *engine,
+	const struct hash_context *context)
+{
+	struct hash_engine_riot *riot = (struct hash_engine_riot*) engine;
+	size_t length;
+
+	if ((riot == NULL) || (context == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (riot->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	length = hash_riot_get_context_length (context->active);
+	if ((length == 0) || (context->length != length)) {
+		return HASH_ENGINE_INVALID_CONTEXT;
+	}
+
+	memcpy (&riot->context, context->state, length);
+	riot->active = context->active;
+
+	return 0;
+}
+
 /**
  * Initialize a riot hash engine.
  *
@@ -235,6 +308,8 @@ int hash_riot_init (struct hash_engine_riot *engine)
 	engine->base.get_hash = hash_riot_get_hash;
 	engine->base.finish = hash_riot_finish;
 	engine->base.cancel = hash_riot_cancel;
+	engine->base.save_context = hash_riot_save_context;
+	engine->base.restore_context = hash_riot_restore_context;
 
 	engine->active = HASH_ACTIVE_NONE;
 
@@ -22,6 +22,28 @@ static void riot_key_manager_free_ca_cert (struct der_cert *cert)
 	cert->cert = NULL;
 }
 
+/**
+ * Discard all cached certificate chain digests.  This must be called any time the certificates
+ * change.
+ *
+ * @param riot The RIoT key manager to update.
+ */
+static void riot_key_manager_invalidate_digests (struct riot_key_manager *riot)
+{
+	size_t i;
+
+	platform_mutex_lock (&riot->digest_lock);
+
+	/* Digests calculated before this point must not be added to the cache. */
+	riot->cert_generation++;
+
+	for (i = 0; i < riot->digest_count; i++) {
+		riot->digest_cache[i].length = 0;
+	}
+
+	platform_mutex_unlock (&riot->digest_lock);
+}
+
 /**
  * Load the certificates from keystore and check if they create a authenticated certificate chain.
  * If the chain is authenticated, update the RIoT keys using the stored certificates.
@@ -172,6 +194,8 @@ static int riot_key_manager_store_certificate (struct riot_key_manager *riot, in
 	status = riot->keystore->save_key (riot->keystore, id, cert, length);
 	platform_mutex_unlock (&riot->store_lock);
 
+	riot_key_manager_invalidate_digests (riot);
+
 	return status;
 }
 
@@ -211,6 +235,14 @@ static int riot_key_manager_init_certs (struct riot_key_manager *riot,
 		return status;
 	}
 
+	status = platform_mutex_init (&riot->digest_lock);
+	if (status != 0) {
+		platform_mutex_free (&riot->store_lock);
+		platform_mutex_free (&riot->auth_lock);
+
+		return status;
+	}
+
 	riot->keystore = keystore;
 	riot->x509 = x509;
 	riot->static_keys = static_keys;
@@ -286,6 +318,7 @@ void riot_key_manager_release (struct riot_key_manager *riot)
 
 		platform_mutex_free (&riot->store_lock);
 		platform_mutex_free (&riot->auth_lock);
+		platform_mutex_free (&riot->digest_lock);
 	}
 }
 
@@ -357,11 +390,18 @@ int riot_key_manager_store_intermediate_ca (struct riot_key_manager *riot, const
  */
 int riot_key_manager_verify_stored_certs (struct riot_key_manager *riot)
 {
+	int status;
+
 	if (riot == NULL) {
 		return RIOT_KEY_MANAGER_INVALID_ARGUMENT;
 	}
 
-	return riot_key_manager_authenticate_stored_certificates (riot);
+	status = riot_key_manager_authenticate_stored_certificates (riot);
+
+	/* Both successful and failed authentication can change the certificates in memory. */
+	riot_key_manager_invalidate_digests (riot);
+
+	return status;
 }
 
 /**
@@ -396,6 +436,8 @@ int riot_key_manager_erase_all_certificates (struct riot_key_manager *riot)
 exit:
 	platform_mutex_unlock (&riot->store_lock);
 
+	riot_key_manager_invalidate_digests (riot);
+
 	return status;
 }
 
@@ -472,3 +514,187 @@ const struct der_cert* riot_key_manager_get_intermediate_ca (struct riot_key_man
 		return NULL;
 	}
 }
+
+/**
+ * Provide storage for caching digests of the RIoT certificate chains.  Calculating these digests
+ * requires hashing every certificate in the chain, so caching them avoids repeating that work for
+ * each attestation request.  The cache is cleared any time certificates are stored, erased, or
+ * verified.
+ *
+ * @param riot The RIoT key manager to update.
+ * @param cache Storage for the cached digests.  This must remain valid for the lifetime of the key
+ * manager.  Set this to null to disable digest caching.
+ * @param count The number of entries in the cache.
+ *
+ * @return 0 if the digest cache was configured successfully or an error code.
+ */
+int riot_key_manager_enable_digest_cache (struct riot_key_manager *riot,
+	struct riot_key_manager_digest *cache, size_t count)
+{
+	if ((riot == NULL) || ((cache == NULL) && (count != 0))) {
+		return RIOT_KEY_MANAGER_INVALID_ARGUMENT;
+	}
+
+	if (cache == NULL) {
+		count = 0;
+	}
+
+	platform_mutex_lock (&riot->digest_lock);
+
+	riot->digest_cache = cache;
+	riot->digest_count = count;
+	riot->digest_next = 0;
+	if (count != 0) {
+		memset (cache, 0, sizeof (struct riot_key_manager_digest) * count);
+	}
+
+	platform_mutex_unlock (&riot->digest_lock);
+
+	return 0;
+}
+
+/**
+ * Find the cache entry for a certificate chain digest.  This must be called with the digest lock
+ * held.
+ *
+ * @param riot The RIoT key manager to query.
+ * @param slot Certificate chain slot for the digest.
+ * @param hash_type Hash algorithm used for the digest.
+ * @param type The type of digest.
+ *
+ * @return The cache entry for the digest or null if it is not cached.
+ */
+static struct riot_key_manager_digest* riot_key_manager_find_digest (
+	struct riot_key_manager *riot, uint8_t slot, enum hash_type hash_type,
+	enum riot_key_manager_digest_type type)
+{
+	size_t i;
+
+	for (i = 0; i < riot->digest_count; i++) {
+		if ((riot->digest_cache[i].length != 0) && (riot->digest_cache[i].slot == slot) &&
+			(riot->digest_cache[i].hash_type == hash_type) &&
+			(riot->digest_cache[i].type == type)) {
+			return &riot->digest_cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Get a cached digest for a certificate chain.
+ *
+ * If the digest is not cached, the caller can calculate it and add it to the cache using
+ * riot_key_manager_cache_digest().  The generation value reported here must be provided when adding
+ * the digest, so a digest calculated from certificates that have since changed will not be cached.
+ *
+ * @param riot The RIoT key manager to query.
+ * @param slot Certificate chain slot for the digest.
+ * @param hash_type Hash algorithm used for the digest.
+ * @param type The type of digest to get.
+ * @param digest Output for the cached digest.
+ * @param length Length of the digest buffer.
+ * @param cert_count Optional output for the number of certificates in the chain.
+ * @param generation Optional output for the current certificate generation.  This is reported
+ * whether or not the digest is cached.
+ *
+ * @return The length of the cached digest or an error code.  If the digest is not cached,
+ * RIOT_KEY_MANAGER_DIGEST_NOT_CACHED will be returned.
+ */
+int riot_key_manager_get_cached_digest (struct riot_key_manager *riot, uint8_t slot,
+	enum hash_type hash_type, enum riot_key_manager_digest_type type, uint8_t *digest,
+	size_t length, uint8_t *cert_count, uint32_t *generation)
+{
+	struct riot_key_manager_digest *entry;
+	int status;
+
+	if ((riot == NULL) || (digest == NULL)) {
+		return RIOT_KEY_MANAGER_INVALID_ARGUMENT;
+	}
+
+	platform_mutex_lock (&riot->digest_lock);
+
+	if (generation != NULL) {
+		*generation = riot->cert_generation;
+	}
+
+	entry = riot_key_manager_find_digest (riot, slot, hash_type, type);
+	if (entry == NULL) {
+		status = RIOT_KEY_MANAGER_DIGEST_NOT_CACHED;
+		goto exit;
+	}
+
+	if (length < entry->length) {
+		status = RIOT_KEY_MANAGER_SMALL_DIGEST_BUFFER;
+		goto exit;
+	}
+
+	memcpy (digest, entry->digest, entry->length);
+	if (cert_count != NULL) {
+		*cert_count = entry->cert_count;
+	}
+
+	status = entry->length;
+
+exit:
+	platform_mutex_unlock (&riot->digest_lock);
+
+	return status;
+}
+
+/**
+ * Add a certificate chain digest to the cache.  If the cache is full, a previously cached digest
+ * will be replaced.
+ *
+ * @param riot The RIoT key manager to update.
+ * @param slot Certificate chain slot for the digest.
+ * @param hash_type Hash algorithm used for the digest.
+ * @param type The type of digest being cached.
+ * @param digest The digest to cache.
+ * @param length Length of the digest.
+ * @param cert_count The number of certificates in the chain.
+ * @param generation The certificate generation reported by riot_key_manager_get_cached_digest()
+ * before the digest was calculated.  If the certificates have changed since then, the digest will
+ * not be cached.
+ *
+ * @return 0 if the digest was processed successfully or an error code.  It is not an error if the
+ * digest was not added to the cache because caching is disabled or the certificates have changed.
+ */
+int riot_key_manager_cache_digest (struct riot_key_manager *riot, uint8_t slot,
+	enum hash_type hash_type, enum riot_key_manager_digest_type type, const uint8_t *digest,
+	size_t length, uint8_t cert_count, uint32_t generation)
+{
+	struct riot_key_manager_digest *entry;
+
+	if ((riot == NULL) || (digest == NULL) || (length == 0)) {
+		return RIOT_KEY_MANAGER_INVALID_ARGUMENT;
+	}
+
+	if (length > RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH) {
+		return RIOT_KEY_MANAGER_DIGEST_TOO_LARGE;
+	}
+
+	platform_mutex_lock (&riot->digest_lock);
+
+	if ((riot->digest_count == 0) || (generation != riot->cert_generation)) {
+		goto exit;
+	}
+
+	entry = riot_key_manager_find_digest (riot, slot, hash_type, type);
+	if (entry == NULL) {
+		entry = &riot->digest_cache[riot->digest_next];
+		riot->digest_next = (riot->digest_next + 1) % riot->digest_count;
+	}
+
+	memcpy (entry->digest, digest, length);
+	entry->length = length;
+	entry->hash_type = hash_type;
+	entry->type = type;
+	entry->slot = slot;
+	entry->cert_count = cert_count;
+
+exit:
+	platform_mutex_unlock (&riot->digest_lock);
+
+	return 0;
+}
@@ -11,10 +11,37 @@
 #include "riot_keys.h"
 #include "asn1/x509.h"
 #include "common/certificate.h"
+#include "crypto/hash.h"
 #include "keystore/keystore.h"
 #include "status/rot_status.h"
 
 
+/**
+ * Maximum length of a cached certificate chain digest.  This is large enough for a SHA-256 digest
+ * of each certificate in a four certificate chain or a single digest of any supported type.
+ */
+#define	RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH		(4 * SHA256_HASH_LENGTH)
+
+/**
+ * The types of certificate chain digests that can be cached.
+ */
+enum riot_key_manager_digest_type {
+	RIOT_KEY_MANAGER_DIGEST_CHAIN = 0,		/**< A single digest calculated over the complete certificate chain. */
+	RIOT_KEY_MANAGER_DIGEST_CERT_LIST,		/**< A list containing the digest of each certificate in the chain. */
+};
+
+/**
+ * A cached digest of a certificate chain.
+ */
+struct riot_key_manager_digest {
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];	/**< The cached digest data. */
+	size_t length;										/**< Length of the digest data.  0 if the entry is not used. */
+	enum hash_type hash_type;							/**< Hash algorithm used for the digest. */
+	enum riot_key_manager_digest_type type;				/**< The type of digest that is cached. */
+	uint8_t slot;										/**< Certificate chain slot for the digest. */
+	uint8_t cert_count;									/**< Number of certificates in the chain. */
+};
+
 /**
  * Management of RIoT device keys.
  */
@@ -28,6 +55,11 @@ struct riot_key_manager {
 	bool static_devid;					/**< Flag indicating a static device ID cert buffer. */
 	platform_mutex store_lock;			/**< Synchronization for cert storage. */
 	platform_mutex auth_lock;			/**< Synchronization for key updates. */
+	platform_mutex digest_lock;			/**< Synchronization for the digest cache. */
+	struct riot_key_manager_digest *digest_cache;	/**< Cache of certificate chain digests. */
+	size_t digest_count;				/**< Number of entries in the digest cache. */
+	size_t digest_next;					/**< The next cache entry to replace. */
+	uint32_t cert_generation;			/**< Counter that changes every time the certificates change. */
 };
 
 
@@ -56,6 +88,15 @@ void riot_key_manager_release_riot_keys (struct riot_key_manager *riot,
 const struct der_cert* riot_key_manager_get_root_ca (struct riot_key_manager *riot);
 const struct der_cert* riot_key_manager_get_intermediate_ca (struct riot_key_manager *riot);
 
+int riot_key_manager_enable_digest_cache (struct riot_key_manager *riot,
+	struct riot_key_manager_digest *cache, size_t count);
+int riot_key_manager_get_cached_digest (struct riot_key_manager *riot, uint8_t slot,
+	enum hash_type hash_type, enum riot_key_manager_digest_type type, uint8_t *digest,
+	size_t length, uint8_t *cert_count, uint32_t *generation);
+int riot_key_manager_cache_digest (struct riot_key_manager *riot, uint8_t slot,
+	enum hash_type hash_type, enum riot_key_manager_digest_type type, const uint8_t *digest,
+	size_t length, uint8_t cert_count, uint32_t generation);
+
 
 #define	RIOT_KEY_MANAGER_ERROR(code)		ROT_ERROR (ROT_MODULE_RIOT_KEY_MANAGER, code)
 
@@ -68,6 +109,9 @@ enum {
 	RIOT_KEY_MANAGER_KEYSTORE_LOCKED = RIOT_KEY_MANAGER_ERROR (0x02),		/**< The keystore is locked from modification. */
 	RIOT_KEY_MANAGER_NO_SIGNED_DEVICE_ID = RIOT_KEY_MANAGER_ERROR (0x03),	/**< There is no signed device ID stored. */
 	RIOT_KEY_MANAGER_NO_ROOT_CA = RIOT_KEY_MANAGER_ERROR (0x04),			/**< There is no root CA stored. */
+	RIOT_KEY_MANAGER_DIGEST_NOT_CACHED = RIOT_KEY_MANAGER_ERROR (0x05),		/**< The requested digest is not in the cache. */
+	RIOT_KEY_MANAGER_DIGEST_TOO_LARGE = RIOT_KEY_MANAGER_ERROR (0x06),		/**< The digest is too large for the cache. */
+	RIOT_KEY_MANAGER_SMALL_DIGEST_BUFFER = RIOT_KEY_MANAGER_ERROR (0x07),	/**< The digest buffer is too small for the cached digest. */
 };
 
 
@@ -26,6 +26,9 @@ int cmd_interface_spdm_process_request (const struct cmd_interface *intf,
 	uint8_t req_code;
 	int status = 0;
 	struct spdm_secure_session_manager *session_manager;
+	struct spdm_secure_session *session = NULL;
+	uint32_t session_id = SPDM_INVALID_SESSION_ID;
+	struct spdm_connection_info connection_info;
 
 	if ((spdm_responder == NULL) || (request == NULL)) {
 		status = CMD_HANDLER_SPDM_RESPONDER_INVALID_ARGUMENT;
@@ -53,12 +56,21 @@ int cmd_interface_spdm_process_request (const struct cmd_interface *intf,
 			status = 0;
 			goto exit;
 		}
+
+		/* Requests in a session are processed using the connection the session was created on.
+		 * Another requester may have negotiated a new connection since the session was created. */
+		session_id = session_manager->get_last_session_id (session_manager);
+		session = session_manager->get_session (session_manager, session_id);
+		if (session != NULL) {
+			connection_info = spdm_responder->state->connection_info;
+			spdm_responder->state->connection_info = session->connection_info;
+		}
 	}
 
 	/* Pre-process the request and get the command Id. */
 	status = spdm_get_command_id (request, &req_code);
 	if (status != 0) {
-		goto exit;
+		goto restore_connection;
 	}
 
 	switch (req_code) {
@@ -102,6 +114,10 @@ int cmd_interface_spdm_process_request (const struct cmd_interface *intf,
 			status = spdm_end_session (spdm_responder, request);
 			break;
 
+		case SPDM_REQUEST_RESPOND_IF_READY:
+			status = spdm_respond_if_ready (spdm_responder, request);
+			break;
+
 		case SPDM_REQUEST_VENDOR_DEFINED_REQUEST:
 			status = spdm_vendor_defined_request (spdm_responder, request);
 			break;
@@ -112,6 +128,16 @@ int cmd_interface_spdm_process_request (const struct cmd_interface *intf,
 			break;
 	}
 
+restore_connection:
+	if (session != NULL) {
+		/* The session is released by requests that end the session. */
+		if (session->session_id == session_id) {
+			session->connection_info = spdm_responder->state->connection_info;
+		}
+
+		spdm_responder->state->connection_info = connection_info;
+	}
+
 	if ((status == 0) && (request->is_encrypted == true)) {
 		/* If the request was encoded and was succesfully decoded, encode the response. */
 		status = session_manager->encode_secure_message (session_manager, request);
@@ -353,6 +379,80 @@ exit:
 	return status;
 }
 
+/**
+ * Generate the signatures for CHALLENGE and GET_MEASUREMENTS responses on a background task.
+ * Instead of blocking request processing while the signature is generated, the responder returns a
+ * ResponseNotReady error and provides the complete response when the requester sends
+ * RESPOND_IF_READY.  Responses in a secure session are always signed immediately, as are responses
+ * that arrive while the background task is busy with another operation.
+ *
+ * Asynchronous signing is disabled by default.  Platforms that want it must enable it after the
+ * responder has been initialized.
+ *
+ * The background task and the responder will both use the ECC engine, so the responder engine is
+ * wrapped with a thread-safe ECC instance while asynchronous signing is enabled.  Asynchronous
+ * signing must not be reconfigured while a background signature is being generated.
+ *
+ * @param spdm_responder The SPDM responder to configure.
+ * @param background The background task that will generate signatures.  Null to generate all
+ * signatures immediately.
+ * @param ecc Storage for the thread-safe wrapper of the responder ECC engine.  This is not used if
+ * the background task is null.
+ * @param buffer Buffer to hold responses while the signature is being generated.  Responses that
+ * don't fit in this buffer will be signed immediately.
+ * @param length Length of the response buffer.
+ *
+ * @return 0 if signing was configured successfully or an error code.
+ */
+int cmd_interface_spdm_responder_enable_async_signing (
+	struct cmd_interface_spdm_responder *spdm_responder, const struct cmd_background *background,
+	struct ecc_engine_thread_safe *ecc, uint8_t *buffer, size_t length)
+{
+	int status = 0;
+
+	if ((spdm_responder == NULL) || (spdm_responder->state == NULL) ||
+		((background != NULL) && ((ecc == NULL) || (buffer == NULL) || (length == 0) ||
+		(spdm_responder->ecc_engine == NULL)))) {
+		return CMD_HANDLER_SPDM_RESPONDER_INVALID_ARGUMENT;
+	}
+
+	/* Restore the original ECC engine from any previous configuration. */
+	if (spdm_responder->async_ecc != NULL) {
+		spdm_responder->ecc_engine = spdm_responder->async_ecc->engine;
+		ecc_thread_safe_release (spdm_responder->async_ecc);
+		spdm_responder->async_ecc = NULL;
+	}
+
+	if (background != NULL) {
+		status = ecc_thread_safe_init (ecc, spdm_responder->ecc_engine);
+		if (status == 0) {
+			spdm_responder->ecc_engine = &ecc->base;
+			spdm_responder->async_ecc = ecc;
+		}
+		else {
+			background = NULL;
+		}
+	}
+
+	spdm_responder->background = background;
+	if (background != NULL) {
+		spdm_responder->deferred_response = buffer;
+		spdm_responder->deferred_length = length;
+	}
+	else {
+		spdm_responder->deferred_response = NULL;
+		spdm_responder->deferred_length = 0;
+	}
+
+	/* Drop any response that is waiting on the previous configuration. */
+	if (spdm_responder->state->response_state == SPDM_RESPONSE_STATE_NOT_READY) {
+		spdm_responder->state->deferred.request_code = 0;
+		spdm_responder->state->response_state = SPDM_RESPONSE_STATE_NORMAL;
+	}
+
+	return status;
+}
+
 /**
  * Deinitialize the SPDM responder instance.
  *
@@ -360,5 +460,7 @@ exit:
  */
 void cmd_interface_spdm_responder_deinit (const struct cmd_interface_spdm_responder *spdm_responder)
 {
-	UNUSED (spdm_responder);
+	if ((spdm_responder != NULL) && (spdm_responder->async_ecc != NULL)) {
+		ecc_thread_safe_release (spdm_responder->async_ecc);
+	}
 }
@@ -9,8 +9,10 @@
 #include "spdm_measurements.h"
 #include "spdm_protocol.h"
 #include "spdm_transcript_manager.h"
+#include "cmd_interface/cmd_background.h"
 #include "cmd_interface/cmd_interface.h"
 #include "crypto/ecc.h"
+#include "crypto/ecc_thread_safe.h"
 #include "crypto/hash.h"
 #include "crypto/rng.h"
 #include "riot/riot_key_manager.h"
@@ -42,6 +44,10 @@ struct cmd_interface_spdm_responder {
 	const struct spdm_local_device_algorithms *local_algorithms;		/**< Local SPDM algorithms and their priorities. */
 	struct spdm_secure_session_manager *session_manager;				/**< Session manager for managing secure sessions. */
 	const struct cmd_interface *vdm_handler;							/**< Command handler for VDM messages */
+	const struct cmd_background *background;							/**< Background task for generating response signatures. */
+	uint8_t *deferred_response;											/**< Buffer for responses waiting for a signature. */
+	size_t deferred_length;												/**< Length of the deferred response buffer. */
+	struct ecc_engine_thread_safe *async_ecc;							/**< Thread-safe ECC engine shared with the background task. */
 };
 
 
@@ -63,6 +69,10 @@ int cmd_interface_spdm_responder_init_state (
 void cmd_interface_spdm_responder_deinit (
 	const struct cmd_interface_spdm_responder *spdm_responder);
 
+int cmd_interface_spdm_responder_enable_async_signing (
+	struct cmd_interface_spdm_responder *spdm_responder, const struct cmd_background *background,
+	struct ecc_engine_thread_safe *ecc, uint8_t *buffer, size_t length);
+
 
 #define	CMD_HANDLER_SPDM_RESPONDER_ERROR(\
 	code)	   ROT_ERROR (ROT_MODULE_CMD_HANDLER_SPDM_RESPONDER, code)
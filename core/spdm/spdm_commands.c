@@ -12,6 +12,7 @@
 #include "spdm_logging.h"
 #include "spdm_logging.h"
 #include "spdm_secure_session_manager.h"
+#include "platform_api.h"
 #include "attestation/attestation_responder.h"
 #include "cmd_interface/device_manager.h"
 #include "common/array_size.h"
@@ -152,7 +153,10 @@ static void spdm_handle_response_state (struct spdm_state *state, int *spdm_erro
 			break;
 
 		case SPDM_RESPONSE_STATE_NOT_READY:
-		/* [TODO] Implement this case in later messages. */
+			/* A response is waiting for its signature.  Nothing else can be processed until the
+			 * requester retrieves it with RESPOND_IF_READY. */
+			*spdm_error = SPDM_ERROR_BUSY;
+			break;
 
 		default:
 			*spdm_error = SPDM_ERROR_UNSPECIFIED;
@@ -1034,7 +1038,8 @@ exit:
 }
 
 /**
- * Get the digest of the spdm certificate chain.
+ * Get the digest of the spdm certificate chain.  Digests are cached by the key manager, so the
+ * certificate chain only needs to be hashed again after the certificates change.
  *
  * @param key_manager RIoT device key manager.
  * @param hash_engine Hash engine for hashing operations.
@@ -1054,20 +1059,26 @@ static int spdm_get_certificate_chain_digest (struct riot_key_manager *key_manag
 	uint32_t cert_chain_length;
 	const struct riot_keys *keys = NULL;
 	int hash_size;
+	uint32_t generation;
 	bool cancel_hash = false;
 
+	hash_size = hash_get_hash_length (hash_type);
+	if (hash_size == HASH_ENGINE_UNKNOWN_HASH) {
+		return HASH_ENGINE_UNKNOWN_HASH;
+	}
+
+	status = riot_key_manager_get_cached_digest (key_manager, 0, hash_type,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, hash_size, NULL, &generation);
+	if (status == hash_size) {
+		return 0;
+	}
+
 	/* Retrieve the certificate chain. */
 	status = spdm_get_certificate_list (key_manager, &cert_count, cert, &keys);
 	if (status != 0) {
 		goto exit;
 	}
 
-	hash_size = hash_get_hash_length (hash_type);
-	if (hash_size == HASH_ENGINE_UNKNOWN_HASH) {
-		status = HASH_ENGINE_UNKNOWN_HASH;
-		goto exit;
-	}
-
 	/* Hash the root cert. */
 	status = hash_calculate (hash_engine, hash_type, cert[0].cert, cert[0].length,
 		cert_chain.root_hash, hash_size);
@@ -1113,6 +1124,9 @@ static int spdm_get_certificate_chain_digest (struct riot_key_manager *key_manag
 	}
 	cancel_hash = false;
 
+	status = riot_key_manager_cache_digest (key_manager, 0, hash_type,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, hash_size, cert_count, generation);
+
 exit:
 	if (keys != NULL) {
 		riot_key_manager_release_riot_keys (key_manager, keys);
@@ -1207,6 +1221,57 @@ static void spdm_create_signing_context (struct spdm_state *state, uint8_t op_co
 	}
 }
 
+/**
+ * Generate the digest that gets signed for a SPDM response.  Since SPDM 1.2, a signing context is
+ * prepended to the message hash before signing.
+ *
+ * @param state SPDM state.
+ * @param hash_engine Hash engine.
+ * @param op_code SPDM response opcode.
+ * @param message_hash The message hash to be signed.
+ * @param hash_size The size in bytes of the message hash.
+ * @param digest Output for the digest to sign.  This will be the same length as the message hash.
+ *
+ * @return 0 if the digest was generated successfully, error code otherwise.
+ */
+static int spdm_get_signature_digest (struct spdm_state *state, struct hash_engine *hash_engine,
+	uint8_t op_code, const uint8_t *message_hash, size_t hash_size, uint8_t *digest)
+{
+	uint8_t spdm12_signing_context_with_hash[SPDM_VERSION_1_2_SIGNING_CONTEXT_SIZE +
+		HASH_MAX_HASH_LEN];
+	uint8_t spdm_version;
+	enum hash_type hash_type;
+	int status;
+
+	spdm_version = SPDM_MAKE_VERSION (state->connection_info.version.major_version,
+		state->connection_info.version.minor_version);
+
+	/* v1.2 (and greater) requires a signing context prepended to the hash. */
+	if (spdm_version > SPDM_VERSION_1_1) {
+		hash_type = spdm_get_hash_type (state->connection_info.peer_algorithms.base_hash_algo);
+
+		/* Create the signing context. */
+		spdm_create_signing_context (state, op_code, false,
+			(char*) spdm12_signing_context_with_hash);
+
+		/* Copy the hash to the signing context buffer. */
+		memcpy (&spdm12_signing_context_with_hash[SPDM_VERSION_1_2_SIGNING_CONTEXT_SIZE],
+			message_hash, hash_size);
+
+		/* Calculate the message hash as required by ECDSA. It may not be needed for other algos. */
+		status = hash_calculate (hash_engine, hash_type, spdm12_signing_context_with_hash,
+			SPDM_VERSION_1_2_SIGNING_CONTEXT_SIZE + hash_size, digest, hash_size);
+		if (ROT_IS_ERROR (status)) {
+			return status;
+		}
+	}
+	else {
+		memcpy (digest, message_hash, hash_size);
+	}
+
+	return 0;
+}
+
 /**
  * Generate a SPDM response signature.
  *
@@ -1227,23 +1292,14 @@ static int spdm_responder_data_sign (struct spdm_state *state, struct riot_key_m
 	const uint8_t *message_hash, size_t hash_size, uint8_t *signature, size_t sig_size)
 {
 	int status;
-	uint8_t *message;
-	size_t message_size;
 	uint8_t full_message_hash[HASH_MAX_HASH_LEN];
-	uint8_t spdm12_signing_context_with_hash[SPDM_VERSION_1_2_SIGNING_CONTEXT_SIZE +
-		HASH_MAX_HASH_LEN];
 	struct ecc_private_key alias_priv_key;
 	bool release_alias_key = false;
-	uint8_t spdm_version;
 	int sig_size_der;
 	uint8_t sig_der[ECC_DER_ECDSA_MAX_LENGTH];
 	uint32_t sig_r_component_size = sig_size >> 1;
-	enum hash_type hash_type;
 	const struct riot_keys *keys = NULL;
 
-	spdm_version = SPDM_MAKE_VERSION (state->connection_info.version.major_version,
-		state->connection_info.version.minor_version);
-	hash_type = spdm_get_hash_type (state->connection_info.peer_algorithms.base_hash_algo);
 	keys = riot_key_manager_get_riot_keys (key_manager);
 
 	/* Get the private key reference for the alias certificate. */
@@ -1260,36 +1316,15 @@ static int spdm_responder_data_sign (struct spdm_state *state, struct riot_key_m
 		goto exit;
 	}
 
-	/* v1.2 (and greater) requires a signing context prepended to the hash. */
-	if (spdm_version > SPDM_VERSION_1_1) {
-		/* Create the signing context. */
-		spdm_create_signing_context (state, op_code, false,
-			(char*) spdm12_signing_context_with_hash);
-
-		/* Copy the hash to the signing context buffer. */
-		memcpy (&spdm12_signing_context_with_hash[SPDM_VERSION_1_2_SIGNING_CONTEXT_SIZE],
-			message_hash, hash_size);
-
-		/* Assign message and message_size for signing. */
-		message = spdm12_signing_context_with_hash;
-		message_size = SPDM_VERSION_1_2_SIGNING_CONTEXT_SIZE + hash_size;
-
-		/* Calculate the message hash as required by ECDSA. It may not be needed for other algos. */
-		status = hash_calculate (hash_engine, hash_type, message, message_size, full_message_hash,
-			hash_size);
-		if (ROT_IS_ERROR (status)) {
-			goto exit;
-		}
-		status = 0;
-
-		/* Sign the full message hash. */
-		sig_size_der = ecc_engine->sign (ecc_engine, &alias_priv_key, full_message_hash, hash_size,
-			sig_der, sig_size_der);
-	}
-	else {
-		sig_size_der = ecc_engine->sign (ecc_engine, &alias_priv_key, message_hash, hash_size,
-			sig_der, sig_size_der);
+	status = spdm_get_signature_digest (state, hash_engine, op_code, message_hash, hash_size,
+		full_message_hash);
+	if (status != 0) {
+		goto exit;
 	}
+
+	/* Sign the full message hash. */
+	sig_size_der = ecc_engine->sign (ecc_engine, &alias_priv_key, full_message_hash, hash_size,
+		sig_der, sig_size_der);
 	if (ROT_IS_ERROR (sig_size_der)) {
 		status = sig_size_der;
 		goto exit;
@@ -1315,25 +1350,204 @@ exit:
 }
 
 /**
- * Generate the SPDM measurement signature.
+ * Update the longest time measured to generate a response signature.
  *
- * @param transcript_manager SPDM transcript manager.
  * @param state SPDM state.
- * @param key_manager RIoT device key manager.
- * @param ecc_engine ECC engine.
+ * @param sign_time_ms Time taken to generate a signature, in milliseconds.
+ */
+static void spdm_update_signature_time (struct spdm_state *state, uint32_t sign_time_ms)
+{
+	if (sign_time_ms > state->sign_time_ms) {
+		state->sign_time_ms = sign_time_ms;
+	}
+}
+
+/**
+ * Get the timing exponent that covers the longest time measured to generate a response signature.
+ * Timing exponents represent a duration of 2^exponent microseconds.
+ *
+ * @param state SPDM state.
+ * @param min_exponent The smallest exponent that should be reported.
+ *
+ * @return The timing exponent for signature generation.
+ */
+static uint8_t spdm_get_signature_time_exponent (const struct spdm_state *state,
+	uint8_t min_exponent)
+{
+	uint64_t sign_time_us = (uint64_t) state->sign_time_ms * 1000;
+	uint8_t exponent = min_exponent;
+
+	while ((exponent < SPDM_MAX_CT_EXPONENT) && ((1ULL << exponent) < sign_time_us)) {
+		exponent++;
+	}
+
+	return exponent;
+}
+
+/**
+ * Generate a ResponseNotReady error for the response that is waiting for a signature.  This is an
+ * expected condition, so no error is logged.
+ *
+ * @param spdm_responder SPDM responder instance.
+ * @param response The message to update with the error response.
+ */
+static void spdm_generate_response_not_ready (
+	const struct cmd_interface_spdm_responder *spdm_responder, struct cmd_interface_msg *response)
+{
+	const struct spdm_state *state = spdm_responder->state;
+	struct spdm_error_response *rsp = (struct spdm_error_response*) response->payload;
+	struct spdm_error_response_not_ready *not_ready =
+		(struct spdm_error_response_not_ready*) spdm_get_spdm_error_rsp_optional_data (rsp);
+
+	memset (rsp, 0, sizeof (*rsp) + sizeof (*not_ready));
+
+	spdm_populate_header (&rsp->header, SPDM_RESPONSE_ERROR,
+		state->connection_info.version.minor_version);
+	rsp->error_code = SPDM_ERROR_RESPONSE_NOT_READY;
+
+	/* Without any measurements of signing time, fall back to the cryptographic timeout. */
+	if (state->sign_time_ms != 0) {
+		not_ready->rdt_exponent = spdm_get_signature_time_exponent (state, 0);
+	}
+	else {
+		not_ready->rdt_exponent = spdm_responder->local_capabilities->ct_exponent;
+	}
+
+	not_ready->request_code = state->deferred.request_code;
+	not_ready->token = state->deferred.token;
+	not_ready->rdtm = SPDM_RESPONSE_NOT_READY_RDTM;
+
+	cmd_interface_msg_set_message_payload_length (response, sizeof (*rsp) + sizeof (*not_ready));
+}
+
+/**
+ * Start generating a response signature on the background task.  The response, without the
+ * signature, is saved until the requester retrieves it with RESPOND_IF_READY.
+ *
+ * @param spdm_responder SPDM responder instance.
+ * @param request The message containing the response that needs to be signed.
+ * @param hash_engine Hash engine.
+ * @param request_code SPDM request code that generated the response.
+ * @param op_code SPDM response opcode.
+ * @param message_hash The message hash to be signed.
+ * @param hash_size The size in bytes of the message hash.
+ * @param response_size Total length of the response, including the signature.
+ * @param signature_size Length of the signature at the end of the response.
+ *
+ * @return 0 if signature generation was started, error code otherwise.
+ */
+static int spdm_defer_response_signature (
+	const struct cmd_interface_spdm_responder *spdm_responder,
+	const struct cmd_interface_msg *request, struct hash_engine *hash_engine, uint8_t request_code,
+	uint8_t op_code, const uint8_t *message_hash, size_t hash_size, size_t response_size,
+	size_t signature_size)
+{
+	struct spdm_state *state = spdm_responder->state;
+	uint8_t digest[HASH_MAX_HASH_LEN];
+	int status;
+
+	status = spdm_get_signature_digest (state, hash_engine, op_code, message_hash, hash_size,
+		digest);
+	if (status != 0) {
+		return status;
+	}
+
+	status = spdm_responder->background->alias_sign_start (spdm_responder->background,
+		spdm_responder->ecc_engine, digest, hash_size);
+	if (status != 0) {
+		return status;
+	}
+
+	memcpy (spdm_responder->deferred_response, request->payload, response_size - signature_size);
+
+	state->deferred.request_code = request_code;
+	state->deferred.token++;
+	state->deferred.length = response_size;
+	state->deferred.signature_size = signature_size;
+	state->response_state = SPDM_RESPONSE_STATE_NOT_READY;
+
+	return 0;
+}
+
+/**
+ * Sign a response and set the final response length.  When the responder has a background task for
+ * signing, the signature is generated asynchronously and the response is replaced with a
+ * ResponseNotReady error.
+ *
+ * @param spdm_responder SPDM responder instance.
+ * @param request The message containing the response that needs to be signed.
+ * @param hash_engine Hash engine.
+ * @param request_code SPDM request code that generated the response.
+ * @param op_code SPDM response opcode.
+ * @param message_hash The message hash to be signed.
+ * @param hash_size The size in bytes of the message hash.
+ * @param response_size Total length of the response, including the signature.
+ * @param signature_size Length of the signature at the end of the response.
+ * @param in_session Flag indicating if the response is part of a secure session.  These responses
+ * are always signed immediately.
+ *
+ * @return 0 if the response was signed or deferred successfully, error code otherwise.
+ */
+static int spdm_responder_sign_response (const struct cmd_interface_spdm_responder *spdm_responder,
+	struct cmd_interface_msg *request, struct hash_engine *hash_engine, uint8_t request_code,
+	uint8_t op_code, const uint8_t *message_hash, size_t hash_size, size_t response_size,
+	size_t signature_size, bool in_session)
+{
+	struct spdm_state *state = spdm_responder->state;
+	platform_clock sign_start;
+	platform_clock sign_end;
+	int status;
+
+	if ((spdm_responder->background != NULL) && !in_session &&
+		((response_size - signature_size) <= spdm_responder->deferred_length)) {
+		status = spdm_defer_response_signature (spdm_responder, request, hash_engine, request_code,
+			op_code, message_hash, hash_size, response_size, signature_size);
+		if (status == 0) {
+			spdm_generate_response_not_ready (spdm_responder, request);
+
+			return 0;
+		}
+
+		/* The background task can't take the request, most likely because it is busy with another
+		 * operation.  Generate the signature now rather than failing the request. */
+	}
+
+	platform_init_current_tick (&sign_start);
+
+	status = spdm_responder_data_sign (state, spdm_responder->key_manager,
+		spdm_responder->ecc_engine, hash_engine, op_code, message_hash, hash_size,
+		&request->payload[response_size - signature_size], signature_size);
+	if (status != 0) {
+		return status;
+	}
+
+	platform_init_current_tick (&sign_end);
+	spdm_update_signature_time (state, platform_get_duration (&sign_start, &sign_end));
+
+	cmd_interface_msg_set_message_payload_length (request, response_size);
+
+	return 0;
+}
+
+/**
+ * Generate the SPDM measurement signature and set the final response length.
+ *
+ * @param spdm_responder SPDM responder instance.
+ * @param request The message containing the measurements response.
  * @param hash_engine Hash engine.
  * @param session Session information.
- * @param signature Buffer to store the signature.
+ * @param response_size Total length of the response, including the signature.
  * @param sig_size The size of the signature.
  *
  * @return 0 if signature is generated successfully, error code otherwise.
  */
 static int spdm_generate_measurement_signature (
-	const struct spdm_transcript_manager *transcript_manager, struct spdm_state *state,
-	struct riot_key_manager *key_manager, struct ecc_engine *ecc_engine,
-	struct hash_engine *hash_engine, struct spdm_secure_session *session_info, uint8_t *signature,
-	size_t sig_size)
+	const struct cmd_interface_spdm_responder *spdm_responder, struct cmd_interface_msg *request,
+	struct hash_engine *hash_engine, struct spdm_secure_session *session_info,
+	size_t response_size, size_t sig_size)
 {
+	const struct spdm_transcript_manager *transcript_manager = spdm_responder->transcript_manager;
+	struct spdm_state *state = spdm_responder->state;
 	int status;
 	uint8_t l1l2_hash[HASH_MAX_HASH_LEN];
 	int l1l2_hash_size;
@@ -1364,8 +1578,9 @@ static int spdm_generate_measurement_signature (
 	}
 
 	/* Sign the L1L2 hash. */
-	status = spdm_responder_data_sign (state, key_manager, ecc_engine, hash_engine,
-		SPDM_RESPONSE_GET_MEASUREMENTS, l1l2_hash, l1l2_hash_size, signature, sig_size);
+	status = spdm_responder_sign_response (spdm_responder, request, hash_engine,
+		SPDM_REQUEST_GET_MEASUREMENTS, SPDM_RESPONSE_GET_MEASUREMENTS, l1l2_hash, l1l2_hash_size,
+		response_size, sig_size, (session_info != NULL));
 	if (status != 0) {
 		goto exit;
 	}
@@ -1532,6 +1747,8 @@ int spdm_get_version (const struct cmd_interface_spdm_responder *spdm_responder,
 	struct spdm_state *state;
 	struct spdm_secure_session_manager *session_manager;
 	uint16_t minor_ver_in_error_msg;
+	uint32_t sign_time_ms;
+	uint16_t local_session_id;
 
 	if ((spdm_responder == NULL) || (request == NULL)) {
 		return CMD_HANDLER_SPDM_RESPONDER_INVALID_ARGUMENT;
@@ -1560,9 +1777,11 @@ int spdm_get_version (const struct cmd_interface_spdm_responder *spdm_responder,
 		goto exit;
 	}
 
-	/* Receiving a GET_VERSION resets the need to resynchronize. */
+	/* Receiving a GET_VERSION resets the need to resynchronize.  Any response waiting for a
+	 * signature is abandoned. */
 	if ((state->response_state == SPDM_RESPONSE_STATE_NEED_RESYNC) ||
-		(state->response_state == SPDM_RESPONSE_STATE_PROCESSING_ENCAP)) {
+		(state->response_state == SPDM_RESPONSE_STATE_PROCESSING_ENCAP) ||
+		(state->response_state == SPDM_RESPONSE_STATE_NOT_READY)) {
 		state->response_state = SPDM_RESPONSE_STATE_NORMAL;
 	}
 
@@ -1574,8 +1793,9 @@ int spdm_get_version (const struct cmd_interface_spdm_responder *spdm_responder,
 
 	/* Process the request. */
 
-	/* Reset transcript manager state. */
-	transcript_manager->reset (transcript_manager);
+	/* Reset the transcripts for the connection.  Session transcripts are reset when the session is
+	 * released. */
+	transcript_manager->reset_connection (transcript_manager);
 
 	/* Append request to VCA buffer. */
 	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_VCA,
@@ -1586,12 +1806,19 @@ int spdm_get_version (const struct cmd_interface_spdm_responder *spdm_responder,
 		goto exit;
 	}
 
-	/* Initialize the SPDM state. No error check as this function call cannot fail. */
+	/* Initialize the SPDM state. No error check as this function call cannot fail.  Signing time
+	 * is a property of the device rather than the connection, so it is retained.  Sessions created
+	 * for other requesters remain active, so local session IDs must keep advancing. */
+	sign_time_ms = state->sign_time_ms;
+	local_session_id = state->current_local_session_id;
 	spdm_init_state (state);
+	state->sign_time_ms = sign_time_ms;
+	state->current_local_session_id = local_session_id;
+	state->connection_info.peer_eid = request->source_eid;
 
-	/* Reset any in-progress session(s). */
+	/* Release any session(s) previously created by this requester. */
 	if (session_manager) {
-		session_manager->reset (session_manager);
+		session_manager->release_peer_sessions (session_manager, request->source_eid);
 	}
 
 	/* Contruct the response. */
@@ -1826,7 +2053,9 @@ int spdm_get_capabilities (const struct cmd_interface_spdm_responder *spdm_respo
 	req_resp->base_capabilities.reserved3 = 0;
 	req_resp->base_capabilities.reserved4 = 0;
 
-	req_resp->base_capabilities.ct_exponent = local_capabilities->ct_exponent;
+	/* Cryptographic timeout must cover the time it takes to generate response signatures. */
+	req_resp->base_capabilities.ct_exponent =
+		spdm_get_signature_time_exponent (state, local_capabilities->ct_exponent);
 	req_resp->base_capabilities.flags = local_capabilities->flags;
 
 	if (spdm_version >= SPDM_VERSION_1_2) {
@@ -2179,7 +2408,7 @@ int spdm_negotiate_algorithms (const struct cmd_interface_spdm_responder *spdm_r
 	struct spdm_algorithm_request *algstruct_table;
 	size_t i_algstruct;
 	uint8_t spdm_version;
-	uint8_t alg_type_pre;
+	uint8_t alg_type_pre = 0;
 	uint16_t ext_alg_total_count = 0;
 	size_t request_size;
 	const struct spdm_transcript_manager *transcript_manager;
@@ -2980,7 +3209,6 @@ int spdm_challenge (const struct cmd_interface_spdm_responder *spdm_responder,
 	struct hash_engine *hash_engine;
 	struct riot_key_manager *key_manager;
 	struct rng_engine *rng_engine;
-	struct ecc_engine *ecc_engine;
 	enum hash_type hash_type;
 	int hash_size;
 	size_t signature_size;
@@ -3001,7 +3229,6 @@ int spdm_challenge (const struct cmd_interface_spdm_responder *spdm_responder,
 	state = spdm_responder->state;
 	local_capabilities = spdm_responder->local_capabilities;
 	key_manager = spdm_responder->key_manager;
-	ecc_engine = spdm_responder->ecc_engine;
 	hash_engine = spdm_responder->hash_engine[0];
 	hash_type = spdm_get_hash_type (state->connection_info.peer_algorithms.base_hash_algo);
 	measurements = spdm_responder->measurements;
@@ -3049,8 +3276,6 @@ int spdm_challenge (const struct cmd_interface_spdm_responder *spdm_responder,
 
 	/* Verify SPDM state. */
 	if (state->response_state != SPDM_RESPONSE_STATE_NORMAL) {
-		/* [TODO] Handle RESPOND_IF_READY condition when supported. */
-
 		spdm_handle_response_state (state, &spdm_error);
 		status = CMD_HANDLER_SPDM_RESPONDER_INTERNAL_ERROR;
 		goto exit;
@@ -3171,16 +3396,14 @@ int spdm_challenge (const struct cmd_interface_spdm_responder *spdm_responder,
 	}
 
 	/* Sign the M1 hash. */
-	status = spdm_responder_data_sign (state, key_manager, ecc_engine, hash_engine,
-		SPDM_RESPONSE_CHALLENGE, m1_hash, hash_size, response_ptr, signature_size);
+	status = spdm_responder_sign_response (spdm_responder, request, hash_engine,
+		SPDM_REQUEST_CHALLENGE, SPDM_RESPONSE_CHALLENGE, m1_hash, hash_size, response_size,
+		signature_size, false);
 	if (status != 0) {
 		spdm_error = SPDM_ERROR_UNSPECIFIED;
 		goto exit;
 	}
 
-	/* Set the payload length. */
-	cmd_interface_msg_set_message_payload_length (request, response_size);
-
 exit:
 	if (status != 0) {
 		spdm_generate_error_response (request, state->connection_info.version.minor_version,
@@ -3339,8 +3562,6 @@ int spdm_get_measurements (const struct cmd_interface_spdm_responder *spdm_respo
 
 	/* Verify SPDM state. */
 	if (state->response_state != SPDM_RESPONSE_STATE_NORMAL) {
-		/* [TODO] Handle RESPOND_IF_READY condition when supported. */
-
 		spdm_handle_response_state (state, &spdm_error);
 		status = CMD_HANDLER_SPDM_RESPONDER_INTERNAL_ERROR;
 		goto exit;
@@ -3501,17 +3722,17 @@ int spdm_get_measurements (const struct cmd_interface_spdm_responder *spdm_respo
 
 	/* Generate the signature, if requested. */
 	if (signature_requested == true) {
-		status = spdm_generate_measurement_signature (transcript_manager, state,
-			spdm_responder->key_manager, spdm_responder->ecc_engine, hash_engine, session,
-			spdm_get_measurements_resp_signature (spdm_response), signature_size);
+		status = spdm_generate_measurement_signature (spdm_responder, request, hash_engine, session,
+			response_size, signature_size);
 		if (status != 0) {
 			spdm_error = SPDM_ERROR_UNSPECIFIED;
 			goto exit;
 		}
 	}
-
-	/* Set the payload length. */
-	cmd_interface_msg_set_message_payload_length (request, response_size);
+	else {
+		/* Set the payload length. */
+		cmd_interface_msg_set_message_payload_length (request, response_size);
+	}
 
 exit:
 	if (status != 0) {
@@ -3617,6 +3838,123 @@ int spdm_process_get_measurements_response (struct cmd_interface_msg *response)
 	return 0;
 }
 
+/**
+ * Process the SPDM RESPOND_IF_READY request.  This provides a response that was deferred while its
+ * signature was being generated in the background.
+ *
+ * @param spdm_responder SPDM responder instance.
+ * @param request RESPOND_IF_READY request to process.
+ *
+ * @return 0 if request was processed successfully, or an error code.
+ */
+int spdm_respond_if_ready (const struct cmd_interface_spdm_responder *spdm_responder,
+	struct cmd_interface_msg *request)
+{
+	int status;
+	int spdm_error;
+	const struct spdm_respond_if_ready_request *spdm_request;
+	struct spdm_state *state;
+	const struct cmd_background *background;
+	uint8_t sig_der[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_der_length = sizeof (sig_der);
+	uint32_t sign_status;
+	uint32_t sign_time = 0;
+	size_t unsigned_length;
+	uint8_t *signature;
+	size_t sig_r_component_size;
+
+	if ((spdm_responder == NULL) || (request == NULL)) {
+		return CMD_HANDLER_SPDM_RESPONDER_INVALID_ARGUMENT;
+	}
+
+	state = spdm_responder->state;
+	background = spdm_responder->background;
+
+	/* Validate the request. */
+	if (request->payload_length < sizeof (struct spdm_respond_if_ready_request)) {
+		status = CMD_HANDLER_SPDM_RESPONDER_INVALID_REQUEST;
+		spdm_error = SPDM_ERROR_INVALID_REQUEST;
+		goto exit;
+	}
+	spdm_request = (const struct spdm_respond_if_ready_request*) request->payload;
+	if (SPDM_MAKE_VERSION (spdm_request->header.spdm_major_version,
+		spdm_request->header.spdm_minor_version) != spdm_get_connection_version (state)) {
+		status = CMD_HANDLER_SPDM_RESPONDER_VERSION_MISMATCH;
+		spdm_error = SPDM_ERROR_VERSION_MISMATCH;
+		goto exit;
+	}
+
+	/* Verify SPDM state.  There must be a response waiting for a signature. */
+	if ((state->response_state != SPDM_RESPONSE_STATE_NOT_READY) || (background == NULL)) {
+		status = CMD_HANDLER_SPDM_RESPONDER_UNEXPECTED_REQUEST;
+		spdm_error = SPDM_ERROR_UNEXPECTED_REQUEST;
+		goto exit;
+	}
+
+	if ((spdm_request->original_request_code != state->deferred.request_code) ||
+		(spdm_request->token != state->deferred.token)) {
+		status = CMD_HANDLER_SPDM_RESPONDER_INVALID_REQUEST;
+		spdm_error = SPDM_ERROR_INVALID_REQUEST;
+		goto exit;
+	}
+
+	status = background->alias_sign_result (background, sig_der, &sig_der_length, &sign_status,
+		&sign_time);
+	if (status != 0) {
+		spdm_error = SPDM_ERROR_UNSPECIFIED;
+		goto complete;
+	}
+
+	if ((sign_status & 0xff) == CMD_BACKGROUND_SIGN_STATUS_RUNNING) {
+		spdm_generate_response_not_ready (spdm_responder, request);
+
+		return 0;
+	}
+	else if ((sign_status & 0xff) != CMD_BACKGROUND_SIGN_STATUS_SUCCESS) {
+		status = CMD_HANDLER_SPDM_RESPONDER_INTERNAL_ERROR;
+		spdm_error = SPDM_ERROR_UNSPECIFIED;
+		goto complete;
+	}
+
+	if (cmd_interface_msg_get_max_response (request) < state->deferred.length) {
+		status = CMD_HANDLER_SPDM_RESPONDER_RESPONSE_TOO_LARGE;
+		spdm_error = SPDM_ERROR_UNSPECIFIED;
+		goto complete;
+	}
+
+	/* Construct the original response with the signature. */
+	unsigned_length = state->deferred.length - state->deferred.signature_size;
+	memcpy (request->payload, spdm_responder->deferred_response, unsigned_length);
+
+	signature = &request->payload[unsigned_length];
+	sig_r_component_size = state->deferred.signature_size >> 1;
+
+	/* Convert signature from DER encoding to <r,s> format. */
+	status = ecc_der_decode_ecdsa_signature (sig_der, sig_der_length, signature,
+		&signature[sig_r_component_size], sig_r_component_size);
+	if (status != 0) {
+		spdm_error = SPDM_ERROR_UNSPECIFIED;
+		goto complete;
+	}
+
+	spdm_update_signature_time (state, sign_time);
+	cmd_interface_msg_set_message_payload_length (request, state->deferred.length);
+
+complete:
+	/* The deferred response is no longer available, whether or not it was successfully generated.
+	 * The token is not reset so the next deferred response will use a different value. */
+	state->deferred.request_code = 0;
+	state->response_state = SPDM_RESPONSE_STATE_NORMAL;
+
+exit:
+	if (status != 0) {
+		spdm_generate_error_response (request, state->connection_info.version.minor_version,
+			spdm_error, 0x00, NULL, 0, SPDM_REQUEST_RESPOND_IF_READY, status);
+	}
+
+	return 0;
+}
+
 /**
  * Construct SPDM respond if ready request.
  *
@@ -26,6 +26,15 @@
 #define SPDM_MAX_CT_EXPONENT						31
 #endif
 
+/**
+ * Multiplier reported in ResponseNotReady errors that indicates how long a deferred response will
+ * remain available to the requester, relative to the expected response time, as described in the
+ * ERROR response section of the DSP0274 SPDM spec.
+ */
+#ifndef SPDM_RESPONSE_NOT_READY_RDTM
+#define SPDM_RESPONSE_NOT_READY_RDTM				8
+#endif
+
 /**
  * Capabilities of SPDM requester. Capabilities described in section 10.3 in DSP0274 SPDM spec.
  */
@@ -1298,6 +1307,7 @@ struct spdm_connection_info {
 	 * This is a sticky bit wherein if it is set to 1 then it cannot be set to 0.
 	 */
 	struct spdm_end_session_request_attributes end_session_attributes;
+	uint8_t peer_eid;									/**< EID of the peer that started the connection. */
 };
 
 /**
@@ -1312,6 +1322,16 @@ enum spdm_response_state {
 	SPDM_RESPONSE_STATE_MAX,				/**< MAX */
 };
 
+/**
+ * A response that is waiting for its signature to be generated in the background.
+ */
+struct spdm_deferred_response {
+	uint8_t request_code;	/**< Request code for the deferred response. */
+	uint8_t token;			/**< Token provided to the requester for retrieving the response. */
+	size_t length;			/**< Total length of the response, including the signature. */
+	size_t signature_size;	/**< Length of the signature at the end of the response. */
+};
+
 /**
  * SPDM context for a requester/responder.
  */
@@ -1321,6 +1341,8 @@ struct spdm_state {
 	uint64_t max_spdm_session_sequence_number;		/**< Max SPDM session sequence number. */
 	uint16_t current_local_session_id;				/**< Current local session Id. */
 	uint8_t handle_error_return_policy;				/**< Handle error return policy. */
+	struct spdm_deferred_response deferred;			/**< Response waiting for a signature. */
+	uint32_t sign_time_ms;							/**< Longest time measured to generate a response signature. */
 };
 
 /* TODO:  This is a temporary work-around in the absence of a SPDM connection handler that is
@@ -1383,6 +1405,8 @@ int spdm_generate_get_measurements_request (uint8_t *buf, size_t buf_len, uint8_
 	uint8_t spdm_minor_version);
 int spdm_process_get_measurements_response (struct cmd_interface_msg *response);
 
+int spdm_respond_if_ready (const struct cmd_interface_spdm_responder *spdm_responder,
+	struct cmd_interface_msg *request);
 int spdm_generate_respond_if_ready_request (uint8_t *buf, size_t buf_len,
 	uint8_t original_request_code, uint8_t token, uint8_t spdm_minor_version);
 
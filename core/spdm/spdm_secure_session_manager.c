@@ -6,6 +6,263 @@
 #include "common/unused.h"
 #include "crypto/kdf.h"
 
+
+/* Session lookup entries are 8-bit values offset by one from the session index. */
+_Static_assert (SPDM_MAX_SESSION_COUNT < UINT8_MAX, "Too many SPDM sessions for session lookup");
+_Static_assert (SPDM_SECURE_SESSION_MANAGER_LOOKUP_BUCKETS > 0, "No SPDM session lookup buckets");
+
+
+/**
+ * Get the lookup bucket for a session ID.
+ *
+ * @param session_id SPDM Session Id.
+ *
+ * @return The bucket that contains the session.
+ */
+static size_t spdm_secure_session_manager_get_lookup_bucket (uint32_t session_id)
+{
+	/* Responder session IDs are assigned sequentially, so combining both halves of the ID spreads
+	 * sessions from the same or different requesters evenly across the buckets. */
+	return (GET_REQUEST_SESSION_ID (session_id) ^ GET_RESPONSE_SESSION_ID (session_id)) %
+		SPDM_SECURE_SESSION_MANAGER_LOOKUP_BUCKETS;
+}
+
+/**
+ * Find the index of an active session.
+ *
+ * @param state Session manager state.
+ * @param session_id SPDM Session Id to find.
+ *
+ * @return The index of the session or SPDM_MAX_SESSION_COUNT if there is no session with the ID.
+ */
+static size_t spdm_secure_session_manager_find_session (
+	const struct spdm_secure_session_manager_state *state, uint32_t session_id)
+{
+	uint8_t entry;
+
+	entry = state->lookup[spdm_secure_session_manager_get_lookup_bucket (session_id)];
+	while (entry != 0) {
+		if (state->sessions[entry - 1].session_id == session_id) {
+			return entry - 1;
+		}
+
+		entry = state->lookup_next[entry - 1];
+	}
+
+	return SPDM_MAX_SESSION_COUNT;
+}
+
+/**
+ * Add a session to the session lookup table.
+ *
+ * @param state Session manager state.
+ * @param session_index Index of the session to add.  The session ID must already be assigned.
+ */
+static void spdm_secure_session_manager_add_lookup (struct spdm_secure_session_manager_state *state,
+	size_t session_index)
+{
+	size_t bucket = spdm_secure_session_manager_get_lookup_bucket (
+		state->sessions[session_index].session_id);
+
+	state->lookup_next[session_index] = state->lookup[bucket];
+	state->lookup[bucket] = session_index + 1;
+}
+
+/**
+ * Remove a session from the session lookup table.
+ *
+ * @param state Session manager state.
+ * @param session_index Index of the session to remove.  The session ID must still be assigned.
+ */
+static void spdm_secure_session_manager_remove_lookup (
+	struct spdm_secure_session_manager_state *state, size_t session_index)
+{
+	uint8_t *entry;
+
+	entry = &state->lookup[spdm_secure_session_manager_get_lookup_bucket (
+		state->sessions[session_index].session_id)];
+	while (*entry != 0) {
+		if (*entry == (session_index + 1)) {
+			*entry = state->lookup_next[session_index];
+			state->lookup_next[session_index] = 0;
+
+			return;
+		}
+
+		entry = &state->lookup_next[*entry - 1];
+	}
+}
+
+/**
+ * Record activity on a session.  This determines the order in which idle sessions get reclaimed.
+ *
+ * @param state Session manager state.
+ * @param session The session that was used.
+ */
+static void spdm_secure_session_manager_mark_activity (
+	struct spdm_secure_session_manager_state *state, struct spdm_secure_session *session)
+{
+	session->last_activity = ++state->activity_count;
+
+#if (SPDM_SECURE_SESSION_MANAGER_IDLE_TIMEOUT_MS != 0)
+	platform_init_current_tick (&session->last_activity_time);
+#endif
+}
+
+/**
+ * Discard any session keys held by dedicated AES engines.  This must be called before the session
+ * keys stored in a block of session memory are changed or cleared.
+ *
+ * @param session_manager Session Manager.
+ * @param secrets Start of the session memory containing the keys to discard.
+ * @param length Length of the session memory.
+ */
+static void spdm_secure_session_manager_evict_keys (
+	const struct spdm_secure_session_manager *session_manager, const void *secrets, size_t length)
+{
+	struct spdm_secure_session_key_cache_entry *entry;
+	const uint8_t *start = secrets;
+	size_t index;
+
+	for (index = 0; index < session_manager->key_cache_count; index++) {
+		entry = &session_manager->state->key_cache[index];
+
+		if ((entry->key != NULL) && (entry->key >= start) && (entry->key < (start + length))) {
+			entry->key = NULL;
+		}
+	}
+}
+
+/**
+ * Get an AES engine loaded with a session key.  If there are AES engines dedicated to session keys,
+ * an engine that already holds the key will be used without loading the key again.  Otherwise, the
+ * key is loaded into the engine that has been unused for the longest time.  Without dedicated
+ * engines, the key is always loaded into the shared AES engine.
+ *
+ * @param session_manager Session Manager.
+ * @param key The session key.  This must point to the key in session memory.
+ * @param key_length Length of the key.
+ * @param aes_engine Output for the AES engine loaded with the key.
+ *
+ * @return 0 if an AES engine was loaded with the key or an error code.
+ */
+static int spdm_secure_session_manager_load_key (
+	const struct spdm_secure_session_manager *session_manager, const uint8_t *key,
+	size_t key_length, struct aes_engine **aes_engine)
+{
+	struct spdm_secure_session_manager_state *state = session_manager->state;
+	struct spdm_secure_session_key_cache_entry *entry;
+	size_t oldest = 0;
+	size_t index;
+	int status;
+
+	if (session_manager->key_cache_count == 0) {
+		*aes_engine = session_manager->aes_engine;
+		state->key_load_count++;
+
+		return session_manager->aes_engine->set_key (session_manager->aes_engine, key, key_length);
+	}
+
+	for (index = 0; index < session_manager->key_cache_count; index++) {
+		entry = &state->key_cache[index];
+
+		if (entry->key == key) {
+			entry->last_use = ++state->key_cache_use_count;
+			state->key_cache_hit_count++;
+			*aes_engine = session_manager->key_cache[index];
+
+			return 0;
+		}
+
+		/* Prefer an unused engine.  The difference is used so the age stays correct when the use
+		 * count wraps. */
+		if ((state->key_cache[oldest].key != NULL) && ((entry->key == NULL) ||
+			((state->key_cache_use_count - entry->last_use) >
+				(state->key_cache_use_count - state->key_cache[oldest].last_use)))) {
+			oldest = index;
+		}
+	}
+
+	entry = &state->key_cache[oldest];
+	entry->key = NULL;
+
+	status = session_manager->key_cache[oldest]->set_key (session_manager->key_cache[oldest], key,
+		key_length);
+	if (status != 0) {
+		return status;
+	}
+
+	entry->key = key;
+	entry->last_use = ++state->key_cache_use_count;
+	state->key_load_count++;
+	*aes_engine = session_manager->key_cache[oldest];
+
+	return 0;
+}
+
+/**
+ * Release the session that has been idle for the longest time to make room for a new session.  The
+ * session for the last secure message is never released, since that message is still being
+ * processed.  Established sessions are only released after being idle for the configured timeout,
+ * so new key exchanges can't displace sessions that are in use.
+ *
+ * @param session_manager Session Manager.
+ *
+ * @return true if a session was released or false if no session could be released.
+ */
+static bool spdm_secure_session_manager_reclaim_idle_session (
+	const struct spdm_secure_session_manager *session_manager)
+{
+	struct spdm_secure_session_manager_state *state = session_manager->state;
+	struct spdm_secure_session *session;
+	struct spdm_secure_session *idle = NULL;
+	uint32_t idle_time = 0;
+#if (SPDM_SECURE_SESSION_MANAGER_IDLE_TIMEOUT_MS != 0)
+	platform_clock now;
+#endif
+	size_t index;
+
+#if (SPDM_SECURE_SESSION_MANAGER_IDLE_TIMEOUT_MS != 0)
+	platform_init_current_tick (&now);
+#endif
+
+	for (index = 0; index < SPDM_MAX_SESSION_COUNT; index++) {
+		session = &state->sessions[index];
+
+		if ((session->session_id == SPDM_INVALID_SESSION_ID) ||
+			(state->last_spdm_request_secure_session_id_valid &&
+			(session->session_id == state->last_spdm_request_secure_session_id))) {
+			continue;
+		}
+
+		if (session->session_state == SPDM_SESSION_STATE_ESTABLISHED) {
+#if (SPDM_SECURE_SESSION_MANAGER_IDLE_TIMEOUT_MS != 0)
+			if (platform_get_duration (&session->last_activity_time, &now) <
+				SPDM_SECURE_SESSION_MANAGER_IDLE_TIMEOUT_MS) {
+				continue;
+			}
+#else
+			continue;
+#endif
+		}
+
+		/* The difference is used so idle times stay correct when the activity count wraps. */
+		if ((idle == NULL) || ((state->activity_count - session->last_activity) > idle_time)) {
+			idle = session;
+			idle_time = state->activity_count - idle->last_activity;
+		}
+	}
+
+	if (idle == NULL) {
+		return false;
+	}
+
+	session_manager->release_session (session_manager, idle->session_id);
+	state->reclaimed_session_count++;
+
+	return true;
+}
+
 /**
  * Initialize a secure session's state.
  *
@@ -43,6 +300,8 @@ static void spdm_secure_session_manager_init_session_state (
 		session_type = SPDM_SESSION_TYPE_NONE;
 	}
 
+	spdm_secure_session_manager_evict_keys (session_manager, session,
+		sizeof (struct spdm_secure_session));
 	memset (session, 0, sizeof (struct spdm_secure_session));
 
 	/* Reset the session transcipt for TH hash. */
@@ -65,28 +324,33 @@ static void spdm_secure_session_manager_init_session_state (
 	session->aead_iv_size = spdm_get_aead_iv_size (session->aead_cipher_suite);
 	session->aead_tag_size = spdm_get_aead_tag_size (session->aead_cipher_suite);
 	session->peer_capabilities = connection_info->peer_capabilities;
+	session->connection_info = *connection_info;
 }
 
 struct spdm_secure_session* spdm_secure_session_manager_create_session (
 	const struct spdm_secure_session_manager *session_manager, uint32_t session_id,
 	bool is_requester, const struct spdm_connection_info *connection_info)
 {
+	struct spdm_secure_session_manager_state *state;
 	struct spdm_secure_session *sessions;
-	uint8_t index;
+	size_t index;
 
 	if ((session_manager == NULL) || (session_id == SPDM_INVALID_SESSION_ID) ||
-		(connection_info == NULL) ||
-		(session_manager->state->current_session_count >= SPDM_MAX_SESSION_COUNT)) {
+		(connection_info == NULL)) {
 		return NULL;
 	}
 
-	sessions = session_manager->state->sessions;
+	state = session_manager->state;
+	sessions = state->sessions;
 
 	/* Check if the session exists. */
-	for (index = 0; index < SPDM_MAX_SESSION_COUNT; index++) {
-		if (sessions[index].session_id == session_id) {
-			return NULL;
-		}
+	if (spdm_secure_session_manager_find_session (state, session_id) < SPDM_MAX_SESSION_COUNT) {
+		return NULL;
+	}
+
+	if ((state->current_session_count >= SPDM_MAX_SESSION_COUNT) &&
+		!spdm_secure_session_manager_reclaim_idle_session (session_manager)) {
+		return NULL;
 	}
 
 	/* Initialize a session. */
@@ -94,8 +358,13 @@ struct spdm_secure_session* spdm_secure_session_manager_create_session (
 		if (sessions[index].session_id == SPDM_INVALID_SESSION_ID) {
 			spdm_secure_session_manager_init_session_state (session_manager, index, session_id,
 				is_requester, connection_info);
+			spdm_secure_session_manager_add_lookup (state, index);
+			spdm_secure_session_manager_mark_activity (state, &sessions[index]);
 
-			session_manager->state->current_session_count++;
+			state->current_session_count++;
+			if (state->current_session_count > state->peak_session_count) {
+				state->peak_session_count = state->current_session_count;
+			}
 
 			return &sessions[index];
 		}
@@ -107,7 +376,7 @@ struct spdm_secure_session* spdm_secure_session_manager_create_session (
 void spdm_secure_session_manager_release_session (
 	const struct spdm_secure_session_manager *session_manager, uint32_t session_id)
 {
-	struct spdm_secure_session *sessions;
+	struct spdm_secure_session_manager_state *state;
 	const struct spdm_transcript_manager *transcript_manager;
 	size_t session_index;
 
@@ -115,17 +384,17 @@ void spdm_secure_session_manager_release_session (
 		return;
 	}
 
-	sessions = session_manager->state->sessions;
+	state = session_manager->state;
 	transcript_manager = session_manager->transcript_manager;
 
-	for (session_index = 0; session_index < SPDM_MAX_SESSION_COUNT; session_index++) {
-		if (sessions[session_index].session_id == session_id) {
-			memset (&sessions[session_index], 0, sizeof (struct spdm_secure_session));
-			transcript_manager->reset_session_transcript (transcript_manager, session_index);
-			session_manager->state->current_session_count--;
-
-			return;
-		}
+	session_index = spdm_secure_session_manager_find_session (state, session_id);
+	if (session_index < SPDM_MAX_SESSION_COUNT) {
+		spdm_secure_session_manager_remove_lookup (state, session_index);
+		spdm_secure_session_manager_evict_keys (session_manager, &state->sessions[session_index],
+			sizeof (struct spdm_secure_session));
+		memset (&state->sessions[session_index], 0, sizeof (struct spdm_secure_session));
+		transcript_manager->reset_session_transcript (transcript_manager, session_index);
+		state->current_session_count--;
 	}
 }
 
@@ -175,6 +444,8 @@ void spdm_secure_session_manager_set_session_state (
 
 		/* Session handshake keys should be zeroized after the handshake phase. */
 		if (session_state == SPDM_SESSION_STATE_ESTABLISHED) {
+			spdm_secure_session_manager_evict_keys (session_manager, &session->handshake_secret,
+				sizeof (session->handshake_secret));
 			spdm_secure_session_clear_handshake_secret (session);
 			spdm_secure_session_clear_master_secret (session);
 		}
@@ -192,7 +463,8 @@ void spdm_secure_session_manager_reset (const struct spdm_secure_session_manager
 
 	sessions = session_manager->state->sessions;
 
-	/* Release all sessions. */
+	/* Release all sessions.  Releasing the sessions also clears the session lookup table and any
+	 * loaded session keys, so only the usage statistics remain. */
 	for (session_index = 0; session_index < SPDM_MAX_SESSION_COUNT; session_index++) {
 		if (sessions[session_index].session_id != SPDM_INVALID_SESSION_ID) {
 			spdm_secure_session_manager_release_session (session_manager,
@@ -200,28 +472,51 @@ void spdm_secure_session_manager_reset (const struct spdm_secure_session_manager
 		}
 	}
 
-	/* Reset the state. */
-	memset (session_manager->state, 0, sizeof (struct spdm_secure_session_manager_state));
+	session_manager->state->last_spdm_request_secure_session_id = SPDM_INVALID_SESSION_ID;
+	session_manager->state->last_spdm_request_secure_session_id_valid = false;
+}
+
+void spdm_secure_session_manager_release_peer_sessions (
+	const struct spdm_secure_session_manager *session_manager, uint8_t peer_eid)
+{
+	struct spdm_secure_session_manager_state *state;
+	size_t session_index;
+
+	if (session_manager == NULL) {
+		return;
+	}
+
+	state = session_manager->state;
+
+	for (session_index = 0; session_index < SPDM_MAX_SESSION_COUNT; session_index++) {
+		if ((state->sessions[session_index].session_id != SPDM_INVALID_SESSION_ID) &&
+			(state->sessions[session_index].connection_info.peer_eid == peer_eid)) {
+			if (state->last_spdm_request_secure_session_id ==
+				state->sessions[session_index].session_id) {
+				state->last_spdm_request_secure_session_id_valid = false;
+			}
+
+			spdm_secure_session_manager_release_session (session_manager,
+				state->sessions[session_index].session_id);
+		}
+	}
 }
 
 struct spdm_secure_session* spdm_secure_session_manager_get_session (
 	const struct spdm_secure_session_manager *session_manager, uint32_t session_id)
 {
-	struct spdm_secure_session *sessions;
 	size_t index;
 
 	if ((session_manager == NULL) || (session_id == SPDM_INVALID_SESSION_ID)) {
 		return NULL;
 	}
 
-	sessions = (struct spdm_secure_session*) session_manager->state->sessions;
-	for (index = 0; index < SPDM_MAX_SESSION_COUNT; index++) {
-		if (sessions[index].session_id == session_id) {
-			return &sessions[index];
-		}
+	index = spdm_secure_session_manager_find_session (session_manager->state, session_id);
+	if (index >= SPDM_MAX_SESSION_COUNT) {
+		return NULL;
 	}
 
-	return NULL;
+	return &session_manager->state->sessions[index];
 }
 
 int spdm_secure_session_manager_generate_shared_secret (
@@ -484,6 +779,9 @@ int spdm_secure_session_manager_generate_session_handshake_keys (
 	hash_engine = session_manager->hash_engine;
 	hash_size = session->hash_size;
 
+	spdm_secure_session_manager_evict_keys (session_manager, &session->handshake_secret,
+		sizeof (session->handshake_secret));
+
 	/* Step 1: Get the TH hash; do not complete the hash context as it is needed later. */
 	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, false,
 		true, session->session_index, th1_hash, hash_size);
@@ -621,6 +919,9 @@ int spdm_secure_session_manager_generate_session_data_keys (
 	hash_engine = session_manager->hash_engine;
 	transcript_manager = session_manager->transcript_manager;
 
+	spdm_secure_session_manager_evict_keys (session_manager, &session->data_secret,
+		sizeof (session->data_secret));
+
 	/* Derive salt1 key. */
 	bin_str0_size = sizeof (bin_str0);
 	spdm_secure_session_manager_bin_concat (session->version, SPDM_BIN_STR_0_LABEL,
@@ -745,7 +1046,7 @@ static void spdm_secure_session_manager_generate_iv (uint64_t sequence_number, u
  * @param request The request message to decrypt.
  * @param sequence_number The sequence number.
  * @param sequence_num_in_header_size The size of the sequence number in the message header.
- * @param key The AEAD key.
+ * @param key The AEAD key in session memory.
  * @param salt The AEAD salt.
  * @param iv The AEAD IV.
  *
@@ -777,7 +1078,6 @@ int spdm_secure_session_manager_decrypt_message (
 	aead_tag_size = session->aead_tag_size;
 	aead_key_size = session->aead_key_size;
 	aead_iv_size = session->aead_iv_size;
-	aes_engine = session_manager->aes_engine;
 
 	record_header_size = sizeof (struct spdm_secured_message_data_header_1) +
 		sequence_num_in_header_size + sizeof (struct spdm_secured_message_data_header_2);
@@ -809,7 +1109,8 @@ int spdm_secure_session_manager_decrypt_message (
 	tag = (const uint8_t*) record_header_1 + record_header_size + ciphertext_size;
 	add_data = (const uint8_t*) record_header_1;	/* Header is also included in MAC calculation. */
 
-	status = aes_engine->set_key (aes_engine, key, aead_key_size);
+	status = spdm_secure_session_manager_load_key (session_manager, key, aead_key_size,
+		&aes_engine);
 	if (status != 0) {
 		goto exit;
 	}
@@ -939,6 +1240,11 @@ int spdm_secure_session_manager_decode_secure_message (
 	session_manager_state->last_spdm_request_secure_session_id = session->session_id;
 	session_manager_state->last_spdm_request_secure_session_id_valid = true;
 
+	/* Only authenticated messages keep a session from being reclaimed. */
+	if (status == 0) {
+		spdm_secure_session_manager_mark_activity (session_manager_state, session);
+	}
+
 exit:
 
 	return status;
@@ -951,7 +1257,7 @@ exit:
  * @param session The SPDM session.
  * @param request The message to encrypt.
  * @param sequence_num_in_header_size The size of the sequence number in the message header.
- * @param key The AEAD key.
+ * @param key The AEAD key in session memory.
  * @param iv The AEAD IV.
  *
  * @return 0 if the message is encrypted, error code otherwise.
@@ -981,7 +1287,6 @@ static int spdm_secure_session_manager_encrypt_message (
 	aead_tag_size = session->aead_tag_size;
 	aead_key_size = session->aead_key_size;
 	aead_iv_size = session->aead_iv_size;
-	aes_engine = session_manager->aes_engine;
 
 	record_header_size = sizeof (struct spdm_secured_message_data_header_1) +
 		sequence_num_in_header_size +
@@ -1017,8 +1322,8 @@ static int spdm_secure_session_manager_encrypt_message (
 	tag = (uint8_t*) record_header_1 + record_header_size + plaintext_size;
 	add_data = (uint8_t*) record_header_1;
 
-	/* Set the encryption key. */
-	status = aes_engine->set_key (aes_engine, key, aead_key_size);
+	status = spdm_secure_session_manager_load_key (session_manager, key, aead_key_size,
+		&aes_engine);
 	if (status != 0) {
 		goto exit;
 	}
@@ -1190,6 +1495,7 @@ int spdm_secure_session_manager_init (struct spdm_secure_session_manager *sessio
 	session_manager->release_session = spdm_secure_session_manager_release_session;
 	session_manager->set_session_state = spdm_secure_session_manager_set_session_state;
 	session_manager->reset = spdm_secure_session_manager_reset;
+	session_manager->release_peer_sessions = spdm_secure_session_manager_release_peer_sessions;
 	session_manager->get_session = spdm_secure_session_manager_get_session;
 	session_manager->generate_shared_secret = spdm_secure_session_manager_generate_shared_secret;
 	session_manager->generate_session_handshake_keys =
@@ -1256,3 +1562,79 @@ exit:
 
 	return status;
 }
+
+/**
+ * Dedicate AES engines to session keys.  Each engine keeps a session key loaded across messages, so
+ * the key does not need to be loaded for every secure message.  Keys are assigned to engines as they
+ * are used, and an engine is only loaded with a different key when all engines are in use.  Key
+ * changes, such as new data keys or releasing the session, discard any loaded keys for the session.
+ *
+ * The shared AES engine for the session manager is not used for session keys once dedicated
+ * engines have been provided.  To keep every session key loaded, provide two engines for each
+ * session.
+ *
+ * @param session_manager The session manager to configure.
+ * @param aes_engines The list of AES engines to dedicate to session keys.  Null to use the shared
+ * AES engine for all session keys.
+ * @param count The number of AES engines in the list.  This cannot be more than
+ * SPDM_SECURE_SESSION_MANAGER_MAX_KEY_CACHE.
+ *
+ * @return 0 if the AES engines were configured successfully or an error code.
+ */
+int spdm_secure_session_manager_enable_key_cache (
+	struct spdm_secure_session_manager *session_manager, struct aes_engine *const *aes_engines,
+	size_t count)
+{
+	size_t index;
+
+	if ((session_manager == NULL) || (session_manager->state == NULL) ||
+		((aes_engines == NULL) && (count != 0)) ||
+		(count > SPDM_SECURE_SESSION_MANAGER_MAX_KEY_CACHE)) {
+		return SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT;
+	}
+
+	for (index = 0; index < count; index++) {
+		if (aes_engines[index] == NULL) {
+			return SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT;
+		}
+	}
+
+	session_manager->key_cache = aes_engines;
+	session_manager->key_cache_count = count;
+	memset (session_manager->state->key_cache, 0, sizeof (session_manager->state->key_cache));
+
+	return 0;
+}
+
+/**
+ * Get session usage and memory statistics for the Session Manager.
+ *
+ * @param session_manager Session manager to query.
+ * @param stats Output for the session statistics.
+ *
+ * @return 0 if the statistics were retrieved successfully or an error code.
+ */
+int spdm_secure_session_manager_get_stats (
+	const struct spdm_secure_session_manager *session_manager,
+	struct spdm_secure_session_manager_stats *stats)
+{
+	struct spdm_secure_session_manager_state *state;
+
+	if ((session_manager == NULL) || (stats == NULL)) {
+		return SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT;
+	}
+
+	state = session_manager->state;
+
+	stats->max_sessions = SPDM_MAX_SESSION_COUNT;
+	stats->active_sessions = state->current_session_count;
+	stats->peak_sessions = state->peak_session_count;
+	stats->reclaimed_sessions = state->reclaimed_session_count;
+	stats->key_loads = state->key_load_count;
+	stats->key_cache_hits = state->key_cache_hit_count;
+	stats->session_size = SPDM_SECURE_SESSION_MEMORY_SIZE;
+	stats->used_bytes = state->current_session_count * SPDM_SECURE_SESSION_MEMORY_SIZE;
+	stats->total_bytes = SPDM_MAX_SESSION_COUNT * SPDM_SECURE_SESSION_MEMORY_SIZE;
+
+	return 0;
+}
@@ -4,6 +4,7 @@
 #ifndef SPDM_SECURE_SESSION_MANAGER_H_
 #define SPDM_SECURE_SESSION_MANAGER_H_
 
+#include "platform_api.h"
 #include "platform_config.h"
 #include "spdm_commands.h"
 
@@ -11,10 +12,35 @@
 /* Configurable parameters. Defaults can be overridden in platform_config.h. */
 
 /**
- * Maximum number of SPDM sessions supported.
+ * Maximum number of SPDM sessions supported.  Each session requires SPDM_SECURE_SESSION_MEMORY_SIZE
+ * bytes of state.  All sessions share the same crypto engines.
  */
 #ifndef SPDM_MAX_SESSION_COUNT
-#define SPDM_MAX_SESSION_COUNT		1
+#define SPDM_MAX_SESSION_COUNT		8
+#endif
+
+/**
+ * Number of buckets in the table used to look up sessions by session ID.
+ */
+#ifndef SPDM_SECURE_SESSION_MANAGER_LOOKUP_BUCKETS
+#define SPDM_SECURE_SESSION_MANAGER_LOOKUP_BUCKETS		SPDM_MAX_SESSION_COUNT
+#endif
+
+/**
+ * Time, in milliseconds, that an established session must be idle before it can be released to make
+ * room for a new session.  Sessions that have not finished the handshake can always be released.
+ * Set this to 0 to never release established sessions.
+ */
+#ifndef SPDM_SECURE_SESSION_MANAGER_IDLE_TIMEOUT_MS
+#define SPDM_SECURE_SESSION_MANAGER_IDLE_TIMEOUT_MS		0
+#endif
+
+/**
+ * Maximum number of AES engines that can be dedicated to session keys.  Each session uses one key
+ * for each message direction, so the default allows every session key to stay loaded.
+ */
+#ifndef SPDM_SECURE_SESSION_MANAGER_MAX_KEY_CACHE
+#define SPDM_SECURE_SESSION_MANAGER_MAX_KEY_CACHE		(SPDM_MAX_SESSION_COUNT * 2)
 #endif
 
 /**
@@ -37,10 +63,10 @@
 /**
  * Session Id concatenation (Request Session Id (16-LSb), Response Session Id (16-MSb))
  */
-#define GET_REQUEST_SESSION_ID(session_id) (session_id & 0xFFFF)
-#define GET_RESPONSE_SESSION_ID(session_id) ((session_id & 0xFFFF0000) >> 16)
+#define GET_REQUEST_SESSION_ID(session_id) ((session_id) & 0xFFFF)
+#define GET_RESPONSE_SESSION_ID(session_id) (((session_id) & 0xFFFF0000) >> 16)
 #define MAKE_SESSION_ID(req_session_id, rsp_session_id) \
-	((((uint32_t) rsp_session_id) << 16) | req_session_id)
+	((((uint32_t) (rsp_session_id)) << 16) | (req_session_id))
 
 /**
  * SPDM Key Schedule related strings.
@@ -245,6 +271,23 @@ struct spdm_secure_session {
 	uint8_t export_master_secret[HASH_MAX_HASH_LEN];					/**< Export master secret. */
 	bool is_requester;													/**< Requester or responder role. */
 	struct spdm_device_capability peer_capabilities;					/**< Peer capabilities. */
+	struct spdm_connection_info connection_info;						/**< Connection the session was created on. */
+	uint32_t last_activity;												/**< Activity count when the session was last used. */
+	platform_clock last_activity_time;									/**< Time when the session was last used. */
+};
+
+/**
+ * Memory needed for each SPDM session, including the session transcript state.
+ */
+#define	SPDM_SECURE_SESSION_MEMORY_SIZE	\
+	(sizeof (struct spdm_secure_session) + sizeof (struct spdm_transcript_manager_session_context))
+
+/**
+ * Tracking for an AES engine dedicated to session keys.
+ */
+struct spdm_secure_session_key_cache_entry {
+	const uint8_t *key;		/**< Session key loaded in the engine.  Null if no session key is loaded. */
+	uint32_t last_use;		/**< Key cache use count when the engine was last used. */
 };
 
 /**
@@ -255,11 +298,54 @@ struct spdm_secure_session_manager_state {
 	uint32_t current_session_count;									/**< Current number of active sessions. */
 	uint32_t last_spdm_request_secure_session_id;					/**< Secure session Id of last secure message. */
 	bool last_spdm_request_secure_session_id_valid;					/**< Secure session Id validity. */
+
+	/**
+	 * Head of the session list for each lookup bucket.  Entries are session indices offset by one,
+	 * with zero indicating an empty list.
+	 */
+	uint8_t lookup[SPDM_SECURE_SESSION_MANAGER_LOOKUP_BUCKETS];
+
+	/**
+	 * Next session in the same lookup bucket for each session, using the same encoding as the
+	 * bucket heads.
+	 */
+	uint8_t lookup_next[SPDM_MAX_SESSION_COUNT];
+
+	uint32_t activity_count;										/**< Counter used to order session activity. */
+	uint32_t peak_session_count;									/**< Highest number of concurrent sessions. */
+	uint32_t reclaimed_session_count;								/**< Number of idle sessions reclaimed. */
+
+	/**
+	 * The session key loaded in each AES engine dedicated to session keys.
+	 */
+	struct spdm_secure_session_key_cache_entry key_cache[SPDM_SECURE_SESSION_MANAGER_MAX_KEY_CACHE];
+
+	uint32_t key_cache_use_count;									/**< Counter used to order key cache use. */
+	uint32_t key_load_count;										/**< Number of times a session key was loaded. */
+	uint32_t key_cache_hit_count;									/**< Number of messages that used an already loaded key. */
+};
+
+/**
+ * Session usage and memory statistics for a session manager.
+ */
+struct spdm_secure_session_manager_stats {
+	uint32_t max_sessions;			/**< Maximum number of concurrent sessions. */
+	uint32_t active_sessions;		/**< Number of sessions currently in use. */
+	uint32_t peak_sessions;			/**< Highest number of sessions in use at the same time. */
+	uint32_t reclaimed_sessions;	/**< Number of idle sessions released to create new sessions. */
+	uint32_t key_loads;				/**< Number of times a session key was loaded into an AES engine. */
+	uint32_t key_cache_hits;		/**< Number of messages processed without loading the session key. */
+	size_t session_size;			/**< Bytes of state needed for each session. */
+	size_t used_bytes;				/**< Bytes of session state currently in use. */
+	size_t total_bytes;				/**< Bytes of session state reserved for all sessions. */
 };
 
 struct spdm_secure_session_manager {
 	/**
-	 * Create a new SPDM secure session.
+	 * Create a new SPDM secure session.  If there are no unused sessions, the session that has been
+	 * idle for the longest time will be released and reused for the new session.  Established
+	 * sessions are only released once they have been idle for
+	 * SPDM_SECURE_SESSION_MANAGER_IDLE_TIMEOUT_MS.
 	 *
 	 * @param session_manager SPDM session manager.
 	 * @param session_id Session Id for the session.
@@ -303,12 +389,22 @@ struct spdm_secure_session_manager {
 		uint32_t session_id, enum spdm_secure_session_state session_state);
 
 	/**
-	 * Reset the Session Manager.
+	 * Reset the Session Manager, releasing all sessions.  Session usage statistics are retained.
 	 *
 	 * @param session_manager SPDM session manager.
 	 */
 	void (*reset) (const struct spdm_secure_session_manager *session_manager);
 
+	/**
+	 * Release all sessions created on a connection negotiated by a single peer.  Sessions created
+	 * for other peers are not affected.
+	 *
+	 * @param session_manager SPDM session manager.
+	 * @param peer_eid EID of the peer whose sessions should be released.
+	 */
+	void (*release_peer_sessions) (const struct spdm_secure_session_manager *session_manager,
+		uint8_t peer_eid);
+
 	/**
 	 * Generate the shared secret from peer and local publick keys.
 	 *
@@ -397,6 +493,8 @@ struct spdm_secure_session_manager {
 	const struct spdm_device_capability *local_capabilities;	/**< Local capabilities. */
 	const struct spdm_device_algorithms *local_algorithms;		/**< Local algorithms. */
 	struct aes_engine *aes_engine;								/**< AES engine. */
+	struct aes_engine *const *key_cache;						/**< AES engines dedicated to session keys. */
+	size_t key_cache_count;										/**< Number of AES engines dedicated to session keys. */
 	struct hash_engine *hash_engine;							/**< Hashing engine. */
 	struct rng_engine *rng_engine;								/**< RNG engine. */
 	struct ecc_engine *ecc_engine;								/**< ECC engine. */
@@ -419,6 +517,14 @@ void spdm_secure_session_manager_release (
 int spdm_secure_session_manager_init_state (
 	const struct spdm_secure_session_manager *session_manager);
 
+int spdm_secure_session_manager_enable_key_cache (
+	struct spdm_secure_session_manager *session_manager, struct aes_engine *const *aes_engines,
+	size_t count);
+
+int spdm_secure_session_manager_get_stats (
+	const struct spdm_secure_session_manager *session_manager,
+	struct spdm_secure_session_manager_stats *stats);
+
 
 #define	SPDM_SECURE_SESSION_MANAGER_ERROR(\
 	code) ROT_ERROR (ROT_MODULE_SPDM_SECURE_SESSION_MANAGER, code)
@@ -23,6 +23,9 @@ void spdm_secure_session_manager_set_session_state (
 
 void spdm_secure_session_manager_reset (const struct spdm_secure_session_manager *session_manager);
 
+void spdm_secure_session_manager_release_peer_sessions (
+	const struct spdm_secure_session_manager *session_manager, uint8_t peer_eid);
+
 struct spdm_secure_session* spdm_secure_session_manager_get_session (
 	const struct spdm_secure_session_manager *session_manager, uint32_t session_id);
 
@@ -62,6 +65,7 @@ int spdm_secure_session_manager_encode_secure_message (
 	.get_session = spdm_secure_session_manager_get_session, \
 	.set_session_state = spdm_secure_session_manager_set_session_state, \
 	.reset = spdm_secure_session_manager_reset, \
+	.release_peer_sessions = spdm_secure_session_manager_release_peer_sessions, \
 	.generate_shared_secret = spdm_secure_session_manager_generate_shared_secret, \
 	.generate_session_handshake_keys = spdm_secure_session_manager_generate_session_handshake_keys, \
 	.generate_session_data_keys = spdm_secure_session_manager_generate_session_data_keys, \
@@ -6,10 +6,13 @@
 #include "spdm_protocol.h"
 #include "spdm_transcript_manager.h"
 #include "common/array_size.h"
-#include "common/common_math.h"
 #include "common/unused.h"
 
 
+/* Session indices are 8-bit values, and SPDM_MAX_SESSION_COUNT is used to indicate no session. */
+_Static_assert (SPDM_MAX_SESSION_COUNT < UINT8_MAX, "Too many SPDM sessions");
+
+
 /**
  * Add a message to the hash context. A new hash will be started with the message data using
  * the negotiated hash algorithm if there is no active hash for the context.
@@ -66,6 +69,111 @@ exit:
 	return status;
 }
 
+/**
+ * Get the connection parameters for a session transcript.  If the session transcript does not have
+ * connection parameters yet, the parameters for the current connection are copied to the session.
+ *
+ * There is no validation on the parameters since this is an internal function.
+ *
+ * @param transcript_manager	Transcript manager instance.
+ * @param session_idx			Index of the session transcript context.
+ *
+ * @return The connection parameters for the session transcript.
+ */
+static const struct spdm_transcript_manager_session_connection*
+spdm_transcript_manager_get_session_connection (
+	const struct spdm_transcript_manager *transcript_manager, uint32_t session_idx)
+{
+	struct spdm_transcript_manager_state *state = transcript_manager->state;
+	struct spdm_transcript_manager_session_connection *connection =
+		&state->session_transcript[session_idx].connection;
+
+	if (connection->valid == false) {
+		connection->hash_algo = state->hash_algo;
+		connection->spdm_version = state->spdm_version;
+		memcpy (connection->message_vca.buffer, state->message_vca.buffer,
+			state->message_vca.buffer_size);
+		connection->message_vca.buffer_size = state->message_vca.buffer_size;
+		connection->valid = true;
+	}
+
+	return connection;
+}
+
+/**
+ * Add a message to a session hash context.  Session transcripts share a single hash engine, so the
+ * saved state for the transcript is loaded into the engine before the update and saved again
+ * afterwards.  A new hash will be started with the message data using the hash algorithm for the
+ * session if there is no active hash for the context.
+ *
+ * There is no validation on the parameters since this is an internal function.
+ *
+ * @param transcript_manager	Transcript manager instance.
+ * @param connection			Connection parameters for the session.
+ * @param hash_context			Session hash context to add the message to.
+ * @param message				Message to add to the hash context.
+ * @param message_size			Size of message.
+ * @param add_vca				Flag indicating if the VCA buffer should be added to the hash.
+ *
+ * @return 0 if the message was added to the hash successfully or an error code.
+ */
+static int spdm_transcript_manager_add_session_msg (
+	const struct spdm_transcript_manager *transcript_manager,
+	const struct spdm_transcript_manager_session_connection *connection,
+	struct spdm_transcript_manager_session_hash_context *hash_context, const void *message,
+	size_t message_size, bool add_vca)
+{
+	int status;
+	struct hash_engine *hash_engine;
+
+	hash_engine =
+		transcript_manager->hash_engine[SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_SESSION];
+
+	if (hash_context->hash_started == false) {
+		status = hash_start_new_hash (hash_engine, connection->hash_algo);
+		if (status != 0) {
+			goto exit;
+		}
+
+		/* Add the VCA buffer to the hash context if requested by the caller
+		 * and only if the hash was just started.
+		 */
+		if (add_vca == true) {
+			status = hash_engine->update (hash_engine, connection->message_vca.buffer,
+				connection->message_vca.buffer_size);
+			if (status != 0) {
+				goto cancel;
+			}
+		}
+	}
+	else {
+		status = hash_engine->restore_context (hash_engine, &hash_context->midstate);
+		if (status != 0) {
+			goto exit;
+		}
+	}
+
+	/* Update the hash context with the message and save the new state.  The saved state is only
+	 * replaced once the update has completed successfully. */
+	status = hash_engine->update (hash_engine, message, message_size);
+	if (status != 0) {
+		goto cancel;
+	}
+
+	status = hash_engine->save_context (hash_engine, &hash_context->midstate);
+	if (status != 0) {
+		goto cancel;
+	}
+
+	hash_context->hash_started = true;
+
+cancel:
+	hash_engine->cancel (hash_engine);
+exit:
+
+	return status;
+}
+
 /**
  * Update VCA cache.
  *
@@ -146,18 +254,21 @@ static int spdm_transcript_manager_update_l1l2 (
 {
 	int status = 0;
 	struct spdm_transcript_manager_state *state = transcript_manager->state;
-	struct spdm_transcript_manager_hash_context *hash_context;
+	const struct spdm_transcript_manager_session_connection *connection;
 
+	/* Add the message to the hash context. */
 	if (use_session_context == true) {
-		hash_context = &state->session_transcript[session_idx].l1l2;
+		connection = spdm_transcript_manager_get_session_connection (transcript_manager,
+			session_idx);
+
+		status = spdm_transcript_manager_add_session_msg (transcript_manager, connection,
+			&state->session_transcript[session_idx].l1l2, message, message_size,
+			(connection->spdm_version > SPDM_VERSION_1_1));
 	}
 	else {
-		hash_context = &state->l1l2;
+		status = spdm_transcript_manager_add_msg (transcript_manager, &state->l1l2, message,
+			message_size, (state->spdm_version > SPDM_VERSION_1_1));
 	}
-
-	/* Add the message to the hash context. */
-	status = spdm_transcript_manager_add_msg (transcript_manager, hash_context, message,
-		message_size, (state->spdm_version > SPDM_VERSION_1_1));
 	if (status != 0) {
 		goto exit;
 	}
@@ -185,13 +296,15 @@ static int spdm_transcript_manager_update_th (
 {
 	int status = 0;
 	struct spdm_transcript_manager_state *state = transcript_manager->state;
-	struct spdm_transcript_manager_hash_context *hash_context;
+	struct spdm_transcript_manager_session_hash_context *hash_context;
+	const struct spdm_transcript_manager_session_connection *connection;
 
 	hash_context = &state->session_transcript[session_idx].th;
+	connection = spdm_transcript_manager_get_session_connection (transcript_manager, session_idx);
 
 	/* Add the message to the hash context. */
-	status = spdm_transcript_manager_add_msg (transcript_manager, hash_context, message,
-		message_size, true);
+	status = spdm_transcript_manager_add_session_msg (transcript_manager, connection,
+		hash_context, message, message_size, true);
 	if (status != 0) {
 		goto exit;
 	}
@@ -241,7 +354,23 @@ static void spdm_transcript_manager_reset_m1m2 (
 }
 
 /**
- * Reset the L1L2 global or session hash engine context.
+ * Discard the saved state for a session hash context.
+ *
+ * There is no validation on the parameter since this is an internal function.
+ *
+ * @param hash_context			Session hash context to reset.
+ */
+static void spdm_transcript_manager_reset_session_hash (
+	struct spdm_transcript_manager_session_hash_context *hash_context)
+{
+	if (hash_context->hash_started == true) {
+		memset (&hash_context->midstate, 0, sizeof (hash_context->midstate));
+		hash_context->hash_started = false;
+	}
+}
+
+/**
+ * Reset the L1L2 global or session hash context.
  *
  * There is no validation on the parameter since this is an internal function.
  *
@@ -254,21 +383,20 @@ static void spdm_transcript_manager_reset_l1l2 (
 	uint8_t session_idx)
 {
 	struct hash_engine *l1l2;
-	struct spdm_transcript_manager_hash_context *hash_context;
 	struct spdm_transcript_manager_state *state = transcript_manager->state;
 
-	hash_context = (use_session_context == true) ?
-			&state->session_transcript[session_idx].l1l2 : &state->l1l2;
-
-	if (hash_context->hash_started == true) {
-		l1l2 = transcript_manager->hash_engine[hash_context->hash_engine_idx];
+	if (use_session_context == true) {
+		spdm_transcript_manager_reset_session_hash (&state->session_transcript[session_idx].l1l2);
+	}
+	else if (state->l1l2.hash_started == true) {
+		l1l2 = transcript_manager->hash_engine[state->l1l2.hash_engine_idx];
 		l1l2->cancel (l1l2);
-		hash_context->hash_started = false;
+		state->l1l2.hash_started = false;
 	}
 }
 
 /**
- * Reset the TH hash engine context.
+ * Reset the TH hash context.
  *
  * There is no validation on the parameters since this is an internal function.
  *
@@ -278,16 +406,8 @@ static void spdm_transcript_manager_reset_l1l2 (
 static void spdm_transcript_manager_reset_th (
 	const struct spdm_transcript_manager *transcript_manager, uint8_t session_idx)
 {
-	struct hash_engine *th;
-	struct spdm_transcript_manager_hash_context *hash_context;
-	struct spdm_transcript_manager_state *state = transcript_manager->state;
-
-	hash_context = &state->session_transcript[session_idx].th;
-	if (hash_context->hash_started == true) {
-		th = transcript_manager->hash_engine[hash_context->hash_engine_idx];
-		th->cancel (th);
-		hash_context->hash_started = false;
-	}
+	spdm_transcript_manager_reset_session_hash (
+		&transcript_manager->state->session_transcript[session_idx].th);
 }
 
 void spdm_transcript_manager_reset_session_transcript (
@@ -307,6 +427,9 @@ void spdm_transcript_manager_reset_session_transcript (
 	spdm_transcript_manager_reset_l1l2 (transcript_manager, true, session_idx);
 
 	spdm_transcript_manager_reset_th (transcript_manager, session_idx);
+
+	memset (&state->session_transcript[session_idx].connection, 0,
+		sizeof (state->session_transcript[session_idx].connection));
 }
 
 void spdm_transcript_manager_reset_context (
@@ -359,6 +482,19 @@ void spdm_transcript_manager_reset_context (
 	return;
 }
 
+void spdm_transcript_manager_reset_connection (
+	const struct spdm_transcript_manager *transcript_manager)
+{
+	if (transcript_manager != NULL) {
+		transcript_manager->state->hash_algo = HASH_TYPE_INVALID;
+
+		/* Reset global transcripts. */
+		spdm_transcript_manager_reset_vca (transcript_manager);
+		spdm_transcript_manager_reset_m1m2 (transcript_manager);
+		spdm_transcript_manager_reset_l1l2 (transcript_manager, false, SPDM_MAX_SESSION_COUNT);
+	}
+}
+
 void spdm_transcript_manager_reset (const struct spdm_transcript_manager *transcript_manager)
 {
 	uint8_t session_idx;
@@ -367,12 +503,7 @@ void spdm_transcript_manager_reset (const struct spdm_transcript_manager *transc
 	if (transcript_manager != NULL) {
 		state = transcript_manager->state;
 
-		state->hash_algo = HASH_TYPE_INVALID;
-
-		/* Reset global transcripts. */
-		spdm_transcript_manager_reset_vca (transcript_manager);
-		spdm_transcript_manager_reset_m1m2 (transcript_manager);
-		spdm_transcript_manager_reset_l1l2 (transcript_manager, false, SPDM_MAX_SESSION_COUNT);
+		spdm_transcript_manager_reset_connection (transcript_manager);
 
 		/* Reset session transcript(s). */
 		for (session_idx = 0; session_idx < state->session_transcript_count; session_idx++) {
@@ -436,7 +567,7 @@ int spdm_transcript_manager_update (
 		case TRANSCRIPT_CONTEXT_TYPE_L1L2:
 		case TRANSCRIPT_CONTEXT_TYPE_TH:
 			if ((use_session_context == true) &&
-				(session_idx >= SPDM_MAX_SESSION_COUNT)) {
+				(session_idx >= transcript_manager->state->session_transcript_count)) {
 				status = SPDM_TRANSCRIPT_MANAGER_INVALID_SESSION_IDX;
 				goto exit;
 			}
@@ -462,6 +593,53 @@ exit:
 	return status;
 }
 
+/**
+ * Get the hash for a session hash context.  The saved state for the transcript is loaded into the
+ * shared session hash engine to calculate the hash.  Unless the hash is being finished, the saved
+ * state is not modified and can be updated with additional messages.
+ *
+ * There is no validation on the parameters since this is an internal function.
+ *
+ * @param transcript_manager	Transcript manager instance.
+ * @param hash_context			Session hash context to get the hash from.
+ * @param finish_hash			Flag to indicate to finish the hash.
+ * @param hash					Buffer to copy the hash to.
+ * @param hash_size				Size of hash.
+ *
+ * @return 0 if the hash was returned successfully or an error code.
+ */
+static int spdm_transcript_manager_get_session_hash (
+	const struct spdm_transcript_manager *transcript_manager,
+	struct spdm_transcript_manager_session_hash_context *hash_context, bool finish_hash,
+	uint8_t *hash, size_t hash_size)
+{
+	int status;
+	struct hash_engine *hash_engine;
+
+	hash_engine =
+		transcript_manager->hash_engine[SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_SESSION];
+
+	status = hash_engine->restore_context (hash_engine, &hash_context->midstate);
+	if (status != 0) {
+		goto exit;
+	}
+
+	/* The saved state is retained, so the loaded hash can always be finished. */
+	status = hash_engine->finish (hash_engine, hash, hash_size);
+	if (status != 0) {
+		hash_engine->cancel (hash_engine);
+		goto exit;
+	}
+
+	if (finish_hash) {
+		spdm_transcript_manager_reset_session_hash (hash_context);
+	}
+
+exit:
+
+	return status;
+}
+
 int spdm_transcript_manager_get_hash (
 	const struct spdm_transcript_manager *transcript_manager,
 	enum spdm_transcript_manager_context_type context_type, bool finish_hash,
@@ -470,6 +648,7 @@ int spdm_transcript_manager_get_hash (
 	int status;
 	struct spdm_transcript_manager_state *state;
 	struct spdm_transcript_manager_hash_context *hash_context;
+	struct spdm_transcript_manager_session_hash_context *session_context;
 	struct hash_engine *hash_engine;
 
 	if ((transcript_manager == NULL) || (hash == NULL) || (hash_size == 0)) {
@@ -498,16 +677,24 @@ int spdm_transcript_manager_get_hash (
 
 		case TRANSCRIPT_CONTEXT_TYPE_L1L2:
 		case TRANSCRIPT_CONTEXT_TYPE_TH:
+			if (use_session_context == false) {
+				hash_context = &state->l1l2;
+				break;
+			}
 
-			if (context_type == TRANSCRIPT_CONTEXT_TYPE_L1L2) {
-				hash_context = (use_session_context == true) ?
-						&state->session_transcript[session_idx].l1l2 : &state->l1l2;
+			session_context = (context_type == TRANSCRIPT_CONTEXT_TYPE_L1L2) ?
+					&state->session_transcript[session_idx].l1l2 :
+					&state->session_transcript[session_idx].th;
+
+			if (session_context->hash_started == false) {
+				status = SPDM_TRANSCRIPT_MANAGER_HASH_NOT_STARTED;
 			}
 			else {
-				hash_context = &state->session_transcript[session_idx].th;
+				status = spdm_transcript_manager_get_session_hash (transcript_manager,
+					session_context, finish_hash, hash, hash_size);
 			}
 
-			break;
+			goto exit;
 
 		default:
 			status = SPDM_TRANSCRIPT_MANAGER_UNSUPPORTED_CONTEXT_TYPE;
@@ -572,6 +759,7 @@ int spdm_transcript_manager_init (struct spdm_transcript_manager *transcript_man
 	transcript_manager->get_hash = spdm_transcript_manager_get_hash;
 	transcript_manager->reset_transcript = spdm_transcript_manager_reset_context;
 	transcript_manager->reset = spdm_transcript_manager_reset;
+	transcript_manager->reset_connection = spdm_transcript_manager_reset_connection;
 	transcript_manager->reset_session_transcript = spdm_transcript_manager_reset_session_transcript;
 
 	/* Initialize the state. */
@@ -592,10 +780,7 @@ exit:
 int spdm_transcript_manager_init_state (const struct spdm_transcript_manager *transcript_manager)
 {
 	int status = 0;
-	int max_session_count;
-	struct spdm_transcript_manager_session_context *session_transcript;
 	uint8_t hash_engine_idx;
-	uint8_t session_idx;
 	struct spdm_transcript_manager_state *state;
 
 	if ((transcript_manager == NULL) || (transcript_manager->state == NULL) ||
@@ -624,19 +809,12 @@ int spdm_transcript_manager_init_state (const struct spdm_transcript_manager *tr
 	state->m1m2.hash_engine_idx = SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_M1M2;
 	state->l1l2.hash_engine_idx = SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_L1L2;
 
-	/* Process hash engines for SPDM session(s). */
-	session_transcript = state->session_transcript;
-	max_session_count = (transcript_manager->hash_engine_count -
-		SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT) /
-		SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT;
-	state->session_transcript_count =
-		min (max_session_count, SPDM_MAX_SESSION_COUNT);
-
-	/* Assig indices from the hash_engine array to session transcript hashes. */
-	for (session_idx = 0, hash_engine_idx = SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT;
-		session_idx < state->session_transcript_count; session_idx++) {
-		session_transcript[session_idx].l1l2.hash_engine_idx = hash_engine_idx++;
-		session_transcript[session_idx].th.hash_engine_idx = hash_engine_idx++;
+	/* All SPDM sessions share a single hash engine, so the number of session transcripts is only
+	 * limited by the state size. */
+	if (transcript_manager->hash_engine_count >=
+		(SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT +
+		SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT)) {
+		state->session_transcript_count = SPDM_MAX_SESSION_COUNT;
 	}
 
 exit:
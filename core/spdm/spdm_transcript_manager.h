@@ -25,7 +25,7 @@
  * on input parameters provided during initialization.
  */
 #ifndef SPDM_MAX_SESSION_COUNT
-#define SPDM_MAX_SESSION_COUNT	1
+#define SPDM_MAX_SESSION_COUNT	8
 #endif
 
 /**
@@ -38,11 +38,13 @@
  */
 #define SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_M1M2			0
 #define SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_L1L2			1
+#define SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_SESSION		2
 
 /**
- * Count of hash engines required for an SPDM session.
+ * Count of hash engines required for SPDM sessions.  A single engine is shared by all sessions,
+ * with each session transcript kept as a saved hash context between updates.
  */
-#define SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT	2
+#define SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT	1
 
 
 /**
@@ -61,10 +63,36 @@ struct spdm_transcript_manager_hash_context {
 	bool hash_started;			/**< Hash engine state. */
 };
 
+/**
+ * Context for an SPDM session transcript digest.  The hash engine used to update the digest is
+ * shared with other sessions, so the intermediate hash state is saved between updates.
+ */
+struct spdm_transcript_manager_session_hash_context {
+	struct hash_context midstate;	/**< Intermediate hash state for the transcript. */
+	bool hash_started;				/**< Hash state. */
+};
+
+/**
+ * Connection parameters used for the transcripts of an SPDM session.  These are copied from the
+ * connection when the first session transcript is started, so a new connection negotiated by a
+ * different requester does not change the transcripts of an existing session.
+ */
+struct spdm_transcript_manager_session_connection {
+	enum hash_type hash_algo;										/**< Hash algorithm for the session. */
+	uint8_t spdm_version;											/**< SPDM version for the session. */
+	struct spdm_transcript_manager_vca_managed_buffer message_vca;	/**< VCA messages for the session. */
+	bool valid;														/**< Flag indicating the parameters have been set. */
+};
+
 /**
  * Transcript hash context for an SPDM session.
  */
 struct spdm_transcript_manager_session_context {
+	/**
+	 * Connection parameters for the session transcripts.
+	 */
+	struct spdm_transcript_manager_session_connection connection;
+
 	/**
 	 * TH for KEY_EXCHANGE response signature: Concatenate (A, D, Ct, K)
 	 * D = DIGEST, if MULTI_KEY_CONN_RSP
@@ -92,13 +120,13 @@ struct spdm_transcript_manager_session_context {
 	 * CM = mutual certificate chain, if MutAuth
 	 * F = Concatenate (FINISH request\verify_data)
 	 */
-	struct spdm_transcript_manager_hash_context th;
+	struct spdm_transcript_manager_session_hash_context th;
 
 	/**
 	 * L1/L2 = Concatenate (M)
 	 * M = Concatenate (GET_MEASUREMENT, MEASUREMENT\signature)
 	 */
-	struct spdm_transcript_manager_hash_context l1l2;
+	struct spdm_transcript_manager_session_hash_context l1l2;
 };
 
 /**
@@ -225,6 +253,14 @@ struct spdm_transcript_manager {
 	 */
 	void (*reset) (const struct spdm_transcript_manager *transcript_manager);
 
+	/**
+	 * Reset the transcripts for the connection and the negotiated hash algorithm.  Transcripts for
+	 * SPDM session(s) are not changed.
+	 *
+	 * @param transcript_manager	Transcript manager to reset.
+	 */
+	void (*reset_connection) (const struct spdm_transcript_manager *transcript_manager);
+
 	/**
 	 * Reset a session transcript.
 	 *
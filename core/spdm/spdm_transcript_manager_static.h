@@ -32,6 +32,9 @@ void spdm_transcript_manager_reset_context (
 void spdm_transcript_manager_reset (
 	const struct spdm_transcript_manager *transcript_manager);
 
+void spdm_transcript_manager_reset_connection (
+	const struct spdm_transcript_manager *transcript_manager);
+
 void spdm_transcript_manager_reset_session_transcript (
 	const struct spdm_transcript_manager *transcript_manager, uint8_t session_idx);
 
@@ -45,6 +48,7 @@ void spdm_transcript_manager_reset_session_transcript (
 	.get_hash = spdm_transcript_manager_get_hash, \
 	.reset_transcript = spdm_transcript_manager_reset_context, \
 	.reset = spdm_transcript_manager_reset, \
+	.reset_connection = spdm_transcript_manager_reset_connection, \
 	.reset_session_transcript = spdm_transcript_manager_reset_session_transcript
 
 /**
@@ -152,6 +152,8 @@ enum {
 	ROT_MODULE_AUTHORIZED_EXECUTION = 0x008c,			/**< Execution context for authorized operations. */
 	ROT_MODULE_SPDM_VDM_PROTOCOL = 0x008d,				/**< SPDM vendor defined messages protocol. */
 	ROT_MODULE_SPDM_PCISIG_PROTOCOL = 0x008e,			/**< SPDM PCISIG messages protocol. */
+	ROT_MODULE_HEAP_TLSF = 0x008f,						/**< Segregated-fit heap allocator. */
+	ROT_MODULE_OBJECT_POOL = 0x0090,					/**< Pool of fixed-size objects. */
 	ROT_MODULE_PIT_CRYPTO = 0x0063,						/**< Handel Error from PIT Crypto file. */
 	ROT_MODULE_PIT_I2C = 0X0064,						/**< Handel Error from PIT Client file. */
 	ROT_MODULE_PIT = 0X0065,							/**< Handel Error from PIT file. */
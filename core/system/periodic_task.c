@@ -31,7 +31,9 @@ void periodic_task_prepare_handlers (const struct periodic_task_handler **handle
  * that time, then execute the handler.
  *
  * This is a simple search and does not guarantee fair opportunity for each handler to run.  It is
- * expected that handlers will be constructed to not starve each other.
+ * expected that handlers will be constructed to not starve each other.  Every handler is queried on
+ * each call, so task implementations should use {@link periodic_task_scheduler_execute_due_handlers}
+ * instead.
  *
  * @param handlers The list of handlers to search.  Each entry in the list is a pointer to a
  * handler that could be executed.
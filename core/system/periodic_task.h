@@ -59,6 +59,7 @@ enum {
 	PERIODIC_TASK_INVALID_ARGUMENT = PERIODIC_TASK_ERROR (0x00),	/**< Input parameter is null or not valid. */
 	PERIODIC_TASK_NO_MEMORY = PERIODIC_TASK_ERROR (0x01),			/**< Memory allocation failed. */
 	PERIODIC_TASK_NO_HANDLERS = PERIODIC_TASK_ERROR (0x02),			/**< A list of handlers only contains null pointers. */
+	PERIODIC_TASK_UNKNOWN_HANDLER = PERIODIC_TASK_ERROR (0x03),		/**< The handler is not managed by the scheduler. */
 };
 
 
@@ -0,0 +1,480 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "periodic_task_scheduler.h"
+
+
+/**
+ * Determine if one scheduling time is earlier than another.  Times are relative to the start of the
+ * scheduler and are allowed to wrap.
+ */
+#define	PERIODIC_TASK_SCHEDULER_IS_BEFORE(a, b)		((int32_t) ((a) - (b)) < 0)
+
+
+/**
+ * Initialize a scheduler for periodic task handlers.
+ *
+ * @param scheduler The scheduler to initialize.
+ * @param state Variable context for the scheduler.  This must be uninitialized.
+ * @param handlers The list of handlers to schedule.  Null entries in the list will be ignored.
+ * @param num_handlers The number of handlers in the list.
+ * @param entries Storage for the scheduling heap.  This must have space for the same number of
+ * entries as the handler list.
+ *
+ * @return 0 if the scheduler was initialized successfully or an error code.
+ */
+int periodic_task_scheduler_init (struct periodic_task_scheduler *scheduler,
+	struct periodic_task_scheduler_state *state, const struct periodic_task_handler **handlers,
+	size_t num_handlers, struct periodic_task_scheduler_entry *entries)
+{
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (scheduler, 0, sizeof (struct periodic_task_scheduler));
+
+	scheduler->state = state;
+	scheduler->handlers = handlers;
+	scheduler->num_handlers = num_handlers;
+	scheduler->entries = entries;
+
+	return periodic_task_scheduler_init_state (scheduler);
+}
+
+/**
+ * Initialize only the variable state for a periodic task scheduler.  The rest of the scheduler is
+ * assumed to have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param scheduler The scheduler that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int periodic_task_scheduler_init_state (const struct periodic_task_scheduler *scheduler)
+{
+	if ((scheduler == NULL) || (scheduler->state == NULL) || (scheduler->handlers == NULL) ||
+		(scheduler->num_handlers == 0) || (scheduler->entries == NULL)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (scheduler->state, 0, sizeof (struct periodic_task_scheduler_state));
+	memset (scheduler->entries, 0,
+		sizeof (struct periodic_task_scheduler_entry) * scheduler->num_handlers);
+
+	return platform_semaphore_init (&scheduler->state->wake);
+}
+
+/**
+ * Release the resources used by a periodic task scheduler.
+ *
+ * @param scheduler The scheduler to release.
+ */
+void periodic_task_scheduler_release (const struct periodic_task_scheduler *scheduler)
+{
+	if (scheduler) {
+		platform_semaphore_free (&scheduler->state->wake);
+	}
+}
+
+/**
+ * Get the current time relative to the start of the scheduler.
+ *
+ * @param scheduler The scheduler to query.
+ * @param now Output for the current time, in milliseconds.
+ *
+ * @return 0 if the current time was determined successfully or an error code.
+ */
+static int periodic_task_scheduler_get_time (const struct periodic_task_scheduler *scheduler,
+	uint32_t *now)
+{
+	platform_clock current;
+	int status;
+
+	status = platform_init_current_tick (&current);
+	if (status != 0) {
+		return status;
+	}
+
+	*now = platform_get_duration (&scheduler->state->start, &current);
+
+	return 0;
+}
+
+/**
+ * Query a handler for the next time it needs to be executed.
+ *
+ * @param entry The scheduling entry for the handler.
+ * @param now The current scheduler time.
+ *
+ * @return 0 if the execution time was updated successfully or an error code.  On error, the
+ * handler will be scheduled to run immediately.
+ */
+static int periodic_task_scheduler_update_deadline (struct periodic_task_scheduler_entry *entry,
+	uint32_t now)
+{
+	const platform_clock *next;
+	uint32_t wait = 0;
+	int status = 0;
+
+	next = entry->handler->get_next_execution (entry->handler);
+	if (next != NULL) {
+		status = platform_get_timeout_remaining (next, &wait);
+		if (status != 0) {
+			wait = 0;
+		}
+	}
+
+	entry->deadline = now + wait;
+
+	return status;
+}
+
+/**
+ * Move an entry towards the top of the heap until it is in the correct position.
+ *
+ * @param entries The scheduling heap.
+ * @param index Index of the entry to move.
+ */
+static void periodic_task_scheduler_sift_up (struct periodic_task_scheduler_entry *entries,
+	size_t index)
+{
+	struct periodic_task_scheduler_entry entry = entries[index];
+
+	while (index > 0) {
+		size_t parent = (index - 1) / 2;
+
+		if (!PERIODIC_TASK_SCHEDULER_IS_BEFORE (entry.deadline, entries[parent].deadline)) {
+			break;
+		}
+
+		entries[index] = entries[parent];
+		index = parent;
+	}
+
+	entries[index] = entry;
+}
+
+/**
+ * Move an entry towards the bottom of the heap until it is in the correct position.
+ *
+ * @param entries The scheduling heap.
+ * @param count The number of entries in the heap.
+ * @param index Index of the entry to move.
+ */
+static void periodic_task_scheduler_sift_down (struct periodic_task_scheduler_entry *entries,
+	size_t count, size_t index)
+{
+	struct periodic_task_scheduler_entry entry = entries[index];
+	size_t child;
+
+	while ((child = (index * 2) + 1) < count) {
+		if (((child + 1) < count) &&
+			PERIODIC_TASK_SCHEDULER_IS_BEFORE (entries[child + 1].deadline,
+				entries[child].deadline)) {
+			child++;
+		}
+
+		if (!PERIODIC_TASK_SCHEDULER_IS_BEFORE (entries[child].deadline, entry.deadline)) {
+			break;
+		}
+
+		entries[index] = entries[child];
+		index = child;
+	}
+
+	entries[index] = entry;
+}
+
+/**
+ * Query every handler for the next execution time and rebuild the scheduling heap.
+ *
+ * @param scheduler The scheduler to refresh.
+ *
+ * @return 0 if the schedule was refreshed successfully or an error code.  The heap is always
+ * rebuilt, even if an error is reported.
+ */
+static int periodic_task_scheduler_refresh (const struct periodic_task_scheduler *scheduler)
+{
+	struct periodic_task_scheduler_state *state = scheduler->state;
+	uint32_t now;
+	size_t i;
+	int status;
+	int result;
+
+	status = periodic_task_scheduler_get_time (scheduler, &now);
+	if (status != 0) {
+		return status;
+	}
+
+	for (i = 0; i < state->count; i++) {
+		result = periodic_task_scheduler_update_deadline (&scheduler->entries[i], now);
+		if (status == 0) {
+			status = result;
+		}
+	}
+
+	for (i = state->count / 2; i > 0; i--) {
+		periodic_task_scheduler_sift_down (scheduler->entries, state->count, i - 1);
+	}
+
+	return status;
+}
+
+/**
+ * Prepare all handlers for execution and build the initial schedule.  This must be called from the
+ * context of the task that will execute the handlers before any handlers are executed.  Any
+ * existing execution statistics will be cleared.
+ *
+ * @param scheduler The scheduler to prepare.
+ *
+ * @return 0 if the handlers were prepared successfully or an error code.
+ */
+int periodic_task_scheduler_prepare (const struct periodic_task_scheduler *scheduler)
+{
+	struct periodic_task_scheduler_state *state;
+	size_t i;
+	int status;
+
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	state = scheduler->state;
+
+	status = platform_init_current_tick (&state->start);
+	if (status != 0) {
+		return status;
+	}
+
+	periodic_task_prepare_handlers (scheduler->handlers, scheduler->num_handlers);
+
+	memset (scheduler->entries, 0,
+		sizeof (struct periodic_task_scheduler_entry) * scheduler->num_handlers);
+
+	state->count = 0;
+	for (i = 0; i < scheduler->num_handlers; i++) {
+		if (scheduler->handlers[i] != NULL) {
+			scheduler->entries[state->count].handler = scheduler->handlers[i];
+			state->count++;
+		}
+	}
+
+	if (state->count == 0) {
+		return PERIODIC_TASK_NO_HANDLERS;
+	}
+
+	/* Anything signaled up to this point will be handled by the refresh. */
+	platform_semaphore_reset (&state->wake);
+
+	return periodic_task_scheduler_refresh (scheduler);
+}
+
+/**
+ * Execute a single handler and update its statistics and schedule.
+ *
+ * @param scheduler The scheduler executing the handler.
+ * @param entry The scheduling entry for the handler.
+ * @param now The current scheduler time.  This will be updated with the time after the handler
+ * finished executing.
+ *
+ * @return 0 if the handler schedule was updated successfully or an error code.
+ */
+static int periodic_task_scheduler_execute_handler (const struct periodic_task_scheduler *scheduler,
+	struct periodic_task_scheduler_entry *entry, uint32_t *now)
+{
+	struct periodic_task_scheduler_stats *stats = &entry->stats;
+	uint32_t lateness = 0;
+	uint32_t exec_time;
+	uint32_t start;
+
+	/* If the current time can't be determined, the last known time is used. */
+	periodic_task_scheduler_get_time (scheduler, now);
+	start = *now;
+
+	if (!PERIODIC_TASK_SCHEDULER_IS_BEFORE (start, entry->deadline)) {
+		lateness = start - entry->deadline;
+	}
+
+	entry->handler->execute (entry->handler);
+
+	periodic_task_scheduler_get_time (scheduler, now);
+	exec_time = *now - start;
+
+	stats->executions++;
+	stats->total_exec_time += exec_time;
+	stats->total_lateness += lateness;
+	if (exec_time > stats->max_exec_time) {
+		stats->max_exec_time = exec_time;
+	}
+	if (lateness > stats->max_lateness) {
+		stats->max_lateness = lateness;
+	}
+
+	return periodic_task_scheduler_update_deadline (entry, *now);
+}
+
+/**
+ * Wait until at least one handler is ready for execution, then execute all handlers that are due.
+ * Handlers are executed in the order of their scheduled times, and each handler will be executed at
+ * most once per call.
+ *
+ * The wait can be interrupted by a scheduler notification, in which case the schedule will be
+ * refreshed and any handlers that are now due will be executed.  If no handlers are due after a
+ * notification, this returns without executing any handlers so the caller can check for other work.
+ *
+ * @param scheduler The scheduler to execute.
+ *
+ * @return 0 if the due handlers were executed or the schedule was refreshed, or an error code.
+ * This does not report status of the handlers, just whether the handlers were executed.
+ */
+int periodic_task_scheduler_execute_due_handlers (const struct periodic_task_scheduler *scheduler)
+{
+	struct periodic_task_scheduler_state *state;
+	struct periodic_task_scheduler_entry *entries;
+	size_t end;
+	size_t i;
+	uint32_t now;
+	bool notified = false;
+	int status;
+	int result;
+
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	state = scheduler->state;
+	entries = scheduler->entries;
+
+	if (state->count == 0) {
+		return PERIODIC_TASK_NO_HANDLERS;
+	}
+
+	status = platform_semaphore_try_wait (&state->wake);
+	while (1) {
+		if (status == 0) {
+			notified = true;
+
+			status = periodic_task_scheduler_refresh (scheduler);
+			if (status != 0) {
+				return status;
+			}
+		}
+		else if (status != 1) {
+			return status;
+		}
+
+		status = periodic_task_scheduler_get_time (scheduler, &now);
+		if (status != 0) {
+			return status;
+		}
+
+		if (!PERIODIC_TASK_SCHEDULER_IS_BEFORE (now, entries[0].deadline)) {
+			break;
+		}
+		else if (notified) {
+			return 0;
+		}
+
+		status = platform_semaphore_wait (&state->wake, entries[0].deadline - now);
+	}
+
+	/* Move every handler that is due to the end of the heap.  The earliest handler will be last. */
+	end = state->count;
+	while ((state->count > 0) && !PERIODIC_TASK_SCHEDULER_IS_BEFORE (now, entries[0].deadline)) {
+		struct periodic_task_scheduler_entry due = entries[0];
+
+		state->count--;
+		entries[0] = entries[state->count];
+		entries[state->count] = due;
+		periodic_task_scheduler_sift_down (entries, state->count, 0);
+	}
+
+	status = 0;
+	for (i = end; i > state->count; i--) {
+		result = periodic_task_scheduler_execute_handler (scheduler, &entries[i - 1], &now);
+		if (status == 0) {
+			status = result;
+		}
+	}
+
+	while (state->count < end) {
+		periodic_task_scheduler_sift_up (entries, state->count);
+		state->count++;
+	}
+
+	return status;
+}
+
+/**
+ * Notify the scheduler that the execution time for one or more handlers has been changed outside
+ * of the handler execution.  If the task is waiting for the next handler, it will be woken up to
+ * refresh the schedule.
+ *
+ * This must only be called from task context.
+ *
+ * @param scheduler The scheduler to notify.
+ *
+ * @return 0 if the notification was sent successfully or an error code.
+ */
+int periodic_task_scheduler_notify (const struct periodic_task_scheduler *scheduler)
+{
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	return platform_semaphore_post (&scheduler->state->wake);
+}
+
+/**
+ * Notify the scheduler from interrupt context that the execution time for one or more handlers has
+ * been changed.
+ *
+ * @param scheduler The scheduler to notify.
+ *
+ * @return 0 if the notification was sent successfully or an error code.
+ */
+int periodic_task_scheduler_notify_from_isr (const struct periodic_task_scheduler *scheduler)
+{
+	if (scheduler == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	return platform_semaphore_post_from_isr (&scheduler->state->wake);
+}
+
+/**
+ * Get the execution statistics for a single handler.
+ *
+ * Statistics are updated from the context of the task executing the handlers without any
+ * synchronization, so values read from a different context may be from different executions.
+ *
+ * @param scheduler The scheduler to query.
+ * @param handler The handler to get statistics for.
+ * @param stats Output for the handler statistics.
+ *
+ * @return 0 if the statistics were retrieved successfully or an error code.
+ */
+int periodic_task_scheduler_get_stats (const struct periodic_task_scheduler *scheduler,
+	const struct periodic_task_handler *handler, struct periodic_task_scheduler_stats *stats)
+{
+	size_t i;
+
+	if ((scheduler == NULL) || (handler == NULL) || (stats == NULL)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	for (i = 0; i < scheduler->num_handlers; i++) {
+		if (scheduler->entries[i].handler == handler) {
+			*stats = scheduler->entries[i].stats;
+
+			return 0;
+		}
+	}
+
+	return PERIODIC_TASK_UNKNOWN_HANDLER;
+}
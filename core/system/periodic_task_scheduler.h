@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef PERIODIC_TASK_SCHEDULER_H_
+#define PERIODIC_TASK_SCHEDULER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "platform_api.h"
+#include "system/periodic_task.h"
+
+
+/* Scheduler for periodic task handlers.  Handlers are kept in a min-heap ordered by the next time
+ * each one needs to run, so finding the next handler does not require querying every handler.  All
+ * handlers that are due are executed each time the task wakes up.
+ *
+ * The next execution time for a handler is only queried after the handler has been prepared or
+ * executed.  If the execution time for a handler is changed from a different context, the scheduler
+ * must be notified so it can refresh the execution times.  The notification will also wake the task
+ * if it is waiting for the next handler to be ready. */
+
+
+/**
+ * Execution statistics for a single handler.  All times are in milliseconds.
+ */
+struct periodic_task_scheduler_stats {
+	uint32_t executions;		/**< The number of times the handler has been executed. */
+	uint32_t total_exec_time;	/**< Total time spent executing the handler. */
+	uint32_t max_exec_time;		/**< The longest time taken by a single execution. */
+	uint32_t total_lateness;	/**< Total time between the scheduled time and execution. */
+	uint32_t max_lateness;		/**< The longest delay between the scheduled time and execution. */
+};
+
+/**
+ * A scheduling entry for a single handler.
+ */
+struct periodic_task_scheduler_entry {
+	const struct periodic_task_handler *handler;	/**< The handler to execute. */
+	uint32_t deadline;								/**< Next execution, relative to the scheduler start. */
+	struct periodic_task_scheduler_stats stats;		/**< Execution statistics for the handler. */
+};
+
+/**
+ * Variable context for the periodic task scheduler.
+ */
+struct periodic_task_scheduler_state {
+	platform_semaphore wake;	/**< Signal to refresh the schedule and wake the task. */
+	platform_clock start;		/**< The time the handlers were prepared. */
+	size_t count;				/**< The number of handlers in the heap. */
+};
+
+/**
+ * Scheduler for a list of periodic task handlers.
+ */
+struct periodic_task_scheduler {
+	struct periodic_task_scheduler_state *state;		/**< Variable context for the scheduler. */
+	const struct periodic_task_handler **handlers;		/**< The list of handlers to schedule. */
+	size_t num_handlers;								/**< The number of handlers in the list. */
+	struct periodic_task_scheduler_entry *entries;		/**< Heap storage, one for each handler. */
+};
+
+
+int periodic_task_scheduler_init (struct periodic_task_scheduler *scheduler,
+	struct periodic_task_scheduler_state *state, const struct periodic_task_handler **handlers,
+	size_t num_handlers, struct periodic_task_scheduler_entry *entries);
+int periodic_task_scheduler_init_state (const struct periodic_task_scheduler *scheduler);
+void periodic_task_scheduler_release (const struct periodic_task_scheduler *scheduler);
+
+int periodic_task_scheduler_prepare (const struct periodic_task_scheduler *scheduler);
+int periodic_task_scheduler_execute_due_handlers (const struct periodic_task_scheduler *scheduler);
+int periodic_task_scheduler_notify (const struct periodic_task_scheduler *scheduler);
+int periodic_task_scheduler_notify_from_isr (const struct periodic_task_scheduler *scheduler);
+
+int periodic_task_scheduler_get_stats (const struct periodic_task_scheduler *scheduler,
+	const struct periodic_task_handler *handler, struct periodic_task_scheduler_stats *stats);
+
+
+#endif	/* PERIODIC_TASK_SCHEDULER_H_ */
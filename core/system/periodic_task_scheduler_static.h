@@ -0,0 +1,29 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef PERIODIC_TASK_SCHEDULER_STATIC_H_
+#define PERIODIC_TASK_SCHEDULER_STATIC_H_
+
+#include "system/periodic_task_scheduler.h"
+
+
+/**
+ * Initialize a static instance of a periodic task scheduler.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the scheduler.
+ * @param handlers_ptr The list of handlers to schedule.
+ * @param count The number of handlers in the list.
+ * @param entries_ptr Storage for the scheduling heap.  This must have space for the same number of
+ * entries as the handler list.
+ */
+#define	periodic_task_scheduler_static_init(state_ptr, handlers_ptr, count, entries_ptr)	{ \
+		.state = state_ptr, \
+		.handlers = handlers_ptr, \
+		.num_handlers = count, \
+		.entries = entries_ptr, \
+	}
+
+
+#endif	/* PERIODIC_TASK_SCHEDULER_STATIC_H_ */
@@ -671,6 +671,100 @@ static void attestation_responder_test_get_digests (CuTest *test)
 	complete_attestation_responder_mock_test (test, &attestation);
 }
 
+static void attestation_responder_test_get_digests_digest_cache (CuTest *test)
+{
+	int status;
+	struct attestation_responder_testing attestation;
+	struct riot_key_manager_digest cache[2];
+	uint8_t buf[32 * 4] = {0};
+	uint8_t cert_hash[2][32 * 4];
+	uint8_t num_cert = 0;
+	uint8_t *dev_id_der = NULL;
+	int i;
+	int j;
+
+	TEST_START;
+
+	for (i = 0; i < (int) sizeof (cert_hash[0]); i++) {
+		cert_hash[0][i] = i;
+		cert_hash[1][i] = ~i;
+	}
+
+	setup_attestation_responder_mock_test (test, &attestation);
+
+	attestation_testing_add_int_ca_to_riot_key_manager (test, &attestation.riot,
+		&attestation.keystore, &attestation.x509);
+
+	status = riot_key_manager_enable_digest_cache (&attestation.riot, cache, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The first request calculates the digests and the second uses the cached values.  After the
+	 * stored certificates are verified, the digests must be calculated again. */
+	for (i = 0; i < 3; i++) {
+		j = (i == 2) ? 1 : 0;
+
+		if (i == 2) {
+			status = mock_expect (&attestation.keystore.mock, attestation.keystore.base.load_key,
+				&attestation.keystore, KEYSTORE_NO_KEY, MOCK_ARG (0), MOCK_ARG_NOT_NULL,
+				MOCK_ARG_NOT_NULL);
+			status |= mock_expect_output (&attestation.keystore.mock, 1, &dev_id_der,
+				sizeof (dev_id_der), -1);
+
+			CuAssertIntEquals (test, 0, status);
+
+			status = riot_key_manager_verify_stored_certs (&attestation.riot);
+			CuAssertIntEquals (test, RIOT_KEY_MANAGER_NO_SIGNED_DEVICE_ID, status);
+		}
+
+		if (i != 1) {
+			status = mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+				&attestation.hash, 0,
+				MOCK_ARG_PTR_CONTAINS (X509_CERTSS_RSA_CA_NOPL_DER,
+				X509_CERTSS_RSA_CA_NOPL_DER_LEN), MOCK_ARG (X509_CERTSS_RSA_CA_NOPL_DER_LEN),
+				MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+			status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[j][0], 32, -1);
+
+			status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+				&attestation.hash, 0,
+				MOCK_ARG_PTR_CONTAINS (X509_CERTCA_ECC_CA_NOPL_DER,
+				X509_CERTCA_ECC_CA_NOPL_DER_LEN), MOCK_ARG (X509_CERTCA_ECC_CA_NOPL_DER_LEN),
+				MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+			status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[j][32], 32, -1);
+
+			status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+				&attestation.hash, 0,
+				MOCK_ARG_PTR_CONTAINS (RIOT_CORE_DEVID_INTR_SIGNED_CERT,
+				RIOT_CORE_DEVID_INTR_SIGNED_CERT_LEN),
+				MOCK_ARG (RIOT_CORE_DEVID_INTR_SIGNED_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+			status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[j][64], 32, -1);
+
+			status |= mock_expect (&attestation.hash.mock, attestation.hash.base.calculate_sha256,
+				&attestation.hash, 0,
+				MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_CERT, RIOT_CORE_ALIAS_CERT_LEN),
+				MOCK_ARG (RIOT_CORE_ALIAS_CERT_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG (32));
+			status |= mock_expect_output (&attestation.hash.mock, 2, &cert_hash[j][96], 32, -1);
+
+			CuAssertIntEquals (test, 0, status);
+		}
+
+		memset (buf, 0, sizeof (buf));
+		num_cert = 0;
+
+		status = attestation.responder.get_digests (&attestation.responder, 0, buf, sizeof (buf),
+			&num_cert);
+		CuAssertIntEquals (test, sizeof (cert_hash[j]), status);
+		CuAssertIntEquals (test, 4, num_cert);
+
+		status = testing_validate_array (cert_hash[j], buf, sizeof (cert_hash[j]));
+		CuAssertIntEquals (test, 0, status);
+
+		status = mock_validate (&attestation.hash.mock);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	complete_attestation_responder_mock_test (test, &attestation);
+}
+
 static void attestation_responder_test_get_digests_no_aux (CuTest *test)
 {
 	int status;
@@ -4130,6 +4224,7 @@ TEST (attestation_responder_test_init_no_aux_init_keypair_fail);
 TEST (attestation_responder_test_init_no_aux_null);
 TEST (attestation_responder_test_release_null);
 TEST (attestation_responder_test_get_digests);
+TEST (attestation_responder_test_get_digests_digest_cache);
 TEST (attestation_responder_test_get_digests_no_aux);
 TEST (attestation_responder_test_get_digests_aux_slot);
 TEST (attestation_responder_test_get_digests_aux_slot_no_aux);
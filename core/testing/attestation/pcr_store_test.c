@@ -27,6 +27,14 @@ struct pcr_store_testing {
 	struct pcr_store test;					/**< PCR store under test. */
 };
 
+/**
+ * Context for counting requests for measured data.
+ */
+struct pcr_store_testing_data_counter {
+	uint32_t data;	/**< The measured data to return. */
+	int calls;		/**< The number of times measured data was requested. */
+};
+
 
 /**
  * Initialize dependencies for testing PCR storage.
@@ -157,6 +165,36 @@ static void pcr_store_testing_mock_pcr_compute (CuTest *test, struct pcr_store_t
 }
 
 
+/**
+ * Callback function to provide measured data and count the number of requests.
+ *
+ * @param context The data counter context.
+ * @param offset The offset for the requested data.
+ * @param buffer Output buffer for the data.
+ * @param length Size of the output buffer.
+ * @param total_len Total length of measurement data.
+ *
+ * @return The number of bytes returned.
+ */
+static int pcr_store_testing_counted_data_callback (void *context, size_t offset,
+	uint8_t *buffer, size_t length, uint32_t *total_len)
+{
+	struct pcr_store_testing_data_counter *counter = context;
+	int bytes = sizeof (counter->data) - offset;
+
+	counter->calls++;
+	*total_len = sizeof (counter->data);
+
+	if (bytes <= 0) {
+		return 0;
+	}
+
+	bytes = (bytes <= (int) length) ? bytes : (int) length;
+	memcpy (buffer, &((uint8_t*) &counter->data)[offset], bytes);
+
+	return bytes;
+}
+
 /*******************
  * Test cases
  *******************/
@@ -7234,6 +7272,139 @@ static void pcr_store_test_get_attestation_log_compute_pcr_fail (CuTest *test)
 	pcr_store_testing_release (test, &store);
 }
 
+static void pcr_store_test_get_attestation_log_multiple_reads (CuTest *test)
+{
+	struct pcr_store_testing store;
+	const struct pcr_config pcr_config[] = {
+		{
+			.num_measurements = 4,
+			.measurement_algo = HASH_TYPE_SHA256
+		},
+		{
+			.num_measurements = 2,
+			.measurement_algo = HASH_TYPE_SHA256
+		}
+	};
+	uint8_t digests[6][SHA256_HASH_LENGTH] = {
+		{
+			0x24,0x80,0x93,0x84,0x92,0xaa,0x6c,0xbf,0x73,0xbe,0x56,0xa2,0xb7,0x45,0x46,0x36,
+			0xdf,0x10,0xe5,0xaf,0xbc,0x3f,0x92,0xf2,0x72,0x77,0x23,0x33,0x6a,0xc6,0x23,0x39
+		},
+		{
+			0x47,0x67,0xee,0xd7,0xd0,0xe2,0xcf,0xf9,0x03,0x91,0xe5,0x8f,0x33,0xd1,0x50,0x35,
+			0x27,0xac,0x95,0xab,0xc8,0x25,0x66,0x00,0x64,0x68,0x83,0x32,0xb5,0xb6,0xeb,0x52
+		},
+		{
+			0xaa,0x13,0xc5,0xb7,0x11,0xd9,0xd5,0x74,0xfb,0xc4,0x49,0x11,0x42,0x62,0x48,0x94,
+			0x33,0x82,0x5e,0x48,0x3d,0x0c,0x79,0x91,0xd4,0xc0,0x89,0xb0,0x75,0x38,0xb2,0x37
+		},
+		{
+			0xe7,0x11,0x78,0x3f,0xf8,0xdb,0xb8,0x8c,0x3d,0xad,0x3e,0xc9,0xcb,0x5b,0x4b,0x51,
+			0xe9,0x43,0xe9,0x4a,0xe7,0xf0,0x82,0x61,0xf7,0x24,0x15,0x0d,0xd7,0x6e,0x89,0x6a
+		},
+		{
+			0xd5,0x3d,0x5f,0x66,0xf2,0xf8,0x10,0x07,0x14,0x79,0x59,0x77,0xe9,0x4d,0x66,0x29,
+			0xa0,0xcc,0xc3,0x13,0x86,0xf3,0xef,0x63,0xb7,0x4c,0x17,0xac,0x1a,0xa7,0xdb,0x24
+		},
+		{
+			0x26,0xb5,0xef,0xb0,0x9c,0xcd,0x4c,0x6e,0x4c,0xde,0xbe,0x9d,0xff,0x87,0xcf,0xcf,
+			0x62,0x02,0xa1,0x1f,0x65,0x42,0x24,0x05,0x5a,0x48,0x89,0xa1,0x01,0x19,0x1a,0x8b
+		}
+	};
+	uint8_t measurements[6][SHA256_HASH_LENGTH] = {
+		{
+			0x30,0x1c,0x62,0x93,0x3d,0x9f,0x83,0x9d,0xf0,0xae,0x1f,0x37,0xaa,0xbb,0x2b,0x62,
+			0x92,0x29,0xab,0x4f,0x09,0x06,0xca,0x27,0x81,0xfd,0x31,0xbb,0xc9,0xf1,0xed,0xd8
+		},
+		{
+			0xc9,0x22,0xfe,0xae,0xf6,0xf4,0x58,0x25,0x42,0x41,0x9a,0xbc,0xca,0xb6,0x38,0xf5,
+			0x8b,0x1d,0x3c,0xb8,0xdb,0x8a,0xcc,0xf7,0x7a,0x85,0xdb,0xc8,0xde,0x56,0x3d,0x88
+		},
+		{
+			0x9b,0xd5,0x97,0xdb,0x66,0xb1,0x49,0x3c,0x93,0x82,0xa6,0xa5,0x24,0x86,0x9e,0x5c,
+			0x69,0xbc,0xf8,0x3e,0x21,0x79,0xca,0xb5,0x5f,0xf7,0x02,0x74,0xa5,0x07,0x49,0xc7
+		},
+		{
+			0x8f,0xfe,0xc1,0xef,0xcf,0x7c,0xc5,0x96,0x7e,0x8d,0x66,0xd9,0x35,0x53,0xa6,0x5a,
+			0xac,0xb6,0xf5,0xad,0x75,0x6c,0xa6,0xc9,0xd7,0xdf,0x4c,0x01,0x91,0xec,0x21,0x23
+		},
+		{
+			0x1d,0x21,0x09,0x96,0x64,0xcd,0x45,0x6d,0x55,0x83,0xbc,0x64,0xa1,0x25,0x04,0x1d,
+			0x76,0xcc,0x83,0x92,0xaa,0xea,0xa0,0x3e,0x0d,0xa0,0x8e,0x1e,0x11,0xd8,0xd5,0x80
+		},
+		{
+			0x51,0xf9,0x84,0x8b,0x01,0xd6,0x24,0x77,0x35,0x33,0x40,0x2c,0x68,0xd1,0x40,0x8c,
+			0x7a,0x04,0x7b,0x45,0xdd,0xa7,0xa5,0xa6,0x95,0x84,0x1c,0xf8,0x14,0x2c,0x4d,0xfa
+		}
+	};
+	struct pcr_store_attestation_log_entry_sha256 expected[6];
+	uint8_t output[sizeof (expected) + 32];
+	size_t offset;
+	size_t reads;
+	uint16_t measurement_type;
+	size_t i;
+	size_t j;
+	size_t k;
+	int status;
+
+	TEST_START;
+
+	CuAssertIntEquals (test, sizeof (digests[0]), sizeof (measurements[0]));
+
+	pcr_store_testing_init (test, &store, pcr_config, ARRAY_SIZE (pcr_config));
+
+	/* Each PCR only needs to be computed once.  Subsequent reads of the log use the cached
+	 * measurement values, since none of the measurements have changed. */
+	for (k = 0, j = 0; k < ARRAY_SIZE (pcr_config); k++) {
+		pcr_store_testing_mock_pcr_compute (test, &store, digests[j], measurements[j],
+			sizeof (digests[0]), pcr_config[k].num_measurements, SHA256_HASH_LENGTH);
+
+		for (i = 0; i < pcr_config[k].num_measurements; i++, j++) {
+			measurement_type = PCR_MEASUREMENT (k, i);
+
+			expected[j].base.header.log_magic = 0xCB;
+			expected[j].base.header.length = sizeof (struct pcr_store_attestation_log_entry_sha256);
+			expected[j].base.header.entry_id = j;
+
+			expected[j].base.info.digest_algorithm_id = 0x0B;
+			expected[j].base.info.digest_count = 1;
+			expected[j].base.info.event_type = 0x0A + j;
+			expected[j].base.info.measurement_type = measurement_type;
+
+			expected[j].entry.measurement_size = SHA256_HASH_LENGTH;
+			memcpy (expected[j].entry.digest, digests[j], SHA256_HASH_LENGTH);
+			memcpy (expected[j].entry.measurement, measurements[j], SHA256_HASH_LENGTH);
+
+			status = pcr_store_update_digest (&store.test, measurement_type, digests[j],
+				SHA256_HASH_LENGTH);
+			status |= pcr_store_set_tcg_event_type (&store.test, measurement_type, 0x0A + j);
+			CuAssertIntEquals (test, 0, status);
+		}
+	}
+
+	offset = 0;
+	reads = 0;
+	do {
+		status = pcr_store_get_attestation_log (&store.test, &store.hash_mock.base, offset,
+			&output[offset], 32);
+		CuAssertTrue (test, !ROT_IS_ERROR (status));
+
+		offset += status;
+		reads++;
+	} while (status != 0);
+
+	CuAssertIntEquals (test, sizeof (expected), offset);
+	CuAssertIntEquals (test, (sizeof (expected) + 31) / 32 + 1, reads);
+
+	/* Without caching, every read would have extended all 6 measurements again. */
+	CuAssertIntEquals (test, 6 * 4, store.hash_mock.mock.call_count);
+
+	status = testing_validate_array ((uint8_t*) expected, output, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_store_testing_release (test, &store);
+}
+
 void pcr_store_test_get_tcg_log_sha256 (CuTest *test)
 {
 	struct pcr_store_testing store;
@@ -10219,6 +10390,249 @@ void pcr_store_test_get_tcg_log_null (CuTest *test)
 	pcr_store_testing_release (test, &store);
 }
 
+void pcr_store_test_get_tcg_log_sequential_reads (CuTest *test)
+{
+	struct pcr_store_testing store;
+	const struct pcr_config pcr_config[] = {
+		{
+			.num_measurements = 4,
+			.measurement_algo = HASH_TYPE_SHA256
+		},
+		{
+			.num_measurements = 0,
+			.measurement_algo = HASH_TYPE_SHA256
+		},
+		{
+			.num_measurements = 3,
+			.measurement_algo = HASH_TYPE_SHA384
+		}
+	};
+	uint8_t expected[1024];
+	uint8_t buffer[1024];
+	struct pcr_measured_data measurement[7];
+	uint8_t data[7][5];
+	size_t offset;
+	size_t chunk;
+	int log_length;
+	int i;
+	int status;
+
+	TEST_START;
+
+	pcr_store_testing_init (test, &store, pcr_config, ARRAY_SIZE (pcr_config));
+
+	for (i = 0; i < 7; i++) {
+		uint16_t measurement_type = (i < 4) ? PCR_MEASUREMENT (0, i) : PCR_MEASUREMENT (2, i - 4);
+
+		memset (data[i], 0x50 + i, sizeof (data[i]));
+		measurement[i].type = PCR_DATA_TYPE_MEMORY;
+		measurement[i].data.memory.buffer = data[i];
+		measurement[i].data.memory.length = i % 5 + 1;
+
+		status = pcr_store_update_buffer (&store.test, &store.hash.base, measurement_type, data[i],
+			i % 5 + 1, true);
+		CuAssertIntEquals (test, 0, status);
+
+		status = pcr_store_set_tcg_event_type (&store.test, measurement_type, 0x0A + i);
+		CuAssertIntEquals (test, 0, status);
+
+		status = pcr_store_set_measurement_data (&store.test, measurement_type, &measurement[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	log_length = pcr_store_get_tcg_log (&store.test, 0, expected, sizeof (expected));
+	CuAssertTrue (test, (log_length > 0));
+	CuAssertTrue (test, ((size_t) log_length < sizeof (expected)));
+
+	/* Use chunk sizes that will stop in different locations of each log entry. */
+	for (chunk = 1; chunk < 40; chunk += 3) {
+		memset (buffer, 0, sizeof (buffer));
+
+		offset = 0;
+		do {
+			status = pcr_store_get_tcg_log (&store.test, offset, &buffer[offset], chunk);
+			CuAssertTrue (test, !ROT_IS_ERROR (status));
+
+			offset += status;
+		} while (status != 0);
+
+		CuAssertIntEquals (test, log_length, offset);
+
+		status = testing_validate_array (expected, buffer, log_length);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	pcr_store_testing_release (test, &store);
+}
+
+void pcr_store_test_get_tcg_log_sequential_reads_measurement_changed (CuTest *test)
+{
+	struct pcr_store_testing store;
+	const struct pcr_config pcr_config[] = {
+		{
+			.num_measurements = 4,
+			.measurement_algo = HASH_TYPE_SHA256
+		},
+		{
+			.num_measurements = 2,
+			.measurement_algo = HASH_TYPE_SHA256
+		}
+	};
+	uint8_t expected[1024];
+	uint8_t buffer[1024];
+	struct pcr_measured_data measurement[6];
+	struct pcr_measured_data updated;
+	uint8_t data[16];
+	size_t offset;
+	int log_length;
+	int i;
+	int status;
+
+	TEST_START;
+
+	memset (data, 0x55, sizeof (data));
+
+	pcr_store_testing_init (test, &store, pcr_config, ARRAY_SIZE (pcr_config));
+
+	for (i = 0; i < 6; i++) {
+		uint16_t measurement_type = PCR_MEASUREMENT (i / 4, i % 4);
+
+		measurement[i].type = PCR_DATA_TYPE_1BYTE;
+		measurement[i].data.value_1byte = 0xAA + i;
+
+		status = pcr_store_set_measurement_data (&store.test, measurement_type, &measurement[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* Read past the first PCR. */
+	offset = 0;
+	do {
+		status = pcr_store_get_tcg_log (&store.test, offset, &buffer[offset], 32);
+		CuAssertIntEquals (test, 32, status);
+
+		offset += status;
+	} while (offset < (sizeof (struct pcr_tcg_event2_sha256) + 1) * 5);
+
+	/* Change the size of a measurement that was already read. */
+	updated.type = PCR_DATA_TYPE_MEMORY;
+	updated.data.memory.buffer = data;
+	updated.data.memory.length = sizeof (data);
+
+	status = pcr_store_set_measurement_data (&store.test, PCR_MEASUREMENT (0, 1), &updated);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_get_tcg_log (&store.test, offset, &buffer[offset], 32);
+	CuAssertIntEquals (test, 32, status);
+
+	/* The data must match the log with the updated measurement. */
+	log_length = pcr_store_get_tcg_log (&store.test, 0, expected, sizeof (expected));
+	CuAssertTrue (test, (log_length > 0));
+
+	status = testing_validate_array (&expected[offset], &buffer[offset], 32);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Change the digest of a measurement that has not been read. */
+	offset += 32;
+
+	status = pcr_store_update_digest (&store.test, PCR_MEASUREMENT (1, 1), SHA256_TEST_HASH,
+		SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_store_get_tcg_log (&store.test, offset, &buffer[offset], sizeof (buffer) - offset);
+	CuAssertTrue (test, (status > 0));
+
+	log_length = pcr_store_get_tcg_log (&store.test, 0, expected, sizeof (expected));
+	CuAssertIntEquals (test, offset + status, log_length);
+
+	status = testing_validate_array (&expected[offset], &buffer[offset], log_length - offset);
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_store_testing_release (test, &store);
+}
+
+void pcr_store_test_get_tcg_log_sequential_reads_entries_generated (CuTest *test)
+{
+	struct pcr_store_testing store;
+	const struct pcr_config pcr_config[] = {
+		{
+			.num_measurements = 32,
+			.measurement_algo = HASH_TYPE_SHA256
+		},
+		{
+			.num_measurements = 32,
+			.measurement_algo = HASH_TYPE_SHA384
+		}
+	};
+	uint8_t forward[8192];
+	uint8_t reverse[8192];
+	struct pcr_store_testing_data_counter counter = {
+		.data = 0x11223344,
+		.calls = 0
+	};
+	struct pcr_measured_data measurement;
+	size_t offset;
+	size_t log_length;
+	int forward_calls;
+	int reverse_calls;
+	int reads;
+	int i;
+	int status;
+
+	TEST_START;
+
+	measurement.type = PCR_DATA_TYPE_CALLBACK;
+	measurement.data.callback.get_data = pcr_store_testing_counted_data_callback;
+	measurement.data.callback.hash_data = NULL;
+	measurement.data.callback.context = &counter;
+
+	pcr_store_testing_init (test, &store, pcr_config, ARRAY_SIZE (pcr_config));
+
+	for (i = 0; i < 64; i++) {
+		status = pcr_store_set_measurement_data (&store.test, PCR_MEASUREMENT (i / 32, i % 32),
+			&measurement);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* Read the 64 measurement log sequentially in 32-byte chunks. */
+	offset = 0;
+	reads = 0;
+	do {
+		status = pcr_store_get_tcg_log (&store.test, offset, &forward[offset], 32);
+		CuAssertTrue (test, !ROT_IS_ERROR (status));
+
+		offset += status;
+		reads++;
+	} while (status != 0);
+
+	log_length = offset;
+	forward_calls = counter.calls;
+	CuAssertTrue (test, (log_length < sizeof (forward)));
+
+	/* Read the log again in reverse, which requires every read to regenerate the log starting from
+	 * the beginning.  This matches the cost of every read without saving the read location. */
+	counter.calls = 0;
+	offset = log_length;
+	while (offset > 0) {
+		size_t chunk = (offset % 32) ? (offset % 32) : 32;
+
+		offset -= chunk;
+		status = pcr_store_get_tcg_log (&store.test, offset, &reverse[offset], chunk);
+		CuAssertIntEquals (test, chunk, status);
+	}
+
+	reverse_calls = counter.calls;
+
+	status = testing_validate_array (forward, reverse, log_length);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Each sequential read only needs data for the entries it returns.  Only the first read and any
+	 * read spanning two entries requests data for more than one measurement. */
+	CuAssertTrue (test, (forward_calls <= (reads + 64)));
+	CuAssertTrue (test, (reverse_calls > (forward_calls * 10)));
+
+	pcr_store_testing_release (test, &store);
+}
+
 static void pcr_store_test_set_dmtf_value_type (CuTest *test)
 {
 	struct pcr_store_testing store;
@@ -10944,6 +11358,7 @@ TEST (pcr_store_test_get_attestation_log_small_buffer_nonzero_offset);
 TEST (pcr_store_test_get_attestation_log_invalid_offset);
 TEST (pcr_store_test_get_attestation_log_null);
 TEST (pcr_store_test_get_attestation_log_compute_pcr_fail);
+TEST (pcr_store_test_get_attestation_log_multiple_reads);
 TEST (pcr_store_test_get_tcg_log_sha256);
 #if defined HASH_ENABLE_SHA384 && (PCR_MAX_DIGEST_LENGTH >= SHA384_HASH_LENGTH)
 TEST (pcr_store_test_get_tcg_log_sha384);
@@ -10972,6 +11387,9 @@ TEST (pcr_store_test_get_tcg_log_offset_skip_event);
 TEST (pcr_store_test_get_tcg_log_offset_into_event);
 TEST (pcr_store_test_get_tcg_log_offset_only_one_event);
 TEST (pcr_store_test_get_tcg_log_null);
+TEST (pcr_store_test_get_tcg_log_sequential_reads);
+TEST (pcr_store_test_get_tcg_log_sequential_reads_measurement_changed);
+TEST (pcr_store_test_get_tcg_log_sequential_reads_entries_generated);
 TEST (pcr_store_test_set_dmtf_value_type);
 TEST (pcr_store_test_set_dmtf_value_type_null);
 TEST (pcr_store_test_set_dmtf_value_type_invalid_pcr);
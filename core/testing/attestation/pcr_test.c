@@ -5875,6 +5875,283 @@ static void pcr_test_compute_finish_hash_fail (CuTest *test)
 	pcr_testing_release (test, &pcr);
 }
 
+static void pcr_test_compute_no_changes (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t measurement[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 3, HASH_TYPE_SHA256);
+
+	status = pcr_update_digest (&pcr.test, 0, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_update_digest (&pcr.test, 2, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, NULL, 0);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	/* No measurements have changed, so no hashing is necessary. */
+	status = pcr_compute (&pcr.test, &pcr.hash_mock.base, true, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = testing_validate_array (PCR_TESTING_SHA256_PCR_MEASUREMENT2, measurement, status);
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_compute_after_update_digest (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t measurement[SHA256_HASH_LENGTH];
+	const struct pcr_measurement *measurement_list;
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 3, HASH_TYPE_SHA256);
+
+	status = pcr_update_digest (&pcr.test, 0, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, NULL, 0);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = pcr_update_digest (&pcr.test, 2, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Only the last measurement needs to be extended. */
+	status = mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.start_sha256, &pcr.hash_mock, 0);
+
+	status |= mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.update, &pcr.hash_mock, 0,
+		MOCK_ARG_PTR_CONTAINS (PCR_TESTING_SHA256_PCR_MEASUREMENT1, SHA256_HASH_LENGTH),
+		MOCK_ARG (SHA256_HASH_LENGTH));
+
+	status |= mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.update, &pcr.hash_mock, 0,
+		MOCK_ARG_PTR_CONTAINS (SHA256_TEST2_HASH, SHA256_HASH_LENGTH),
+		MOCK_ARG (SHA256_HASH_LENGTH));
+
+	status |= mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.finish, &pcr.hash_mock, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG_AT_LEAST (SHA256_HASH_LENGTH));
+	status |= mock_expect_output (&pcr.hash_mock.mock, 0, PCR_TESTING_SHA256_PCR_MEASUREMENT2,
+		SHA256_HASH_LENGTH, -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash_mock.base, true, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = testing_validate_array (PCR_TESTING_SHA256_PCR_MEASUREMENT2, measurement, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_get_all_measurements (&pcr.test, &measurement_list);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = testing_validate_array (PCR_TESTING_SHA256_PCR_MEASUREMENT0,
+		measurement_list[0].measurement, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (PCR_TESTING_SHA256_PCR_MEASUREMENT1,
+		measurement_list[1].measurement, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (PCR_TESTING_SHA256_PCR_MEASUREMENT2,
+		measurement_list[2].measurement, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_compute_after_update_buffer (CuTest *test)
+{
+	struct pcr_testing pcr;
+	struct pcr_bank full;
+	const struct pcr_config config = {
+		.num_measurements = 3,
+		.measurement_algo = HASH_TYPE_SHA256
+	};
+	uint8_t measurement[SHA256_HASH_LENGTH];
+	uint8_t expected[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 3, HASH_TYPE_SHA256);
+
+	status = pcr_update_digest (&pcr.test, 0, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, NULL, 0);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = pcr_update_buffer (&pcr.test, &pcr.hash.base, 2, HASH_TESTING_FULL_BLOCK_512,
+		HASH_TESTING_FULL_BLOCK_512_LEN, false);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	/* Compare against a full calculation with a new PCR. */
+	status = pcr_init (&full, &config);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_update_digest (&full, 0, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_update_buffer (&full, &pcr.hash.base, 2, HASH_TESTING_FULL_BLOCK_512,
+		HASH_TESTING_FULL_BLOCK_512_LEN, false);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&full, &pcr.hash.base, true, expected, sizeof (expected));
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	pcr_release (&full);
+
+	status = testing_validate_array (expected, measurement, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_compute_after_invalidate_measurement (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t measurement[SHA256_HASH_LENGTH];
+	uint8_t zeros[SHA256_HASH_LENGTH] = {0};
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 3, HASH_TYPE_SHA256);
+
+	status = pcr_update_digest (&pcr.test, 0, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_update_digest (&pcr.test, 2, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, NULL, 0);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = pcr_invalidate_measurement (&pcr.test, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Only the invalidated measurement needs to be extended. */
+	status = mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.start_sha256, &pcr.hash_mock, 0);
+
+	status |= mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.update, &pcr.hash_mock, 0,
+		MOCK_ARG_PTR_CONTAINS (PCR_TESTING_SHA256_PCR_MEASUREMENT1, SHA256_HASH_LENGTH),
+		MOCK_ARG (SHA256_HASH_LENGTH));
+
+	status |= mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.update, &pcr.hash_mock, 0,
+		MOCK_ARG_PTR_CONTAINS (zeros, sizeof (zeros)), MOCK_ARG (sizeof (zeros)));
+
+	status |= mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.finish, &pcr.hash_mock, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG_AT_LEAST (SHA256_HASH_LENGTH));
+	status |= mock_expect_output (&pcr.hash_mock.mock, 0, SHA256_FULL_BLOCK_512_HASH,
+		SHA256_HASH_LENGTH, -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash_mock.base, true, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = testing_validate_array (SHA256_FULL_BLOCK_512_HASH, measurement, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_update_digest (&pcr.test, 2, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = testing_validate_array (PCR_TESTING_SHA256_PCR_MEASUREMENT2, measurement, status);
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_compute_constant_update_fail (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t measurement[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 3, HASH_TYPE_SHA256);
+
+	status = pcr_update_digest (&pcr.test, 0, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_const_update_digest (&pcr.test, 2, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, NULL, 0);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = pcr_update_digest (&pcr.test, 2, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, PCR_CONSTANT_MEASUREMENT, status);
+
+	status = pcr_invalidate_measurement (&pcr.test, 2);
+	CuAssertIntEquals (test, PCR_CONSTANT_MEASUREMENT, status);
+
+	/* The measurement was not changed, so no hashing is necessary. */
+	status = pcr_compute (&pcr.test, &pcr.hash_mock.base, true, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = testing_validate_array (PCR_TESTING_SHA256_PCR_MEASUREMENT2, measurement, status);
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_compute_after_hash_fail (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t measurement[SHA256_HASH_LENGTH];
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 3, HASH_TYPE_SHA256);
+
+	status = pcr_update_digest (&pcr.test, 0, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, NULL, 0);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = pcr_update_digest (&pcr.test, 1, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&pcr.hash_mock.mock, pcr.hash_mock.base.start_sha256, &pcr.hash_mock,
+		HASH_ENGINE_START_SHA256_FAILED);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash_mock.base, true, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, HASH_ENGINE_START_SHA256_FAILED, status);
+
+	/* Restore the original digest.  The failed measurement must still be extended. */
+	status = pcr_invalidate_measurement (&pcr.test, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_update_digest (&pcr.test, 2, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, measurement, sizeof (measurement));
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	status = testing_validate_array (PCR_TESTING_SHA256_PCR_MEASUREMENT2, measurement, status);
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_testing_release (test, &pcr);
+}
+
 static void pcr_test_lock_then_unlock (CuTest *test)
 {
 	struct pcr_testing pcr;
@@ -24625,6 +24902,303 @@ static void pcr_test_get_tcg_log_get_measured_data_fail (CuTest *test)
 	pcr_testing_release (test, &pcr);
 }
 
+static void pcr_test_get_tcg_log_from_position (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t buffer[512];
+	uint8_t digests[5][SHA256_HASH_LENGTH] = {
+		{
+			0xab,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0xcd,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0xef,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0x12,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+		{
+			0x23,0xe6,0xe6,0x4f,0x38,0x13,0x4f,0x82,0x18,0x33,0xf6,0x5b,0x12,0xc7,0xe7,0x6e,
+			0x7f,0xe6,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x9c,0x4f,0x7f,0x38,0x7f,0x6e
+		},
+	};
+	struct pcr_tcg_event2_sha256 *event = (struct pcr_tcg_event2_sha256*) buffer;
+	struct pcr_measured_data measurement[5];
+	struct pcr_tcg_log_position position;
+	const size_t entry_len = sizeof (struct pcr_tcg_event2_sha256) + sizeof (uint8_t);
+	size_t total_len;
+	int i_measurement;
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 5, HASH_TYPE_SHA256);
+
+	for (i_measurement = 0; i_measurement < 5; ++i_measurement) {
+		measurement[i_measurement].type = PCR_DATA_TYPE_1BYTE;
+		measurement[i_measurement].data.value_1byte = 0xAA + i_measurement;
+
+		status = pcr_update_digest (&pcr.test, i_measurement, digests[i_measurement],
+			SHA256_HASH_LENGTH);
+		CuAssertIntEquals (test, 0, status);
+
+		status = pcr_set_tcg_event_type (&pcr.test, i_measurement, 0x0A + i_measurement);
+		CuAssertIntEquals (test, 0, status);
+
+		status = pcr_set_measurement_data (&pcr.test, i_measurement, &measurement[i_measurement]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	position.measurement = 2;
+	position.offset = 0;
+
+	status = pcr_get_tcg_log_from_position (&pcr.test, 0, &position, 0, buffer, sizeof (buffer),
+		&total_len);
+	CuAssertIntEquals (test, entry_len * 3, status);
+	CuAssertIntEquals (test, entry_len * 3, total_len);
+	CuAssertIntEquals (test, 4, position.measurement);
+	CuAssertIntEquals (test, entry_len * 2, position.offset);
+
+	for (i_measurement = 2; i_measurement < 5; ++i_measurement) {
+		CuAssertIntEquals (test, 0, event->header.pcr_index);
+		CuAssertIntEquals (test, 0x0A + i_measurement, event->header.event_type);
+		CuAssertIntEquals (test, 1, event->header.digest_count);
+		CuAssertIntEquals (test, PCR_TCG_SHA256_ALG_ID, event->header.digest_algorithm_id);
+		CuAssertIntEquals (test, 1, event->event_size);
+		CuAssertIntEquals (test, 0xAA + i_measurement,
+			(((uint8_t*) event) + sizeof (struct pcr_tcg_event2_sha256))[0]);
+
+		status = testing_validate_array (digests[i_measurement], event->digest, SHA256_HASH_LENGTH);
+		CuAssertIntEquals (test, 0, status);
+
+		event = (struct pcr_tcg_event2_sha256*) ((uint8_t*) (event + 1) + 1);
+	}
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_get_tcg_log_from_position_with_offset (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t buffer[512];
+	uint8_t expected[512];
+	struct pcr_measured_data measurement[5];
+	struct pcr_tcg_log_position position;
+	const size_t entry_len = sizeof (struct pcr_tcg_event2_sha256) + sizeof (uint8_t);
+	size_t total_len;
+	int i_measurement;
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 5, HASH_TYPE_SHA256);
+
+	for (i_measurement = 0; i_measurement < 5; ++i_measurement) {
+		measurement[i_measurement].type = PCR_DATA_TYPE_1BYTE;
+		measurement[i_measurement].data.value_1byte = 0xAA + i_measurement;
+
+		status = pcr_update_digest (&pcr.test, i_measurement, SHA256_TEST_HASH,
+			SHA256_HASH_LENGTH);
+		CuAssertIntEquals (test, 0, status);
+
+		status = pcr_set_tcg_event_type (&pcr.test, i_measurement, 0x0A + i_measurement);
+		CuAssertIntEquals (test, 0, status);
+
+		status = pcr_set_measurement_data (&pcr.test, i_measurement, &measurement[i_measurement]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = pcr_get_tcg_log (&pcr.test, 0, 0, expected, sizeof (expected), &total_len);
+	CuAssertIntEquals (test, entry_len * 5, status);
+
+	/* Start in the middle of the header for the measurement 2 entry and end on the event data. */
+	position.measurement = 1;
+	position.offset = 0;
+
+	status = pcr_get_tcg_log_from_position (&pcr.test, 0, &position, entry_len + 10, buffer,
+		entry_len - 10, &total_len);
+	CuAssertIntEquals (test, entry_len - 10, status);
+	CuAssertIntEquals (test, 2, position.measurement);
+	CuAssertIntEquals (test, entry_len, position.offset);
+
+	status = testing_validate_array (&expected[(entry_len * 2) + 10], buffer, entry_len - 10);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Start in the event data for measurement 3 and end in the middle of the measurement 4 header. */
+	position.measurement = 3;
+	position.offset = 0;
+
+	status = pcr_get_tcg_log_from_position (&pcr.test, 0, &position, entry_len - 1, buffer, 10,
+		&total_len);
+	CuAssertIntEquals (test, 10, status);
+	CuAssertIntEquals (test, 4, position.measurement);
+	CuAssertIntEquals (test, entry_len, position.offset);
+
+	status = testing_validate_array (&expected[(entry_len * 4) - 1], buffer, 10);
+	CuAssertIntEquals (test, 0, status);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_get_tcg_log_from_position_zero_bytes_read (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t buffer[512];
+	struct pcr_measured_data measurement[5];
+	struct pcr_tcg_log_position position;
+	const size_t entry_len = sizeof (struct pcr_tcg_event2_sha256) + sizeof (uint8_t);
+	size_t total_len;
+	int i_measurement;
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 5, HASH_TYPE_SHA256);
+
+	for (i_measurement = 0; i_measurement < 5; ++i_measurement) {
+		measurement[i_measurement].type = PCR_DATA_TYPE_1BYTE;
+		measurement[i_measurement].data.value_1byte = 0xAA + i_measurement;
+
+		status = pcr_set_measurement_data (&pcr.test, i_measurement, &measurement[i_measurement]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	position.measurement = 3;
+	position.offset = 0x1234;
+
+	status = pcr_get_tcg_log_from_position (&pcr.test, 0, &position, entry_len * 2, buffer,
+		sizeof (buffer), &total_len);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, entry_len * 2, total_len);
+	CuAssertIntEquals (test, 3, position.measurement);
+	CuAssertIntEquals (test, 0x1234, position.offset);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_get_tcg_log_from_position_null (CuTest *test)
+{
+	struct pcr_testing pcr;
+	uint8_t buffer[512];
+	struct pcr_tcg_log_position position = {0};
+	size_t total_len;
+	int status;
+
+	TEST_START;
+
+	pcr_testing_init (test, &pcr, 5, HASH_TYPE_SHA256);
+
+	status = pcr_get_tcg_log_from_position (NULL, 0, &position, 0, buffer, sizeof (buffer),
+		&total_len);
+	CuAssertIntEquals (test, PCR_INVALID_ARGUMENT, status);
+
+	status = pcr_get_tcg_log_from_position (&pcr.test, 0, NULL, 0, buffer, sizeof (buffer),
+		&total_len);
+	CuAssertIntEquals (test, PCR_INVALID_ARGUMENT, status);
+
+	status = pcr_get_tcg_log_from_position (&pcr.test, 0, &position, 0, NULL, sizeof (buffer),
+		&total_len);
+	CuAssertIntEquals (test, PCR_INVALID_ARGUMENT, status);
+
+	status = pcr_get_tcg_log_from_position (&pcr.test, 0, &position, 0, buffer, sizeof (buffer),
+		NULL);
+	CuAssertIntEquals (test, PCR_INVALID_ARGUMENT, status);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_get_generation (CuTest *test)
+{
+	struct pcr_testing pcr;
+	struct pcr_measured_data measurement;
+	uint32_t generation;
+	uint32_t prev;
+	int status;
+
+	TEST_START;
+
+	measurement.type = PCR_DATA_TYPE_1BYTE;
+	measurement.data.value_1byte = 0xAA;
+
+	pcr_testing_init (test, &pcr, 3, HASH_TYPE_SHA256);
+
+	prev = pcr_get_generation (&pcr.test);
+
+	status = pcr_update_digest (&pcr.test, 0, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	generation = pcr_get_generation (&pcr.test);
+	CuAssertTrue (test, (generation != prev));
+	prev = generation;
+
+	status = pcr_update_buffer (&pcr.test, &pcr.hash.base, 1, HASH_TESTING_FULL_BLOCK_512,
+		HASH_TESTING_FULL_BLOCK_512_LEN, false);
+	CuAssertIntEquals (test, 0, status);
+
+	generation = pcr_get_generation (&pcr.test);
+	CuAssertTrue (test, (generation != prev));
+	prev = generation;
+
+	status = pcr_invalidate_measurement (&pcr.test, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	generation = pcr_get_generation (&pcr.test);
+	CuAssertTrue (test, (generation != prev));
+	prev = generation;
+
+	status = pcr_set_tcg_event_type (&pcr.test, 2, 0x0A);
+	CuAssertIntEquals (test, 0, status);
+
+	generation = pcr_get_generation (&pcr.test);
+	CuAssertTrue (test, (generation != prev));
+	prev = generation;
+
+	status = pcr_set_measurement_data (&pcr.test, 2, &measurement);
+	CuAssertIntEquals (test, 0, status);
+
+	generation = pcr_get_generation (&pcr.test);
+	CuAssertTrue (test, (generation != prev));
+	prev = generation;
+
+	status = pcr_const_update_digest (&pcr.test, 2, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	generation = pcr_get_generation (&pcr.test);
+	CuAssertTrue (test, (generation != prev));
+	prev = generation;
+
+	/* Failed updates do not change the generation. */
+	status = pcr_update_digest (&pcr.test, 2, SHA256_TEST2_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, PCR_CONSTANT_MEASUREMENT, status);
+
+	status = pcr_invalidate_measurement (&pcr.test, 2);
+	CuAssertIntEquals (test, PCR_CONSTANT_MEASUREMENT, status);
+
+	generation = pcr_get_generation (&pcr.test);
+	CuAssertIntEquals (test, prev, generation);
+
+	/* Reading measurements does not change the generation. */
+	status = pcr_compute (&pcr.test, &pcr.hash.base, true, NULL, 0);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, status);
+
+	generation = pcr_get_generation (&pcr.test);
+	CuAssertIntEquals (test, prev, generation);
+
+	pcr_testing_release (test, &pcr);
+}
+
+static void pcr_test_get_generation_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertIntEquals (test, 0, pcr_get_generation (NULL));
+}
 
 // *INDENT-OFF*
 TEST_SUITE_START (pcr);
@@ -24879,6 +25453,12 @@ TEST (pcr_test_compute_sha512_start_hash_fail);
 TEST (pcr_test_compute_hash_fail);
 TEST (pcr_test_compute_extend_hash_fail);
 TEST (pcr_test_compute_finish_hash_fail);
+TEST (pcr_test_compute_no_changes);
+TEST (pcr_test_compute_after_update_digest);
+TEST (pcr_test_compute_after_update_buffer);
+TEST (pcr_test_compute_after_invalidate_measurement);
+TEST (pcr_test_compute_constant_update_fail);
+TEST (pcr_test_compute_after_hash_fail);
 TEST (pcr_test_lock_then_unlock);
 TEST (pcr_test_lock_null);
 TEST (pcr_test_unlock_null);
@@ -25357,6 +25937,12 @@ TEST (pcr_test_get_tcg_log_small_buffer_with_offset);
 TEST (pcr_test_get_tcg_log_short_buffer_middle_of_event_header);
 TEST (pcr_test_get_tcg_log_null);
 TEST (pcr_test_get_tcg_log_get_measured_data_fail);
+TEST (pcr_test_get_tcg_log_from_position);
+TEST (pcr_test_get_tcg_log_from_position_with_offset);
+TEST (pcr_test_get_tcg_log_from_position_zero_bytes_read);
+TEST (pcr_test_get_tcg_log_from_position_null);
+TEST (pcr_test_get_generation);
+TEST (pcr_test_get_generation_null);
 
 TEST_SUITE_END;
 // *INDENT-ON*
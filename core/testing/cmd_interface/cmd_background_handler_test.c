@@ -16,10 +16,12 @@
 #include "testing/asn1/x509_testing.h"
 #include "testing/attestation/aux_attestation_testing.h"
 #include "testing/cmd_interface/config_reset_testing.h"
+#include "testing/crypto/hash_testing.h"
 #include "testing/engines/hash_testing_engine.h"
 #include "testing/logging/debug_log_testing.h"
 #include "testing/mock/attestation/attestation_responder_mock.h"
 #include "testing/mock/common/authorized_execution_mock.h"
+#include "testing/mock/crypto/ecc_mock.h"
 #include "testing/mock/crypto/rsa_mock.h"
 #include "testing/mock/logging/logging_mock.h"
 #include "testing/mock/system/event_task_mock.h"
@@ -288,6 +290,8 @@ static void cmd_background_handler_test_init (CuTest *test)
 #endif
 	CuAssertPtrNotNull (test, handler.test.base_cmd.authenticate_riot_certs);
 	CuAssertPtrNotNull (test, handler.test.base_cmd.get_riot_cert_chain_state);
+	CuAssertPtrNotNull (test, handler.test.base_cmd.alias_sign_start);
+	CuAssertPtrNotNull (test, handler.test.base_cmd.alias_sign_result);
 	CuAssertPtrNotNull (test, handler.test.base_cmd.reboot_device);
 
 	CuAssertPtrEquals (test, NULL, handler.test.base_event.prepare);
@@ -351,6 +355,8 @@ static void cmd_background_handler_test_static_init (CuTest *test)
 #endif
 	CuAssertPtrNotNull (test, test_static.base_cmd.authenticate_riot_certs);
 	CuAssertPtrNotNull (test, test_static.base_cmd.get_riot_cert_chain_state);
+	CuAssertPtrNotNull (test, test_static.base_cmd.alias_sign_start);
+	CuAssertPtrNotNull (test, test_static.base_cmd.alias_sign_result);
 	CuAssertPtrNotNull (test, test_static.base_cmd.reboot_device);
 
 	CuAssertPtrEquals (test, NULL, test_static.base_event.prepare);
@@ -1881,6 +1887,382 @@ static void cmd_background_handler_test_authenticate_riot_certs_notify_error (Cu
 	cmd_background_handler_testing_validate_and_release (test, &handler);
 }
 
+static void cmd_background_handler_test_alias_sign_start (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	struct cmd_background_handler_alias_sign *sign =
+		(struct cmd_background_handler_alias_sign*) handler.context.event_buffer;
+	int status;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.get_event_context, &handler.task, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&handler.task.mock, 0, &handler.context_ptr,
+		sizeof (handler.context_ptr), -1);
+
+	status |= mock_expect (&handler.task.mock, handler.task.base.notify, &handler.task, 0,
+		MOCK_ARG_PTR (&handler.test.base_event));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd, &handler.keys.ecc.base,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN, handler.context.action);
+	CuAssertIntEquals (test, sizeof (struct cmd_background_handler_alias_sign),
+		handler.context.buffer_length);
+	CuAssertPtrEquals (test, &handler.keys.ecc.base, sign->ecc);
+	CuAssertIntEquals (test, SHA256_HASH_LENGTH, sign->length);
+
+	status = testing_validate_array (SHA256_TEST_HASH, sign->digest, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_RUNNING, sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_alias_sign_start_static_init (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	struct cmd_background_handler test_static = cmd_background_handler_static_init (&handler.state,
+		&handler.attestation.base, &handler.hash.base, &handler.keys.riot, &handler.task.base);
+	struct cmd_background_handler_alias_sign *sign =
+		(struct cmd_background_handler_alias_sign*) handler.context.event_buffer;
+	int status;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init_static (test, &handler, &test_static);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.get_event_context, &handler.task, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&handler.task.mock, 0, &handler.context_ptr,
+		sizeof (handler.context_ptr), -1);
+
+	status |= mock_expect (&handler.task.mock, handler.task.base.notify, &handler.task, 0,
+		MOCK_ARG_PTR (&test_static.base_event));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = test_static.base_cmd.alias_sign_start (&test_static.base_cmd, &handler.keys.ecc.base,
+		SHA384_TEST_HASH, SHA384_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN, handler.context.action);
+	CuAssertIntEquals (test, sizeof (struct cmd_background_handler_alias_sign),
+		handler.context.buffer_length);
+	CuAssertPtrEquals (test, &handler.keys.ecc.base, sign->ecc);
+	CuAssertIntEquals (test, SHA384_HASH_LENGTH, sign->length);
+
+	status = testing_validate_array (SHA384_TEST_HASH, sign->digest, SHA384_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = test_static.base_cmd.alias_sign_result (&test_static.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_RUNNING, sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	cmd_background_handler_testing_release_dependencies (test, &handler);
+	cmd_background_handler_release (&test_static);
+}
+
+static void cmd_background_handler_test_alias_sign_start_null (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	status = handler.test.base_cmd.alias_sign_start (NULL, &handler.keys.ecc.base,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, CMD_BACKGROUND_INVALID_ARGUMENT, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd, NULL,
+		SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, CMD_BACKGROUND_INVALID_ARGUMENT, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd,
+		&handler.keys.ecc.base, NULL, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, CMD_BACKGROUND_INVALID_ARGUMENT, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd,
+		&handler.keys.ecc.base, SHA256_TEST_HASH, 0);
+	CuAssertIntEquals (test, CMD_BACKGROUND_INVALID_ARGUMENT, status);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_alias_sign_start_digest_too_long (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+	uint8_t digest[HASH_MAX_HASH_LEN + 1];
+
+	TEST_START;
+
+	memset (digest, 0x55, sizeof (digest));
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd,
+		&handler.keys.ecc.base, digest, sizeof (digest));
+	CuAssertIntEquals (test, CMD_BACKGROUND_INPUT_TOO_BIG, status);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_alias_sign_start_no_task (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+	void *null_ptr = NULL;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+	handler.context_ptr = NULL;
+
+	status = mock_expect (&handler.task.mock, handler.task.base.get_event_context, &handler.task,
+		EVENT_TASK_NO_TASK, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&handler.task.mock, 0, &null_ptr, sizeof (null_ptr), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd,
+		&handler.keys.ecc.base, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, CMD_BACKGROUND_NO_TASK, status);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test,
+		(((CMD_BACKGROUND_NO_TASK & 0x00ffffff) << 8) | CMD_BACKGROUND_SIGN_STATUS_TASK_NOT_RUNNING),
+		sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_alias_sign_start_task_busy (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+	void *null_ptr = NULL;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+	handler.context_ptr = NULL;
+
+	status = mock_expect (&handler.task.mock, handler.task.base.get_event_context, &handler.task,
+		EVENT_TASK_BUSY, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&handler.task.mock, 0, &null_ptr, sizeof (null_ptr), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd,
+		&handler.keys.ecc.base, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, CMD_BACKGROUND_TASK_BUSY, status);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_NONE_STARTED, sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_alias_sign_start_get_context_error (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+	void *null_ptr = NULL;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+	handler.context_ptr = NULL;
+
+	status = mock_expect (&handler.task.mock, handler.task.base.get_event_context, &handler.task,
+		EVENT_TASK_GET_CONTEXT_FAILED, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&handler.task.mock, 0, &null_ptr, sizeof (null_ptr), -1);
+
+	/* Need to lock while updating the status. */
+	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd,
+		&handler.keys.ecc.base, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, EVENT_TASK_GET_CONTEXT_FAILED, status);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test,
+		(((EVENT_TASK_GET_CONTEXT_FAILED & 0x00ffffff) << 8) |
+			CMD_BACKGROUND_SIGN_STATUS_INTERNAL_ERROR),
+		sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_alias_sign_start_notify_error (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.get_event_context, &handler.task, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&handler.task.mock, 0, &handler.context_ptr,
+		sizeof (handler.context_ptr), -1);
+
+	status |= mock_expect (&handler.task.mock, handler.task.base.notify, &handler.task,
+		EVENT_TASK_NOTIFY_FAILED, MOCK_ARG_PTR (&handler.test.base_event));
+
+	/* Need to lock while updating the status. */
+	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd,
+		&handler.keys.ecc.base, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, EVENT_TASK_NOTIFY_FAILED, status);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test,
+		(((EVENT_TASK_NOTIFY_FAILED & 0x00ffffff) << 8) | CMD_BACKGROUND_SIGN_STATUS_INTERNAL_ERROR),
+		sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_alias_sign_result (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_NONE_STARTED, sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_alias_sign_result_null (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	status = handler.test.base_cmd.alias_sign_result (NULL, signature, &sig_length, &sign_status,
+		NULL);
+	CuAssertIntEquals (test, CMD_BACKGROUND_INVALID_ARGUMENT, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, NULL, &sig_length,
+		&sign_status, NULL);
+	CuAssertIntEquals (test, CMD_BACKGROUND_INVALID_ARGUMENT, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature, NULL,
+		&sign_status, NULL);
+	CuAssertIntEquals (test, CMD_BACKGROUND_INVALID_ARGUMENT, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, NULL, NULL);
+	CuAssertIntEquals (test, CMD_BACKGROUND_INVALID_ARGUMENT, status);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
 static void cmd_background_handler_test_reboot_device (CuTest *test)
 {
 	struct cmd_background_handler_testing handler;
@@ -3463,6 +3845,255 @@ static void cmd_background_handler_test_execute_authenticate_riot_certs_static_i
 	cmd_background_handler_release (&test_static);
 }
 
+static void cmd_background_handler_test_execute_alias_sign (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	struct cmd_background_handler_alias_sign sign;
+	struct ecc_public_key alias_key;
+	int status;
+	bool reset = false;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+	uint32_t sign_time = 0xffffffff;
+
+	TEST_START;
+
+	memset (&sign, 0, sizeof (sign));
+	sign.ecc = &handler.keys.ecc.base;
+	sign.length = SHA256_HASH_LENGTH;
+	memcpy (sign.digest, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	/* Lock for state update: CMD_BACKGROUND_SIGN_STATUS_SUCCESS */
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	handler.context.action = CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN;
+	handler.context.buffer_length = sizeof (sign);
+	memcpy (handler.context.event_buffer, &sign, sizeof (sign));
+
+	handler.test.base_event.execute (&handler.test.base_event, handler.context_ptr, &reset);
+	CuAssertIntEquals (test, 0, reset);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, &sign_time);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_SUCCESS, sign_status);
+	CuAssertTrue (test, (sig_length > 0));
+	CuAssertTrue (test, (sign_time != 0xffffffff));
+
+	status = handler.keys.ecc.base.init_public_key (&handler.keys.ecc.base,
+		RIOT_CORE_ALIAS_PUBLIC_KEY, RIOT_CORE_ALIAS_PUBLIC_KEY_LEN, &alias_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.keys.ecc.base.verify (&handler.keys.ecc.base, &alias_key, SHA256_TEST_HASH,
+		SHA256_HASH_LENGTH, signature, sig_length);
+	CuAssertIntEquals (test, 0, status);
+
+	handler.keys.ecc.base.release_key_pair (&handler.keys.ecc.base, NULL, &alias_key);
+
+	/* The signature can only be retrieved once. */
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	sig_length = sizeof (signature);
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_NONE_STARTED, sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_execute_alias_sign_static_init (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	struct cmd_background_handler test_static = cmd_background_handler_static_init (&handler.state,
+		&handler.attestation.base, &handler.hash.base, &handler.keys.riot, &handler.task.base);
+	struct cmd_background_handler_alias_sign sign;
+	struct ecc_public_key alias_key;
+	int status;
+	bool reset = false;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	memset (&sign, 0, sizeof (sign));
+	sign.ecc = &handler.keys.ecc.base;
+	sign.length = SHA384_HASH_LENGTH;
+	memcpy (sign.digest, SHA384_TEST_HASH, SHA384_HASH_LENGTH);
+
+	cmd_background_handler_testing_init_static (test, &handler, &test_static);
+
+	/* Lock for state update: CMD_BACKGROUND_SIGN_STATUS_SUCCESS */
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	handler.context.action = CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN;
+	handler.context.buffer_length = sizeof (sign);
+	memcpy (handler.context.event_buffer, &sign, sizeof (sign));
+
+	test_static.base_event.execute (&test_static.base_event, handler.context_ptr, &reset);
+	CuAssertIntEquals (test, 0, reset);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = test_static.base_cmd.alias_sign_result (&test_static.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_SUCCESS, sign_status);
+
+	status = handler.keys.ecc.base.init_public_key (&handler.keys.ecc.base,
+		RIOT_CORE_ALIAS_PUBLIC_KEY, RIOT_CORE_ALIAS_PUBLIC_KEY_LEN, &alias_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.keys.ecc.base.verify (&handler.keys.ecc.base, &alias_key, SHA384_TEST_HASH,
+		SHA384_HASH_LENGTH, signature, sig_length);
+	CuAssertIntEquals (test, 0, status);
+
+	handler.keys.ecc.base.release_key_pair (&handler.keys.ecc.base, NULL, &alias_key);
+
+	cmd_background_handler_testing_release_dependencies (test, &handler);
+	cmd_background_handler_release (&test_static);
+}
+
+static void cmd_background_handler_test_execute_alias_sign_result_buffer_too_small (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	struct cmd_background_handler_alias_sign sign;
+	int status;
+	bool reset = false;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = 8;
+	uint32_t sign_status;
+
+	TEST_START;
+
+	memset (&sign, 0, sizeof (sign));
+	sign.ecc = &handler.keys.ecc.base;
+	sign.length = SHA256_HASH_LENGTH;
+	memcpy (sign.digest, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	/* Lock for state update: CMD_BACKGROUND_SIGN_STATUS_SUCCESS */
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	handler.context.action = CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN;
+	handler.context.buffer_length = sizeof (sign);
+	memcpy (handler.context.event_buffer, &sign, sizeof (sign));
+
+	handler.test.base_event.execute (&handler.test.base_event, handler.context_ptr, &reset);
+	CuAssertIntEquals (test, 0, reset);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, CMD_BACKGROUND_BUF_TOO_SMALL, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_SUCCESS, sign_status);
+	CuAssertIntEquals (test, 8, sig_length);
+
+	/* The signature is still available with a larger buffer. */
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	sig_length = sizeof (signature);
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CMD_BACKGROUND_SIGN_STATUS_SUCCESS, sign_status);
+	CuAssertTrue (test, (sig_length > 8));
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
+static void cmd_background_handler_test_execute_alias_sign_failure (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	struct ecc_engine_mock ecc;
+	struct cmd_background_handler_alias_sign sign;
+	int status;
+	bool reset = false;
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	status = ecc_mock_init (&ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&sign, 0, sizeof (sign));
+	sign.ecc = &ecc.base;
+	sign.length = SHA256_HASH_LENGTH;
+	memcpy (sign.digest, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	status = mock_expect (&ecc.mock, ecc.base.init_key_pair, &ecc, ECC_ENGINE_KEY_PAIR_FAILED,
+		MOCK_ARG_PTR_CONTAINS (RIOT_CORE_ALIAS_KEY, RIOT_CORE_ALIAS_KEY_LEN),
+		MOCK_ARG (RIOT_CORE_ALIAS_KEY_LEN), MOCK_ARG_NOT_NULL, MOCK_ARG_PTR (NULL));
+
+	/* Lock for state update: CMD_BACKGROUND_SIGN_STATUS_FAILURE */
+	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	handler.context.action = CMD_BACKGROUND_HANDLER_ACTION_ALIAS_SIGN;
+	handler.context.buffer_length = sizeof (sign);
+	memcpy (handler.context.event_buffer, &sign, sizeof (sign));
+
+	handler.test.base_event.execute (&handler.test.base_event, handler.context_ptr, &reset);
+	CuAssertIntEquals (test, 0, reset);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test,
+		(((ECC_ENGINE_KEY_PAIR_FAILED & 0x00ffffff) << 8) | CMD_BACKGROUND_SIGN_STATUS_FAILURE),
+		sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	status = ecc_mock_validate_and_release (&ecc);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
 static void cmd_background_handler_test_execute_reboot_device (CuTest *test)
 {
 	struct cmd_background_handler_testing handler;
@@ -3976,6 +4607,82 @@ static void cmd_background_handler_test_execute_unknown_action_riot_auth_active
 	cmd_background_handler_testing_validate_and_release (test, &handler);
 }
 
+static void cmd_background_handler_test_execute_unknown_action_alias_sign_active (CuTest *test)
+{
+	struct cmd_background_handler_testing handler;
+	int status;
+	bool reset = false;
+	struct debug_log_entry_info entry = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_WARNING,
+		.component = DEBUG_LOG_COMPONENT_CMD_INTERFACE,
+		.msg_index = CMD_LOGGING_NOTIFICATION_ERROR,
+		.arg1 = 0x100,
+		.arg2 = 0
+	};
+	uint8_t signature[ECC_DER_ECDSA_MAX_LENGTH];
+	size_t sig_length = sizeof (signature);
+	uint32_t sign_status;
+
+	TEST_START;
+
+	cmd_background_handler_testing_init (test, &handler);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.get_event_context, &handler.task, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&handler.task.mock, 0, &handler.context_ptr,
+		sizeof (handler.context_ptr), -1);
+
+	status |= mock_expect (&handler.task.mock, handler.task.base.notify, &handler.task, 0,
+		MOCK_ARG_PTR (&handler.test.base_event));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_start (&handler.test.base_cmd,
+		&handler.keys.ecc.base, SHA256_TEST_HASH, SHA256_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Corrupt the action. */
+	handler.context.action = 0x100;
+
+	status = mock_expect (&handler.log.mock, handler.log.base.create_entry, &handler.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry)));
+
+	/* Lock for state update: CMD_BACKGROUND_SIGN_STATUS_INTERNAL_ERROR */
+	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	handler.test.base_event.execute (&handler.test.base_event, handler.context_ptr, &reset);
+	CuAssertIntEquals (test, 0, reset);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.alias_sign_result (&handler.test.base_cmd, signature,
+		&sig_length, &sign_status, NULL);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test,
+		(((CMD_BACKGROUND_UNSUPPORTED_OP & 0x00ffffff) << 8) |
+			CMD_BACKGROUND_SIGN_STATUS_INTERNAL_ERROR),
+		sign_status);
+	CuAssertIntEquals (test, 0, sig_length);
+
+	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
+	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = handler.test.base_cmd.get_riot_cert_chain_state (&handler.test.base_cmd);
+	CuAssertIntEquals (test, RIOT_CERT_STATE_CHAIN_INVALID, status);
+
+	cmd_background_handler_testing_validate_and_release (test, &handler);
+}
+
 static void cmd_background_handler_test_execute_unknown_action_static_init (CuTest *test)
 {
 	struct cmd_background_handler_testing handler;
@@ -4111,6 +4818,16 @@ TEST (cmd_background_handler_test_authenticate_riot_certs_no_task);
 TEST (cmd_background_handler_test_authenticate_riot_certs_task_busy);
 TEST (cmd_background_handler_test_authenticate_riot_certs_get_context_error);
 TEST (cmd_background_handler_test_authenticate_riot_certs_notify_error);
+TEST (cmd_background_handler_test_alias_sign_start);
+TEST (cmd_background_handler_test_alias_sign_start_static_init);
+TEST (cmd_background_handler_test_alias_sign_start_null);
+TEST (cmd_background_handler_test_alias_sign_start_digest_too_long);
+TEST (cmd_background_handler_test_alias_sign_start_no_task);
+TEST (cmd_background_handler_test_alias_sign_start_task_busy);
+TEST (cmd_background_handler_test_alias_sign_start_get_context_error);
+TEST (cmd_background_handler_test_alias_sign_start_notify_error);
+TEST (cmd_background_handler_test_alias_sign_result);
+TEST (cmd_background_handler_test_alias_sign_result_null);
 TEST (cmd_background_handler_test_reboot_device);
 TEST (cmd_background_handler_test_reboot_device_static_init);
 TEST (cmd_background_handler_test_reboot_device_null);
@@ -4152,6 +4869,10 @@ TEST (cmd_background_handler_test_execute_debug_log_fill_static_init);
 TEST (cmd_background_handler_test_execute_authenticate_riot_certs);
 TEST (cmd_background_handler_test_execute_authenticate_riot_certs_failure);
 TEST (cmd_background_handler_test_execute_authenticate_riot_certs_static_init);
+TEST (cmd_background_handler_test_execute_alias_sign);
+TEST (cmd_background_handler_test_execute_alias_sign_static_init);
+TEST (cmd_background_handler_test_execute_alias_sign_result_buffer_too_small);
+TEST (cmd_background_handler_test_execute_alias_sign_failure);
 TEST (cmd_background_handler_test_execute_reboot_device);
 TEST (cmd_background_handler_test_execute_reboot_device_static_init);
 #ifdef ATTESTATION_SUPPORT_RSA_UNSEAL
@@ -4167,6 +4888,7 @@ TEST (cmd_background_handler_test_execute_unknown_action_unseal_active);
 TEST (cmd_background_handler_test_execute_unknown_action_config_reset_active);
 #endif
 TEST (cmd_background_handler_test_execute_unknown_action_riot_auth_active);
+TEST (cmd_background_handler_test_execute_unknown_action_alias_sign_active);
 TEST (cmd_background_handler_test_execute_unknown_action_static_init);
 
 TEST_SUITE_END;
@@ -12,6 +12,74 @@
 TEST_SUITE_LABEL ("checksum");
 
 
+/**
+ * Reference bit-by-bit implementation of SMBus CRC8 to check the optimized implementations.
+ *
+ * @param crc The initial CRC value.
+ * @param data The data to process.
+ * @param len Length of the data.
+ *
+ * @return The resulting CRC8.
+ */
+static uint8_t checksum_testing_reference_crc8 (uint8_t crc, const uint8_t *data, size_t len)
+{
+	size_t i;
+	int j;
+
+	for (i = 0; i < len; i++) {
+		crc ^= data[i];
+
+		for (j = 0; j < 8; j++) {
+			crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ 0x07) : (uint8_t) (crc << 1);
+		}
+	}
+
+	return crc;
+}
+
+/**
+ * Reference bit-by-bit implementation of CRC-32C to check the optimized implementations.
+ *
+ * @param data The data to process.
+ * @param len Length of the data.
+ *
+ * @return The resulting CRC-32C.
+ */
+static uint32_t checksum_testing_reference_crc32c (const uint8_t *data, size_t len)
+{
+	uint32_t crc = 0xffffffff;
+	size_t i;
+	int j;
+
+	for (i = 0; i < len; i++) {
+		crc ^= data[i];
+
+		for (j = 0; j < 8; j++) {
+			crc = (crc & 1) ? ((crc >> 1) ^ 0x82f63b78) : (crc >> 1);
+		}
+	}
+
+	return ~crc;
+}
+
+/**
+ * Fill a buffer with deterministic pseudo-random data.
+ *
+ * @param seed Seed for the random sequence.  This will be updated with the next seed.
+ * @param buffer The buffer to fill.
+ * @param length Length of the buffer.
+ */
+static void checksum_testing_random_data (uint32_t *seed, uint8_t *buffer, size_t length)
+{
+	size_t i;
+
+	for (i = 0; i < length; i++) {
+		*seed = (*seed * 1103515245) + 12345;
+		buffer[i] = *seed >> 16;
+	}
+}
+
+
 /*******************
  * Test cases
  *******************/
@@ -126,6 +194,153 @@ static void checksum_test_update_smbus_crc8_zero_length (CuTest *test)
 }
 
 
+static void checksum_test_update_smbus_crc8_random_data (CuTest *test)
+{
+	uint8_t buf[255];
+	uint32_t seed = 0x1234;
+	uint8_t crc;
+	uint8_t expected;
+	int i;
+
+	TEST_START;
+
+	/* Cover every length with random data and initial CRC values. */
+	for (i = 0; i <= 255; i++) {
+		checksum_testing_random_data (&seed, buf, i);
+
+		expected = checksum_testing_reference_crc8 (seed & 0xff, buf, i);
+		crc = checksum_update_smbus_crc8 (seed & 0xff, buf, i);
+		CuAssertIntEquals (test, expected, crc);
+	}
+}
+
+static void checksum_test_update_smbus_crc8_unaligned (CuTest *test)
+{
+	uint8_t buf[64];
+	uint32_t seed = 0xcafe;
+	uint8_t crc;
+	uint8_t expected;
+	int i;
+
+	TEST_START;
+
+	checksum_testing_random_data (&seed, buf, sizeof (buf));
+
+	for (i = 0; i < 8; i++) {
+		expected = checksum_testing_reference_crc8 (0, &buf[i], sizeof (buf) - i);
+		crc = checksum_update_smbus_crc8 (0, &buf[i], sizeof (buf) - i);
+		CuAssertIntEquals (test, expected, crc);
+	}
+}
+
+static void checksum_test_crc32c (CuTest *test)
+{
+	const char *check = "123456789";
+	uint8_t zero[32] = {0};
+	uint8_t ones[32];
+	uint8_t inc[32];
+	uint32_t crc;
+	int i;
+
+	TEST_START;
+
+	memset (ones, 0xff, sizeof (ones));
+	for (i = 0; i < (int) sizeof (inc); i++) {
+		inc[i] = i;
+	}
+
+	crc = checksum_crc32c ((const uint8_t*) check, strlen (check));
+	CuAssertIntEquals (test, 0xe3069283, crc);
+
+	/* Test vectors from RFC 3720, Appendix B.4. */
+	crc = checksum_crc32c (zero, sizeof (zero));
+	CuAssertIntEquals (test, 0x8a9136aa, crc);
+
+	crc = checksum_crc32c (ones, sizeof (ones));
+	CuAssertIntEquals (test, 0x62a8ab43, crc);
+
+	crc = checksum_crc32c (inc, sizeof (inc));
+	CuAssertIntEquals (test, 0x46dd794e, crc);
+}
+
+static void checksum_test_crc32c_null (CuTest *test)
+{
+	uint32_t crc;
+
+	TEST_START;
+
+	crc = checksum_crc32c (NULL, 16);
+	CuAssertIntEquals (test, 0, crc);
+}
+
+static void checksum_test_crc32c_zero_length (CuTest *test)
+{
+	uint8_t buf[4] = {0x01, 0x02, 0x03, 0x04};
+	uint32_t crc;
+
+	TEST_START;
+
+	crc = checksum_crc32c (buf, 0);
+	CuAssertIntEquals (test, 0, crc);
+}
+
+static void checksum_test_crc32c_random_data (CuTest *test)
+{
+	uint8_t buf[1024];
+	uint32_t seed = 0x5678;
+	uint32_t crc;
+	uint32_t expected;
+	size_t i;
+
+	TEST_START;
+
+	for (i = 0; i <= 64; i++) {
+		checksum_testing_random_data (&seed, buf, i);
+
+		expected = checksum_testing_reference_crc32c (buf, i);
+		crc = checksum_crc32c (buf, i);
+		CuAssertIntEquals (test, expected, crc);
+	}
+
+	for (i = 1; i < sizeof (buf); i += 61) {
+		checksum_testing_random_data (&seed, buf, i);
+
+		expected = checksum_testing_reference_crc32c (&buf[1], i - 1);
+		crc = checksum_crc32c (&buf[1], i - 1);
+		CuAssertIntEquals (test, expected, crc);
+	}
+}
+
+static void checksum_test_update_crc32c (CuTest *test)
+{
+	uint8_t buf[300];
+	uint32_t seed = 0x9abc;
+	uint32_t crc;
+	uint32_t expected;
+
+	TEST_START;
+
+	checksum_testing_random_data (&seed, buf, sizeof (buf));
+	expected = checksum_crc32c (buf, sizeof (buf));
+
+	crc = checksum_update_crc32c (0, buf, 7);
+	crc = checksum_update_crc32c (crc, &buf[7], 0);
+	crc = checksum_update_crc32c (crc, &buf[7], 150);
+	crc = checksum_update_crc32c (crc, &buf[157], sizeof (buf) - 157);
+	CuAssertIntEquals (test, expected, crc);
+}
+
+static void checksum_test_update_crc32c_null (CuTest *test)
+{
+	uint32_t crc;
+
+	TEST_START;
+
+	crc = checksum_update_crc32c (0x55, NULL, 16);
+	CuAssertIntEquals (test, 0x55, crc);
+}
+
+
 // *INDENT-OFF*
 TEST_SUITE_START (checksum);
 
@@ -136,6 +351,14 @@ TEST (checksum_test_init_smbus_crc8);
 TEST (checksum_test_update_smbus_crc8);
 TEST (checksum_test_update_smbus_crc8_null);
 TEST (checksum_test_update_smbus_crc8_zero_length);
+TEST (checksum_test_update_smbus_crc8_random_data);
+TEST (checksum_test_update_smbus_crc8_unaligned);
+TEST (checksum_test_crc32c);
+TEST (checksum_test_crc32c_null);
+TEST (checksum_test_crc32c_zero_length);
+TEST (checksum_test_crc32c_random_data);
+TEST (checksum_test_update_crc32c);
+TEST (checksum_test_update_crc32c_null);
 
 TEST_SUITE_END;
 // *INDENT-ON*
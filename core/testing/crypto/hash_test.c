@@ -3302,6 +3302,130 @@ static void hash_test_calculate_sha512_small_buffer (CuTest *test)
 }
 #endif
 
+static void hash_test_clone_context (CuTest *test)
+{
+	HASH_TESTING_ENGINE engine;
+	HASH_TESTING_ENGINE clone;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = HASH_TESTING_ENGINE_INIT (&clone);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_clone_context (&engine.base, &clone.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = clone.base.update (&clone.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = clone.base.finish (&clone.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&engine);
+	HASH_TESTING_ENGINE_RELEASE (&clone);
+}
+
+static void hash_test_clone_context_null (CuTest *test)
+{
+	struct hash_engine_mock engine;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_clone_context (NULL, &engine.base);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_clone_context (&engine.base, NULL);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_clone_context (&engine.base, &engine.base);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = hash_mock_validate_and_release (&engine);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void hash_test_clone_context_save_error (CuTest *test)
+{
+	struct hash_engine_mock engine;
+	struct hash_engine_mock clone;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_mock_init (&clone);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&engine.mock, engine.base.save_context, &engine,
+		HASH_ENGINE_NO_ACTIVE_HASH, MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_clone_context (&engine.base, &clone.base);
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	status = hash_mock_validate_and_release (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_mock_validate_and_release (&clone);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void hash_test_clone_context_restore_error (CuTest *test)
+{
+	struct hash_engine_mock engine;
+	struct hash_engine_mock clone;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_mock_init (&clone);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&engine.mock, engine.base.save_context, &engine, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect (&clone.mock, clone.base.restore_context, &clone,
+		HASH_ENGINE_HASH_IN_PROGRESS, MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_clone_context (&engine.base, &clone.base);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_IN_PROGRESS, status);
+
+	status = hash_mock_validate_and_release (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_mock_validate_and_release (&clone);
+	CuAssertIntEquals (test, 0, status);
+}
+
 static void hash_test_get_hash_length (CuTest *test)
 {
 	int status;
@@ -3543,6 +3667,10 @@ TEST (hash_test_calculate_sha384_small_buffer);
 #ifdef HASH_ENABLE_SHA512
 TEST (hash_test_calculate_sha512_small_buffer);
 #endif
+TEST (hash_test_clone_context);
+TEST (hash_test_clone_context_null);
+TEST (hash_test_clone_context_save_error);
+TEST (hash_test_clone_context_restore_error);
 TEST (hash_test_get_hash_length);
 TEST (hash_test_get_hash_length_unsupported);
 TEST (hash_test_hmac_get_hmac_length);
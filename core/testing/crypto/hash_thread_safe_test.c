@@ -1212,6 +1212,219 @@ static void hash_thread_safe_test_get_hash_null (CuTest *test)
 }
 
 
+static void hash_thread_safe_test_save_context (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.start_sha256, &mock, 0);
+	status |= mock_expect (&mock.mock, mock.base.save_context, &mock, 0, MOCK_ARG_PTR (&context));
+	status |= mock_expect (&mock.mock, mock.base.cancel, &mock, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_save_context_error (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.start_sha256, &mock, 0);
+	status |= mock_expect (&mock.mock, mock.base.save_context, &mock, HASH_ENGINE_NO_ACTIVE_HASH,
+		MOCK_ARG_PTR (&context));
+	status |= mock_expect (&mock.mock, mock.base.cancel, &mock, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_save_context_null (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.start_sha256, &mock, 0);
+	status |= mock_expect (&mock.mock, mock.base.cancel, &mock, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (NULL, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_restore_context (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.restore_context, &mock, 0,
+		MOCK_ARG_PTR (&context));
+	status |= mock_expect (&mock.mock, mock.base.cancel, &mock, 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_restore_context_error (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&mock.mock, mock.base.restore_context, &mock,
+		HASH_ENGINE_INVALID_CONTEXT, MOCK_ARG_PTR (&context));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_CONTEXT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
+static void hash_thread_safe_test_restore_context_null (CuTest *test)
+{
+	struct hash_engine_thread_safe engine;
+	struct hash_engine_mock mock;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_thread_safe_init (&engine, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_context (NULL, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check lock has been released. */
+	engine.base.start_sha256 (&engine.base);
+
+	hash_mock_release (&mock);
+	hash_thread_safe_release (&engine);
+}
+
 // *INDENT-OFF*
 TEST_SUITE_START (hash_thread_safe);
 
@@ -1252,6 +1465,12 @@ TEST (hash_thread_safe_test_cancel_null);
 TEST (hash_thread_safe_test_get_hash);
 TEST (hash_thread_safe_test_get_hash_error);
 TEST (hash_thread_safe_test_get_hash_null);
+TEST (hash_thread_safe_test_save_context);
+TEST (hash_thread_safe_test_save_context_error);
+TEST (hash_thread_safe_test_save_context_null);
+TEST (hash_thread_safe_test_restore_context);
+TEST (hash_thread_safe_test_restore_context_error);
+TEST (hash_thread_safe_test_restore_context_null);
 
 TEST_SUITE_END;
 // *INDENT-ON*
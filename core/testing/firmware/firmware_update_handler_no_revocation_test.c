@@ -1225,7 +1225,7 @@ static void firmware_update_handler_no_revocation_test_execute_prepare_staging (
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -1331,7 +1331,7 @@ static void firmware_update_handler_no_revocation_test_execute_prepare_staging_k
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -1378,7 +1378,7 @@ static void firmware_update_handler_no_revocation_test_execute_prepare_staging_s
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -1427,7 +1427,7 @@ firmware_update_handler_no_revocation_test_execute_prepare_staging_static_init_k
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
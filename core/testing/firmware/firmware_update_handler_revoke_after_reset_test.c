@@ -2318,7 +2318,7 @@ static void firmware_update_handler_revoke_after_reset_test_execute_prepare_stag
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -2424,7 +2424,7 @@ firmware_update_handler_revoke_after_reset_test_execute_prepare_staging_keep_rec
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -2471,7 +2471,7 @@ static void firmware_update_handler_revoke_after_reset_test_execute_prepare_stag
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -2520,7 +2520,7 @@ firmware_update_handler_revoke_after_reset_test_execute_prepare_staging_static_i
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -585,7 +585,7 @@ static void firmware_update_handler_test_get_remaining_len (CuTest *test)
 	firmware_update_handler_testing_init (test, &handler, 0, 0, 0, false);
 
 	/* Need to prepare staging flash for there to be any remaining length. */
-	status = flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, 5);
+	status = flash_mock_expect_get_block_size (&handler.flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = firmware_update_prepare_staging (&handler.updater, NULL, 5);
@@ -616,7 +616,7 @@ static void firmware_update_handler_test_get_remaining_len_keep_recovery_updated
 	firmware_update_handler_testing_init_keep_recovery_updated (test, &handler, 0, 0, 0, false);
 
 	/* Need to prepare staging flash for there to be any remaining length. */
-	status = flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, 5);
+	status = flash_mock_expect_get_block_size (&handler.flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = firmware_update_prepare_staging (&handler.updater, NULL, 5);
@@ -649,7 +649,7 @@ static void firmware_update_handler_test_get_remaining_len_static_init (CuTest *
 	firmware_update_handler_testing_init_static (test, &handler, &test_static, 0, 0, 0, false);
 
 	/* Need to prepare staging flash for there to be any remaining length. */
-	status = flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, 32);
+	status = flash_mock_expect_get_block_size (&handler.flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = firmware_update_prepare_staging (&handler.updater, NULL, 32);
@@ -685,7 +685,7 @@ static void firmware_update_handler_test_get_remaining_len_static_init_keep_reco
 	firmware_update_handler_testing_init_static (test, &handler, &test_static, 0, 0, 0, false);
 
 	/* Need to prepare staging flash for there to be any remaining length. */
-	status = flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, 32);
+	status = flash_mock_expect_get_block_size (&handler.flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = firmware_update_prepare_staging (&handler.updater, NULL, 32);
@@ -3154,7 +3154,7 @@ static void firmware_update_handler_test_execute_prepare_staging (CuTest *test)
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -3255,7 +3255,7 @@ static void firmware_update_handler_test_execute_prepare_staging_keep_recovery_u
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -3298,7 +3298,7 @@ static void firmware_update_handler_test_execute_prepare_staging_static_init (Cu
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -3344,7 +3344,7 @@ static void firmware_update_handler_test_execute_prepare_staging_static_init_kee
 	status = mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
 	status |= mock_expect (&handler.task.mock, handler.task.base.unlock, &handler.task, 0);
 
-	status |= flash_mock_expect_erase_flash_verify (&handler.flash, 0x30000, bytes);
+	status |= flash_mock_expect_get_block_size (&handler.flash);
 
 	/* Lock for state update: 0 */
 	status |= mock_expect (&handler.task.mock, handler.task.base.lock, &handler.task, 0);
@@ -5888,7 +5888,7 @@ static void firmware_update_test_run_update_verify_incomplete_image (CuTest *tes
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000, 5);
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -15830,7 +15830,7 @@ static void firmware_update_test_run_update_no_revocation_verify_incomplete_imag
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000, 5);
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -25362,7 +25362,7 @@ static void firmware_update_test_prepare_staging (CuTest *test)
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000, 5);
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -25386,7 +25386,7 @@ static void firmware_update_test_prepare_staging_image_offset (CuTest *test)
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30100, 5);
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -25408,7 +25408,7 @@ static void firmware_update_test_prepare_staging_different_flash_devices (CuTest
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash3, 0xa0000, 5);
+	status |= flash_mock_expect_get_block_size (&updater.flash3);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -25432,7 +25432,7 @@ static void firmware_update_test_prepare_staging_static_init (CuTest *test)
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000, 5);
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -25458,7 +25458,7 @@ static void firmware_update_test_prepare_staging_static_init_no_firmware_header
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000, 5);
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -25499,7 +25499,7 @@ static void firmware_update_test_prepare_staging_null_callback (CuTest *test)
 
 	firmware_update_testing_init (test, &updater, 0, 0, 0);
 
-	status = flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000, 5);
+	status = flash_mock_expect_get_block_size (&updater.flash);
 	CuAssertIntEquals (test, 0, status);
 
 	status = firmware_update_prepare_staging (&updater.test, NULL, 5);
@@ -25854,6 +25854,44 @@ static void firmware_update_test_write_to_staging_write_fail (CuTest *test)
 	firmware_update_testing_validate_and_release (test, &updater);
 }
 
+static void firmware_update_test_write_to_staging_erase_fail (CuTest *test)
+{
+	struct firmware_update_testing updater;
+	int status;
+	uint8_t staging_data[] = {0x11, 0x12, 0x13, 0x14, 0x15};
+
+	TEST_START;
+
+	firmware_update_testing_init (test, &updater, 0, 0, 0);
+
+	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
+		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
+	status |= flash_mock_expect_get_block_size (&updater.flash);
+
+	status |= mock_expect (&updater.handler.mock, updater.handler.base.status_change,
+		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_WRITE));
+
+	status |= mock_expect (&updater.flash.mock, updater.flash.base.get_block_size, &updater.flash,
+		FLASH_BLOCK_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	status |= mock_expect (&updater.handler.mock, updater.handler.base.status_change,
+		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_WRITE_FAIL));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = firmware_update_prepare_staging (&updater.test, &updater.handler.base,
+		sizeof (staging_data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = firmware_update_write_to_staging (&updater.test, &updater.handler.base, staging_data,
+		sizeof (staging_data));
+	CuAssertIntEquals (test, FLASH_BLOCK_SIZE_FAILED, status);
+	CuAssertIntEquals (test, sizeof (staging_data),
+		firmware_update_get_update_remaining (&updater.test));
+
+	firmware_update_testing_validate_and_release (test, &updater);
+}
+
 static void firmware_update_test_write_to_staging_image_too_large (CuTest *test)
 {
 	struct firmware_update_testing updater;
@@ -25987,10 +26025,11 @@ static void firmware_update_test_multiple_prepare_and_write_cycles (CuTest *test
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000, sizeof (staging_data));
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	status |= mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_WRITE));
+	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000, sizeof (staging_data));
 	status |= mock_expect (&updater.flash.mock, updater.flash.base.write, &updater.flash,
 		sizeof (staging_data), MOCK_ARG (0x30000),
 		MOCK_ARG_PTR_CONTAINS (staging_data, sizeof (staging_data)),
@@ -25998,11 +26037,12 @@ static void firmware_update_test_multiple_prepare_and_write_cycles (CuTest *test
 
 	status |= mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000,
-		sizeof (staging_data2));
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	status |= mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_WRITE));
+	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30000,
+		sizeof (staging_data2));
 	status |= mock_expect (&updater.flash.mock, updater.flash.base.write, &updater.flash,
 		sizeof (staging_data2), MOCK_ARG (0x30000),
 		MOCK_ARG_PTR_CONTAINS (staging_data2, sizeof (staging_data2)),
@@ -26046,10 +26086,11 @@ static void firmware_update_test_multiple_prepare_and_write_cycles_image_offset
 
 	status = mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30100, sizeof (staging_data));
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	status |= mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_WRITE));
+	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30100, sizeof (staging_data));
 	status |= mock_expect (&updater.flash.mock, updater.flash.base.write, &updater.flash,
 		sizeof (staging_data), MOCK_ARG (0x30100),
 		MOCK_ARG_PTR_CONTAINS (staging_data, sizeof (staging_data)),
@@ -26057,11 +26098,12 @@ static void firmware_update_test_multiple_prepare_and_write_cycles_image_offset
 
 	status |= mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_PREP));
-	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30100,
-		sizeof (staging_data2));
+	status |= flash_mock_expect_get_block_size (&updater.flash);
 
 	status |= mock_expect (&updater.handler.mock, updater.handler.base.status_change,
 		&updater.handler, 0, MOCK_ARG (UPDATE_STATUS_STAGING_WRITE));
+	status |= flash_mock_expect_erase_flash_verify (&updater.flash, 0x30100,
+		sizeof (staging_data2));
 	status |= mock_expect (&updater.flash.mock, updater.flash.base.write, &updater.flash,
 		sizeof (staging_data2), MOCK_ARG (0x30100),
 		MOCK_ARG_PTR_CONTAINS (staging_data2, sizeof (staging_data2)),
@@ -30878,6 +30920,7 @@ TEST (firmware_update_test_write_to_staging_static_init_no_firmware_header);
 TEST (firmware_update_test_write_to_staging_null_updater);
 TEST (firmware_update_test_write_to_staging_null_callback);
 TEST (firmware_update_test_write_to_staging_write_fail);
+TEST (firmware_update_test_write_to_staging_erase_fail);
 TEST (firmware_update_test_write_to_staging_image_too_large);
 TEST (firmware_update_test_write_to_staging_image_too_large_image_offset);
 TEST (firmware_update_test_write_to_staging_partial_write);
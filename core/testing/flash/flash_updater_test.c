@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <string.h>
 #include "testing.h"
+#include "flash/flash_common.h"
 #include "flash/flash_updater.h"
 #include "testing/mock/flash/flash_mock.h"
 
@@ -1455,6 +1456,669 @@ static void flash_updater_test_write_update_data_restart_write_erase_error (CuTe
 	flash_updater_release (&updater);
 }
 
+static void flash_updater_test_prepare_for_update_lazy_erase (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x2800);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0x2800, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_prepare_for_update_lazy_erase_block (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t block_size = FLASH_BLOCK_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init (&updater, &flash.base, 0x10000, 0x20000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_block_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &block_size, sizeof (block_size), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update_erase_all (&updater, 0x18000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0x18000, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_prepare_for_update_lazy_erase_zero_length (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_expect_erase_flash_sector_verify (&flash, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update_erase_all (&updater, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_prepare_for_update_lazy_erase_sector_size_error (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x2800);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_write_update_data_lazy_erase (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+	uint8_t data1[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t data2[] = {0x05, 0x06, 0x07, 0x08, 0x09};
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x10000, 0x1000);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data1),
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data1, sizeof (data1)),
+		MOCK_ARG (sizeof (data1)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data2),
+		MOCK_ARG (0x10004), MOCK_ARG_PTR_CONTAINS (data2, sizeof (data2)),
+		MOCK_ARG (sizeof (data2)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x2800);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data1, sizeof (data1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data2, sizeof (data2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, sizeof (data1) + sizeof (data2), status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0x2800 - sizeof (data1) - sizeof (data2), status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_write_update_data_lazy_erase_cross_sector (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+	uint8_t data1[0xffc];
+	uint8_t data2[] = {0x05, 0x06, 0x07, 0x08, 0x09};
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (data1, 0x55, sizeof (data1));
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x10000, 0x1000);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data1),
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data1, sizeof (data1)),
+		MOCK_ARG (sizeof (data1)));
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x1000);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data2),
+		MOCK_ARG (0x10ffc), MOCK_ARG_PTR_CONTAINS (data2, sizeof (data2)),
+		MOCK_ARG (sizeof (data2)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x2800);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data1, sizeof (data1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data2, sizeof (data2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, sizeof (data1) + sizeof (data2), status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0x2800 - sizeof (data1) - sizeof (data2), status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_write_update_data_lazy_erase_last_data (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+	uint8_t data1[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t data2[] = {0x05, 0x06, 0x07, 0x08, 0x09};
+	uint8_t data3[] = {0x0a, 0x0b, 0x0c};
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x10000, 0x1000);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data1),
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data1, sizeof (data1)),
+		MOCK_ARG (sizeof (data1)));
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x800);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data2),
+		MOCK_ARG (0x10004), MOCK_ARG_PTR_CONTAINS (data2, sizeof (data2)),
+		MOCK_ARG (sizeof (data2)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data3),
+		MOCK_ARG (0x10009), MOCK_ARG_PTR_CONTAINS (data3, sizeof (data3)),
+		MOCK_ARG (sizeof (data3)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x1800);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data1, sizeof (data1));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Truncate the expected size to make the next write complete the update. */
+	updater.update_size = sizeof (data2);
+
+	status = flash_updater_write_update_data (&updater, data2, sizeof (data2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data3, sizeof (data3));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, sizeof (data1) + sizeof (data2) + sizeof (data3), status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, -((int) sizeof (data3)), status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_write_update_data_lazy_erase_erase_all (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+	uint8_t data1[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t data2[] = {0x05, 0x06, 0x07, 0x08};
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x10000, 0x8000);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data1),
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data1, sizeof (data1)),
+		MOCK_ARG (sizeof (data1)));
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x18000, 0x8000);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data2),
+		MOCK_ARG (0x10004), MOCK_ARG_PTR_CONTAINS (data2, sizeof (data2)),
+		MOCK_ARG (sizeof (data2)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update_erase_all (&updater, 8);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data1, sizeof (data1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data2, sizeof (data2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, sizeof (data1) + sizeof (data2), status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_write_update_data_lazy_erase_erase_all_multiple_writes (
+	CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+	uint8_t data[0x1000];
+	int i;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (data, 0x55, sizeof (data));
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	for (i = 0; i < 4; i++) {
+		status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x10000 + (i * 0x4000),
+			0x4000);
+		status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data),
+			MOCK_ARG (0x10000 + (i * sizeof (data))), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)),
+			MOCK_ARG (sizeof (data)));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update_erase_all (&updater, sizeof (data) * 4);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 4; i++) {
+		status = flash_updater_write_update_data (&updater, data, sizeof (data));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, sizeof (data) * 4, status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_write_update_data_lazy_erase_region_full (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+	uint8_t data1[] = {0x01, 0x02, 0x03, 0x04};
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x2800);
+	CuAssertIntEquals (test, 0, status);
+
+	updater.write_offset = 0x10000 - 2;
+
+	status = flash_updater_write_update_data (&updater, data1, sizeof (data1));
+	CuAssertIntEquals (test, FLASH_UPDATER_OUT_OF_SPACE, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, 0x10000 - 2, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_write_update_data_lazy_erase_erase_error (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+	uint8_t data1[] = {0x01, 0x02, 0x03, 0x04};
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.get_sector_size, &flash,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x2800);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data1, sizeof (data1));
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_remaining_bytes (&updater);
+	CuAssertIntEquals (test, 0x2800, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_erase_ahead (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+	uint8_t data1[] = {0x01, 0x02, 0x03, 0x04};
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x10000, 0x1000);
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x11000, 0x1000);
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data1),
+		MOCK_ARG (0x10000), MOCK_ARG_PTR_CONTAINS (data1, sizeof (data1)),
+		MOCK_ARG (sizeof (data1)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x2800);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_erase_ahead (&updater, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_erase_ahead (&updater, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_erase_ahead (&updater, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_write_update_data (&updater, data1, sizeof (data1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_get_bytes_written (&updater);
+	CuAssertIntEquals (test, sizeof (data1), status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_erase_ahead_region_erased (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+	uint32_t sector_size = FLASH_SECTOR_SIZE;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init_sector (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_set_lazy_erase (&updater, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &sector_size, sizeof (sector_size), -1);
+
+	status |= flash_mock_expect_erase_flash_sector_verify (&flash, 0x10000, 0x1800);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 0x1800);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_erase_ahead (&updater, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_erase_ahead (&updater, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_erase_ahead_not_lazy (CuTest *test)
+{
+	struct flash_mock flash;
+	struct flash_updater updater;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_init (&updater, &flash.base, 0x10000, 0x10000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_expect_erase_flash_verify (&flash, 0x10000, 5);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_prepare_for_update (&updater, 5);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_updater_erase_ahead (&updater, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_updater_release (&updater);
+}
+
+static void flash_updater_test_erase_ahead_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = flash_updater_erase_ahead (NULL, 0x1000);
+	CuAssertIntEquals (test, FLASH_UPDATER_INVALID_ARGUMENT, status);
+}
+
+static void flash_updater_test_set_lazy_erase_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = flash_updater_set_lazy_erase (NULL, true);
+	CuAssertIntEquals (test, FLASH_UPDATER_INVALID_ARGUMENT, status);
+}
+
 static void flash_updater_test_get_remaining_bytes_null (CuTest *test)
 {
 	struct flash_mock flash;
@@ -1756,6 +2420,22 @@ TEST (flash_updater_test_write_update_data_restart_write);
 TEST (flash_updater_test_write_update_data_restart_write_erase_all);
 TEST (flash_updater_test_write_update_data_restart_write_with_offset);
 TEST (flash_updater_test_write_update_data_restart_write_erase_error);
+TEST (flash_updater_test_prepare_for_update_lazy_erase);
+TEST (flash_updater_test_prepare_for_update_lazy_erase_block);
+TEST (flash_updater_test_prepare_for_update_lazy_erase_zero_length);
+TEST (flash_updater_test_prepare_for_update_lazy_erase_sector_size_error);
+TEST (flash_updater_test_write_update_data_lazy_erase);
+TEST (flash_updater_test_write_update_data_lazy_erase_cross_sector);
+TEST (flash_updater_test_write_update_data_lazy_erase_last_data);
+TEST (flash_updater_test_write_update_data_lazy_erase_erase_all);
+TEST (flash_updater_test_write_update_data_lazy_erase_erase_all_multiple_writes);
+TEST (flash_updater_test_write_update_data_lazy_erase_region_full);
+TEST (flash_updater_test_write_update_data_lazy_erase_erase_error);
+TEST (flash_updater_test_erase_ahead);
+TEST (flash_updater_test_erase_ahead_region_erased);
+TEST (flash_updater_test_erase_ahead_not_lazy);
+TEST (flash_updater_test_erase_ahead_null);
+TEST (flash_updater_test_set_lazy_erase_null);
 TEST (flash_updater_test_get_remaining_bytes_null);
 TEST (flash_updater_test_get_bytes_written_null);
 TEST (flash_updater_test_apply_update_offset_null);
@@ -1805,6 +1805,90 @@ static void flash_blank_check_test_not_blank (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
+static void flash_blank_check_test_multiple_blocks (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint8_t data[FLASH_VERIFICATION_BLOCK + 7];
+
+	TEST_START;
+
+	memset (data, 0xff, sizeof (data));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_VERIFICATION_BLOCK));
+	status |= mock_expect_output (&flash.mock, 1, data, FLASH_VERIFICATION_BLOCK, 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0,
+		MOCK_ARG (0x10000 + FLASH_VERIFICATION_BLOCK), MOCK_ARG_NOT_NULL, MOCK_ARG (7));
+	status |= mock_expect_output (&flash.mock, 1, &data[FLASH_VERIFICATION_BLOCK], 7, 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_blank_check (&flash.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_blank_check_test_not_blank_middle_of_block (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint8_t data[FLASH_VERIFICATION_BLOCK];
+
+	TEST_START;
+
+	memset (data, 0xff, sizeof (data));
+	data[FLASH_VERIFICATION_BLOCK / 2 + 1] = 0xfe;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_blank_check (&flash.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void flash_blank_check_test_not_blank_trailing_bytes (CuTest *test)
+{
+	struct flash_mock flash;
+	int status;
+	uint8_t data[19];
+
+	TEST_START;
+
+	memset (data, 0xff, sizeof (data));
+	data[sizeof (data) - 1] = 0x7f;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_blank_check (&flash.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, FLASH_UTIL_NOT_BLANK, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
 static void flash_blank_check_test_null (CuTest *test)
 {
 	struct flash_mock flash;
@@ -2559,13 +2643,14 @@ static void flash_copy_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_copy_test_page_size_unsupported (CuTest *test)
+static void flash_copy_test_large_page (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_BLOCK_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
 	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -2589,10 +2674,17 @@ static void flash_copy_test_page_size_unsupported (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -3793,13 +3885,14 @@ static void flash_copy_and_verify_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_copy_and_verify_test_page_size_unsupported (CuTest *test)
+static void flash_copy_and_verify_test_large_page (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_BLOCK_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
 	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -3823,10 +3916,21 @@ static void flash_copy_and_verify_test_page_size_unsupported (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -4904,14 +5008,15 @@ static void flash_copy_ext_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_copy_ext_test_page_size_unsupported (CuTest *test)
+static void flash_copy_ext_test_large_page (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_BLOCK_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
 	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -4937,10 +5042,17 @@ static void flash_copy_ext_test_page_size_unsupported (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
 
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -6359,14 +6471,15 @@ static void flash_copy_ext_and_verify_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_copy_ext_and_verify_test_page_size_unsupported (CuTest *test)
+static void flash_copy_ext_and_verify_test_large_page (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_BLOCK_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
 	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -6392,10 +6505,22 @@ static void flash_copy_ext_and_verify_test_page_size_unsupported (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
 
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -6844,6 +6969,73 @@ static void flash_copy_ext_to_blank_and_verify_test (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
+static void flash_copy_ext_to_blank_test_large_page (CuTest *test)
+{
+	struct flash_mock flash1;
+	struct flash_mock flash2;
+	int status;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
+	uint8_t data[FLASH_MAX_COPY_BLOCK * 2];
+	size_t i;
+	int offset = 0;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
+	status = flash_mock_init (&flash1);
+	CuAssertIntEquals (test, 0, status);
+	flash1.mock.name = "flash1";
+
+	status = flash_mock_init (&flash2);
+	CuAssertIntEquals (test, 0, status);
+	flash2.mock.name = "flash2";
+
+	status = mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (page), -1);
+
+	/* Pages larger than the copy buffer are written in aligned blocks of FLASH_MAX_COPY_BLOCK. */
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_MAX_COPY_BLOCK - 0x10));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_MAX_COPY_BLOCK - 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset,
+		FLASH_MAX_COPY_BLOCK - 0x10), MOCK_ARG (FLASH_MAX_COPY_BLOCK - 0x10));
+
+	offset += FLASH_MAX_COPY_BLOCK - 0x10;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (FLASH_MAX_COPY_BLOCK));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, FLASH_MAX_COPY_BLOCK,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, FLASH_MAX_COPY_BLOCK),
+		MOCK_ARG (FLASH_MAX_COPY_BLOCK));
+
+	offset += FLASH_MAX_COPY_BLOCK;
+
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000 + offset),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0x10));
+	status |= mock_expect_output (&flash1.mock, 1, data + offset, sizeof (data) - offset, 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, 0x10,
+		MOCK_ARG (0x20010 + offset), MOCK_ARG_PTR_CONTAINS (data + offset, 0x10), MOCK_ARG (0x10));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_copy_ext_to_blank (&flash2.base, 0x20010, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mock_validate_and_release (&flash2);
+	CuAssertIntEquals (test, 0, status);
+}
+
 static void flash_erase_region_and_verify_test (CuTest *test)
 {
 	struct flash_mock flash;
@@ -9662,13 +9854,14 @@ static void flash_sector_copy_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_test_large_page (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
 	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -9692,10 +9885,17 @@ static void flash_sector_copy_test_page_size_unsupported (CuTest *test)
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -10653,13 +10853,14 @@ static void flash_sector_copy_and_verify_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_and_verify_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_and_verify_test_large_page (CuTest *test)
 {
 	struct flash_mock flash;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
 	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -10683,10 +10884,21 @@ static void flash_sector_copy_and_verify_test_page_size_unsupported (CuTest *tes
 	status |= mock_expect (&flash.mock, flash.base.get_page_size, &flash, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash.mock, 0, &page, sizeof (&page), -1);
 
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy_and_verify (&flash.base, 0x20000, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash);
 	CuAssertIntEquals (test, 0, status);
@@ -11762,14 +11974,15 @@ static void flash_sector_copy_ext_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_ext_test_large_page (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
 	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -11795,10 +12008,17 @@ static void flash_sector_copy_ext_test_page_size_unsupported (CuTest *test)
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
 
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy_ext (&flash2.base, 0x20000, &flash1.base, 0x10000, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -12959,14 +13179,15 @@ static void flash_sector_copy_ext_and_verify_test_page_size_error (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 }
 
-static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest *test)
+static void flash_sector_copy_ext_and_verify_test_large_page (CuTest *test)
 {
 	struct flash_mock flash1;
 	struct flash_mock flash2;
 	int status;
 	uint32_t bytes = FLASH_SECTOR_SIZE;
-	uint32_t page = FLASH_MAX_COPY_BLOCK + 1;
+	uint32_t page = FLASH_MAX_COPY_BLOCK * 2;
 	uint8_t blank[4];
+	uint8_t data[] = {0x01, 0x02, 0x03, 0x04};
 
 	TEST_START;
 
@@ -12992,10 +13213,22 @@ static void flash_sector_copy_ext_and_verify_test_page_size_unsupported (CuTest
 	status |= mock_expect (&flash2.mock, flash2.base.get_page_size, &flash2, 0, MOCK_ARG_NOT_NULL);
 	status |= mock_expect_output (&flash2.mock, 0, &page, sizeof (&page), -1);
 
+	status |= mock_expect (&flash1.mock, flash1.base.read, &flash1, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash1.mock, 1, data, sizeof (data), 2);
+
+	status |= mock_expect (&flash2.mock, flash2.base.write, &flash2, sizeof (data),
+		MOCK_ARG (0x20000), MOCK_ARG_PTR_CONTAINS (data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&flash2.mock, flash2.base.read, &flash2, 0, MOCK_ARG (0x20000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (data)));
+	status |= mock_expect_output (&flash2.mock, 1, data, sizeof (data), 2);
+
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000, 4);
-	CuAssertIntEquals (test, FLASH_UTIL_UNSUPPORTED_PAGE_SIZE, status);
+	status = flash_sector_copy_ext_and_verify (&flash2.base, 0x20000, &flash1.base, 0x10000,
+		sizeof (data));
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_mock_validate_and_release (&flash1);
 	CuAssertIntEquals (test, 0, status);
@@ -18320,6 +18553,9 @@ TEST (flash_program_and_verify_test_error);
 TEST (flash_program_and_verify_test_verify_error);
 TEST (flash_blank_check_test);
 TEST (flash_blank_check_test_not_blank);
+TEST (flash_blank_check_test_multiple_blocks);
+TEST (flash_blank_check_test_not_blank_middle_of_block);
+TEST (flash_blank_check_test_not_blank_trailing_bytes);
 TEST (flash_blank_check_test_null);
 TEST (flash_blank_check_test_error);
 TEST (flash_copy_test);
@@ -18336,7 +18572,7 @@ TEST (flash_copy_test_no_length);
 TEST (flash_copy_test_block_check_error);
 TEST (flash_copy_test_not_blank);
 TEST (flash_copy_test_page_size_error);
-TEST (flash_copy_test_page_size_unsupported);
+TEST (flash_copy_test_large_page);
 TEST (flash_copy_test_read_error);
 TEST (flash_copy_test_write_error);
 TEST (flash_copy_test_partial_write);
@@ -18363,7 +18599,7 @@ TEST (flash_copy_and_verify_test_null);
 TEST (flash_copy_and_verify_test_block_check_error);
 TEST (flash_copy_and_verify_test_not_blank);
 TEST (flash_copy_and_verify_test_page_size_error);
-TEST (flash_copy_and_verify_test_page_size_unsupported);
+TEST (flash_copy_and_verify_test_large_page);
 TEST (flash_copy_and_verify_test_read_error);
 TEST (flash_copy_and_verify_test_write_error);
 TEST (flash_copy_and_verify_test_partial_write);
@@ -18386,7 +18622,7 @@ TEST (flash_copy_ext_test_no_length);
 TEST (flash_copy_ext_test_block_check_error);
 TEST (flash_copy_ext_test_not_blank);
 TEST (flash_copy_ext_test_page_size_error);
-TEST (flash_copy_ext_test_page_size_unsupported);
+TEST (flash_copy_ext_test_large_page);
 TEST (flash_copy_ext_test_read_error);
 TEST (flash_copy_ext_test_write_error);
 TEST (flash_copy_ext_test_partial_write);
@@ -18414,7 +18650,7 @@ TEST (flash_copy_ext_and_verify_test_null);
 TEST (flash_copy_ext_and_verify_test_block_check_error);
 TEST (flash_copy_ext_and_verify_test_not_blank);
 TEST (flash_copy_ext_and_verify_test_page_size_error);
-TEST (flash_copy_ext_and_verify_test_page_size_unsupported);
+TEST (flash_copy_ext_and_verify_test_large_page);
 TEST (flash_copy_ext_and_verify_test_read_error);
 TEST (flash_copy_ext_and_verify_test_write_error);
 TEST (flash_copy_ext_and_verify_test_partial_write);
@@ -18427,6 +18663,7 @@ TEST (flash_copy_to_blank_test);
 TEST (flash_copy_to_blank_and_verify_test);
 TEST (flash_copy_ext_to_blank_test);
 TEST (flash_copy_ext_to_blank_and_verify_test);
+TEST (flash_copy_ext_to_blank_test_large_page);
 TEST (flash_erase_region_and_verify_test);
 TEST (flash_erase_region_and_verify_test_not_blank);
 TEST (flash_erase_region_and_verify_test_null);
@@ -18505,7 +18742,7 @@ TEST (flash_sector_copy_test_no_length);
 TEST (flash_sector_copy_test_sector_check_error);
 TEST (flash_sector_copy_test_not_blank);
 TEST (flash_sector_copy_test_page_size_error);
-TEST (flash_sector_copy_test_page_size_unsupported);
+TEST (flash_sector_copy_test_large_page);
 TEST (flash_sector_copy_test_read_error);
 TEST (flash_sector_copy_test_write_error);
 TEST (flash_sector_copy_test_partial_write);
@@ -18525,7 +18762,7 @@ TEST (flash_sector_copy_and_verify_test_multiple_pages_page_offset);
 TEST (flash_sector_copy_and_verify_test_null);
 TEST (flash_sector_copy_and_verify_test_sector_check_error);
 TEST (flash_sector_copy_and_verify_test_page_size_error);
-TEST (flash_sector_copy_and_verify_test_page_size_unsupported);
+TEST (flash_sector_copy_and_verify_test_large_page);
 TEST (flash_sector_copy_and_verify_test_read_error);
 TEST (flash_sector_copy_and_verify_test_write_error);
 TEST (flash_sector_copy_and_verify_test_partial_write);
@@ -18548,7 +18785,7 @@ TEST (flash_sector_copy_ext_test_no_length);
 TEST (flash_sector_copy_ext_test_sector_check_error);
 TEST (flash_sector_copy_ext_test_not_blank);
 TEST (flash_sector_copy_ext_test_page_size_error);
-TEST (flash_sector_copy_ext_test_page_size_unsupported);
+TEST (flash_sector_copy_ext_test_large_page);
 TEST (flash_sector_copy_ext_test_read_error);
 TEST (flash_sector_copy_ext_test_write_error);
 TEST (flash_sector_copy_ext_test_partial_write);
@@ -18570,7 +18807,7 @@ TEST (flash_sector_copy_ext_and_verify_test_null);
 TEST (flash_sector_copy_ext_and_verify_test_sector_check_error);
 TEST (flash_sector_copy_ext_and_verify_test_not_blank);
 TEST (flash_sector_copy_ext_and_verify_test_page_size_error);
-TEST (flash_sector_copy_ext_and_verify_test_page_size_unsupported);
+TEST (flash_sector_copy_ext_and_verify_test_large_page);
 TEST (flash_sector_copy_ext_and_verify_test_read_error);
 TEST (flash_sector_copy_ext_and_verify_test_write_error);
 TEST (flash_sector_copy_ext_and_verify_test_partial_write);
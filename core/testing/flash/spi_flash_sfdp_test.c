@@ -9994,6 +9994,198 @@ static void spi_flash_sfdp_test_get_page_size_null (CuTest *test)
 	spi_flash_sfdp_release (&sfdp);
 }
 
+static void spi_flash_sfdp_test_get_write_timing_mx25l1606e (CuTest *test)
+{
+	struct flash_master_mock flash;
+	struct spi_flash_sfdp sfdp;
+	struct spi_flash_sfdp_basic_table table;
+	struct spi_flash_sfdp_write_timing timing;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_sfdp_testing_init_expectations (test, &flash, SFDP_HEADER_MX25L1606E,
+		FLASH_ID_MX25L1606E);
+
+	status = spi_flash_sfdp_init (&sfdp, &flash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash, 0, (uint8_t*) SFDP_PARAMS_MX25L1606E,
+		SFDP_PARAMS_MX25L1606E_LEN,
+		FLASH_EXP_READ_CMD (0x5a, SFDP_PARAMS_ADDR_MX25L1606E, 1, -1, SFDP_PARAMS_MX25L1606E_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sfdp_basic_table_init (&table, &sfdp);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sfdp_get_write_timing (&table, &timing);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, timing.page_program_us);
+	CuAssertIntEquals (test, 0, timing.sector_erase_ms);
+	CuAssertIntEquals (test, 0, timing.block_erase_ms);
+	CuAssertIntEquals (test, 0, timing.chip_erase_ms);
+
+	status = flash_master_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_sfdp_basic_table_release (&table);
+	spi_flash_sfdp_release (&sfdp);
+}
+
+static void spi_flash_sfdp_test_get_write_timing_w25q16jv (CuTest *test)
+{
+	struct flash_master_mock flash;
+	struct spi_flash_sfdp sfdp;
+	struct spi_flash_sfdp_basic_table table;
+	struct spi_flash_sfdp_write_timing timing;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_sfdp_testing_init_expectations (test, &flash, SFDP_HEADER_W25Q16JV,
+		FLASH_ID_W25Q16JV);
+
+	status = spi_flash_sfdp_init (&sfdp, &flash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash, 0, (uint8_t*) SFDP_PARAMS_W25Q16JV,
+		SFDP_PARAMS_W25Q16JV_LEN,
+		FLASH_EXP_READ_CMD (0x5a, SFDP_PARAMS_ADDR_W25Q16JV, 1, -1, SFDP_PARAMS_W25Q16JV_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sfdp_basic_table_init (&table, &sfdp);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sfdp_get_write_timing (&table, &timing);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 704, timing.page_program_us);
+	CuAssertIntEquals (test, 64, timing.sector_erase_ms);
+	CuAssertIntEquals (test, 160, timing.block_erase_ms);
+	CuAssertIntEquals (test, 5120, timing.chip_erase_ms);
+
+	status = flash_master_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_sfdp_basic_table_release (&table);
+	spi_flash_sfdp_release (&sfdp);
+}
+
+static void spi_flash_sfdp_test_get_write_timing_mt25q256aba (CuTest *test)
+{
+	struct flash_master_mock flash;
+	struct spi_flash_sfdp sfdp;
+	struct spi_flash_sfdp_basic_table table;
+	struct spi_flash_sfdp_write_timing timing;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_sfdp_testing_init_expectations (test, &flash, SFDP_HEADER_MT25Q256ABA,
+		FLASH_ID_MT25Q256ABA);
+
+	status = spi_flash_sfdp_init (&sfdp, &flash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash, 0, (uint8_t*) SFDP_PARAMS_MT25Q256ABA,
+		SFDP_PARAMS_MT25Q256ABA_LEN,
+		FLASH_EXP_READ_CMD (0x5a, SFDP_PARAMS_ADDR_MT25Q256ABA, 1, -1,
+			SFDP_PARAMS_MT25Q256ABA_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sfdp_basic_table_init (&table, &sfdp);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sfdp_get_write_timing (&table, &timing);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 120, timing.page_program_us);
+	CuAssertIntEquals (test, 48, timing.sector_erase_ms);
+	CuAssertIntEquals (test, 160, timing.block_erase_ms);
+	CuAssertIntEquals (test, 84000, timing.chip_erase_ms);
+
+	status = flash_master_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_sfdp_basic_table_release (&table);
+	spi_flash_sfdp_release (&sfdp);
+}
+
+static void spi_flash_sfdp_test_get_write_timing_null (CuTest *test)
+{
+	struct flash_master_mock flash;
+	struct spi_flash_sfdp sfdp;
+	struct spi_flash_sfdp_basic_table table;
+	struct spi_flash_sfdp_write_timing timing;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_sfdp_testing_init_expectations (test, &flash, SFDP_HEADER_W25Q16JV,
+		FLASH_ID_W25Q16JV);
+
+	status = spi_flash_sfdp_init (&sfdp, &flash.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash, 0, (uint8_t*) SFDP_PARAMS_W25Q16JV,
+		SFDP_PARAMS_W25Q16JV_LEN,
+		FLASH_EXP_READ_CMD (0x5a, SFDP_PARAMS_ADDR_W25Q16JV, 1, -1, SFDP_PARAMS_W25Q16JV_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sfdp_basic_table_init (&table, &sfdp);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sfdp_get_write_timing (NULL, &timing);
+	CuAssertIntEquals (test, SPI_FLASH_SFDP_INVALID_ARGUMENT, status);
+
+	status = spi_flash_sfdp_get_write_timing (&table, NULL);
+	CuAssertIntEquals (test, SPI_FLASH_SFDP_INVALID_ARGUMENT, status);
+
+	status = flash_master_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_sfdp_basic_table_release (&table);
+	spi_flash_sfdp_release (&sfdp);
+}
+
 static void spi_flash_sfdp_test_get_deep_powerdown_commands_mx25l1606e (CuTest *test)
 {
 	struct flash_master_mock flash;
@@ -11032,6 +11224,10 @@ TEST (spi_flash_sfdp_test_get_page_size_s28hs02gt);
 TEST (spi_flash_sfdp_test_get_page_size_128_byte_page);
 TEST (spi_flash_sfdp_test_get_page_size_max_page_size);
 TEST (spi_flash_sfdp_test_get_page_size_null);
+TEST (spi_flash_sfdp_test_get_write_timing_mx25l1606e);
+TEST (spi_flash_sfdp_test_get_write_timing_w25q16jv);
+TEST (spi_flash_sfdp_test_get_write_timing_mt25q256aba);
+TEST (spi_flash_sfdp_test_get_write_timing_null);
 TEST (spi_flash_sfdp_test_get_deep_powerdown_commands_mx25l1606e);
 TEST (spi_flash_sfdp_test_get_deep_powerdown_commands_mx25l25635f);
 TEST (spi_flash_sfdp_test_get_deep_powerdown_commands_mx25l25645g);
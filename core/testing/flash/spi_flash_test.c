@@ -154,6 +154,18 @@ void spi_flash_testing_discover_params_fast_read (CuTest *test, struct spi_flash
 		params_len, params_addr, capabilities, true);
 }
 
+/**
+ * Poll yield handler for testing.  Counts the number of times the handler was called.
+ *
+ * @param context Counter to increment.
+ */
+static void spi_flash_testing_poll_yield (void *context)
+{
+	int *count = context;
+
+	(*count)++;
+}
+
 /*******************
  * Test cases
  *******************/
@@ -1601,6 +1613,57 @@ static void spi_flash_test_discover_device_properties_4byte_mode_unsupported (Cu
 	spi_flash_release (&flash);
 }
 
+static void spi_flash_test_discover_device_properties_write_timing (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t header[] = {
+		0x50444653,
+		0xff000106,
+		0x10010600,
+		0xff000010
+	};
+	uint32_t params[] = {
+		0xfff920e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb423b08,
+		0xfffffffe,
+		0x0000ffff,
+		0xeb40ffff,
+		0x520f200c,
+		0x0000d810,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff4df719,
+		0x80f830e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000010, FULL_CAPABILITIES);
+
+	CuAssertIntEquals (test, 0, state.poll_delay_ms[SPI_FLASH_WRITE_OP_PAGE_PROGRAM]);
+	CuAssertIntEquals (test, 64, state.poll_delay_ms[SPI_FLASH_WRITE_OP_SECTOR_ERASE]);
+	CuAssertIntEquals (test, 160, state.poll_delay_ms[SPI_FLASH_WRITE_OP_BLOCK_ERASE]);
+	CuAssertIntEquals (test, 5120, state.poll_delay_ms[SPI_FLASH_WRITE_OP_CHIP_ERASE]);
+	CuAssertIntEquals (test, 0, state.poll_delay_ms[SPI_FLASH_WRITE_OP_REGISTER]);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
 static void spi_flash_test_discover_device_properties_null (CuTest *test)
 {
 	struct spi_flash_state state;
@@ -9165,14 +9228,17 @@ static void spi_flash_test_read_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write (CuTest *test)
+static void spi_flash_test_read_write_state_tracking (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
-	uint8_t read_status = 0;
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t data2[] = {5, 6, 7, 8};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = 0;
 
 	TEST_START;
 
@@ -9185,37 +9251,54 @@ static void spi_flash_test_write (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = spi_flash_set_write_state_tracking (&flash, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
-	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
+	status = testing_validate_array (data, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	/* No write has been issued, so the device status doesn't need to be checked again. */
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, data2, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1238, 0, data_in, length));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read (&flash, 0x1238, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data2, data_in, length);
+	CuAssertIntEquals (test, 0, status);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_across_page (CuTest *test)
+static void spi_flash_test_read_write_state_tracking_write_in_progress (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint8_t data[] = {1, 2, 3, 4};
-	uint8_t cmd_expected[] = {0x01};
-	uint8_t cmd2_expected[] = {0x02, 0x03, 0x04};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = FLASH_STATUS_WIP;
 	uint8_t read_status = 0;
 
 	TEST_START;
@@ -9229,42 +9312,50 @@ static void spi_flash_test_write_across_page (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x12ff, 0, cmd_expected, sizeof (cmd_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = spi_flash_set_write_state_tracking (&flash, true);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, cmd2_expected, sizeof (cmd2_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
-	CuAssertIntEquals (test, sizeof (data), status);
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = testing_validate_array (data, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_multiple_pages (CuTest *test)
+static void spi_flash_test_read_write_state_tracking_write_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t data[FLASH_PAGE_SIZE * 2];
-	uint8_t page1_expected[FLASH_PAGE_SIZE];
-	uint8_t page2_expected[FLASH_PAGE_SIZE];
+	uint8_t data[] = {1, 2, 3, 4};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
 	uint8_t read_status = 0;
-	int i;
 
 	TEST_START;
 
@@ -9277,53 +9368,54 @@ static void spi_flash_test_write_multiple_pages (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	for (i = 0; i < FLASH_PAGE_SIZE; i++) {
-		data[i] = i;
-		page1_expected[i] = i;
-	}
-	for (i = FLASH_PAGE_SIZE - 1; i >= 0; i--) {
-		data[FLASH_PAGE_SIZE + i] = i;
-		page2_expected[i] = i;
-	}
+	status = spi_flash_set_write_state_tracking (&flash, true);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1200, 0, page1_expected, sizeof (page1_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, data, length));
 
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, page2_expected, sizeof (page2_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x1234, data, length);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The write could have started, so the device status must be checked before reading. */
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x1200, data, sizeof (data));
-	CuAssertIntEquals (test, sizeof (data), status);
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data, data_in, length);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_multiple_pages_not_aligned (CuTest *test)
+static void spi_flash_test_read_write_state_tracking_disabled (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t data[FLASH_PAGE_SIZE * 2];
-	uint8_t page1_expected[0x10] = {0x02, 0x00, 0x12, 0xf0};
-	uint8_t page2_expected[FLASH_PAGE_SIZE] = {0x02, 0x00, 0x13, 0x00};
-	uint8_t page3_expected[FLASH_PAGE_SIZE - 0x10] = {0x02, 0x00, 0x14, 0x00};
-	uint8_t read_status = 0;
-	int i;
-	uint8_t *pos;
+	uint8_t data[] = {1, 2, 3, 4};
+	const size_t length = sizeof (data);
+	uint8_t data_in[length];
+	uint8_t wip_status = 0;
 
 	TEST_START;
 
@@ -9336,68 +9428,541 @@ static void spi_flash_test_write_multiple_pages_not_aligned (CuTest *test)
 	status = spi_flash_set_device_size (&flash, 0x1000000);
 	CuAssertIntEquals (test, 0, status);
 
-	for (i = 0; i < FLASH_PAGE_SIZE; i++) {
-		data[i] = i;
-	}
-	for (i = FLASH_PAGE_SIZE - 1; i >= 0; i--) {
-		data[FLASH_PAGE_SIZE + i] = i;
-	}
-
-	pos = data;
-	for (i = 0; i < 0x10; i++, pos++) {
-		page1_expected[i] = *pos;
-	}
-	for (i = 0; i < FLASH_PAGE_SIZE; i++, pos++) {
-		page2_expected[i] = *pos;
-	}
-	for (i = 0; i < FLASH_PAGE_SIZE - 0x10; i++, pos++) {
-		page3_expected[i] = *pos;
-	}
+	status = spi_flash_set_write_state_tracking (&flash, true);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x12f0, 0, page1_expected, sizeof (page1_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
 
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, page2_expected, sizeof (page2_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_write_state_tracking (&flash, false);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
 
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
-		FLASH_EXP_WRITE_CMD (0x02, 0x1400, 0, page3_expected, sizeof (page3_expected)));
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data, length,
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in, length));
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_write (&flash, 0x12f0, data, sizeof (data));
-	CuAssertIntEquals (test, sizeof (data), status);
+	status = spi_flash_read (&flash, 0x1234, data_in, length);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_write_max_address (CuTest *test)
+static void spi_flash_test_set_write_state_tracking_null (CuTest *test)
 {
-	struct spi_flash_state state;
-	struct spi_flash flash;
-	struct flash_master_mock mock;
 	int status;
-	uint8_t cmd_expected[] = {0x01};
-	uint8_t read_status = 0;
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_set_write_state_tracking (NULL, true);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_read_regions (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data1[] = {1, 2, 3, 4};
+	uint8_t data2[] = {5, 6};
+	uint8_t data3[] = {7, 8, 9};
+	uint8_t data_in1[sizeof (data1)];
+	uint8_t data_in2[sizeof (data2)];
+	uint8_t data_in3[sizeof (data3)];
+	struct spi_flash_read_region regions[] = {
+		{0x1234, data_in1, sizeof (data_in1)},
+		{0x5678, data_in2, sizeof (data_in2)},
+		{0x10, data_in3, sizeof (data_in3)}
+	};
+	uint8_t wip_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data1, sizeof (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in1, sizeof (data_in1)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data2, sizeof (data2),
+		FLASH_EXP_READ_CMD (0x03, 0x5678, 0, data_in2, sizeof (data_in2)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data3, sizeof (data3),
+		FLASH_EXP_READ_CMD (0x03, 0x10, 0, data_in3, sizeof (data_in3)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read_regions (&flash, regions, 3);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (data1, data_in1, sizeof (data1));
+	status |= testing_validate_array (data2, data_in2, sizeof (data2));
+	status |= testing_validate_array (data3, data_in3, sizeof (data3));
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_read_regions_no_regions (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read_regions (&flash, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_read_regions_null (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data_in[4];
+	struct spi_flash_read_region regions[] = {
+		{0x1234, data_in, sizeof (data_in)},
+		{0x5678, NULL, sizeof (data_in)}
+	};
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read_regions (NULL, regions, 1);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = spi_flash_read_regions (&flash, NULL, 1);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = spi_flash_read_regions (&flash, regions, 2);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_read_regions_out_of_range (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data_in[4];
+	struct spi_flash_read_region regions[] = {
+		{0x1234, data_in, sizeof (data_in)},
+		{0x1000000, data_in, sizeof (data_in)}
+	};
+	struct spi_flash_read_region too_long[] = {
+		{0x1234, data_in, sizeof (data_in)},
+		{0xfffffd, data_in, sizeof (data_in)}
+	};
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read_regions (&flash, regions, 2);
+	CuAssertIntEquals (test, SPI_FLASH_ADDRESS_OUT_OF_RANGE, status);
+
+	status = spi_flash_read_regions (&flash, too_long, 2);
+	CuAssertIntEquals (test, SPI_FLASH_OPERATION_OUT_OF_RANGE, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_read_regions_error_in_progress (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data_in[4];
+	struct spi_flash_read_region regions[] = {
+		{0x1234, data_in, sizeof (data_in)},
+		{0x5678, data_in, sizeof (data_in)}
+	};
+	uint8_t wip_status = FLASH_STATUS_WIP;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read_regions (&flash, regions, 2);
+	CuAssertIntEquals (test, SPI_FLASH_WRITE_IN_PROGRESS, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_read_regions_error (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data1[] = {1, 2, 3, 4};
+	uint8_t data_in1[sizeof (data1)];
+	uint8_t data_in2[4];
+	struct spi_flash_read_region regions[] = {
+		{0x1234, data_in1, sizeof (data_in1)},
+		{0x5678, data_in2, sizeof (data_in2)},
+		{0x10, data_in2, sizeof (data_in2)}
+	};
+	uint8_t wip_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, data1, sizeof (data1),
+		FLASH_EXP_READ_CMD (0x03, 0x1234, 0, data_in1, sizeof (data_in1)));
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_CMD (0x03, 0x5678, 0, data_in2, sizeof (data_in2)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_read_regions (&flash, regions, 3);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_across_page (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t cmd_expected[] = {0x01};
+	uint8_t cmd2_expected[] = {0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x12ff, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, cmd2_expected, sizeof (cmd2_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_multiple_pages (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data[FLASH_PAGE_SIZE * 2];
+	uint8_t page1_expected[FLASH_PAGE_SIZE];
+	uint8_t page2_expected[FLASH_PAGE_SIZE];
+	uint8_t read_status = 0;
+	int i;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < FLASH_PAGE_SIZE; i++) {
+		data[i] = i;
+		page1_expected[i] = i;
+	}
+	for (i = FLASH_PAGE_SIZE - 1; i >= 0; i--) {
+		data[FLASH_PAGE_SIZE + i] = i;
+		page2_expected[i] = i;
+	}
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1200, 0, page1_expected, sizeof (page1_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, page2_expected, sizeof (page2_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x1200, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_multiple_pages_not_aligned (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data[FLASH_PAGE_SIZE * 2];
+	uint8_t page1_expected[0x10] = {0x02, 0x00, 0x12, 0xf0};
+	uint8_t page2_expected[FLASH_PAGE_SIZE] = {0x02, 0x00, 0x13, 0x00};
+	uint8_t page3_expected[FLASH_PAGE_SIZE - 0x10] = {0x02, 0x00, 0x14, 0x00};
+	uint8_t read_status = 0;
+	int i;
+	uint8_t *pos;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < FLASH_PAGE_SIZE; i++) {
+		data[i] = i;
+	}
+	for (i = FLASH_PAGE_SIZE - 1; i >= 0; i--) {
+		data[FLASH_PAGE_SIZE + i] = i;
+	}
+
+	pos = data;
+	for (i = 0; i < 0x10; i++, pos++) {
+		page1_expected[i] = *pos;
+	}
+	for (i = 0; i < FLASH_PAGE_SIZE; i++, pos++) {
+		page2_expected[i] = *pos;
+	}
+	for (i = 0; i < FLASH_PAGE_SIZE - 0x10; i++, pos++) {
+		page3_expected[i] = *pos;
+	}
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x12f0, 0, page1_expected, sizeof (page1_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1300, 0, page2_expected, sizeof (page2_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1400, 0, page3_expected, sizeof (page3_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x12f0, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_max_address (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t cmd_expected[] = {0x01};
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
@@ -10467,7 +11032,277 @@ static void spi_flash_test_write_error_second_page (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 
 	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
-	CuAssertIntEquals (test, 1, status);
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_sfdp_page_size (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t cmd_expected[] = {0x01, 0x02};
+	uint8_t cmd2_expected[] = {0x03, 0x04};
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff000106,
+		0x10010600,
+		0xff000010
+	};
+	uint32_t params[] = {
+		0xfff920e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb423b08,
+		0xfffffffe,
+		0x0000ffff,
+		0xeb40ffff,
+		0x520f200c,
+		0x0000d810,
+		0x00a60236,
+		0xb314ea72,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff4df719,
+		0x80f830e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000010, FULL_CAPABILITIES);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x127e, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1280, 0, cmd2_expected, sizeof (cmd2_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x127e, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_sequence (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data[FLASH_PAGE_SIZE + 4];
+	uint8_t page1_expected[FLASH_PAGE_SIZE - 0x10];
+	uint8_t page2_expected[0x14];
+	uint8_t read_status = 0;
+	int i;
+	uint32_t header[] = {
+		0x50444653,
+		0xff000106,
+		0x10010600,
+		0xff000010
+	};
+	uint32_t params[] = {
+		0xfff920e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb423b08,
+		0xfffffffe,
+		0x0000ffff,
+		0xeb40ffff,
+		0x520f200c,
+		0x0000d810,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff4df719,
+		0x80f830e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000010, FULL_CAPABILITIES | FLASH_CAP_WRITE_SEQUENCE);
+
+	for (i = 0; i < (int) sizeof (data); i++) {
+		data[i] = i;
+	}
+	memcpy (page1_expected, data, sizeof (page1_expected));
+	memcpy (page2_expected, &data[sizeof (page1_expected)], sizeof (page2_expected));
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_EXT_CMD (0x02, 0x1210, 0, 0, page1_expected, sizeof (page1_expected),
+		FLASH_FLAG_WRITE_SEQUENCE));
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_EXT_CMD (0x02, 0x1300, 0, 0, page2_expected, sizeof (page2_expected),
+		FLASH_FLAG_WRITE_SEQUENCE));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x1210, data, sizeof (data));
+	CuAssertIntEquals (test, sizeof (data), status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_sequence_error_second_page (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t cmd_expected[] = {0x01};
+	uint8_t cmd2_expected[] = {0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff000106,
+		0x10010600,
+		0xff000010
+	};
+	uint32_t params[] = {
+		0xfff920e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb423b08,
+		0xfffffffe,
+		0x0000ffff,
+		0xeb40ffff,
+		0x520f200c,
+		0x0000d810,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff4df719,
+		0x80f830e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000010, FULL_CAPABILITIES | FLASH_CAP_WRITE_SEQUENCE);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_EXT_CMD (0x02, 0x12ff, 0, 0, cmd_expected, sizeof (cmd_expected),
+		FLASH_FLAG_WRITE_SEQUENCE));
+	status |= flash_master_mock_expect_tx_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_WRITE_EXT_CMD (0x02, 0x1300, 0, 0, cmd2_expected, sizeof (cmd2_expected),
+		FLASH_FLAG_WRITE_SEQUENCE));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
+	CuAssertIntEquals (test, 1, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_write_sequence_status_error (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t data[] = {1, 2, 3, 4};
+	uint8_t cmd_expected[] = {0x01};
+	uint8_t cmd2_expected[] = {0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff000106,
+		0x10010600,
+		0xff000010
+	};
+	uint32_t params[] = {
+		0xfff920e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb423b08,
+		0xfffffffe,
+		0x0000ffff,
+		0xeb40ffff,
+		0x520f200c,
+		0x0000d810,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff4df719,
+		0x80f830e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000010, FULL_CAPABILITIES | FLASH_CAP_WRITE_SEQUENCE);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_EXT_CMD (0x02, 0x12ff, 0, 0, cmd_expected, sizeof (cmd_expected),
+		FLASH_FLAG_WRITE_SEQUENCE));
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_EXT_CMD (0x02, 0x1300, 0, 0, cmd2_expected, sizeof (cmd2_expected),
+		FLASH_FLAG_WRITE_SEQUENCE));
+	status |= flash_master_mock_expect_rx_xfer (&mock, FLASH_MASTER_XFER_FAILED, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_write (&flash, 0x12ff, data, sizeof (data));
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13389,12 +14224,265 @@ static void spi_flash_test_chip_erase_error_in_progress_flag_status_register (Cu
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_chip_erase_status_error (CuTest *test)
+static void spi_flash_test_chip_erase_status_error (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_chip_erase (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_chip_erase_error (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_OPCODE (0xc7));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_chip_erase (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_chip_erase_wait_error (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t read_status = 0;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xc7));
+	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_chip_erase (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_get_sector_size (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t out;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_get_sector_size (&flash, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE, out);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_get_sector_size_flash_api (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t out;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash.base.get_sector_size (&flash.base, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE, out);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_get_sector_size_static_read_only (CuTest *test)
+{
+	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
+		&mock.base);
+	int status;
+	uint32_t out;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init_state (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash.base.get_sector_size (&flash.base, &out);
+	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_get_sector_size_null (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t out;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_get_sector_size (NULL, &out);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = spi_flash_get_sector_size (&flash, NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_get_block_size (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint32_t out;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_get_block_size (&flash, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_BLOCK_SIZE, out);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_get_block_size_flash_api (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	uint32_t out;
 
 	TEST_START;
 
@@ -13404,13 +14492,38 @@ static void spi_flash_test_chip_erase_status_error (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_STATUS_REG);
+	status = flash.base.get_block_size (&flash.base, &out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_BLOCK_SIZE, out);
 
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_chip_erase (&flash);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_get_block_size_static_read_only (CuTest *test)
+{
+	struct flash_master_mock mock;
+	struct spi_flash_state state;
+	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
+		&mock.base);
+	int status;
+	uint32_t out;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init_state (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash.base.get_block_size (&flash.base, &out);
+	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13421,13 +14534,13 @@ static void spi_flash_test_chip_erase_status_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_chip_erase_error (CuTest *test)
+static void spi_flash_test_get_block_size_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
+	uint32_t out;
 
 	TEST_START;
 
@@ -13437,16 +14550,11 @@ static void spi_flash_test_chip_erase_error (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_OPCODE (0xc7));
-
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_get_block_size (NULL, &out);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
-	status = spi_flash_chip_erase (&flash);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	status = spi_flash_get_block_size (&flash, NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13457,13 +14565,13 @@ static void spi_flash_test_chip_erase_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_chip_erase_wait_error (CuTest *test)
+static void spi_flash_test_get_page_size (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t read_status = 0;
+	uint32_t out;
 
 	TEST_START;
 
@@ -13473,17 +14581,9 @@ static void spi_flash_test_chip_erase_wait_error (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
-	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_OPCODE (0xc7));
-	status |= flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
-		FLASH_EXP_READ_STATUS_REG);
-
+	status = spi_flash_get_page_size (&flash, &out);
 	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_chip_erase (&flash);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, FLASH_PAGE_SIZE, out);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13494,25 +14594,46 @@ static void spi_flash_test_chip_erase_wait_error (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_sector_size (CuTest *test)
+static void spi_flash_test_get_page_size_sfdp (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
 	uint32_t out;
+	uint32_t header[] = {
+		0x50444653,
+		0xff000106,
+		0x10010600,
+		0xff000010
+	};
+	uint32_t params[] = {
+		0xfff920e5,
+		0x00ffffff,
+		0x6b08eb44,
+		0xbb423b08,
+		0xfffffffe,
+		0x0000ffff,
+		0xeb40ffff,
+		0x520f200c,
+		0x0000d810,
+		0x00a60236,
+		0xb314ea72,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2f7,
+		0xff4df719,
+		0x80f830e9
+	};
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spi_flash_init (&flash, &state, &mock.base);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000010, FULL_CAPABILITIES);
 
-	status = spi_flash_get_sector_size (&flash, &out);
+	status = spi_flash_get_page_size (&flash, &out);
 	CuAssertIntEquals (test, 0, status);
-	CuAssertIntEquals (test, FLASH_SECTOR_SIZE, out);
+	CuAssertIntEquals (test, 128, out);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13523,7 +14644,7 @@ static void spi_flash_test_get_sector_size (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_sector_size_flash_api (CuTest *test)
+static void spi_flash_test_get_page_size_flash_api (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -13539,9 +14660,9 @@ static void spi_flash_test_get_sector_size_flash_api (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.get_sector_size (&flash.base, &out);
+	status = flash.base.get_page_size (&flash.base, &out);
 	CuAssertIntEquals (test, 0, status);
-	CuAssertIntEquals (test, FLASH_SECTOR_SIZE, out);
+	CuAssertIntEquals (test, FLASH_PAGE_SIZE, out);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13552,7 +14673,7 @@ static void spi_flash_test_get_sector_size_flash_api (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_sector_size_static_read_only (CuTest *test)
+static void spi_flash_test_get_page_size_static_read_only (CuTest *test)
 {
 	struct flash_master_mock mock;
 	struct spi_flash_state state;
@@ -13569,7 +14690,7 @@ static void spi_flash_test_get_sector_size_static_read_only (CuTest *test)
 	status = spi_flash_init_state (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.get_sector_size (&flash.base, &out);
+	status = flash.base.get_page_size (&flash.base, &out);
 	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
 
 	status = mock_validate (&mock.mock);
@@ -13581,7 +14702,7 @@ static void spi_flash_test_get_sector_size_static_read_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_sector_size_null (CuTest *test)
+static void spi_flash_test_get_page_size_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -13597,10 +14718,10 @@ static void spi_flash_test_get_sector_size_null (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_get_sector_size (NULL, &out);
+	status = spi_flash_get_block_size (NULL, &out);
 	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
-	status = spi_flash_get_sector_size (&flash, NULL);
+	status = spi_flash_get_block_size (&flash, NULL);
 	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
 	status = mock_validate (&mock.mock);
@@ -13612,7 +14733,7 @@ static void spi_flash_test_get_sector_size_null (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_block_size (CuTest *test)
+static void spi_flash_test_minimum_write_per_page (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -13628,9 +14749,9 @@ static void spi_flash_test_get_block_size (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_get_block_size (&flash, &out);
+	status = spi_flash_minimum_write_per_page (&flash, &out);
 	CuAssertIntEquals (test, 0, status);
-	CuAssertIntEquals (test, FLASH_BLOCK_SIZE, out);
+	CuAssertIntEquals (test, 1, out);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13641,7 +14762,7 @@ static void spi_flash_test_get_block_size (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_block_size_flash_api (CuTest *test)
+static void spi_flash_test_minimum_write_per_page_flash_api (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -13657,9 +14778,9 @@ static void spi_flash_test_get_block_size_flash_api (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.get_block_size (&flash.base, &out);
+	status = flash.base.minimum_write_per_page (&flash.base, &out);
 	CuAssertIntEquals (test, 0, status);
-	CuAssertIntEquals (test, FLASH_BLOCK_SIZE, out);
+	CuAssertIntEquals (test, 1, out);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13670,7 +14791,7 @@ static void spi_flash_test_get_block_size_flash_api (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_block_size_static_read_only (CuTest *test)
+static void spi_flash_test_minimum_write_per_page_static_read_only (CuTest *test)
 {
 	struct flash_master_mock mock;
 	struct spi_flash_state state;
@@ -13687,7 +14808,7 @@ static void spi_flash_test_get_block_size_static_read_only (CuTest *test)
 	status = spi_flash_init_state (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.get_block_size (&flash.base, &out);
+	status = flash.base.minimum_write_per_page (&flash.base, &out);
 	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
 
 	status = mock_validate (&mock.mock);
@@ -13699,7 +14820,7 @@ static void spi_flash_test_get_block_size_static_read_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_block_size_null (CuTest *test)
+static void spi_flash_test_minimum_write_per_page_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -13715,10 +14836,10 @@ static void spi_flash_test_get_block_size_null (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_get_block_size (NULL, &out);
+	status = spi_flash_minimum_write_per_page (NULL, &out);
 	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
-	status = spi_flash_get_block_size (&flash, NULL);
+	status = spi_flash_minimum_write_per_page (&flash, NULL);
 	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
 	status = mock_validate (&mock.mock);
@@ -13730,13 +14851,13 @@ static void spi_flash_test_get_block_size_null (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_page_size (CuTest *test)
+static void spi_flash_test_is_write_in_progress (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t out;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
@@ -13746,9 +14867,13 @@ static void spi_flash_test_get_page_size (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_get_page_size (&flash, &out);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
 	CuAssertIntEquals (test, 0, status);
-	CuAssertIntEquals (test, FLASH_PAGE_SIZE, out);
+
+	status = spi_flash_is_write_in_progress (&flash);
+	CuAssertIntEquals (test, 1, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13759,13 +14884,13 @@ static void spi_flash_test_get_page_size (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_page_size_flash_api (CuTest *test)
+static void spi_flash_test_is_write_in_progress_no_write (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t out;
+	uint8_t wip_status = 0;
 
 	TEST_START;
 
@@ -13775,9 +14900,64 @@ static void spi_flash_test_get_page_size_flash_api (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.get_page_size (&flash.base, &out);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
 	CuAssertIntEquals (test, 0, status);
-	CuAssertIntEquals (test, FLASH_PAGE_SIZE, out);
+
+	status = spi_flash_is_write_in_progress (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_is_write_in_progress_flag_status_register (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	int status;
+	uint8_t wip_status = 0;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2fb,
+		0xff088000,
+		0x80f820e9
+	};
+
+	TEST_START;
+
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_write_in_progress (&flash);
+	CuAssertIntEquals (test, 1, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13788,25 +14968,50 @@ static void spi_flash_test_get_page_size_flash_api (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_page_size_static_read_only (CuTest *test)
+static void spi_flash_test_is_write_in_progress_no_write_flag_status_register (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
-		&mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
-	uint32_t out;
+	uint8_t wip_status = FLASH_FLAG_STATUS_READY;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2fb,
+		0xff088000,
+		0x80f820e9
+	};
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
 
-	status = spi_flash_init_state (&flash);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.get_page_size (&flash.base, &out);
-	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
+	status = spi_flash_is_write_in_progress (&flash);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13817,13 +15022,12 @@ static void spi_flash_test_get_page_size_static_read_only (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_get_page_size_null (CuTest *test)
+static void spi_flash_test_is_write_in_progress_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t out;
 
 	TEST_START;
 
@@ -13833,11 +15037,13 @@ static void spi_flash_test_get_page_size_null (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_get_block_size (NULL, &out);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = spi_flash_get_block_size (&flash, NULL);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_is_write_in_progress (&flash);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13848,13 +15054,24 @@ static void spi_flash_test_get_page_size_null (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_minimum_write_per_page (CuTest *test)
+static void spi_flash_test_is_write_in_progress_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_is_write_in_progress (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_wait_for_write (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t out;
+	uint8_t wip_status = FLASH_STATUS_WIP;
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -13864,9 +15081,17 @@ static void spi_flash_test_minimum_write_per_page (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_minimum_write_per_page (&flash, &out);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_wait_for_write (&flash, 100);
 	CuAssertIntEquals (test, 0, status);
-	CuAssertIntEquals (test, 1, out);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13877,25 +15102,55 @@ static void spi_flash_test_minimum_write_per_page (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_minimum_write_per_page_flash_api (CuTest *test)
+static void spi_flash_test_wait_for_write_flag_status_register (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t out;
+	uint8_t wip_status = 0;
+	uint8_t read_status = FLASH_FLAG_STATUS_READY;
+	uint32_t header[] = {
+		0x50444653,
+		0xff010106,
+		0x10010600,
+		0xff000030
+	};
+	uint32_t params[] = {
+		0xff8020e5,
+		0x00ffffff,
+		0xff00ff00,
+		0xff00ff00,
+		0xffffffee,
+		0xff00ffff,
+		0xff00ffff,
+		0xd810200c,
+		0xff00ff00,
+		0x00a60236,
+		0xb314ea82,
+		0x337663e9,
+		0x757a757a,
+		0x5cd5a2fb,
+		0xff088000,
+		0x80f820e9
+	};
 
 	TEST_START;
 
-	status = flash_master_mock_init (&mock);
-	CuAssertIntEquals (test, 0, status);
+	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
+		sizeof (params), 0x000030, FULL_CAPABILITIES);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_FLAG_STATUS_REG);
 
-	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.minimum_write_per_page (&flash.base, &out);
+	status = spi_flash_wait_for_write (&flash, 100);
 	CuAssertIntEquals (test, 0, status);
-	CuAssertIntEquals (test, 1, out);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13906,42 +15161,37 @@ static void spi_flash_test_minimum_write_per_page_flash_api (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_minimum_write_per_page_static_read_only (CuTest *test)
+static void spi_flash_test_wait_for_write_null (CuTest *test)
 {
-	struct flash_master_mock mock;
 	struct spi_flash_state state;
-	struct spi_flash flash = spi_flash_static_init (SPI_FLASH_READ_ONLY_API_INIT, &state,
-		&mock.base);
+	struct spi_flash flash;
+	struct flash_master_mock mock;
 	int status;
-	uint32_t out;
 
 	TEST_START;
 
 	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_init_state (&flash);
+	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash.base.minimum_write_per_page (&flash.base, &out);
-	CuAssertIntEquals (test, SPI_FLASH_READ_ONLY_INTERFACE, status);
+	status = spi_flash_wait_for_write (NULL, 100);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
-	status = mock_validate (&mock.mock);
+	status = flash_master_mock_validate_and_release (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
-	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_minimum_write_per_page_null (CuTest *test)
+static void spi_flash_test_wait_for_write_timeout (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint32_t out;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
@@ -13951,22 +15201,30 @@ static void spi_flash_test_minimum_write_per_page_null (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_minimum_write_per_page (NULL, &out);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
-
-	status = spi_flash_minimum_write_per_page (&flash, NULL);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_wait_for_write (&flash, 35);
+	CuAssertIntEquals (test, SPI_FLASH_WIP_TIMEOUT, status);
+	CuAssertTrue (test, ((mock.mock.call_count >= 3) && (mock.mock.call_count <= 5)));
+
 	spi_flash_is_write_in_progress (&flash);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_write_in_progress (CuTest *test)
+static void spi_flash_test_wait_for_write_immediate_timeout (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
@@ -13987,8 +15245,8 @@ static void spi_flash_test_is_write_in_progress (CuTest *test)
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_write_in_progress (&flash);
-	CuAssertIntEquals (test, 1, status);
+	status = spi_flash_wait_for_write (&flash, 0);
+	CuAssertIntEquals (test, SPI_FLASH_WIP_TIMEOUT, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -13999,13 +15257,14 @@ static void spi_flash_test_is_write_in_progress (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_write_in_progress_no_write (CuTest *test)
+static void spi_flash_test_wait_for_write_no_timeout (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t wip_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -14017,10 +15276,16 @@ static void spi_flash_test_is_write_in_progress_no_write (CuTest *test)
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_wait_for_write (&flash, -1);
 	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_validate_and_release (&mock);
@@ -14029,50 +15294,33 @@ static void spi_flash_test_is_write_in_progress_no_write (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_write_in_progress_flag_status_register (CuTest *test)
+static void spi_flash_test_wait_for_write_error (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t wip_status = 0;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8020e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2fb,
-		0xff088000,
-		0x80f820e9
-	};
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
 
 	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, FLASH_MASTER_XFER_FAILED, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_write_in_progress (&flash);
-	CuAssertIntEquals (test, 1, status);
+	status = spi_flash_wait_for_write (&flash, 100);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -14083,53 +15331,96 @@ static void spi_flash_test_is_write_in_progress_flag_status_register (CuTest *te
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_write_in_progress_no_write_flag_status_register (CuTest *test)
+static void spi_flash_test_get_write_stats_no_writes (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_write_stats stats;
 	int status;
-	uint8_t wip_status = FLASH_FLAG_STATUS_READY;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8020e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2fb,
-		0xff088000,
-		0x80f820e9
-	};
+	int i;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < NUM_SPI_FLASH_WRITE_OPS; i++) {
+		memset (&stats, 0xff, sizeof (stats));
+
+		status = spi_flash_get_write_stats (&flash, (enum spi_flash_write_op) i, &stats);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, 0, stats.count);
+		CuAssertIntEquals (test, 0, stats.polls);
+		CuAssertIntEquals (test, 0, stats.min_ms);
+		CuAssertIntEquals (test, 0, stats.max_ms);
+		CuAssertIntEquals (test, 0, stats.total_ms);
+		CuAssertIntEquals (test, 0, stats.mean_ms);
+	}
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	flash_master_mock_release (&mock);
+	spi_flash_release (&flash);
+}
+
+static void spi_flash_test_get_write_stats_page_program (CuTest *test)
+{
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	struct flash_master_mock mock;
+	struct spi_flash_write_stats stats;
+	int status;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
+
+	TEST_START;
+
+	status = flash_master_mock_init (&mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	TEST_START;
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
 
+	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_write_in_progress (&flash);
+	status = spi_flash_get_write_stats (&flash, SPI_FLASH_WRITE_OP_PAGE_PROGRAM, &stats);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.count);
+	CuAssertIntEquals (test, 3, stats.polls);
+	CuAssertTrue (test, (stats.min_ms <= stats.max_ms));
+	CuAssertIntEquals (test, stats.max_ms, stats.total_ms);
+	CuAssertIntEquals (test, stats.total_ms, stats.mean_ms);
 
-	status = mock_validate (&mock.mock);
+	status = spi_flash_get_write_stats (&flash, SPI_FLASH_WRITE_OP_SECTOR_ERASE, &stats);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.count);
 
 	spi_flash_is_write_in_progress (&flash);
 
@@ -14137,12 +15428,15 @@ static void spi_flash_test_is_write_in_progress_no_write_flag_status_register (C
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_write_in_progress_error (CuTest *test)
+static void spi_flash_test_get_write_stats_sector_erase (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_write_stats stats;
 	int status;
+	uint8_t read_status = 0;
+	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
@@ -14152,40 +15446,68 @@ static void spi_flash_test_is_write_in_progress_error (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_xfer (&mock, FLASH_MASTER_XFER_FAILED,
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x2000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_is_write_in_progress (&flash);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_sector_erase (&flash, 0x2000);
+	CuAssertIntEquals (test, 0, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_get_write_stats (&flash, SPI_FLASH_WRITE_OP_SECTOR_ERASE, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.count);
+	CuAssertIntEquals (test, 5, stats.polls);
+	/* The first erase backs off for 1, 2, and 4 ms between status checks. */
+	CuAssertTrue (test, (stats.max_ms >= 7));
+	CuAssertTrue (test, (stats.min_ms <= stats.max_ms));
+	CuAssertIntEquals (test, stats.min_ms + stats.max_ms, stats.total_ms);
+	CuAssertIntEquals (test, stats.total_ms / 2, stats.mean_ms);
+
+	status = spi_flash_get_write_stats (&flash, SPI_FLASH_WRITE_OP_BLOCK_ERASE, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.count);
+
 	spi_flash_is_write_in_progress (&flash);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_is_write_in_progress_null (CuTest *test)
-{
-	int status;
-
-	TEST_START;
-
-	status = spi_flash_is_write_in_progress (NULL);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
-}
-
-static void spi_flash_test_wait_for_write (CuTest *test)
+static void spi_flash_test_get_write_stats_wait_for_write_not_tracked (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_write_stats stats;
 	int status;
-	uint8_t wip_status = FLASH_STATUS_WIP;
+	int i;
 	uint8_t read_status = 0;
 
 	TEST_START;
@@ -14196,11 +15518,7 @@ static void spi_flash_test_wait_for_write (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
@@ -14211,77 +15529,58 @@ static void spi_flash_test_wait_for_write (CuTest *test)
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
+	for (i = 0; i < NUM_SPI_FLASH_WRITE_OPS; i++) {
+		status = spi_flash_get_write_stats (&flash, (enum spi_flash_write_op) i, &stats);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, 0, stats.count);
+	}
+
 	spi_flash_is_write_in_progress (&flash);
 
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_wait_for_write_flag_status_register (CuTest *test)
+static void spi_flash_test_get_write_stats_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_write_stats stats;
 	int status;
-	uint8_t wip_status = 0;
-	uint8_t read_status = FLASH_FLAG_STATUS_READY;
-	uint32_t header[] = {
-		0x50444653,
-		0xff010106,
-		0x10010600,
-		0xff000030
-	};
-	uint32_t params[] = {
-		0xff8020e5,
-		0x00ffffff,
-		0xff00ff00,
-		0xff00ff00,
-		0xffffffee,
-		0xff00ffff,
-		0xff00ffff,
-		0xd810200c,
-		0xff00ff00,
-		0x00a60236,
-		0xb314ea82,
-		0x337663e9,
-		0x757a757a,
-		0x5cd5a2fb,
-		0xff088000,
-		0x80f820e9
-	};
 
 	TEST_START;
 
-	spi_flash_testing_discover_params (test, &flash, &state, &mock, TEST_ID, header, params,
-		sizeof (params), 0x000030, FULL_CAPABILITIES);
-
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
-		FLASH_EXP_READ_FLAG_STATUS_REG);
-
+	status = flash_master_mock_init (&mock);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_wait_for_write (&flash, 100);
+	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
+	status = spi_flash_get_write_stats (NULL, SPI_FLASH_WRITE_OP_PAGE_PROGRAM, &stats);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = spi_flash_get_write_stats (&flash, NUM_SPI_FLASH_WRITE_OPS, &stats);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
+	status = spi_flash_get_write_stats (&flash, SPI_FLASH_WRITE_OP_PAGE_PROGRAM, NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_wait_for_write_null (CuTest *test)
+static void spi_flash_test_reset_write_stats (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_write_stats stats;
 	int status;
+	uint8_t read_status = 0;
 
 	TEST_START;
 
@@ -14291,21 +15590,63 @@ static void spi_flash_test_wait_for_write_null (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_wait_for_write (NULL, 100);
-	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0xd8, 0x10000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_block_erase (&flash, 0x10000);
 	CuAssertIntEquals (test, 0, status);
 
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_get_write_stats (&flash, SPI_FLASH_WRITE_OP_BLOCK_ERASE, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.count);
+	CuAssertIntEquals (test, 1, stats.polls);
+
+	status = spi_flash_reset_write_stats (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_get_write_stats (&flash, SPI_FLASH_WRITE_OP_BLOCK_ERASE, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.count);
+	CuAssertIntEquals (test, 0, stats.polls);
+	CuAssertIntEquals (test, 0, stats.total_ms);
+
+	spi_flash_is_write_in_progress (&flash);
+
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_wait_for_write_timeout (CuTest *test)
+static void spi_flash_test_reset_write_stats_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = spi_flash_reset_write_stats (NULL);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_set_poll_yield (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	int yields = 0;
+	uint8_t cmd_expected[] = {0x01, 0x02, 0x03, 0x04};
+	uint8_t read_status = 0;
 	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
@@ -14316,22 +15657,32 @@ static void spi_flash_test_wait_for_write_timeout (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_poll_yield (&flash, spi_flash_testing_poll_yield, &yields);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_tx_xfer (&mock, 0,
+		FLASH_EXP_WRITE_CMD (0x02, 0x1234, 0, cmd_expected, sizeof (cmd_expected)));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_wait_for_write (&flash, 35);
-	CuAssertIntEquals (test, SPI_FLASH_WIP_TIMEOUT, status);
-	CuAssertTrue (test, ((mock.mock.call_count >= 3) && (mock.mock.call_count <= 5)));
+	status = spi_flash_write (&flash, 0x1234, cmd_expected, sizeof (cmd_expected));
+	CuAssertIntEquals (test, sizeof (cmd_expected), status);
+	CuAssertIntEquals (test, 2, yields);
+
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
 
 	spi_flash_is_write_in_progress (&flash);
 
@@ -14339,12 +15690,14 @@ static void spi_flash_test_wait_for_write_timeout (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_wait_for_write_immediate_timeout (CuTest *test)
+static void spi_flash_test_set_poll_yield_not_called_for_erase (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
+	int yields = 0;
+	uint8_t read_status = 0;
 	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
@@ -14355,13 +15708,26 @@ static void spi_flash_test_wait_for_write_immediate_timeout (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_poll_yield (&flash, spi_flash_testing_poll_yield, &yields);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_wait_for_write (&flash, 0);
-	CuAssertIntEquals (test, SPI_FLASH_WIP_TIMEOUT, status);
+	status = spi_flash_sector_erase (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, yields);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
@@ -14372,13 +15738,24 @@ static void spi_flash_test_wait_for_write_immediate_timeout (CuTest *test)
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_wait_for_write_no_timeout (CuTest *test)
+static void spi_flash_test_set_poll_yield_null (CuTest *test)
+{
+	int status;
+	int yields = 0;
+
+	TEST_START;
+
+	status = spi_flash_set_poll_yield (NULL, spi_flash_testing_poll_yield, &yields);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
+}
+
+static void spi_flash_test_set_write_poll_delay (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
+	struct spi_flash_write_stats stats;
 	int status;
-	uint8_t wip_status = FLASH_STATUS_WIP;
 	uint8_t read_status = 0;
 
 	TEST_START;
@@ -14389,33 +15766,45 @@ static void spi_flash_test_wait_for_write_no_timeout (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_write_poll_delay (&flash, SPI_FLASH_WRITE_OP_SECTOR_ERASE, 20);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_WRITE_ENABLE);
+	status |= flash_master_mock_expect_xfer (&mock, 0, FLASH_EXP_ERASE_CMD (0x20, 0x1000));
 	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &read_status, 1,
 		FLASH_EXP_READ_STATUS_REG);
 
 	CuAssertIntEquals (test, 0, status);
 
-	status = spi_flash_wait_for_write (&flash, -1);
+	status = spi_flash_sector_erase (&flash, 0x1000);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_validate_and_release (&mock);
+	status = mock_validate (&mock.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_get_write_stats (&flash, SPI_FLASH_WRITE_OP_SECTOR_ERASE, &stats);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.count);
+	CuAssertIntEquals (test, 1, stats.polls);
+	CuAssertTrue (test, (stats.min_ms >= 20));
+
+	spi_flash_is_write_in_progress (&flash);
 
+	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
 
-static void spi_flash_test_wait_for_write_error (CuTest *test)
+static void spi_flash_test_set_write_poll_delay_null (CuTest *test)
 {
 	struct spi_flash_state state;
 	struct spi_flash flash;
 	struct flash_master_mock mock;
 	int status;
-	uint8_t wip_status = FLASH_STATUS_WIP;
 
 	TEST_START;
 
@@ -14425,23 +15814,15 @@ static void spi_flash_test_wait_for_write_error (CuTest *test)
 	status = spi_flash_init (&flash, &state, &mock.base);
 	CuAssertIntEquals (test, 0, status);
 
-	status = flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, 0, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-	status |= flash_master_mock_expect_rx_xfer (&mock, FLASH_MASTER_XFER_FAILED, &wip_status, 1,
-		FLASH_EXP_READ_STATUS_REG);
-
-	CuAssertIntEquals (test, 0, status);
+	status = spi_flash_set_write_poll_delay (NULL, SPI_FLASH_WRITE_OP_SECTOR_ERASE, 20);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
-	status = spi_flash_wait_for_write (&flash, 100);
-	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	status = spi_flash_set_write_poll_delay (&flash, NUM_SPI_FLASH_WRITE_OPS, 20);
+	CuAssertIntEquals (test, SPI_FLASH_INVALID_ARGUMENT, status);
 
 	status = mock_validate (&mock.mock);
 	CuAssertIntEquals (test, 0, status);
 
-	spi_flash_is_write_in_progress (&flash);
-
 	flash_master_mock_release (&mock);
 	spi_flash_release (&flash);
 }
@@ -28384,6 +29765,7 @@ TEST (spi_flash_test_discover_device_properties_sfdp_error);
 TEST (spi_flash_test_discover_device_properties_large_device);
 TEST (spi_flash_test_discover_device_properties_incompatible_4byte_mode_switch);
 TEST (spi_flash_test_discover_device_properties_unknown_quad_enable);
+TEST (spi_flash_test_discover_device_properties_write_timing);
 TEST (spi_flash_test_enable_4byte_address_mode);
 TEST (spi_flash_test_enable_4byte_address_mode_disable);
 TEST (spi_flash_test_enable_4byte_address_mode_16M);
@@ -28519,6 +29901,17 @@ TEST (spi_flash_test_read_error_in_progress);
 TEST (spi_flash_test_read_error_in_progress_flag_status_register);
 TEST (spi_flash_test_read_status_error);
 TEST (spi_flash_test_read_error);
+TEST (spi_flash_test_read_write_state_tracking);
+TEST (spi_flash_test_read_write_state_tracking_write_in_progress);
+TEST (spi_flash_test_read_write_state_tracking_write_error);
+TEST (spi_flash_test_read_write_state_tracking_disabled);
+TEST (spi_flash_test_set_write_state_tracking_null);
+TEST (spi_flash_test_read_regions);
+TEST (spi_flash_test_read_regions_no_regions);
+TEST (spi_flash_test_read_regions_null);
+TEST (spi_flash_test_read_regions_out_of_range);
+TEST (spi_flash_test_read_regions_error_in_progress);
+TEST (spi_flash_test_read_regions_error);
 TEST (spi_flash_test_write);
 TEST (spi_flash_test_write_across_page);
 TEST (spi_flash_test_write_multiple_pages);
@@ -28545,6 +29938,10 @@ TEST (spi_flash_test_write_too_long);
 TEST (spi_flash_test_write_error_enable);
 TEST (spi_flash_test_write_error_write);
 TEST (spi_flash_test_write_error_second_page);
+TEST (spi_flash_test_write_sfdp_page_size);
+TEST (spi_flash_test_write_sequence);
+TEST (spi_flash_test_write_sequence_error_second_page);
+TEST (spi_flash_test_write_sequence_status_error);
 TEST (spi_flash_test_write_error_in_progress);
 TEST (spi_flash_test_write_error_in_progress_flag_status_register);
 TEST (spi_flash_test_write_status_error);
@@ -28621,6 +30018,7 @@ TEST (spi_flash_test_get_block_size_flash_api);
 TEST (spi_flash_test_get_block_size_static_read_only);
 TEST (spi_flash_test_get_block_size_null);
 TEST (spi_flash_test_get_page_size);
+TEST (spi_flash_test_get_page_size_sfdp);
 TEST (spi_flash_test_get_page_size_flash_api);
 TEST (spi_flash_test_get_page_size_static_read_only);
 TEST (spi_flash_test_get_page_size_null);
@@ -28641,6 +30039,18 @@ TEST (spi_flash_test_wait_for_write_timeout);
 TEST (spi_flash_test_wait_for_write_immediate_timeout);
 TEST (spi_flash_test_wait_for_write_no_timeout);
 TEST (spi_flash_test_wait_for_write_error);
+TEST (spi_flash_test_get_write_stats_no_writes);
+TEST (spi_flash_test_get_write_stats_page_program);
+TEST (spi_flash_test_get_write_stats_sector_erase);
+TEST (spi_flash_test_get_write_stats_wait_for_write_not_tracked);
+TEST (spi_flash_test_get_write_stats_null);
+TEST (spi_flash_test_reset_write_stats);
+TEST (spi_flash_test_reset_write_stats_null);
+TEST (spi_flash_test_set_poll_yield);
+TEST (spi_flash_test_set_poll_yield_not_called_for_erase);
+TEST (spi_flash_test_set_poll_yield_null);
+TEST (spi_flash_test_set_write_poll_delay);
+TEST (spi_flash_test_set_write_poll_delay_null);
 TEST (spi_flash_test_enable_quad_spi_no_quad_enable);
 TEST (spi_flash_test_enable_quad_spi_no_quad_enable_hold_disable_flag_status_register);
 TEST (spi_flash_test_enable_quad_spi_no_quad_enable_hold_disable_volatile_write_enable);
@@ -14,6 +14,7 @@
 #include "testing/mock/manifest/pfm/pfm_manager_mock.h"
 #include "testing/mock/spi_filter/spi_filter_interface_mock.h"
 #include "testing/mock/spi_filter/flash_mfg_filter_handler_mock.h"
+#include "testing/mock/system/event_task_mock.h"
 #include "testing/engines/hash_testing_engine.h"
 #include "testing/engines/rsa_testing_engine.h"
 #include "testing/crypto/rsa_testing.h"
@@ -46,6 +47,11 @@ struct host_flash_manager_dual_testing {
 	struct host_control_mock control;				/**< Mock for host control. */
 	struct pfm_mock pfm;							/**< Mock PFM for testing. */
 	struct pfm_mock pfm_good;						/**< Secondary mock PFM for testing. */
+	struct event_task_mock task;					/**< Mock for the parallel validation task. */
+	struct event_task_context context;				/**< Event context for the validation task. */
+	struct event_task_context *context_ptr;			/**< Pointer to the validation task context. */
+	HASH_TESTING_ENGINE hash_task;					/**< Hash engine for the validation task. */
+	RSA_TESTING_ENGINE rsa_task;					/**< RSA engine for the validation task. */
 	struct host_flash_manager_dual test;			/**< Flash manager under test. */
 };
 
@@ -387,6 +393,100 @@ static void host_flash_manager_dual_testing_initialize_flash_device (CuTest *tes
 	CuAssertIntEquals (test, 0, status);
 }
 
+/**
+ * Initialize a flash manager for testing with parallel flash validation enabled.
+ *
+ * @param test The testing framework.
+ * @param manager The testing components to initialize.
+ * @param ro_cs1 true if CS1 flash should be used as the RO flash.
+ */
+static void host_flash_manager_dual_testing_init_parallel_validation (CuTest *test,
+	struct host_flash_manager_dual_testing *manager, bool ro_cs1)
+{
+	int status;
+
+	host_flash_manager_dual_testing_init (test, manager, ro_cs1);
+
+	status = HASH_TESTING_ENGINE_INIT (&manager->hash_task);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&manager->rsa_task);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_mock_init (&manager->task);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&manager->context, 0, sizeof (manager->context));
+	manager->context_ptr = &manager->context;
+
+	status = host_flash_manager_dual_enable_parallel_validation (&manager->test,
+		&manager->task.base, &manager->hash_task.base, &manager->rsa_task.base);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release all testing components for parallel flash validation and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param manager The testing components to release.
+ */
+static void host_flash_manager_dual_testing_validate_and_release_parallel_validation (
+	CuTest *test, struct host_flash_manager_dual_testing *manager)
+{
+	int status;
+
+	status = event_task_mock_validate_and_release (&manager->task);
+	CuAssertIntEquals (test, 0, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&manager->hash_task);
+	RSA_TESTING_ENGINE_RELEASE (&manager->rsa_task);
+
+	host_flash_manager_dual_testing_validate_and_release (test, manager);
+}
+
+/**
+ * Mock action to run the flash manager event handler when the validation task is notified.
+ *
+ * @param expected The expectation context for the notification.
+ * @param called The calling context for the notification.
+ *
+ * @return Always 0.
+ */
+static int64_t host_flash_manager_dual_testing_execute_task (const struct mock_call *expected,
+	const struct mock_call *called)
+{
+	struct host_flash_manager_dual_testing *manager = expected->context;
+	bool reset = false;
+
+	manager->test.base_event.execute (&manager->test.base_event, &manager->context, &reset);
+
+	return 0;
+}
+
+/**
+ * Set up expectations for running read/write flash validation on the validation task.
+ *
+ * @param test The testing framework.
+ * @param manager The testing components.
+ */
+static void host_flash_manager_dual_testing_expect_validation_task (CuTest *test,
+	struct host_flash_manager_dual_testing *manager)
+{
+	int status;
+
+	status = mock_expect (&manager->task.mock, manager->task.base.get_event_context,
+		&manager->task, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager->task.mock, 0, &manager->context_ptr,
+		sizeof (manager->context_ptr), -1);
+
+	status |= mock_expect (&manager->task.mock, manager->task.base.notify, &manager->task, 0,
+		MOCK_ARG_PTR (&manager->test.base_event));
+	status |= mock_expect_external_action (&manager->task.mock,
+		host_flash_manager_dual_testing_execute_task, manager);
+
+	CuAssertIntEquals (test, 0, status);
+}
+
 
 /*******************
  * Test cases
@@ -420,6 +520,7 @@ static void host_flash_manager_dual_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, manager.test.base.set_flash_for_host_access);
 	CuAssertPtrNotNull (test, manager.test.base.host_has_flash_access);
 	CuAssertPtrNotNull (test, manager.test.base.reset_flash);
+	CuAssertPtrEquals (test, NULL, manager.test.base.validate_flash_parallel);
 
 	host_flash_manager_dual_testing_validate_and_release (test, &manager);
 }
@@ -546,6 +647,57 @@ static void host_flash_manager_dual_test_release_null (CuTest *test)
 	host_flash_manager_dual_release (NULL);
 }
 
+static void host_flash_manager_dual_test_enable_parallel_validation (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init_parallel_validation (test, &manager, false);
+
+	CuAssertPtrNotNull (test, manager.test.base.validate_flash_parallel);
+	CuAssertPtrNotNull (test, manager.test.base_event.execute);
+
+	host_flash_manager_dual_testing_validate_and_release_parallel_validation (test, &manager);
+}
+
+static void host_flash_manager_dual_test_enable_parallel_validation_null (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct event_task_mock task;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init (test, &manager, false);
+
+	status = event_task_mock_init (&task);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_manager_dual_enable_parallel_validation (NULL, &task.base,
+		&manager.hash.base, &manager.rsa.base);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = host_flash_manager_dual_enable_parallel_validation (&manager.test, NULL,
+		&manager.hash.base, &manager.rsa.base);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = host_flash_manager_dual_enable_parallel_validation (&manager.test, &task.base,
+		NULL, &manager.rsa.base);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = host_flash_manager_dual_enable_parallel_validation (&manager.test, &task.base,
+		&manager.hash.base, NULL);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	CuAssertPtrEquals (test, NULL, manager.test.base.validate_flash_parallel);
+
+	status = event_task_mock_validate_and_release (&task);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_validate_and_release (test, &manager);
+}
+
 static void host_flash_manager_dual_test_get_read_only_flash_cs0 (CuTest *test)
 {
 	struct host_flash_manager_dual_testing manager;
@@ -7111,6 +7263,785 @@ static void host_flash_manager_dual_test_validate_read_write_flash_verify_error
 	host_flash_manager_dual_testing_validate_and_release (test, &manager);
 }
 
+static void host_flash_manager_dual_test_validate_flash_parallel (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct pfm_firmware fw_list;
+	const char *fw_exp = NULL;
+	struct pfm_firmware_version version;
+	struct pfm_firmware_versions version_list;
+	const char *version_exp = "1234";
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	char *img_data = "Test";
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_output;
+	struct host_flash_manager_rw_regions ro_output;
+	int ro_status;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init_parallel_validation (test, &manager, false);
+
+	fw_list.ids = &fw_exp;
+	fw_list.count = 1;
+
+	version.fw_version_id = version_exp;
+	version.version_addr = 0x123;
+	version.blank_byte = 0xff;
+
+	version_list.versions = &version;
+	version_list.count = 1;
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (img_data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = spi_flash_set_device_size (&manager.flash0, 0x1000);
+	status |= spi_flash_set_device_size (&manager.flash1, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Prepare the read/write flash validation. */
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 3);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list, sizeof (version_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 0);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list, sizeof (img_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 1);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list, sizeof (rw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 2);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (0));
+
+	/* Verify the read/write flash. */
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, (uint8_t*) img_data,
+		strlen (img_data), FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (img_data)));
+
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0 + strlen (img_data),
+		0x200 - strlen (img_data));
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0x300, 0x1000 - 0x300);
+
+	/* Validate the read-only flash. */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 7);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list, sizeof (version_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 4);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list, sizeof (img_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 5);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list, sizeof (rw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 6);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (4));
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) img_data,
+		strlen (img_data), FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (img_data)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (5));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (7));
+
+	/* Finish read/write flash validation. */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (1));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (3));
+
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_expect_validation_task (test, &manager);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, &manager.rsa.base, false, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MANAGER_DUAL_ACTION_VALIDATE, manager.context.action);
+
+	CuAssertIntEquals (test, 1, rw_output.count);
+	CuAssertPtrNotNull (test, rw_output.writable);
+	CuAssertPtrEquals (test, &manager.pfm, rw_output.pfm);
+	CuAssertPtrEquals (test, &rw_region, (void*) rw_output.writable->regions);
+
+	CuAssertIntEquals (test, 1, ro_output.count);
+	CuAssertPtrNotNull (test, ro_output.writable);
+	CuAssertPtrEquals (test, &manager.pfm, ro_output.pfm);
+	CuAssertPtrEquals (test, &rw_region, (void*) ro_output.writable->regions);
+
+	status = mock_validate (&manager.flash_mock0.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manager.flash_mock1.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manager.pfm.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (2));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions,
+		&manager.pfm, 0, MOCK_ARG_SAVED_ARG (6));
+	CuAssertIntEquals (test, 0, status);
+
+	manager.test.base.free_read_write_regions (&manager.test.base, &rw_output);
+	manager.test.base.free_read_write_regions (&manager.test.base, &ro_output);
+
+	host_flash_manager_dual_testing_validate_and_release_parallel_validation (test, &manager);
+}
+
+static void host_flash_manager_dual_test_validate_flash_parallel_rw_verify_error (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct pfm_firmware fw_list;
+	const char *fw_exp = NULL;
+	struct pfm_firmware_version version;
+	struct pfm_firmware_versions version_list;
+	const char *version_exp = "1234";
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	char *img_data = "Test";
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_output;
+	struct host_flash_manager_rw_regions ro_output;
+	int ro_status;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init_parallel_validation (test, &manager, false);
+
+	fw_list.ids = &fw_exp;
+	fw_list.count = 1;
+
+	version.fw_version_id = version_exp;
+	version.version_addr = 0x123;
+	version.blank_byte = 0xff;
+
+	version_list.versions = &version;
+	version_list.count = 1;
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (img_data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = spi_flash_set_device_size (&manager.flash0, 0x1000);
+	status |= spi_flash_set_device_size (&manager.flash1, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Prepare the read/write flash validation. */
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 3);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list, sizeof (version_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 0);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list, sizeof (img_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 1);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list, sizeof (rw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 2);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (0));
+
+	/* Verify the read/write flash. */
+	status |= flash_master_mock_expect_xfer (&manager.flash_mock1, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	/* Validate the read-only flash. */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 7);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list, sizeof (version_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 4);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list, sizeof (img_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 5);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list, sizeof (rw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 6);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (4));
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) img_data,
+		strlen (img_data), FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (img_data)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (5));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (7));
+
+	/* Finish read/write flash validation. */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions,
+		&manager.pfm, 0, MOCK_ARG_SAVED_ARG (2));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (1));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (3));
+
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_expect_validation_task (test, &manager);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, &manager.rsa.base, false, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, status);
+	CuAssertIntEquals (test, 0, ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MANAGER_DUAL_ACTION_VALIDATE, manager.context.action);
+
+	CuAssertIntEquals (test, 1, ro_output.count);
+	CuAssertPtrNotNull (test, ro_output.writable);
+	CuAssertPtrEquals (test, &manager.pfm, ro_output.pfm);
+	CuAssertPtrEquals (test, &rw_region, (void*) ro_output.writable->regions);
+
+	status = mock_validate (&manager.pfm.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions,
+		&manager.pfm, 0, MOCK_ARG_SAVED_ARG (6));
+	CuAssertIntEquals (test, 0, status);
+
+	manager.test.base.free_read_write_regions (&manager.test.base, &ro_output);
+
+	host_flash_manager_dual_testing_validate_and_release_parallel_validation (test, &manager);
+}
+
+static void host_flash_manager_dual_test_validate_flash_parallel_ro_verify_error (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct pfm_firmware fw_list;
+	const char *fw_exp = NULL;
+	struct pfm_firmware_version version;
+	struct pfm_firmware_versions version_list;
+	const char *version_exp = "1234";
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	char *img_data = "Test";
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_output;
+	struct host_flash_manager_rw_regions ro_output;
+	int ro_status;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init_parallel_validation (test, &manager, false);
+
+	fw_list.ids = &fw_exp;
+	fw_list.count = 1;
+
+	version.fw_version_id = version_exp;
+	version.version_addr = 0x123;
+	version.blank_byte = 0xff;
+
+	version_list.versions = &version;
+	version_list.count = 1;
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (img_data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = spi_flash_set_device_size (&manager.flash0, 0x1000);
+	status |= spi_flash_set_device_size (&manager.flash1, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Prepare the read/write flash validation. */
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 3);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list, sizeof (version_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 0);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list, sizeof (img_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 1);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list, sizeof (rw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 2);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (0));
+
+	/* Verify the read/write flash. */
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, (uint8_t*) img_data,
+		strlen (img_data), FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (img_data)));
+
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0 + strlen (img_data),
+		0x200 - strlen (img_data));
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0x300, 0x1000 - 0x300);
+
+	/* Validate the read-only flash. */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 7);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list, sizeof (version_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 4);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list, sizeof (img_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 5);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list, sizeof (rw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 6);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (4));
+
+	status |= flash_master_mock_expect_xfer (&manager.flash_mock0, FLASH_MASTER_XFER_FAILED,
+		FLASH_EXP_READ_STATUS_REG);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions,
+		&manager.pfm, 0, MOCK_ARG_SAVED_ARG (6));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (5));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (7));
+
+	/* Finish read/write flash validation. */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (1));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (3));
+
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_testing_expect_validation_task (test, &manager);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, &manager.rsa.base, false, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, FLASH_MASTER_XFER_FAILED, ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MANAGER_DUAL_ACTION_VALIDATE, manager.context.action);
+
+	CuAssertIntEquals (test, 1, rw_output.count);
+	CuAssertPtrNotNull (test, rw_output.writable);
+	CuAssertPtrEquals (test, &manager.pfm, rw_output.pfm);
+	CuAssertPtrEquals (test, &rw_region, (void*) rw_output.writable->regions);
+
+	status = mock_validate (&manager.flash_mock0.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manager.flash_mock1.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manager.pfm.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (2));
+	CuAssertIntEquals (test, 0, status);
+
+	manager.test.base.free_read_write_regions (&manager.test.base, &rw_output);
+
+	host_flash_manager_dual_testing_validate_and_release_parallel_validation (test, &manager);
+}
+
+static void host_flash_manager_dual_test_validate_flash_parallel_task_busy (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct pfm_firmware fw_list;
+	const char *fw_exp = NULL;
+	struct pfm_firmware_version version;
+	struct pfm_firmware_versions version_list;
+	const char *version_exp = "1234";
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list;
+	char *img_data = "Test";
+	struct flash_region rw_region;
+	struct pfm_read_write rw_prop;
+	struct pfm_read_write_regions rw_list;
+	struct host_flash_manager_rw_regions rw_output;
+	struct host_flash_manager_rw_regions ro_output;
+	int ro_status;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init_parallel_validation (test, &manager, false);
+
+	fw_list.ids = &fw_exp;
+	fw_list.count = 1;
+
+	version.fw_version_id = version_exp;
+	version.version_addr = 0x123;
+	version.blank_byte = 0xff;
+
+	version_list.versions = &version;
+	version_list.count = 1;
+
+	img_region.start_addr = 0;
+	img_region.length = strlen (img_data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list.images_sig = &sig;
+	img_list.images_hash = NULL;
+	img_list.count = 1;
+
+	rw_region.start_addr = 0x200;
+	rw_region.length = 0x100;
+
+	rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list.regions = &rw_region;
+	rw_list.properties = &rw_prop;
+	rw_list.count = 1;
+
+	status = spi_flash_set_device_size (&manager.flash0, 0x1000);
+	status |= spi_flash_set_device_size (&manager.flash1, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Prepare the read/write flash validation. */
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 3);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list, sizeof (version_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 0);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list, sizeof (img_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 1);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list, sizeof (rw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 2);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (0));
+
+	/* Verify the read/write flash. */
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock1, 0, (uint8_t*) img_data,
+		strlen (img_data), FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (img_data)));
+
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0 + strlen (img_data),
+		0x200 - strlen (img_data));
+	status |= flash_master_mock_expect_blank_check (&manager.flash_mock1, 0x300, 0x1000 - 0x300);
+
+	/* Validate the read-only flash. */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware, &manager.pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 0, &fw_list, sizeof (fw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 0, 7);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_supported_versions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 1, &version_list, sizeof (version_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 1, 4);
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) version_exp,
+		strlen (version_exp), FLASH_EXP_READ_CMD (0x03, 0x123, 0, -1, strlen (version_exp)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_firmware_images, &manager.pfm, 0,
+		MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &img_list, sizeof (img_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 5);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.get_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version_exp, strlen (version_exp) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager.pfm.mock, 2, &rw_list, sizeof (rw_list), -1);
+	status |= mock_expect_save_arg (&manager.pfm.mock, 2, 6);
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_fw_versions, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (4));
+
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&manager.flash_mock0, 0, (uint8_t*) img_data,
+		strlen (img_data), FLASH_EXP_READ_CMD (0x03, 0, 0, -1, strlen (img_data)));
+
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (5));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (7));
+
+	/* Finish read/write flash validation. */
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware_images, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (1));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_firmware, &manager.pfm, 0,
+		MOCK_ARG_SAVED_ARG (3));
+
+	CuAssertIntEquals (test, 0, status);
+
+	/* The read/write flash will be verified without using the task. */
+	status = mock_expect (&manager.task.mock, manager.task.base.get_event_context, &manager.task,
+		EVENT_TASK_BUSY, MOCK_ARG_NOT_NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, &manager.rsa.base, false, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, ro_status);
+
+	CuAssertIntEquals (test, 1, rw_output.count);
+	CuAssertPtrNotNull (test, rw_output.writable);
+	CuAssertPtrEquals (test, &manager.pfm, rw_output.pfm);
+	CuAssertPtrEquals (test, &rw_region, (void*) rw_output.writable->regions);
+
+	CuAssertIntEquals (test, 1, ro_output.count);
+	CuAssertPtrNotNull (test, ro_output.writable);
+	CuAssertPtrEquals (test, &manager.pfm, ro_output.pfm);
+	CuAssertPtrEquals (test, &rw_region, (void*) ro_output.writable->regions);
+
+	status = mock_validate (&manager.flash_mock0.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manager.flash_mock1.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manager.pfm.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions, &manager.pfm,
+		0, MOCK_ARG_SAVED_ARG (2));
+	status |= mock_expect (&manager.pfm.mock, manager.pfm.base.free_read_write_regions,
+		&manager.pfm, 0, MOCK_ARG_SAVED_ARG (6));
+	CuAssertIntEquals (test, 0, status);
+
+	manager.test.base.free_read_write_regions (&manager.test.base, &rw_output);
+	manager.test.base.free_read_write_regions (&manager.test.base, &ro_output);
+
+	host_flash_manager_dual_testing_validate_and_release_parallel_validation (test, &manager);
+}
+
+static void host_flash_manager_dual_test_validate_flash_parallel_null (CuTest *test)
+{
+	struct host_flash_manager_dual_testing manager;
+	struct host_flash_manager_rw_regions rw_output;
+	struct host_flash_manager_rw_regions ro_output;
+	int ro_status;
+	int status;
+
+	TEST_START;
+
+	host_flash_manager_dual_testing_init_parallel_validation (test, &manager, false);
+
+	status = manager.test.base.validate_flash_parallel (NULL, &manager.pfm.base, NULL,
+		&manager.hash.base, &manager.rsa.base, false, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, NULL, NULL,
+		&manager.hash.base, &manager.rsa.base, false, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, NULL, &manager.rsa.base, false, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, NULL, false, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, &manager.rsa.base, false, NULL, &ro_output, &ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, &manager.rsa.base, false, &rw_output, NULL, &ro_status);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	status = manager.test.base.validate_flash_parallel (&manager.test.base, &manager.pfm.base,
+		NULL, &manager.hash.base, &manager.rsa.base, false, &rw_output, &ro_output, NULL);
+	CuAssertIntEquals (test, HOST_FLASH_MGR_INVALID_ARGUMENT, status);
+
+	host_flash_manager_dual_testing_validate_and_release_parallel_validation (test, &manager);
+}
+
 static void host_flash_manager_dual_test_free_read_write_regions_null (CuTest *test)
 {
 	struct host_flash_manager_dual_testing manager;
@@ -12763,6 +13694,8 @@ TEST (host_flash_manager_dual_test_init_null);
 TEST (host_flash_manager_dual_test_init_with_managed_flash_initialization);
 TEST (host_flash_manager_dual_test_init_with_managed_flash_initialization_null);
 TEST (host_flash_manager_dual_test_release_null);
+TEST (host_flash_manager_dual_test_enable_parallel_validation);
+TEST (host_flash_manager_dual_test_enable_parallel_validation_null);
 TEST (host_flash_manager_dual_test_get_read_only_flash_cs0);
 TEST (host_flash_manager_dual_test_get_read_only_flash_cs1);
 TEST (host_flash_manager_dual_test_get_read_only_flash_null);
@@ -12832,6 +13765,11 @@ TEST (host_flash_manager_dual_test_validate_read_write_flash_pfm_images_error);
 TEST (host_flash_manager_dual_test_validate_read_write_flash_pfm_rw_error);
 TEST (host_flash_manager_dual_test_validate_read_write_flash_version_error);
 TEST (host_flash_manager_dual_test_validate_read_write_flash_verify_error);
+TEST (host_flash_manager_dual_test_validate_flash_parallel);
+TEST (host_flash_manager_dual_test_validate_flash_parallel_rw_verify_error);
+TEST (host_flash_manager_dual_test_validate_flash_parallel_ro_verify_error);
+TEST (host_flash_manager_dual_test_validate_flash_parallel_task_busy);
+TEST (host_flash_manager_dual_test_validate_flash_parallel_null);
 TEST (host_flash_manager_dual_test_free_read_write_regions_null);
 TEST (host_flash_manager_dual_test_free_read_write_regions_null_list);
 TEST (host_flash_manager_dual_test_free_read_write_regions_null_pfm);
@@ -455,6 +455,68 @@ static void host_fw_determine_version_test_same_address_different_lengths_shorte
 	spi_flash_release (&flash);
 }
 
+static void host_fw_determine_version_test_long_version_id (CuTest *test)
+{
+	struct pfm_firmware_version version[2];
+	struct pfm_firmware_versions version_list;
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	int status;
+	char version_exp[HOST_FW_UTIL_VERSION_BUFFER_LEN + 17];
+	char version_other[HOST_FW_UTIL_VERSION_BUFFER_LEN + 5];
+	const struct pfm_firmware_version *version_out;
+
+	TEST_START;
+
+	memset (version_exp, '1', sizeof (version_exp) - 1);
+	version_exp[sizeof (version_exp) - 1] = '\0';
+
+	memcpy (version_other, version_exp, sizeof (version_other) - 2);
+	version_other[sizeof (version_other) - 2] = '2';
+	version_other[sizeof (version_other) - 1] = '\0';
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x1000000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp,
+		sizeof (version_exp), FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, strlen (version_other)));
+
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) version_exp,
+		sizeof (version_exp),
+		FLASH_EXP_READ_CMD (0x03, 0x100 + strlen (version_other), 0, -1,
+		strlen (version_exp) - strlen (version_other)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	version[0].fw_version_id = version_exp;
+	version[0].version_addr = 0x100;
+	version[1].fw_version_id = version_other;
+	version[1].version_addr = 0x100;
+
+	version_list.versions = version;
+	version_list.count = 2;
+
+	status = host_fw_determine_version (&flash, &version_list, &version_out);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, &version[0], (void*) version_out);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+}
+
 static void host_fw_determine_version_test_null (CuTest *test)
 {
 	struct pfm_firmware_version version;
@@ -7550,6 +7612,96 @@ static void host_fw_are_read_write_regions_different_test_multiple_reordered (Cu
 	CuAssertIntEquals (test, false, status);
 }
 
+static void host_fw_are_read_write_regions_different_test_many_regions_reordered (CuTest *test)
+{
+	struct flash_region rw_region1[256];
+	struct pfm_read_write rw_prop1[256];
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2[256];
+	struct pfm_read_write rw_prop2[256];
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+	int i;
+
+	TEST_START;
+
+	for (i = 0; i < 256; i++) {
+		rw_region1[i].start_addr = i * 0x1000;
+		rw_region1[i].length = 0x100 + i;
+		rw_prop1[i].on_failure = PFM_RW_DO_NOTHING;
+
+		/* Interleave the regions from both ends of the first list. */
+		if (i & 1) {
+			rw_region2[i].start_addr = (255 - (i / 2)) * 0x1000;
+			rw_region2[i].length = 0x100 + (255 - (i / 2));
+		}
+		else {
+			rw_region2[i].start_addr = (i / 2) * 0x1000;
+			rw_region2[i].length = 0x100 + (i / 2);
+		}
+		rw_prop2[i].on_failure = PFM_RW_DO_NOTHING;
+	}
+
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 256;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 256;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, false, status);
+
+	rw_region2[200].length++;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, true, status);
+}
+
+static void host_fw_are_read_write_regions_different_test_many_regions_duplicates (CuTest *test)
+{
+	struct flash_region rw_region1[256];
+	struct pfm_read_write rw_prop1[256];
+	struct pfm_read_write_regions rw_list1;
+	struct flash_region rw_region2[256];
+	struct pfm_read_write rw_prop2[256];
+	struct pfm_read_write_regions rw_list2;
+	bool status;
+	int i;
+
+	TEST_START;
+
+	/* Both lists contain the same set of regions, but with a different number of copies. */
+	for (i = 0; i < 256; i++) {
+		rw_region1[i].start_addr = (i % 2) * 0x1000;
+		rw_region1[i].length = 0x100;
+		rw_prop1[i].on_failure = PFM_RW_DO_NOTHING;
+
+		rw_region2[i].start_addr = (i % 4) ? 0 : 0x1000;
+		rw_region2[i].length = 0x100;
+		rw_prop2[i].on_failure = PFM_RW_DO_NOTHING;
+	}
+
+	rw_list1.regions = rw_region1;
+	rw_list1.properties = rw_prop1;
+	rw_list1.count = 256;
+
+	rw_list2.regions = rw_region2;
+	rw_list2.properties = rw_prop2;
+	rw_list2.count = 256;
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, true, status);
+
+	for (i = 0; i < 256; i++) {
+		rw_region2[i].start_addr = ((i + 1) % 2) * 0x1000;
+	}
+
+	status = host_fw_are_read_write_regions_different (&rw_list1, &rw_list2);
+	CuAssertIntEquals (test, false, status);
+}
+
 static void host_fw_are_read_write_regions_different_test_null (CuTest *test)
 {
 	struct flash_region rw_region1;
@@ -13809,6 +13961,263 @@ static void host_fw_full_flash_verification_multiple_fw_test_hashes_multiple (Cu
 	RSA_TESTING_ENGINE_RELEASE (&rsa);
 }
 
+static void host_fw_full_flash_verification_multiple_fw_test_overlapping_regions (CuTest *test)
+{
+	struct flash_region img_region;
+	struct pfm_image_signature sig;
+	struct pfm_image_list img_list[2];
+	struct flash_region rw_region[3];
+	struct pfm_read_write rw_prop[3];
+	struct pfm_read_write_regions rw_list[2];
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
+	int status;
+	char *data = "Test";
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_expect_rx_xfer (&flash_mock, 0, &WIP_STATUS, 1,
+		FLASH_EXP_READ_STATUS_REG);
+	status |= flash_master_mock_expect_rx_xfer (&flash_mock, 0, (uint8_t*) data, strlen (data),
+		FLASH_EXP_READ_CMD (0x03, 0x100, 0, -1, strlen (data)));
+
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0, 0xc0);
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x100 + strlen (data),
+		0x100 - strlen (data));
+	status |= flash_master_mock_expect_blank_check (&flash_mock, 0x300, 0xd00);
+
+	CuAssertIntEquals (test, 0, status);
+
+	img_region.start_addr = 0x100;
+	img_region.length = strlen (data);
+
+	sig.regions = &img_region;
+	sig.count = 1;
+	memcpy (&sig.key, &RSA_PUBLIC_KEY, sizeof (RSA_PUBLIC_KEY));
+	memcpy (&sig.signature, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+	sig.sig_length = RSA_ENCRYPT_LEN;
+	sig.always_validate = 1;
+
+	img_list[0].images_sig = &sig;
+	img_list[0].images_hash = NULL;
+	img_list[0].count = 1;
+
+	img_list[1].images_sig = NULL;
+	img_list[1].images_hash = NULL;
+	img_list[1].count = 0;
+
+	/* The first R/W region ends in the middle of the image and the second one is completely
+	 * contained by the first. */
+	rw_region[0].start_addr = 0xc0;
+	rw_region[0].length = 0x42;
+	rw_region[1].start_addr = 0xc0;
+	rw_region[1].length = 0x10;
+	rw_region[2].start_addr = 0x200;
+	rw_region[2].length = 0x100;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list[0].regions = &rw_region[0];
+	rw_list[0].properties = &rw_prop[0];
+	rw_list[0].count = 2;
+
+	rw_list[1].regions = &rw_region[2];
+	rw_list[1].properties = &rw_prop[2];
+	rw_list[1].count = 1;
+
+	status = spi_flash_set_device_size (&flash, 0x1000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_full_flash_verification_multiple_fw (&flash, img_list, rw_list, 2, 0xff,
+		&hash.base, &rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
+}
+
+static void host_fw_full_flash_verification_multiple_fw_test_many_regions (CuTest *test)
+{
+	struct flash_region rw_region[4][64];
+	struct pfm_read_write rw_prop[64];
+	struct pfm_read_write_regions rw_list[4];
+	struct pfm_image_list img_list[4];
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
+	int status;
+	int i;
+	int j;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Every firmware component has R/W regions interleaved with the other components, and each
+	 * list is in reverse address order. */
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 64; j++) {
+			rw_region[i][j].start_addr = (((63 - j) * 4) + i) * 0x200;
+			rw_region[i][j].length = 0x100;
+		}
+
+		rw_list[i].regions = rw_region[i];
+		rw_list[i].properties = rw_prop;
+		rw_list[i].count = 64;
+
+		img_list[i].images_sig = NULL;
+		img_list[i].images_hash = NULL;
+		img_list[i].count = 0;
+	}
+
+	for (j = 0; j < 64; j++) {
+		rw_prop[j].on_failure = PFM_RW_DO_NOTHING;
+	}
+
+	status = 0;
+	for (i = 0; i < 256; i++) {
+		status |= flash_master_mock_expect_blank_check (&flash_mock, (i * 0x200) + 0x100, 0x100);
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x20000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_full_flash_verification_multiple_fw (&flash, img_list, rw_list, 4, 0xff,
+		&hash.base, &rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
+}
+
+static void host_fw_full_flash_verification_multiple_fw_test_many_regions_merged_large_region (
+	CuTest *test)
+{
+	struct flash_region rw_region[4][64];
+	struct pfm_read_write rw_prop[64];
+	struct flash_region large_region;
+	struct pfm_read_write_regions rw_list[5];
+	struct pfm_image_list img_list[5];
+	struct flash_master_mock flash_mock;
+	struct spi_flash_state state;
+	struct spi_flash flash;
+	HASH_TESTING_ENGINE hash;
+	RSA_TESTING_ENGINE rsa;
+	int status;
+	int i;
+	int j;
+
+	TEST_START;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_init (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_init (&flash, &state, &flash_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Every firmware component has R/W regions interleaved with the other components, and each
+	 * list is in reverse address order. */
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 64; j++) {
+			rw_region[i][j].start_addr = (((63 - j) * 4) + i) * 0x200;
+			rw_region[i][j].length = 0x100;
+		}
+
+		rw_list[i].regions = rw_region[i];
+		rw_list[i].properties = rw_prop;
+		rw_list[i].count = 64;
+	}
+
+	for (j = 0; j < 64; j++) {
+		rw_prop[j].on_failure = PFM_RW_DO_NOTHING;
+	}
+
+	/* The last component has a single region that covers many of the other regions, so regions
+	 * with higher addresses have already been added to the map before it. */
+	large_region.start_addr = 0x3f00;
+	large_region.length = 0x4200;
+
+	rw_list[4].regions = &large_region;
+	rw_list[4].properties = rw_prop;
+	rw_list[4].count = 1;
+
+	for (i = 0; i < 5; i++) {
+		img_list[i].images_sig = NULL;
+		img_list[i].images_hash = NULL;
+		img_list[i].count = 0;
+	}
+
+	status = 0;
+	for (i = 0; i < 256; i++) {
+		/* Regions from 0x3e00 to 0x8100 are merged with the large region. */
+		if ((i < 0x1f) || (i > 0x3f)) {
+			status |= flash_master_mock_expect_blank_check (&flash_mock, (i * 0x200) + 0x100,
+				0x100);
+		}
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&flash, 0x20000);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_full_flash_verification_multiple_fw (&flash, img_list, rw_list, 5, 0xff,
+		&hash.base, &rsa.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_master_mock_validate_and_release (&flash_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spi_flash_release (&flash);
+	HASH_TESTING_ENGINE_RELEASE (&hash);
+	RSA_TESTING_ENGINE_RELEASE (&rsa);
+}
+
 static void host_fw_full_flash_verification_multiple_fw_test_null (CuTest *test)
 {
 	struct flash_region img_region;
@@ -14593,6 +15002,110 @@ static void host_fw_config_spi_filter_read_write_regions_multiple_fw_test_combin
 	CuAssertIntEquals (test, 0, status);
 }
 
+static void host_fw_config_spi_filter_read_write_regions_multiple_fw_test_overlapping_regions (
+	CuTest *test)
+{
+	struct spi_filter_interface_mock filter;
+	struct flash_region rw_region[4];
+	struct pfm_read_write rw_prop[4];
+	struct pfm_read_write_regions rw_list[2];
+	int status;
+
+	TEST_START;
+
+	status = spi_filter_interface_mock_init (&filter);
+	CuAssertIntEquals (test, 0, status);
+
+	rw_region[0].start_addr = 0x10000;
+	rw_region[0].length = 0x20000;
+
+	rw_region[1].start_addr = 0x60000;
+	rw_region[1].length = 0x30000;
+
+	rw_region[2].start_addr = 0x20000;
+	rw_region[2].length = 0x20000;
+
+	rw_region[3].start_addr = 0x70000;
+	rw_region[3].length = 0x10000;
+
+	rw_prop[0].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[1].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[2].on_failure = PFM_RW_DO_NOTHING;
+	rw_prop[3].on_failure = PFM_RW_DO_NOTHING;
+
+	rw_list[0].regions = &rw_region[0];
+	rw_list[0].properties = &rw_prop[0];
+	rw_list[0].count = 2;
+
+	rw_list[1].regions = &rw_region[2];
+	rw_list[1].properties = &rw_prop[2];
+	rw_list[1].count = 2;
+
+	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter, 0);
+	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
+		MOCK_ARG (1), MOCK_ARG (0x10000), MOCK_ARG (0x40000));
+	status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
+		MOCK_ARG (2), MOCK_ARG (0x60000), MOCK_ARG (0x90000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_config_spi_filter_read_write_regions_multiple_fw (&filter.base, rw_list, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_filter_interface_mock_validate_and_release (&filter);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void host_fw_config_spi_filter_read_write_regions_multiple_fw_test_many_regions (
+	CuTest *test)
+{
+	struct spi_filter_interface_mock filter;
+	struct flash_region rw_region[4][64];
+	struct pfm_read_write rw_prop[64];
+	struct pfm_read_write_regions rw_list[4];
+	int status;
+	int i;
+	int j;
+
+	TEST_START;
+
+	status = spi_filter_interface_mock_init (&filter);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Regions from pairs of firmware components are contiguous and must be combined. */
+	for (i = 0; i < 4; i++) {
+		for (j = 0; j < 64; j++) {
+			rw_region[i][j].start_addr = (((63 - j) * 4) + i) * 0x10000;
+			if (i & 1) {
+				rw_region[i][j].start_addr -= 0x8000;
+			}
+			rw_region[i][j].length = 0x8000;
+		}
+
+		rw_list[i].regions = rw_region[i];
+		rw_list[i].properties = rw_prop;
+		rw_list[i].count = 64;
+	}
+
+	for (j = 0; j < 64; j++) {
+		rw_prop[j].on_failure = PFM_RW_DO_NOTHING;
+	}
+
+	status = mock_expect (&filter.mock, filter.base.clear_filter_rw_regions, &filter, 0);
+	for (i = 0; i < 128; i++) {
+		status |= mock_expect (&filter.mock, filter.base.set_filter_rw_region, &filter, 0,
+			MOCK_ARG (i + 1), MOCK_ARG (i * 0x20000), MOCK_ARG ((i * 0x20000) + 0x10000));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_fw_config_spi_filter_read_write_regions_multiple_fw (&filter.base, rw_list, 4);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_filter_interface_mock_validate_and_release (&filter);
+	CuAssertIntEquals (test, 0, status);
+}
+
 static void host_fw_config_spi_filter_read_write_regions_multiple_fw_test_no_regions (CuTest *test)
 {
 	struct spi_filter_interface_mock filter;
@@ -15371,6 +15884,7 @@ TEST (host_fw_determine_version_test_different_lengths);
 TEST (host_fw_determine_version_test_same_address);
 TEST (host_fw_determine_version_test_same_address_different_lengths);
 TEST (host_fw_determine_version_test_same_address_different_lengths_shorter);
+TEST (host_fw_determine_version_test_long_version_id);
 TEST (host_fw_determine_version_test_null);
 TEST (host_fw_determine_version_test_empty_list);
 TEST (host_fw_determine_version_test_read_fail);
@@ -15473,6 +15987,8 @@ TEST (host_fw_are_read_write_regions_different_test_multiple_diff_size);
 TEST (host_fw_are_read_write_regions_different_test_second_fewer);
 TEST (host_fw_are_read_write_regions_different_test_first_fewer);
 TEST (host_fw_are_read_write_regions_different_test_multiple_reordered);
+TEST (host_fw_are_read_write_regions_different_test_many_regions_reordered);
+TEST (host_fw_are_read_write_regions_different_test_many_regions_duplicates);
 TEST (host_fw_are_read_write_regions_different_test_null);
 TEST (host_fw_restore_flash_device_test);
 TEST (host_fw_restore_flash_device_test_multipart_image);
@@ -15564,6 +16080,9 @@ TEST (host_fw_full_flash_verification_multiple_fw_test);
 TEST (host_fw_full_flash_verification_multiple_fw_test_multiple);
 TEST (host_fw_full_flash_verification_multiple_fw_test_hashes);
 TEST (host_fw_full_flash_verification_multiple_fw_test_hashes_multiple);
+TEST (host_fw_full_flash_verification_multiple_fw_test_overlapping_regions);
+TEST (host_fw_full_flash_verification_multiple_fw_test_many_regions);
+TEST (host_fw_full_flash_verification_multiple_fw_test_many_regions_merged_large_region);
 TEST (host_fw_full_flash_verification_multiple_fw_test_null);
 TEST (host_fw_restore_read_write_data_multiple_fw_test);
 TEST (host_fw_restore_read_write_data_multiple_fw_test_no_source_device);
@@ -15577,6 +16096,8 @@ TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_multiple_fw_
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_combine_multiple_regions);
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_combine_multiple_fw);
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_combine_multiple_fw_and_regions);
+TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_overlapping_regions);
+TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_many_regions);
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_no_regions);
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_no_fw);
 TEST (host_fw_config_spi_filter_read_write_regions_multiple_fw_test_null);
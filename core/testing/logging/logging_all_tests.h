@@ -39,12 +39,24 @@ static void add_all_logging_tests (CuSuite *suite)
 	!defined TESTING_SKIP_LOGGING_FLASH_SUITE
 	TESTING_RUN_SUITE (logging_flash);
 #endif
+#if (defined TESTING_RUN_LOGGING_FLASH_COMPRESSED_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_LOGGING_FLASH_COMPRESSED_SUITE
+	TESTING_RUN_SUITE (logging_flash_compressed);
+#endif
 #if (defined TESTING_RUN_LOGGING_MEMORY_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
 	!defined TESTING_SKIP_LOGGING_MEMORY_SUITE
 	TESTING_RUN_SUITE (logging_memory);
 #endif
+#if (defined TESTING_RUN_LOGGING_RING_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_LOGGING_RING_SUITE
+	TESTING_RUN_SUITE (logging_ring);
+#endif
 }
 
 
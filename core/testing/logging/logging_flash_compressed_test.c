@@ -0,0 +1,1255 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "common/unused.h"
+#include "flash/flash_virtual_ram.h"
+#include "logging/debug_log.h"
+#include "logging/logging_flash_compressed.h"
+#include "logging/logging_flash_compressed_static.h"
+#include "testing/mock/flash/flash_mock.h"
+
+
+TEST_SUITE_LABEL ("logging_flash_compressed");
+
+
+/**
+ * Number of sectors used by the log for testing.
+ */
+#define	LOGGING_FLASH_COMPRESSED_TESTING_SECTORS	4
+
+/**
+ * Flash address of the log for testing.
+ */
+#define	LOGGING_FLASH_COMPRESSED_TESTING_BASE		VIRTUAL_FLASH_BLOCK_SIZE
+
+
+/**
+ * Dependencies for testing.
+ */
+struct logging_flash_compressed_testing {
+	struct flash_virtual_ram_state flash_state;		/**< Context for the virtual flash. */
+	struct flash_virtual_ram flash;					/**< Flash device for the log. */
+	struct logging_flash_compressed_state state;	/**< Context for the log being tested. */
+	struct logging_flash_compressed test;			/**< Log being tested. */
+
+	/**
+	 * Memory for the virtual flash device.
+	 */
+	uint8_t flash_data[VIRTUAL_FLASH_BLOCK_SIZE * (LOGGING_FLASH_COMPRESSED_TESTING_SECTORS + 1)];
+
+	/**
+	 * Sector information for the log.
+	 */
+	struct logging_flash_compressed_sector sectors[LOGGING_FLASH_COMPRESSED_TESTING_SECTORS];
+};
+
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param test The testing framework.
+ * @param log The testing components to initialize.
+ */
+static void logging_flash_compressed_testing_init_dependencies (CuTest *test,
+	struct logging_flash_compressed_testing *log)
+{
+	int status;
+
+	memset (log->flash_data, 0xff, sizeof (log->flash_data));
+
+	status = flash_virtual_ram_init (&log->flash, &log->flash_state, log->flash_data,
+		sizeof (log->flash_data));
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize a log for testing.
+ *
+ * @param test The testing framework.
+ * @param log The testing components to initialize.
+ */
+static void logging_flash_compressed_testing_init (CuTest *test,
+	struct logging_flash_compressed_testing *log)
+{
+	int status;
+
+	logging_flash_compressed_testing_init_dependencies (test, log);
+
+	status = logging_flash_compressed_init (&log->test, &log->state, &log->flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log->sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Reinitialize the log being tested from the current flash contents.
+ *
+ * @param test The testing framework.
+ * @param log The testing components to reinitialize.
+ */
+static void logging_flash_compressed_testing_reinit (CuTest *test,
+	struct logging_flash_compressed_testing *log)
+{
+	int status;
+
+	logging_flash_compressed_release (&log->test);
+
+	status = logging_flash_compressed_init (&log->test, &log->state, &log->flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log->sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release test components.
+ *
+ * @param test The testing framework.
+ * @param log The testing components to release.
+ */
+static void logging_flash_compressed_testing_release (CuTest *test,
+	struct logging_flash_compressed_testing *log)
+{
+	UNUSED (test);
+
+	logging_flash_compressed_release (&log->test);
+	flash_virtual_ram_release (&log->flash);
+}
+
+/**
+ * Generate a debug log entry.
+ *
+ * @param entry The entry to generate.
+ * @param msg_index The message identifier for the entry.
+ * @param arg1 The first entry argument.
+ * @param arg2 The second entry argument.
+ * @param time The entry timestamp.
+ */
+static void logging_flash_compressed_testing_debug_entry (struct debug_log_entry_info *entry,
+	uint8_t msg_index, uint32_t arg1, uint32_t arg2, uint64_t time)
+{
+	entry->format = DEBUG_LOG_ENTRY_FORMAT;
+	entry->severity = DEBUG_LOG_SEVERITY_INFO;
+	entry->component = DEBUG_LOG_COMPONENT_SYSTEM;
+	entry->msg_index = msg_index;
+	entry->arg1 = arg1;
+	entry->arg2 = arg2;
+	entry->time = time;
+}
+
+/**
+ * Add debug log entries to the log.  Each entry uses the entry number for the message index and
+ * first argument.
+ *
+ * @param test The testing framework.
+ * @param log The testing components.
+ * @param first The number of the first entry to add.
+ * @param count The number of entries to add.
+ */
+static void logging_flash_compressed_testing_add_entries (CuTest *test,
+	struct logging_flash_compressed_testing *log, uint32_t first, uint32_t count)
+{
+	struct debug_log_entry_info entry;
+	uint32_t i;
+	int status;
+
+	for (i = first; i < (first + count); i++) {
+		logging_flash_compressed_testing_debug_entry (&entry, i, i, 0, 1000 * i);
+
+		status = log->test.base.create_entry (&log->test.base, (uint8_t*) &entry, sizeof (entry));
+		CuAssertIntEquals (test, 0, status);
+	}
+}
+
+/**
+ * Check that the log contains the expected sequence of entries added by
+ * logging_flash_compressed_testing_add_entries.
+ *
+ * @param test The testing framework.
+ * @param log The testing components.
+ * @param first The number of the first entry expected in the log.
+ * @param count The number of entries expected in the log.
+ */
+static void logging_flash_compressed_testing_check_entries (CuTest *test,
+	struct logging_flash_compressed_testing *log, uint32_t first, uint32_t count)
+{
+	struct debug_log_entry expected;
+	struct debug_log_entry *actual;
+	uint8_t contents[LOGGING_FLASH_COMPRESSED_TESTING_SECTORS * VIRTUAL_FLASH_BLOCK_SIZE * 8];
+	uint32_t i;
+	int status;
+
+	status = log->test.base.get_size (&log->test.base);
+	CuAssertIntEquals (test, sizeof (expected) * count, status);
+
+	status = log->test.base.read_contents (&log->test.base, 0, contents, sizeof (contents));
+	CuAssertIntEquals (test, sizeof (expected) * count, status);
+
+	for (i = 0; i < count; i++) {
+		expected.header.log_magic = LOGGING_MAGIC_START;
+		expected.header.length = sizeof (expected);
+		expected.header.entry_id = first + i;
+		logging_flash_compressed_testing_debug_entry (&expected.entry, first + i, first + i, 0,
+			1000 * (first + i));
+
+		actual = (struct debug_log_entry*) &contents[i * sizeof (expected)];
+		status = testing_validate_array ((uint8_t*) &expected, (uint8_t*) actual,
+			sizeof (expected));
+		CuAssertIntEquals (test, 0, status);
+	}
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void logging_flash_compressed_test_init (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct logging_flash_compressed_stats stats;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init_dependencies (test, &log);
+
+	status = logging_flash_compressed_init (&log.test, &log.state, &log.flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log.sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, log.test.base.create_entry);
+#ifndef LOGGING_DISABLE_FLUSH
+	CuAssertPtrNotNull (test, log.test.base.flush);
+#endif
+	CuAssertPtrNotNull (test, log.test.base.clear);
+	CuAssertPtrNotNull (test, log.test.base.get_size);
+	CuAssertPtrNotNull (test, log.test.base.read_contents);
+
+	status = log.test.base.get_size (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_get_stats (&log.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.entries);
+	CuAssertIntEquals (test, 0, stats.log_length);
+	CuAssertIntEquals (test, 0, stats.stored_length);
+	CuAssertIntEquals (test, 0, stats.min_erase_count);
+	CuAssertIntEquals (test, 0, stats.max_erase_count);
+	CuAssertIntEquals (test, 0, stats.total_erase_count);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_init_null (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init_dependencies (test, &log);
+
+	status = logging_flash_compressed_init (NULL, &log.state, &log.flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log.sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_flash_compressed_init (&log.test, NULL, &log.flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log.sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_flash_compressed_init (&log.test, &log.state, NULL,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log.sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_flash_compressed_init (&log.test, &log.state, &log.flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, NULL, LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	flash_virtual_ram_release (&log.flash);
+}
+
+static void logging_flash_compressed_test_init_one_sector (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init_dependencies (test, &log);
+
+	status = logging_flash_compressed_init (&log.test, &log.state, &log.flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log.sectors, 1);
+	CuAssertIntEquals (test, LOGGING_INSUFFICIENT_STORAGE, status);
+
+	flash_virtual_ram_release (&log.flash);
+}
+
+static void logging_flash_compressed_test_init_not_aligned (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init_dependencies (test, &log);
+
+	status = logging_flash_compressed_init (&log.test, &log.state, &log.flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE + 0x10, log.sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	CuAssertIntEquals (test, LOGGING_STORAGE_NOT_ALIGNED, status);
+
+	flash_virtual_ram_release (&log.flash);
+}
+
+static void logging_flash_compressed_test_init_small_sector (CuTest *test)
+{
+	struct flash_mock flash;
+	struct logging_flash_compressed_state state;
+	struct logging_flash_compressed logging;
+	struct logging_flash_compressed_sector sectors[2];
+	uint32_t bytes = 64;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_init (&logging, &state, &flash.base, 0x10000, sectors, 2);
+	CuAssertIntEquals (test, LOGGING_INSUFFICIENT_STORAGE, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void logging_flash_compressed_test_init_sector_size_error (CuTest *test)
+{
+	struct flash_mock flash;
+	struct logging_flash_compressed_state state;
+	struct logging_flash_compressed logging;
+	struct logging_flash_compressed_sector sectors[2];
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash,
+		FLASH_SECTOR_SIZE_FAILED, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_init (&logging, &state, &flash.base, 0x10000, sectors, 2);
+	CuAssertIntEquals (test, FLASH_SECTOR_SIZE_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void logging_flash_compressed_test_init_read_error (CuTest *test)
+{
+	struct flash_mock flash;
+	struct logging_flash_compressed_state state;
+	struct logging_flash_compressed logging;
+	struct logging_flash_compressed_sector sectors[2];
+	uint32_t bytes = 0x1000;
+	int status;
+
+	TEST_START;
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (struct logging_flash_compressed_header)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_init (&logging, &state, &flash.base, 0x10000, sectors, 2);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void logging_flash_compressed_test_init_existing_entries (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+	logging_flash_compressed_testing_add_entries (test, &log, 0, 10);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_reinit (test, &log);
+	logging_flash_compressed_testing_check_entries (test, &log, 0, 10);
+
+	/* New entries continue from the existing entries. */
+	logging_flash_compressed_testing_add_entries (test, &log, 10, 5);
+	logging_flash_compressed_testing_check_entries (test, &log, 0, 15);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_reinit (test, &log);
+	logging_flash_compressed_testing_check_entries (test, &log, 0, 15);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_init_existing_entries_wrapped (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct logging_flash_compressed_stats expected;
+	struct logging_flash_compressed_stats stats;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+	logging_flash_compressed_testing_add_entries (test, &log, 0, 500);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_get_stats (&log.test, &expected);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_reinit (test, &log);
+
+	status = logging_flash_compressed_get_stats (&log.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, expected.entries, stats.entries);
+	CuAssertIntEquals (test, expected.log_length, stats.log_length);
+	CuAssertIntEquals (test, expected.stored_length, stats.stored_length);
+	CuAssertIntEquals (test, expected.min_erase_count, stats.min_erase_count);
+	CuAssertIntEquals (test, expected.max_erase_count, stats.max_erase_count);
+	CuAssertIntEquals (test, expected.total_erase_count, stats.total_erase_count);
+
+	logging_flash_compressed_testing_check_entries (test, &log, 500 - stats.entries,
+		stats.entries);
+
+	logging_flash_compressed_testing_add_entries (test, &log, 500, 1);
+	logging_flash_compressed_testing_check_entries (test, &log, 501 - stats.entries - 1,
+		stats.entries + 1);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_init_corrupt_entry (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	uint32_t used;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+	logging_flash_compressed_testing_add_entries (test, &log, 0, 3);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Add an entry with reserved bits set. */
+	used = log.sectors[0].used;
+	log.flash_data[LOGGING_FLASH_COMPRESSED_TESTING_BASE + used] = 0x41;
+
+	logging_flash_compressed_testing_reinit (test, &log);
+	logging_flash_compressed_testing_check_entries (test, &log, 0, 3);
+
+	CuAssertIntEquals (test, used, log.sectors[0].used);
+
+	/* New entries must not be added after the invalid data. */
+	logging_flash_compressed_testing_add_entries (test, &log, 3, 2);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 1, log.state.current);
+	CuAssertIntEquals (test, 2, log.sectors[1].entries);
+
+	logging_flash_compressed_testing_reinit (test, &log);
+	logging_flash_compressed_testing_check_entries (test, &log, 0, 5);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_static_init (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct logging_flash_compressed test_static =
+		logging_flash_compressed_static_init (&log.state, &log.flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log.sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	int status;
+
+	TEST_START;
+
+	CuAssertPtrNotNull (test, test_static.base.create_entry);
+#ifndef LOGGING_DISABLE_FLUSH
+	CuAssertPtrNotNull (test, test_static.base.flush);
+#endif
+	CuAssertPtrNotNull (test, test_static.base.clear);
+	CuAssertPtrNotNull (test, test_static.base.get_size);
+	CuAssertPtrNotNull (test, test_static.base.read_contents);
+
+	logging_flash_compressed_testing_init_dependencies (test, &log);
+
+	status = logging_flash_compressed_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	memcpy (&log.test, &test_static, sizeof (test_static));
+
+	logging_flash_compressed_testing_add_entries (test, &log, 0, 2);
+	logging_flash_compressed_testing_check_entries (test, &log, 0, 2);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_static_init_null (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct logging_flash_compressed test_static =
+		logging_flash_compressed_static_init (&log.state, &log.flash.base,
+		LOGGING_FLASH_COMPRESSED_TESTING_BASE, log.sectors,
+		LOGGING_FLASH_COMPRESSED_TESTING_SECTORS);
+	int status;
+
+	TEST_START;
+
+	status = logging_flash_compressed_init_state (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	test_static.state = NULL;
+	status = logging_flash_compressed_init_state (&test_static);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	test_static.state = &log.state;
+	test_static.flash = NULL;
+	status = logging_flash_compressed_init_state (&test_static);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	test_static.flash = &log.flash.base;
+	test_static.sectors = NULL;
+	status = logging_flash_compressed_init_state (&test_static);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+}
+
+static void logging_flash_compressed_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	logging_flash_compressed_release (NULL);
+}
+
+static void logging_flash_compressed_test_create_entry (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct logging_flash_compressed_stats stats;
+	struct logging_flash_compressed_header *header;
+	struct debug_log_entry_info entry;
+	struct debug_log_entry expected;
+	uint8_t contents[sizeof (expected) * 2];
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	logging_flash_compressed_testing_debug_entry (&entry, 4, 0x12345678, 0, 0x123456789);
+	entry.severity = DEBUG_LOG_SEVERITY_ERROR;
+
+	status = log.test.base.create_entry (&log.test.base, (uint8_t*) &entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.get_size (&log.test.base);
+	CuAssertIntEquals (test, sizeof (expected), status);
+
+	status = log.test.base.read_contents (&log.test.base, 0, contents, sizeof (contents));
+	CuAssertIntEquals (test, sizeof (expected), status);
+
+	expected.header.log_magic = LOGGING_MAGIC_START;
+	expected.header.length = sizeof (expected);
+	expected.header.entry_id = 0;
+	memcpy (&expected.entry, &entry, sizeof (entry));
+
+	status = testing_validate_array ((uint8_t*) &expected, contents, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Nothing is written to flash until the log is flushed. */
+	CuAssertIntEquals (test, 0xff, log.flash_data[LOGGING_FLASH_COMPRESSED_TESTING_BASE]);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	header = (struct logging_flash_compressed_header*)
+		&log.flash_data[LOGGING_FLASH_COMPRESSED_TESTING_BASE];
+	CuAssertIntEquals (test, 1, header->sequence);
+	CuAssertIntEquals (test, 1, header->erase_count);
+	CuAssertIntEquals (test, 0, header->first_entry_id);
+	CuAssertTrue (test, (header->base_time == 0));
+
+	status = logging_flash_compressed_get_stats (&log.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.entries);
+	CuAssertIntEquals (test, sizeof (expected), stats.log_length);
+	CuAssertTrue (test, (stats.stored_length < (sizeof (*header) + sizeof (expected))));
+	CuAssertIntEquals (test, 0, stats.min_erase_count);
+	CuAssertIntEquals (test, 1, stats.max_erase_count);
+	CuAssertIntEquals (test, 1, stats.total_erase_count);
+
+	memset (contents, 0, sizeof (contents));
+	status = log.test.base.read_contents (&log.test.base, 0, contents, sizeof (contents));
+	CuAssertIntEquals (test, sizeof (expected), status);
+
+	status = testing_validate_array ((uint8_t*) &expected, contents, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_create_entry_time_reset (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct debug_log_entry_info entry[3];
+	struct debug_log_entry *actual;
+	uint8_t contents[sizeof (struct debug_log_entry) * 3];
+	int i;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	logging_flash_compressed_testing_debug_entry (&entry[0], 1, 0, 0xffffffff, 500000);
+	logging_flash_compressed_testing_debug_entry (&entry[1], 2, 1, 2, 10);
+	logging_flash_compressed_testing_debug_entry (&entry[2], 3, 0, 0, 0xffffffffffffffffULL);
+
+	for (i = 0; i < 3; i++) {
+		status = log.test.base.create_entry (&log.test.base, (uint8_t*) &entry[i],
+			sizeof (entry[i]));
+		CuAssertIntEquals (test, 0, status);
+
+		if (i == 1) {
+			status = log.test.base.flush (&log.test.base);
+			CuAssertIntEquals (test, 0, status);
+		}
+	}
+
+	logging_flash_compressed_testing_reinit (test, &log);
+
+	status = log.test.base.read_contents (&log.test.base, 0, contents, sizeof (contents));
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry) * 2, status);
+
+	for (i = 0; i < 2; i++) {
+		actual = (struct debug_log_entry*) &contents[sizeof (struct debug_log_entry) * i];
+		CuAssertIntEquals (test, i, actual->header.entry_id);
+
+		status = testing_validate_array ((uint8_t*) &entry[i], (uint8_t*) &actual->entry,
+			sizeof (entry[i]));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_create_entry_raw (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	uint8_t entry1[LOGGING_FLASH_COMPRESSED_MAX_ENTRY_LEN];
+	uint8_t entry2[] = {0x01, 0x02, 0x03, 0x04};
+	struct debug_log_entry_info entry3;
+	uint8_t contents[sizeof (entry1) + sizeof (entry2) + (sizeof (struct logging_entry_header) * 2)];
+	struct logging_entry_header *header;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	for (i = 0; i < sizeof (entry1); i++) {
+		entry1[i] = i;
+	}
+
+	/* A debug entry with an unknown format is stored without compression. */
+	logging_flash_compressed_testing_debug_entry (&entry3, 1, 2, 3, 4);
+	entry3.format = DEBUG_LOG_ENTRY_FORMAT + 1;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.create_entry (&log.test.base, (uint8_t*) &entry3, sizeof (entry3));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_reinit (test, &log);
+
+	status = log.test.base.get_size (&log.test.base);
+	CuAssertIntEquals (test, sizeof (contents) + sizeof (struct debug_log_entry), status);
+
+	status = log.test.base.read_contents (&log.test.base, 0, contents, sizeof (contents));
+	CuAssertIntEquals (test, sizeof (contents), status);
+
+	header = (struct logging_entry_header*) contents;
+	CuAssertIntEquals (test, LOGGING_MAGIC_START, header->log_magic);
+	CuAssertIntEquals (test, sizeof (*header) + sizeof (entry1), header->length);
+	CuAssertIntEquals (test, 0, header->entry_id);
+
+	status = testing_validate_array (entry1, &contents[sizeof (*header)], sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	header = (struct logging_entry_header*) &contents[sizeof (*header) + sizeof (entry1)];
+	CuAssertIntEquals (test, LOGGING_MAGIC_START, header->log_magic);
+	CuAssertIntEquals (test, sizeof (*header) + sizeof (entry2), header->length);
+	CuAssertIntEquals (test, 1, header->entry_id);
+
+	status = testing_validate_array (entry2, (uint8_t*) &header[1], sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.read_contents (&log.test.base, sizeof (contents), contents,
+		sizeof (contents));
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry), status);
+
+	header = (struct logging_entry_header*) contents;
+	CuAssertIntEquals (test, 2, header->entry_id);
+
+	status = testing_validate_array ((uint8_t*) &entry3, (uint8_t*) &header[1], sizeof (entry3));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_create_entry_multiple_sectors (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+	logging_flash_compressed_testing_add_entries (test, &log, 0, 60);
+	logging_flash_compressed_testing_check_entries (test, &log, 0, 60);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 2, log.state.sequence);
+	CuAssertIntEquals (test, 1, log.state.current);
+
+	logging_flash_compressed_testing_check_entries (test, &log, 0, 60);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_create_entry_wrap_sectors (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct logging_flash_compressed_stats stats;
+	uint32_t first;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+	logging_flash_compressed_testing_add_entries (test, &log, 0, 1000);
+
+	status = logging_flash_compressed_get_stats (&log.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Erases are spread evenly across all sectors. */
+	CuAssertTrue (test, (stats.max_erase_count - stats.min_erase_count) <= 1);
+	CuAssertIntEquals (test, log.state.sequence, stats.total_erase_count);
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry) * stats.entries, stats.log_length);
+	CuAssertTrue (test, (stats.stored_length < (stats.log_length / 2)));
+
+	first = 1000 - stats.entries;
+	CuAssertTrue (test, (first != 0));
+
+	logging_flash_compressed_testing_check_entries (test, &log, first, stats.entries);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_create_entry_null (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	uint8_t entry[4] = {0};
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = log.test.base.create_entry (NULL, entry, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log.test.base.create_entry (&log.test.base, NULL, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log.test.base.get_size (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_create_entry_bad_length (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	uint8_t entry[LOGGING_FLASH_COMPRESSED_MAX_ENTRY_LEN + 1] = {0};
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry, 0);
+	CuAssertIntEquals (test, LOGGING_BAD_ENTRY_LENGTH, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_BAD_ENTRY_LENGTH, status);
+
+	status = log.test.base.get_size (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_flush_empty (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < sizeof (log.flash_data); i++) {
+		CuAssertIntEquals (test, 0xff, log.flash_data[i]);
+	}
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_flush_null (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = log.test.base.flush (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_flush_erase_error (CuTest *test)
+{
+	struct flash_mock flash;
+	struct logging_flash_compressed_state state;
+	struct logging_flash_compressed logging;
+	struct logging_flash_compressed_sector sectors[2];
+	struct debug_log_entry_info entry;
+	uint8_t blank[sizeof (struct logging_flash_compressed_header)];
+	uint32_t bytes = 0x1000;
+	int status;
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_init (&logging, &state, &flash.base, 0x10000, sectors, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_debug_entry (&entry, 1, 2, 3, 4);
+
+	status = logging.base.create_entry (&logging.base, (uint8_t*) &entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.sector_erase, &flash, FLASH_SECTOR_ERASE_FAILED,
+		MOCK_ARG (0x10000));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, FLASH_SECTOR_ERASE_FAILED, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry), status);
+
+	CuAssertIntEquals (test, 0, sectors[0].erase_count);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_release (&logging);
+}
+
+static void logging_flash_compressed_test_flush_write_error (CuTest *test)
+{
+	struct flash_mock flash;
+	struct logging_flash_compressed_state state;
+	struct logging_flash_compressed logging;
+	struct logging_flash_compressed_sector sectors[2];
+	struct debug_log_entry_info entry;
+	uint8_t blank[sizeof (struct logging_flash_compressed_header)];
+	uint32_t bytes = 0x1000;
+	size_t record_len;
+	int status;
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_init (&logging, &state, &flash.base, 0x10000, sectors, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_debug_entry (&entry, 1, 2, 3, 4);
+
+	status = logging.base.create_entry (&logging.base, (uint8_t*) &entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	record_len = state.buffered;
+
+	status = mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (blank),
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, record_len - 1,
+		MOCK_ARG (0x10000 + sizeof (blank)), MOCK_ARG_NOT_NULL, MOCK_ARG (record_len));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, LOGGING_INCOMPLETE_FLUSH, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry), status);
+
+	/* The buffered entries are written to the next sector. */
+	status = mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x11000));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (blank),
+		MOCK_ARG (0x11000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, record_len,
+		MOCK_ARG (0x11000 + sizeof (blank)), MOCK_ARG_NOT_NULL, MOCK_ARG (record_len));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.get_size (&logging.base);
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry), status);
+
+	CuAssertIntEquals (test, 1, state.current);
+	CuAssertIntEquals (test, 1, sectors[1].entries);
+	CuAssertIntEquals (test, 0, sectors[0].entries);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_release (&logging);
+}
+
+static void logging_flash_compressed_test_clear (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct logging_flash_compressed_stats stats;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+	logging_flash_compressed_testing_add_entries (test, &log, 0, 50);
+
+	status = log.test.base.clear (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.get_size (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_get_stats (&log.test, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.entries);
+	CuAssertIntEquals (test, 0, stats.stored_length);
+	CuAssertIntEquals (test, 2, stats.total_erase_count);
+
+	/* New entries continue in the next sector. */
+	logging_flash_compressed_testing_add_entries (test, &log, 50, 2);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 1, log.state.current);
+
+	logging_flash_compressed_testing_reinit (test, &log);
+	logging_flash_compressed_testing_check_entries (test, &log, 50, 2);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_clear_null (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = log.test.base.clear (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_get_size_null (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = log.test.base.get_size (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_read_contents_offset (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	uint8_t expected[sizeof (struct debug_log_entry) * 60];
+	uint8_t contents[sizeof (expected)];
+	size_t offset;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+	logging_flash_compressed_testing_add_entries (test, &log, 0, 60);
+
+	status = log.test.base.read_contents (&log.test.base, 0, expected, sizeof (expected));
+	CuAssertIntEquals (test, sizeof (expected), status);
+
+	/* Read the log in small pieces that split entries and sectors. */
+	for (offset = 0; offset < sizeof (expected); offset += 13) {
+		status = log.test.base.read_contents (&log.test.base, offset, &contents[offset], 13);
+		CuAssertIntEquals (test, ((sizeof (expected) - offset) < 13) ?
+			(int) (sizeof (expected) - offset) : 13, status);
+	}
+
+	status = testing_validate_array (expected, contents, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.read_contents (&log.test.base, sizeof (expected), contents,
+		sizeof (contents));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_read_contents_read_error (CuTest *test)
+{
+	struct flash_mock flash;
+	struct logging_flash_compressed_state state;
+	struct logging_flash_compressed logging;
+	struct logging_flash_compressed_sector sectors[2];
+	struct debug_log_entry_info entry;
+	uint8_t blank[sizeof (struct logging_flash_compressed_header)];
+	uint8_t contents[sizeof (struct debug_log_entry)];
+	uint32_t bytes = 0x1000;
+	int status;
+
+	TEST_START;
+
+	memset (blank, 0xff, sizeof (blank));
+
+	status = flash_mock_init (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.get_sector_size, &flash, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&flash.mock, 0, &bytes, sizeof (bytes), -1);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x10000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, 0, MOCK_ARG (0x11000),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect_output (&flash.mock, 1, blank, sizeof (blank), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_compressed_init (&logging, &state, &flash.base, 0x10000, sectors, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_testing_debug_entry (&entry, 1, 2, 3, 4);
+
+	status = logging.base.create_entry (&logging.base, (uint8_t*) &entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&flash.mock, flash.base.sector_erase, &flash, 0, MOCK_ARG (0x10000));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, sizeof (blank),
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+	status |= mock_expect (&flash.mock, flash.base.write, &flash, state.buffered,
+		MOCK_ARG (0x10000 + sizeof (blank)), MOCK_ARG_NOT_NULL, MOCK_ARG (state.buffered));
+
+	status |= mock_expect (&flash.mock, flash.base.read, &flash, FLASH_READ_FAILED,
+		MOCK_ARG (0x10000), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (blank)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.flush (&logging.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging.base.read_contents (&logging.base, 0, contents, sizeof (contents));
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+
+	status = flash_mock_validate_and_release (&flash);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_release (&logging);
+}
+
+static void logging_flash_compressed_test_read_contents_null (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	uint8_t contents[8];
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = log.test.base.read_contents (NULL, 0, contents, sizeof (contents));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log.test.base.read_contents (&log.test.base, 0, NULL, sizeof (contents));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+static void logging_flash_compressed_test_get_stats_null (CuTest *test)
+{
+	struct logging_flash_compressed_testing log;
+	struct logging_flash_compressed_stats stats;
+	int status;
+
+	TEST_START;
+
+	logging_flash_compressed_testing_init (test, &log);
+
+	status = logging_flash_compressed_get_stats (NULL, &stats);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_flash_compressed_get_stats (&log.test, NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_flash_compressed_testing_release (test, &log);
+}
+
+
+TEST_SUITE_START (logging_flash_compressed);
+
+TEST (logging_flash_compressed_test_init);
+TEST (logging_flash_compressed_test_init_null);
+TEST (logging_flash_compressed_test_init_one_sector);
+TEST (logging_flash_compressed_test_init_not_aligned);
+TEST (logging_flash_compressed_test_init_small_sector);
+TEST (logging_flash_compressed_test_init_sector_size_error);
+TEST (logging_flash_compressed_test_init_read_error);
+TEST (logging_flash_compressed_test_init_existing_entries);
+TEST (logging_flash_compressed_test_init_existing_entries_wrapped);
+TEST (logging_flash_compressed_test_init_corrupt_entry);
+TEST (logging_flash_compressed_test_static_init);
+TEST (logging_flash_compressed_test_static_init_null);
+TEST (logging_flash_compressed_test_release_null);
+TEST (logging_flash_compressed_test_create_entry);
+TEST (logging_flash_compressed_test_create_entry_time_reset);
+TEST (logging_flash_compressed_test_create_entry_raw);
+TEST (logging_flash_compressed_test_create_entry_multiple_sectors);
+TEST (logging_flash_compressed_test_create_entry_wrap_sectors);
+TEST (logging_flash_compressed_test_create_entry_null);
+TEST (logging_flash_compressed_test_create_entry_bad_length);
+TEST (logging_flash_compressed_test_flush_empty);
+TEST (logging_flash_compressed_test_flush_null);
+TEST (logging_flash_compressed_test_flush_erase_error);
+TEST (logging_flash_compressed_test_flush_write_error);
+TEST (logging_flash_compressed_test_clear);
+TEST (logging_flash_compressed_test_clear_null);
+TEST (logging_flash_compressed_test_get_size_null);
+TEST (logging_flash_compressed_test_read_contents_offset);
+TEST (logging_flash_compressed_test_read_contents_read_error);
+TEST (logging_flash_compressed_test_read_contents_null);
+TEST (logging_flash_compressed_test_get_stats_null);
+
+TEST_SUITE_END;
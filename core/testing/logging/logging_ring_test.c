@@ -0,0 +1,1041 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "logging/log_flush_handler.h"
+#include "logging/logging_ring.h"
+#include "logging/logging_ring_static.h"
+#include "testing/mock/logging/logging_mock.h"
+
+
+TEST_SUITE_LABEL ("logging_ring");
+
+
+/**
+ * Maximum entry length used for testing.
+ */
+#define	LOGGING_RING_TESTING_ENTRY_LEN		10
+
+/**
+ * Number of entries in the test ring.
+ */
+#define	LOGGING_RING_TESTING_ENTRY_COUNT	4
+
+
+/**
+ * Dependencies for testing.
+ */
+struct logging_ring_testing {
+	struct logging_mock target;			/**< Mock for the target log. */
+	struct logging_ring_state state;	/**< Context for the log being tested. */
+	struct logging_ring test;			/**< Log being tested. */
+
+	/**
+	 * Memory for the ring.
+	 */
+	uint32_t ring[LOGGING_RING_BUFFER_LEN (LOGGING_RING_TESTING_ENTRY_COUNT,
+		LOGGING_RING_TESTING_ENTRY_LEN) / sizeof (uint32_t)];
+};
+
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param test The testing framework.
+ * @param log The testing components to initialize.
+ */
+static void logging_ring_testing_init_dependencies (CuTest *test, struct logging_ring_testing *log)
+{
+	int status;
+
+	status = logging_mock_init (&log->target);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize a log for testing.
+ *
+ * @param test The testing framework.
+ * @param log The testing components to initialize.
+ */
+static void logging_ring_testing_init (CuTest *test, struct logging_ring_testing *log)
+{
+	int status;
+
+	logging_ring_testing_init_dependencies (test, log);
+
+	status = logging_ring_init (&log->test, &log->state, &log->target.base, (uint8_t*) log->ring,
+		sizeof (log->ring), LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release test components and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param log The testing components to release.
+ */
+static void logging_ring_testing_release (CuTest *test, struct logging_ring_testing *log)
+{
+	int status;
+
+	status = logging_mock_validate_and_release (&log->target);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_release (&log->test);
+}
+
+/**
+ * Set up expectations for an entry to be added to the target log.
+ *
+ * @param test The testing framework.
+ * @param log The testing components.
+ * @param entry The entry data expected in the target log.
+ * @param length Length of the entry.
+ * @param result Result of the call to the target log.
+ */
+static void logging_ring_testing_expect_entry (CuTest *test, struct logging_ring_testing *log,
+	const uint8_t *entry, size_t length, int result)
+{
+	int status;
+
+	status = mock_expect (&log->target.mock, log->target.base.create_entry, &log->target, result,
+		MOCK_ARG_PTR_CONTAINS_TMP (entry, length), MOCK_ARG (length));
+	CuAssertIntEquals (test, 0, status);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void logging_ring_test_init (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init_dependencies (test, &log);
+
+	status = logging_ring_init (&log.test, &log.state, &log.target.base, (uint8_t*) log.ring,
+		sizeof (log.ring), LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, log.test.base.create_entry);
+#ifndef LOGGING_DISABLE_FLUSH
+	CuAssertPtrNotNull (test, log.test.base.flush);
+#endif
+	CuAssertPtrNotNull (test, log.test.base.clear);
+	CuAssertPtrNotNull (test, log.test.base.get_size);
+	CuAssertPtrNotNull (test, log.test.base.read_contents);
+
+	CuAssertIntEquals (test, LOGGING_RING_TESTING_ENTRY_COUNT, log.test.entry_count);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_init_not_power_of_2 (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init_dependencies (test, &log);
+
+	status = logging_ring_init (&log.test, &log.state, &log.target.base, (uint8_t*) log.ring,
+		sizeof (log.ring) - 1, LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, LOGGING_RING_TESTING_ENTRY_COUNT / 2, log.test.entry_count);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_init_null (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init_dependencies (test, &log);
+
+	status = logging_ring_init (NULL, &log.state, &log.target.base, (uint8_t*) log.ring,
+		sizeof (log.ring), LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_ring_init (&log.test, NULL, &log.target.base, (uint8_t*) log.ring,
+		sizeof (log.ring), LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_ring_init (&log.test, &log.state, NULL, (uint8_t*) log.ring,
+		sizeof (log.ring), LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_ring_init (&log.test, &log.state, &log.target.base, NULL,
+		sizeof (log.ring), LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_ring_init (&log.test, &log.state, &log.target.base, (uint8_t*) log.ring,
+		sizeof (log.ring), 0);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_mock_validate_and_release (&log.target);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void logging_ring_test_init_not_aligned (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init_dependencies (test, &log);
+
+	status = logging_ring_init (&log.test, &log.state, &log.target.base,
+		((uint8_t*) log.ring) + 1, sizeof (log.ring) - 1, LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, LOGGING_STORAGE_NOT_ALIGNED, status);
+
+	status = logging_mock_validate_and_release (&log.target);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void logging_ring_test_init_insufficient_storage (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init_dependencies (test, &log);
+
+	status = logging_ring_init (&log.test, &log.state, &log.target.base, (uint8_t*) log.ring,
+		LOGGING_RING_SLOT_SIZE (LOGGING_RING_TESTING_ENTRY_LEN) - 1,
+		LOGGING_RING_TESTING_ENTRY_LEN);
+	CuAssertIntEquals (test, LOGGING_INSUFFICIENT_STORAGE, status);
+
+	status = logging_mock_validate_and_release (&log.target);
+	CuAssertIntEquals (test, 0, status);
+}
+
+static void logging_ring_test_static_init (CuTest *test)
+{
+	struct logging_ring_testing log;
+	struct logging_ring test_static = logging_ring_static_init (&log.state, &log.target.base,
+		(uint8_t*) log.ring, LOGGING_RING_TESTING_ENTRY_COUNT, LOGGING_RING_TESTING_ENTRY_LEN);
+	uint8_t entry[] = {0x01, 0x02, 0x03};
+	int status;
+
+	TEST_START;
+
+	CuAssertPtrNotNull (test, test_static.base.create_entry);
+#ifndef LOGGING_DISABLE_FLUSH
+	CuAssertPtrNotNull (test, test_static.base.flush);
+#endif
+	CuAssertPtrNotNull (test, test_static.base.clear);
+	CuAssertPtrNotNull (test, test_static.base.get_size);
+	CuAssertPtrNotNull (test, test_static.base.read_contents);
+
+	logging_ring_testing_init_dependencies (test, &log);
+
+	status = logging_ring_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	status = test_static.base.create_entry (&test_static.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_expect_entry (test, &log, entry, sizeof (entry), 0);
+
+	status = logging_ring_drain (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_mock_validate_and_release (&log.target);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_release (&test_static);
+}
+
+static void logging_ring_test_static_init_null (CuTest *test)
+{
+	struct logging_ring_testing log;
+	struct logging_ring null_state = logging_ring_static_init (NULL, &log.target.base,
+		(uint8_t*) log.ring, LOGGING_RING_TESTING_ENTRY_COUNT, LOGGING_RING_TESTING_ENTRY_LEN);
+	struct logging_ring null_target = logging_ring_static_init (&log.state, NULL,
+		(uint8_t*) log.ring, LOGGING_RING_TESTING_ENTRY_COUNT, LOGGING_RING_TESTING_ENTRY_LEN);
+	struct logging_ring null_ring = logging_ring_static_init (&log.state, &log.target.base,
+		NULL, LOGGING_RING_TESTING_ENTRY_COUNT, LOGGING_RING_TESTING_ENTRY_LEN);
+	struct logging_ring zero_len = logging_ring_static_init (&log.state, &log.target.base,
+		(uint8_t*) log.ring, LOGGING_RING_TESTING_ENTRY_COUNT, 0);
+	int status;
+
+	TEST_START;
+
+	status = logging_ring_init_state (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_ring_init_state (&null_state);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_ring_init_state (&null_target);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_ring_init_state (&null_ring);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = logging_ring_init_state (&zero_len);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+}
+
+static void logging_ring_test_static_init_not_power_of_2 (CuTest *test)
+{
+	struct logging_ring_testing log;
+	struct logging_ring test_static = logging_ring_static_init (&log.state, &log.target.base,
+		(uint8_t*) log.ring, LOGGING_RING_TESTING_ENTRY_COUNT - 1, LOGGING_RING_TESTING_ENTRY_LEN);
+	struct logging_ring no_entries = logging_ring_static_init (&log.state, &log.target.base,
+		(uint8_t*) log.ring, 0, LOGGING_RING_TESTING_ENTRY_LEN);
+	int status;
+
+	TEST_START;
+
+	status = logging_ring_init_state (&test_static);
+	CuAssertIntEquals (test, LOGGING_INSUFFICIENT_STORAGE, status);
+
+	status = logging_ring_init_state (&no_entries);
+	CuAssertIntEquals (test, LOGGING_INSUFFICIENT_STORAGE, status);
+}
+
+static void logging_ring_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	logging_ring_release (NULL);
+}
+
+static void logging_ring_test_create_entry (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry1[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	/* Entries are not added to the target log until the ring is drained. */
+	status = log.test.base.create_entry (&log.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&log.target.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_expect_entry (test, &log, entry1, sizeof (entry1), 0);
+	logging_ring_testing_expect_entry (test, &log, entry2, sizeof (entry2), 0);
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_create_entry_wrap_ring (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[LOGGING_RING_TESTING_ENTRY_LEN];
+	int status;
+	int i;
+	int j;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < LOGGING_RING_TESTING_ENTRY_COUNT - 1; j++) {
+			memset (entry, (i * LOGGING_RING_TESTING_ENTRY_COUNT) + j, sizeof (entry));
+
+			status = log.test.base.create_entry (&log.test.base, entry, sizeof (entry));
+			CuAssertIntEquals (test, 0, status);
+
+			logging_ring_testing_expect_entry (test, &log, entry, sizeof (entry), 0);
+		}
+
+		status = logging_ring_drain (&log.test);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_create_entry_position_overflow (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[LOGGING_RING_TESTING_ENTRY_COUNT * 2][LOGGING_RING_TESTING_ENTRY_LEN];
+	struct logging_ring_slot *slot;
+	uint32_t pos = 0xfffffffe;
+	int status;
+	int i;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	/* Move the ring to just before the 32-bit ring position wraps to 0. */
+	log.state.enqueue_pos = pos;
+	log.state.dequeue_pos = pos;
+	for (i = 0; i < LOGGING_RING_TESTING_ENTRY_COUNT; i++) {
+		slot = (struct logging_ring_slot*) &((uint8_t*) log.ring)[((pos + i) &
+			(LOGGING_RING_TESTING_ENTRY_COUNT - 1)) *
+			LOGGING_RING_SLOT_SIZE (LOGGING_RING_TESTING_ENTRY_LEN)];
+		slot->sequence = pos + i;
+	}
+
+	for (i = 0; i < LOGGING_RING_TESTING_ENTRY_COUNT; i++) {
+		memset (entry[i], i, sizeof (entry[i]));
+
+		status = log.test.base.create_entry (&log.test.base, entry[i], sizeof (entry[i]));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* Fill the ring again, which requires the entries that cross the wrap to be drained. */
+	for (i = 0; i < LOGGING_RING_TESTING_ENTRY_COUNT; i++) {
+		logging_ring_testing_expect_entry (test, &log, entry[i], sizeof (entry[i]), 0);
+	}
+
+	for (; i < LOGGING_RING_TESTING_ENTRY_COUNT * 2; i++) {
+		memset (entry[i], i, sizeof (entry[i]));
+
+		status = log.test.base.create_entry (&log.test.base, entry[i], sizeof (entry[i]));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = mock_validate (&log.target.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = LOGGING_RING_TESTING_ENTRY_COUNT; i < LOGGING_RING_TESTING_ENTRY_COUNT * 2; i++) {
+		logging_ring_testing_expect_entry (test, &log, entry[i], sizeof (entry[i]), 0);
+	}
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, pos + (LOGGING_RING_TESTING_ENTRY_COUNT * 2), log.state.dequeue_pos);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_create_entry_full (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[LOGGING_RING_TESTING_ENTRY_COUNT + 1][LOGGING_RING_TESTING_ENTRY_LEN];
+	int status;
+	int i;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	for (i = 0; i < LOGGING_RING_TESTING_ENTRY_COUNT; i++) {
+		memset (entry[i], i, sizeof (entry[i]));
+
+		status = log.test.base.create_entry (&log.test.base, entry[i], sizeof (entry[i]));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* The ring is full, so all buffered entries will be moved to the target log before adding the
+	 * new entry. */
+	for (i = 0; i < LOGGING_RING_TESTING_ENTRY_COUNT; i++) {
+		logging_ring_testing_expect_entry (test, &log, entry[i], sizeof (entry[i]), 0);
+	}
+
+	memset (entry[i], i, sizeof (entry[i]));
+	status = log.test.base.create_entry (&log.test.base, entry[i], sizeof (entry[i]));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&log.target.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_expect_entry (test, &log, entry[i], sizeof (entry[i]), 0);
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_create_entry_full_entry_in_progress (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[LOGGING_RING_TESTING_ENTRY_COUNT + 1][LOGGING_RING_TESTING_ENTRY_LEN];
+	struct logging_ring_slot *slot;
+	int status;
+	int i;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	for (i = 0; i < LOGGING_RING_TESTING_ENTRY_COUNT + 1; i++) {
+		memset (entry[i], i, sizeof (entry[i]));
+	}
+
+	status = log.test.base.create_entry (&log.test.base, entry[0], sizeof (entry[0]));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Simulate an entry that has been reserved but not yet committed. */
+	slot = (struct logging_ring_slot*) &((uint8_t*) log.ring)[LOGGING_RING_SLOT_SIZE (
+		LOGGING_RING_TESTING_ENTRY_LEN)];
+	log.state.enqueue_pos++;
+
+	for (i = 2; i < LOGGING_RING_TESTING_ENTRY_COUNT; i++) {
+		status = log.test.base.create_entry (&log.test.base, entry[i], sizeof (entry[i]));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* The ring is full.  Only the entry before the uncommitted entry can be moved to the target
+	 * log, but that is enough to make space for the new entry. */
+	logging_ring_testing_expect_entry (test, &log, entry[0], sizeof (entry[0]), 0);
+
+	status = log.test.base.create_entry (&log.test.base, entry[i], sizeof (entry[i]));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&log.target.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Commit the reserved entry.  All entries are moved to the target log in order. */
+	slot->length = sizeof (entry[1]);
+	memcpy (&slot[1], entry[1], sizeof (entry[1]));
+	slot->sequence = 2;
+
+	for (i = 1; i < LOGGING_RING_TESTING_ENTRY_COUNT + 1; i++) {
+		logging_ring_testing_expect_entry (test, &log, entry[i], sizeof (entry[i]), 0);
+	}
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_create_entry_full_target_error (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[LOGGING_RING_TESTING_ENTRY_COUNT + 1][LOGGING_RING_TESTING_ENTRY_LEN];
+	int status;
+	int i;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	for (i = 0; i < LOGGING_RING_TESTING_ENTRY_COUNT; i++) {
+		memset (entry[i], i, sizeof (entry[i]));
+
+		status = log.test.base.create_entry (&log.test.base, entry[i], sizeof (entry[i]));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* A failure in the target log does not prevent the new entry from being buffered. */
+	logging_ring_testing_expect_entry (test, &log, entry[0], sizeof (entry[0]),
+		LOGGING_CREATE_ENTRY_FAILED);
+	for (i = 1; i < LOGGING_RING_TESTING_ENTRY_COUNT; i++) {
+		logging_ring_testing_expect_entry (test, &log, entry[i], sizeof (entry[i]), 0);
+	}
+
+	memset (entry[i], i, sizeof (entry[i]));
+	status = log.test.base.create_entry (&log.test.base, entry[i], sizeof (entry[i]));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&log.target.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_expect_entry (test, &log, entry[i], sizeof (entry[i]), 0);
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_create_entry_null (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[LOGGING_RING_TESTING_ENTRY_LEN];
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (NULL, entry, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log.test.base.create_entry (&log.test.base, NULL, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_create_entry_bad_length (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[LOGGING_RING_TESTING_ENTRY_LEN + 1];
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry, 0);
+	CuAssertIntEquals (test, LOGGING_BAD_ENTRY_LENGTH, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, LOGGING_BAD_ENTRY_LENGTH, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_drain_empty (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_drain_entry_in_progress (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry1[] = {0x01, 0x02, 0x03};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	uint8_t entry3[] = {0x21, 0x22, 0x23};
+	struct logging_ring_slot *slot;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Simulate an entry that has been reserved but not yet committed. */
+	slot = (struct logging_ring_slot*) &((uint8_t*) log.ring)[LOGGING_RING_SLOT_SIZE (
+		LOGGING_RING_TESTING_ENTRY_LEN)];
+	log.state.enqueue_pos++;
+
+	status = log.test.base.create_entry (&log.test.base, entry3, sizeof (entry3));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Only entries before the uncommitted entry are moved to the target log. */
+	logging_ring_testing_expect_entry (test, &log, entry1, sizeof (entry1), 0);
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&log.target.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Commit the reserved entry. */
+	slot->length = sizeof (entry2);
+	memcpy (&slot[1], entry2, sizeof (entry2));
+	slot->sequence = 2;
+
+	logging_ring_testing_expect_entry (test, &log, entry2, sizeof (entry2), 0);
+	logging_ring_testing_expect_entry (test, &log, entry3, sizeof (entry3), 0);
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_drain_target_error (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry1[] = {0x01, 0x02, 0x03};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_expect_entry (test, &log, entry1, sizeof (entry1),
+		LOGGING_CREATE_ENTRY_FAILED);
+	logging_ring_testing_expect_entry (test, &log, entry2, sizeof (entry2), 0);
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, LOGGING_CREATE_ENTRY_FAILED, status);
+
+	status = mock_validate (&log.target.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The failed entry is discarded. */
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_drain_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = logging_ring_drain (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+}
+
+#ifndef LOGGING_DISABLE_FLUSH
+static void logging_ring_test_flush (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry1[] = {0x01, 0x02, 0x03};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_expect_entry (test, &log, entry1, sizeof (entry1), 0);
+	logging_ring_testing_expect_entry (test, &log, entry2, sizeof (entry2), 0);
+
+	status = mock_expect (&log.target.mock, log.target.base.flush, &log.target, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_flush_target_create_error (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[] = {0x01, 0x02, 0x03};
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_expect_entry (test, &log, entry, sizeof (entry),
+		LOGGING_CREATE_ENTRY_FAILED);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, LOGGING_CREATE_ENTRY_FAILED, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_flush_target_flush_error (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = mock_expect (&log.target.mock, log.target.base.flush, &log.target,
+		LOGGING_FLUSH_FAILED);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.flush (&log.test.base);
+	CuAssertIntEquals (test, LOGGING_FLUSH_FAILED, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_flush_null (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.flush (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_log_flush_handler (CuTest *test)
+{
+	struct logging_ring_testing log;
+	struct log_flush_handler_state handler_state;
+	struct log_flush_handler handler;
+	const struct logging *flush_logs[1];
+	uint8_t entry1[] = {0x01, 0x02, 0x03};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	flush_logs[0] = &log.test.base;
+
+	status = log_flush_handler_init (&handler, &handler_state, flush_logs, 1, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The flush task moves buffered entries to the target log and then flushes the target. */
+	logging_ring_testing_expect_entry (test, &log, entry1, sizeof (entry1), 0);
+	logging_ring_testing_expect_entry (test, &log, entry2, sizeof (entry2), 0);
+
+	status = mock_expect (&log.target.mock, log.target.base.flush, &log.target, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	handler.base.execute (&handler.base);
+
+	log_flush_handler_release (&handler);
+	logging_ring_testing_release (test, &log);
+}
+#endif
+
+static void logging_ring_test_clear (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry1[] = {0x01, 0x02, 0x03};
+	uint8_t entry2[] = {0x11, 0x12, 0x13};
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry1, sizeof (entry1));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Buffered entries are discarded. */
+	status = mock_expect (&log.target.mock, log.target.base.clear, &log.target, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.clear (&log.test.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&log.target.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.create_entry (&log.test.base, entry2, sizeof (entry2));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_expect_entry (test, &log, entry2, sizeof (entry2), 0);
+
+	status = logging_ring_drain (&log.test);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_clear_error (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = mock_expect (&log.target.mock, log.target.base.clear, &log.target,
+		LOGGING_CLEAR_FAILED);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.clear (&log.test.base);
+	CuAssertIntEquals (test, LOGGING_CLEAR_FAILED, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_clear_null (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.clear (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_get_size (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[] = {0x01, 0x02, 0x03};
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Buffered entries are moved to the target log before getting the size. */
+	logging_ring_testing_expect_entry (test, &log, entry, sizeof (entry), 0);
+
+	status = mock_expect (&log.target.mock, log.target.base.get_size, &log.target, 100);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.get_size (&log.test.base);
+	CuAssertIntEquals (test, 100, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_get_size_null (CuTest *test)
+{
+	struct logging_ring_testing log;
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.get_size (NULL);
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_read_contents (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t entry[] = {0x01, 0x02, 0x03};
+	uint8_t contents[32];
+	uint8_t output[32];
+	int status;
+
+	TEST_START;
+
+	memset (contents, 0x55, sizeof (contents));
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.create_entry (&log.test.base, entry, sizeof (entry));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Buffered entries are moved to the target log before reading the contents. */
+	logging_ring_testing_expect_entry (test, &log, entry, sizeof (entry), 0);
+
+	status = mock_expect (&log.target.mock, log.target.base.read_contents, &log.target,
+		sizeof (contents), MOCK_ARG (4), MOCK_ARG_NOT_NULL, MOCK_ARG (sizeof (output)));
+	status |= mock_expect_output (&log.target.mock, 1, contents, sizeof (contents), 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = log.test.base.read_contents (&log.test.base, 4, output, sizeof (output));
+	CuAssertIntEquals (test, sizeof (contents), status);
+
+	status = testing_validate_array (contents, output, sizeof (contents));
+	CuAssertIntEquals (test, 0, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+static void logging_ring_test_read_contents_null (CuTest *test)
+{
+	struct logging_ring_testing log;
+	uint8_t output[32];
+	int status;
+
+	TEST_START;
+
+	logging_ring_testing_init (test, &log);
+
+	status = log.test.base.read_contents (NULL, 0, output, sizeof (output));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	status = log.test.base.read_contents (&log.test.base, 0, NULL, sizeof (output));
+	CuAssertIntEquals (test, LOGGING_INVALID_ARGUMENT, status);
+
+	logging_ring_testing_release (test, &log);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (logging_ring);
+
+TEST (logging_ring_test_init);
+TEST (logging_ring_test_init_not_power_of_2);
+TEST (logging_ring_test_init_null);
+TEST (logging_ring_test_init_not_aligned);
+TEST (logging_ring_test_init_insufficient_storage);
+TEST (logging_ring_test_static_init);
+TEST (logging_ring_test_static_init_null);
+TEST (logging_ring_test_static_init_not_power_of_2);
+TEST (logging_ring_test_release_null);
+TEST (logging_ring_test_create_entry);
+TEST (logging_ring_test_create_entry_wrap_ring);
+TEST (logging_ring_test_create_entry_position_overflow);
+TEST (logging_ring_test_create_entry_full);
+TEST (logging_ring_test_create_entry_full_entry_in_progress);
+TEST (logging_ring_test_create_entry_full_target_error);
+TEST (logging_ring_test_create_entry_null);
+TEST (logging_ring_test_create_entry_bad_length);
+TEST (logging_ring_test_drain_empty);
+TEST (logging_ring_test_drain_entry_in_progress);
+TEST (logging_ring_test_drain_target_error);
+TEST (logging_ring_test_drain_null);
+#ifndef LOGGING_DISABLE_FLUSH
+TEST (logging_ring_test_flush);
+TEST (logging_ring_test_flush_target_create_error);
+TEST (logging_ring_test_flush_target_flush_error);
+TEST (logging_ring_test_flush_null);
+TEST (logging_ring_test_log_flush_handler);
+#endif
+TEST (logging_ring_test_clear);
+TEST (logging_ring_test_clear_error);
+TEST (logging_ring_test_clear_null);
+TEST (logging_ring_test_get_size);
+TEST (logging_ring_test_get_size_null);
+TEST (logging_ring_test_read_contents);
+TEST (logging_ring_test_read_contents_null);
+
+TEST_SUITE_END;
+// *INDENT-ON*
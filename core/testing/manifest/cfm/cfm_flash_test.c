@@ -7060,6 +7060,69 @@ static void cfm_flash_test_get_next_measurement_or_measurement_data_first_free_a
 	cfm_flash_testing_validate_and_release (test, &cfm);
 }
 
+static void cfm_flash_test_get_next_measurement_or_measurement_data_context_from_pool (
+	CuTest *test)
+{
+	struct cfm_flash_testing cfm;
+	struct cfm_measurement_container container;
+	struct object_pool_stats stats;
+	size_t bytes_read = 0;
+	int status;
+
+	TEST_START;
+
+	cfm_flash_testing_init_and_verify (test, &cfm, 0x10000, &CFM_TESTING, 0, false, 0);
+
+	// Read Component element
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest,
+		CFM_TESTING.component_device1_entry, 0, CFM_TESTING.component_device1_hash,
+		CFM_TESTING.component_device1_offset, CFM_TESTING.component_device1_len,
+		CFM_TESTING.component_device1_len, 0);
+
+	manifest_flash_v2_testing_iterate_manifest_toc (test, &cfm.manifest, &CFM_TESTING.manifest, 2,
+		7);
+
+	manifest_flash_v2_testing_iterate_manifest_toc (test, &cfm.manifest, &CFM_TESTING.manifest, 2,
+		9);
+
+	manifest_flash_v2_testing_iterate_manifest_toc (test, &cfm.manifest, &CFM_TESTING.manifest, 2,
+		26);
+
+	// Read Measurement element
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 7, 2, 7,
+		0x74c, 0x48, sizeof (struct cfm_measurement_element), bytes_read);
+	bytes_read += sizeof (struct cfm_measurement_element);
+
+	// Read Allowable Digest 1
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 7, 7, 7,
+		0x74c, 0x48, sizeof (struct cfm_allowable_digest_element), bytes_read);
+	bytes_read += sizeof (struct cfm_allowable_digest_element);
+
+	// Read Allowable Digest 1 digests
+	manifest_flash_v2_testing_read_element (test, &cfm.manifest, &CFM_TESTING.manifest, 7, 7, 7,
+		0x74c, 0x48, 2 * SHA256_HASH_LENGTH, bytes_read);
+
+	status = cfm.test.base.get_next_measurement_or_measurement_data (&cfm.test.base, 3, &container,
+		true);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CFM_MEASUREMENT_TYPE_DIGEST, container.measurement_type);
+
+	status = object_pool_get_stats (&cfm.test.context_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, CFM_FLASH_MEASUREMENT_CONTEXT_COUNT, stats.num_objects);
+	CuAssertIntEquals (test, 1, stats.num_allocated);
+	CuAssertIntEquals (test, 1, stats.total_allocations);
+	CuAssertIntEquals (test, 0, stats.failed_allocations);
+
+	cfm.test.base.free_measurement_container (&cfm.test.base, &container);
+
+	status = object_pool_get_stats (&cfm.test.context_pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.num_allocated);
+
+	cfm_flash_testing_validate_and_release (test, &cfm);
+}
+
 static void cfm_flash_test_get_next_measurement_or_measurement_data_null (CuTest *test)
 {
 	struct cfm_flash_testing cfm;
@@ -11122,6 +11185,7 @@ TEST (cfm_flash_test_get_next_measurement_or_measurement_data_second_component);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_no_measurement_data);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_no_measurement);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_first_free_after_failure);
+TEST (cfm_flash_test_get_next_measurement_or_measurement_data_context_from_pool);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_null);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_verify_never_run);
 TEST (cfm_flash_test_get_next_measurement_or_measurement_data_component_read_fail);
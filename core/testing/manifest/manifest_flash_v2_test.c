@@ -6,6 +6,7 @@
 #include <string.h>
 #include "manifest_flash_v2_testing.h"
 #include "testing.h"
+#include "common/array_size.h"
 #include "crypto/ecc.h"
 #include "crypto/rsa.h"
 #include "manifest/cfm/cfm_format.h"
@@ -417,6 +418,206 @@ static void manifest_flash_v2_testing_init_and_verify (CuTest *test,
 	CuAssertIntEquals (test, 0, status);
 }
 
+/**
+ * Set expectations on mocks for v2 manifest verification when the table of contents will be
+ * cached.
+ *
+ * @param test The testing framework.
+ * @param manifest The components for the test.
+ * @param data Manifest data for the test.
+ * @param sig_result Result of the signature verification call.
+ */
+static void manifest_flash_v2_testing_verify_manifest_toc_cache (CuTest *test,
+	struct manifest_flash_v2_testing *manifest, const struct manifest_v2_testing_data *data,
+	int sig_result)
+{
+	uint32_t toc_entry_offset = MANIFEST_V2_TOC_ENTRY_OFFSET;
+	uint32_t toc_hashes_offset =
+		toc_entry_offset + (MANIFEST_V2_TOC_ENTRY_SIZE * data->toc_entries);
+	const uint8_t *plat_id = data->raw + data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE;
+	uint32_t validate_start = data->toc_hash_offset + data->toc_hash_len;
+	uint32_t validate_end = data->plat_id_offset;
+	uint32_t validate_resume =
+		data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE + data->plat_id_str_len;
+	int status;
+
+	/* Read manifest header. */
+	status = mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr), MOCK_ARG_NOT_NULL, MOCK_ARG (MANIFEST_V2_HEADER_SIZE));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->raw, data->length, 2);
+
+	/* Read manifest signature. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + data->sig_offset), MOCK_ARG_NOT_NULL, MOCK_ARG (data->sig_len));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->signature, data->sig_len, 2);
+
+	/* Read table of contents header. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + MANIFEST_V2_TOC_HDR_OFFSET), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_HEADER_SIZE));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->toc,
+		data->length - MANIFEST_V2_TOC_HDR_OFFSET, 2);
+
+	/* Read all table of contents entries. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + toc_entry_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_ENTRY_SIZE * data->toc_entries));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->raw + toc_entry_offset,
+		data->length - toc_entry_offset, 2);
+
+	/* Read all table of contents element hashes. */
+	if (data->toc_hashes != 0) {
+		status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash,
+			0, MOCK_ARG (manifest->addr + toc_hashes_offset), MOCK_ARG_NOT_NULL,
+			MOCK_ARG (data->toc_hash_len * data->toc_hashes));
+		status |= mock_expect_output (&manifest->flash.mock, 1, data->raw + toc_hashes_offset,
+			data->length - toc_hashes_offset, 2);
+	}
+
+	/* Read table of contents hash. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + data->toc_hash_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (data->toc_hash_len));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->toc_hash,
+		data->length - data->toc_hash_offset, 2);
+
+	status |= flash_mock_expect_verify_flash (&manifest->flash, manifest->addr + validate_start,
+		data->raw + validate_start, validate_end - validate_start);
+
+	/* Read the platform ID header. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + data->plat_id_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_PLATFORM_HEADER_SIZE));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->plat_id,
+		data->length - data->plat_id_offset, 2);
+
+	/* Read the platform ID string. */
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (data->plat_id_str_len));
+	status |= mock_expect_output (&manifest->flash.mock, 1, plat_id,
+		data->length - data->plat_id_offset + MANIFEST_V2_PLATFORM_HEADER_SIZE, 2);
+
+	status |= flash_mock_expect_verify_flash (&manifest->flash, manifest->addr + validate_resume,
+		data->raw + validate_resume, data->sig_offset - validate_resume);
+
+	status |= mock_expect (&manifest->verification.mock,
+		manifest->verification.base.verify_signature, &manifest->verification, sig_result,
+		MOCK_ARG_PTR_CONTAINS (data->hash, data->hash_len), MOCK_ARG (data->hash_len),
+		MOCK_ARG_PTR_CONTAINS (data->signature, data->sig_len), MOCK_ARG (data->sig_len));
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize a manifest for testing with the table of contents cache enabled and run verification.
+ *
+ * @param test The testing framework.
+ * @param manifest The testing components to initialize.
+ * @param address The base address for the manifest data.
+ * @param magic_v1 The manifest v1 type identifier.
+ * @param magic_v2 The manifest v2 type identifier.
+ * @param data Manifest data for the test.
+ * @param sig_result Result of the signature verification call.
+ */
+static void manifest_flash_v2_testing_init_and_verify_toc_cache (CuTest *test,
+	struct manifest_flash_v2_testing *manifest, uint32_t address, uint16_t magic_v1,
+	uint16_t magic_v2, const struct manifest_v2_testing_data *data, int sig_result)
+{
+	int status;
+
+	manifest_flash_v2_testing_init (test, manifest, address, magic_v1, magic_v2);
+
+	status = manifest_flash_enable_toc_cache (&manifest->test, manifest->toc_cache,
+		ARRAY_SIZE (manifest->toc_cache), manifest->toc_hash_cache,
+		sizeof (manifest->toc_hash_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_verify_manifest_toc_cache (test, manifest, data, sig_result);
+
+	status = manifest_flash_verify (&manifest->test, &manifest->hash.base,
+		&manifest->verification.base, NULL, 0);
+	CuAssertIntEquals (test, sig_result, status);
+
+	status = mock_validate (&manifest->flash.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&manifest->verification.mock);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Set expectations on mocks for reading an element from a v2 manifest using the cached table of
+ * contents.
+ *
+ * @param test The testing framework.
+ * @param manifest The components for the test.
+ * @param data Manifest data for the test.
+ * @param hash_id The hash index for the element or -1 if the element is not hashed.
+ * @param offset Address offset of the element to read.
+ * @param length Length of the element data.
+ * @param read_len Maximum length of the element data to read.
+ * @param read_offset Offset to starting reading the element data.
+ */
+static void manifest_flash_v2_testing_read_element_toc_cache (CuTest *test,
+	struct manifest_flash_v2_testing *manifest, const struct manifest_v2_testing_data *data,
+	int hash_id, uint32_t offset, size_t length, size_t read_len, uint32_t read_offset)
+{
+	int status = 0;
+
+	if (read_offset != 0) {
+		if (hash_id >= 0) {
+			status |= flash_mock_expect_verify_flash (&manifest->flash, manifest->addr + offset,
+				data->raw + offset, read_offset);
+		}
+
+		length -= read_offset;
+		offset += read_offset;
+	}
+	if (length < read_len) {
+		read_len = length;
+	}
+
+	status |= mock_expect (&manifest->flash.mock, manifest->flash.base.read, &manifest->flash, 0,
+		MOCK_ARG (manifest->addr + offset), MOCK_ARG_NOT_NULL, MOCK_ARG (read_len));
+	status |= mock_expect_output (&manifest->flash.mock, 1, data->raw + offset,
+		data->length - offset, 2);
+
+	if ((hash_id >= 0) && (read_len < length)) {
+		status |= flash_mock_expect_verify_flash (&manifest->flash,
+			manifest->addr + offset + read_len, data->raw + offset + read_len, length - read_len);
+	}
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Get the number of flash read calls and the total number of bytes requested from flash.
+ *
+ * @param manifest The components for the test.
+ * @param bytes Output for the total number of bytes read.
+ *
+ * @return The number of flash read calls.
+ */
+static int manifest_flash_v2_testing_count_flash_reads (struct manifest_flash_v2_testing *manifest,
+	size_t *bytes)
+{
+	struct mock_call *call = manifest->flash.mock.called;
+	int reads = 0;
+
+	*bytes = 0;
+	while (call != NULL) {
+		if (call->func == manifest->flash.base.read) {
+			reads++;
+			*bytes += call->argv[2].value;
+		}
+
+		call = call->next;
+	}
+
+	return reads;
+}
+
 /**
  * Set expectations on mocks for reading an element from a v2 manifest.
  *
@@ -8704,6 +8905,460 @@ static void manifest_flash_v2_test_get_child_elements_info_toc_invalid (CuTest *
 }
 
 
+static void manifest_flash_v2_test_enable_toc_cache (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, manifest.toc_cache,
+		ARRAY_SIZE (manifest.toc_cache), manifest.toc_hash_cache, sizeof (manifest.toc_hash_cache));
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, manifest.toc_cache,
+		ARRAY_SIZE (manifest.toc_cache), NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_enable_toc_cache_null (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (NULL, manifest.toc_cache,
+		ARRAY_SIZE (manifest.toc_cache), manifest.toc_hash_cache, sizeof (manifest.toc_hash_cache));
+	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, NULL,
+		ARRAY_SIZE (manifest.toc_cache), manifest.toc_hash_cache, sizeof (manifest.toc_hash_cache));
+	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, manifest.toc_cache, 0,
+		manifest.toc_hash_cache, sizeof (manifest.toc_hash_cache));
+	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, manifest.toc_cache,
+		ARRAY_SIZE (manifest.toc_cache), NULL, sizeof (manifest.toc_hash_cache));
+	CuAssertIntEquals (test, MANIFEST_INVALID_ARGUMENT, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0);
+	CuAssertIntEquals (test, true, manifest.test.toc_cache_valid);
+
+	status = testing_validate_array (PFM_V2.manifest.raw + MANIFEST_V2_TOC_ENTRY_OFFSET,
+		manifest.toc_cache, MANIFEST_V2_TOC_ENTRY_SIZE * PFM_V2.manifest.toc_entries);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_bad_signature (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, SIG_VERIFICATION_BAD_SIGNATURE);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_too_small (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, manifest.toc_cache,
+		PFM_V2.manifest.toc_entries - 1, manifest.toc_hash_cache,
+		sizeof (manifest.toc_hash_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The table of contents doesn't fit, so verification must use the uncached flow. */
+	manifest_flash_v2_testing_verify_manifest (test, &manifest, &PFM_V2.manifest, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_hashes_too_small (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, manifest.toc_cache,
+		ARRAY_SIZE (manifest.toc_cache), manifest.toc_hash_cache,
+		(PFM_V2.manifest.toc_hash_len * PFM_V2.manifest.toc_hashes) - 1);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_verify_manifest (test, &manifest, &PFM_V2.manifest, 0);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_verify_toc_cache_toc_read_error (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init (test, &manifest, 0x10000, PFM_MAGIC_NUM, PFM_V2_MAGIC_NUM);
+
+	status = manifest_flash_enable_toc_cache (&manifest.test, manifest.toc_cache,
+		ARRAY_SIZE (manifest.toc_cache), manifest.toc_hash_cache,
+		sizeof (manifest.toc_hash_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr), MOCK_ARG_NOT_NULL, MOCK_ARG (MANIFEST_V2_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, PFM_V2.manifest.raw,
+		PFM_V2.manifest.length, 2);
+
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + PFM_V2.manifest.sig_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (PFM_V2.manifest.sig_len));
+	status |= mock_expect_output (&manifest.flash.mock, 1, PFM_V2.manifest.signature,
+		PFM_V2.manifest.sig_len, 2);
+
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + MANIFEST_V2_TOC_HDR_OFFSET), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (MANIFEST_V2_TOC_HEADER_SIZE));
+	status |= mock_expect_output (&manifest.flash.mock, 1, PFM_V2.manifest.toc,
+		PFM_V2.manifest.length - MANIFEST_V2_TOC_HDR_OFFSET, 2);
+
+	status |= mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash,
+		FLASH_READ_FAILED, MOCK_ARG (manifest.addr + MANIFEST_V2_TOC_ENTRY_OFFSET),
+		MOCK_ARG_NOT_NULL, MOCK_ARG (MANIFEST_V2_TOC_ENTRY_SIZE * PFM_V2.manifest.toc_entries));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_verify (&manifest.test, &manifest.hash.base,
+		&manifest.verification.base, NULL, 0);
+	CuAssertIntEquals (test, FLASH_READ_FAILED, status);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	size_t total = 0;
+	uint8_t format = 0xff;
+	uint8_t found = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0);
+
+	manifest_flash_v2_testing_read_element_toc_cache (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.plat_id_hash, PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len,
+		sizeof (buffer), 0);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, &found, &format, &total, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
+	CuAssertIntEquals (test, 1, format);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, total);
+
+	status = testing_validate_array (PFM_V2.manifest.plat_id, buffer, status);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_partial_element_with_read_offset (
+	CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len - 4];
+	uint8_t *element = buffer;
+	size_t total = 0;
+	uint8_t format = 0xff;
+	uint8_t found = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0);
+
+	manifest_flash_v2_testing_read_element_toc_cache (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.plat_id_hash, PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len,
+		sizeof (buffer) - 2, 2);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 2, &found, &format, &total, &element,
+		sizeof (buffer) - 2);
+	CuAssertIntEquals (test, sizeof (buffer) - 2, status);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, total);
+
+	status = testing_validate_array (PFM_V2.manifest.plat_id + 2, buffer, status);
+	CuAssertIntEquals (test, 0, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_element_not_found (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base, 0x55, 0,
+		MANIFEST_NO_PARENT, 0, NULL, NULL, NULL, &element, sizeof (buffer));
+	CuAssertIntEquals (test, MANIFEST_ELEMENT_NOT_FOUND, status);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, PFM_V2.manifest.plat_id_entry + 1, MANIFEST_NO_PARENT, 0, NULL, NULL,
+		NULL, &element, sizeof (buffer));
+	CuAssertIntEquals (test, MANIFEST_ELEMENT_NOT_FOUND, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_child_not_found (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		PFM_FIRMWARE_VERSION, PFM_V2.manifest.plat_id_entry, PFM_FIRMWARE, 0, NULL, NULL, NULL,
+		&element, sizeof (buffer));
+	CuAssertIntEquals (test, MANIFEST_CHILD_NOT_FOUND, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_after_invalidate (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	uint8_t found = 0xff;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0);
+
+	manifest_flash_invalidate_toc_cache (&manifest.test);
+	CuAssertIntEquals (test, false, manifest.test.toc_cache_valid);
+
+	/* Element access must validate the table of contents from flash. */
+	manifest_flash_v2_testing_read_element (test, &manifest, &PFM_V2.manifest,
+		PFM_V2.manifest.plat_id_entry, 0, PFM_V2.manifest.plat_id_hash,
+		PFM_V2.manifest.plat_id_offset, PFM_V2.manifest.plat_id_len, sizeof (buffer), 0);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, &found, NULL, NULL, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_len, status);
+	CuAssertIntEquals (test, PFM_V2.manifest.plat_id_entry, found);
+
+	manifest_flash_invalidate_toc_cache (NULL);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_bad_element_hash (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	uint8_t bad_data[PFM_V2.manifest.plat_id_len];
+
+	TEST_START;
+
+	memcpy (bad_data, PFM_V2.manifest.plat_id, sizeof (bad_data));
+	bad_data[5] ^= 0x55;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, &PFM_V2.manifest, 0);
+
+	status = mock_expect (&manifest.flash.mock, manifest.flash.base.read, &manifest.flash, 0,
+		MOCK_ARG (manifest.addr + PFM_V2.manifest.plat_id_offset), MOCK_ARG_NOT_NULL,
+		MOCK_ARG (sizeof (buffer)));
+	status |= mock_expect_output (&manifest.flash.mock, 1, bad_data, sizeof (bad_data), 2);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = manifest_flash_read_element_data (&manifest.test, &manifest.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, NULL, NULL, NULL, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, MANIFEST_ELEMENT_INVALID, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_read_element_data_toc_cache_flash_access (CuTest *test)
+{
+	struct manifest_flash_v2_testing uncached;
+	struct manifest_flash_v2_testing cached;
+	const struct manifest_v2_testing_data *data = &PFM_V2.manifest;
+	int status;
+	uint8_t buffer[PFM_V2.manifest.plat_id_len];
+	uint8_t *element = buffer;
+	int reads_start;
+	int uncached_reads;
+	int cached_reads;
+	size_t bytes_start;
+	size_t uncached_bytes;
+	size_t cached_bytes;
+
+	TEST_START;
+
+	/* Compare the flash access needed to read a single element with and without the cache. */
+	manifest_flash_v2_testing_init_and_verify (test, &uncached, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, data, 0, false, 0);
+
+	manifest_flash_v2_testing_read_element (test, &uncached, data, data->plat_id_entry, 0,
+		data->plat_id_hash, data->plat_id_offset, data->plat_id_len, sizeof (buffer), 0);
+
+	reads_start = manifest_flash_v2_testing_count_flash_reads (&uncached, &bytes_start);
+	status = manifest_flash_read_element_data (&uncached.test, &uncached.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, NULL, NULL, NULL, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, data->plat_id_len, status);
+
+	uncached_reads = manifest_flash_v2_testing_count_flash_reads (&uncached, &uncached_bytes);
+	uncached_reads -= reads_start;
+	uncached_bytes -= bytes_start;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &cached, 0x10000, PFM_MAGIC_NUM,
+		PFM_V2_MAGIC_NUM, data, 0);
+
+	manifest_flash_v2_testing_read_element_toc_cache (test, &cached, data, data->plat_id_hash,
+		data->plat_id_offset, data->plat_id_len, sizeof (buffer), 0);
+
+	reads_start = manifest_flash_v2_testing_count_flash_reads (&cached, &bytes_start);
+	status = manifest_flash_read_element_data (&cached.test, &cached.hash.base,
+		MANIFEST_PLATFORM_ID, 0, MANIFEST_NO_PARENT, 0, NULL, NULL, NULL, &element,
+		sizeof (buffer));
+	CuAssertIntEquals (test, data->plat_id_len, status);
+
+	cached_reads = manifest_flash_v2_testing_count_flash_reads (&cached, &cached_bytes);
+	cached_reads -= reads_start;
+	cached_bytes -= bytes_start;
+
+	/* Only the element data should be read from flash when the TOC is cached. */
+	CuAssertIntEquals (test, 1, cached_reads);
+	CuAssertIntEquals (test, data->plat_id_len, cached_bytes);
+	CuAssertTrue (test, (uncached_reads > cached_reads));
+	CuAssertTrue (test, (uncached_bytes >= (data->toc_hash_offset - MANIFEST_V2_TOC_ENTRY_OFFSET)));
+
+	manifest_flash_v2_testing_validate_and_release (test, &uncached);
+	manifest_flash_v2_testing_validate_and_release (test, &cached);
+}
+
+static void manifest_flash_v2_test_get_child_elements_info_toc_cache (CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	size_t child_len;
+	int num_child;
+	int entry;
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, CFM_MAGIC_NUM,
+		CFM_V2_MAGIC_NUM, &CFM_TESTING.manifest, 0);
+
+	status = manifest_flash_get_child_elements_info (&manifest.test, &manifest.hash.base, 2,
+		CFM_COMPONENT_DEVICE, MANIFEST_NO_PARENT, CFM_PMR_DIGEST, &child_len, &num_child, &entry);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, num_child);
+	CuAssertIntEquals (test, 5, entry);
+	CuAssertIntEquals (test, 0x68, child_len);
+
+	status = manifest_flash_get_child_elements_info (&manifest.test, &manifest.hash.base, 2,
+		CFM_COMPONENT_DEVICE, MANIFEST_NO_PARENT, CFM_ROOT_CA, NULL, NULL, &entry);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, entry);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
+static void manifest_flash_v2_test_get_child_elements_info_toc_cache_only_first_entry_not_found (
+	CuTest *test)
+{
+	struct manifest_flash_v2_testing manifest;
+	int entry;
+	int status;
+
+	TEST_START;
+
+	manifest_flash_v2_testing_init_and_verify_toc_cache (test, &manifest, 0x10000, CFM_MAGIC_NUM,
+		CFM_V2_MAGIC_NUM, &CFM_TESTING.manifest, 0);
+
+	status = manifest_flash_get_child_elements_info (&manifest.test, &manifest.hash.base, 3,
+		CFM_ROOT_CA, CFM_COMPONENT_DEVICE, CFM_ALLOWABLE_DATA, NULL, NULL, &entry);
+	CuAssertIntEquals (test, MANIFEST_CHILD_NOT_FOUND, status);
+
+	manifest_flash_v2_testing_validate_and_release (test, &manifest);
+}
+
 // *INDENT-OFF*
 TEST_SUITE_START (manifest_flash_v2);
 
@@ -8909,6 +9564,22 @@ TEST (manifest_flash_v2_test_get_child_elements_info_hash_update_entry_fail);
 TEST (manifest_flash_v2_test_get_child_elements_info_toc_after_last_entry_hash_update_fail);
 TEST (manifest_flash_v2_test_get_child_elements_info_hash_finish_fail);
 TEST (manifest_flash_v2_test_get_child_elements_info_toc_invalid);
+TEST (manifest_flash_v2_test_enable_toc_cache);
+TEST (manifest_flash_v2_test_enable_toc_cache_null);
+TEST (manifest_flash_v2_test_verify_toc_cache);
+TEST (manifest_flash_v2_test_verify_toc_cache_bad_signature);
+TEST (manifest_flash_v2_test_verify_toc_cache_too_small);
+TEST (manifest_flash_v2_test_verify_toc_cache_hashes_too_small);
+TEST (manifest_flash_v2_test_verify_toc_cache_toc_read_error);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_partial_element_with_read_offset);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_element_not_found);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_child_not_found);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_after_invalidate);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_bad_element_hash);
+TEST (manifest_flash_v2_test_read_element_data_toc_cache_flash_access);
+TEST (manifest_flash_v2_test_get_child_elements_info_toc_cache);
+TEST (manifest_flash_v2_test_get_child_elements_info_toc_cache_only_first_entry_not_found);
 
 TEST_SUITE_END;
 // *INDENT-ON*
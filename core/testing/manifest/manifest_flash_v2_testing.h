@@ -26,6 +26,8 @@ struct manifest_flash_v2_testing {
 	uint32_t addr;										/**< Base address of the PFM. */
 	uint8_t signature[512];								/**< Buffer for the manifest signature. */
 	uint8_t platform_id[256];							/**< Cache for the platform ID. */
+	struct manifest_toc_entry toc_cache[MANIFEST_MAX_ENTRIES];		/**< Cache for TOC entries. */
+	uint8_t toc_hash_cache[MANIFEST_MAX_ENTRIES * SHA512_HASH_LENGTH];	/**< Cache for TOC hashes. */
 	struct manifest_flash test;							/**< Manifest instance for common testing. */
 };
 
@@ -275,6 +275,194 @@ static void mctp_interface_testing_generate_and_issue_request (CuTest *test,
 	CuAssertIntEquals (test, issue_request_status, status);
 }
 
+/**
+ * Construct a received MCTP request packet.  The packet will be sent by an SMBus address of 0x55.
+ *
+ * @param packet The packet to construct.
+ * @param src_eid EID of the device sending the packet.
+ * @param msg_tag Message tag for the packet.
+ * @param som Flag to indicate the packet starts a message.
+ * @param eom Flag to indicate the packet ends a message.
+ * @param packet_seq Sequence number for the packet.
+ * @param payload Payload data for the packet.
+ * @param length Length of the packet payload.
+ */
+static void mctp_interface_testing_build_request_packet (struct cmd_packet *packet, uint8_t src_eid,
+	uint8_t msg_tag, bool som, bool eom, uint8_t packet_seq, const uint8_t *payload, size_t length)
+{
+	struct mctp_base_protocol_transport_header *header =
+		(struct mctp_base_protocol_transport_header*) packet->data;
+
+	memset (packet, 0, sizeof (*packet));
+
+	header->cmd_code = SMBUS_CMD_CODE_MCTP;
+	header->byte_count = length + 5;
+	header->source_addr = 0xAB;
+	header->rsvd = 0;
+	header->header_version = 1;
+	header->destination_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	header->source_eid = src_eid;
+	header->som = som;
+	header->eom = eom;
+	header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
+	header->msg_tag = msg_tag;
+	header->packet_seq = packet_seq;
+
+	memcpy (&packet->data[MCTP_HEADER_LENGTH], payload, length);
+	packet->data[MCTP_HEADER_LENGTH + length] = checksum_crc8 (0xBA, packet->data,
+		MCTP_HEADER_LENGTH + length);
+	packet->pkt_size = MCTP_HEADER_LENGTH + length + 1;
+	packet->dest_addr = 0x5D;
+}
+
+/**
+ * Set up the expectations for processing a request message that doesn't generate a response.
+ *
+ * @param test The test framework.
+ * @param mctp The testing instances to utilize.
+ * @param data The expected request data.
+ * @param length Length of the request data.
+ * @param src_eid EID of the device that sent the request.
+ */
+static void mctp_interface_testing_expect_request_no_response (CuTest *test,
+	struct mctp_interface_testing *mctp, uint8_t *data, size_t length, uint8_t src_eid)
+{
+	struct cmd_interface_msg request;
+	struct cmd_interface_msg response;
+	int status;
+
+	memset (&request, 0, sizeof (request));
+	request.data = data;
+	request.length = length;
+	request.payload = data;
+	request.payload_length = length;
+	request.source_eid = src_eid;
+	request.source_addr = 0x55;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	request.is_encrypted = false;
+	request.crypto_timeout = false;
+	request.channel_id = 0;
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	memset (&response, 0, sizeof (response));
+	response.data = data;
+	response.payload = response.data;
+
+	status = mock_expect (&mctp->req_handler.mock, mctp->req_handler.base.base.process_request,
+		&mctp->req_handler, 0,
+		MOCK_ARG_VALIDATOR_DEEP_COPY_TMP (cmd_interface_mock_validate_request, &request,
+			sizeof (request), cmd_interface_mock_save_request, cmd_interface_mock_free_request,
+			cmd_interface_mock_duplicate_request));
+	status |= mock_expect_output_deep_copy_tmp (&mctp->req_handler.mock, 0, &response,
+		sizeof (response), cmd_interface_mock_copy_request, cmd_interface_mock_duplicate_request,
+		cmd_interface_mock_free_request);
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Send a request message to the BMC that will not wait for a response.
+ *
+ * @param test The test framework.
+ * @param mctp The testing instances to utilize.
+ * @param msg_tag The message tag expected to be assigned to the request.
+ */
+static void mctp_interface_testing_send_request_no_wait (CuTest *test,
+	struct mctp_interface_testing *mctp, uint8_t msg_tag)
+{
+	uint8_t tx_message[MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN] = {0};
+	struct cmd_packet tx_packet;
+	struct mctp_base_protocol_transport_header *header =
+		(struct mctp_base_protocol_transport_header*) tx_packet.data;
+	struct cmd_interface_msg request;
+	int status;
+
+	status = msg_transport_create_empty_request (&mctp->test.base, tx_message,
+		sizeof (tx_message), MCTP_BASE_PROTOCOL_BMC_EID, &request);
+	CuAssertIntEquals (test, 0, status);
+
+	request.payload[0] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	request.payload[1] = 0x12;
+	request.payload[2] = 0x34;
+	request.payload[3] = 0x56;
+	request.payload[4] = 0x78;
+	request.payload[5] = msg_tag;
+	cmd_interface_msg_set_message_payload_length (&request, 6);
+
+	memset (&tx_packet, 0, sizeof (tx_packet));
+
+	header->cmd_code = SMBUS_CMD_CODE_MCTP;
+	header->byte_count = 11;
+	header->source_addr = 0xBB;
+	header->rsvd = 0;
+	header->header_version = 1;
+	header->destination_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	header->source_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	header->som = 1;
+	header->eom = 1;
+	header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
+	header->msg_tag = msg_tag;
+	header->packet_seq = 0;
+
+	memcpy (&tx_packet.data[7], request.payload, request.payload_length);
+
+	tx_packet.data[13] = checksum_crc8 (0xA2, tx_packet.data, 13);
+	tx_packet.pkt_size = 14;
+	tx_packet.state = CMD_VALID_PACKET;
+	tx_packet.dest_addr = 0x51;
+	tx_packet.timeout_valid = false;
+
+	status = mock_expect (&mctp->channel.mock, mctp->channel.base.send_packet, &mctp->channel, 0,
+		MOCK_ARG_VALIDATOR_TMP (cmd_channel_mock_validate_packet, &tx_packet, sizeof (tx_packet)));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp->test.base.send_request_message (&mctp->test.base, &request, 0, NULL);
+	CuAssertIntEquals (test, MSG_TRANSPORT_NO_WAIT_RESPONSE, status);
+}
+
+/**
+ * Construct a single packet vendor defined response from the BMC.
+ *
+ * @param packet The packet to construct.
+ * @param msg_tag Message tag for the response.
+ */
+static void mctp_interface_testing_build_response_packet (struct cmd_packet *packet,
+	uint8_t msg_tag)
+{
+	struct mctp_base_protocol_transport_header *header =
+		(struct mctp_base_protocol_transport_header*) packet->data;
+
+	memset (packet, 0, sizeof (*packet));
+
+	header->cmd_code = SMBUS_CMD_CODE_MCTP;
+	header->byte_count = 15;
+	header->source_addr = 0xA3;
+	header->rsvd = 0;
+	header->header_version = 1;
+	header->destination_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	header->source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	header->som = 1;
+	header->eom = 1;
+	header->tag_owner = MCTP_BASE_PROTOCOL_TO_RESPONSE;
+	header->msg_tag = msg_tag;
+	header->packet_seq = 0;
+
+	packet->data[7] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	packet->data[8] = 0x01;
+	packet->data[9] = 0x02;
+	packet->data[10] = 0x03;
+	packet->data[11] = 0x04;
+	packet->data[12] = 0x05;
+	packet->data[13] = 0x06;
+	packet->data[14] = 0x07;
+	packet->data[15] = 0x08;
+	packet->data[16] = msg_tag;
+	packet->data[17] = checksum_crc8 (0xBA, packet->data, 17);
+	packet->pkt_size = 18;
+	packet->dest_addr = 0x5D;
+	packet->timeout_valid = false;
+}
+
 /*******************
  * Test cases
  *******************/
@@ -1585,7 +1773,7 @@ static void mctp_interface_test_process_packet_new_som_before_eom (CuTest *test)
 		.component = DEBUG_LOG_COMPONENT_MCTP,
 		.msg_index = MCTP_LOGGING_RESTART_MESSAGE,
 		.arg1 = 0x0a030111,
-		.arg2 = 0x0c040122
+		.arg2 = 0x0a030122
 	};
 
 	TEST_START;
@@ -1630,18 +1818,18 @@ static void mctp_interface_test_process_packet_new_som_before_eom (CuTest *test)
 	CuAssertIntEquals (test, 0, status);
 	CuAssertPtrEquals (test, NULL, tx);
 
-	/* Start a new message. */
+	/* Start a new message with the same message tag. */
 	header->cmd_code = SMBUS_CMD_CODE_MCTP;
 	header->byte_count = 69;
 	header->source_addr = 0xAB;
 	header->rsvd = 0;
 	header->header_version = 1;
 	header->destination_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
-	header->source_eid = 0x0C;
+	header->source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
 	header->som = 1;
 	header->eom = 0;
 	header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
-	header->msg_tag = 0x04;
+	header->msg_tag = 0x03;
 	header->packet_seq = 0;
 
 	memcpy (&rx.data[7], &data[64], 64);
@@ -1672,11 +1860,11 @@ static void mctp_interface_test_process_packet_new_som_before_eom (CuTest *test)
 	header->rsvd = 0;
 	header->header_version = 1;
 	header->destination_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
-	header->source_eid = 0x0C;
+	header->source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
 	header->som = 0;
 	header->eom = 1;
 	header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
-	header->msg_tag = 0x04;
+	header->msg_tag = 0x03;
 	header->packet_seq = 1;
 
 	memcpy (&rx.data[7], &data[128], 64);
@@ -1687,7 +1875,7 @@ static void mctp_interface_test_process_packet_new_som_before_eom (CuTest *test)
 	request.length = sizeof (data) - 64;
 	request.payload = request.data;
 	request.payload_length = request.length;
-	request.source_eid = 0x0c;
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
 	request.source_addr = 0x55;
 	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
 	request.is_encrypted = false;
@@ -5044,36 +5232,540 @@ static void mctp_interface_test_process_packet_different_src_eid (CuTest *test)
 	header->msg_tag = 0x03;
 	header->packet_seq = 1;
 
-	memcpy (&rx.data[7], &data[64], 64);
-	rx.data[71] = checksum_crc8 (0xBA, rx.data, 71);
-	rx.pkt_size = 72;
+	memcpy (&rx.data[7], &data[64], 64);
+	rx.data[71] = checksum_crc8 (0xBA, rx.data, 71);
+	rx.pkt_size = 72;
+
+	request.data = data;
+	request.length = sizeof (data);
+	request.payload = data;
+	request.payload_length = sizeof (data);
+	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	request.source_addr = 0x55;
+	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	request.is_encrypted = false;
+	request.crypto_timeout = false;
+	request.channel_id = 0;
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	memset (&response, 0, sizeof (response));
+	response.data = data;
+	response.length = 0;
+	response.payload = response.data;
+	response.payload_length = 0;
+
+	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.base.process_request,
+		&mctp.req_handler, 0,
+		MOCK_ARG_VALIDATOR_DEEP_COPY (cmd_interface_mock_validate_request, &request,
+			sizeof (request), cmd_interface_mock_save_request, cmd_interface_mock_free_request));
+	status |= mock_expect_output_deep_copy (&mctp.req_handler.mock, 0, &response, sizeof (response),
+		cmd_interface_mock_copy_request);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_release (test, &mctp);
+}
+
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+static void mctp_interface_test_process_packet_interleaved_messages_different_src_eid (
+	CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	uint8_t data1[32];
+	uint8_t data2[32];
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	for (i = 0; i < sizeof (data1); i++) {
+		data1[i] = i;
+		data2[i] = ~i;
+	}
+
+	data1[0] = 0x11;
+	data2[0] = 0x22;
+
+	/* Start a message from the first endpoint. */
+	mctp_interface_testing_build_request_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0x03, true,
+		false, 0, data1, 16);
+
+	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.is_message_type_supported,
+		&mctp.req_handler, 0, MOCK_ARG (0x11));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Start a message from a second endpoint using the same message tag. */
+	mctp_interface_testing_build_request_packet (&rx, 0x0c, 0x03, true, false, 0, data2, 16);
+
+	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.is_message_type_supported,
+		&mctp.req_handler, 0, MOCK_ARG (0x22));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Complete the first message. */
+	mctp_interface_testing_build_request_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0x03, false,
+		true, 1, &data1[16], 16);
+
+	mctp_interface_testing_expect_request_no_response (test, &mctp, data1, sizeof (data1),
+		MCTP_BASE_PROTOCOL_BMC_EID);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Complete the second message. */
+	mctp_interface_testing_build_request_packet (&rx, 0x0c, 0x03, false, true, 1, &data2[16], 16);
+
+	mctp_interface_testing_expect_request_no_response (test, &mctp, data2, sizeof (data2), 0x0c);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_release (test, &mctp);
+}
+
+static void mctp_interface_test_process_packet_interleaved_messages_different_msg_tag (
+	CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	uint8_t data1[32];
+	uint8_t data2[32];
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	for (i = 0; i < sizeof (data1); i++) {
+		data1[i] = i;
+		data2[i] = ~i;
+	}
+
+	data1[0] = 0x11;
+	data2[0] = 0x22;
+
+	/* Start a message with the first message tag. */
+	mctp_interface_testing_build_request_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0x03, true,
+		false, 0, data1, 16);
+
+	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.is_message_type_supported,
+		&mctp.req_handler, 0, MOCK_ARG (0x11));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Start a message from the same endpoint with a different message tag. */
+	mctp_interface_testing_build_request_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0x05, true,
+		false, 0, data2, 16);
+
+	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.is_message_type_supported,
+		&mctp.req_handler, 0, MOCK_ARG (0x22));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Complete the second message. */
+	mctp_interface_testing_build_request_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0x05, false,
+		true, 1, &data2[16], 16);
+
+	mctp_interface_testing_expect_request_no_response (test, &mctp, data2, sizeof (data2),
+		MCTP_BASE_PROTOCOL_BMC_EID);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Complete the first message. */
+	mctp_interface_testing_build_request_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0x03, false,
+		true, 1, &data1[16], 16);
+
+	mctp_interface_testing_expect_request_no_response (test, &mctp, data1, sizeof (data1),
+		MCTP_BASE_PROTOCOL_BMC_EID);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_release (test, &mctp);
+}
+#endif
+
+static void mctp_interface_test_process_packet_interleaved_messages_max_contexts (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	uint8_t data[MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS][48];
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	size_t i;
+	size_t j;
+	int status;
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		for (j = 0; j < sizeof (data[i]); j++) {
+			data[i][j] = i + j;
+		}
+
+		data[i][0] = 0x10 + i;
+	}
+
+	/* Start a message from each endpoint. */
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		mctp_interface_testing_build_request_packet (&rx, 0x20 + i, 0x00, true, false, 0, data[i],
+			16);
+
+		status = mock_expect (&mctp.req_handler.mock,
+			mctp.req_handler.base.is_message_type_supported, &mctp.req_handler, 0,
+			MOCK_ARG (0x10 + i));
+		CuAssertIntEquals (test, 0, status);
+
+		status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertPtrEquals (test, NULL, tx);
+	}
+
+	/* Send a middle packet for each message in reverse order. */
+	for (i = MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i > 0; i--) {
+		mctp_interface_testing_build_request_packet (&rx, 0x20 + i - 1, 0x00, false, false, 1,
+			&data[i - 1][16], 16);
+
+		status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertPtrEquals (test, NULL, tx);
+	}
+
+	/* Complete each message. */
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		mctp_interface_testing_build_request_packet (&rx, 0x20 + i, 0x00, false, true, 2,
+			&data[i][32], 16);
+
+		mctp_interface_testing_expect_request_no_response (test, &mctp, data[i], sizeof (data[i]),
+			0x20 + i);
+
+		status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertPtrEquals (test, NULL, tx);
+	}
+
+	mctp_interface_testing_release (test, &mctp);
+}
+
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+static void mctp_interface_test_process_packet_interleaved_messages_evict_least_recently_used (
+	CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	uint8_t data[MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS][48];
+	uint8_t new_data[48];
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	size_t i;
+	size_t j;
+	int status;
+	struct debug_log_entry_info entry1 = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_INFO,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = MCTP_LOGGING_CHANNEL,
+		.arg1 = 0,
+		.arg2 = 0
+	};
+	struct debug_log_entry_info entry2 = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_ERROR,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = MCTP_LOGGING_RESTART_MESSAGE,
+		.arg1 = 0x21000111,
+		.arg2 = 0x30000130
+	};
+	struct debug_log_entry_info entry3 = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_ERROR,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = MCTP_LOGGING_PKT_DROPPED,
+		.arg1 = 0x01ab150f,
+		.arg2 = 0x1818210b
+	};
+	struct debug_log_entry_info entry4 = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_ERROR,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = MCTP_LOGGING_PROTOCOL_ERROR,
+		.arg1 = 0x01210b00,
+		.arg2 = MCTP_BASE_PROTOCOL_INVALID_EID
+	};
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		for (j = 0; j < sizeof (data[i]); j++) {
+			data[i][j] = i + j;
+		}
+
+		data[i][0] = 0x10 + i;
+	}
+
+	for (j = 0; j < sizeof (new_data); j++) {
+		new_data[j] = ~j;
+	}
+
+	new_data[0] = 0x30;
+
+	/* Use all available assembly contexts. */
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		mctp_interface_testing_build_request_packet (&rx, 0x20 + i, 0x00, true, false, 0, data[i],
+			16);
+
+		status = mock_expect (&mctp.req_handler.mock,
+			mctp.req_handler.base.is_message_type_supported, &mctp.req_handler, 0,
+			MOCK_ARG (0x10 + i));
+		CuAssertIntEquals (test, 0, status);
+
+		status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertPtrEquals (test, NULL, tx);
+	}
+
+	/* Continue the first message so the second message is the least recently used. */
+	mctp_interface_testing_build_request_packet (&rx, 0x20, 0x00, false, false, 1, &data[0][16],
+		16);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Start a message from a new endpoint. */
+	mctp_interface_testing_build_request_packet (&rx, 0x30, 0x00, true, false, 0, new_data, 16);
+
+	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.is_message_type_supported,
+		&mctp.req_handler, 0, MOCK_ARG (0x30));
+
+	status |= mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry1, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry1)));
+	status |= mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry2, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry2)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* The next packet for the discarded message is dropped. */
+	mctp_interface_testing_build_request_packet (&rx, 0x21, 0x00, false, false, 1, &data[1][16],
+		16);
+
+	status = mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry1, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry1)));
+	status |= mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry3, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry3)));
+	status |= mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry4, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry4)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Complete the first message. */
+	mctp_interface_testing_build_request_packet (&rx, 0x20, 0x00, false, true, 2, &data[0][32], 16);
+
+	mctp_interface_testing_expect_request_no_response (test, &mctp, data[0], sizeof (data[0]),
+		0x20);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* Complete the new message. */
+	mctp_interface_testing_build_request_packet (&rx, 0x30, 0x00, false, false, 1, &new_data[16],
+		16);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_build_request_packet (&rx, 0x30, 0x00, false, true, 2, &new_data[32],
+		16);
+
+	mctp_interface_testing_expect_request_no_response (test, &mctp, new_data, sizeof (new_data),
+		0x30);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_release (test, &mctp);
+}
+#endif
+
+static void mctp_interface_test_process_packet_assembly_timeout_not_reclaimed (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	uint8_t data[32];
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	for (i = 0; i < sizeof (data); i++) {
+		data[i] = i;
+	}
+
+	data[0] = 0x11;
+
+	mctp_interface_testing_build_request_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0x03, true,
+		false, 0, data, 16);
+
+	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.is_message_type_supported,
+		&mctp.req_handler, 0, MOCK_ARG (0x11));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	platform_msleep (MCTP_INTERFACE_ASSEMBLY_TIMEOUT_MS + 10);
+
+	/* The last packet arrives late, but the context was not needed for another message. */
+	mctp_interface_testing_build_request_packet (&rx, MCTP_BASE_PROTOCOL_BMC_EID, 0x03, false,
+		true, 1, &data[16], 16);
+
+	mctp_interface_testing_expect_request_no_response (test, &mctp, data, sizeof (data),
+		MCTP_BASE_PROTOCOL_BMC_EID);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_release (test, &mctp);
+}
+
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+static void mctp_interface_test_process_packet_assembly_timeout_reclaim_context (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	uint8_t data[MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS][32];
+	uint8_t new_data[32];
+	struct cmd_packet rx;
+	struct cmd_message *tx;
+	size_t i;
+	size_t j;
+	int status;
+	struct debug_log_entry_info entry1 = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_INFO,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = MCTP_LOGGING_CHANNEL,
+		.arg1 = 0,
+		.arg2 = 0
+	};
+	struct debug_log_entry_info entry2 = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_ERROR,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = MCTP_LOGGING_ASSEMBLY_TIMEOUT,
+		.arg1 = 0x20000110,
+		.arg2 = 16
+	};
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		for (j = 0; j < sizeof (data[i]); j++) {
+			data[i][j] = i + j;
+		}
+
+		data[i][0] = 0x10 + i;
+	}
+
+	for (j = 0; j < sizeof (new_data); j++) {
+		new_data[j] = ~j;
+	}
+
+	new_data[0] = 0x30;
+
+	/* Use all available assembly contexts. */
+	for (i = 0; i < MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS; i++) {
+		mctp_interface_testing_build_request_packet (&rx, 0x20 + i, 0x00, true, false, 0, data[i],
+			16);
+
+		status = mock_expect (&mctp.req_handler.mock,
+			mctp.req_handler.base.is_message_type_supported, &mctp.req_handler, 0,
+			MOCK_ARG (0x10 + i));
+		CuAssertIntEquals (test, 0, status);
+
+		status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertPtrEquals (test, NULL, tx);
+	}
+
+	platform_msleep (MCTP_INTERFACE_ASSEMBLY_TIMEOUT_MS + 10);
 
-	request.data = data;
-	request.length = sizeof (data);
-	request.payload = data;
-	request.payload_length = sizeof (data);
-	request.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
-	request.source_addr = 0x55;
-	request.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
-	request.is_encrypted = false;
-	request.crypto_timeout = false;
-	request.channel_id = 0;
-	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	/* Start a message from a new endpoint. */
+	mctp_interface_testing_build_request_packet (&rx, 0x30, 0x00, true, false, 0, new_data, 16);
 
-	memset (&response, 0, sizeof (response));
-	response.data = data;
-	response.length = 0;
-	response.payload = response.data;
-	response.payload_length = 0;
+	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.is_message_type_supported,
+		&mctp.req_handler, 0, MOCK_ARG (0x30));
 
-	status = mock_expect (&mctp.req_handler.mock, mctp.req_handler.base.base.process_request,
-		&mctp.req_handler, 0,
-		MOCK_ARG_VALIDATOR_DEEP_COPY (cmd_interface_mock_validate_request, &request,
-			sizeof (request), cmd_interface_mock_save_request, cmd_interface_mock_free_request));
-	status |= mock_expect_output_deep_copy (&mctp.req_handler.mock, 0, &response, sizeof (response),
-		cmd_interface_mock_copy_request);
+	status |= mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry1, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry1)));
+	status |= mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry2, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry2)));
+
+	CuAssertIntEquals (test, 0, status);
 
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
 	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_build_request_packet (&rx, 0x30, 0x00, false, true, 1, &new_data[16],
+		16);
+
+	mctp_interface_testing_expect_request_no_response (test, &mctp, new_data, sizeof (new_data),
+		0x30);
 
 	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
 	CuAssertIntEquals (test, 0, status);
@@ -5081,6 +5773,7 @@ static void mctp_interface_test_process_packet_different_src_eid (CuTest *test)
 
 	mctp_interface_testing_release (test, &mctp);
 }
+#endif
 
 static void mctp_interface_test_process_packet_incorrect_middle_packet_size (CuTest *test)
 {
@@ -10050,14 +10743,6 @@ static void mctp_interface_test_send_request_message_no_response_wait_then_anoth
 	struct cmd_interface_msg request;
 	struct cmd_interface_msg response;
 	int status;
-	struct debug_log_entry_info entry1 = {
-		.format = DEBUG_LOG_ENTRY_FORMAT,
-		.severity = DEBUG_LOG_SEVERITY_INFO,
-		.component = DEBUG_LOG_COMPONENT_MCTP,
-		.msg_index = MCTP_LOGGING_RSP_DROPPED,
-		.arg1 = MCTP_LOGGING_RSP_DROPPED_WRONG_TAG,
-		.arg2 = 0x010005
-	};
 
 	TEST_START;
 
@@ -10215,6 +10900,7 @@ static void mctp_interface_test_send_request_message_no_response_wait_then_anoth
 	rx_packet[1].dest_addr = 0x5D;
 	rx_packet[1].timeout_valid = false;
 
+	/* The response to the first request is still consumed, since that request is outstanding. */
 	context.expected_status = 0;
 	context.rsp_packet = rx_packet;
 	context.packet_count = 2;
@@ -10227,10 +10913,6 @@ static void mctp_interface_test_send_request_message_no_response_wait_then_anoth
 	status |= mock_expect_external_action (&mctp.channel.mock,
 		mctp_interface_testing_process_packet_callback, &context);
 
-	status = mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
-		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry1, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
-		MOCK_ARG (sizeof (entry1)));
-
 	CuAssertIntEquals (test, 0, status);
 
 	/* Prepare a response structure. */
@@ -10259,6 +10941,158 @@ static void mctp_interface_test_send_request_message_no_response_wait_then_anoth
 	mctp_interface_testing_release (test, &mctp);
 }
 
+static void mctp_interface_test_send_request_message_no_response_wait_multiple_outstanding_requests (
+	CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx_packet;
+	struct cmd_message *tx;
+	int i;
+	int status;
+	struct debug_log_entry_info entry = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_INFO,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = MCTP_LOGGING_RSP_DROPPED,
+		.arg1 = MCTP_LOGGING_RSP_DROPPED_UNEXPECTED,
+		.arg2 = 0
+	};
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+		mctp_interface_testing_send_request_no_wait (test, &mctp, i);
+	}
+
+	/* Responses are accepted in any order while the requests are outstanding. */
+	for (i = MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS - 1; i >= 0; i--) {
+		mctp_interface_testing_build_response_packet (&rx_packet, i);
+
+		status = mctp_interface_process_packet (&mctp.test, &rx_packet, &tx);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertPtrEquals (test, NULL, tx);
+	}
+
+	/* A second response for a completed request is dropped. */
+	status = mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry)));
+	CuAssertIntEquals (test, 0, status);
+
+	mctp_interface_testing_build_response_packet (&rx_packet, 0);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx_packet, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_release (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_message_no_response_wait_reclaim_oldest_request (
+	CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx_packet;
+	struct cmd_message *tx;
+	int i;
+	int status;
+	struct debug_log_entry_info entry = {
+		.format = DEBUG_LOG_ENTRY_FORMAT,
+		.severity = DEBUG_LOG_SEVERITY_INFO,
+		.component = DEBUG_LOG_COMPONENT_MCTP,
+		.msg_index = MCTP_LOGGING_RSP_DROPPED,
+		.arg1 = MCTP_LOGGING_RSP_DROPPED_WRONG_TAG,
+		.arg2 = (MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS << 16) | 0x0000
+	};
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	for (i = 0; i < MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+		mctp_interface_testing_send_request_no_wait (test, &mctp, i);
+	}
+
+	/* With all request contexts in use, the oldest request is no longer tracked. */
+	mctp_interface_testing_send_request_no_wait (test, &mctp,
+		MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS);
+
+	status = mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
+		MOCK_ARG (sizeof (entry)));
+	CuAssertIntEquals (test, 0, status);
+
+	mctp_interface_testing_build_response_packet (&rx_packet, 0);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx_packet, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	for (i = 1; i <= MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS; i++) {
+		mctp_interface_testing_build_response_packet (&rx_packet, i);
+
+		status = mctp_interface_process_packet (&mctp.test, &rx_packet, &tx);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertPtrEquals (test, NULL, tx);
+	}
+
+	mctp_interface_testing_release (test, &mctp);
+}
+
+static void mctp_interface_test_send_request_message_no_response_wait_skip_outstanding_msg_tag (
+	CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	struct cmd_packet rx_packet;
+	struct cmd_message *tx;
+	int status;
+
+	TEST_START;
+
+	mctp_interface_testing_init (test, &mctp);
+
+	mctp_interface_testing_send_request_no_wait (test, &mctp, 0);
+	mctp_interface_testing_send_request_no_wait (test, &mctp, 1);
+
+	/* Adjust internal state to make the next message tag collide with an outstanding request. */
+	mctp.state.next_msg_tag = 0;
+
+	mctp_interface_testing_send_request_no_wait (test, &mctp, 2);
+
+	mctp_interface_testing_build_response_packet (&rx_packet, 1);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx_packet, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	/* The tag for the completed request is available again. */
+	mctp.state.next_msg_tag = 0;
+
+	mctp_interface_testing_send_request_no_wait (test, &mctp, 1);
+
+	mctp_interface_testing_build_response_packet (&rx_packet, 0);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx_packet, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_build_response_packet (&rx_packet, 1);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx_packet, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_build_response_packet (&rx_packet, 2);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx_packet, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_release (test, &mctp);
+}
+
 static void mctp_interface_test_send_request_message_no_response_wait_then_another_request_wrap_tag (
 	CuTest *test)
 {
@@ -10272,14 +11106,6 @@ static void mctp_interface_test_send_request_message_no_response_wait_then_anoth
 	struct cmd_interface_msg request;
 	struct cmd_interface_msg response;
 	int status;
-	struct debug_log_entry_info entry1 = {
-		.format = DEBUG_LOG_ENTRY_FORMAT,
-		.severity = DEBUG_LOG_SEVERITY_INFO,
-		.component = DEBUG_LOG_COMPONENT_MCTP,
-		.msg_index = MCTP_LOGGING_RSP_DROPPED,
-		.arg1 = MCTP_LOGGING_RSP_DROPPED_WRONG_TAG,
-		.arg2 = 0x000700
-	};
 
 	TEST_START;
 
@@ -10438,6 +11264,7 @@ static void mctp_interface_test_send_request_message_no_response_wait_then_anoth
 	rx_packet[1].dest_addr = 0x5D;
 	rx_packet[1].timeout_valid = false;
 
+	/* The response to the first request is still consumed, since that request is outstanding. */
 	context.expected_status = 0;
 	context.rsp_packet = rx_packet;
 	context.packet_count = 2;
@@ -10450,10 +11277,6 @@ static void mctp_interface_test_send_request_message_no_response_wait_then_anoth
 	status |= mock_expect_external_action (&mctp.channel.mock,
 		mctp_interface_testing_process_packet_callback, &context);
 
-	status = mock_expect (&mctp.log.mock, mctp.log.base.create_entry, &mctp.log, 0,
-		MOCK_ARG_PTR_CONTAINS_TMP ((uint8_t*) &entry1, LOG_ENTRY_SIZE_TIME_FIELD_NOT_INCLUDED),
-		MOCK_ARG (sizeof (entry1)));
-
 	CuAssertIntEquals (test, 0, status);
 
 	/* Prepare a response structure. */
@@ -13437,6 +14260,90 @@ static void mctp_interface_test_issue_request_no_wait (CuTest *test)
 	mctp_interface_testing_release (test, &mctp);
 }
 
+static void mctp_interface_test_issue_request_no_wait_then_process_packet_response (CuTest *test)
+{
+	struct mctp_interface_testing mctp;
+	uint8_t buf[6] = {0};
+	uint8_t msg_buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN] = {0};
+	struct cmd_packet tx_packet;
+	struct cmd_packet rx;
+	struct mctp_base_protocol_transport_header *header;
+	struct cmd_message *tx;
+	uint8_t data[10];
+	struct cmd_interface_msg response;
+	int status;
+
+	TEST_START;
+
+	buf[0] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+
+	memset (&tx_packet, 0, sizeof (tx_packet));
+
+	header = (struct mctp_base_protocol_transport_header*) tx_packet.data;
+
+	header->cmd_code = SMBUS_CMD_CODE_MCTP;
+	header->byte_count = 11;
+	header->source_addr = 0xBB;
+	header->rsvd = 0;
+	header->header_version = 1;
+	header->destination_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	header->source_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	header->som = 1;
+	header->eom = 1;
+	header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
+	header->msg_tag = 0x00;
+	header->packet_seq = 0;
+
+	memcpy (&tx_packet.data[7], buf, sizeof (buf));
+
+	tx_packet.data[13] = checksum_crc8 (0xAA, tx_packet.data, 13);
+	tx_packet.pkt_size = 14;
+	tx_packet.state = CMD_VALID_PACKET;
+	tx_packet.dest_addr = 0x55;
+	tx_packet.timeout_valid = false;
+
+	mctp_interface_testing_build_response_packet (&rx, 0);
+
+	memset (&response, 0, sizeof (response));
+	response.data = data;
+	response.length = sizeof (data);
+	memcpy (response.data, &rx.data[7], response.length);
+	response.payload = data;
+	response.payload_length = sizeof (data);
+	response.source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	response.source_addr = 0x51;
+	response.target_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	response.is_encrypted = false;
+	response.crypto_timeout = false;
+	response.channel_id = 0;
+	response.max_response = 0;
+
+	mctp_interface_testing_init (test, &mctp);
+	debug_log = NULL;
+
+	status = mock_expect (&mctp.channel.mock, mctp.channel.base.send_packet, &mctp.channel, 0,
+		MOCK_ARG_VALIDATOR (cmd_channel_mock_validate_packet, &tx_packet, sizeof (tx_packet)));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_issue_request (&mctp.test, &mctp.channel.base, 0x55,
+		MCTP_BASE_PROTOCOL_BMC_EID, buf, sizeof (buf), msg_buf, sizeof (msg_buf), 0);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The response is still processed even though nothing waited for it. */
+	status = mock_expect (&mctp.cmd_cerberus.mock, mctp.cmd_cerberus.base.process_response,
+		&mctp.cmd_cerberus, 0, MOCK_ARG_VALIDATOR_DEEP_COPY (cmd_interface_mock_validate_request,
+			&response, sizeof (response), cmd_interface_mock_save_request,
+			cmd_interface_mock_free_request));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mctp_interface_process_packet (&mctp.test, &rx, &tx);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, NULL, tx);
+
+	mctp_interface_testing_release (test, &mctp);
+}
+
 static void mctp_interface_test_issue_request_no_response (CuTest *test)
 {
 	struct mctp_interface_testing mctp;
@@ -15617,6 +16524,18 @@ TEST (mctp_interface_test_process_packet_last_packet_no_som);
 TEST (mctp_interface_test_process_packet_incorrect_packet_seq);
 TEST (mctp_interface_test_process_packet_unexpected_msg_tag);
 TEST (mctp_interface_test_process_packet_different_src_eid);
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+TEST (mctp_interface_test_process_packet_interleaved_messages_different_src_eid);
+TEST (mctp_interface_test_process_packet_interleaved_messages_different_msg_tag);
+#endif
+TEST (mctp_interface_test_process_packet_interleaved_messages_max_contexts);
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+TEST (mctp_interface_test_process_packet_interleaved_messages_evict_least_recently_used);
+#endif
+TEST (mctp_interface_test_process_packet_assembly_timeout_not_reclaimed);
+#if MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS > 1
+TEST (mctp_interface_test_process_packet_assembly_timeout_reclaim_context);
+#endif
 TEST (mctp_interface_test_process_packet_incorrect_middle_packet_size);
 TEST (mctp_interface_test_process_packet_eom_larger_than_som);
 TEST (mctp_interface_test_process_packet_msg_overflow);
@@ -15669,6 +16588,9 @@ TEST (mctp_interface_test_send_request_message_no_response_wait_receive_response
 TEST (mctp_interface_test_send_request_message_no_response_wait_receive_response_drop_unexpected_response_msg_type);
 TEST (mctp_interface_test_send_request_message_no_response_wait_receive_response_drop_request_packet_no_som);
 TEST (mctp_interface_test_send_request_message_no_response_wait_then_another_request);
+TEST (mctp_interface_test_send_request_message_no_response_wait_multiple_outstanding_requests);
+TEST (mctp_interface_test_send_request_message_no_response_wait_reclaim_oldest_request);
+TEST (mctp_interface_test_send_request_message_no_response_wait_skip_outstanding_msg_tag);
 TEST (mctp_interface_test_send_request_message_no_response_wait_then_another_request_wrap_tag);
 TEST (mctp_interface_test_send_request_message_static_init);
 TEST (mctp_interface_test_send_request_message_null);
@@ -15697,6 +16619,7 @@ TEST (mctp_interface_test_send_discovery_notify_null);
 TEST (mctp_interface_test_send_discovery_notify_no_mctp_bridge);
 TEST (mctp_interface_test_send_discovery_notify_cmd_channel_fail);
 TEST (mctp_interface_test_issue_request_no_wait);
+TEST (mctp_interface_test_issue_request_no_wait_then_process_packet_response);
 TEST (mctp_interface_test_issue_request_no_response);
 TEST (mctp_interface_test_issue_request_state_clean_after_completion_no_response);
 TEST (mctp_interface_test_issue_request_multiple_packets_no_response);
@@ -0,0 +1,875 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "memory_mgmt/heap_tlsf.h"
+#include "memory_mgmt/heap_with_defrag.h"
+
+
+TEST_SUITE_LABEL ("heap_tlsf");
+
+
+static size_t heap[4096 / sizeof (size_t)];
+static struct heap_with_defrag_stats stats;
+
+/**
+ * Block size used by the heap for an allocation request.
+ *
+ * @param size The requested size.
+ */
+#define	heap_tlsf_testing_block_size(size)	\
+	(((size) + sizeof (void*) - 1) & ~(sizeof (void*) - 1))
+
+
+/**
+ * Heap operations for replaying an allocation trace.
+ */
+struct heap_tlsf_testing_trace_entry {
+	int alloc_index;	/**< Index of the allocation to allocate or free. */
+	size_t size;		/**< Size to allocate, or 0 to free the allocation. */
+};
+
+/**
+ * Allocation trace recorded from an SPDM attestation sequence with certificate chain and
+ * measurement processing.  The sizes are representative of X.509 parsing, hash contexts, and
+ * message buffers that are allocated and freed in an interleaved order.
+ */
+static const struct heap_tlsf_testing_trace_entry heap_tlsf_testing_trace[] = {
+	{0, 512}, {1, 64}, {2, 212}, {3, 48}, {4, 1024}, {1, 0}, {5, 36}, {6, 96}, {3, 0}, {7, 300},
+	{2, 0}, {8, 16}, {9, 140}, {6, 0}, {10, 72}, {4, 0}, {11, 640}, {12, 24}, {5, 0}, {13, 200},
+	{8, 0}, {14, 52}, {15, 128}, {9, 0}, {12, 0}, {16, 400}, {10, 0}, {17, 8}, {14, 0}, {18, 256},
+	{0, 0}, {19, 180}, {7, 0}, {20, 44}, {13, 0}, {21, 96}, {15, 0}, {17, 0}, {22, 720}, {11, 0},
+	{23, 60}, {16, 0}, {24, 32}, {19, 0}, {18, 0}, {25, 1000}, {20, 0}, {21, 0}, {23, 0}, {24, 0},
+	{22, 0}, {25, 0}
+};
+
+/**
+ * Number of distinct allocations in the trace.
+ */
+#define	HEAP_TLSF_TESTING_TRACE_ALLOCATIONS		26
+
+
+/**
+ * Helper function to verify heap allocator stats after all allocations have been freed.
+ *
+ * @param test The test framework
+ * @param heap_size Size of the heap to check
+ */
+static void heap_tlsf_testing_check_stats_empty (CuTest *test, size_t heap_size)
+{
+	int status;
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 0, stats.total_allocated_size);
+	CuAssertIntEquals (test, 0, stats.total_allocated_size_w_overhead);
+	CuAssertIntEquals (test, 1, stats.num_free_blocks);
+	CuAssertIntEquals (test, heap_size - (2 * HEAP_TLSF_BLOCK_HEADER_LEN), stats.total_free_size);
+	CuAssertIntEquals (test, heap_size - HEAP_TLSF_BLOCK_HEADER_LEN,
+		stats.total_free_size_w_overhead);
+	CuAssertIntEquals (test, stats.total_free_size, stats.largest_free_block);
+	CuAssertIntEquals (test, 0, stats.fragmentation);
+}
+
+/**
+ * Helper function to verify memory block contents
+ *
+ * @param test The test framework
+ * @param value Value memory block contents should all be at
+ * @param block Pointer to beginning of block
+ * @param size Size of memory block
+ */
+static void heap_tlsf_testing_check_value (CuTest *test, uint8_t value, uint8_t *block,
+	size_t size)
+{
+	for (size_t i = 0; i < size; ++i) {
+		CuAssertIntEquals (test, value, block[i]);
+	}
+}
+
+/*******************
+ * Test cases
+ *******************/
+
+static void heap_tlsf_test_init (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_init_unaligned (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (((uint8_t*) heap) + 1, sizeof (heap) - 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 1, stats.num_free_blocks);
+	CuAssertIntEquals (test, sizeof (heap) - sizeof (size_t) - (2 * HEAP_TLSF_BLOCK_HEADER_LEN),
+		stats.total_free_size);
+	CuAssertIntEquals (test, 0, (uintptr_t) heap_tlsf_allocate (1) % sizeof (void*));
+}
+
+static void heap_tlsf_test_init_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (NULL, sizeof (heap));
+	CuAssertIntEquals (test, HEAP_TLSF_INVALID_ARGUMENT, status);
+
+	status = heap_tlsf_init (heap, HEAP_TLSF_BLOCK_HEADER_LEN * 2);
+	CuAssertIntEquals (test, HEAP_TLSF_INVALID_ARGUMENT, status);
+}
+
+static void heap_tlsf_test_init_heap_too_large (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	/* The heap memory is never accessed when the size is checked. */
+	status = heap_tlsf_init (heap, (size_t) 1 << (HEAP_TLSF_FL_INDEX_MAX + 2));
+	CuAssertIntEquals (test, HEAP_TLSF_HEAP_TOO_LARGE, status);
+}
+
+static void heap_tlsf_test_init_heap_too_large_size_limit (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	/* The heap memory is never accessed when the size is checked. */
+	status = heap_tlsf_init (heap,
+		((size_t) 1 << HEAP_TLSF_FL_INDEX_MAX) + (HEAP_TLSF_BLOCK_HEADER_LEN * 2));
+	CuAssertIntEquals (test, HEAP_TLSF_HEAP_TOO_LARGE, status);
+
+	status = heap_tlsf_init (heap,
+		((size_t) 1 << HEAP_TLSF_FL_INDEX_MAX) + (HEAP_TLSF_BLOCK_HEADER_LEN * 2) + 4096);
+	CuAssertIntEquals (test, HEAP_TLSF_HEAP_TOO_LARGE, status);
+}
+
+static void heap_tlsf_test_init_max_heap_size (CuTest *test)
+{
+	size_t *max_heap;
+	size_t heap_len = ((size_t) 1 << HEAP_TLSF_FL_INDEX_MAX) - sizeof (void*) +
+		(HEAP_TLSF_BLOCK_HEADER_LEN * 2);
+	void *block;
+	int status;
+
+	TEST_START;
+
+	max_heap = platform_malloc (heap_len);
+	CuAssertPtrNotNull (test, max_heap);
+
+	status = heap_tlsf_init (max_heap, heap_len);
+	CuAssertIntEquals (test, 0, status);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 1, stats.num_free_blocks);
+	CuAssertIntEquals (test, ((size_t) 1 << HEAP_TLSF_FL_INDEX_MAX) - sizeof (void*),
+		stats.total_free_size);
+
+	/* The entire heap can be allocated as a single block. */
+	block = heap_tlsf_allocate (((size_t) 1 << HEAP_TLSF_FL_INDEX_MAX) - sizeof (void*));
+	CuAssertPtrNotNull (test, block);
+
+	heap_tlsf_free (block);
+
+	block = heap_tlsf_allocate ((size_t) 1 << HEAP_TLSF_FL_INDEX_MAX);
+	CuAssertPtrEquals (test, NULL, block);
+
+	heap_tlsf_testing_check_stats_empty (test, heap_len);
+
+	platform_free (max_heap);
+}
+
+static void heap_tlsf_test_allocate (CuTest *test)
+{
+	void *block;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block = heap_tlsf_allocate (64);
+	CuAssertPtrNotNull (test, block);
+
+	memset (block, 0xAA, 64);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 64, stats.total_allocated_size);
+	CuAssertIntEquals (test, 64 + HEAP_TLSF_BLOCK_HEADER_LEN,
+		stats.total_allocated_size_w_overhead);
+	CuAssertIntEquals (test, 1, stats.num_free_blocks);
+	CuAssertIntEquals (test, sizeof (heap) - HEAP_TLSF_BLOCK_HEADER_LEN,
+		stats.total_free_size_w_overhead + stats.total_allocated_size_w_overhead);
+
+	heap_tlsf_free (block);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_allocate_unaligned_size (CuTest *test)
+{
+	void *block1;
+	void *block2;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_tlsf_allocate (61);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_tlsf_allocate (3);
+	CuAssertPtrNotNull (test, block2);
+
+	CuAssertIntEquals (test, 0, (uintptr_t) block1 % sizeof (void*));
+	CuAssertIntEquals (test, 0, (uintptr_t) block2 % sizeof (void*));
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, heap_tlsf_testing_block_size (61) + (2 * sizeof (void*)),
+		stats.total_allocated_size);
+
+	heap_tlsf_free (block1);
+	heap_tlsf_free (block2);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_allocate_zero (CuTest *test)
+{
+	void *block;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block = heap_tlsf_allocate (0);
+	CuAssertPtrNotNull (test, block);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 2 * sizeof (void*), stats.total_allocated_size);
+
+	heap_tlsf_free (block);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_allocate_entire_heap (CuTest *test)
+{
+	void *block;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block = heap_tlsf_allocate (sizeof (heap) - (2 * HEAP_TLSF_BLOCK_HEADER_LEN));
+	CuAssertPtrNotNull (test, block);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 0, stats.num_free_blocks);
+	CuAssertIntEquals (test, 0, stats.largest_free_block);
+	CuAssertIntEquals (test, 0, stats.fragmentation);
+
+	CuAssertPtrEquals (test, NULL, heap_tlsf_allocate (0));
+
+	heap_tlsf_free (block);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_allocate_no_memory (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, NULL,
+		heap_tlsf_allocate (sizeof (heap) - (2 * HEAP_TLSF_BLOCK_HEADER_LEN) + 1));
+	CuAssertPtrEquals (test, NULL, heap_tlsf_allocate ((size_t) -1));
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_allocate_until_full (CuTest *test)
+{
+	void *block[128];
+	int count = 0;
+	int status;
+	int i;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	do {
+		block[count] = heap_tlsf_allocate (100);
+		if (block[count] != NULL) {
+			memset (block[count], count, 100);
+		}
+	} while ((block[count] != NULL) && (++count < 128));
+
+	CuAssertTrue (test, (count < 128));
+	CuAssertIntEquals (test, (sizeof (heap) - HEAP_TLSF_BLOCK_HEADER_LEN) /
+		(heap_tlsf_testing_block_size (100) + HEAP_TLSF_BLOCK_HEADER_LEN), count);
+
+	for (i = 0; i < count; i++) {
+		heap_tlsf_testing_check_value (test, i, block[i], 100);
+	}
+
+	/* Free every other block, then the rest, to exercise combining in both directions. */
+	for (i = 0; i < count; i += 2) {
+		heap_tlsf_free (block[i]);
+	}
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, count / 2, stats.num_allocated_blocks);
+	CuAssertTrue (test, (stats.fragmentation > 0));
+
+	for (i = 1; i < count; i += 2) {
+		heap_tlsf_free (block[i]);
+	}
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_allocate_reuse_free_block (CuTest *test)
+{
+	void *block1;
+	void *block2;
+	void *block3;
+	void *block4;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_tlsf_allocate (200);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_tlsf_allocate (200);
+	CuAssertPtrNotNull (test, block2);
+
+	block3 = heap_tlsf_allocate (200);
+	CuAssertPtrNotNull (test, block3);
+
+	memset (block1, 0xAA, 200);
+	memset (block3, 0xCC, 200);
+
+	heap_tlsf_free (block2);
+
+	/* An allocation that fits in the freed block uses it instead of splitting the larger block. */
+	block4 = heap_tlsf_allocate (200);
+	CuAssertPtrEquals (test, block2, block4);
+
+	heap_tlsf_testing_check_value (test, 0xAA, block1, 200);
+	heap_tlsf_testing_check_value (test, 0xCC, block3, 200);
+
+	heap_tlsf_free (block1);
+	heap_tlsf_free (block3);
+	heap_tlsf_free (block4);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_free_combine_free_blocks (CuTest *test)
+{
+	void *block1;
+	void *block2;
+	void *block3;
+	void *block4;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_tlsf_allocate (128);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_tlsf_allocate (128);
+	CuAssertPtrNotNull (test, block2);
+
+	block3 = heap_tlsf_allocate (128);
+	CuAssertPtrNotNull (test, block3);
+
+	block4 = heap_tlsf_allocate (128);
+	CuAssertPtrNotNull (test, block4);
+
+	heap_tlsf_free (block1);
+	heap_tlsf_free (block3);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 3, stats.num_free_blocks);
+
+	/* Freeing the block between two free blocks combines all three. */
+	heap_tlsf_free (block2);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+
+	/* The combined block can be used for a larger allocation. */
+	block1 = heap_tlsf_allocate ((128 * 3) + (HEAP_TLSF_BLOCK_HEADER_LEN * 2));
+	CuAssertPtrNotNull (test, block1);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 1, stats.num_free_blocks);
+
+	heap_tlsf_free (block4);
+	heap_tlsf_free (block1);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_allocate_zeroize (CuTest *test)
+{
+	uint8_t *block;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block);
+
+	memset (block, 0x55, 100);
+	heap_tlsf_free (block);
+
+	block = heap_tlsf_allocate_zeroize (10, 10);
+	CuAssertPtrNotNull (test, block);
+
+	heap_tlsf_testing_check_value (test, 0, block, 100);
+
+	heap_tlsf_free (block);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_allocate_zeroize_overflow (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, NULL, heap_tlsf_allocate_zeroize (((size_t) -1 / 2) + 2, 2));
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_reallocate_grow_in_place (CuTest *test)
+{
+	uint8_t *block;
+	uint8_t *new_block;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block);
+
+	memset (block, 0xAA, 100);
+
+	new_block = heap_tlsf_reallocate (block, 1000);
+	CuAssertPtrEquals (test, block, new_block);
+
+	heap_tlsf_testing_check_value (test, 0xAA, new_block, 100);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 1000, stats.total_allocated_size);
+	CuAssertIntEquals (test, 1, stats.num_free_blocks);
+
+	heap_tlsf_free (new_block);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_reallocate_grow_new_block (CuTest *test)
+{
+	uint8_t *block1;
+	uint8_t *block2;
+	uint8_t *new_block;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block2);
+
+	memset (block1, 0xAA, 100);
+
+	new_block = heap_tlsf_reallocate (block1, 1000);
+	CuAssertPtrNotNull (test, new_block);
+	CuAssertTrue (test, (block1 != new_block));
+
+	heap_tlsf_testing_check_value (test, 0xAA, new_block, 100);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, heap_tlsf_testing_block_size (100) + 1000,
+		stats.total_allocated_size);
+
+	heap_tlsf_free (new_block);
+	heap_tlsf_free (block2);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_reallocate_shrink (CuTest *test)
+{
+	uint8_t *block1;
+	uint8_t *block2;
+	uint8_t *new_block;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_tlsf_allocate (1000);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block2);
+
+	memset (block1, 0xAA, 1000);
+
+	new_block = heap_tlsf_reallocate (block1, 100);
+	CuAssertPtrEquals (test, block1, new_block);
+
+	heap_tlsf_testing_check_value (test, 0xAA, new_block, 100);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, heap_tlsf_testing_block_size (100) * 2, stats.total_allocated_size);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+
+	heap_tlsf_free (new_block);
+	heap_tlsf_free (block2);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_reallocate_null_ptr (CuTest *test)
+{
+	void *block;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block = heap_tlsf_reallocate (NULL, 100);
+	CuAssertPtrNotNull (test, block);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, heap_tlsf_testing_block_size (100), stats.total_allocated_size);
+
+	heap_tlsf_free (block);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_reallocate_no_memory (CuTest *test)
+{
+	uint8_t *block1;
+	uint8_t *block2;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block2);
+
+	memset (block1, 0xAA, 100);
+
+	CuAssertPtrEquals (test, NULL, heap_tlsf_reallocate (block1, sizeof (heap)));
+
+	heap_tlsf_testing_check_value (test, 0xAA, block1, 100);
+
+	heap_tlsf_free (block1);
+	heap_tlsf_free (block2);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_free_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	heap_tlsf_free (NULL);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_free_twice (CuTest *test)
+{
+	void *block1;
+	void *block2;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_tlsf_allocate (100);
+	CuAssertPtrNotNull (test, block2);
+
+	heap_tlsf_free (block1);
+	heap_tlsf_free (block1);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+
+	heap_tlsf_free (block2);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_free_outside_heap (CuTest *test)
+{
+	uint8_t other[64];
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	heap_tlsf_free (&other[32]);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_replay_trace (CuTest *test)
+{
+	void *tlsf[HEAP_TLSF_TESTING_TRACE_ALLOCATIONS];
+	void *defrag[HEAP_TLSF_TESTING_TRACE_ALLOCATIONS];
+	static uint8_t defrag_heap[sizeof (heap)];
+	struct heap_with_defrag_stats defrag_stats;
+	size_t size[HEAP_TLSF_TESTING_TRACE_ALLOCATIONS];
+	const struct heap_tlsf_testing_trace_entry *entry;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	status = heap_with_defrag_init (defrag_heap, sizeof (defrag_heap));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Drive both allocators with the same trace.  Each allocation is filled with a pattern that must
+	 * be intact when it gets freed. */
+	for (i = 0; i < (sizeof (heap_tlsf_testing_trace) / sizeof (heap_tlsf_testing_trace[0]));
+		i++) {
+		entry = &heap_tlsf_testing_trace[i];
+
+		if (entry->size != 0) {
+			tlsf[entry->alloc_index] = heap_tlsf_allocate (entry->size);
+			CuAssertPtrNotNull (test, tlsf[entry->alloc_index]);
+
+			defrag[entry->alloc_index] = heap_with_defrag_allocate (entry->size);
+			CuAssertPtrNotNull (test, defrag[entry->alloc_index]);
+
+			size[entry->alloc_index] = entry->size;
+			memset (tlsf[entry->alloc_index], entry->alloc_index, entry->size);
+			memset (defrag[entry->alloc_index], entry->alloc_index, entry->size);
+		}
+		else {
+			heap_tlsf_testing_check_value (test, entry->alloc_index, tlsf[entry->alloc_index],
+				size[entry->alloc_index]);
+			heap_tlsf_testing_check_value (test, entry->alloc_index, defrag[entry->alloc_index],
+				size[entry->alloc_index]);
+
+			heap_tlsf_free (tlsf[entry->alloc_index]);
+			heap_with_defrag_free (defrag[entry->alloc_index]);
+		}
+
+		status = heap_tlsf_get_stats (&stats);
+		CuAssertIntEquals (test, 0, status);
+
+		status = heap_with_defrag_get_stats (&defrag_stats);
+		CuAssertIntEquals (test, 0, status);
+
+		CuAssertIntEquals (test, defrag_stats.num_allocated_blocks, stats.num_allocated_blocks);
+		CuAssertTrue (test, (stats.largest_free_block <= stats.total_free_size));
+	}
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+
+	status = heap_with_defrag_get_stats (&defrag_stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, defrag_stats.num_allocated_blocks);
+	CuAssertIntEquals (test, 1, defrag_stats.num_free_blocks);
+}
+
+static void heap_tlsf_test_get_stats_fragmentation (CuTest *test)
+{
+	void *block1;
+	void *block2;
+	void *block3;
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	block1 = heap_tlsf_allocate (1200);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_tlsf_allocate (1200);
+	CuAssertPtrNotNull (test, block2);
+
+	block3 = heap_tlsf_allocate (1200);
+	CuAssertPtrNotNull (test, block3);
+
+	heap_tlsf_free (block2);
+
+	status = heap_tlsf_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+	CuAssertIntEquals (test, 1200, stats.largest_free_block);
+	CuAssertIntEquals (test, 100 - ((1200 * 100) / stats.total_free_size), stats.fragmentation);
+
+	heap_tlsf_free (block1);
+	heap_tlsf_free (block3);
+
+	heap_tlsf_testing_check_stats_empty (test, sizeof (heap));
+}
+
+static void heap_tlsf_test_get_stats_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = heap_tlsf_get_stats (NULL);
+	CuAssertIntEquals (test, HEAP_TLSF_INVALID_ARGUMENT, status);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (heap_tlsf);
+
+TEST (heap_tlsf_test_init);
+TEST (heap_tlsf_test_init_unaligned);
+TEST (heap_tlsf_test_init_null);
+TEST (heap_tlsf_test_init_heap_too_large);
+TEST (heap_tlsf_test_init_heap_too_large_size_limit);
+TEST (heap_tlsf_test_init_max_heap_size);
+TEST (heap_tlsf_test_allocate);
+TEST (heap_tlsf_test_allocate_unaligned_size);
+TEST (heap_tlsf_test_allocate_zero);
+TEST (heap_tlsf_test_allocate_entire_heap);
+TEST (heap_tlsf_test_allocate_no_memory);
+TEST (heap_tlsf_test_allocate_until_full);
+TEST (heap_tlsf_test_allocate_reuse_free_block);
+TEST (heap_tlsf_test_free_combine_free_blocks);
+TEST (heap_tlsf_test_allocate_zeroize);
+TEST (heap_tlsf_test_allocate_zeroize_overflow);
+TEST (heap_tlsf_test_reallocate_grow_in_place);
+TEST (heap_tlsf_test_reallocate_grow_new_block);
+TEST (heap_tlsf_test_reallocate_shrink);
+TEST (heap_tlsf_test_reallocate_null_ptr);
+TEST (heap_tlsf_test_reallocate_no_memory);
+TEST (heap_tlsf_test_free_null);
+TEST (heap_tlsf_test_free_twice);
+TEST (heap_tlsf_test_free_outside_heap);
+TEST (heap_tlsf_test_replay_trace);
+TEST (heap_tlsf_test_get_stats_fragmentation);
+TEST (heap_tlsf_test_get_stats_null);
+
+TEST_SUITE_END;
+// *INDENT-ON*
@@ -3561,6 +3561,46 @@ static void heap_with_defrag_test_free_null (CuTest *test)
 	heap_with_defrag_testing_check_stats_constant_size_alloc (test, 1, 4);
 }
 
+static void heap_with_defrag_test_get_stats_fragmentation (CuTest *test)
+{
+	void *block1;
+	void *block2;
+	void *block3;
+	int status;
+
+	TEST_START;
+
+	status = heap_with_defrag_init (heap, sizeof (heap));
+	CuAssertIntEquals (test, 0, status);
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, stats.total_free_size, stats.largest_free_block);
+	CuAssertIntEquals (test, 0, stats.fragmentation);
+
+	block1 = heap_with_defrag_allocate (1200);
+	CuAssertPtrNotNull (test, block1);
+
+	block2 = heap_with_defrag_allocate (1200);
+	CuAssertPtrNotNull (test, block2);
+
+	block3 = heap_with_defrag_allocate (1200);
+	CuAssertPtrNotNull (test, block3);
+
+	heap_with_defrag_free (block2);
+
+	status = heap_with_defrag_get_stats (&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_free_blocks);
+	CuAssertIntEquals (test, 1200, stats.largest_free_block);
+	CuAssertIntEquals (test, 100 - ((1200 * 100) / stats.total_free_size), stats.fragmentation);
+
+	heap_with_defrag_free (block1);
+	heap_with_defrag_free (block3);
+
+	heap_with_defrag_testing_check_stats_empty (test, sizeof (heap));
+}
+
 static void heap_with_defrag_test_get_stats_null (CuTest *test)
 {
 	int status;
@@ -3633,6 +3673,7 @@ TEST (heap_with_defrag_test_reallocate_zero_new_and_old_size);
 TEST (heap_with_defrag_test_reallocate_null_ptr);
 TEST (heap_with_defrag_test_free);
 TEST (heap_with_defrag_test_free_null);
+TEST (heap_with_defrag_test_get_stats_fragmentation);
 TEST (heap_with_defrag_test_get_stats_null);
 
 TEST_SUITE_END;
@@ -21,12 +21,24 @@ static void add_all_memory_mgmt_tests (CuSuite *suite)
 	/* This is unused when no tests will be executed. */
 	UNUSED (suite);
 
+#if (defined TESTING_RUN_HEAP_TLSF_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_HEAP_TLSF_SUITE
+	TESTING_RUN_SUITE (heap_tlsf);
+#endif
 #if (defined TESTING_RUN_HEAP_WITH_DEFRAG_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
 	!defined TESTING_SKIP_HEAP_WITH_DEFRAG_SUITE
 	TESTING_RUN_SUITE (heap_with_defrag);
 #endif
+#if (defined TESTING_RUN_OBJECT_POOL_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_OBJECT_POOL_SUITE
+	TESTING_RUN_SUITE (object_pool);
+#endif
 }
 
 
@@ -0,0 +1,402 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "memory_mgmt/object_pool.h"
+
+
+TEST_SUITE_LABEL ("object_pool");
+
+
+/**
+ * Object type used for testing pools.
+ */
+struct object_pool_testing_object {
+	uint32_t id;		/**< Identifier for the object. */
+	uint8_t data[20];	/**< Object data. */
+};
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void object_pool_test_init (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 4)];
+	struct object_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (struct object_pool_testing_object), stats.object_size);
+	CuAssertIntEquals (test, 4, stats.num_objects);
+	CuAssertIntEquals (test, 0, stats.num_allocated);
+	CuAssertIntEquals (test, 0, stats.peak_allocated);
+	CuAssertIntEquals (test, 0, stats.total_allocations);
+	CuAssertIntEquals (test, 0, stats.failed_allocations);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_init_small_object (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (1, 8)];
+	struct object_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage), 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (void*), stats.object_size);
+	CuAssertIntEquals (test, 8, stats.num_objects);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_init_unaligned_storage (CuTest *test)
+{
+	struct object_pool pool;
+	void *storage[9];
+	struct object_pool_stats stats;
+	void *object;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, ((uint8_t*) storage) + 1, sizeof (storage) - 1,
+		sizeof (void*) * 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 4, stats.num_objects);
+
+	object = object_pool_allocate (&pool);
+	CuAssertPtrEquals (test, &storage[1], object);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_init_null (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 4)];
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (NULL, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init (&pool, NULL, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_init (&pool, storage, sizeof (storage), 0);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+}
+
+static void object_pool_test_init_storage_too_small (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 1)];
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage) - 1,
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, OBJECT_POOL_STORAGE_TOO_SMALL, status);
+}
+
+static void object_pool_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	object_pool_release (NULL);
+}
+
+static void object_pool_test_allocate (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 4)];
+	struct object_pool_stats stats;
+	struct object_pool_testing_object *object[4];
+	int status;
+	int i;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 4; i++) {
+		object[i] = object_pool_allocate (&pool);
+		CuAssertPtrNotNull (test, object[i]);
+
+		object[i]->id = i;
+		memset (object[i]->data, i, sizeof (object[i]->data));
+	}
+
+	/* Objects are allocated in order from the pool storage. */
+	CuAssertPtrEquals (test, storage, object[0]);
+	CuAssertPtrEquals (test, &storage[sizeof (struct object_pool_testing_object) * 3], object[3]);
+
+	for (i = 0; i < 4; i++) {
+		CuAssertIntEquals (test, i, object[i]->id);
+		CuAssertIntEquals (test, i, object[i]->data[0]);
+		CuAssertIntEquals (test, i, object[i]->data[sizeof (object[i]->data) - 1]);
+	}
+
+	status = object_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 4, stats.num_allocated);
+	CuAssertIntEquals (test, 4, stats.peak_allocated);
+	CuAssertIntEquals (test, 4, stats.total_allocations);
+	CuAssertIntEquals (test, 0, stats.failed_allocations);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_allocate_empty (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 2)];
+	struct object_pool_stats stats;
+	void *object[2];
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, 0, status);
+
+	object[0] = object_pool_allocate (&pool);
+	CuAssertPtrNotNull (test, object[0]);
+
+	object[1] = object_pool_allocate (&pool);
+	CuAssertPtrNotNull (test, object[1]);
+
+	CuAssertPtrEquals (test, NULL, object_pool_allocate (&pool));
+	CuAssertPtrEquals (test, NULL, object_pool_allocate_zeroize (&pool));
+
+	status = object_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated);
+	CuAssertIntEquals (test, 2, stats.total_allocations);
+	CuAssertIntEquals (test, 2, stats.failed_allocations);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_allocate_null (CuTest *test)
+{
+	TEST_START;
+
+	CuAssertPtrEquals (test, NULL, object_pool_allocate (NULL));
+	CuAssertPtrEquals (test, NULL, object_pool_allocate_zeroize (NULL));
+}
+
+static void object_pool_test_allocate_zeroize (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 1)];
+	struct object_pool_testing_object zero;
+	struct object_pool_testing_object *object;
+	int status;
+
+	TEST_START;
+
+	memset (&zero, 0, sizeof (zero));
+	memset (storage, 0x55, sizeof (storage));
+
+	status = object_pool_init (&pool, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, 0, status);
+
+	object = object_pool_allocate_zeroize (&pool);
+	CuAssertPtrNotNull (test, object);
+
+	status = testing_validate_array (&zero, object, sizeof (zero));
+	CuAssertIntEquals (test, 0, status);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_free (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 4)];
+	struct object_pool_stats stats;
+	void *object[4];
+	void *reused;
+	int status;
+	int i;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 4; i++) {
+		object[i] = object_pool_allocate (&pool);
+		CuAssertPtrNotNull (test, object[i]);
+	}
+
+	status = object_pool_free (&pool, object[2]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_free (&pool, object[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.num_allocated);
+	CuAssertIntEquals (test, 4, stats.peak_allocated);
+
+	/* The most recently freed object is reused first. */
+	reused = object_pool_allocate (&pool);
+	CuAssertPtrEquals (test, object[0], reused);
+
+	reused = object_pool_allocate (&pool);
+	CuAssertPtrEquals (test, object[2], reused);
+
+	CuAssertPtrEquals (test, NULL, object_pool_allocate (&pool));
+
+	for (i = 0; i < 4; i++) {
+		status = object_pool_free (&pool, object[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = object_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.num_allocated);
+	CuAssertIntEquals (test, 4, stats.peak_allocated);
+	CuAssertIntEquals (test, 6, stats.total_allocations);
+	CuAssertIntEquals (test, 1, stats.failed_allocations);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_free_null (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 4)];
+	void *object;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, 0, status);
+
+	object = object_pool_allocate (&pool);
+	CuAssertPtrNotNull (test, object);
+
+	status = object_pool_free (NULL, object);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_free (&pool, NULL);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_free_not_pool_object (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 4)];
+	struct object_pool_testing_object other;
+	struct object_pool_stats stats;
+	uint8_t *object;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, 0, status);
+
+	object = object_pool_allocate (&pool);
+	CuAssertPtrNotNull (test, object);
+
+	status = object_pool_free (&pool, &other);
+	CuAssertIntEquals (test, OBJECT_POOL_NOT_POOL_OBJECT, status);
+
+	status = object_pool_free (&pool, object + 1);
+	CuAssertIntEquals (test, OBJECT_POOL_NOT_POOL_OBJECT, status);
+
+	status = object_pool_free (&pool, &storage[sizeof (storage)]);
+	CuAssertIntEquals (test, OBJECT_POOL_NOT_POOL_OBJECT, status);
+
+	status = object_pool_get_stats (&pool, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.num_allocated);
+
+	object_pool_release (&pool);
+}
+
+static void object_pool_test_get_stats_null (CuTest *test)
+{
+	struct object_pool pool;
+	uint8_t storage[OBJECT_POOL_STORAGE_LEN (sizeof (struct object_pool_testing_object), 4)];
+	struct object_pool_stats stats;
+	int status;
+
+	TEST_START;
+
+	status = object_pool_init (&pool, storage, sizeof (storage),
+		sizeof (struct object_pool_testing_object));
+	CuAssertIntEquals (test, 0, status);
+
+	status = object_pool_get_stats (NULL, &stats);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	status = object_pool_get_stats (&pool, NULL);
+	CuAssertIntEquals (test, OBJECT_POOL_INVALID_ARGUMENT, status);
+
+	object_pool_release (&pool);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (object_pool);
+
+TEST (object_pool_test_init);
+TEST (object_pool_test_init_small_object);
+TEST (object_pool_test_init_unaligned_storage);
+TEST (object_pool_test_init_null);
+TEST (object_pool_test_init_storage_too_small);
+TEST (object_pool_test_release_null);
+TEST (object_pool_test_allocate);
+TEST (object_pool_test_allocate_empty);
+TEST (object_pool_test_allocate_null);
+TEST (object_pool_test_allocate_zeroize);
+TEST (object_pool_test_free);
+TEST (object_pool_test_free_null);
+TEST (object_pool_test_free_not_pool_object);
+TEST (object_pool_test_get_stats_null);
+
+TEST_SUITE_END;
+// *INDENT-ON*
@@ -101,6 +101,33 @@ static int cmd_background_mock_get_riot_cert_chain_state (const struct cmd_backg
 	MOCK_RETURN_NO_ARGS (&mock->mock, cmd_background_mock_get_riot_cert_chain_state, cmd);
 }
 
+static int cmd_background_mock_alias_sign_start (const struct cmd_background *cmd,
+	struct ecc_engine *ecc, const uint8_t *digest, size_t length)
+{
+	struct cmd_background_mock *mock = (struct cmd_background_mock*) cmd;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, cmd_background_mock_alias_sign_start, cmd, MOCK_ARG_PTR_CALL (ecc),
+		MOCK_ARG_PTR_CALL (digest), MOCK_ARG_CALL (length));
+}
+
+static int cmd_background_mock_alias_sign_result (const struct cmd_background *cmd,
+	uint8_t *signature, size_t *sig_length, uint32_t *sign_status, uint32_t *sign_time)
+{
+	struct cmd_background_mock *mock = (struct cmd_background_mock*) cmd;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, cmd_background_mock_alias_sign_result, cmd,
+		MOCK_ARG_PTR_CALL (signature), MOCK_ARG_PTR_CALL (sig_length),
+		MOCK_ARG_PTR_CALL (sign_status), MOCK_ARG_PTR_CALL (sign_time));
+}
+
 static int cmd_background_mock_reboot_device (const struct cmd_background *cmd)
 {
 	struct cmd_background_mock *mock = (struct cmd_background_mock*) cmd;
@@ -114,9 +141,13 @@ static int cmd_background_mock_reboot_device (const struct cmd_background *cmd)
 
 static int cmd_background_mock_func_arg_count (void *func)
 {
-	if (func == cmd_background_mock_unseal_result) {
+	if ((func == cmd_background_mock_unseal_result) ||
+		(func == cmd_background_mock_alias_sign_start)) {
 		return 3;
 	}
+	else if (func == cmd_background_mock_alias_sign_result) {
+		return 4;
+	}
 	else if (func == cmd_background_mock_unseal_start) {
 		return 2;
 	}
@@ -154,6 +185,12 @@ static const char* cmd_background_mock_func_name_map (void *func)
 	else if (func == cmd_background_mock_get_riot_cert_chain_state) {
 		return "get_riot_cert_chain_state";
 	}
+	else if (func == cmd_background_mock_alias_sign_start) {
+		return "alias_sign_start";
+	}
+	else if (func == cmd_background_mock_alias_sign_result) {
+		return "alias_sign_result";
+	}
 	else if (func == cmd_background_mock_reboot_device) {
 		return "reboot_device";
 	}
@@ -191,6 +228,33 @@ static const char* cmd_background_mock_arg_name_map (void *func, int arg)
 				return "execution";
 		}
 	}
+	else if (func == cmd_background_mock_alias_sign_start) {
+		switch (arg) {
+			case 0:
+				return "ecc";
+
+			case 1:
+				return "digest";
+
+			case 2:
+				return "length";
+		}
+	}
+	else if (func == cmd_background_mock_alias_sign_result) {
+		switch (arg) {
+			case 0:
+				return "signature";
+
+			case 1:
+				return "sig_length";
+
+			case 2:
+				return "sign_status";
+
+			case 3:
+				return "sign_time";
+		}
+	}
 
 	return "unknown";
 }
@@ -228,6 +292,8 @@ int cmd_background_mock_init (struct cmd_background_mock *mock)
 	mock->base.debug_log_fill = cmd_background_mock_debug_log_fill;
 	mock->base.authenticate_riot_certs = cmd_background_mock_authenticate_riot_certs;
 	mock->base.get_riot_cert_chain_state = cmd_background_mock_get_riot_cert_chain_state;
+	mock->base.alias_sign_start = cmd_background_mock_alias_sign_start;
+	mock->base.alias_sign_result = cmd_background_mock_alias_sign_result;
 	mock->base.reboot_device = cmd_background_mock_reboot_device;
 
 	mock->mock.func_arg_count = cmd_background_mock_func_arg_count;
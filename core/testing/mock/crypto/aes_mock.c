@@ -86,6 +86,90 @@ static int aes_mock_decrypt_with_add_data (struct aes_engine *engine, const uint
 		MOCK_ARG_CALL (out_length));
 }
 
+static int aes_mock_start_encrypt (struct aes_engine *engine, const uint8_t *iv, size_t iv_length)
+{
+	struct aes_engine_mock *mock = (struct aes_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, aes_mock_start_encrypt, engine, MOCK_ARG_PTR_CALL (iv),
+		MOCK_ARG_CALL (iv_length));
+}
+
+static int aes_mock_start_decrypt (struct aes_engine *engine, const uint8_t *iv, size_t iv_length)
+{
+	struct aes_engine_mock *mock = (struct aes_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, aes_mock_start_decrypt, engine, MOCK_ARG_PTR_CALL (iv),
+		MOCK_ARG_CALL (iv_length));
+}
+
+static int aes_mock_update_add_data (struct aes_engine *engine, const uint8_t *additional_data,
+	size_t length)
+{
+	struct aes_engine_mock *mock = (struct aes_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, aes_mock_update_add_data, engine,
+		MOCK_ARG_PTR_CALL (additional_data), MOCK_ARG_CALL (length));
+}
+
+static int aes_mock_update (struct aes_engine *engine, const uint8_t *input, size_t length,
+	uint8_t *output, size_t out_length)
+{
+	struct aes_engine_mock *mock = (struct aes_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, aes_mock_update, engine, MOCK_ARG_PTR_CALL (input),
+		MOCK_ARG_CALL (length), MOCK_ARG_PTR_CALL (output), MOCK_ARG_CALL (out_length));
+}
+
+static int aes_mock_finish_encrypt (struct aes_engine *engine, uint8_t *tag, size_t tag_length)
+{
+	struct aes_engine_mock *mock = (struct aes_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, aes_mock_finish_encrypt, engine, MOCK_ARG_PTR_CALL (tag),
+		MOCK_ARG_CALL (tag_length));
+}
+
+static int aes_mock_finish_decrypt (struct aes_engine *engine, const uint8_t *tag)
+{
+	struct aes_engine_mock *mock = (struct aes_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, aes_mock_finish_decrypt, engine, MOCK_ARG_PTR_CALL (tag));
+}
+
+static void aes_mock_cancel (struct aes_engine *engine)
+{
+	struct aes_engine_mock *mock = (struct aes_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return;
+	}
+
+	MOCK_VOID_RETURN_NO_ARGS (&mock->mock, aes_mock_cancel, engine);
+}
+
 static int aes_mock_func_arg_count (void *func)
 {
 	if (func == aes_mock_encrypt_data) {
@@ -103,6 +187,16 @@ static int aes_mock_func_arg_count (void *func)
 	else if (func == aes_mock_set_key) {
 		return 2;
 	}
+	else if ((func == aes_mock_start_encrypt) || (func == aes_mock_start_decrypt) ||
+		(func == aes_mock_update_add_data) || (func == aes_mock_finish_encrypt)) {
+		return 2;
+	}
+	else if (func == aes_mock_update) {
+		return 4;
+	}
+	else if (func == aes_mock_finish_decrypt) {
+		return 1;
+	}
 	else {
 		return 0;
 	}
@@ -125,6 +219,27 @@ static const char* aes_mock_func_name_map (void *func)
 	else if (func == aes_mock_decrypt_with_add_data) {
 		return "decrypt_with_add_data";
 	}
+	else if (func == aes_mock_start_encrypt) {
+		return "start_encrypt";
+	}
+	else if (func == aes_mock_start_decrypt) {
+		return "start_decrypt";
+	}
+	else if (func == aes_mock_update_add_data) {
+		return "update_add_data";
+	}
+	else if (func == aes_mock_update) {
+		return "update";
+	}
+	else if (func == aes_mock_finish_encrypt) {
+		return "finish_encrypt";
+	}
+	else if (func == aes_mock_finish_decrypt) {
+		return "finish_decrypt";
+	}
+	else if (func == aes_mock_cancel) {
+		return "cancel";
+	}
 	else {
 		return "unknown";
 	}
@@ -255,6 +370,54 @@ static const char* aes_mock_arg_name_map (void *func, int arg)
 				return "out_length";
 		}
 	}
+	else if ((func == aes_mock_start_encrypt) || (func == aes_mock_start_decrypt)) {
+		switch (arg) {
+			case 0:
+				return "iv";
+
+			case 1:
+				return "iv_length";
+		}
+	}
+	else if (func == aes_mock_update_add_data) {
+		switch (arg) {
+			case 0:
+				return "additional_data";
+
+			case 1:
+				return "length";
+		}
+	}
+	else if (func == aes_mock_update) {
+		switch (arg) {
+			case 0:
+				return "input";
+
+			case 1:
+				return "length";
+
+			case 2:
+				return "output";
+
+			case 3:
+				return "out_length";
+		}
+	}
+	else if (func == aes_mock_finish_encrypt) {
+		switch (arg) {
+			case 0:
+				return "tag";
+
+			case 1:
+				return "tag_length";
+		}
+	}
+	else if (func == aes_mock_finish_decrypt) {
+		switch (arg) {
+			case 0:
+				return "tag";
+		}
+	}
 
 	return "unknown";
 }
@@ -288,6 +451,13 @@ int aes_mock_init (struct aes_engine_mock *mock)
 	mock->base.decrypt_data = aes_mock_decrypt_data;
 	mock->base.encrypt_with_add_data = aes_mock_encrypt_with_add_data;
 	mock->base.decrypt_with_add_data = aes_mock_decrypt_with_add_data;
+	mock->base.start_encrypt = aes_mock_start_encrypt;
+	mock->base.start_decrypt = aes_mock_start_decrypt;
+	mock->base.update_add_data = aes_mock_update_add_data;
+	mock->base.update = aes_mock_update;
+	mock->base.finish_encrypt = aes_mock_finish_encrypt;
+	mock->base.finish_decrypt = aes_mock_finish_decrypt;
+	mock->base.cancel = aes_mock_cancel;
 
 	mock->mock.func_arg_count = aes_mock_func_arg_count;
 	mock->mock.func_name_map = aes_mock_func_name_map;
@@ -150,6 +150,29 @@ static int hash_mock_get_hash (struct hash_engine *engine, uint8_t *hash, size_t
 		MOCK_ARG_CALL (hash_length));
 }
 
+static int hash_mock_save_context (struct hash_engine *engine, struct hash_context *context)
+{
+	struct hash_engine_mock *mock = (struct hash_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, hash_mock_save_context, engine, MOCK_ARG_PTR_CALL (context));
+}
+
+static int hash_mock_restore_context (struct hash_engine *engine,
+	const struct hash_context *context)
+{
+	struct hash_engine_mock *mock = (struct hash_engine_mock*) engine;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, hash_mock_restore_context, engine, MOCK_ARG_PTR_CALL (context));
+}
+
 static int hash_mock_func_arg_count (void *func)
 {
 	if ((func == hash_mock_calculate_sha1) || (func == hash_mock_calculate_sha256) ||
@@ -160,6 +183,9 @@ static int hash_mock_func_arg_count (void *func)
 		(func == hash_mock_get_hash)) {
 		return 2;
 	}
+	else if ((func == hash_mock_save_context) || (func == hash_mock_restore_context)) {
+		return 1;
+	}
 	else {
 		return 0;
 	}
@@ -203,6 +229,12 @@ static const char* hash_mock_func_name_map (void *func)
 	else if (func == hash_mock_get_hash) {
 		return "get_hash";
 	}
+	else if (func == hash_mock_save_context) {
+		return "save_context";
+	}
+	else if (func == hash_mock_restore_context) {
+		return "restore_context";
+	}
 	else {
 		return "unknown";
 	}
@@ -288,6 +320,12 @@ static const char* hash_mock_arg_name_map (void *func, int arg)
 				return "hash_length";
 		}
 	}
+	else if ((func == hash_mock_save_context) || (func == hash_mock_restore_context)) {
+		switch (arg) {
+			case 0:
+				return "context";
+		}
+	}
 
 	return "unknown";
 }
@@ -334,6 +372,8 @@ int hash_mock_init (struct hash_engine_mock *mock)
 	mock->base.finish = hash_mock_finish;
 	mock->base.cancel = hash_mock_cancel;
 	mock->base.get_hash = hash_mock_get_hash;
+	mock->base.save_context = hash_mock_save_context;
+	mock->base.restore_context = hash_mock_restore_context;
 
 	mock->mock.func_arg_count = hash_mock_func_arg_count;
 	mock->mock.func_name_map = hash_mock_func_name_map;
@@ -351,6 +351,24 @@ int flash_mock_expect_blank_check (struct flash_mock *mock, uint32_t start, size
 	return status;
 }
 
+/**
+ * Set up expectations for querying the flash block size, such as when preparing for a lazy erase.
+ *
+ * @param mock The mock to update.
+ *
+ * @return 0 if the expectations were added successfully or non-zero if not.
+ */
+int flash_mock_expect_get_block_size (struct flash_mock *mock)
+{
+	uint32_t block_size = FLASH_BLOCK_SIZE;
+	int status;
+
+	status = mock_expect (&mock->mock, mock->base.get_block_size, mock, 0, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output_tmp (&mock->mock, 0, &block_size, sizeof (block_size), -1);
+
+	return status;
+}
+
 /**
  * Set up expectations for successfully erasing blocks of flash.
  *
@@ -30,6 +30,8 @@ int flash_mock_validate_and_release (struct flash_mock *mock);
 
 int flash_mock_expect_blank_check (struct flash_mock *mock, uint32_t start, size_t length);
 
+int flash_mock_expect_get_block_size (struct flash_mock *mock);
+
 int flash_mock_expect_erase_flash (struct flash_mock *mock, uint32_t addr, size_t length);
 int flash_mock_expect_erase_flash_ext (struct flash_mock *mock, uint32_t addr, size_t length,
 	uint32_t block_size);
@@ -64,6 +64,24 @@ static int host_flash_manager_dual_mock_validate_read_write_flash (
 		MOCK_ARG_PTR_CALL (host_rw));
 }
 
+static int host_flash_manager_dual_mock_validate_flash_parallel (
+	struct host_flash_manager *manager, struct pfm *pfm, struct pfm *good_pfm,
+	struct hash_engine *hash, struct rsa_engine *rsa, bool full_validation,
+	struct host_flash_manager_rw_regions *rw_host_rw,
+	struct host_flash_manager_rw_regions *ro_host_rw, int *ro_status)
+{
+	struct host_flash_manager_dual_mock *mock = (struct host_flash_manager_dual_mock*) manager;
+
+	if (mock == NULL) {
+		return MOCK_INVALID_ARGUMENT;
+	}
+
+	MOCK_RETURN (&mock->mock, host_flash_manager_dual_mock_validate_flash_parallel, manager,
+		MOCK_ARG_PTR_CALL (pfm), MOCK_ARG_PTR_CALL (good_pfm), MOCK_ARG_PTR_CALL (hash),
+		MOCK_ARG_PTR_CALL (rsa), MOCK_ARG_CALL (full_validation), MOCK_ARG_PTR_CALL (rw_host_rw),
+		MOCK_ARG_PTR_CALL (ro_host_rw), MOCK_ARG_PTR_CALL (ro_status));
+}
+
 static int host_flash_manager_dual_mock_get_flash_read_write_regions (
 	struct host_flash_manager *manager, struct pfm *pfm, bool rw_flash,
 	struct host_flash_manager_rw_regions *host_rw)
@@ -209,7 +227,10 @@ static int host_flash_manager_dual_mock_reset_flash (
 
 static int host_flash_manager_dual_mock_func_arg_count (void *func)
 {
-	if (func == host_flash_manager_dual_mock_validate_read_only_flash) {
+	if (func == host_flash_manager_dual_mock_validate_flash_parallel) {
+		return 8;
+	}
+	else if (func == host_flash_manager_dual_mock_validate_read_only_flash) {
 		return 6;
 	}
 	else if (func == host_flash_manager_dual_mock_validate_read_write_flash) {
@@ -248,6 +269,9 @@ static const char* host_flash_manager_dual_mock_func_name_map (void *func)
 	else if (func == host_flash_manager_dual_mock_validate_read_write_flash) {
 		return "validate_read_write_flash";
 	}
+	else if (func == host_flash_manager_dual_mock_validate_flash_parallel) {
+		return "validate_flash_parallel";
+	}
 	else if (func == host_flash_manager_dual_mock_get_flash_read_write_regions) {
 		return "get_flash_read_write_regions";
 	}
@@ -324,6 +348,33 @@ static const char* host_flash_manager_dual_mock_arg_name_map (void *func, int ar
 				return "host_rw";
 		}
 	}
+	else if (func == host_flash_manager_dual_mock_validate_flash_parallel) {
+		switch (arg) {
+			case 0:
+				return "pfm";
+
+			case 1:
+				return "good_pfm";
+
+			case 2:
+				return "hash";
+
+			case 3:
+				return "rsa";
+
+			case 4:
+				return "full_validation";
+
+			case 5:
+				return "rw_host_rw";
+
+			case 6:
+				return "ro_host_rw";
+
+			case 7:
+				return "ro_status";
+		}
+	}
 	else if (func == host_flash_manager_dual_mock_get_flash_read_write_regions) {
 		switch (arg) {
 			case 0:
@@ -441,6 +492,29 @@ int host_flash_manager_dual_mock_init (struct host_flash_manager_dual_mock *mock
 	return 0;
 }
 
+/**
+ * Initialize a mock instance for a manager of protected flash using dual flashes that supports
+ * parallel validation of both flash devices.
+ *
+ * @param mock The mock to initialize.
+ *
+ * @return 0 if the mock was successfully initialized or an error code.
+ */
+int host_flash_manager_dual_mock_init_parallel_validation (
+	struct host_flash_manager_dual_mock *mock)
+{
+	int status;
+
+	status = host_flash_manager_dual_mock_init (mock);
+	if (status != 0) {
+		return status;
+	}
+
+	mock->base.base.validate_flash_parallel = host_flash_manager_dual_mock_validate_flash_parallel;
+
+	return 0;
+}
+
 /**
  * Release the resources used by flash manager mock instance.
  *
@@ -18,6 +18,8 @@ struct host_flash_manager_dual_mock {
 
 
 int host_flash_manager_dual_mock_init (struct host_flash_manager_dual_mock *mock);
+int host_flash_manager_dual_mock_init_parallel_validation (
+	struct host_flash_manager_dual_mock *mock);
 void host_flash_manager_dual_mock_release (struct host_flash_manager_dual_mock *mock);
 
 int host_flash_manager_dual_mock_validate_and_release (struct host_flash_manager_dual_mock *mock);
@@ -64,6 +64,20 @@ static void spdm_secure_session_manager_mock_reset (
 	MOCK_VOID_RETURN_NO_ARGS (&mock->mock, spdm_secure_session_manager_mock_reset, session_manager);
 }
 
+static void spdm_secure_session_manager_mock_release_peer_sessions (
+	const struct spdm_secure_session_manager *session_manager, uint8_t peer_eid)
+{
+	struct spdm_secure_session_manager_mock *mock =
+		(struct spdm_secure_session_manager_mock*) session_manager;
+
+	if (mock == NULL) {
+		return;
+	}
+
+	MOCK_VOID_RETURN (&mock->mock, spdm_secure_session_manager_mock_release_peer_sessions,
+		session_manager, MOCK_ARG_CALL (peer_eid));
+}
+
 static struct spdm_secure_session* spdm_secure_session_manager_mock_get_session (
 	const struct spdm_secure_session_manager *session_manager, uint32_t session_id)
 {
@@ -209,6 +223,9 @@ static int spdm_secure_session_manager_mock_func_arg_count (void *func)
 	else if (func == spdm_secure_session_manager_mock_reset) {
 		return 0;
 	}
+	else if (func == spdm_secure_session_manager_mock_release_peer_sessions) {
+		return 1;
+	}
 	else if (func == spdm_secure_session_manager_mock_generate_shared_secret) {
 		return 3;
 	}
@@ -255,6 +272,9 @@ static const char* spdm_secure_session_manager_mock_func_name_map (void *func)
 	else if (func == spdm_secure_session_manager_mock_reset) {
 		return "reset";
 	}
+	else if (func == spdm_secure_session_manager_mock_release_peer_sessions) {
+		return "release_peer_sessions";
+	}
 	else if (func == spdm_secure_session_manager_mock_generate_shared_secret) {
 		return "generate_shared_secret";
 	}
@@ -325,6 +345,12 @@ static const char* spdm_secure_session_manager_mock_arg_name_map (void *func, in
 				return "session_manager";
 		}
 	}
+	else if (func == spdm_secure_session_manager_mock_release_peer_sessions) {
+		switch (arg) {
+			case 0:
+				return "peer_eid";
+		}
+	}
 	else if (func == spdm_secure_session_manager_mock_generate_shared_secret) {
 		switch (arg) {
 			case 0:
@@ -412,6 +438,7 @@ int spdm_secure_session_manager_mock_init (struct spdm_secure_session_manager_mo
 	mock->base.get_session = spdm_secure_session_manager_mock_get_session;
 	mock->base.set_session_state = spdm_secure_session_set_session_state;
 	mock->base.reset = spdm_secure_session_manager_mock_reset;
+	mock->base.release_peer_sessions = spdm_secure_session_manager_mock_release_peer_sessions;
 	mock->base.generate_shared_secret = spdm_secure_session_manager_mock_generate_shared_secret;
 	mock->base.generate_session_handshake_keys =
 		spdm_secure_session_manager_mock_generate_session_handshake_keys;
@@ -99,6 +99,20 @@ static void spdm_transcript_manager_mock_reset (
 	MOCK_VOID_RETURN_NO_ARGS (&mock->mock, spdm_transcript_manager_mock_reset, transcript_manager);
 }
 
+static void spdm_transcript_manager_mock_reset_connection (
+	const struct spdm_transcript_manager *transcript_manager)
+{
+	struct spdm_transcript_manager_mock *mock =
+		(struct spdm_transcript_manager_mock*) transcript_manager;
+
+	if (mock == NULL) {
+		return;
+	}
+
+	MOCK_VOID_RETURN_NO_ARGS (&mock->mock, spdm_transcript_manager_mock_reset_connection,
+		transcript_manager);
+}
+
 static void spdm_transcript_manager_mock_reset_session_transcript (
 	const struct spdm_transcript_manager *transcript_manager, uint8_t session_idx)
 {
@@ -133,6 +147,9 @@ static int spdm_transcript_manager_mock_func_arg_count (void *func)
 	else if (func == spdm_transcript_manager_mock_reset) {
 		return 0;
 	}
+	else if (func == spdm_transcript_manager_mock_reset_connection) {
+		return 0;
+	}
 	else if (func == spdm_transcript_manager_mock_reset_session_transcript) {
 		return 1;
 	}
@@ -242,6 +259,9 @@ static const char* spdm_transcript_manager_mock_func_name_map (void *func)
 	else if (func == spdm_transcript_manager_mock_reset) {
 		return "reset";
 	}
+	else if (func == spdm_transcript_manager_mock_reset_connection) {
+		return "reset_connection";
+	}
 	else if (func == spdm_transcript_manager_mock_reset_session_transcript) {
 		return "reset_session_transcript";
 	}
@@ -280,6 +300,7 @@ int spdm_transcript_manager_mock_init (struct spdm_transcript_manager_mock *mock
 	mock->base.get_hash = spdm_transcript_manager_mock_get_hash;
 	mock->base.reset_transcript = spdm_transcript_manager_mock_reset_context;
 	mock->base.reset = spdm_transcript_manager_mock_reset;
+	mock->base.reset_connection = spdm_transcript_manager_mock_reset_connection;
 	mock->base.reset_session_transcript = spdm_transcript_manager_mock_reset_session_transcript;
 
 	mock->mock.func_arg_count = spdm_transcript_manager_mock_func_arg_count;
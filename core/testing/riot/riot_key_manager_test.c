@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <string.h>
 #include "platform_api.h"
+#include "common/array_size.h"
 #include "testing.h"
 #include "riot/riot_key_manager.h"
 #include "testing/asn1/x509_testing.h"
@@ -86,6 +87,65 @@ static void riot_key_manager_testing_static_riot_core_keys (CuTest *test, struct
 	keys->alias_cert_length = RIOT_CORE_ALIAS_CERT_LEN;
 }
 
+/**
+ * Initialize a RIoT key manager that has no certificates stored in the keystore.
+ *
+ * @param test The testing framework.
+ * @param manager The key manager to initialize.
+ * @param keystore The keystore mock to initialize for the manager.
+ * @param x509 The X.509 mock to initialize for the manager.
+ * @param keys The RIoT keys to initialize for the manager.
+ */
+static void riot_key_manager_testing_init_no_certs (CuTest *test,
+	struct riot_key_manager *manager, struct keystore_mock *keystore, struct x509_engine_mock *x509,
+	struct riot_keys *keys)
+{
+	uint8_t *dev_id_der = NULL;
+	int status;
+
+	status = x509_mock_init (x509);
+	CuAssertIntEquals (test, 0, status);
+
+	status = keystore_mock_init (keystore);
+	CuAssertIntEquals (test, 0, status);
+
+	riot_key_manager_testing_alloc_riot_core_keys (test, keys);
+
+	status = mock_expect (&keystore->mock, keystore->base.load_key, keystore, KEYSTORE_NO_KEY,
+		MOCK_ARG (0), MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&keystore->mock, 1, &dev_id_der, sizeof (dev_id_der), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_init (manager, &keystore->base, keys, &x509->base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_validate (&keystore->mock);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release a RIoT key manager and validate the mocks.
+ *
+ * @param test The testing framework.
+ * @param manager The key manager to release.
+ * @param keystore The keystore mock to release.
+ * @param x509 The X.509 mock to release.
+ */
+static void riot_key_manager_testing_release_no_certs (CuTest *test,
+	struct riot_key_manager *manager, struct keystore_mock *keystore, struct x509_engine_mock *x509)
+{
+	int status;
+
+	status = keystore_mock_validate_and_release (keystore);
+	CuAssertIntEquals (test, 0, status);
+
+	status = x509_mock_validate_and_release (x509);
+	CuAssertIntEquals (test, 0, status);
+
+	riot_key_manager_release (manager);
+}
+
 /*******************
  * Test cases
  *******************/
@@ -6878,6 +6938,435 @@ static void riot_key_manager_test_erase_all_certificates_intermediate_ca_error (
 }
 
 
+static void riot_key_manager_test_digest_cache (CuTest *test)
+{
+	struct x509_engine_mock x509;
+	struct keystore_mock keystore;
+	struct riot_keys keys;
+	struct riot_key_manager manager;
+	struct riot_key_manager_digest cache[2];
+	uint8_t chain_digest[SHA384_HASH_LENGTH];
+	uint8_t cert_digests[SHA256_HASH_LENGTH * 3];
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];
+	uint8_t cert_count = 0;
+	uint32_t generation = 0;
+	int status;
+
+	TEST_START;
+
+	memset (chain_digest, 0x55, sizeof (chain_digest));
+	memset (cert_digests, 0xaa, sizeof (cert_digests));
+
+	riot_key_manager_testing_init_no_certs (test, &manager, &keystore, &x509, &keys);
+
+	status = riot_key_manager_enable_digest_cache (&manager, cache, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA384,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), &cert_count, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA384,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CERT_LIST, cert_digests, sizeof (cert_digests), 3, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA384,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), &cert_count, NULL);
+	CuAssertIntEquals (test, sizeof (chain_digest), status);
+	CuAssertIntEquals (test, 2, cert_count);
+
+	status = testing_validate_array (chain_digest, digest, sizeof (chain_digest));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CERT_LIST, digest, sizeof (cert_digests), &cert_count, NULL);
+	CuAssertIntEquals (test, sizeof (cert_digests), status);
+	CuAssertIntEquals (test, 3, cert_count);
+
+	status = testing_validate_array (cert_digests, digest, sizeof (cert_digests));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Digests are only reported for a matching slot, hash, and type. */
+	status = riot_key_manager_get_cached_digest (&manager, 1, HASH_TYPE_SHA384,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA384,
+		RIOT_KEY_MANAGER_DIGEST_CERT_LIST, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	riot_key_manager_testing_release_no_certs (test, &manager, &keystore, &x509);
+}
+
+static void riot_key_manager_test_digest_cache_replace (CuTest *test)
+{
+	struct x509_engine_mock x509;
+	struct keystore_mock keystore;
+	struct riot_keys keys;
+	struct riot_key_manager manager;
+	struct riot_key_manager_digest cache[2];
+	uint8_t digest1[SHA256_HASH_LENGTH];
+	uint8_t digest2[SHA256_HASH_LENGTH];
+	uint8_t digest3[SHA256_HASH_LENGTH];
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];
+	uint32_t generation = 0;
+	int status;
+
+	TEST_START;
+
+	memset (digest1, 0x11, sizeof (digest1));
+	memset (digest2, 0x22, sizeof (digest2));
+	memset (digest3, 0x33, sizeof (digest3));
+
+	riot_key_manager_testing_init_no_certs (test, &manager, &keystore, &x509, &keys);
+
+	status = riot_key_manager_enable_digest_cache (&manager, cache, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest1, sizeof (digest1), 4, generation);
+	status |= riot_key_manager_cache_digest (&manager, 1, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest2, sizeof (digest2), 4, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Updating a cached digest does not replace a different entry. */
+	status = riot_key_manager_cache_digest (&manager, 1, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest3, sizeof (digest3), 4, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, sizeof (digest1), status);
+
+	status = testing_validate_array (digest1, digest, sizeof (digest1));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 1, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, sizeof (digest3), status);
+
+	status = testing_validate_array (digest3, digest, sizeof (digest3));
+	CuAssertIntEquals (test, 0, status);
+
+	/* A new digest replaces the oldest entry when the cache is full. */
+	status = riot_key_manager_cache_digest (&manager, 2, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest2, sizeof (digest2), 4, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 1, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, sizeof (digest3), status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 2, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, sizeof (digest2), status);
+
+	status = testing_validate_array (digest2, digest, sizeof (digest2));
+	CuAssertIntEquals (test, 0, status);
+
+	riot_key_manager_testing_release_no_certs (test, &manager, &keystore, &x509);
+}
+
+static void riot_key_manager_test_digest_cache_disabled (CuTest *test)
+{
+	struct x509_engine_mock x509;
+	struct keystore_mock keystore;
+	struct riot_keys keys;
+	struct riot_key_manager manager;
+	struct riot_key_manager_digest cache[2];
+	uint8_t chain_digest[SHA256_HASH_LENGTH];
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];
+	uint32_t generation = 0;
+	int status;
+
+	TEST_START;
+
+	memset (chain_digest, 0x55, sizeof (chain_digest));
+
+	riot_key_manager_testing_init_no_certs (test, &manager, &keystore, &x509, &keys);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	/* Disable a cache that was previously enabled. */
+	status = riot_key_manager_enable_digest_cache (&manager, cache, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_enable_digest_cache (&manager, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	riot_key_manager_testing_release_no_certs (test, &manager, &keystore, &x509);
+}
+
+static void riot_key_manager_test_digest_cache_store_certificate (CuTest *test)
+{
+	struct x509_engine_mock x509;
+	struct keystore_mock keystore;
+	struct riot_keys keys;
+	struct riot_key_manager manager;
+	struct riot_key_manager_digest cache[2];
+	uint8_t chain_digest[SHA256_HASH_LENGTH];
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];
+	uint32_t generation = 0;
+	uint32_t old_generation;
+	int status;
+
+	TEST_START;
+
+	memset (chain_digest, 0x55, sizeof (chain_digest));
+
+	riot_key_manager_testing_init_no_certs (test, &manager, &keystore, &x509, &keys);
+
+	status = riot_key_manager_enable_digest_cache (&manager, cache, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	old_generation = generation;
+
+	status = mock_expect (&keystore.mock, keystore.base.save_key, &keystore, 0, MOCK_ARG (1),
+		MOCK_ARG_PTR_CONTAINS (X509_CERTSS_RSA_CA_NOPL_DER, X509_CERTSS_RSA_CA_NOPL_DER_LEN),
+		MOCK_ARG (X509_CERTSS_RSA_CA_NOPL_DER_LEN));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_store_root_ca (&manager, X509_CERTSS_RSA_CA_NOPL_DER,
+		X509_CERTSS_RSA_CA_NOPL_DER_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+	CuAssertTrue (test, (generation != old_generation));
+
+	/* A digest calculated before the certificates changed is not cached. */
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, old_generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	riot_key_manager_testing_release_no_certs (test, &manager, &keystore, &x509);
+}
+
+static void riot_key_manager_test_digest_cache_verify_stored_certs (CuTest *test)
+{
+	struct x509_engine_mock x509;
+	struct keystore_mock keystore;
+	struct riot_keys keys;
+	struct riot_key_manager manager;
+	struct riot_key_manager_digest cache[2];
+	uint8_t chain_digest[SHA256_HASH_LENGTH];
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];
+	uint8_t *dev_id_der = NULL;
+	uint32_t generation = 0;
+	int status;
+
+	TEST_START;
+
+	memset (chain_digest, 0x55, sizeof (chain_digest));
+
+	riot_key_manager_testing_init_no_certs (test, &manager, &keystore, &x509, &keys);
+
+	status = riot_key_manager_enable_digest_cache (&manager, cache, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&keystore.mock, keystore.base.load_key, &keystore, KEYSTORE_NO_KEY,
+		MOCK_ARG (0), MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&keystore.mock, 1, &dev_id_der, sizeof (dev_id_der), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_verify_stored_certs (&manager);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_NO_SIGNED_DEVICE_ID, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	riot_key_manager_testing_release_no_certs (test, &manager, &keystore, &x509);
+}
+
+static void riot_key_manager_test_digest_cache_erase_all_certificates (CuTest *test)
+{
+	struct x509_engine_mock x509;
+	struct keystore_mock keystore;
+	struct riot_keys keys;
+	struct riot_key_manager manager;
+	struct riot_key_manager_digest cache[2];
+	uint8_t chain_digest[SHA256_HASH_LENGTH];
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];
+	uint32_t generation = 0;
+	int status;
+
+	TEST_START;
+
+	memset (chain_digest, 0x55, sizeof (chain_digest));
+
+	riot_key_manager_testing_init_no_certs (test, &manager, &keystore, &x509, &keys);
+
+	status = riot_key_manager_enable_digest_cache (&manager, cache, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&keystore.mock, keystore.base.erase_key, &keystore, 0, MOCK_ARG (0));
+	status |= mock_expect (&keystore.mock, keystore.base.erase_key, &keystore, 0, MOCK_ARG (1));
+	status |= mock_expect (&keystore.mock, keystore.base.erase_key, &keystore, 0, MOCK_ARG (2));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_erase_all_certificates (&manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	riot_key_manager_testing_release_no_certs (test, &manager, &keystore, &x509);
+}
+
+static void riot_key_manager_test_digest_cache_small_buffer (CuTest *test)
+{
+	struct x509_engine_mock x509;
+	struct keystore_mock keystore;
+	struct riot_keys keys;
+	struct riot_key_manager manager;
+	struct riot_key_manager_digest cache[2];
+	uint8_t chain_digest[SHA384_HASH_LENGTH];
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];
+	uint32_t generation = 0;
+	int status;
+
+	TEST_START;
+
+	memset (chain_digest, 0x55, sizeof (chain_digest));
+
+	riot_key_manager_testing_init_no_certs (test, &manager, &keystore, &x509, &keys);
+
+	status = riot_key_manager_enable_digest_cache (&manager, cache, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA384,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, &generation);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_NOT_CACHED, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA384,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, generation);
+	CuAssertIntEquals (test, 0, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA384,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (chain_digest) - 1, NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_SMALL_DIGEST_BUFFER, status);
+
+	riot_key_manager_testing_release_no_certs (test, &manager, &keystore, &x509);
+}
+
+static void riot_key_manager_test_digest_cache_invalid_arg (CuTest *test)
+{
+	struct x509_engine_mock x509;
+	struct keystore_mock keystore;
+	struct riot_keys keys;
+	struct riot_key_manager manager;
+	struct riot_key_manager_digest cache[2];
+	uint8_t chain_digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH + 1];
+	uint8_t digest[RIOT_KEY_MANAGER_DIGEST_MAX_LENGTH];
+	int status;
+
+	TEST_START;
+
+	memset (chain_digest, 0x55, sizeof (chain_digest));
+
+	riot_key_manager_testing_init_no_certs (test, &manager, &keystore, &x509, &keys);
+
+	status = riot_key_manager_enable_digest_cache (NULL, cache, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_INVALID_ARGUMENT, status);
+
+	status = riot_key_manager_enable_digest_cache (&manager, NULL, ARRAY_SIZE (cache));
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_INVALID_ARGUMENT, status);
+
+	status = riot_key_manager_get_cached_digest (NULL, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, digest, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_INVALID_ARGUMENT, status);
+
+	status = riot_key_manager_get_cached_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, NULL, sizeof (digest), NULL, NULL);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_INVALID_ARGUMENT, status);
+
+	status = riot_key_manager_cache_digest (NULL, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, SHA256_HASH_LENGTH, 2, 0);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_INVALID_ARGUMENT, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, NULL, SHA256_HASH_LENGTH, 2, 0);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_INVALID_ARGUMENT, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, 0, 2, 0);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_INVALID_ARGUMENT, status);
+
+	status = riot_key_manager_cache_digest (&manager, 0, HASH_TYPE_SHA256,
+		RIOT_KEY_MANAGER_DIGEST_CHAIN, chain_digest, sizeof (chain_digest), 2, 0);
+	CuAssertIntEquals (test, RIOT_KEY_MANAGER_DIGEST_TOO_LARGE, status);
+
+	riot_key_manager_testing_release_no_certs (test, &manager, &keystore, &x509);
+}
+
 // *INDENT-OFF*
 TEST_SUITE_START (riot_key_manager);
 
@@ -6956,6 +7445,14 @@ TEST (riot_key_manager_test_erase_all_certificates_null);
 TEST (riot_key_manager_test_erase_all_certificates_device_id_error);
 TEST (riot_key_manager_test_erase_all_certificates_root_ca_error);
 TEST (riot_key_manager_test_erase_all_certificates_intermediate_ca_error);
+TEST (riot_key_manager_test_digest_cache);
+TEST (riot_key_manager_test_digest_cache_replace);
+TEST (riot_key_manager_test_digest_cache_disabled);
+TEST (riot_key_manager_test_digest_cache_store_certificate);
+TEST (riot_key_manager_test_digest_cache_verify_stored_certs);
+TEST (riot_key_manager_test_digest_cache_erase_all_certificates);
+TEST (riot_key_manager_test_digest_cache_small_buffer);
+TEST (riot_key_manager_test_digest_cache_invalid_arg);
 
 TEST_SUITE_END;
 // *INDENT-ON*
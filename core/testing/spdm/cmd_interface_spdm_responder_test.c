@@ -3,10 +3,14 @@
 
 #include <string.h>
 #include "testing.h"
+#include "asn1/ecc_der_util.h"
 #include "common/array_size.h"
+#include "common/buffer_util.h"
 #include "pcisig/doe/doe_base_protocol.h"
 #include "spdm/cmd_interface_spdm_responder_static.h"
 #include "spdm/spdm_commands.h"
+#include "spdm/spdm_secure_session_manager.h"
+#include "spdm/spdm_transcript_manager.h"
 #include "testing/asn1/x509_testing.h"
 #include "testing/crypto/hash_testing.h"
 #include "testing/engines/aes_testing_engine.h"
@@ -16,6 +20,7 @@
 #include "testing/engines/hash_testing_engine.h"
 #include "testing/engines/rng_testing_engine.h"
 #include "testing/mock/asn1/x509_mock.h"
+#include "testing/mock/cmd_interface/cmd_background_mock.h"
 #include "testing/mock/cmd_interface/cmd_interface_mock.h"
 #include "testing/mock/crypto/aes_mock.h"
 #include "testing/mock/crypto/ecc_mock.h"
@@ -102,6 +107,74 @@ struct cmd_interface_spdm_responder_testing {
 };
 
 
+/**
+ * Number of requesters sharing the SPDM responder when testing concurrent sessions.
+ */
+#define	CMD_INTERFACE_SPDM_RESPONDER_TESTING_REQUESTER_COUNT		3
+
+/**
+ * Number of hash engines used by a transcript manager that supports sessions.
+ */
+#define	CMD_INTERFACE_SPDM_RESPONDER_TESTING_TRANSCRIPT_HASH_COUNT	\
+	(SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT + \
+	SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT)
+
+/**
+ * Length of the secured message headers in front of an encrypted SPDM message.
+ */
+#define	CMD_INTERFACE_SPDM_RESPONDER_TESTING_SECURE_HEADER_LEN		\
+	(sizeof (struct spdm_secured_message_data_header_1) + \
+	sizeof (struct spdm_secured_message_data_header_2) + \
+	sizeof (struct spdm_secured_message_cipher_header))
+
+/**
+ * A requester sharing the SPDM responder with other requesters.  The requester keeps its own
+ * transcript and session keys so messages are checked independently of the responder state.
+ */
+struct cmd_interface_spdm_responder_testing_requester {
+	uint8_t eid;											/**< EID of the requester. */
+	uint8_t minor_version;									/**< SPDM minor version used by the requester. */
+	struct spdm_transcript_manager transcript_manager;		/**< Transcript for the requester. */
+	struct spdm_transcript_manager_state transcript_state;	/**< Requester transcript state. */
+	struct spdm_secure_session_manager session_manager;		/**< Session keys for the requester. */
+	struct spdm_secure_session_manager_state session_state;	/**< Requester session state. */
+	struct spdm_connection_info connection_info;			/**< Connection negotiated with the responder. */
+	uint8_t cert_chain_hash[HASH_MAX_HASH_LEN];				/**< Digest of the responder certificate chain. */
+	uint32_t session_id;									/**< ID of the current requester session. */
+};
+
+/**
+ * Dependencies for testing multiple requesters with sessions on a single responder.
+ */
+struct cmd_interface_spdm_responder_testing_sessions {
+	struct cmd_interface_spdm_responder_testing base;			/**< Common responder dependencies. */
+	HASH_TESTING_ENGINE hash[SPDM_RESPONDER_HASH_ENGINE_REQUIRED_COUNT];	/**< Hash engines for the responder. */
+	struct hash_engine *hash_engine[SPDM_RESPONDER_HASH_ENGINE_REQUIRED_COUNT];	/**< Responder hash engine list. */
+	HASH_TESTING_ENGINE
+		transcript_hash[CMD_INTERFACE_SPDM_RESPONDER_TESTING_TRANSCRIPT_HASH_COUNT];	/**< Hash engines for the responder transcript. */
+	struct hash_engine
+		*transcript_hash_engine[CMD_INTERFACE_SPDM_RESPONDER_TESTING_TRANSCRIPT_HASH_COUNT];	/**< Responder transcript hash engine list. */
+	HASH_TESTING_ENGINE session_hash;							/**< Hash engine for responder sessions. */
+	AES_TESTING_ENGINE aes;										/**< AES engine for responder sessions. */
+	ECC_TESTING_ENGINE ecc;										/**< ECC engine for the responder. */
+	RNG_TESTING_ENGINE rng;										/**< RNG engine for the responder. */
+	struct spdm_transcript_manager transcript_manager;			/**< Responder transcript manager. */
+	struct spdm_transcript_manager_state transcript_state;		/**< Responder transcript state. */
+	struct spdm_secure_session_manager session_manager;			/**< Responder session manager. */
+	struct spdm_secure_session_manager_state session_state;		/**< Responder session state. */
+	HASH_TESTING_ENGINE
+		req_hash[CMD_INTERFACE_SPDM_RESPONDER_TESTING_TRANSCRIPT_HASH_COUNT];	/**< Hash engines for requester transcripts. */
+	struct hash_engine
+		*req_hash_engine[CMD_INTERFACE_SPDM_RESPONDER_TESTING_TRANSCRIPT_HASH_COUNT];	/**< Requester transcript hash engine list. */
+	HASH_TESTING_ENGINE req_session_hash;						/**< Hash engine for requester sessions. */
+	AES_TESTING_ENGINE req_aes;									/**< AES engine for requester sessions. */
+	ECC_TESTING_ENGINE req_ecc;									/**< ECC engine for requester key exchange. */
+	RNG_TESTING_ENGINE req_rng;									/**< RNG engine for requester messages. */
+	struct cmd_interface_spdm_responder_testing_requester
+		requester[CMD_INTERFACE_SPDM_RESPONDER_TESTING_REQUESTER_COUNT];	/**< Requesters sharing the responder. */
+};
+
+
 /**
  * Helper to initialize all dependencies for testing.
  *
@@ -345,6 +418,686 @@ static void cmd_interface_spdm_responder_testing_release (CuTest *test,
 	cmd_interface_spdm_responder_testing_release_dependencies (test, testing);
 }
 
+/**
+ * Initialize an SPDM responder that uses real transcript and session managers, along with
+ * requesters that will establish sessions with the responder.
+ *
+ * @param test		The test framework.
+ * @param testing	Testing dependencies to initialize.
+ */
+static void cmd_interface_spdm_responder_testing_init_sessions (CuTest *test,
+	struct cmd_interface_spdm_responder_testing_sessions *testing)
+{
+	struct cmd_interface_spdm_responder_testing_requester *requester;
+	size_t i;
+	int status;
+
+	cmd_interface_spdm_responder_testing_init_dependencies (test, &testing->base);
+
+	for (i = 0; i < ARRAY_SIZE (testing->hash); i++) {
+		status = HASH_TESTING_ENGINE_INIT (&testing->hash[i]);
+		CuAssertIntEquals (test, 0, status);
+		testing->hash_engine[i] = &testing->hash[i].base;
+	}
+
+	for (i = 0; i < ARRAY_SIZE (testing->transcript_hash); i++) {
+		status = HASH_TESTING_ENGINE_INIT (&testing->transcript_hash[i]);
+		CuAssertIntEquals (test, 0, status);
+		testing->transcript_hash_engine[i] = &testing->transcript_hash[i].base;
+
+		status = HASH_TESTING_ENGINE_INIT (&testing->req_hash[i]);
+		CuAssertIntEquals (test, 0, status);
+		testing->req_hash_engine[i] = &testing->req_hash[i].base;
+	}
+
+	status = HASH_TESTING_ENGINE_INIT (&testing->session_hash);
+	status |= AES_TESTING_ENGINE_INIT (&testing->aes);
+	status |= ECC_TESTING_ENGINE_INIT (&testing->ecc);
+	status |= RNG_TESTING_ENGINE_INIT (&testing->rng);
+	status |= HASH_TESTING_ENGINE_INIT (&testing->req_session_hash);
+	status |= AES_TESTING_ENGINE_INIT (&testing->req_aes);
+	status |= ECC_TESTING_ENGINE_INIT (&testing->req_ecc);
+	status |= RNG_TESTING_ENGINE_INIT (&testing->req_rng);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_transcript_manager_init (&testing->transcript_manager,
+		&testing->transcript_state, testing->transcript_hash_engine,
+		ARRAY_SIZE (testing->transcript_hash_engine));
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_secure_session_manager_init (&testing->session_manager, &testing->session_state,
+		&testing->base.local_capabilities,
+		(const struct spdm_device_algorithms*) &testing->base.local_algorithms,
+		&testing->aes.base, &testing->session_hash.base, &testing->rng.base, &testing->ecc.base,
+		&testing->transcript_manager);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_interface_spdm_responder_init (&testing->base.spdm_responder,
+		&testing->base.spdm_responder_state, &testing->transcript_manager, testing->hash_engine,
+		ARRAY_SIZE (testing->hash_engine), testing->base.version_num,
+		ARRAY_SIZE (testing->base.version_num), testing->base.secure_message_version_num,
+		ARRAY_SIZE (testing->base.secure_message_version_num), &testing->base.local_capabilities,
+		&testing->base.local_algorithms, &testing->base.key_manager,
+		&testing->base.measurements_mock.base, &testing->ecc.base, &testing->rng.base,
+		&testing->session_manager, &testing->base.vdm_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < ARRAY_SIZE (testing->requester); i++) {
+		requester = &testing->requester[i];
+
+		memset (requester, 0, sizeof (*requester));
+		requester->eid = 0x10 + i;
+		requester->minor_version = ((i % 2) == 0) ? 2 : 1;
+
+		status = spdm_transcript_manager_init (&requester->transcript_manager,
+			&requester->transcript_state, testing->req_hash_engine,
+			ARRAY_SIZE (testing->req_hash_engine));
+		CuAssertIntEquals (test, 0, status);
+
+		status = spdm_secure_session_manager_init (&requester->session_manager,
+			&requester->session_state, &testing->base.local_capabilities,
+			(const struct spdm_device_algorithms*) &testing->base.local_algorithms,
+			&testing->req_aes.base, &testing->req_session_hash.base, &testing->req_rng.base,
+			&testing->req_ecc.base, &requester->transcript_manager);
+		CuAssertIntEquals (test, 0, status);
+	}
+}
+
+/**
+ * Release the SPDM responder and requesters and validate all mocks.
+ *
+ * @param test		The test framework.
+ * @param testing	Testing dependencies to release.
+ */
+static void cmd_interface_spdm_responder_testing_release_sessions (CuTest *test,
+	struct cmd_interface_spdm_responder_testing_sessions *testing)
+{
+	size_t i;
+
+	for (i = 0; i < ARRAY_SIZE (testing->requester); i++) {
+		spdm_secure_session_manager_release (&testing->requester[i].session_manager);
+		spdm_transcript_manager_release (&testing->requester[i].transcript_manager);
+	}
+
+	cmd_interface_spdm_responder_deinit (&testing->base.spdm_responder);
+	spdm_secure_session_manager_release (&testing->session_manager);
+	spdm_transcript_manager_release (&testing->transcript_manager);
+
+	for (i = 0; i < ARRAY_SIZE (testing->hash); i++) {
+		HASH_TESTING_ENGINE_RELEASE (&testing->hash[i]);
+	}
+
+	for (i = 0; i < ARRAY_SIZE (testing->transcript_hash); i++) {
+		HASH_TESTING_ENGINE_RELEASE (&testing->transcript_hash[i]);
+		HASH_TESTING_ENGINE_RELEASE (&testing->req_hash[i]);
+	}
+
+	HASH_TESTING_ENGINE_RELEASE (&testing->session_hash);
+	AES_TESTING_ENGINE_RELEASE (&testing->aes);
+	ECC_TESTING_ENGINE_RELEASE (&testing->ecc);
+	RNG_TESTING_ENGINE_RELEASE (&testing->rng);
+	HASH_TESTING_ENGINE_RELEASE (&testing->req_session_hash);
+	AES_TESTING_ENGINE_RELEASE (&testing->req_aes);
+	ECC_TESTING_ENGINE_RELEASE (&testing->req_ecc);
+	RNG_TESTING_ENGINE_RELEASE (&testing->req_rng);
+
+	cmd_interface_spdm_responder_testing_release_dependencies (test, &testing->base);
+}
+
+/**
+ * Swap the request and response keys for a phase of a requester session.  The session manager
+ * always decrypts with request keys and encrypts with response keys, so the keys are swapped to let
+ * the requester encrypt requests and decrypt responses.
+ *
+ * @param request_key Request encryption key for the session phase.
+ * @param request_salt Request salt for the session phase.
+ * @param response_key Response encryption key for the session phase.
+ * @param response_salt Response salt for the session phase.
+ */
+static void cmd_interface_spdm_responder_testing_swap_keys (uint8_t *request_key,
+	uint8_t *request_salt, uint8_t *response_key, uint8_t *response_salt)
+{
+	uint8_t key[SPDM_MAX_AEAD_KEY_SIZE];
+	uint8_t salt[SPDM_MAX_AEAD_IV_SIZE];
+
+	memcpy (key, request_key, sizeof (key));
+	memcpy (salt, request_salt, sizeof (salt));
+
+	memcpy (request_key, response_key, sizeof (key));
+	memcpy (request_salt, response_salt, sizeof (salt));
+
+	memcpy (response_key, key, sizeof (key));
+	memcpy (response_salt, salt, sizeof (salt));
+}
+
+/**
+ * Send an unencrypted request from a requester to the responder.
+ *
+ * @param test		The test framework.
+ * @param testing	Testing dependencies.
+ * @param requester	The requester sending the request.
+ * @param buf		Buffer with the request.  The response will be stored in the same buffer.  This
+ * must be MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY bytes.
+ * @param length	Length of the request.
+ * @param add_vca	Flag to add the request and response to the requester VCA transcript.
+ *
+ * @return Length of the response.
+ */
+static size_t cmd_interface_spdm_responder_testing_send (CuTest *test,
+	struct cmd_interface_spdm_responder_testing_sessions *testing,
+	struct cmd_interface_spdm_responder_testing_requester *requester, uint8_t *buf,
+	size_t length, bool add_vca)
+{
+	struct cmd_interface_msg request;
+	int status;
+
+	if (add_vca) {
+		status = requester->transcript_manager.update (&requester->transcript_manager,
+			TRANSCRIPT_CONTEXT_TYPE_VCA, buf, length, false, SPDM_MAX_SESSION_COUNT);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	memset (&request, 0, sizeof (request));
+	request.data = buf;
+	request.payload = buf;
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.payload_length = length;
+	request.length = length;
+	request.source_eid = requester->eid;
+
+	status = testing->base.spdm_responder.base.process_request (
+		&testing->base.spdm_responder.base, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, buf, request.payload);
+	CuAssertTrue (test,
+		(((struct spdm_protocol_header*) buf)->req_rsp_code != SPDM_RESPONSE_ERROR));
+
+	if (add_vca) {
+		status = requester->transcript_manager.update (&requester->transcript_manager,
+			TRANSCRIPT_CONTEXT_TYPE_VCA, buf, request.payload_length, false,
+			SPDM_MAX_SESSION_COUNT);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	return request.payload_length;
+}
+
+/**
+ * Send a request from a requester to the responder in the requester session.
+ *
+ * @param test		The test framework.
+ * @param testing	Testing dependencies.
+ * @param requester	The requester sending the request.
+ * @param buf		Buffer for the secured message.  This must be
+ * MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY bytes, with the request starting after the secured message
+ * headers.  The response will be stored
+ * in the same location.
+ * @param length	Length of the request.
+ *
+ * @return Length of the response.
+ */
+static size_t cmd_interface_spdm_responder_testing_send_secure (CuTest *test,
+	struct cmd_interface_spdm_responder_testing_sessions *testing,
+	struct cmd_interface_spdm_responder_testing_requester *requester, uint8_t *buf,
+	size_t length)
+{
+	uint8_t *payload = &buf[CMD_INTERFACE_SPDM_RESPONDER_TESTING_SECURE_HEADER_LEN];
+	struct cmd_interface_msg request;
+	int status;
+
+	memset (&request, 0, sizeof (request));
+	request.data = buf;
+	request.payload = payload;
+	request.max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	request.payload_length = length;
+	request.length = length;
+	request.source_eid = requester->eid;
+
+	requester->session_state.last_spdm_request_secure_session_id = requester->session_id;
+	requester->session_state.last_spdm_request_secure_session_id_valid = true;
+
+	status = requester->session_manager.encode_secure_message (&requester->session_manager,
+		&request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, buf, request.payload);
+
+	request.is_encrypted = true;
+
+	status = testing->base.spdm_responder.base.process_request (
+		&testing->base.spdm_responder.base, &request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, buf, request.payload);
+
+	status = requester->session_manager.decode_secure_message (&requester->session_manager,
+		&request);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, payload, request.payload);
+	CuAssertTrue (test,
+		(((struct spdm_protocol_header*) payload)->req_rsp_code != SPDM_RESPONSE_ERROR));
+
+	return request.payload_length;
+}
+
+/**
+ * Negotiate a new connection between a requester and the responder and get the digest of the
+ * responder certificate chain.  Any previous session for the requester is discarded.
+ *
+ * @param test		The test framework.
+ * @param testing	Testing dependencies.
+ * @param requester	The requester starting the connection.
+ */
+static void cmd_interface_spdm_responder_testing_connect (CuTest *test,
+	struct cmd_interface_spdm_responder_testing_sessions *testing,
+	struct cmd_interface_spdm_responder_testing_requester *requester)
+{
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct spdm_get_version_request *version_rq = (struct spdm_get_version_request*) buf;
+	struct spdm_get_version_response *version_rsp = (struct spdm_get_version_response*) buf;
+	struct spdm_get_capabilities *capabilities = (struct spdm_get_capabilities*) buf;
+	struct spdm_negotiate_algorithms_request *algorithms_rq =
+		(struct spdm_negotiate_algorithms_request*) buf;
+	struct spdm_negotiate_algorithms_response_no_ext_alg *algorithms_rsp =
+		(struct spdm_negotiate_algorithms_response_no_ext_alg*) buf;
+	struct spdm_get_digests_request *digests_rq = (struct spdm_get_digests_request*) buf;
+	struct spdm_algorithm_request *algstruct_table;
+	const struct spdm_device_algorithms *local_algorithms =
+		&testing->base.local_algorithms.device_algorithms;
+	struct spdm_connection_info *connection_info = &requester->connection_info;
+	size_t length;
+	int i;
+	int status;
+
+	requester->session_manager.reset (&requester->session_manager);
+	requester->transcript_manager.reset (&requester->transcript_manager);
+	memset (connection_info, 0, sizeof (*connection_info));
+	requester->session_id = SPDM_INVALID_SESSION_ID;
+
+	/* GET_VERSION */
+	memset (buf, 0, sizeof (buf));
+	version_rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	version_rq->header.spdm_minor_version = 0;
+	version_rq->header.req_rsp_code = SPDM_REQUEST_GET_VERSION;
+
+	cmd_interface_spdm_responder_testing_send (test, testing, requester, buf, sizeof (*version_rq),
+		true);
+	CuAssertIntEquals (test, SPDM_RESPONSE_GET_VERSION, version_rsp->header.req_rsp_code);
+	CuAssertIntEquals (test, ARRAY_SIZE (testing->base.version_num),
+		version_rsp->version_num_entry_count);
+	CuAssertIntEquals (test, requester->eid,
+		testing->base.spdm_responder_state.connection_info.peer_eid);
+
+	/* GET_CAPABILITIES */
+	memset (buf, 0, sizeof (buf));
+	capabilities->base_capabilities.header.spdm_major_version = SPDM_MAJOR_VERSION;
+	capabilities->base_capabilities.header.spdm_minor_version = requester->minor_version;
+	capabilities->base_capabilities.header.req_rsp_code = SPDM_REQUEST_GET_CAPABILITIES;
+	capabilities->base_capabilities.ct_exponent = testing->base.local_capabilities.ct_exponent;
+	capabilities->base_capabilities.flags = testing->base.local_capabilities.flags;
+
+	if (requester->minor_version >= 2) {
+		capabilities->data_transfer_size = testing->base.local_capabilities.data_transfer_size;
+		capabilities->max_spdm_msg_size = testing->base.local_capabilities.max_spdm_msg_size;
+		length = sizeof (struct spdm_get_capabilities);
+	}
+	else {
+		length = sizeof (struct spdm_get_capabilities_1_1);
+	}
+
+	cmd_interface_spdm_responder_testing_send (test, testing, requester, buf, length, true);
+	CuAssertIntEquals (test, SPDM_RESPONSE_GET_CAPABILITIES,
+		capabilities->base_capabilities.header.req_rsp_code);
+
+	connection_info->peer_capabilities.flags = capabilities->base_capabilities.flags;
+	connection_info->peer_capabilities.ct_exponent = capabilities->base_capabilities.ct_exponent;
+
+	/* NEGOTIATE_ALGORITHMS */
+	length = sizeof (struct spdm_negotiate_algorithms_request) +
+		(sizeof (struct spdm_algorithm_request) * 4);
+
+	memset (buf, 0, sizeof (buf));
+	algorithms_rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	algorithms_rq->header.spdm_minor_version = requester->minor_version;
+	algorithms_rq->header.req_rsp_code = SPDM_REQUEST_NEGOTIATE_ALGORITHMS;
+	algorithms_rq->num_alg_structure_tables = 4;
+	algorithms_rq->length = length;
+	algorithms_rq->measurement_specification = local_algorithms->measurement_spec;
+	algorithms_rq->base_asym_algo = local_algorithms->base_asym_algo;
+	algorithms_rq->base_hash_algo = local_algorithms->base_hash_algo;
+
+	if (requester->minor_version >= 2) {
+		algorithms_rq->other_params_support.opaque_data_format =
+			local_algorithms->other_params_support.opaque_data_format;
+	}
+
+	algstruct_table = spdm_negotiate_algorithms_req_algstruct_table (algorithms_rq);
+	algstruct_table[0].fixed_alg_count = 2;
+	algstruct_table[0].alg_type = SPDM_ALG_REQ_STRUCT_ALG_TYPE_DHE;
+	algstruct_table[0].alg_supported = local_algorithms->dhe_named_group;
+
+	algstruct_table[1].fixed_alg_count = 2;
+	algstruct_table[1].alg_type = SPDM_ALG_REQ_STRUCT_ALG_TYPE_AEAD;
+	algstruct_table[1].alg_supported = local_algorithms->aead_cipher_suite;
+
+	algstruct_table[2].fixed_alg_count = 2;
+	algstruct_table[2].alg_type = SPDM_ALG_REQ_STRUCT_ALG_TYPE_REQ_BASE_ASYM_ALG;
+	algstruct_table[2].alg_supported = local_algorithms->req_base_asym_alg;
+
+	algstruct_table[3].fixed_alg_count = 2;
+	algstruct_table[3].alg_type = SPDM_ALG_REQ_STRUCT_ALG_TYPE_KEY_SCHEDULE;
+	algstruct_table[3].alg_supported = local_algorithms->key_schedule;
+
+	cmd_interface_spdm_responder_testing_send (test, testing, requester, buf, length, true);
+	CuAssertIntEquals (test, SPDM_RESPONSE_NEGOTIATE_ALGORITHMS,
+		algorithms_rsp->base.header.req_rsp_code);
+	CuAssertIntEquals (test, 4, algorithms_rsp->base.num_alg_structure_tables);
+
+	connection_info->version.major_version = SPDM_MAJOR_VERSION;
+	connection_info->version.minor_version = requester->minor_version;
+	connection_info->peer_algorithms.measurement_spec =
+		algorithms_rsp->base.measurement_specification;
+	connection_info->peer_algorithms.measurement_hash_algo =
+		algorithms_rsp->base.measurement_hash_algo;
+	connection_info->peer_algorithms.base_asym_algo = algorithms_rsp->base.base_asym_sel;
+	connection_info->peer_algorithms.base_hash_algo = algorithms_rsp->base.base_hash_sel;
+
+	for (i = 0; i < algorithms_rsp->base.num_alg_structure_tables; i++) {
+		switch (algorithms_rsp->algstruct_table[i].alg_type) {
+			case SPDM_ALG_REQ_STRUCT_ALG_TYPE_DHE:
+				connection_info->peer_algorithms.dhe_named_group =
+					algorithms_rsp->algstruct_table[i].alg_supported;
+				break;
+
+			case SPDM_ALG_REQ_STRUCT_ALG_TYPE_AEAD:
+				connection_info->peer_algorithms.aead_cipher_suite =
+					algorithms_rsp->algstruct_table[i].alg_supported;
+				break;
+
+			case SPDM_ALG_REQ_STRUCT_ALG_TYPE_KEY_SCHEDULE:
+				connection_info->peer_algorithms.key_schedule =
+					algorithms_rsp->algstruct_table[i].alg_supported;
+				break;
+		}
+	}
+
+	CuAssertIntEquals (test, SPDM_TPM_ALG_SHA_384, connection_info->peer_algorithms.base_hash_algo);
+	CuAssertIntEquals (test, SPDM_ALG_DHE_NAMED_GROUP_SECP_384_R1,
+		connection_info->peer_algorithms.dhe_named_group);
+	CuAssertIntEquals (test, SPDM_ALG_AEAD_CIPHER_SUITE_AES_256_GCM,
+		connection_info->peer_algorithms.aead_cipher_suite);
+	CuAssertIntEquals (test, SPDM_ALG_KEY_SCHEDULE_HMAC_HASH,
+		connection_info->peer_algorithms.key_schedule);
+
+	status = requester->transcript_manager.set_hash_algo (&requester->transcript_manager,
+		HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	requester->transcript_manager.set_spdm_version (&requester->transcript_manager,
+		SPDM_MAKE_VERSION (SPDM_MAJOR_VERSION, requester->minor_version));
+
+	/* GET_DIGESTS */
+	memset (buf, 0, sizeof (buf));
+	digests_rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	digests_rq->header.spdm_minor_version = requester->minor_version;
+	digests_rq->header.req_rsp_code = SPDM_REQUEST_GET_DIGESTS;
+
+	length = cmd_interface_spdm_responder_testing_send (test, testing, requester, buf,
+		sizeof (*digests_rq), false);
+	CuAssertIntEquals (test, SPDM_RESPONSE_GET_DIGESTS,
+		((struct spdm_get_digests_response*) buf)->header.req_rsp_code);
+	CuAssertIntEquals (test, sizeof (struct spdm_get_digests_response) + SHA384_HASH_LENGTH,
+		length);
+
+	memcpy (requester->cert_chain_hash, &buf[sizeof (struct spdm_get_digests_response)],
+		SHA384_HASH_LENGTH);
+}
+
+/**
+ * Start a session between a requester and the responder.  The requester derives the handshake keys
+ * from its own transcript and checks the responder HMAC.
+ *
+ * @param test				The test framework.
+ * @param testing			Testing dependencies.
+ * @param requester			The requester starting the session.
+ * @param req_session_id	The requester part of the session ID.
+ */
+static void cmd_interface_spdm_responder_testing_key_exchange (CuTest *test,
+	struct cmd_interface_spdm_responder_testing_sessions *testing,
+	struct cmd_interface_spdm_responder_testing_requester *requester, uint16_t req_session_id)
+{
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	uint8_t rq_copy[sizeof (struct spdm_key_exchange_request) + (ECC_KEY_LENGTH_384 * 2) +
+		sizeof (uint16_t)];
+	struct spdm_key_exchange_request *rq = (struct spdm_key_exchange_request*) buf;
+	struct spdm_key_exchange_response *rsp = (struct spdm_key_exchange_response*) buf;
+	const struct spdm_transcript_manager *transcript_manager = &requester->transcript_manager;
+	struct spdm_secure_session *session;
+	struct ecc_engine *ecc = &testing->req_ecc.base;
+	struct ecc_private_key priv_key;
+	struct ecc_public_key pub_key;
+	struct ecc_public_key rsp_pub_key;
+	uint8_t *pub_key_der;
+	size_t pub_key_der_len;
+	uint8_t rsp_pub_key_der[ECC_DER_MAX_PUBLIC_LENGTH];
+	uint8_t th_hash[SHA384_HASH_LENGTH];
+	uint8_t hmac[SHA384_HASH_LENGTH];
+	uint8_t *ptr;
+	uint8_t *signature;
+	size_t length;
+	int status;
+
+	memset (buf, 0, sizeof (buf));
+	rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	rq->header.spdm_minor_version = requester->minor_version;
+	rq->header.req_rsp_code = SPDM_REQUEST_KEY_EXCHANGE;
+	rq->measurement_summary_hash_type = SPDM_MEASUREMENT_SUMMARY_HASH_NONE;
+	rq->slot_id = 0;
+	rq->req_session_id = req_session_id;
+
+	status = testing->req_rng.base.generate_random_buffer (&testing->req_rng.base,
+		sizeof (rq->random_data), rq->random_data);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Add an ephemeral DHE public key.  There is no opaque data in the request. */
+	status = ecc->generate_key_pair (ecc, ECC_KEY_LENGTH_384, &priv_key, &pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc->get_public_key_der (ecc, &pub_key, &pub_key_der, &pub_key_der_len);
+	CuAssertIntEquals (test, 0, status);
+
+	ptr = &buf[sizeof (*rq)];
+	status = ecc_der_decode_public_key (pub_key_der, pub_key_der_len, ptr,
+		&ptr[ECC_KEY_LENGTH_384], ECC_KEY_LENGTH_384);
+	CuAssertTrue (test, !ROT_IS_ERROR (status));
+
+	platform_free (pub_key_der);
+	ecc->release_key_pair (ecc, NULL, &pub_key);
+
+	memcpy (rq_copy, buf, sizeof (rq_copy));
+
+	length = cmd_interface_spdm_responder_testing_send (test, testing, requester, buf,
+		sizeof (rq_copy), false);
+	CuAssertIntEquals (test, SPDM_RESPONSE_KEY_EXCHANGE, rsp->header.req_rsp_code);
+
+	requester->session_id = MAKE_SESSION_ID (req_session_id, rsp->rsp_session_id);
+
+	session = requester->session_manager.create_session (&requester->session_manager,
+		requester->session_id, true, &requester->connection_info);
+	CuAssertPtrNotNull (test, session);
+
+	/* Generate the shared secret from the responder DHE public key. */
+	ptr = &buf[sizeof (*rsp)];
+	status = ecc_der_encode_public_key (ptr, &ptr[ECC_KEY_LENGTH_384], ECC_KEY_LENGTH_384,
+		rsp_pub_key_der, sizeof (rsp_pub_key_der));
+	CuAssertTrue (test, !ROT_IS_ERROR (status));
+
+	status = ecc->init_public_key (ecc, rsp_pub_key_der, status, &rsp_pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	status = ecc->compute_shared_secret (ecc, &priv_key, &rsp_pub_key,
+		session->master_secret.dhe_secret, sizeof (session->master_secret.dhe_secret));
+	CuAssertTrue (test, !ROT_IS_ERROR (status));
+	session->dhe_key_size = status;
+
+	ecc->release_key_pair (ecc, &priv_key, NULL);
+	ecc->release_key_pair (ecc, NULL, &rsp_pub_key);
+
+	/* Find the signature and HMAC in the response. */
+	ptr += (ECC_KEY_LENGTH_384 * 2);
+	ptr += sizeof (uint16_t) + buffer_unaligned_read16 ((const uint16_t*) ptr);
+	signature = ptr;
+	ptr += (ECC_KEY_LENGTH_384 * 2);
+	CuAssertIntEquals (test, (ptr - buf) + SHA384_HASH_LENGTH, length);
+
+	/* Build the requester transcript and derive the handshake keys. */
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		requester->cert_chain_hash, SHA384_HASH_LENGTH, true, session->session_index);
+	status |= transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, rq_copy,
+		sizeof (rq_copy), true, session->session_index);
+	status |= transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, buf,
+		signature - buf, true, session->session_index);
+	status |= transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		signature, ECC_KEY_LENGTH_384 * 2, true, session->session_index);
+	CuAssertIntEquals (test, 0, status);
+
+	status = requester->session_manager.generate_session_handshake_keys (
+		&requester->session_manager, session);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Check the responder HMAC. */
+	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, false,
+		true, session->session_index, th_hash, sizeof (th_hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_generate_hmac (&testing->req_session_hash.base,
+		session->handshake_secret.response_finished_key, SHA384_HASH_LENGTH, th_hash,
+		sizeof (th_hash), HMAC_SHA384, hmac, sizeof (hmac));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (hmac, ptr, sizeof (hmac));
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, ptr,
+		SHA384_HASH_LENGTH, true, session->session_index);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_testing_swap_keys (
+		session->handshake_secret.request_handshake_encryption_key,
+		session->handshake_secret.request_handshake_salt,
+		session->handshake_secret.response_handshake_encryption_key,
+		session->handshake_secret.response_handshake_salt);
+
+	requester->session_manager.set_session_state (&requester->session_manager,
+		requester->session_id, SPDM_SESSION_STATE_HANDSHAKING);
+}
+
+/**
+ * Complete the handshake for a requester session.  The responder checks the requester HMAC, which
+ * requires the responder transcript to match the transcript for the requester.
+ *
+ * @param test		The test framework.
+ * @param testing	Testing dependencies.
+ * @param requester	The requester finishing the session handshake.
+ */
+static void cmd_interface_spdm_responder_testing_finish (CuTest *test,
+	struct cmd_interface_spdm_responder_testing_sessions *testing,
+	struct cmd_interface_spdm_responder_testing_requester *requester)
+{
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	uint8_t *payload = &buf[CMD_INTERFACE_SPDM_RESPONDER_TESTING_SECURE_HEADER_LEN];
+	struct spdm_finish_request *rq = (struct spdm_finish_request*) payload;
+	struct spdm_finish_response *rsp = (struct spdm_finish_response*) payload;
+	const struct spdm_transcript_manager *transcript_manager = &requester->transcript_manager;
+	struct spdm_secure_session *session;
+	uint8_t th_hash[SHA384_HASH_LENGTH];
+	uint8_t *hmac = &payload[sizeof (*rq)];
+	size_t length;
+	int status;
+
+	session = requester->session_manager.get_session (&requester->session_manager,
+		requester->session_id);
+	CuAssertPtrNotNull (test, session);
+
+	memset (buf, 0, sizeof (buf));
+	rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	rq->header.spdm_minor_version = requester->minor_version;
+	rq->header.req_rsp_code = SPDM_REQUEST_FINISH;
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, payload,
+		sizeof (*rq), true, session->session_index);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, false,
+		true, session->session_index, th_hash, sizeof (th_hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_generate_hmac (&testing->req_session_hash.base,
+		session->handshake_secret.request_finished_key, SHA384_HASH_LENGTH, th_hash,
+		sizeof (th_hash), HMAC_SHA384, hmac, SHA384_HASH_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, hmac,
+		SHA384_HASH_LENGTH, true, session->session_index);
+	CuAssertIntEquals (test, 0, status);
+
+	length = cmd_interface_spdm_responder_testing_send_secure (test, testing, requester, buf,
+		sizeof (*rq) + SHA384_HASH_LENGTH);
+	CuAssertIntEquals (test, sizeof (*rsp), length);
+	CuAssertIntEquals (test, SPDM_RESPONSE_FINISH, rsp->header.req_rsp_code);
+
+	/* Derive the data keys from the requester transcript. */
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, payload,
+		sizeof (*rsp), true, session->session_index);
+	CuAssertIntEquals (test, 0, status);
+
+	status = requester->session_manager.generate_session_data_keys (&requester->session_manager,
+		session);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_testing_swap_keys (
+		session->data_secret.request_data_encryption_key, session->data_secret.request_data_salt,
+		session->data_secret.response_data_encryption_key,
+		session->data_secret.response_data_salt);
+
+	requester->session_manager.set_session_state (&requester->session_manager,
+		requester->session_id, SPDM_SESSION_STATE_ESTABLISHED);
+}
+
+/**
+ * Get the number of measurements from the responder in a requester session.
+ *
+ * @param test		The test framework.
+ * @param testing	Testing dependencies.
+ * @param requester	The requester getting the measurements.
+ */
+static void cmd_interface_spdm_responder_testing_get_measurements (CuTest *test,
+	struct cmd_interface_spdm_responder_testing_sessions *testing,
+	struct cmd_interface_spdm_responder_testing_requester *requester)
+{
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	uint8_t *payload = &buf[CMD_INTERFACE_SPDM_RESPONDER_TESTING_SECURE_HEADER_LEN];
+	struct spdm_get_measurements_request *rq = (struct spdm_get_measurements_request*) payload;
+	struct spdm_get_measurements_response *rsp = (struct spdm_get_measurements_response*) payload;
+	int status;
+
+	memset (buf, 0, sizeof (buf));
+	rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	rq->header.spdm_minor_version = requester->minor_version;
+	rq->header.req_rsp_code = SPDM_REQUEST_GET_MEASUREMENTS;
+	rq->sig_required = 0;
+	rq->measurement_operation =
+		SPDM_GET_MEASUREMENTS_REQUEST_MEASUREMENT_OPERATION_TOTAL_NUMBER_OF_MEASUREMENTS;
+
+	status = mock_expect (&testing->base.measurements_mock.mock,
+		testing->base.measurements_mock.base.get_measurement_count,
+		&testing->base.measurements_mock, 4);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_testing_send_secure (test, testing, requester, buf, sizeof (*rq));
+	CuAssertIntEquals (test, SPDM_RESPONSE_GET_MEASUREMENTS, rsp->header.req_rsp_code);
+	CuAssertIntEquals (test, requester->minor_version, rsp->header.spdm_minor_version);
+	CuAssertIntEquals (test, 4, rsp->num_measurement_indices);
+}
+
 /*******************
  * Test cases
  *******************/
@@ -1120,7 +1873,8 @@ static void cmd_interface_spdm_responder_test_process_request_get_version (CuTes
 		&testing.session_manager_mock.base, 0);
 
 	status |= mock_expect (&testing.transcript_manager_mock.mock,
-		testing.transcript_manager_mock.base.reset,	&testing.transcript_manager_mock.base, 0);
+		testing.transcript_manager_mock.base.reset_connection,
+		&testing.transcript_manager_mock.base, 0);
 
 	status |= mock_expect (&testing.transcript_manager_mock.mock,
 		testing.transcript_manager_mock.base.update, &testing.transcript_manager_mock.base, 0,
@@ -1130,7 +1884,8 @@ static void cmd_interface_spdm_responder_test_process_request_get_version (CuTes
 		MOCK_ARG (SPDM_MAX_SESSION_COUNT));
 
 	status |= mock_expect (&testing.session_manager_mock.mock,
-		testing.session_manager_mock.base.reset, &testing.session_manager_mock.base, 0);
+		testing.session_manager_mock.base.release_peer_sessions,
+		&testing.session_manager_mock.base, 0, MOCK_ARG (0));
 
 	status |= mock_expect (&testing.transcript_manager_mock.mock,
 		testing.transcript_manager_mock.base.update, &testing.transcript_manager_mock.base, 0,
@@ -2999,6 +3754,137 @@ static void cmd_interface_spdm_responder_test_process_request_end_session_fail (
 	cmd_interface_spdm_responder_testing_release (test, &testing);
 }
 
+static void cmd_interface_spdm_responder_test_process_request_respond_if_ready (CuTest *test)
+{
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY] = {0};
+	uint8_t deferred[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	int status;
+	struct spdm_respond_if_ready_request *rq = (struct spdm_respond_if_ready_request*) buf;
+	struct spdm_error_response *error_response = (struct spdm_error_response*) buf;
+	struct spdm_error_response_not_ready *not_ready = (struct spdm_error_response_not_ready*)
+		spdm_get_spdm_error_rsp_optional_data (error_response);
+	struct cmd_interface_spdm_responder *spdm_responder;
+	struct spdm_state *spdm_state;
+	struct cmd_interface_spdm_responder_testing testing;
+	struct cmd_background_mock background;
+	struct ecc_engine_thread_safe ecc_async;
+	size_t sig_length = 0;
+	uint32_t sign_status = CMD_BACKGROUND_SIGN_STATUS_RUNNING;
+
+	TEST_START;
+
+	cmd_interface_spdm_responder_testing_init (test, &testing);
+	spdm_responder = &testing.spdm_responder;
+	spdm_state = spdm_responder->state;
+
+	status = cmd_background_mock_init (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (spdm_responder, &background.base,
+		&ecc_async, deferred, sizeof (deferred));
+	CuAssertIntEquals (test, 0, status);
+
+	memset (&request, 0, sizeof (request));
+	request.data = buf;
+	request.payload = (uint8_t*) rq;
+	request.max_response = sizeof (buf);
+	request.payload_length = sizeof (struct spdm_respond_if_ready_request);
+	request.length = request.payload_length;
+
+	spdm_state->connection_info.version.major_version = SPDM_MAJOR_VERSION;
+	spdm_state->connection_info.version.minor_version = 2;
+	spdm_state->response_state = SPDM_RESPONSE_STATE_NOT_READY;
+	spdm_state->connection_info.connection_state = SPDM_CONNECTION_STATE_NEGOTIATED;
+	spdm_state->deferred.request_code = SPDM_REQUEST_CHALLENGE;
+	spdm_state->deferred.token = 1;
+
+	rq->header.req_rsp_code = SPDM_REQUEST_RESPOND_IF_READY;
+	rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	rq->header.spdm_minor_version = 2;
+	rq->original_request_code = SPDM_REQUEST_CHALLENGE;
+	rq->token = 1;
+
+	status = mock_expect (&testing.session_manager_mock.mock,
+		testing.session_manager_mock.base.reset_last_session_id_validity,
+		&testing.session_manager_mock.base, 0);
+
+	status |= mock_expect (&background.mock, background.base.alias_sign_result, &background, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&background.mock, 1, &sig_length, sizeof (sig_length), -1);
+	status |= mock_expect_output (&background.mock, 2, &sign_status, sizeof (sign_status), -1);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing.spdm_responder.base.process_request (&testing.spdm_responder.base, &request);
+
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test,
+		sizeof (struct spdm_error_response) + sizeof (struct spdm_error_response_not_ready),
+		request.payload_length);
+	CuAssertIntEquals (test, SPDM_RESPONSE_ERROR, error_response->header.req_rsp_code);
+	CuAssertIntEquals (test, SPDM_ERROR_RESPONSE_NOT_READY, error_response->error_code);
+	CuAssertIntEquals (test, SPDM_REQUEST_CHALLENGE, not_ready->request_code);
+	CuAssertIntEquals (test, 1, not_ready->token);
+
+	status = cmd_background_mock_validate_and_release (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_testing_release (test, &testing);
+}
+
+static void cmd_interface_spdm_responder_test_process_request_respond_if_ready_fail (
+	CuTest *test)
+{
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY] = {0};
+	struct cmd_interface_msg request;
+	int status;
+	struct spdm_respond_if_ready_request *rq = (struct spdm_respond_if_ready_request*) buf;
+	struct spdm_error_response *error_response = (struct spdm_error_response*) buf;
+	struct cmd_interface_spdm_responder *spdm_responder;
+	struct spdm_state *spdm_state;
+	struct cmd_interface_spdm_responder_testing testing;
+
+	TEST_START;
+
+	cmd_interface_spdm_responder_testing_init (test, &testing);
+	spdm_responder = &testing.spdm_responder;
+	spdm_state = spdm_responder->state;
+
+	memset (&request, 0, sizeof (request));
+	request.data = buf;
+	request.payload = (uint8_t*) rq;
+	request.max_response = sizeof (buf);
+	request.payload_length = sizeof (struct spdm_respond_if_ready_request);
+	request.length = request.payload_length;
+
+	spdm_state->connection_info.version.major_version = SPDM_MAJOR_VERSION;
+	spdm_state->connection_info.version.minor_version = 2;
+	spdm_state->response_state = SPDM_RESPONSE_STATE_NORMAL;
+	spdm_state->connection_info.connection_state = SPDM_CONNECTION_STATE_NEGOTIATED;
+
+	rq->header.req_rsp_code = SPDM_REQUEST_RESPOND_IF_READY;
+	rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	rq->header.spdm_minor_version = 2;
+	rq->original_request_code = SPDM_REQUEST_CHALLENGE;
+	rq->token = 1;
+
+	status = mock_expect (&testing.session_manager_mock.mock,
+		testing.session_manager_mock.base.reset_last_session_id_validity,
+		&testing.session_manager_mock.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing.spdm_responder.base.process_request (&testing.spdm_responder.base, &request);
+
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, SPDM_ERROR_UNEXPECTED_REQUEST, error_response->error_code);
+	CuAssertIntEquals (test, 0, error_response->error_data);
+	CuAssertIntEquals (test, SPDM_RESPONSE_ERROR, error_response->header.req_rsp_code);
+	CuAssertIntEquals (test, sizeof (struct spdm_error_response), request.payload_length);
+
+	cmd_interface_spdm_responder_testing_release (test, &testing);
+}
+
 static void cmd_interface_spdm_responder_test_process_request_vdm (CuTest *test)
 {
 	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY] = {0};
@@ -3095,7 +3981,13 @@ static void cmd_interface_spdm_responder_test_process_request_vdm_encrypt (CuTes
 	rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
 	rq->header.spdm_minor_version = 2;
 
+	session.session_id = 0xDEADBEEF;
 	session.session_state = SPDM_SESSION_STATE_ESTABLISHED;
+	session.connection_info = spdm_state->connection_info;
+
+	/* The connection state for a different requester should not be used for the session. */
+	spdm_state->connection_info.version.minor_version = 0;
+	spdm_state->connection_info.connection_state = SPDM_CONNECTION_STATE_AFTER_VERSION;
 
 	status = mock_expect (&testing.session_manager_mock.mock,
 		testing.session_manager_mock.base.reset_last_session_id_validity,
@@ -3105,6 +3997,14 @@ static void cmd_interface_spdm_responder_test_process_request_vdm_encrypt (CuTes
 		testing.session_manager_mock.base.decode_secure_message, &testing.session_manager_mock.base,
 		0, MOCK_ARG_PTR (&request));
 
+	status |= mock_expect (&testing.session_manager_mock.mock,
+		testing.session_manager_mock.base.get_last_session_id, &testing.session_manager_mock.base,
+		0xDEADBEEF);
+
+	status |= mock_expect (&testing.session_manager_mock.mock,
+		testing.session_manager_mock.base.get_session, &testing.session_manager_mock.base,
+		MOCK_RETURN_PTR (&session), MOCK_ARG (0xDEADBEEF));
+
 	status |= mock_expect (&testing.session_manager_mock.mock,
 		testing.session_manager_mock.base.is_last_session_id_valid,
 		&testing.session_manager_mock.base, 1);
@@ -3137,6 +4037,10 @@ static void cmd_interface_spdm_responder_test_process_request_vdm_encrypt (CuTes
 	CuAssertIntEquals (test, SPDM_MAJOR_VERSION, rsp->header.spdm_major_version);
 	CuAssertIntEquals (test, SPDM_RESPONSE_VENDOR_DEFINED_REQUEST, rsp->header.req_rsp_code);
 
+	CuAssertIntEquals (test, 0, spdm_state->connection_info.version.minor_version);
+	CuAssertIntEquals (test, SPDM_CONNECTION_STATE_AFTER_VERSION,
+		spdm_state->connection_info.connection_state);
+
 	cmd_interface_spdm_responder_testing_release (test, &testing);
 }
 
@@ -3267,7 +4171,7 @@ static void cmd_interface_spdm_responder_test_process_request_unsupported_reques
 
 	rq->header.spdm_minor_version = 0;
 	rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
-	rq->header.req_rsp_code = -1;
+	rq->header.req_rsp_code = SPDM_REQUEST_HEARTBEAT;
 	rq->reserved = 0;
 	rq->reserved2 = 0;
 
@@ -3308,6 +4212,274 @@ static void cmd_interface_spdm_responder_test_process_response (
 }
 
 
+static void cmd_interface_spdm_responder_test_enable_async_signing (CuTest *test)
+{
+	struct cmd_interface_spdm_responder_testing testing;
+	struct cmd_background_mock background;
+	struct ecc_engine_thread_safe ecc_async;
+	uint8_t deferred[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	int status;
+
+	TEST_START;
+
+	cmd_interface_spdm_responder_testing_init (test, &testing);
+
+	status = cmd_background_mock_init (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, NULL, (void*) testing.spdm_responder.background);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&testing.spdm_responder,
+		&background.base, &ecc_async, deferred, sizeof (deferred));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, &background.base, (void*) testing.spdm_responder.background);
+	CuAssertPtrEquals (test, deferred, testing.spdm_responder.deferred_response);
+	CuAssertIntEquals (test, sizeof (deferred), testing.spdm_responder.deferred_length);
+
+	/* The responder ECC engine is shared with the background task. */
+	CuAssertPtrEquals (test, &ecc_async.base, testing.spdm_responder.ecc_engine);
+	CuAssertPtrEquals (test, &testing.ecc_mock.base, ecc_async.engine);
+
+	status = cmd_background_mock_validate_and_release (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_testing_release (test, &testing);
+}
+
+static void cmd_interface_spdm_responder_test_enable_async_signing_static_init (CuTest *test)
+{
+	struct cmd_interface_spdm_responder_testing testing;
+	struct cmd_background_mock background;
+	struct ecc_engine_thread_safe ecc_async;
+	uint8_t deferred[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	int status;
+
+	TEST_START;
+
+	cmd_interface_spdm_responder_testing_init_dependencies (test, &testing);
+
+	struct cmd_interface_spdm_responder spdm_responder =
+		cmd_interface_spdm_responder_static_init (&testing.spdm_responder_state,
+		&testing.transcript_manager_mock.base, testing.hash_engine,
+		ARRAY_SIZE (testing.hash_engine), testing.version_num, ARRAY_SIZE (testing.version_num),
+		testing.secure_message_version_num, ARRAY_SIZE (testing.secure_message_version_num),
+		&testing.local_capabilities, &testing.local_algorithms, &testing.key_manager,
+		&testing.measurements_mock.base, &testing.ecc_mock.base, &testing.rng_mock.base,
+		&testing.session_manager_mock.base, &testing.vdm_mock.base);
+
+	status = cmd_interface_spdm_responder_init_state (&spdm_responder);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_background_mock_init (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, NULL, (void*) spdm_responder.background);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&spdm_responder, &background.base,
+		&ecc_async, deferred, sizeof (deferred));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, &background.base, (void*) spdm_responder.background);
+	CuAssertPtrEquals (test, deferred, spdm_responder.deferred_response);
+	CuAssertIntEquals (test, sizeof (deferred), spdm_responder.deferred_length);
+	CuAssertPtrEquals (test, &ecc_async.base, spdm_responder.ecc_engine);
+	CuAssertPtrEquals (test, &testing.ecc_mock.base, ecc_async.engine);
+
+	status = cmd_background_mock_validate_and_release (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_deinit (&spdm_responder);
+
+	cmd_interface_spdm_responder_testing_release_dependencies (test, &testing);
+}
+
+static void cmd_interface_spdm_responder_test_enable_async_signing_disable (CuTest *test)
+{
+	struct cmd_interface_spdm_responder_testing testing;
+	struct cmd_background_mock background;
+	struct ecc_engine_thread_safe ecc_async;
+	uint8_t deferred[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	int status;
+
+	TEST_START;
+
+	cmd_interface_spdm_responder_testing_init (test, &testing);
+
+	status = cmd_background_mock_init (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&testing.spdm_responder,
+		&background.base, &ecc_async, deferred, sizeof (deferred));
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&testing.spdm_responder, NULL,
+		NULL, deferred, sizeof (deferred));
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrEquals (test, NULL, (void*) testing.spdm_responder.background);
+	CuAssertPtrEquals (test, NULL, testing.spdm_responder.deferred_response);
+	CuAssertIntEquals (test, 0, testing.spdm_responder.deferred_length);
+	CuAssertPtrEquals (test, &testing.ecc_mock.base, testing.spdm_responder.ecc_engine);
+	CuAssertPtrEquals (test, NULL, testing.spdm_responder.async_ecc);
+
+	status = cmd_background_mock_validate_and_release (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_testing_release (test, &testing);
+}
+
+static void cmd_interface_spdm_responder_test_enable_async_signing_response_not_ready (
+	CuTest *test)
+{
+	struct cmd_interface_spdm_responder_testing testing;
+	struct cmd_background_mock background;
+	struct ecc_engine_thread_safe ecc_async;
+	uint8_t deferred[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	int status;
+
+	TEST_START;
+
+	cmd_interface_spdm_responder_testing_init (test, &testing);
+
+	status = cmd_background_mock_init (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&testing.spdm_responder,
+		&background.base, &ecc_async, deferred, sizeof (deferred));
+	CuAssertIntEquals (test, 0, status);
+
+	testing.spdm_responder_state.response_state = SPDM_RESPONSE_STATE_NOT_READY;
+	testing.spdm_responder_state.deferred.request_code = SPDM_REQUEST_CHALLENGE;
+
+	/* Changing the configuration drops the response waiting for a signature. */
+	status = cmd_interface_spdm_responder_enable_async_signing (&testing.spdm_responder, NULL,
+		NULL, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, SPDM_RESPONSE_STATE_NORMAL,
+		testing.spdm_responder_state.response_state);
+	CuAssertIntEquals (test, 0, testing.spdm_responder_state.deferred.request_code);
+
+	status = cmd_background_mock_validate_and_release (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_testing_release (test, &testing);
+}
+
+static void cmd_interface_spdm_responder_test_enable_async_signing_invalid_arg (CuTest *test)
+{
+	struct cmd_interface_spdm_responder_testing testing;
+	struct cmd_background_mock background;
+	struct ecc_engine_thread_safe ecc_async;
+	uint8_t deferred[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	int status;
+
+	TEST_START;
+
+	cmd_interface_spdm_responder_testing_init (test, &testing);
+
+	status = cmd_background_mock_init (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (NULL, &background.base,
+		&ecc_async, deferred, sizeof (deferred));
+	CuAssertIntEquals (test, CMD_HANDLER_SPDM_RESPONDER_INVALID_ARGUMENT, status);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&testing.spdm_responder,
+		&background.base, NULL, deferred, sizeof (deferred));
+	CuAssertIntEquals (test, CMD_HANDLER_SPDM_RESPONDER_INVALID_ARGUMENT, status);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&testing.spdm_responder,
+		&background.base, &ecc_async, NULL, sizeof (deferred));
+	CuAssertIntEquals (test, CMD_HANDLER_SPDM_RESPONDER_INVALID_ARGUMENT, status);
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&testing.spdm_responder,
+		&background.base, &ecc_async, deferred, 0);
+	CuAssertIntEquals (test, CMD_HANDLER_SPDM_RESPONDER_INVALID_ARGUMENT, status);
+
+	CuAssertPtrEquals (test, NULL, (void*) testing.spdm_responder.background);
+	CuAssertPtrEquals (test, &testing.ecc_mock.base, testing.spdm_responder.ecc_engine);
+
+	status = cmd_background_mock_validate_and_release (&background);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_interface_spdm_responder_testing_release (test, &testing);
+}
+
+static void cmd_interface_spdm_responder_test_process_request_multiple_requesters (CuTest *test)
+{
+	struct cmd_interface_spdm_responder_testing_sessions testing;
+	struct cmd_interface_spdm_responder_testing_requester *requester_a = &testing.requester[0];
+	struct cmd_interface_spdm_responder_testing_requester *requester_b = &testing.requester[1];
+	struct cmd_interface_spdm_responder_testing_requester *requester_c = &testing.requester[2];
+	struct cmd_interface_spdm_responder_testing_requester *requester;
+	struct spdm_secure_session_manager_stats stats;
+	struct spdm_secure_session *session;
+	uint32_t old_session_id;
+	size_t i;
+	int status;
+
+	TEST_START;
+
+	cmd_interface_spdm_responder_testing_init_sessions (test, &testing);
+
+	/* Interleave connection negotiation and session handshakes from each requester. */
+	cmd_interface_spdm_responder_testing_connect (test, &testing, requester_a);
+	cmd_interface_spdm_responder_testing_key_exchange (test, &testing, requester_a, 0x100);
+
+	cmd_interface_spdm_responder_testing_connect (test, &testing, requester_b);
+	cmd_interface_spdm_responder_testing_key_exchange (test, &testing, requester_b, 0x200);
+
+	cmd_interface_spdm_responder_testing_finish (test, &testing, requester_a);
+
+	cmd_interface_spdm_responder_testing_connect (test, &testing, requester_c);
+
+	cmd_interface_spdm_responder_testing_finish (test, &testing, requester_b);
+	cmd_interface_spdm_responder_testing_get_measurements (test, &testing, requester_a);
+
+	cmd_interface_spdm_responder_testing_key_exchange (test, &testing, requester_c, 0x300);
+	cmd_interface_spdm_responder_testing_get_measurements (test, &testing, requester_b);
+	cmd_interface_spdm_responder_testing_finish (test, &testing, requester_c);
+	cmd_interface_spdm_responder_testing_get_measurements (test, &testing, requester_c);
+
+	for (i = 0; i < ARRAY_SIZE (testing.requester); i++) {
+		requester = &testing.requester[i];
+
+		session = testing.session_manager.get_session (&testing.session_manager,
+			requester->session_id);
+		CuAssertPtrNotNull (test, session);
+		CuAssertIntEquals (test, SPDM_SESSION_STATE_ESTABLISHED, session->session_state);
+		CuAssertIntEquals (test, requester->eid, session->connection_info.peer_eid);
+		CuAssertIntEquals (test, requester->minor_version,
+			session->connection_info.version.minor_version);
+	}
+
+	/* A new connection from one requester only discards the sessions for that requester. */
+	old_session_id = requester_a->session_id;
+	cmd_interface_spdm_responder_testing_connect (test, &testing, requester_a);
+
+	session = testing.session_manager.get_session (&testing.session_manager, old_session_id);
+	CuAssertPtrEquals (test, NULL, session);
+
+	cmd_interface_spdm_responder_testing_get_measurements (test, &testing, requester_b);
+	cmd_interface_spdm_responder_testing_get_measurements (test, &testing, requester_c);
+
+	cmd_interface_spdm_responder_testing_key_exchange (test, &testing, requester_a, 0x101);
+	cmd_interface_spdm_responder_testing_get_measurements (test, &testing, requester_b);
+	cmd_interface_spdm_responder_testing_finish (test, &testing, requester_a);
+	cmd_interface_spdm_responder_testing_get_measurements (test, &testing, requester_a);
+	cmd_interface_spdm_responder_testing_get_measurements (test, &testing, requester_c);
+
+	status = spdm_secure_session_manager_get_stats (&testing.session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, ARRAY_SIZE (testing.requester), stats.active_sessions);
+	CuAssertIntEquals (test, ARRAY_SIZE (testing.requester), stats.peak_sessions);
+	CuAssertIntEquals (test, 0, stats.reclaimed_sessions);
+
+	cmd_interface_spdm_responder_testing_release_sessions (test, &testing);
+}
+
 // *INDENT-OFF*
 TEST_SUITE_START (cmd_interface_spdm_responder);
 
@@ -3347,6 +4519,8 @@ TEST (cmd_interface_spdm_responder_test_process_request_finish);
 TEST (cmd_interface_spdm_responder_test_process_request_finish_fail);
 TEST (cmd_interface_spdm_responder_test_process_request_end_session);
 TEST (cmd_interface_spdm_responder_test_process_request_end_session_fail);
+TEST (cmd_interface_spdm_responder_test_process_request_respond_if_ready);
+TEST (cmd_interface_spdm_responder_test_process_request_respond_if_ready_fail);
 TEST (cmd_interface_spdm_responder_test_process_request_vdm);
 TEST (cmd_interface_spdm_responder_test_process_request_vdm_encrypt);
 TEST (cmd_interface_spdm_responder_test_process_request_vdm_fail);
@@ -3354,6 +4528,12 @@ TEST (cmd_interface_spdm_responder_test_process_request_invalid_arg);
 TEST (cmd_interface_spdm_responder_test_process_request_spdm_get_command_id_failure_short_payload);
 TEST (cmd_interface_spdm_responder_test_process_request_unsupported_request_code);
 TEST (cmd_interface_spdm_responder_test_process_response);
+TEST (cmd_interface_spdm_responder_test_enable_async_signing);
+TEST (cmd_interface_spdm_responder_test_enable_async_signing_static_init);
+TEST (cmd_interface_spdm_responder_test_enable_async_signing_disable);
+TEST (cmd_interface_spdm_responder_test_enable_async_signing_response_not_ready);
+TEST (cmd_interface_spdm_responder_test_enable_async_signing_invalid_arg);
+TEST (cmd_interface_spdm_responder_test_process_request_multiple_requesters);
 
 TEST_SUITE_END;
 // *INDENT-ON*
@@ -12,6 +12,7 @@
 #include "testing/crypto/ecc_testing.h"
 #include "testing/engines/aes_testing_engine.h"
 #include "testing/engines/ecc_testing_engine.h"
+#include "testing/engines/hash_testing_engine.h"
 #include "testing/mock/crypto/aes_mock.h"
 #include "testing/mock/crypto/ecc_mock.h"
 #include "testing/mock/crypto/hash_mock.h"
@@ -210,6 +211,178 @@ static void spdm_secure_session_manager_testing_release (CuTest *test,
 	spdm_secure_session_manager_testing_release_dependencies (test, testing);
 }
 
+
+/**
+ * Helper to set up the connection information for an encrypted SPDM 1.2 session.
+ *
+ * @param connection_info The connection information to initialize.
+ */
+static void spdm_secure_session_manager_testing_init_connection_info (
+	struct spdm_connection_info *connection_info)
+{
+	memset (connection_info, 0, sizeof (*connection_info));
+
+	connection_info->version.major_version = 1;
+	connection_info->version.minor_version = 2;
+	connection_info->secure_message_version.major_version = 1;
+	connection_info->secure_message_version.minor_version = 2;
+
+	connection_info->peer_algorithms.base_hash_algo = SPDM_TPM_ALG_SHA_384;
+	connection_info->peer_algorithms.dhe_named_group = SPDM_ALG_DHE_NAMED_GROUP_SECP_384_R1;
+	connection_info->peer_algorithms.aead_cipher_suite = SPDM_ALG_AEAD_CIPHER_SUITE_AES_256_GCM;
+	connection_info->peer_algorithms.key_schedule = SPDM_ALG_KEY_SCHEDULE_HMAC_HASH;
+
+	connection_info->peer_capabilities.flags.encrypt_cap = 1;
+	connection_info->peer_capabilities.flags.mac_cap = 1;
+	connection_info->peer_capabilities.flags.key_ex_cap = 1;
+}
+
+/**
+ * Helper to generate the AEAD IV for a secured message.
+ *
+ * @param salt The salt for the message direction.
+ * @param sequence_number Sequence number of the message.
+ * @param iv Output for the IV.  This must be SPDM_MAX_AEAD_IV_SIZE bytes.
+ */
+static void spdm_secure_session_manager_testing_generate_iv (const uint8_t *salt,
+	uint64_t sequence_number, uint8_t *iv)
+{
+	size_t i;
+
+	memcpy (iv, salt, SPDM_MAX_AEAD_IV_SIZE);
+	for (i = 0; i < sizeof (sequence_number); i++) {
+		iv[i] ^= (uint8_t) (sequence_number >> (i * 8));
+	}
+}
+
+/**
+ * Helper to build an AES-256-GCM secured request message the way a requester would.
+ *
+ * @param test The test framework.
+ * @param aes The AES engine to use for encryption.
+ * @param session_id The session ID for the message.
+ * @param key The request encryption key.
+ * @param salt The request salt.
+ * @param sequence_number The request sequence number.
+ * @param message The SPDM message to encrypt.
+ * @param length Length of the SPDM message.
+ * @param buffer Buffer to build the secured message in.
+ * @param buffer_length Length of the message buffer.
+ * @param request Output for the secured request message.
+ */
+static void spdm_secure_session_manager_testing_encrypt_request (CuTest *test,
+	struct aes_engine *aes, uint32_t session_id, const uint8_t *key, const uint8_t *salt,
+	uint64_t sequence_number, const uint8_t *message, size_t length, uint8_t *buffer,
+	size_t buffer_length, struct cmd_interface_msg *request)
+{
+	struct spdm_secured_message_data_header_1 *header_1 = (void*) buffer;
+	struct spdm_secured_message_data_header_2 *header_2 = (void*) (header_1 + 1);
+	struct spdm_secured_message_cipher_header *cipher_header = (void*) (header_2 + 1);
+	size_t header_length = sizeof (*header_1) + sizeof (*header_2);
+	size_t plaintext_length = sizeof (*cipher_header) + length;
+	uint8_t *tag = (uint8_t*) cipher_header + plaintext_length;
+	uint8_t iv[SPDM_MAX_AEAD_IV_SIZE];
+	int status;
+
+	header_1->session_id = session_id;
+	header_2->length = plaintext_length + AES_TAG_LENGTH;
+	cipher_header->application_data_length = length;
+	memcpy (cipher_header + 1, message, length);
+
+	spdm_secure_session_manager_testing_generate_iv (salt, sequence_number, iv);
+
+	status = aes->set_key (aes, key, SPDM_MAX_AEAD_KEY_SIZE);
+	CuAssertIntEquals (test, 0, status);
+
+	status = aes->encrypt_with_add_data (aes, (uint8_t*) cipher_header, plaintext_length, iv,
+		SPDM_MAX_AEAD_IV_SIZE, buffer, header_length, (uint8_t*) cipher_header, plaintext_length, tag,
+		AES_TAG_LENGTH);
+	CuAssertIntEquals (test, 0, status);
+
+	memset (request, 0, sizeof (*request));
+	request->data = buffer;
+	request->length = header_length + plaintext_length + AES_TAG_LENGTH;
+	request->payload = buffer;
+	request->payload_length = request->length;
+	request->max_response = buffer_length;
+}
+
+/**
+ * Helper to decrypt an AES-256-GCM secured response message the way a requester would.
+ *
+ * @param test The test framework.
+ * @param aes The AES engine to use for decryption.
+ * @param session_id The expected session ID for the message.
+ * @param key The response encryption key.
+ * @param salt The response salt.
+ * @param sequence_number The response sequence number.
+ * @param response The secured response message.  The message is decrypted in place.
+ *
+ * @return The decrypted SPDM message.
+ */
+static const uint8_t* spdm_secure_session_manager_testing_decrypt_response (CuTest *test,
+	struct aes_engine *aes, uint32_t session_id, const uint8_t *key, const uint8_t *salt,
+	uint64_t sequence_number, struct cmd_interface_msg *response)
+{
+	struct spdm_secured_message_data_header_1 *header_1 = (void*) response->payload;
+	struct spdm_secured_message_data_header_2 *header_2 = (void*) (header_1 + 1);
+	struct spdm_secured_message_cipher_header *cipher_header = (void*) (header_2 + 1);
+	size_t header_length = sizeof (*header_1) + sizeof (*header_2);
+	size_t ciphertext_length;
+	uint8_t iv[SPDM_MAX_AEAD_IV_SIZE];
+	int status;
+
+	CuAssertIntEquals (test, session_id, header_1->session_id);
+	CuAssertIntEquals (test, response->payload_length - header_length, header_2->length);
+
+	ciphertext_length = header_2->length - AES_TAG_LENGTH;
+	spdm_secure_session_manager_testing_generate_iv (salt, sequence_number, iv);
+
+	status = aes->set_key (aes, key, SPDM_MAX_AEAD_KEY_SIZE);
+	CuAssertIntEquals (test, 0, status);
+
+	status = aes->decrypt_with_add_data (aes, (uint8_t*) cipher_header, ciphertext_length,
+		(uint8_t*) cipher_header + ciphertext_length, iv, SPDM_MAX_AEAD_IV_SIZE, response->payload,
+		header_length, (uint8_t*) cipher_header, ciphertext_length);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, ciphertext_length - sizeof (*cipher_header),
+		cipher_header->application_data_length);
+
+	return (const uint8_t*) (cipher_header + 1);
+}
+
+/**
+ * Helper to build a secured request message for a session that uses mock AES engines.  The message
+ * is not actually encrypted.
+ *
+ * @param session_id The session ID for the message.
+ * @param buffer Buffer to build the secured message in.  This must be at least
+ * MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY bytes.
+ * @param request Output for the secured request message.
+ */
+static void spdm_secure_session_manager_testing_build_mock_request (uint32_t session_id,
+	uint8_t *buffer, struct cmd_interface_msg *request)
+{
+	struct spdm_secured_message_data_header_1 *header_1 = (void*) buffer;
+	struct spdm_secured_message_data_header_2 *header_2 = (void*) (header_1 + 1);
+	struct spdm_secured_message_cipher_header *cipher_header = (void*) (header_2 + 1);
+	size_t encrypted_payload_length = 64;
+
+	memset (buffer, 0, MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY);
+	header_1->session_id = session_id;
+	header_2->length = encrypted_payload_length + AES_TAG_LENGTH;
+	cipher_header->application_data_length = encrypted_payload_length - 1;
+
+	memset (request, 0, sizeof (*request));
+	request->data = buffer;
+	request->payload = buffer;
+	request->payload_length = sizeof (*header_1) + sizeof (*header_2) + encrypted_payload_length +
+		AES_TAG_LENGTH;
+	request->length = request->payload_length;
+	request->max_response = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+}
+
 /*******************
  * Test cases
  *******************/
@@ -236,6 +409,7 @@ static void spdm_secure_session_manager_test_static_init (CuTest *test)
 	CuAssertPtrNotNull (test, session_manager.get_session);
 	CuAssertPtrNotNull (test, session_manager.set_session_state);
 	CuAssertPtrNotNull (test, session_manager.reset);
+	CuAssertPtrNotNull (test, session_manager.release_peer_sessions);
 	CuAssertPtrNotNull (test, session_manager.generate_shared_secret);
 	CuAssertPtrNotNull (test, session_manager.generate_session_handshake_keys);
 	CuAssertPtrNotNull (test, session_manager.generate_session_data_keys);
@@ -373,6 +547,7 @@ static void spdm_secure_session_manager_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, testing.session_manager.get_session);
 	CuAssertPtrNotNull (test, testing.session_manager.set_session_state);
 	CuAssertPtrNotNull (test, testing.session_manager.reset);
+	CuAssertPtrNotNull (test, testing.session_manager.release_peer_sessions);
 	CuAssertPtrNotNull (test, testing.session_manager.generate_shared_secret);
 	CuAssertPtrNotNull (test, testing.session_manager.generate_session_handshake_keys);
 	CuAssertPtrNotNull (test, testing.session_manager.generate_session_data_keys);
@@ -682,6 +857,326 @@ static void spdm_secure_session_manager_test_create_session_duplicate_session (C
 	spdm_secure_session_manager_testing_release (test, &testing);
 }
 
+static void spdm_secure_session_manager_test_create_session_multiple_sessions (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	uint32_t session_id[SPDM_MAX_SESSION_COUNT];
+	struct spdm_secure_session *session[SPDM_MAX_SESSION_COUNT];
+	size_t released = SPDM_MAX_SESSION_COUNT / 2;
+	uint8_t i;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	/* All session IDs use the same lookup bucket. */
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		session_id[i] = MAKE_SESSION_ID (0x100 + i, 0x100 + i);
+
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+			MOCK_ARG (true), MOCK_ARG (i));
+		CuAssertIntEquals (test, 0, status);
+
+		session[i] = session_manager->create_session (session_manager, session_id[i], false,
+			&connection_info);
+		CuAssertPtrNotNull (test, session[i]);
+		CuAssertIntEquals (test, i, session[i]->session_index);
+	}
+
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT, session_manager->state->current_session_count);
+
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		CuAssertPtrEquals (test, session[i],
+			session_manager->get_session (session_manager, session_id[i]));
+	}
+
+	/* Release a session in the middle of the lookup chain. */
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (released));
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager->release_session (session_manager, session_id[released]);
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT - 1,
+		session_manager->state->current_session_count);
+
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		if (i == released) {
+			CuAssertPtrEquals (test, NULL,
+				session_manager->get_session (session_manager, session_id[i]));
+		}
+		else {
+			CuAssertPtrEquals (test, session[i],
+				session_manager->get_session (session_manager, session_id[i]));
+		}
+	}
+
+	/* The released slot is used for the next session. */
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (released));
+	CuAssertIntEquals (test, 0, status);
+
+	session[released] = session_manager->create_session (session_manager, 0xDEADBEEF, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session[released]);
+	CuAssertIntEquals (test, released, session[released]->session_index);
+	CuAssertPtrEquals (test, session[released],
+		session_manager->get_session (session_manager, 0xDEADBEEF));
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_create_session_reclaim_idle_session (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session *session;
+	size_t idle = SPDM_MAX_SESSION_COUNT - 1;
+	uint8_t i;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	/* Make sure idle times are correct when the activity count wraps. */
+	session_manager->state->activity_count = 0xfffffffa;
+
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+			MOCK_ARG (true), MOCK_ARG (i));
+		CuAssertIntEquals (test, 0, status);
+
+		session = session_manager->create_session (session_manager, 0x1000 + i, false,
+			&connection_info);
+		CuAssertPtrNotNull (test, session);
+	}
+
+	/* Use every session except the last one. */
+	for (i = 0; i < idle; i++) {
+		session_manager->state->sessions[i].last_activity =
+			++session_manager->state->activity_count;
+	}
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (idle));
+
+	status |= mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (idle));
+
+	CuAssertIntEquals (test, 0, status);
+
+	session = session_manager->create_session (session_manager, 0xDEADBEEF, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+	CuAssertIntEquals (test, idle, session->session_index);
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT, session_manager->state->current_session_count);
+	CuAssertIntEquals (test, 1, session_manager->state->reclaimed_session_count);
+
+	CuAssertPtrEquals (test, NULL, session_manager->get_session (session_manager, 0x1000 + idle));
+	CuAssertPtrEquals (test, session, session_manager->get_session (session_manager, 0xDEADBEEF));
+	for (i = 0; i < idle; i++) {
+		CuAssertPtrNotNull (test, session_manager->get_session (session_manager, 0x1000 + i));
+	}
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_create_session_reclaim_skip_last_session (
+	CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session *session;
+	uint8_t i;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+			MOCK_ARG (true), MOCK_ARG (i));
+		CuAssertIntEquals (test, 0, status);
+
+		session = session_manager->create_session (session_manager, 0x1000 + i, false,
+			&connection_info);
+		CuAssertPtrNotNull (test, session);
+	}
+
+	/* The oldest session is processing the current request, so it can't be released. */
+	session_manager->state->last_spdm_request_secure_session_id = 0x1000;
+	session_manager->state->last_spdm_request_secure_session_id_valid = true;
+
+	if (SPDM_MAX_SESSION_COUNT > 1) {
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_session_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (1));
+
+		status |= mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+			MOCK_ARG (true), MOCK_ARG (1));
+
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	session = session_manager->create_session (session_manager, 0xDEADBEEF, false,
+		&connection_info);
+	if (SPDM_MAX_SESSION_COUNT > 1) {
+		CuAssertPtrNotNull (test, session);
+		CuAssertIntEquals (test, 1, session->session_index);
+		CuAssertPtrEquals (test, NULL, session_manager->get_session (session_manager, 0x1001));
+	}
+	else {
+		CuAssertPtrEquals (test, NULL, session);
+	}
+
+	CuAssertPtrNotNull (test, session_manager->get_session (session_manager, 0x1000));
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_create_session_reclaim_skip_established_session (
+	CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session *session;
+	size_t reclaimed = 0;
+	uint8_t i;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+			MOCK_ARG (true), MOCK_ARG (i));
+		CuAssertIntEquals (test, 0, status);
+
+		session = session_manager->create_session (session_manager, 0x1000 + i, false,
+			&connection_info);
+		CuAssertPtrNotNull (test, session);
+
+		session_manager->set_session_state (session_manager, 0x1000 + i,
+			SPDM_SESSION_STATE_HANDSHAKING);
+	}
+
+	/* The oldest session finished the handshake, so it must not be displaced by new sessions. */
+	session_manager->set_session_state (session_manager, 0x1000, SPDM_SESSION_STATE_ESTABLISHED);
+
+	/* Flood the responder with key exchanges.  Each one replaces a session that has not finished
+	 * the handshake. */
+	for (i = 0; i < (SPDM_MAX_SESSION_COUNT * 2); i++) {
+		if (SPDM_MAX_SESSION_COUNT > 1) {
+			reclaimed = 1 + (i % (SPDM_MAX_SESSION_COUNT - 1));
+
+			status = mock_expect (&testing.transcript_manager_mock.mock,
+				testing.transcript_manager_mock.base.reset_session_transcript,
+				&testing.transcript_manager_mock.base, 0, MOCK_ARG (reclaimed));
+
+			status |= mock_expect (&testing.transcript_manager_mock.mock,
+				testing.transcript_manager_mock.base.reset_transcript,
+				&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+				MOCK_ARG (true), MOCK_ARG (reclaimed));
+
+			CuAssertIntEquals (test, 0, status);
+		}
+
+		session = session_manager->create_session (session_manager, 0x2000 + i, false,
+			&connection_info);
+		if (SPDM_MAX_SESSION_COUNT > 1) {
+			CuAssertPtrNotNull (test, session);
+			CuAssertIntEquals (test, reclaimed, session->session_index);
+		}
+		else {
+			CuAssertPtrEquals (test, NULL, session);
+		}
+
+		session = session_manager->get_session (session_manager, 0x1000);
+		CuAssertPtrNotNull (test, session);
+		CuAssertIntEquals (test, 0, session->session_index);
+		CuAssertIntEquals (test, SPDM_SESSION_STATE_ESTABLISHED, session->session_state);
+	}
+
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT, session_manager->state->current_session_count);
+	CuAssertIntEquals (test, (SPDM_MAX_SESSION_COUNT > 1) ? (SPDM_MAX_SESSION_COUNT * 2) : 0,
+		session_manager->state->reclaimed_session_count);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_create_session_all_sessions_established (
+	CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session *session;
+	uint8_t i;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+			MOCK_ARG (true), MOCK_ARG (i));
+		CuAssertIntEquals (test, 0, status);
+
+		session = session_manager->create_session (session_manager, 0x1000 + i, false,
+			&connection_info);
+		CuAssertPtrNotNull (test, session);
+
+		session_manager->set_session_state (session_manager, 0x1000 + i,
+			SPDM_SESSION_STATE_ESTABLISHED);
+	}
+
+	session = session_manager->create_session (session_manager, 0xDEADBEEF, false,
+		&connection_info);
+	CuAssertPtrEquals (test, NULL, session);
+
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT, session_manager->state->current_session_count);
+	CuAssertIntEquals (test, 0, session_manager->state->reclaimed_session_count);
+	CuAssertPtrEquals (test, NULL, session_manager->get_session (session_manager, 0xDEADBEEF));
+
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		CuAssertPtrNotNull (test, session_manager->get_session (session_manager, 0x1000 + i));
+	}
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
 static void spdm_secure_session_manager_test_release_session (CuTest *test)
 {
 	int status;
@@ -912,6 +1407,7 @@ static void spdm_secure_session_manager_test_reset (CuTest *test)
 	struct spdm_connection_info connection_info = {0};
 	uint32_t session_id = 0xDEADBEEF;
 	struct spdm_secure_session *session;
+	struct spdm_secure_session_manager_stats stats;
 
 	TEST_START;
 
@@ -934,8 +1430,19 @@ static void spdm_secure_session_manager_test_reset (CuTest *test)
 	CuAssertPtrNotNull (test, session);
 	CuAssertIntEquals (test, 1, session_manager->state->current_session_count);
 
+	session_manager->state->last_spdm_request_secure_session_id = session_id;
+	session_manager->state->last_spdm_request_secure_session_id_valid = true;
+
 	session_manager->reset (session_manager);
 	CuAssertIntEquals (test, 0, session_manager->state->current_session_count);
+	CuAssertIntEquals (test, false, session_manager->is_last_session_id_valid (session_manager));
+	CuAssertPtrEquals (test, NULL, session_manager->get_session (session_manager, session_id));
+
+	/* Usage statistics are not cleared by a reset. */
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.active_sessions);
+	CuAssertIntEquals (test, 1, stats.peak_sessions);
 
 	spdm_secure_session_manager_testing_release (test, &testing);
 }
@@ -972,66 +1479,303 @@ static void spdm_secure_session_manager_test_reset_invalid_param (CuTest *test)
 	spdm_secure_session_manager_testing_release (test, &testing);
 }
 
-static void spdm_secure_session_manager_test_generate_shared_secret (CuTest *test)
+static void spdm_secure_session_manager_test_release_peer_sessions (CuTest *test)
 {
 	int status;
 	struct spdm_secure_session_manager_testing testing;
 	struct spdm_secure_session_manager *session_manager;
 	struct spdm_connection_info connection_info = {0};
-	uint32_t session_id = 0xDEADBEEF;
 	struct spdm_secure_session *session;
-	ECC_TESTING_ENGINE ecc_engine_real;
-	AES_TESTING_ENGINE aes_engine_real;
-	struct ecc_private_key req_priv_key;
-	struct ecc_public_key req_pub_key;
-	struct ecc_public_key resp_pub_key;
-	uint8_t *req_pub_key_der = NULL;
-	size_t req_pub_key_der_len;
-	struct ecc_point_public_key req_pub_key_point = {0};
-	uint8_t resp_pub_key_point[ECC_KEY_LENGTH_384 << 1];
-	uint8_t resp_pub_key_der[ECC_DER_MAX_PUBLIC_LENGTH];
-	uint8_t dhe_secret[SPDM_MAX_DHE_SHARED_SECRET_SIZE];
+	struct spdm_secure_session_manager_stats stats;
 
 	TEST_START;
 
-	spdm_secure_session_manager_testing_init_dependencies (test, &testing);
-
+	spdm_secure_session_manager_testing_init (test, &testing);
 	session_manager = &testing.session_manager;
 
-	status = ECC_TESTING_ENGINE_INIT (&ecc_engine_real);
-	status |= AES_TESTING_ENGINE_INIT (&aes_engine_real);
-	CuAssertIntEquals (test, 0, status);
-
-	status = spdm_secure_session_manager_init (session_manager, &testing.state,
-		&testing.local_capabilities,
-		(const struct spdm_device_algorithms*) &testing.local_algorithms, &aes_engine_real.base,
-		&testing.hash_engine_mock.base, &testing.rng_mock.base,	&ecc_engine_real.base,
-		&testing.transcript_manager_mock.base);
-	CuAssertIntEquals (test, 0, status);
-
-	/* Generate a random key pair. */
-	status = ecc_engine_real.base.generate_key_pair (&ecc_engine_real.base, ECC_KEY_LENGTH_384,
-		&req_priv_key, &req_pub_key);
-	CuAssertIntEquals (test, 0, status);
-
-	/* Convert the req public key in DER format. */
-	status = ecc_engine_real.base.get_public_key_der (&ecc_engine_real.base, &req_pub_key,
-		&req_pub_key_der, &req_pub_key_der_len);
-	CuAssertTrue (test, ROT_IS_ERROR (status) == false);
-
-	status = ecc_der_decode_public_key (req_pub_key_der, req_pub_key_der_len, req_pub_key_point.x,
-		req_pub_key_point.y, ECC_KEY_LENGTH_384);
-	CuAssertTrue (test, ROT_IS_ERROR (status) == false);
-	req_pub_key_point.key_length = ECC_KEY_LENGTH_384;
-
 	status = mock_expect (&testing.transcript_manager_mock.mock,
 		testing.transcript_manager_mock.base.reset_transcript,
 		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
 		MOCK_ARG (true), MOCK_ARG (0));
 
 	status |= mock_expect (&testing.transcript_manager_mock.mock,
-		testing.transcript_manager_mock.base.reset_session_transcript,
-		&testing.transcript_manager_mock.base, 0, MOCK_ARG (0));
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (1));
+
+	status |= mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (2));
+
+	status |= mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (0));
+
+	status |= mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (2));
+
+	CuAssertIntEquals (test, 0, status);
+
+	connection_info.peer_eid = 0x10;
+	session = session_manager->create_session (session_manager, 0x10001, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+	CuAssertIntEquals (test, 0x10, session->connection_info.peer_eid);
+
+	connection_info.peer_eid = 0x11;
+	session = session_manager->create_session (session_manager, 0x20002, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+	CuAssertIntEquals (test, 0x11, session->connection_info.peer_eid);
+
+	connection_info.peer_eid = 0x10;
+	session = session_manager->create_session (session_manager, 0x30003, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+	CuAssertIntEquals (test, 3, session_manager->state->current_session_count);
+
+	session_manager->state->last_spdm_request_secure_session_id = 0x30003;
+	session_manager->state->last_spdm_request_secure_session_id_valid = true;
+
+	session_manager->release_peer_sessions (session_manager, 0x10);
+	CuAssertIntEquals (test, 1, session_manager->state->current_session_count);
+	CuAssertIntEquals (test, false, session_manager->is_last_session_id_valid (session_manager));
+	CuAssertPtrEquals (test, NULL, session_manager->get_session (session_manager, 0x10001));
+	CuAssertPtrEquals (test, NULL, session_manager->get_session (session_manager, 0x30003));
+
+	session = session_manager->get_session (session_manager, 0x20002);
+	CuAssertPtrNotNull (test, session);
+	CuAssertIntEquals (test, 0x11, session->connection_info.peer_eid);
+
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.active_sessions);
+	CuAssertIntEquals (test, 3, stats.peak_sessions);
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (1));
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager->release_session (session_manager, 0x20002);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_release_peer_sessions_no_match (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session *session;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (0));
+
+	CuAssertIntEquals (test, 0, status);
+
+	connection_info.peer_eid = 0x10;
+	session = session_manager->create_session (session_manager, 0xDEADBEEF, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+
+	session_manager->state->last_spdm_request_secure_session_id = 0xDEADBEEF;
+	session_manager->state->last_spdm_request_secure_session_id_valid = true;
+
+	session_manager->release_peer_sessions (session_manager, 0x11);
+	CuAssertIntEquals (test, 1, session_manager->state->current_session_count);
+	CuAssertIntEquals (test, true, session_manager->is_last_session_id_valid (session_manager));
+	CuAssertPtrEquals (test, session, session_manager->get_session (session_manager, 0xDEADBEEF));
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (0));
+	CuAssertIntEquals (test, 0, status);
+
+	session_manager->release_session (session_manager, 0xDEADBEEF);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_release_peer_sessions_invalid_param (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session *session;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (0));
+
+	CuAssertIntEquals (test, 0, status);
+
+	session = session_manager->create_session (session_manager, 0xDEADBEEF, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+
+	session_manager->release_peer_sessions (NULL, 0);
+	CuAssertIntEquals (test, 1, session_manager->state->current_session_count);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_get_stats (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session_manager_stats stats;
+	struct spdm_secure_session *session;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT, stats.max_sessions);
+	CuAssertIntEquals (test, 0, stats.active_sessions);
+	CuAssertIntEquals (test, 0, stats.peak_sessions);
+	CuAssertIntEquals (test, 0, stats.reclaimed_sessions);
+	CuAssertIntEquals (test, SPDM_SECURE_SESSION_MEMORY_SIZE, stats.session_size);
+	CuAssertIntEquals (test, 0, stats.used_bytes);
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT * SPDM_SECURE_SESSION_MEMORY_SIZE,
+		stats.total_bytes);
+	CuAssertIntEquals (test, 0, stats.key_loads);
+	CuAssertIntEquals (test, 0, stats.key_cache_hits);
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (0));
+
+	status |= mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (0));
+
+	CuAssertIntEquals (test, 0, status);
+
+	session = session_manager->create_session (session_manager, 0xDEADBEEF, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.active_sessions);
+	CuAssertIntEquals (test, 1, stats.peak_sessions);
+	CuAssertIntEquals (test, SPDM_SECURE_SESSION_MEMORY_SIZE, stats.used_bytes);
+
+	session_manager->release_session (session_manager, 0xDEADBEEF);
+
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.active_sessions);
+	CuAssertIntEquals (test, 1, stats.peak_sessions);
+	CuAssertIntEquals (test, 0, stats.reclaimed_sessions);
+	CuAssertIntEquals (test, 0, stats.used_bytes);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_get_stats_invalid_param (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager_stats stats;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+
+	status = spdm_secure_session_manager_get_stats (NULL, &stats);
+	CuAssertIntEquals (test, SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	status = spdm_secure_session_manager_get_stats (&testing.session_manager, NULL);
+	CuAssertIntEquals (test, SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_generate_shared_secret (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info = {0};
+	uint32_t session_id = 0xDEADBEEF;
+	struct spdm_secure_session *session;
+	ECC_TESTING_ENGINE ecc_engine_real;
+	AES_TESTING_ENGINE aes_engine_real;
+	struct ecc_private_key req_priv_key;
+	struct ecc_public_key req_pub_key;
+	struct ecc_public_key resp_pub_key;
+	uint8_t *req_pub_key_der = NULL;
+	size_t req_pub_key_der_len;
+	struct ecc_point_public_key req_pub_key_point = {0};
+	uint8_t resp_pub_key_point[ECC_KEY_LENGTH_384 << 1];
+	uint8_t resp_pub_key_der[ECC_DER_MAX_PUBLIC_LENGTH];
+	uint8_t dhe_secret[SPDM_MAX_DHE_SHARED_SECRET_SIZE];
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init_dependencies (test, &testing);
+
+	session_manager = &testing.session_manager;
+
+	status = ECC_TESTING_ENGINE_INIT (&ecc_engine_real);
+	status |= AES_TESTING_ENGINE_INIT (&aes_engine_real);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_secure_session_manager_init (session_manager, &testing.state,
+		&testing.local_capabilities,
+		(const struct spdm_device_algorithms*) &testing.local_algorithms, &aes_engine_real.base,
+		&testing.hash_engine_mock.base, &testing.rng_mock.base,	&ecc_engine_real.base,
+		&testing.transcript_manager_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Generate a random key pair. */
+	status = ecc_engine_real.base.generate_key_pair (&ecc_engine_real.base, ECC_KEY_LENGTH_384,
+		&req_priv_key, &req_pub_key);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Convert the req public key in DER format. */
+	status = ecc_engine_real.base.get_public_key_der (&ecc_engine_real.base, &req_pub_key,
+		&req_pub_key_der, &req_pub_key_der_len);
+	CuAssertTrue (test, ROT_IS_ERROR (status) == false);
+
+	status = ecc_der_decode_public_key (req_pub_key_der, req_pub_key_der_len, req_pub_key_point.x,
+		req_pub_key_point.y, ECC_KEY_LENGTH_384);
+	CuAssertTrue (test, ROT_IS_ERROR (status) == false);
+	req_pub_key_point.key_length = ECC_KEY_LENGTH_384;
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (0));
+
+	status |= mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (0));
 
 	CuAssertIntEquals (test, 0, status);
 
@@ -2893,6 +3637,702 @@ static void spdm_secure_session_manager_test_encode_secure_message_encrypt_with_
 	spdm_secure_session_manager_testing_release (test, &testing);
 }
 
+static void spdm_secure_session_manager_test_secure_messages_multiple_sessions (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info;
+	struct spdm_transcript_manager transcript_manager;
+	struct spdm_transcript_manager_state transcript_state;
+	HASH_TESTING_ENGINE transcript_hash[SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT +
+		SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT];
+	struct hash_engine *transcript_hash_engine[ARRAY_SIZE (transcript_hash)];
+	HASH_TESTING_ENGINE hash_engine;
+	ECC_TESTING_ENGINE ecc_engine;
+	AES_TESTING_ENGINE aes_engine;
+	AES_TESTING_ENGINE requester_aes;
+	struct ecc_private_key req_priv_key;
+	struct ecc_public_key req_pub_key;
+	uint8_t *req_pub_key_der;
+	size_t req_pub_key_der_len;
+	struct ecc_point_public_key req_pub_key_point;
+	uint8_t resp_pub_key_point[ECC_KEY_LENGTH_384 << 1];
+	struct spdm_secure_session *session[SPDM_MAX_SESSION_COUNT];
+	struct spdm_secure_session_handshake_secrets handshake[SPDM_MAX_SESSION_COUNT];
+	struct spdm_secure_session_data_secrets data[SPDM_MAX_SESSION_COUNT];
+	uint32_t session_id[SPDM_MAX_SESSION_COUNT];
+	uint8_t key_exchange[SPDM_MAX_SESSION_COUNT][32];
+	uint8_t finish[SPDM_MAX_SESSION_COUNT][16];
+	uint8_t th[sizeof (key_exchange[0]) + sizeof (finish[0])];
+	uint8_t th_hash[SHA384_HASH_LENGTH];
+	uint8_t expected_hash[SHA384_HASH_LENGTH];
+	uint8_t message[64];
+	uint8_t buffer[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct spdm_secure_session_manager_stats stats;
+	const uint8_t *response;
+	size_t i;
+	int j;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init_dependencies (test, &testing);
+	session_manager = &testing.session_manager;
+	spdm_secure_session_manager_testing_init_connection_info (&connection_info);
+
+	status = HASH_TESTING_ENGINE_INIT (&hash_engine);
+	status |= ECC_TESTING_ENGINE_INIT (&ecc_engine);
+	status |= AES_TESTING_ENGINE_INIT (&aes_engine);
+	status |= AES_TESTING_ENGINE_INIT (&requester_aes);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < ARRAY_SIZE (transcript_hash); i++) {
+		status = HASH_TESTING_ENGINE_INIT (&transcript_hash[i]);
+		CuAssertIntEquals (test, 0, status);
+
+		transcript_hash_engine[i] = &transcript_hash[i].base;
+	}
+
+	status = spdm_transcript_manager_init (&transcript_manager, &transcript_state,
+		transcript_hash_engine, ARRAY_SIZE (transcript_hash_engine));
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager.set_hash_algo (&transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	transcript_manager.set_spdm_version (&transcript_manager, SPDM_VERSION_1_2);
+
+	status = spdm_secure_session_manager_init (session_manager, &testing.state,
+		&testing.local_capabilities,
+		(const struct spdm_device_algorithms*) &testing.local_algorithms, &aes_engine.base,
+		&hash_engine.base, &testing.rng_mock.base, &ecc_engine.base, &transcript_manager);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Run key exchange for every session before any of them finish the handshake. */
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		session_id[i] = MAKE_SESSION_ID (0x1000 + i, 0xff00 - i);
+		memset (key_exchange[i], 0x30 + i, sizeof (key_exchange[i]));
+		memset (finish[i], 0x80 + i, sizeof (finish[i]));
+
+		session[i] = session_manager->create_session (session_manager, session_id[i], false,
+			&connection_info);
+		CuAssertPtrNotNull (test, session[i]);
+		CuAssertIntEquals (test, SPDM_SESSION_TYPE_ENC_MAC, session[i]->session_type);
+
+		status = ecc_engine.base.generate_key_pair (&ecc_engine.base, ECC_KEY_LENGTH_384,
+			&req_priv_key, &req_pub_key);
+		CuAssertIntEquals (test, 0, status);
+
+		status = ecc_engine.base.get_public_key_der (&ecc_engine.base, &req_pub_key,
+			&req_pub_key_der, &req_pub_key_der_len);
+		CuAssertIntEquals (test, 0, status);
+
+		status = ecc_der_decode_public_key (req_pub_key_der, req_pub_key_der_len,
+			req_pub_key_point.x, req_pub_key_point.y, ECC_KEY_LENGTH_384);
+		CuAssertTrue (test, !ROT_IS_ERROR (status));
+		req_pub_key_point.key_length = ECC_KEY_LENGTH_384;
+
+		status = session_manager->generate_shared_secret (session_manager, session[i],
+			&req_pub_key_point, resp_pub_key_point);
+		CuAssertIntEquals (test, 0, status);
+
+		ecc_engine.base.release_key_pair (&ecc_engine.base, &req_priv_key, &req_pub_key);
+		platform_free (req_pub_key_der);
+
+		status = transcript_manager.update (&transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+			key_exchange[i], sizeof (key_exchange[i]), true, session[i]->session_index);
+		CuAssertIntEquals (test, 0, status);
+
+		status = session_manager->generate_session_handshake_keys (session_manager, session[i]);
+		CuAssertIntEquals (test, 0, status);
+
+		session_manager->set_session_state (session_manager, session_id[i],
+			SPDM_SESSION_STATE_HANDSHAKING);
+
+		/* The requester derives the same keys from the shared secret. */
+		memcpy (&handshake[i], &session[i]->handshake_secret, sizeof (handshake[i]));
+	}
+
+	for (i = 1; i < SPDM_MAX_SESSION_COUNT; i++) {
+		CuAssertTrue (test, (memcmp (handshake[0].request_handshake_encryption_key,
+			handshake[i].request_handshake_encryption_key, SPDM_MAX_AEAD_KEY_SIZE) != 0));
+	}
+
+	/* Finish the handshakes in reverse order. */
+	for (j = SPDM_MAX_SESSION_COUNT - 1; j >= 0; j--) {
+		memset (message, 0, sizeof (message));
+		((struct spdm_protocol_header*) message)->req_rsp_code = SPDM_REQUEST_FINISH;
+		memcpy (&message[sizeof (struct spdm_protocol_header)], finish[j], sizeof (finish[j]));
+
+		spdm_secure_session_manager_testing_encrypt_request (test, &requester_aes.base,
+			session_id[j], handshake[j].request_handshake_encryption_key,
+			handshake[j].request_handshake_salt, 0, message, sizeof (message), buffer,
+			sizeof (buffer), &request);
+
+		status = session_manager->decode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, sizeof (message), request.payload_length);
+
+		status = testing_validate_array (message, request.payload, sizeof (message));
+		CuAssertIntEquals (test, 0, status);
+
+		status = transcript_manager.update (&transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+			finish[j], sizeof (finish[j]), true, session[j]->session_index);
+		CuAssertIntEquals (test, 0, status);
+
+		status = session_manager->generate_session_data_keys (session_manager, session[j]);
+		CuAssertIntEquals (test, 0, status);
+
+		memcpy (&data[j], &session[j]->data_secret, sizeof (data[j]));
+
+		((struct spdm_protocol_header*) request.payload)->req_rsp_code = SPDM_RESPONSE_FINISH;
+		request.payload_length = 16;
+
+		status = session_manager->encode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, SPDM_SESSION_STATE_ESTABLISHED, session[j]->session_state);
+
+		response = spdm_secure_session_manager_testing_decrypt_response (test,
+			&requester_aes.base, session_id[j], handshake[j].response_handshake_encryption_key,
+			handshake[j].response_handshake_salt, 0, &request);
+		CuAssertIntEquals (test, SPDM_RESPONSE_FINISH,
+			((struct spdm_protocol_header*) response)->req_rsp_code);
+	}
+
+	/* Each session transcript only contains its own messages. */
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		memcpy (th, key_exchange[i], sizeof (key_exchange[i]));
+		memcpy (&th[sizeof (key_exchange[i])], finish[i], sizeof (finish[i]));
+
+		status = hash_engine.base.calculate_sha384 (&hash_engine.base, th, sizeof (th),
+			expected_hash, sizeof (expected_hash));
+		CuAssertIntEquals (test, 0, status);
+
+		status = transcript_manager.get_hash (&transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+			false, true, session[i]->session_index, th_hash, sizeof (th_hash));
+		CuAssertIntEquals (test, 0, status);
+
+		status = testing_validate_array (expected_hash, th_hash, sizeof (expected_hash));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* Exchange application data on every session. */
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		memset (message, i, sizeof (message));
+		((struct spdm_protocol_header*) message)->req_rsp_code = SPDM_REQUEST_GET_MEASUREMENTS;
+
+		spdm_secure_session_manager_testing_encrypt_request (test, &requester_aes.base,
+			session_id[i], data[i].request_data_encryption_key, data[i].request_data_salt, 0,
+			message, 4, buffer, sizeof (buffer), &request);
+
+		status = session_manager->decode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, 4, request.payload_length);
+
+		status = testing_validate_array (message, request.payload, 4);
+		CuAssertIntEquals (test, 0, status);
+
+		((struct spdm_protocol_header*) message)->req_rsp_code = SPDM_RESPONSE_GET_MEASUREMENTS;
+		memcpy (request.payload, message, sizeof (message));
+		request.payload_length = sizeof (message);
+
+		status = session_manager->encode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+
+		response = spdm_secure_session_manager_testing_decrypt_response (test,
+			&requester_aes.base, session_id[i], data[i].response_data_encryption_key,
+			data[i].response_data_salt, 0, &request);
+
+		status = testing_validate_array (message, response, sizeof (message));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	/* Established sessions are not released to make room for a new session. */
+	session_manager->reset_last_session_id_validity (session_manager);
+
+	CuAssertPtrEquals (test, NULL, session_manager->create_session (session_manager, 0xDEADBEEF,
+		false, &connection_info));
+
+	for (i = 0; i < SPDM_MAX_SESSION_COUNT; i++) {
+		CuAssertPtrEquals (test, session[i],
+			session_manager->get_session (session_manager, session_id[i]));
+	}
+
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT, stats.active_sessions);
+	CuAssertIntEquals (test, SPDM_MAX_SESSION_COUNT, stats.peak_sessions);
+	CuAssertIntEquals (test, 0, stats.reclaimed_sessions);
+
+	session_manager->reset (session_manager);
+
+	spdm_secure_session_manager_release (session_manager);
+	spdm_transcript_manager_release (&transcript_manager);
+
+	for (i = 0; i < ARRAY_SIZE (transcript_hash); i++) {
+		HASH_TESTING_ENGINE_RELEASE (&transcript_hash[i]);
+	}
+
+	HASH_TESTING_ENGINE_RELEASE (&hash_engine);
+	ECC_TESTING_ENGINE_RELEASE (&ecc_engine);
+	AES_TESTING_ENGINE_RELEASE (&aes_engine);
+	AES_TESTING_ENGINE_RELEASE (&requester_aes);
+
+	spdm_secure_session_manager_testing_release_dependencies (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_enable_key_cache (CuTest *test)
+{
+	int status;
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct aes_engine_mock cache_mock[2];
+	struct aes_engine *key_cache[] = {&cache_mock[0].base, &cache_mock[1].base};
+	uint32_t session_id = 0xDEADBEEF;
+	struct spdm_secure_session *session;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session_manager_stats stats;
+	uint8_t aes_key[SPDM_MAX_AEAD_KEY_SIZE];
+	int i;
+
+	TEST_START;
+
+	memset (aes_key, 0x5a, sizeof (aes_key));
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	status = aes_mock_init (&cache_mock[0]);
+	status |= aes_mock_init (&cache_mock[1]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_secure_session_manager_enable_key_cache (session_manager, key_cache,
+		ARRAY_SIZE (key_cache));
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrEquals (test, key_cache, (void*) session_manager->key_cache);
+	CuAssertIntEquals (test, ARRAY_SIZE (key_cache), session_manager->key_cache_count);
+
+	/* The key is loaded for each new session, but stays loaded between messages. */
+	for (i = 0; i < 2; i++) {
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+			MOCK_ARG (true), MOCK_ARG (0));
+
+		status |= mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_session_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (0));
+
+		CuAssertIntEquals (test, 0, status);
+
+		session = session_manager->create_session (session_manager, session_id, false,
+			&connection_info);
+		CuAssertPtrNotNull (test, session);
+		session->session_state = SPDM_SESSION_STATE_ESTABLISHED;
+		session->aead_tag_size = AES_TAG_LENGTH;
+		session->session_type = SPDM_SESSION_TYPE_ENC_MAC;
+		session->aead_key_size = sizeof (aes_key);
+		session->aead_iv_size = SPDM_MAX_AEAD_IV_SIZE;
+		memcpy (session->data_secret.request_data_encryption_key, aes_key, sizeof (aes_key));
+
+		status = mock_expect (&cache_mock[0].mock, cache_mock[0].base.set_key, &cache_mock[0], 0,
+			MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)), MOCK_ARG (sizeof (aes_key)));
+
+		status |= mock_expect (&cache_mock[0].mock, cache_mock[0].base.decrypt_with_add_data,
+			&cache_mock[0], 0, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL,
+			MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL,
+			MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL);
+
+		status |= mock_expect (&cache_mock[0].mock, cache_mock[0].base.decrypt_with_add_data,
+			&cache_mock[0], 0, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL,
+			MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL,
+			MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL);
+
+		CuAssertIntEquals (test, 0, status);
+
+		spdm_secure_session_manager_testing_build_mock_request (session_id, buf, &request);
+
+		status = session_manager->decode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+
+		spdm_secure_session_manager_testing_build_mock_request (session_id, buf, &request);
+
+		status = session_manager->decode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+
+		/* Releasing the session unloads its keys, even though the next one uses the same memory. */
+		session_manager->release_session (session_manager, session_id);
+	}
+
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.key_loads);
+	CuAssertIntEquals (test, 2, stats.key_cache_hits);
+
+	status = aes_mock_validate_and_release (&cache_mock[0]);
+	status |= aes_mock_validate_and_release (&cache_mock[1]);
+	CuAssertIntEquals (test, 0, status);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_enable_key_cache_disable (CuTest *test)
+{
+	int status;
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct aes_engine_mock cache_mock;
+	struct aes_engine *key_cache[] = {&cache_mock.base};
+	uint32_t session_id = 0xDEADBEEF;
+	struct spdm_secure_session *session;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session_manager_stats stats;
+	uint8_t aes_key[SPDM_MAX_AEAD_KEY_SIZE];
+	int i;
+
+	TEST_START;
+
+	memset (aes_key, 0x5a, sizeof (aes_key));
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	status = aes_mock_init (&cache_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_secure_session_manager_enable_key_cache (session_manager, key_cache,
+		ARRAY_SIZE (key_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_secure_session_manager_enable_key_cache (session_manager, NULL, 0);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, session_manager->key_cache_count);
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (0));
+
+	status |= mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (0));
+
+	CuAssertIntEquals (test, 0, status);
+
+	session = session_manager->create_session (session_manager, session_id, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+	session->session_state = SPDM_SESSION_STATE_ESTABLISHED;
+	session->aead_tag_size = AES_TAG_LENGTH;
+	session->session_type = SPDM_SESSION_TYPE_ENC_MAC;
+	session->aead_key_size = sizeof (aes_key);
+	session->aead_iv_size = SPDM_MAX_AEAD_IV_SIZE;
+	memcpy (session->data_secret.request_data_encryption_key, aes_key, sizeof (aes_key));
+
+	/* Without the cache, the key is loaded into the shared engine for every message. */
+	for (i = 0; i < 2; i++) {
+		status = mock_expect (&testing.aes_mock.mock, testing.aes_mock.base.set_key,
+			&testing.aes_mock, 0, MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)),
+			MOCK_ARG (sizeof (aes_key)));
+
+		status |= mock_expect (&testing.aes_mock.mock, testing.aes_mock.base.decrypt_with_add_data,
+			&testing.aes_mock, 0, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL,
+			MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL,
+			MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL);
+
+		CuAssertIntEquals (test, 0, status);
+
+		spdm_secure_session_manager_testing_build_mock_request (session_id, buf, &request);
+
+		status = session_manager->decode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 2, stats.key_loads);
+	CuAssertIntEquals (test, 0, stats.key_cache_hits);
+
+	session_manager->release_session (session_manager, session_id);
+
+	status = aes_mock_validate_and_release (&cache_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_enable_key_cache_invalid_params (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct aes_engine_mock cache_mock;
+	struct aes_engine *key_cache[SPDM_SECURE_SESSION_MANAGER_MAX_KEY_CACHE + 1];
+	struct aes_engine *null_entry[] = {&cache_mock.base, NULL};
+	size_t i;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+
+	status = aes_mock_init (&cache_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < ARRAY_SIZE (key_cache); i++) {
+		key_cache[i] = &cache_mock.base;
+	}
+
+	status = spdm_secure_session_manager_enable_key_cache (NULL, key_cache, 1);
+	CuAssertIntEquals (test, SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	status = spdm_secure_session_manager_enable_key_cache (&testing.session_manager, NULL, 1);
+	CuAssertIntEquals (test, SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	status = spdm_secure_session_manager_enable_key_cache (&testing.session_manager, key_cache,
+		ARRAY_SIZE (key_cache));
+	CuAssertIntEquals (test, SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	status = spdm_secure_session_manager_enable_key_cache (&testing.session_manager, null_entry,
+		ARRAY_SIZE (null_entry));
+	CuAssertIntEquals (test, SPDM_SECURE_SESSION_MANAGER_INVALID_ARGUMENT, status);
+
+	CuAssertIntEquals (test, 0, testing.session_manager.key_cache_count);
+
+	status = aes_mock_validate_and_release (&cache_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_enable_key_cache_set_key_fail (CuTest *test)
+{
+	int status;
+	uint8_t buf[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct aes_engine_mock cache_mock;
+	struct aes_engine *key_cache[] = {&cache_mock.base};
+	uint32_t session_id = 0xDEADBEEF;
+	struct spdm_secure_session *session;
+	struct spdm_connection_info connection_info = {0};
+	struct spdm_secure_session_manager_stats stats;
+	uint8_t aes_key[SPDM_MAX_AEAD_KEY_SIZE];
+
+	TEST_START;
+
+	memset (aes_key, 0x5a, sizeof (aes_key));
+
+	spdm_secure_session_manager_testing_init (test, &testing);
+	session_manager = &testing.session_manager;
+
+	status = aes_mock_init (&cache_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_secure_session_manager_enable_key_cache (session_manager, key_cache,
+		ARRAY_SIZE (key_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+		MOCK_ARG (true), MOCK_ARG (0));
+
+	status |= mock_expect (&testing.transcript_manager_mock.mock,
+		testing.transcript_manager_mock.base.reset_session_transcript,
+		&testing.transcript_manager_mock.base, 0, MOCK_ARG (0));
+
+	CuAssertIntEquals (test, 0, status);
+
+	session = session_manager->create_session (session_manager, session_id, false,
+		&connection_info);
+	CuAssertPtrNotNull (test, session);
+	session->session_state = SPDM_SESSION_STATE_ESTABLISHED;
+	session->aead_tag_size = AES_TAG_LENGTH;
+	session->session_type = SPDM_SESSION_TYPE_ENC_MAC;
+	session->aead_key_size = sizeof (aes_key);
+	session->aead_iv_size = SPDM_MAX_AEAD_IV_SIZE;
+	memcpy (session->data_secret.request_data_encryption_key, aes_key, sizeof (aes_key));
+
+	status = mock_expect (&cache_mock.mock, cache_mock.base.set_key, &cache_mock,
+		AES_ENGINE_SET_KEY_FAILED, MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)),
+		MOCK_ARG (sizeof (aes_key)));
+	CuAssertIntEquals (test, 0, status);
+
+	spdm_secure_session_manager_testing_build_mock_request (session_id, buf, &request);
+
+	status = session_manager->decode_secure_message (session_manager, &request);
+	CuAssertIntEquals (test, AES_ENGINE_SET_KEY_FAILED, status);
+
+	/* The failed key is not treated as loaded for the next message. */
+	status = mock_expect (&cache_mock.mock, cache_mock.base.set_key, &cache_mock, 0,
+		MOCK_ARG_PTR_CONTAINS_TMP (aes_key, sizeof (aes_key)), MOCK_ARG (sizeof (aes_key)));
+
+	status |= mock_expect (&cache_mock.mock, cache_mock.base.decrypt_with_add_data, &cache_mock, 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL,
+		MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL, MOCK_ARG_NOT_NULL,
+		MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	spdm_secure_session_manager_testing_build_mock_request (session_id, buf, &request);
+
+	status = session_manager->decode_secure_message (session_manager, &request);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.key_loads);
+	CuAssertIntEquals (test, 0, stats.key_cache_hits);
+
+	session_manager->release_session (session_manager, session_id);
+
+	status = aes_mock_validate_and_release (&cache_mock);
+	CuAssertIntEquals (test, 0, status);
+
+	spdm_secure_session_manager_testing_release (test, &testing);
+}
+
+static void spdm_secure_session_manager_test_secure_messages_key_cache (CuTest *test)
+{
+	int status;
+	struct spdm_secure_session_manager_testing testing;
+	struct spdm_secure_session_manager *session_manager;
+	struct spdm_connection_info connection_info;
+	AES_TESTING_ENGINE aes_engine;
+	AES_TESTING_ENGINE requester_aes;
+	AES_TESTING_ENGINE cache_engine[3];
+	struct aes_engine *key_cache[ARRAY_SIZE (cache_engine)];
+	struct spdm_secure_session *session[2];
+	uint32_t session_id[ARRAY_SIZE (session)];
+	uint64_t sequence_number[ARRAY_SIZE (session)] = {0};
+	/* Session exchange order that hits loaded keys and forces keys to be replaced. */
+	const int order[] = {0, 0, 1, 0};
+	uint8_t message[64];
+	uint8_t buffer[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+	struct cmd_interface_msg request;
+	struct spdm_secure_session_manager_stats stats;
+	const uint8_t *response;
+	size_t i;
+	int j;
+
+	TEST_START;
+
+	spdm_secure_session_manager_testing_init_dependencies (test, &testing);
+	session_manager = &testing.session_manager;
+	spdm_secure_session_manager_testing_init_connection_info (&connection_info);
+
+	status = AES_TESTING_ENGINE_INIT (&aes_engine);
+	status |= AES_TESTING_ENGINE_INIT (&requester_aes);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < ARRAY_SIZE (cache_engine); i++) {
+		status = AES_TESTING_ENGINE_INIT (&cache_engine[i]);
+		CuAssertIntEquals (test, 0, status);
+
+		key_cache[i] = &cache_engine[i].base;
+	}
+
+	status = spdm_secure_session_manager_init (session_manager, &testing.state,
+		&testing.local_capabilities,
+		(const struct spdm_device_algorithms*) &testing.local_algorithms, &aes_engine.base,
+		&testing.hash_engine_mock.base, &testing.rng_mock.base, &testing.ecc_mock.base,
+		&testing.transcript_manager_mock.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spdm_secure_session_manager_enable_key_cache (session_manager, key_cache,
+		ARRAY_SIZE (key_cache));
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < ARRAY_SIZE (session); i++) {
+		session_id[i] = MAKE_SESSION_ID (0x1000 + i, 0xff00 - i);
+
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (TRANSCRIPT_CONTEXT_TYPE_TH),
+			MOCK_ARG (true), MOCK_ARG (i));
+		CuAssertIntEquals (test, 0, status);
+
+		session[i] = session_manager->create_session (session_manager, session_id[i], false,
+			&connection_info);
+		CuAssertPtrNotNull (test, session[i]);
+		session[i]->session_state = SPDM_SESSION_STATE_ESTABLISHED;
+
+		memset (session[i]->data_secret.request_data_encryption_key, 0x10 + i,
+			SPDM_MAX_AEAD_KEY_SIZE);
+		memset (session[i]->data_secret.request_data_salt, 0x20 + i, SPDM_MAX_AEAD_IV_SIZE);
+		memset (session[i]->data_secret.response_data_encryption_key, 0x30 + i,
+			SPDM_MAX_AEAD_KEY_SIZE);
+		memset (session[i]->data_secret.response_data_salt, 0x40 + i, SPDM_MAX_AEAD_IV_SIZE);
+	}
+
+	for (i = 0; i < ARRAY_SIZE (order); i++) {
+		j = order[i];
+
+		memset (message, i, sizeof (message));
+		((struct spdm_protocol_header*) message)->req_rsp_code = SPDM_REQUEST_GET_MEASUREMENTS;
+
+		spdm_secure_session_manager_testing_encrypt_request (test, &requester_aes.base,
+			session_id[j], session[j]->data_secret.request_data_encryption_key,
+			session[j]->data_secret.request_data_salt, sequence_number[j], message, 4, buffer,
+			sizeof (buffer), &request);
+
+		status = session_manager->decode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, 4, request.payload_length);
+
+		status = testing_validate_array (message, request.payload, 4);
+		CuAssertIntEquals (test, 0, status);
+
+		((struct spdm_protocol_header*) message)->req_rsp_code = SPDM_RESPONSE_GET_MEASUREMENTS;
+		memcpy (request.payload, message, sizeof (message));
+		request.payload_length = sizeof (message);
+
+		status = session_manager->encode_secure_message (session_manager, &request);
+		CuAssertIntEquals (test, 0, status);
+
+		response = spdm_secure_session_manager_testing_decrypt_response (test,
+			&requester_aes.base, session_id[j], session[j]->data_secret.response_data_encryption_key,
+			session[j]->data_secret.response_data_salt, sequence_number[j], &request);
+
+		status = testing_validate_array (message, response, sizeof (message));
+		CuAssertIntEquals (test, 0, status);
+
+		sequence_number[j]++;
+	}
+
+	/* The second exchange on session 0 uses loaded keys.  With only three engines, session 1
+	 * replaces keys for session 0 and session 0 then needs to load both keys again. */
+	status = spdm_secure_session_manager_get_stats (session_manager, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 6, stats.key_loads);
+	CuAssertIntEquals (test, 2, stats.key_cache_hits);
+
+	for (i = 0; i < ARRAY_SIZE (session); i++) {
+		status = mock_expect (&testing.transcript_manager_mock.mock,
+			testing.transcript_manager_mock.base.reset_session_transcript,
+			&testing.transcript_manager_mock.base, 0, MOCK_ARG (i));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	session_manager->reset (session_manager);
+
+	spdm_secure_session_manager_release (session_manager);
+
+	AES_TESTING_ENGINE_RELEASE (&aes_engine);
+	AES_TESTING_ENGINE_RELEASE (&requester_aes);
+
+	for (i = 0; i < ARRAY_SIZE (cache_engine); i++) {
+		AES_TESTING_ENGINE_RELEASE (&cache_engine[i]);
+	}
+
+	spdm_secure_session_manager_testing_release_dependencies (test, &testing);
+}
+
 // *INDENT-OFF*
 TEST_SUITE_START (spdm_secure_session_manager);
 
@@ -2907,6 +4347,11 @@ TEST (spdm_secure_session_manager_test_create_session_mac_only);
 TEST (spdm_secure_session_manager_test_create_session_invalid_params);
 TEST (spdm_secure_session_manager_test_create_session_count_gt_max);
 TEST (spdm_secure_session_manager_test_create_session_duplicate_session);
+TEST (spdm_secure_session_manager_test_create_session_multiple_sessions);
+TEST (spdm_secure_session_manager_test_create_session_reclaim_idle_session);
+TEST (spdm_secure_session_manager_test_create_session_reclaim_skip_last_session);
+TEST (spdm_secure_session_manager_test_create_session_reclaim_skip_established_session);
+TEST (spdm_secure_session_manager_test_create_session_all_sessions_established);
 TEST (spdm_secure_session_manager_test_release_session);
 TEST (spdm_secure_session_manager_test_release_session_invalid_params);
 TEST (spdm_secure_session_manager_test_get_session);
@@ -2916,6 +4361,11 @@ TEST (spdm_secure_session_manager_test_set_session_state);
 TEST (spdm_secure_session_manager_test_set_session_state_invalid_param);
 TEST (spdm_secure_session_manager_test_reset);
 TEST (spdm_secure_session_manager_test_reset_invalid_param);
+TEST (spdm_secure_session_manager_test_release_peer_sessions);
+TEST (spdm_secure_session_manager_test_release_peer_sessions_no_match);
+TEST (spdm_secure_session_manager_test_release_peer_sessions_invalid_param);
+TEST (spdm_secure_session_manager_test_get_stats);
+TEST (spdm_secure_session_manager_test_get_stats_invalid_param);
 TEST (spdm_secure_session_manager_test_generate_shared_secret);
 TEST (spdm_secure_session_manager_test_generate_shared_secret_invalid_param);
 TEST (spdm_secure_session_manager_test_generate_shared_secret_ecc_der_encode_public_key_fail);
@@ -2951,6 +4401,12 @@ TEST (spdm_secure_session_manager_test_encode_secure_message_sequence_number_ove
 TEST (spdm_secure_session_manager_test_encode_secure_message_max_response_size_lt_required);
 TEST (spdm_secure_session_manager_test_encode_secure_message_set_key_fail);
 TEST (spdm_secure_session_manager_test_encode_secure_message_encrypt_with_add_data_fail);
+TEST (spdm_secure_session_manager_test_secure_messages_multiple_sessions);
+TEST (spdm_secure_session_manager_test_enable_key_cache);
+TEST (spdm_secure_session_manager_test_enable_key_cache_disable);
+TEST (spdm_secure_session_manager_test_enable_key_cache_invalid_params);
+TEST (spdm_secure_session_manager_test_enable_key_cache_set_key_fail);
+TEST (spdm_secure_session_manager_test_secure_messages_key_cache);
 
 TEST_SUITE_END;
 // *INDENT-ON*
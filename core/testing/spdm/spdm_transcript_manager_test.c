@@ -16,10 +16,9 @@ TEST_SUITE_LABEL ("spdm_transcript_manager");
 
 
 #define HASH_ENGINE_COUNT 	SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT + \
-	(SPDM_MAX_SESSION_COUNT * SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT)
+	SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT
 
-#define SESSION_0_L1L2_HASH_CONTEXT_INDEX	2
-#define SESSION_0_TH_HASH_CONTEXT_INDEX		3
+#define SESSION_HASH_CONTEXT_INDEX	SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_SESSION
 
 /**
  * Dependencies for testing.
@@ -143,6 +142,7 @@ static void spdm_transcript_manager_test_static_init (CuTest *test)
 	CuAssertPtrNotNull (test, transcript_manager.get_hash);
 	CuAssertPtrNotNull (test, transcript_manager.reset_transcript);
 	CuAssertPtrNotNull (test, transcript_manager.reset);
+	CuAssertPtrNotNull (test, transcript_manager.reset_connection);
 	CuAssertPtrNotNull (test, transcript_manager.reset_session_transcript);
 
 	spdm_transcript_manager_release (&transcript_manager);
@@ -215,6 +215,7 @@ static void spdm_transcript_manager_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, testing.transcript_manager.get_hash);
 	CuAssertPtrNotNull (test, testing.transcript_manager.reset_transcript);
 	CuAssertPtrNotNull (test, testing.transcript_manager.reset);
+	CuAssertPtrNotNull (test, testing.transcript_manager.reset_connection);
 	CuAssertPtrNotNull (test, testing.transcript_manager.reset_session_transcript);
 
 	spdm_transcript_manager_testing_release (test, &testing);
@@ -386,6 +387,85 @@ static void spdm_transcript_manager_test_reset_invalid_params (CuTest *test)
 	spdm_transcript_manager_testing_release (test, &testing);
 }
 
+static void spdm_transcript_manager_test_reset_connection (CuTest *test)
+{
+	int status;
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+	char *str = "Hello";
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init (test, &testing, false);
+	transcript_manager = &testing.transcript_manager;
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	transcript_manager->set_spdm_version (transcript_manager, SPDM_VERSION_1_2);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_VCA,
+		(const uint8_t*) str, strlen (str), false, SPDM_MAX_SESSION_COUNT);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_M1M2,
+		(const uint8_t*) str, strlen (str), false, SPDM_MAX_SESSION_COUNT);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_L1L2,
+		(const uint8_t*) str, strlen (str), false, SPDM_MAX_SESSION_COUNT);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_L1L2,
+		(const uint8_t*) str, strlen (str), true, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		(const uint8_t*) str, strlen (str), true, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	transcript_manager->reset_connection (transcript_manager);
+
+	CuAssertIntEquals (test, HASH_TYPE_INVALID, transcript_manager->state->hash_algo);
+	CuAssertIntEquals (test, 0, transcript_manager->state->message_vca.buffer_size);
+	CuAssertTrue (test, transcript_manager->state->m1m2.hash_started == false);
+	CuAssertTrue (test, transcript_manager->state->l1l2.hash_started == false);
+
+	/* Session transcripts are not affected. */
+	CuAssertTrue (test, transcript_manager->state->session_transcript[0].l1l2.hash_started);
+	CuAssertTrue (test, transcript_manager->state->session_transcript[0].th.hash_started);
+	CuAssertTrue (test, transcript_manager->state->session_transcript[0].connection.valid);
+
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
+static void spdm_transcript_manager_test_reset_connection_invalid_params (CuTest *test)
+{
+	int status;
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+	char *str = "Hello";
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init (test, &testing, false);
+	transcript_manager = &testing.transcript_manager;
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_VCA,
+		(const uint8_t*) str, strlen (str), false, SPDM_MAX_SESSION_COUNT);
+	CuAssertIntEquals (test, 0, status);
+
+	transcript_manager->reset_connection (NULL);
+
+	CuAssertIntEquals (test, HASH_TYPE_SHA384, transcript_manager->state->hash_algo);
+	CuAssertIntEquals (test, strlen (str), transcript_manager->state->message_vca.buffer_size);
+
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
 static void spdm_transcript_manager_test_update_vca (CuTest *test)
 {
 	int status;
@@ -2069,7 +2149,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA256_v_1_2_start_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2101,7 +2181,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA256_v_1_2_update
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2139,7 +2219,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA256_v_1_2_second
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2220,7 +2300,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA384_v_1_2_start_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2252,7 +2332,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA384_v_1_2_update
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2290,7 +2370,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA384_v_1_2_second
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2372,7 +2452,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA512_v_1_2_start_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2404,7 +2484,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA512_v_1_2_update
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2442,7 +2522,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA512_v_1_2_second
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2522,7 +2602,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA256_v_1_1_start_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2554,7 +2634,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA256_v_1_1_update
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2630,7 +2710,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA384_v_1_1_start_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2662,7 +2742,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA384_v_1_1_update
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2740,7 +2820,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA512_v_1_1_start_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2772,7 +2852,7 @@ static void spdm_transcript_manager_test_session_update_l1l2_SHA512_v_1_1_update
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2870,7 +2950,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA256_start_hash_fai
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2900,7 +2980,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA256_update_hash_fa
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -2936,7 +3016,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA256_second_update_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -3013,7 +3093,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA384_start_hash_fai
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -3043,7 +3123,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA384_update_hash_fa
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -3079,7 +3159,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA384_second_update_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -3157,7 +3237,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA512_start_hash_fai
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -3187,7 +3267,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA512_update_hash_fa
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -3223,7 +3303,7 @@ static void spdm_transcript_manager_test_session_update_th_SHA512_second_update_
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_TH_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -3279,13 +3359,316 @@ static void spdm_transcript_manager_test_session_update_th_invalid_session_idx (
 	spdm_transcript_manager_testing_release (test, &testing);
 }
 
+static void spdm_transcript_manager_test_session_update_multiple_sessions (CuTest *test)
+{
+	int status;
+	uint8_t vca[] = {0x10, 0x11, 0x12, 0x13, 0x14, 0x15};
+	uint8_t th_msg1[SPDM_MAX_SESSION_COUNT][8];
+	uint8_t th_msg2[SPDM_MAX_SESSION_COUNT][12];
+	uint8_t l1l2_msg[SPDM_MAX_SESSION_COUNT][6];
+	uint8_t th_data[sizeof (vca) + sizeof (th_msg1[0]) + sizeof (th_msg2[0])];
+	uint8_t hash[SHA384_HASH_LENGTH];
+	uint8_t expected[SHA384_HASH_LENGTH];
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+	HASH_TESTING_ENGINE hash_engine;
+	uint8_t session_idx;
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init (test, &testing, false);
+	transcript_manager = &testing.transcript_manager;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash_engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	transcript_manager->set_spdm_version (transcript_manager, SPDM_VERSION_1_2);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_VCA, vca,
+		sizeof (vca), false, SPDM_MAX_SESSION_COUNT);
+	CuAssertIntEquals (test, 0, status);
+
+	for (session_idx = 0; session_idx < SPDM_MAX_SESSION_COUNT; session_idx++) {
+		memset (th_msg1[session_idx], 0x20 + session_idx, sizeof (th_msg1[session_idx]));
+		memset (th_msg2[session_idx], 0x40 + session_idx, sizeof (th_msg2[session_idx]));
+		memset (l1l2_msg[session_idx], 0x60 + session_idx, sizeof (l1l2_msg[session_idx]));
+	}
+
+	/* Interleave updates for every session so each transcript is suspended while others use the
+	 * shared hash engine. */
+	for (session_idx = 0; session_idx < SPDM_MAX_SESSION_COUNT; session_idx++) {
+		status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+			th_msg1[session_idx], sizeof (th_msg1[session_idx]), true, session_idx);
+		CuAssertIntEquals (test, 0, status);
+
+		status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_L1L2,
+			l1l2_msg[session_idx], sizeof (l1l2_msg[session_idx]), true, session_idx);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	for (session_idx = SPDM_MAX_SESSION_COUNT; session_idx > 0; session_idx--) {
+		status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+			th_msg2[session_idx - 1], sizeof (th_msg2[session_idx - 1]), true, session_idx - 1);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	for (session_idx = 0; session_idx < SPDM_MAX_SESSION_COUNT; session_idx++) {
+		memcpy (th_data, vca, sizeof (vca));
+		memcpy (&th_data[sizeof (vca)], th_msg1[session_idx], sizeof (th_msg1[session_idx]));
+		memcpy (&th_data[sizeof (vca) + sizeof (th_msg1[0])], th_msg2[session_idx],
+			sizeof (th_msg2[session_idx]));
+
+		status = hash_engine.base.calculate_sha384 (&hash_engine.base, th_data, sizeof (th_data),
+			expected, sizeof (expected));
+		CuAssertIntEquals (test, 0, status);
+
+		status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+			true, true, session_idx, hash, sizeof (hash));
+		CuAssertIntEquals (test, 0, status);
+
+		status = testing_validate_array (expected, hash, sizeof (expected));
+		CuAssertIntEquals (test, 0, status);
+
+		/* SPDM 1.2 L1L2 contains the VCA. */
+		memcpy (&th_data[sizeof (vca)], l1l2_msg[session_idx], sizeof (l1l2_msg[session_idx]));
+
+		status = hash_engine.base.calculate_sha384 (&hash_engine.base, th_data,
+			sizeof (vca) + sizeof (l1l2_msg[session_idx]), expected, sizeof (expected));
+		CuAssertIntEquals (test, 0, status);
+
+		status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_L1L2,
+			true, true, session_idx, hash, sizeof (hash));
+		CuAssertIntEquals (test, 0, status);
+
+		status = testing_validate_array (expected, hash, sizeof (expected));
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	HASH_TESTING_ENGINE_RELEASE (&hash_engine);
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
+static void spdm_transcript_manager_test_session_update_after_new_connection (CuTest *test)
+{
+	int status;
+	char *vca = "Hello";
+	char *new_vca = "World";
+	uint32_t data = 0xDEADBEEF;
+	uint8_t hash[SHA256_HASH_LENGTH];
+	uint8_t expected_hash[SHA256_HASH_LENGTH];
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+	struct hash_engine *hash_engine;
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init (test, &testing, false);
+	transcript_manager = &testing.transcript_manager;
+	hash_engine = testing.hash_engine[SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_INDEX_M1M2];
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA256);
+	CuAssertIntEquals (test, 0, status);
+
+	transcript_manager->set_spdm_version (transcript_manager, SPDM_VERSION_1_2);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_VCA,
+		(const uint8_t*) vca, strlen (vca), false, SPDM_MAX_SESSION_COUNT);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		(uint8_t*) &data, sizeof (data), true, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Negotiate a new connection with different parameters. */
+	transcript_manager->reset_connection (transcript_manager);
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	transcript_manager->set_spdm_version (transcript_manager, SPDM_VERSION_1_1);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_VCA,
+		(const uint8_t*) new_vca, strlen (new_vca), false, SPDM_MAX_SESSION_COUNT);
+	CuAssertIntEquals (test, 0, status);
+
+	/* The session L1L2 transcript starts with the VCA messages for the session connection. */
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_L1L2,
+		(uint8_t*) &data, sizeof (data), true, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_L1L2, true,
+		true, 0, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_engine->start_sha256 (hash_engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_engine->update (hash_engine, (const uint8_t*) vca, strlen (vca));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_engine->update (hash_engine, (uint8_t*) &data, sizeof (data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_engine->finish (hash_engine, expected_hash, sizeof (expected_hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (expected_hash, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The TH transcript for the session is also unchanged. */
+	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, true,
+		true, 0, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (expected_hash, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	/* Resetting the session transcript discards the session connection. */
+	transcript_manager->reset_session_transcript (transcript_manager, 0);
+	CuAssertTrue (test, testing.state.session_transcript[0].connection.valid == false);
+
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
+static void spdm_transcript_manager_test_session_update_th_restore_context_fail (CuTest *test)
+{
+	int status;
+	uint32_t data = 0xDEADBEEF;
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init (test, &testing, true);
+	transcript_manager = &testing.transcript_manager;
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.start_sha384, &testing.hash_engine_mock[idx], 0);
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.update, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0));
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.update, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_PTR_CONTAINS (&data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.save_context, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_NOT_NULL);
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.cancel, &testing.hash_engine_mock[idx], 0);
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.restore_context, &testing.hash_engine_mock[idx],
+		HASH_ENGINE_INVALID_CONTEXT, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		(uint8_t*) &data, sizeof (data), true, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		(uint8_t*) &data, sizeof (data), true, 0);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_CONTEXT, status);
+
+	CuAssertIntEquals (test, true, testing.state.session_transcript[0].th.hash_started);
+
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
+static void spdm_transcript_manager_test_session_update_th_save_context_fail (CuTest *test)
+{
+	int status;
+	uint32_t data = 0xDEADBEEF;
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init (test, &testing, true);
+	transcript_manager = &testing.transcript_manager;
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.start_sha384, &testing.hash_engine_mock[idx], 0);
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.update, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0));
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.update, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_PTR_CONTAINS (&data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.save_context, &testing.hash_engine_mock[idx],
+		HASH_ENGINE_NO_ACTIVE_HASH, MOCK_ARG_NOT_NULL);
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.cancel, &testing.hash_engine_mock[idx], 0);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		(uint8_t*) &data, sizeof (data), true, 0);
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	CuAssertIntEquals (test, false, testing.state.session_transcript[0].th.hash_started);
+
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
+static void spdm_transcript_manager_test_session_update_no_session_hash_engine (CuTest *test)
+{
+	int status;
+	uint32_t data = 0xDEADBEEF;
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init_dependencies (test, &testing, false);
+	transcript_manager = &testing.transcript_manager;
+
+	status = spdm_transcript_manager_init (transcript_manager, &testing.state, testing.hash_engine,
+		SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, testing.state.session_transcript_count);
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		(uint8_t*) &data, sizeof (data), true, 0);
+	CuAssertIntEquals (test, SPDM_TRANSCRIPT_MANAGER_INVALID_SESSION_IDX, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_L1L2,
+		(uint8_t*) &data, sizeof (data), true, 0);
+	CuAssertIntEquals (test, SPDM_TRANSCRIPT_MANAGER_INVALID_SESSION_IDX, status);
+
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
 static void spdm_transcript_manager_test_session_reset_session_transcript (CuTest *test)
 {
 	int status;
 	uint32_t data = 0xDEADBEEF;
 	struct spdm_transcript_manager_testing testing;
 	struct spdm_transcript_manager *transcript_manager;
-	uint8_t idx = SESSION_0_L1L2_HASH_CONTEXT_INDEX;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
 
 	TEST_START;
 
@@ -3308,6 +3691,10 @@ static void spdm_transcript_manager_test_session_reset_session_transcript (CuTes
 		testing.hash_engine_mock[idx].base.update, &testing.hash_engine_mock[idx], 0,
 		MOCK_ARG_PTR_CONTAINS (&data, sizeof (data)), MOCK_ARG (sizeof (data)));
 
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.save_context, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_NOT_NULL);
+
 	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
 		testing.hash_engine_mock[idx].base.cancel, &testing.hash_engine_mock[idx], 0);
 
@@ -3317,7 +3704,10 @@ static void spdm_transcript_manager_test_session_reset_session_transcript (CuTes
 		(uint8_t*) &data, sizeof (data), true, 0);
 	CuAssertIntEquals (test, 0, status);
 
+	CuAssertIntEquals (test, true, testing.state.session_transcript[0].l1l2.hash_started);
+
 	transcript_manager->reset_session_transcript (transcript_manager, 0);
+	CuAssertIntEquals (test, false, testing.state.session_transcript[0].l1l2.hash_started);
 
 	spdm_transcript_manager_testing_release (test, &testing);
 }
@@ -3583,6 +3973,118 @@ static void spdm_transcript_manager_test_session_get_hash_finish_fail (CuTest *t
 	spdm_transcript_manager_testing_release (test, &testing);
 }
 
+static void spdm_transcript_manager_test_session_get_hash_no_finish (CuTest *test)
+{
+	int status;
+	uint8_t data[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x01, 0x02, 0x03, 0x04};
+	uint8_t hash[SHA384_HASH_LENGTH];
+	uint8_t expected[SHA384_HASH_LENGTH];
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+	HASH_TESTING_ENGINE hash_engine;
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init (test, &testing, false);
+	transcript_manager = &testing.transcript_manager;
+
+	status = HASH_TESTING_ENGINE_INIT (&hash_engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, data, 4,
+		true, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, false,
+		true, 0, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_engine.base.calculate_sha384 (&hash_engine.base, data, 4, expected,
+		sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (expected, hash, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The transcript can still be updated after getting the intermediate hash. */
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, &data[4],
+		4, true, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, true,
+		true, 0, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_engine.base.calculate_sha384 (&hash_engine.base, data, sizeof (data), expected,
+		sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (expected, hash, sizeof (expected));
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, true,
+		true, 0, hash, sizeof (hash));
+	CuAssertIntEquals (test, SPDM_TRANSCRIPT_MANAGER_HASH_NOT_STARTED, status);
+
+	HASH_TESTING_ENGINE_RELEASE (&hash_engine);
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
+static void spdm_transcript_manager_test_session_get_hash_restore_context_fail (CuTest *test)
+{
+	int status;
+	uint32_t data = 0xDEADBEEF;
+	struct spdm_transcript_manager_testing testing;
+	struct spdm_transcript_manager *transcript_manager;
+	uint8_t idx = SESSION_HASH_CONTEXT_INDEX;
+	uint8_t hash[SHA384_HASH_LENGTH];
+
+	TEST_START;
+
+	spdm_transcript_manager_testing_init (test, &testing, true);
+	transcript_manager = &testing.transcript_manager;
+
+	status = transcript_manager->set_hash_algo (transcript_manager, HASH_TYPE_SHA384);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.start_sha384, &testing.hash_engine_mock[idx], 0);
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.update, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_NOT_NULL, MOCK_ARG (0));
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.update, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_PTR_CONTAINS (&data, sizeof (data)), MOCK_ARG (sizeof (data)));
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.save_context, &testing.hash_engine_mock[idx], 0,
+		MOCK_ARG_NOT_NULL);
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.cancel, &testing.hash_engine_mock[idx], 0);
+
+	status |= mock_expect (&testing.hash_engine_mock[idx].mock,
+		testing.hash_engine_mock[idx].base.restore_context, &testing.hash_engine_mock[idx],
+		HASH_ENGINE_INVALID_CONTEXT, MOCK_ARG_NOT_NULL);
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->update (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH,
+		(uint8_t*) &data, sizeof (data), true, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = transcript_manager->get_hash (transcript_manager, TRANSCRIPT_CONTEXT_TYPE_TH, true,
+		true, 0, hash, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_CONTEXT, status);
+
+	spdm_transcript_manager_testing_release (test, &testing);
+}
+
 // *INDENT-OFF*
 TEST_SUITE_START (spdm_transcript_manager);
 
@@ -3593,6 +4095,8 @@ TEST (spdm_transcript_manager_test_init_invalid_params);
 TEST (spdm_transcript_manager_test_release_null);
 TEST (spdm_transcript_manager_test_reset);
 TEST (spdm_transcript_manager_test_reset_invalid_params);
+TEST (spdm_transcript_manager_test_reset_connection);
+TEST (spdm_transcript_manager_test_reset_connection_invalid_params);
 TEST (spdm_transcript_manager_test_update_vca);
 TEST (spdm_transcript_manager_test_update_invalid_params);
 TEST (spdm_transcript_manager_test_vca_buffer_full);
@@ -3676,6 +4180,11 @@ TEST (spdm_transcript_manager_test_session_update_th_SHA512_start_hash_fail);
 TEST (spdm_transcript_manager_test_session_update_th_SHA512_update_hash_fail);
 TEST (spdm_transcript_manager_test_session_update_th_SHA512_second_update_hash_fail);
 TEST (spdm_transcript_manager_test_session_update_th_invalid_session_idx);
+TEST (spdm_transcript_manager_test_session_update_multiple_sessions);
+TEST (spdm_transcript_manager_test_session_update_after_new_connection);
+TEST (spdm_transcript_manager_test_session_update_th_restore_context_fail);
+TEST (spdm_transcript_manager_test_session_update_th_save_context_fail);
+TEST (spdm_transcript_manager_test_session_update_no_session_hash_engine);
 TEST (spdm_transcript_manager_test_session_reset_session_transcript);
 TEST (spdm_transcript_manager_test_session_reset_invalid_params);
 TEST (spdm_transcript_manager_test_session_set_hash_algo_invalid_params);
@@ -3686,6 +4195,8 @@ TEST (spdm_transcript_manager_test_session_get_hash_unsupported_hash_type);
 TEST (spdm_transcript_manager_test_session_get_hash_not_started);
 TEST (spdm_transcript_manager_test_session_get_hash_double_get);
 TEST (spdm_transcript_manager_test_session_get_hash_finish_fail);
+TEST (spdm_transcript_manager_test_session_get_hash_no_finish);
+TEST (spdm_transcript_manager_test_session_get_hash_restore_context_fail);
 
 
 TEST_SUITE_END;
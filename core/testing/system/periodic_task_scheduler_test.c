@@ -0,0 +1,864 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "system/periodic_task_scheduler.h"
+#include "system/periodic_task_scheduler_static.h"
+#include "testing/mock/system/periodic_task_handler_mock.h"
+
+
+TEST_SUITE_LABEL ("periodic_task_scheduler");
+
+
+/**
+ * Dependencies for testing.
+ */
+struct periodic_task_scheduler_testing {
+	struct periodic_task_handler_mock handler1;			/**< A mock periodic handler. */
+	struct periodic_task_handler_mock handler2;			/**< A mock periodic handler. */
+	struct periodic_task_handler_mock handler3;			/**< A mock periodic handler. */
+	struct periodic_task_handler_mock handler4;			/**< A mock periodic handler. */
+	const struct periodic_task_handler *list[4];		/**< List of handlers to schedule. */
+	struct periodic_task_scheduler_entry entries[4];	/**< Heap storage for the scheduler. */
+	struct periodic_task_scheduler_state state;			/**< Variable context for the scheduler. */
+	struct periodic_task_scheduler test;				/**< The scheduler under test. */
+	platform_clock start;								/**< Start time of the test. */
+	platform_clock time_500ms;							/**< A time 500ms in the future. */
+	platform_clock time_1000ms;							/**< A time 1000ms in the future. */
+	platform_clock time_2000ms;							/**< A time 2000ms in the future. */
+};
+
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to initialize.
+ */
+static void periodic_task_scheduler_testing_init_dependencies (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler)
+{
+	int status;
+
+	status = periodic_task_handler_mock_init (&scheduler->handler1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_handler_mock_init (&scheduler->handler2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_handler_mock_init (&scheduler->handler3);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_handler_mock_init (&scheduler->handler4);
+	CuAssertIntEquals (test, 0, status);
+
+	mock_set_name (&scheduler->handler1.mock, "periodic_task_handler1");
+	mock_set_name (&scheduler->handler2.mock, "periodic_task_handler2");
+	mock_set_name (&scheduler->handler3.mock, "periodic_task_handler3");
+	mock_set_name (&scheduler->handler4.mock, "periodic_task_handler4");
+
+	scheduler->list[0] = &scheduler->handler1.base;
+	scheduler->list[1] = &scheduler->handler2.base;
+	scheduler->list[2] = &scheduler->handler3.base;
+	scheduler->list[3] = &scheduler->handler4.base;
+}
+
+/**
+ * Initialize the timeouts for the test.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to initialize.
+ */
+static void periodic_task_scheduler_testing_init_times (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler)
+{
+	int status;
+
+	status = platform_init_current_tick (&scheduler->start);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_timeout (500, &scheduler->time_500ms);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_timeout (1000, &scheduler->time_1000ms);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_timeout (2000, &scheduler->time_2000ms);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize a scheduler for testing.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to initialize.
+ * @param count The number of handlers to schedule.
+ */
+static void periodic_task_scheduler_testing_init (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler, size_t count)
+{
+	int status;
+
+	periodic_task_scheduler_testing_init_dependencies (test, scheduler);
+
+	status = periodic_task_scheduler_init (&scheduler->test, &scheduler->state, scheduler->list,
+		count, scheduler->entries);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Prepare the scheduler for execution.  All handlers will report the same execution time.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components.
+ * @param count The number of handlers in the scheduler.
+ * @param next The execution time that will be reported by each handler.
+ */
+static void periodic_task_scheduler_testing_prepare (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler, size_t count, const platform_clock *next)
+{
+	struct periodic_task_handler_mock *handler[] = {
+		&scheduler->handler1, &scheduler->handler2, &scheduler->handler3, &scheduler->handler4
+	};
+	size_t i;
+	int status = 0;
+
+	for (i = 0; i < count; i++) {
+		status |= mock_expect (&handler[i]->mock, handler[i]->base.prepare, handler[i], 0);
+		status |= mock_expect (&handler[i]->mock, handler[i]->base.get_next_execution,
+			handler[i], MOCK_RETURN_PTR (next));
+	}
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_prepare (&scheduler->test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_handler_mock_validate_and_release (&scheduler->handler1);
+	status |= periodic_task_handler_mock_validate_and_release (&scheduler->handler2);
+	status |= periodic_task_handler_mock_validate_and_release (&scheduler->handler3);
+	status |= periodic_task_handler_mock_validate_and_release (&scheduler->handler4);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_handler_mock_init (&scheduler->handler1);
+	status |= periodic_task_handler_mock_init (&scheduler->handler2);
+	status |= periodic_task_handler_mock_init (&scheduler->handler3);
+	status |= periodic_task_handler_mock_init (&scheduler->handler4);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release test dependencies and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to release.
+ */
+static void periodic_task_scheduler_testing_validate_and_release_dependencies (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler)
+{
+	int status;
+
+	status = periodic_task_handler_mock_validate_and_release (&scheduler->handler1);
+	status |= periodic_task_handler_mock_validate_and_release (&scheduler->handler2);
+	status |= periodic_task_handler_mock_validate_and_release (&scheduler->handler3);
+	status |= periodic_task_handler_mock_validate_and_release (&scheduler->handler4);
+
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release a test instance and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param scheduler The testing components to release.
+ */
+static void periodic_task_scheduler_testing_release (CuTest *test,
+	struct periodic_task_scheduler_testing *scheduler)
+{
+	periodic_task_scheduler_testing_validate_and_release_dependencies (test, scheduler);
+	periodic_task_scheduler_release (&scheduler->test);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void periodic_task_scheduler_test_init (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init_dependencies (test, &scheduler);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, scheduler.list, 4,
+		scheduler.entries);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, PERIODIC_TASK_NO_HANDLERS, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_init_null (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init_dependencies (test, &scheduler);
+
+	status = periodic_task_scheduler_init (NULL, &scheduler.state, scheduler.list, 4,
+		scheduler.entries);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, NULL, scheduler.list, 4,
+		scheduler.entries);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, NULL, 4,
+		scheduler.entries);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, scheduler.list, 0,
+		scheduler.entries);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_init (&scheduler.test, &scheduler.state, scheduler.list, 4,
+		NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	periodic_task_scheduler_testing_validate_and_release_dependencies (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_static_init (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	struct periodic_task_scheduler test_static =
+		periodic_task_scheduler_static_init (&scheduler.state, scheduler.list, 4,
+		scheduler.entries);
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init_dependencies (test, &scheduler);
+
+	status = periodic_task_scheduler_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&test_static);
+	CuAssertIntEquals (test, PERIODIC_TASK_NO_HANDLERS, status);
+
+	periodic_task_scheduler_testing_validate_and_release_dependencies (test, &scheduler);
+	periodic_task_scheduler_release (&test_static);
+}
+
+static void periodic_task_scheduler_test_static_init_null (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	struct periodic_task_scheduler test_static =
+		periodic_task_scheduler_static_init (&scheduler.state, scheduler.list, 4,
+		scheduler.entries);
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_scheduler_init_state (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	test_static.state = NULL;
+	status = periodic_task_scheduler_init_state (&test_static);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	test_static.state = &scheduler.state;
+	test_static.handlers = NULL;
+	status = periodic_task_scheduler_init_state (&test_static);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	test_static.handlers = scheduler.list;
+	test_static.num_handlers = 0;
+	status = periodic_task_scheduler_init_state (&test_static);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	test_static.num_handlers = 4;
+	test_static.entries = NULL;
+	status = periodic_task_scheduler_init_state (&test_static);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_scheduler_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	periodic_task_scheduler_release (NULL);
+}
+
+static void periodic_task_scheduler_test_prepare (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 2);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.prepare,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.prepare,
+		&scheduler.handler2, 0);
+
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_1000ms));
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.get_next_execution,
+		&scheduler.handler2, MOCK_RETURN_PTR (&scheduler.time_500ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_prepare (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_prepare_null_handler (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 3);
+	scheduler.list[1] = NULL;
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.prepare,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler3.mock, scheduler.handler3.base.prepare,
+		&scheduler.handler3, 0);
+
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (NULL));
+	status |= mock_expect (&scheduler.handler3.mock, scheduler.handler3.base.get_next_execution,
+		&scheduler.handler3, MOCK_RETURN_PTR (NULL));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_prepare (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_prepare_no_handlers (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 2);
+	scheduler.list[0] = NULL;
+	scheduler.list[1] = NULL;
+
+	status = periodic_task_scheduler_prepare (&scheduler.test);
+	CuAssertIntEquals (test, PERIODIC_TASK_NO_HANDLERS, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, PERIODIC_TASK_NO_HANDLERS, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_prepare_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_scheduler_prepare (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_scheduler_test_execute_due_handlers (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 1);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+	periodic_task_scheduler_testing_prepare (test, &scheduler, 1, &scheduler.time_500ms);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.execute,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_due_handlers_null_execution_time (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 1);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+	periodic_task_scheduler_testing_prepare (test, &scheduler, 1, NULL);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.execute,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (NULL));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 50));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_due_handlers_multiple (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 4);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.prepare,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.prepare,
+		&scheduler.handler2, 0);
+	status |= mock_expect (&scheduler.handler3.mock, scheduler.handler3.base.prepare,
+		&scheduler.handler3, 0);
+	status |= mock_expect (&scheduler.handler4.mock, scheduler.handler4.base.prepare,
+		&scheduler.handler4, 0);
+
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_1000ms));
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.get_next_execution,
+		&scheduler.handler2, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+	status |= mock_expect (&scheduler.handler3.mock, scheduler.handler3.base.get_next_execution,
+		&scheduler.handler3, MOCK_RETURN_PTR (&scheduler.time_500ms));
+	status |= mock_expect (&scheduler.handler4.mock, scheduler.handler4.base.get_next_execution,
+		&scheduler.handler4, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	status |= mock_expect (&scheduler.handler3.mock, scheduler.handler3.base.execute,
+		&scheduler.handler3, 0);
+	status |= mock_expect (&scheduler.handler3.mock, scheduler.handler3.base.get_next_execution,
+		&scheduler.handler3, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_prepare (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.execute,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 1000));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1500));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_due_handlers_all_due (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 4);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+	periodic_task_scheduler_testing_prepare (test, &scheduler, 4, &scheduler.time_500ms);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.execute,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.execute,
+		&scheduler.handler2, 0);
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.get_next_execution,
+		&scheduler.handler2, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	status |= mock_expect (&scheduler.handler3.mock, scheduler.handler3.base.execute,
+		&scheduler.handler3, 0);
+	status |= mock_expect (&scheduler.handler3.mock, scheduler.handler3.base.get_next_execution,
+		&scheduler.handler3, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	status |= mock_expect (&scheduler.handler4.mock, scheduler.handler4.base.execute,
+		&scheduler.handler4, 0);
+	status |= mock_expect (&scheduler.handler4.mock, scheduler.handler4.base.get_next_execution,
+		&scheduler.handler4, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_due_handlers_always_ready (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+	int i;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 2);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+	periodic_task_scheduler_testing_prepare (test, &scheduler, 2, NULL);
+
+	/* A handler that is always ready must not prevent other handlers from running. */
+	for (i = 0; i < 3; i++) {
+		status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.execute,
+			&scheduler.handler1, 0);
+		status |= mock_expect (&scheduler.handler1.mock,
+			scheduler.handler1.base.get_next_execution, &scheduler.handler1, MOCK_RETURN_PTR (NULL));
+
+		status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.execute,
+			&scheduler.handler2, 0);
+		status |= mock_expect (&scheduler.handler2.mock,
+			scheduler.handler2.base.get_next_execution, &scheduler.handler2, MOCK_RETURN_PTR (NULL));
+
+		CuAssertIntEquals (test, 0, status);
+
+		status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_execute_due_handlers_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_scheduler_execute_due_handlers (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_scheduler_test_notify (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 2);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+	periodic_task_scheduler_testing_prepare (test, &scheduler, 2, &scheduler.time_2000ms);
+
+	status = periodic_task_scheduler_notify (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.get_next_execution,
+		&scheduler.handler2, MOCK_RETURN_PTR (NULL));
+
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.execute,
+		&scheduler.handler2, 0);
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.get_next_execution,
+		&scheduler.handler2, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 50));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_notify_from_isr (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	int status;
+	platform_clock end;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 1);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+	periodic_task_scheduler_testing_prepare (test, &scheduler, 1, &scheduler.time_2000ms);
+
+	status = periodic_task_scheduler_notify_from_isr (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_500ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	/* Nothing is due after the refresh, so no handlers are executed. */
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 50));
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.execute,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_init_current_tick (&end);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) >= 500));
+	CuAssertTrue (test, (platform_get_duration (&scheduler.start, &end) < 1000));
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_notify_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_scheduler_notify (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_notify_from_isr (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_scheduler_test_get_stats (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	struct periodic_task_scheduler_stats stats;
+	int status;
+	int i;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 2);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.prepare,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.prepare,
+		&scheduler.handler2, 0);
+
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (NULL));
+	status |= mock_expect (&scheduler.handler2.mock, scheduler.handler2.base.get_next_execution,
+		&scheduler.handler2, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_prepare (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_stats (&scheduler.test, &scheduler.handler1.base,
+		&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.executions);
+
+	for (i = 0; i < 3; i++) {
+		status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.execute,
+			&scheduler.handler1, 0);
+		status |= mock_expect (&scheduler.handler1.mock,
+			scheduler.handler1.base.get_next_execution, &scheduler.handler1, MOCK_RETURN_PTR (NULL));
+
+		CuAssertIntEquals (test, 0, status);
+
+		status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = periodic_task_scheduler_get_stats (&scheduler.test, &scheduler.handler1.base,
+		&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 3, stats.executions);
+	CuAssertTrue (test, (stats.max_exec_time <= stats.total_exec_time));
+	CuAssertTrue (test, (stats.max_lateness <= stats.total_lateness));
+	CuAssertTrue (test, (stats.max_lateness < 50));
+
+	status = periodic_task_scheduler_get_stats (&scheduler.test, &scheduler.handler2.base,
+		&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, stats.executions);
+	CuAssertIntEquals (test, 0, stats.total_exec_time);
+	CuAssertIntEquals (test, 0, stats.max_exec_time);
+	CuAssertIntEquals (test, 0, stats.total_lateness);
+	CuAssertIntEquals (test, 0, stats.max_lateness);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_get_stats_lateness (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	struct periodic_task_scheduler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 1);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+	periodic_task_scheduler_testing_prepare (test, &scheduler, 1, NULL);
+
+	platform_msleep (100);
+
+	status = mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.execute,
+		&scheduler.handler1, 0);
+	status |= mock_expect (&scheduler.handler1.mock, scheduler.handler1.base.get_next_execution,
+		&scheduler.handler1, MOCK_RETURN_PTR (&scheduler.time_2000ms));
+
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_execute_due_handlers (&scheduler.test);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_scheduler_get_stats (&scheduler.test, &scheduler.handler1.base,
+		&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 1, stats.executions);
+	CuAssertTrue (test, (stats.max_lateness >= 100));
+	CuAssertIntEquals (test, stats.max_lateness, stats.total_lateness);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_get_stats_unknown_handler (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	struct periodic_task_scheduler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 2);
+	periodic_task_scheduler_testing_init_times (test, &scheduler);
+	periodic_task_scheduler_testing_prepare (test, &scheduler, 2, &scheduler.time_2000ms);
+
+	status = periodic_task_scheduler_get_stats (&scheduler.test, &scheduler.handler3.base,
+		&stats);
+	CuAssertIntEquals (test, PERIODIC_TASK_UNKNOWN_HANDLER, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+static void periodic_task_scheduler_test_get_stats_null (CuTest *test)
+{
+	struct periodic_task_scheduler_testing scheduler;
+	struct periodic_task_scheduler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_scheduler_testing_init (test, &scheduler, 1);
+
+	status = periodic_task_scheduler_get_stats (NULL, &scheduler.handler1.base, &stats);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_get_stats (&scheduler.test, NULL, &stats);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_scheduler_get_stats (&scheduler.test, &scheduler.handler1.base, NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	periodic_task_scheduler_testing_release (test, &scheduler);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (periodic_task_scheduler);
+
+TEST (periodic_task_scheduler_test_init);
+TEST (periodic_task_scheduler_test_init_null);
+TEST (periodic_task_scheduler_test_static_init);
+TEST (periodic_task_scheduler_test_static_init_null);
+TEST (periodic_task_scheduler_test_release_null);
+TEST (periodic_task_scheduler_test_prepare);
+TEST (periodic_task_scheduler_test_prepare_null_handler);
+TEST (periodic_task_scheduler_test_prepare_no_handlers);
+TEST (periodic_task_scheduler_test_prepare_null);
+TEST (periodic_task_scheduler_test_execute_due_handlers);
+TEST (periodic_task_scheduler_test_execute_due_handlers_null_execution_time);
+TEST (periodic_task_scheduler_test_execute_due_handlers_multiple);
+TEST (periodic_task_scheduler_test_execute_due_handlers_all_due);
+TEST (periodic_task_scheduler_test_execute_due_handlers_always_ready);
+TEST (periodic_task_scheduler_test_execute_due_handlers_null);
+TEST (periodic_task_scheduler_test_notify);
+TEST (periodic_task_scheduler_test_notify_from_isr);
+TEST (periodic_task_scheduler_test_notify_null);
+TEST (periodic_task_scheduler_test_get_stats);
+TEST (periodic_task_scheduler_test_get_stats_lateness);
+TEST (periodic_task_scheduler_test_get_stats_unknown_handler);
+TEST (periodic_task_scheduler_test_get_stats_null);
+
+TEST_SUITE_END;
+// *INDENT-ON*
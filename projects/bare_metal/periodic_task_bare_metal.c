@@ -5,7 +5,6 @@
 #include <stddef.h>
 #include <string.h>
 #include "periodic_task_bare_metal.h"
-#include "common/unused.h"
 #include "system/system_logging.h"
 
 
@@ -13,26 +12,54 @@
  * Initialize a periodic handler task.
  *
  * @param task The periodic handler task to initialize.
+ * @param state Variable context for the task.  This must be uninitialized.
  * @param handlers The list of handlers that can be used with this task instance.
  * @param num_handlers The number of handlers in the list.
+ * @param entries Storage for scheduling the handlers.  This must have space for the same number of
+ * entries as the handler list.
  * @param log_id Identifier for this task in log messages.
  *
  * @return 0 if the task was initialized or an error code
  */
 int periodic_task_bare_metal_init (struct periodic_task_bare_metal *task,
-	const struct periodic_task_handler **handlers, size_t num_handlers, int log_id)
+	struct periodic_task_bare_metal_state *state, const struct periodic_task_handler **handlers,
+	size_t num_handlers, struct periodic_task_scheduler_entry *entries, int log_id)
 {
-	if (task == NULL) {
+	if ((task == NULL) || (state == NULL)) {
 		return PERIODIC_TASK_INVALID_ARGUMENT;
 	}
 
 	memset (task, 0, sizeof (struct periodic_task_bare_metal));
 
-	task->handlers = handlers;
-	task->num_handlers = num_handlers;
+	task->state = state;
+	task->scheduler.state = &state->scheduler;
+	task->scheduler.handlers = handlers;
+	task->scheduler.num_handlers = num_handlers;
+	task->scheduler.entries = entries;
 	task->id = log_id;
 
-	return 0;
+	return periodic_task_bare_metal_init_state (task);
+}
+
+/**
+ * Initialize only the variable state for a periodic handler task.  The rest of the task instance is
+ * assumed to have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param task The task instance that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int periodic_task_bare_metal_init_state (const struct periodic_task_bare_metal *task)
+{
+	if ((task == NULL) || (task->state == NULL)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (task->state, 0, sizeof (struct periodic_task_bare_metal_state));
+
+	return periodic_task_scheduler_init_state (&task->scheduler);
 }
 
 /**
@@ -42,7 +69,9 @@ int periodic_task_bare_metal_init (struct periodic_task_bare_metal *task,
  */
 void periodic_task_bare_metal_release (const struct periodic_task_bare_metal *task)
 {
-	UNUSED (task);
+	if (task) {
+		periodic_task_scheduler_release (&task->scheduler);
+	}
 }
 
 /**
@@ -50,7 +79,7 @@ void periodic_task_bare_metal_release (const struct periodic_task_bare_metal *ta
  * started.
  *
  * Execution of a task will enter an infinite loop, executing the registered handlers.  This call
- * will not return.
+ * will not return unless there are no handlers to execute.
  *
  * @param task The periodic task to start.
  *
@@ -65,10 +94,20 @@ int periodic_task_bare_metal_start (const struct periodic_task_bare_metal *task)
 		return PERIODIC_TASK_INVALID_ARGUMENT;
 	}
 
-	periodic_task_prepare_handlers (task->handlers, task->num_handlers);
+	status = periodic_task_scheduler_prepare (&task->scheduler);
+	if (status != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
+			SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
+
+		if (status == PERIODIC_TASK_NO_HANDLERS) {
+			return status;
+		}
+
+		last_error = status;
+	}
 
 	while (1) {
-		status = periodic_task_execute_next_handler (task->handlers, task->num_handlers);
+		status = periodic_task_scheduler_execute_due_handlers (&task->scheduler);
 		if ((status != 0) && (status != last_error)) {
 			debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
 				SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
@@ -77,3 +116,20 @@ int periodic_task_bare_metal_start (const struct periodic_task_bare_metal *task)
 		last_error = status;
 	}
 }
+
+/**
+ * Notify the task that the execution time for one or more handlers has changed outside of handler
+ * execution.  The task will refresh its schedule and run any handlers that are now due.
+ *
+ * @param task The periodic task to notify.
+ *
+ * @return 0 if the task was notified or an error code.
+ */
+int periodic_task_bare_metal_notify (const struct periodic_task_bare_metal *task)
+{
+	if (task == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	return periodic_task_scheduler_notify (&task->scheduler);
+}
@@ -1,29 +1,40 @@
-// Copyright (c) Microsoft Corporation. All rights reserved.
-// Licensed under the MIT license.
-
-#ifndef PERIODIC_TASK_BARE_METAL_H_
-#define PERIODIC_TASK_BARE_METAL_H_
-
-#include <stdint.h>
-#include <stdbool.h>
-#include "system/periodic_task.h"
-
-
-/**
- * FreeRTOS implementation for a task to handle event processing.
- */
-struct periodic_task_bare_metal {
-	const struct periodic_task_handler **handlers;	/**< List of registered handlers. */
-	size_t num_handlers;							/**< Number of registered handlers in the list. */
-	int id;											/**< Logging identifier. */
-};
-
-
-int periodic_task_bare_metal_init (struct periodic_task_bare_metal *task,
-	const struct periodic_task_handler **handlers, size_t num_handlers, int log_id);
-void periodic_task_bare_metal_release (const struct periodic_task_bare_metal *task);
-
-int periodic_task_bare_metal_start (const struct periodic_task_bare_metal *task);
-
-
-#endif /* PERIODIC_TASK_BARE_METAL_H_ */
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef PERIODIC_TASK_BARE_METAL_H_
+#define PERIODIC_TASK_BARE_METAL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "system/periodic_task.h"
+#include "system/periodic_task_scheduler.h"
+
+
+/**
+ * Variable context for the task.
+ */
+struct periodic_task_bare_metal_state {
+	struct periodic_task_scheduler_state scheduler;	/**< Variable context for handler scheduling. */
+};
+
+/**
+ * Bare-metal implementation for a task to execute periodic handlers.
+ */
+struct periodic_task_bare_metal {
+	struct periodic_task_bare_metal_state *state;	/**< Variable context for the task. */
+	struct periodic_task_scheduler scheduler;		/**< Scheduler for the registered handlers. */
+	int id;											/**< Logging identifier. */
+};
+
+
+int periodic_task_bare_metal_init (struct periodic_task_bare_metal *task,
+	struct periodic_task_bare_metal_state *state, const struct periodic_task_handler **handlers,
+	size_t num_handlers, struct periodic_task_scheduler_entry *entries, int log_id);
+int periodic_task_bare_metal_init_state (const struct periodic_task_bare_metal *task);
+void periodic_task_bare_metal_release (const struct periodic_task_bare_metal *task);
+
+int periodic_task_bare_metal_start (const struct periodic_task_bare_metal *task);
+int periodic_task_bare_metal_notify (const struct periodic_task_bare_metal *task);
+
+
+#endif /* PERIODIC_TASK_BARE_METAL_H_ */
@@ -5,21 +5,27 @@
 #define PERIODIC_TASK_BARE_METAL_STATIC_H_
 
 #include "periodic_task_bare_metal.h"
+#include "system/periodic_task_scheduler_static.h"
 
 
 /**
- * Initialize a static instance of a bare-metal periodic handler task.  This can be a constant
- * instance.
+ * Initialize a static instance of a bare-metal periodic handler task.  This does not initialize the
+ * task state.  This can be a constant instance.
  *
  * There is no validation done on the arguments.
  *
+ * @param state_ptr Variable context for the task.
  * @param handlers_list The list of event handlers that can be used with this task instance.
  * @param count The number of event handlers in the list.
+ * @param entries_ptr Storage for scheduling the handlers.  This must have space for the same number
+ * of entries as the handler list.
  * @param log_id Identifier for this task in log messages.
  */
-#define	periodic_task_bare_metal_static_init(handlers_list, count, log_id)	{ \
-		.handlers = handlers_list, \
-		.num_handlers = (count), \
+#define	periodic_task_bare_metal_static_init(state_ptr, handlers_list, count, entries_ptr, \
+	log_id)	{ \
+		.state = state_ptr, \
+		.scheduler = periodic_task_scheduler_static_init (&(state_ptr)->scheduler, handlers_list, \
+			(count), entries_ptr), \
 		.id = log_id \
 	}
 
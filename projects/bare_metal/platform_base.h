@@ -71,6 +71,27 @@ typedef volatile int platform_semaphore;
 #define	platform_semaphore_post_from_isr	platform_semaphore_post
 
 
+/* Atomic operations.  Single-threaded environment, so normal memory accesses are sufficient. */
+static inline uint32_t platform_atomic_load (const uint32_t *value)
+{
+	return *(const volatile uint32_t*) value;
+}
+
+static inline void platform_atomic_store (uint32_t *value, uint32_t new_value)
+{
+	*(volatile uint32_t*) value = new_value;
+}
+
+static inline uint32_t platform_atomic_fetch_add (uint32_t *value, uint32_t add)
+{
+	uint32_t prev = *value;
+
+	*value = prev + add;
+
+	return prev;
+}
+
+
 /* Tasks.  Single-threaded environment with no OS running. */
 static inline int platform_os_suspend_scheduler (void)
 {
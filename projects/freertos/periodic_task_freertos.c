@@ -16,23 +16,27 @@
  * @param state Variable context for the task.  This must be uninitialized.
  * @param handlers The list of handlers that can be used with this task instance.
  * @param num_handlers The number of handlers in the list.
+ * @param entries Storage for scheduling the handlers.  This must have space for the same number of
+ * entries as the handler list.
  * @param log_id Identifier for this task in log messages.
  *
  * @return 0 if the task was initialized or an error code
  */
 int periodic_task_freertos_init (struct periodic_task_freertos *task,
 	struct periodic_task_freertos_state *state, const struct periodic_task_handler **handlers,
-	size_t num_handlers, int log_id)
+	size_t num_handlers, struct periodic_task_scheduler_entry *entries, int log_id)
 {
-	if (task == NULL) {
+	if ((task == NULL) || (state == NULL)) {
 		return PERIODIC_TASK_INVALID_ARGUMENT;
 	}
 
 	memset (task, 0, sizeof (struct periodic_task_freertos));
 
 	task->state = state;
-	task->handlers = handlers;
-	task->num_handlers = num_handlers;
+	task->scheduler.state = &state->scheduler;
+	task->scheduler.handlers = handlers;
+	task->scheduler.num_handlers = num_handlers;
+	task->scheduler.entries = entries;
 	task->id = log_id;
 
 	return periodic_task_freertos_init_state (task);
@@ -51,14 +55,13 @@ int periodic_task_freertos_init (struct periodic_task_freertos *task,
  */
 int periodic_task_freertos_init_state (const struct periodic_task_freertos *task)
 {
-	if ((task == NULL) || (task->state == NULL) || (task->handlers == NULL) ||
-		(task->num_handlers == 0)) {
+	if ((task == NULL) || (task->state == NULL)) {
 		return PERIODIC_TASK_INVALID_ARGUMENT;
 	}
 
 	memset (task->state, 0, sizeof (struct periodic_task_freertos_state));
 
-	return 0;
+	return periodic_task_scheduler_init_state (&task->scheduler);
 }
 
 /**
@@ -73,6 +76,7 @@ void periodic_task_freertos_release (const struct periodic_task_freertos *task)
 {
 	if (task) {
 		vTaskDelete (task->state->task);
+		periodic_task_scheduler_release (&task->scheduler);
 	}
 }
 
@@ -89,10 +93,20 @@ static void periodic_task_freertos_loop (struct periodic_task_freertos *task)
 	/* Wait for the task to be started before executing anything in the task context. */
 	ulTaskNotifyTake (pdTRUE, portMAX_DELAY);
 
-	periodic_task_prepare_handlers (task->handlers, task->num_handlers);
+	status = periodic_task_scheduler_prepare (&task->scheduler);
+	if (status != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
+			SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
+
+		if (status == PERIODIC_TASK_NO_HANDLERS) {
+			vTaskSuspend (NULL);
+		}
+
+		last_error = status;
+	}
 
 	while (1) {
-		status = periodic_task_execute_next_handler (task->handlers, task->num_handlers);
+		status = periodic_task_scheduler_execute_due_handlers (&task->scheduler);
 		if ((status != 0) && (status != last_error)) {
 			debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
 				SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
@@ -180,3 +194,20 @@ void periodic_task_freertos_start (const struct periodic_task_freertos *task)
 		xTaskNotifyGive (task->state->task);
 	}
 }
+
+/**
+ * Notify the task that the execution time for one or more handlers has changed outside of handler
+ * execution.  The task will refresh its schedule and run any handlers that are now due.
+ *
+ * @param task The periodic task to notify.
+ *
+ * @return 0 if the task was notified or an error code.
+ */
+int periodic_task_freertos_notify (const struct periodic_task_freertos *task)
+{
+	if (task == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	return periodic_task_scheduler_notify (&task->scheduler);
+}
@@ -9,12 +9,14 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "system/periodic_task.h"
+#include "system/periodic_task_scheduler.h"
 
 
 /**
  * Variable context for the task.
  */
 struct periodic_task_freertos_state {
+	struct periodic_task_scheduler_state scheduler;	/**< Variable context for handler scheduling. */
 	TaskHandle_t task;								/**< The task that will execute periodic operations. */
 };
 
@@ -23,15 +25,14 @@ struct periodic_task_freertos_state {
  */
 struct periodic_task_freertos {
 	struct periodic_task_freertos_state *state;		/**< Variable context for the task. */
-	const struct periodic_task_handler **handlers;	/**< List of registered handlers. */
-	size_t num_handlers;							/**< Number of registered handlers in the list. */
+	struct periodic_task_scheduler scheduler;		/**< Scheduler for the registered handlers. */
 	int id;											/**< Logging identifier. */
 };
 
 
 int periodic_task_freertos_init (struct periodic_task_freertos *task,
 	struct periodic_task_freertos_state *state, const struct periodic_task_handler **handlers,
-	size_t num_handlers, int log_id);
+	size_t num_handlers, struct periodic_task_scheduler_entry *entries, int log_id);
 int periodic_task_freertos_init_state (const struct periodic_task_freertos *task);
 void periodic_task_freertos_release (const struct periodic_task_freertos *task);
 
@@ -47,6 +48,7 @@ int periodic_task_freertos_allocate_static (const struct periodic_task_freertos
 #endif
 
 void periodic_task_freertos_start (const struct periodic_task_freertos *task);
+int periodic_task_freertos_notify (const struct periodic_task_freertos *task);
 
 
 #endif /* PERIODIC_TASK_FREERTOS_H_ */
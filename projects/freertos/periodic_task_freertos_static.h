@@ -5,6 +5,7 @@
 #define PERIODIC_TASK_FREERTOS_STATIC_H_
 
 #include "periodic_task_freertos.h"
+#include "system/periodic_task_scheduler_static.h"
 
 
 /**
@@ -17,12 +18,15 @@
  * @param state_ptr Variable context for the task.
  * @param handlers_list The list of event handlers that can be used with this task instance.
  * @param count The number of event handlers in the list.
+ * @param entries_ptr Storage for scheduling the handlers.  This must have space for the same number
+ * of entries as the handler list.
  * @param log_id Identifier for this task in log messages.
  */
-#define	periodic_task_freertos_static_init(state_ptr, handlers_list, count, log_id)	{ \
+#define	periodic_task_freertos_static_init(state_ptr, handlers_list, count, entries_ptr, \
+	log_id)	{ \
 		.state = state_ptr, \
-		.handlers = handlers_list, \
-		.num_handlers = count, \
+		.scheduler = periodic_task_scheduler_static_init (&(state_ptr)->scheduler, handlers_list, \
+			count, entries_ptr), \
 		.id = log_id \
 	}
 
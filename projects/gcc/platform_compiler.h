@@ -12,4 +12,10 @@ char* strdup (const char *s);
 size_t strnlen (const char *s, size_t maxLen);
 
 
+/* Use the GCC builtins for atomic operations. */
+#define	platform_atomic_load(x)				__atomic_load_n (x, __ATOMIC_ACQUIRE)
+#define	platform_atomic_store(x, val)		__atomic_store_n (x, val, __ATOMIC_RELEASE)
+#define	platform_atomic_fetch_add(x, val)	__atomic_fetch_add (x, val, __ATOMIC_ACQ_REL)
+
+
 #endif /* PLATFORM_COMPILER_H_ */
@@ -0,0 +1,195 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "attestation/pcr_store.h"
+#include "common/array_size.h"
+#include "testing/engines/hash_testing_engine.h"
+
+
+/**
+ * Number of measurements in the PCR used for benchmarking.
+ */
+#define	PCR_STORE_BENCH_MEASUREMENTS		32
+
+/**
+ * Size of each read from the measurement logs.
+ */
+#define	PCR_STORE_BENCH_LOG_CHUNK			512
+
+
+/**
+ * Context for PCR store benchmarks.
+ */
+struct pcr_store_bench {
+	HASH_TESTING_ENGINE hash;					/**< Hash engine for PCR calculations. */
+	struct pcr_store store;						/**< The PCR store being measured. */
+	uint8_t digest[SHA256_HASH_LENGTH];			/**< Digest used for measurement updates. */
+	uint8_t pcr[SHA256_HASH_LENGTH];			/**< Output for computed PCR values. */
+	uint8_t log[PCR_STORE_BENCH_LOG_CHUNK];		/**< Output for log data. */
+	uint8_t next;								/**< Next measurement to update. */
+};
+
+
+static int pcr_store_bench_setup (void **context)
+{
+	const struct pcr_config config[] = {
+		{
+			.num_measurements = PCR_STORE_BENCH_MEASUREMENTS,
+			.measurement_algo = HASH_TYPE_SHA256
+		},
+		{
+			.num_measurements = 8,
+			.measurement_algo = HASH_TYPE_SHA256
+		}
+	};
+	struct pcr_store_bench *bench;
+	int i;
+	int status;
+
+	bench = calloc (1, sizeof (struct pcr_store_bench));
+	if (bench == NULL) {
+		return PCR_NO_MEMORY;
+	}
+
+	status = HASH_TESTING_ENGINE_INIT (&bench->hash);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = pcr_store_init (&bench->store, config, ARRAY_SIZE (config));
+	if (status != 0) {
+		goto release_hash;
+	}
+
+	for (i = 0; i < PCR_STORE_BENCH_MEASUREMENTS; i++) {
+		memset (bench->digest, i, sizeof (bench->digest));
+
+		status = pcr_store_update_digest (&bench->store, PCR_MEASUREMENT (0, i), bench->digest,
+			sizeof (bench->digest));
+		if (status != 0) {
+			goto release_store;
+		}
+	}
+
+	status = pcr_store_compute_pcr (&bench->store, &bench->hash.base, 0, bench->pcr,
+		sizeof (bench->pcr));
+	if (ROT_IS_ERROR (status)) {
+		goto release_store;
+	}
+
+	*context = bench;
+
+	return 0;
+
+release_store:
+	pcr_store_release (&bench->store);
+release_hash:
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static void pcr_store_bench_teardown (void *context)
+{
+	struct pcr_store_bench *bench = context;
+
+	pcr_store_release (&bench->store);
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+	free (bench);
+}
+
+static int pcr_store_bench_compute_pcr (void *context)
+{
+	struct pcr_store_bench *bench = context;
+	int status;
+
+	status = pcr_store_compute_pcr (&bench->store, &bench->hash.base, 0, bench->pcr,
+		sizeof (bench->pcr));
+
+	return (ROT_IS_ERROR (status)) ? status : 0;
+}
+
+static int pcr_store_bench_update_and_compute (void *context)
+{
+	struct pcr_store_bench *bench = context;
+	int status;
+
+	bench->digest[0]++;
+
+	status = pcr_store_update_digest (&bench->store, PCR_MEASUREMENT (0, bench->next),
+		bench->digest, sizeof (bench->digest));
+	if (status != 0) {
+		return status;
+	}
+
+	bench->next = (bench->next + 1) % PCR_STORE_BENCH_MEASUREMENTS;
+
+	return pcr_store_bench_compute_pcr (bench);
+}
+
+static int pcr_store_bench_get_tcg_log (void *context)
+{
+	struct pcr_store_bench *bench = context;
+	size_t offset = 0;
+	int status;
+
+	do {
+		status = pcr_store_get_tcg_log (&bench->store, offset, bench->log, sizeof (bench->log));
+		if (ROT_IS_ERROR (status)) {
+			return status;
+		}
+
+		offset += status;
+	} while (status != 0);
+
+	return 0;
+}
+
+static int pcr_store_bench_get_attestation_log (void *context)
+{
+	struct pcr_store_bench *bench = context;
+	size_t offset = 0;
+	int status;
+
+	do {
+		status = pcr_store_get_attestation_log (&bench->store, &bench->hash.base, offset,
+			bench->log, sizeof (bench->log));
+		if (ROT_IS_ERROR (status)) {
+			return status;
+		}
+
+		offset += status;
+	} while (status != 0);
+
+	return 0;
+}
+
+
+static const struct bench_case pcr_store_bench_cases[] = {
+	{
+		"compute_pcr_unchanged", pcr_store_bench_setup, pcr_store_bench_compute_pcr,
+		pcr_store_bench_teardown, 0
+	},
+	{
+		"update_and_compute_pcr", pcr_store_bench_setup, pcr_store_bench_update_and_compute,
+		pcr_store_bench_teardown, 0
+	},
+	{
+		"get_tcg_log", pcr_store_bench_setup, pcr_store_bench_get_tcg_log,
+		pcr_store_bench_teardown, 0
+	},
+	{
+		"get_attestation_log", pcr_store_bench_setup, pcr_store_bench_get_attestation_log,
+		pcr_store_bench_teardown, 0
+	},
+};
+
+const struct bench_suite pcr_store_bench_suite =
+	BENCH_SUITE ("pcr_store", pcr_store_bench_cases);
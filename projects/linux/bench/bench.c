@@ -0,0 +1,407 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+
+
+/**
+ * Maximum number of times the iteration count will be adjusted to reach the minimum run time.
+ */
+#define	BENCH_MAX_CALIBRATION_ROUNDS	5
+
+
+/**
+ * The results for the case currently being run.  Additional metrics reported by the case are added
+ * here.
+ */
+static struct bench_result *bench_active_result = NULL;
+
+
+/**
+ * Get the current value of the monotonic clock.
+ *
+ * @return The current time, in nanoseconds.
+ */
+uint64_t bench_get_time_ns (void)
+{
+	struct timespec now;
+
+	clock_gettime (CLOCK_MONOTONIC, &now);
+
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + now.tv_nsec;
+}
+
+/**
+ * Initialize benchmark options with default values.
+ *
+ * @param options The options to initialize.
+ */
+void bench_options_init (struct bench_options *options)
+{
+	options->warmup_ns = 100ULL * 1000000;
+	options->min_time_ns = 500ULL * 1000000;
+	options->min_iter = 10;
+	options->filter = NULL;
+}
+
+/**
+ * Determine if a benchmark case should be run.  A case is selected if there is no filter or if the
+ * full name of the case, in the form 'suite/case', contains the filter string.
+ *
+ * @param options The benchmark options.
+ * @param suite The suite that contains the case.
+ * @param bench The case to check.
+ *
+ * @return true if the case should be run.
+ */
+bool bench_case_is_selected (const struct bench_options *options, const struct bench_suite *suite,
+	const struct bench_case *bench)
+{
+	char full_name[256];
+
+	if ((options->filter == NULL) || (options->filter[0] == '\0')) {
+		return true;
+	}
+
+	snprintf (full_name, sizeof (full_name), "%s/%s", suite->name, bench->name);
+
+	return (strstr (full_name, options->filter) != NULL);
+}
+
+/**
+ * Execute a batch of benchmark operations.
+ *
+ * @param bench The case to run.
+ * @param context The context for the case.
+ * @param iterations The number of operations to run.
+ * @param elapsed Output for the total time taken by the batch.
+ *
+ * @return 0 if all operations completed successfully or the error from the first failure.
+ */
+static int bench_run_batch (const struct bench_case *bench, void *context, uint64_t iterations,
+	uint64_t *elapsed)
+{
+	uint64_t start;
+	uint64_t i;
+	int status;
+
+	start = bench_get_time_ns ();
+
+	for (i = 0; i < iterations; i++) {
+		status = bench->run (context);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	*elapsed = bench_get_time_ns () - start;
+
+	return 0;
+}
+
+/**
+ * Run a single benchmark case.  The case is first run repeatedly for the warm-up time, which is also
+ * used to estimate the number of iterations needed to reach the minimum measurement time.  If the
+ * measured batch completes too quickly, the iteration count is scaled up and the batch is repeated.
+ *
+ * @param options Options for running the case.
+ * @param suite The suite that contains the case.
+ * @param bench The case to run.
+ * @param result Output for the case measurements.
+ *
+ * @return 0 if the case completed successfully or an error code.  The error is also reported in
+ * the result.
+ */
+int bench_run_case (const struct bench_options *options, const struct bench_suite *suite,
+	const struct bench_case *bench, struct bench_result *result)
+{
+	void *context = NULL;
+	uint64_t start;
+	uint64_t elapsed;
+	uint64_t warmup = 0;
+	uint64_t iterations;
+	uint64_t allocs_start;
+	uint64_t alloc_bytes_start;
+	uint64_t allocs_end;
+	uint64_t alloc_bytes_end;
+	int round;
+	int status;
+
+	memset (result, 0, sizeof (*result));
+	result->suite = suite->name;
+	result->name = bench->name;
+	bench_active_result = result;
+
+	if (bench->setup) {
+		status = bench->setup (&context);
+		if (status != 0) {
+			result->status = status;
+			bench_active_result = NULL;
+
+			return status;
+		}
+	}
+
+	/* Warm caches and lazily initialized state, and get an estimate of the cost of each call. */
+	start = bench_get_time_ns ();
+	do {
+		status = bench->run (context);
+		if (status != 0) {
+			goto exit;
+		}
+
+		warmup++;
+		elapsed = bench_get_time_ns () - start;
+	} while (elapsed < options->warmup_ns);
+
+	iterations = (options->min_time_ns * warmup) / ((elapsed != 0) ? elapsed : 1);
+	if (iterations < options->min_iter) {
+		iterations = options->min_iter;
+	}
+
+	for (round = 0; round < BENCH_MAX_CALIBRATION_ROUNDS; round++) {
+		bench_alloc_get_counters (&allocs_start, &alloc_bytes_start);
+
+		status = bench_run_batch (bench, context, iterations, &elapsed);
+		if (status != 0) {
+			goto exit;
+		}
+
+		bench_alloc_get_counters (&allocs_end, &alloc_bytes_end);
+
+		if (elapsed >= options->min_time_ns) {
+			break;
+		}
+
+		/* Aim slightly past the minimum time, but don't grow too quickly from a noisy batch. */
+		if (elapsed < (options->min_time_ns / 100)) {
+			iterations *= 100;
+		}
+		else {
+			iterations = ((options->min_time_ns * iterations) / elapsed) * 11 / 10 + 1;
+		}
+	}
+
+	result->iterations = iterations;
+	result->elapsed_ns = elapsed;
+	result->ns_per_op = (double) elapsed / iterations;
+	result->allocs_per_op = (double) (allocs_end - allocs_start) / iterations;
+	result->alloc_bytes_per_op = (double) (alloc_bytes_end - alloc_bytes_start) / iterations;
+
+	if ((bench->bytes != 0) && (elapsed != 0)) {
+		result->bytes_per_sec = ((double) bench->bytes * iterations * 1000000000.0) / elapsed;
+	}
+
+exit:
+	result->status = status;
+
+	if (bench->teardown) {
+		bench->teardown (context);
+	}
+
+	bench_active_result = NULL;
+
+	return status;
+}
+
+/**
+ * Report an additional measurement for the case currently being run.  This can be called from any
+ * of the case handlers.  Reporting a metric that already exists will replace the previous value, so
+ * cases can report a value every iteration and only the last one will be kept.
+ *
+ * @param name Name of the metric.  Names longer than BENCH_METRIC_NAME_LEN will be truncated.
+ * @param value Value of the metric.
+ * @param unit Unit for the metric value.  This must be a static string.
+ */
+void bench_report_metric (const char *name, double value, const char *unit)
+{
+	struct bench_result *result = bench_active_result;
+	size_t i;
+
+	if (result == NULL) {
+		return;
+	}
+
+	for (i = 0; i < result->metric_count; i++) {
+		if (strncmp (result->metric[i].name, name, BENCH_METRIC_NAME_LEN - 1) == 0) {
+			break;
+		}
+	}
+
+	if (i == result->metric_count) {
+		if (result->metric_count == BENCH_MAX_METRICS) {
+			return;
+		}
+
+		snprintf (result->metric[i].name, BENCH_METRIC_NAME_LEN, "%s", name);
+		result->metric_count++;
+	}
+
+	result->metric[i].value = value;
+	result->metric[i].unit = unit;
+}
+
+/**
+ * Compare two samples for sorting.
+ */
+static int bench_compare_samples (const void *a, const void *b)
+{
+	uint64_t first = *((const uint64_t*) a);
+	uint64_t second = *((const uint64_t*) b);
+
+	return (first > second) - (first < second);
+}
+
+/**
+ * Report the latency distribution of a set of samples for the case currently being run.  Metrics
+ * are added for the p50, p99, p99.9 and maximum latency, in microseconds.
+ *
+ * @param name Prefix for the latency metric names.
+ * @param samples The latency samples, in nanoseconds.  The samples will be sorted.
+ * @param count Number of samples.
+ */
+void bench_report_latency (const char *name, uint64_t *samples, size_t count)
+{
+	char metric[BENCH_METRIC_NAME_LEN];
+
+	if (count == 0) {
+		return;
+	}
+
+	qsort (samples, count, sizeof (uint64_t), bench_compare_samples);
+
+	snprintf (metric, sizeof (metric), "%s_p50", name);
+	bench_report_metric (metric, samples[(count * 50) / 100] / 1000.0, "us");
+
+	snprintf (metric, sizeof (metric), "%s_p99", name);
+	bench_report_metric (metric, samples[(count * 99) / 100] / 1000.0, "us");
+
+	snprintf (metric, sizeof (metric), "%s_p99.9", name);
+	bench_report_metric (metric, samples[(count * 999) / 1000] / 1000.0, "us");
+
+	snprintf (metric, sizeof (metric), "%s_max", name);
+	bench_report_metric (metric, samples[count - 1] / 1000.0, "us");
+}
+
+/**
+ * Print the column headings for benchmark results.
+ *
+ * @param out The output stream.
+ */
+void bench_print_header (FILE *out)
+{
+	fprintf (out, "%-48s %12s %14s %12s %10s %12s\n", "benchmark", "iterations", "ns/op", "MB/s",
+		"allocs/op", "B/op");
+}
+
+/**
+ * Print the results of a benchmark case as a single line.
+ *
+ * @param out The output stream.
+ * @param result The results to print.
+ */
+void bench_print_result (FILE *out, const struct bench_result *result)
+{
+	char full_name[256];
+	size_t i;
+
+	snprintf (full_name, sizeof (full_name), "%s/%s", result->suite, result->name);
+
+	if (result->status != 0) {
+		fprintf (out, "%-48s FAILED (0x%08x)\n", full_name, result->status);
+
+		return;
+	}
+
+	fprintf (out, "%-48s %12" PRIu64 " %14.1f ", full_name, result->iterations, result->ns_per_op);
+
+	if (result->bytes_per_sec != 0) {
+		fprintf (out, "%12.2f ", result->bytes_per_sec / (1024 * 1024));
+	}
+	else {
+		fprintf (out, "%12s ", "-");
+	}
+
+	fprintf (out, "%10.2f %12.1f\n", result->allocs_per_op, result->alloc_bytes_per_op);
+
+	for (i = 0; i < result->metric_count; i++) {
+		fprintf (out, "  %-46s %12.3f %s\n", result->metric[i].name, result->metric[i].value,
+			result->metric[i].unit);
+	}
+}
+
+/**
+ * Start a JSON report of benchmark results.
+ *
+ * @param out The output stream.
+ * @param options The options used for running the benchmarks.
+ * @param properties Properties describing the benchmark environment.
+ * @param count The number of properties.
+ */
+void bench_json_start (FILE *out, const struct bench_options *options,
+	const struct bench_property *properties, size_t count)
+{
+	size_t i;
+
+	fprintf (out, "{\n  \"context\": {\n");
+
+	for (i = 0; i < count; i++) {
+		fprintf (out, "    \"%s\": \"%s\",\n", properties[i].name, properties[i].value);
+	}
+
+	fprintf (out, "    \"warmup_ns\": %" PRIu64 ",\n", options->warmup_ns);
+	fprintf (out, "    \"min_time_ns\": %" PRIu64 "\n", options->min_time_ns);
+	fprintf (out, "  },\n  \"benchmarks\": [");
+}
+
+/**
+ * Add the results of a benchmark case to a JSON report.
+ *
+ * @param out The output stream.
+ * @param result The results to add.
+ * @param first Flag indicating if this is the first result in the report.
+ */
+void bench_json_add_result (FILE *out, const struct bench_result *result, bool first)
+{
+	size_t i;
+
+	fprintf (out, "%s\n    {\n", (first) ? "" : ",");
+	fprintf (out, "      \"name\": \"%s/%s\",\n", result->suite, result->name);
+	fprintf (out, "      \"status\": %d,\n", result->status);
+	fprintf (out, "      \"iterations\": %" PRIu64 ",\n", result->iterations);
+	fprintf (out, "      \"elapsed_ns\": %" PRIu64 ",\n", result->elapsed_ns);
+	fprintf (out, "      \"ns_per_op\": %.3f,\n", result->ns_per_op);
+	fprintf (out, "      \"bytes_per_second\": %.3f,\n", result->bytes_per_sec);
+	fprintf (out, "      \"allocs_per_op\": %.3f,\n", result->allocs_per_op);
+	fprintf (out, "      \"alloc_bytes_per_op\": %.3f", result->alloc_bytes_per_op);
+
+	if (result->metric_count != 0) {
+		fprintf (out, ",\n      \"metrics\": [");
+
+		for (i = 0; i < result->metric_count; i++) {
+			fprintf (out, "%s\n        {\"name\": \"%s\", \"value\": %.3f, \"unit\": \"%s\"}",
+				(i == 0) ? "" : ",", result->metric[i].name, result->metric[i].value,
+				result->metric[i].unit);
+		}
+
+		fprintf (out, "\n      ]");
+	}
+
+	fprintf (out, "\n    }");
+}
+
+/**
+ * Finish a JSON report of benchmark results.
+ *
+ * @param out The output stream.
+ */
+void bench_json_end (FILE *out)
+{
+	fprintf (out, "\n  ]\n}\n");
+}
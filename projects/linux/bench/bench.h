@@ -0,0 +1,143 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "common/array_size.h"
+
+
+/**
+ * A single benchmarked operation.
+ */
+struct bench_case {
+	const char *name;	/**< Name of the benchmark case. */
+
+	/**
+	 * Allocate and initialize any context needed to execute the benchmark operation.  Setup is not
+	 * included in the measurements.
+	 *
+	 * @param context Output for the context to pass to the other case handlers.
+	 *
+	 * @return 0 if setup was successful or an error code.
+	 */
+	int (*setup) (void **context);
+
+	/**
+	 * Execute the benchmark operation one time.
+	 *
+	 * @param context The context created during setup.
+	 *
+	 * @return 0 if the operation was successful or an error code.
+	 */
+	int (*run) (void *context);
+
+	/**
+	 * Release the context created during setup.  This can be null if no teardown is necessary.
+	 *
+	 * @param context The context to release.
+	 */
+	void (*teardown) (void *context);
+
+	size_t bytes;		/**< Number of bytes processed by a single operation.  0 if not applicable. */
+};
+
+/**
+ * A group of related benchmark cases.
+ */
+struct bench_suite {
+	const char *name;					/**< Name of the benchmark suite. */
+	const struct bench_case *cases;		/**< List of cases in the suite. */
+	size_t count;						/**< Number of cases in the suite. */
+};
+
+/**
+ * Define a benchmark suite from a static list of cases.
+ *
+ * @param name The name of the suite.
+ * @param case_list The array of cases in the suite.
+ */
+#define	BENCH_SUITE(name, case_list)	{name, case_list, ARRAY_SIZE (case_list)}
+
+/**
+ * Options for executing benchmark cases.
+ */
+struct bench_options {
+	uint64_t warmup_ns;		/**< Time to run each case before measuring. */
+	uint64_t min_time_ns;	/**< Minimum time to measure each case. */
+	uint64_t min_iter;		/**< Minimum number of measured iterations. */
+	const char *filter;		/**< Only run cases whose full name contains this string. */
+};
+
+/**
+ * A named value describing the benchmark environment.
+ */
+struct bench_property {
+	const char *name;	/**< Name of the property. */
+	const char *value;	/**< Value of the property. */
+};
+
+/**
+ * Maximum number of additional metrics that can be reported by a single benchmark case.
+ */
+#define	BENCH_MAX_METRICS			16
+
+/**
+ * Maximum length of the name of an additional metric.
+ */
+#define	BENCH_METRIC_NAME_LEN		32
+
+/**
+ * An additional measurement reported by a benchmark case, such as a latency percentile.
+ */
+struct bench_metric {
+	char name[BENCH_METRIC_NAME_LEN];	/**< Name of the metric. */
+	const char *unit;					/**< Unit for the metric value. */
+	double value;						/**< Value of the metric. */
+};
+
+/**
+ * Measurements for a single benchmark case.
+ */
+struct bench_result {
+	const char *suite;			/**< Name of the suite that contains the case. */
+	const char *name;			/**< Name of the benchmark case. */
+	int status;					/**< 0 if the case completed or the error reported by the case. */
+	uint64_t iterations;		/**< Number of measured iterations. */
+	uint64_t elapsed_ns;		/**< Total time for the measured iterations. */
+	double ns_per_op;			/**< Average time for a single operation. */
+	double bytes_per_sec;		/**< Throughput of the operation.  0 if not applicable. */
+	double allocs_per_op;		/**< Average number of heap allocations per operation. */
+	double alloc_bytes_per_op;	/**< Average number of bytes allocated per operation. */
+	struct bench_metric metric[BENCH_MAX_METRICS];	/**< Additional metrics from the case. */
+	size_t metric_count;							/**< Number of additional metrics. */
+};
+
+
+uint64_t bench_get_time_ns (void);
+
+void bench_alloc_get_counters (uint64_t *count, uint64_t *bytes);
+
+void bench_options_init (struct bench_options *options);
+bool bench_case_is_selected (const struct bench_options *options, const struct bench_suite *suite,
+	const struct bench_case *bench);
+int bench_run_case (const struct bench_options *options, const struct bench_suite *suite,
+	const struct bench_case *bench, struct bench_result *result);
+
+void bench_report_metric (const char *name, double value, const char *unit);
+void bench_report_latency (const char *name, uint64_t *samples, size_t count);
+
+void bench_print_header (FILE *out);
+void bench_print_result (FILE *out, const struct bench_result *result);
+
+void bench_json_start (FILE *out, const struct bench_options *options,
+	const struct bench_property *properties, size_t count);
+void bench_json_add_result (FILE *out, const struct bench_result *result, bool first);
+void bench_json_end (FILE *out);
+
+
+#endif	/* BENCH_H_ */
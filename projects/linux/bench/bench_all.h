@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef BENCH_ALL_H_
+#define BENCH_ALL_H_
+
+#include "bench.h"
+
+
+/*
+ * Benchmark suites for each measured subsystem.
+ *
+ * Be sure to keep the suites in alphabetical order for easier management.
+ */
+extern const struct bench_suite checksum_bench_suite;
+extern const struct bench_suite cmd_channel_linux_bench_suite;
+extern const struct bench_suite flash_updater_bench_suite;
+extern const struct bench_suite flash_util_bench_suite;
+extern const struct bench_suite hash_bench_suite;
+extern const struct bench_suite heap_bench_suite;
+extern const struct bench_suite host_fw_util_bench_suite;
+extern const struct bench_suite logging_flash_compressed_bench_suite;
+extern const struct bench_suite logging_ring_bench_suite;
+extern const struct bench_suite mctp_interface_bench_suite;
+extern const struct bench_suite mctp_interface_interleave_bench_suite;
+extern const struct bench_suite mctp_interface_requester_bench_suite;
+extern const struct bench_suite pcr_store_bench_suite;
+extern const struct bench_suite periodic_task_scheduler_bench_suite;
+extern const struct bench_suite pfm_flash_bench_suite;
+extern const struct bench_suite signature_verification_bench_suite;
+extern const struct bench_suite spdm_commands_bench_suite;
+extern const struct bench_suite spdm_secure_session_bench_suite;
+
+
+#endif	/* BENCH_ALL_H_ */
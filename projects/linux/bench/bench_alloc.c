@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "bench.h"
+
+
+/*
+ * Heap allocations are counted by overriding the C library allocation functions for the benchmark
+ * executable.  The counting wrappers forward to the glibc implementations, so this also captures
+ * allocations made by external crypto libraries.
+ */
+
+extern void* __libc_malloc (size_t size);
+extern void* __libc_calloc (size_t nmemb, size_t size);
+extern void* __libc_realloc (void *ptr, size_t size);
+extern void __libc_free (void *ptr);
+
+
+/**
+ * Total number of heap allocations made by the process.
+ */
+static uint64_t bench_alloc_count;
+
+/**
+ * Total number of bytes requested from the heap.
+ */
+static uint64_t bench_alloc_bytes;
+
+
+/**
+ * Record a heap allocation.
+ *
+ * @param size The number of bytes requested.
+ */
+static void bench_alloc_record (size_t size)
+{
+	__atomic_fetch_add (&bench_alloc_count, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add (&bench_alloc_bytes, size, __ATOMIC_RELAXED);
+}
+
+void* malloc (size_t size)
+{
+	bench_alloc_record (size);
+
+	return __libc_malloc (size);
+}
+
+void* calloc (size_t nmemb, size_t size)
+{
+	bench_alloc_record (nmemb * size);
+
+	return __libc_calloc (nmemb, size);
+}
+
+void* realloc (void *ptr, size_t size)
+{
+	bench_alloc_record (size);
+
+	return __libc_realloc (ptr, size);
+}
+
+void free (void *ptr)
+{
+	__libc_free (ptr);
+}
+
+/**
+ * Get the current heap allocation counters.
+ *
+ * @param count Output for the total number of allocations.
+ * @param bytes Output for the total number of bytes allocated.
+ */
+void bench_alloc_get_counters (uint64_t *count, uint64_t *bytes)
+{
+	*count = __atomic_load_n (&bench_alloc_count, __ATOMIC_RELAXED);
+	*bytes = __atomic_load_n (&bench_alloc_bytes, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,178 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <openssl/evp.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "common/array_size.h"
+#include "testing/engines/aes_testing_engine.h"
+#include "testing/engines/ecc_testing_engine.h"
+#include "testing/engines/hash_testing_engine.h"
+#include "testing/engines/rsa_testing_engine.h"
+
+
+#define	BENCH_STRINGIFY_VALUE(x)	#x
+#define	BENCH_STRINGIFY(x)			BENCH_STRINGIFY_VALUE(x)
+
+#ifndef BENCH_REVISION
+#define	BENCH_REVISION				"unknown"
+#endif
+
+
+/**
+ * All benchmark suites that can be run.
+ */
+static const struct bench_suite *const bench_suites[] = {
+	&checksum_bench_suite,
+	&cmd_channel_linux_bench_suite,
+	&flash_updater_bench_suite,
+	&flash_util_bench_suite,
+	&hash_bench_suite,
+	&heap_bench_suite,
+	&host_fw_util_bench_suite,
+	&logging_flash_compressed_bench_suite,
+	&logging_ring_bench_suite,
+	&mctp_interface_bench_suite,
+	&mctp_interface_interleave_bench_suite,
+	&mctp_interface_requester_bench_suite,
+	&pcr_store_bench_suite,
+	&periodic_task_scheduler_bench_suite,
+	&pfm_flash_bench_suite,
+	&signature_verification_bench_suite,
+	&spdm_commands_bench_suite,
+	&spdm_secure_session_bench_suite,
+};
+
+/**
+ * Details about the environment that are needed to compare results between runs.
+ */
+static const struct bench_property bench_properties[] = {
+	{"revision", BENCH_REVISION},
+	{"hash_engine", BENCH_STRINGIFY (HASH_TESTING_ENGINE_NAME)},
+	{"ecc_engine", BENCH_STRINGIFY (ECC_TESTING_ENGINE_NAME)},
+	{"rsa_engine", BENCH_STRINGIFY (RSA_TESTING_ENGINE_NAME)},
+	{"aes_engine", BENCH_STRINGIFY (AES_TESTING_ENGINE_NAME)},
+};
+
+
+static void bench_usage (const char *name)
+{
+	printf ("Usage: %s [options]\n", name);
+	printf ("  --filter <text>   Only run benchmarks whose 'suite/case' name contains the text.\n");
+	printf ("  --min-time <ms>   Minimum measurement time for each benchmark.\n");
+	printf ("  --warmup <ms>     Time to run each benchmark before measuring.\n");
+	printf ("  --json <file>     Write results as JSON to a file, or '-' for stdout.\n");
+	printf ("  --list            List the available benchmarks.\n");
+}
+
+int main (int argc, char *argv[])
+{
+	struct bench_options options;
+	struct bench_result result;
+	const char *json_path = NULL;
+	FILE *json = NULL;
+	FILE *out = stdout;
+	bool list = false;
+	bool first = true;
+	int failures = 0;
+	size_t i;
+	size_t j;
+	int arg;
+
+	bench_options_init (&options);
+
+	for (arg = 1; arg < argc; arg++) {
+		if ((strcmp (argv[arg], "--filter") == 0) && ((arg + 1) < argc)) {
+			options.filter = argv[++arg];
+		}
+		else if ((strcmp (argv[arg], "--min-time") == 0) && ((arg + 1) < argc)) {
+			options.min_time_ns = strtoull (argv[++arg], NULL, 0) * 1000000;
+		}
+		else if ((strcmp (argv[arg], "--warmup") == 0) && ((arg + 1) < argc)) {
+			options.warmup_ns = strtoull (argv[++arg], NULL, 0) * 1000000;
+		}
+		else if ((strcmp (argv[arg], "--json") == 0) && ((arg + 1) < argc)) {
+			json_path = argv[++arg];
+		}
+		else if (strcmp (argv[arg], "--list") == 0) {
+			list = true;
+		}
+		else {
+			bench_usage (argv[0]);
+
+			return (strcmp (argv[arg], "--help") == 0) ? 0 : 1;
+		}
+	}
+
+	if (list) {
+		for (i = 0; i < ARRAY_SIZE (bench_suites); i++) {
+			for (j = 0; j < bench_suites[i]->count; j++) {
+				if (bench_case_is_selected (&options, bench_suites[i], &bench_suites[i]->cases[j])) {
+					printf ("%s/%s\n", bench_suites[i]->name, bench_suites[i]->cases[j].name);
+				}
+			}
+		}
+
+		return 0;
+	}
+
+	if (json_path != NULL) {
+		if (strcmp (json_path, "-") == 0) {
+			/* Keep the human readable output separate from the JSON report. */
+			json = stdout;
+			out = stderr;
+		}
+		else {
+			json = fopen (json_path, "w");
+			if (json == NULL) {
+				perror (json_path);
+
+				return 1;
+			}
+		}
+
+		bench_json_start (json, &options, bench_properties, ARRAY_SIZE (bench_properties));
+	}
+
+	OpenSSL_add_all_algorithms ();
+
+	bench_print_header (out);
+
+	for (i = 0; i < ARRAY_SIZE (bench_suites); i++) {
+		for (j = 0; j < bench_suites[i]->count; j++) {
+			if (!bench_case_is_selected (&options, bench_suites[i], &bench_suites[i]->cases[j])) {
+				continue;
+			}
+
+			if (bench_run_case (&options, bench_suites[i], &bench_suites[i]->cases[j],
+				&result) != 0) {
+				failures++;
+			}
+
+			bench_print_result (out, &result);
+			fflush (out);
+
+			if (json != NULL) {
+				bench_json_add_result (json, &result, first);
+				first = false;
+			}
+		}
+	}
+
+	if (json != NULL) {
+		bench_json_end (json);
+
+		if (json != stdout) {
+			fclose (json);
+		}
+	}
+
+	EVP_cleanup ();
+
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "cmd_interface/cmd_channel_linux.h"
+#include "cmd_interface/cmd_interface_multi_handler.h"
+#include "cmd_interface/device_manager.h"
+#include "crypto/checksum.h"
+#include "mctp/mctp_base_protocol.h"
+#include "mctp/mctp_interface.h"
+
+
+/**
+ * SMBus address of the device processing requests.
+ */
+#define	CMD_CHANNEL_LINUX_BENCH_SELF_ADDR		0x5d
+
+/**
+ * SMBus address used by every client sending requests.
+ */
+#define	CMD_CHANNEL_LINUX_BENCH_REQ_ADDR		0x55
+
+/**
+ * Length of the MCTP message sent in each request.
+ */
+#define	CMD_CHANNEL_LINUX_BENCH_MSG_LENGTH		16
+
+/**
+ * Maximum number of clients connected to the channel.
+ */
+#define	CMD_CHANNEL_LINUX_BENCH_MAX_CLIENTS		16
+
+
+/**
+ * Context for benchmarks of an MCTP responder using a Linux command channel.
+ */
+struct cmd_channel_linux_bench {
+	struct cmd_interface_multi_handler req_handler;				/**< Handler for request messages. */
+	struct device_manager device_mgr;							/**< Device manager for the interface. */
+	struct mctp_interface_state mctp_state;						/**< Variable context for the interface. */
+	struct mctp_interface mctp;									/**< MCTP layer for the responder. */
+	struct cmd_channel_linux_state channel_state;				/**< Variable context for the channel. */
+	struct cmd_channel_linux channel;							/**< Channel receiving requests. */
+	int client[CMD_CHANNEL_LINUX_BENCH_MAX_CLIENTS];			/**< Client end of each connection. */
+	size_t clients;												/**< Number of connected clients. */
+	size_t next;												/**< Client to send the next request. */
+	uint8_t request[CMD_MAX_PACKET_SIZE];						/**< Request packet sent by clients. */
+	size_t request_len;											/**< Length of the request packet. */
+	uint8_t response[CMD_MAX_PACKET_SIZE];						/**< Buffer for received responses. */
+};
+
+
+/**
+ * Accept all message types.
+ */
+static int cmd_channel_linux_bench_is_message_type_supported (
+	const struct cmd_interface_multi_handler *intf, uint32_t message_type)
+{
+	return 0;
+}
+
+/**
+ * Respond to every request with the same message.  This isolates the cost of the channel and MCTP
+ * layers from any command processing.
+ */
+static int cmd_channel_linux_bench_process_request (const struct cmd_interface *intf,
+	struct cmd_interface_msg *request)
+{
+	return 0;
+}
+
+/**
+ * Build the packet for a single packet vendor defined request.  The destination address is not
+ * part of the packet sent to the channel.
+ *
+ * @param bench The benchmark context to update with the request packet.
+ */
+static void cmd_channel_linux_bench_build_request (struct cmd_channel_linux_bench *bench)
+{
+	struct mctp_base_protocol_transport_header *header =
+		(struct mctp_base_protocol_transport_header*) bench->request;
+
+	memset (bench->request, 0x55, sizeof (bench->request));
+
+	header->cmd_code = SMBUS_CMD_CODE_MCTP;
+	header->source_addr = (CMD_CHANNEL_LINUX_BENCH_REQ_ADDR << 1) | 1;
+	header->rsvd = 0;
+	header->header_version = 1;
+	header->destination_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+	header->source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+	header->som = 1;
+	header->eom = 1;
+	header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
+	header->msg_tag = 0;
+	header->packet_seq = 0;
+
+	bench->request[sizeof (*header)] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+
+	bench->request_len = sizeof (*header) + CMD_CHANNEL_LINUX_BENCH_MSG_LENGTH +
+		MCTP_BASE_PROTOCOL_PEC_SIZE;
+	header->byte_count = bench->request_len - MCTP_BASE_PROTOCOL_SMBUS_OVERHEAD;
+	bench->request[bench->request_len - 1] =
+		checksum_crc8 (CMD_CHANNEL_LINUX_BENCH_SELF_ADDR << 1, bench->request,
+		bench->request_len - 1);
+}
+
+/**
+ * Create the context for a command channel benchmark.  Requests are processed by an MCTP responder
+ * reading packets from the channel, the same way a device task would handle them.
+ *
+ * @param context Output for the benchmark context.
+ * @param clients Number of clients to connect to the channel.  All clients use the same SMBus
+ * address.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int cmd_channel_linux_bench_setup (void **context, size_t clients)
+{
+	struct cmd_channel_linux_bench *bench;
+	struct device_manager_full_capabilities capabilities;
+	int fd[2];
+	int status;
+
+	bench = calloc (1, sizeof (struct cmd_channel_linux_bench));
+	if (bench == NULL) {
+		return CMD_CHANNEL_NO_MEMORY;
+	}
+
+	bench->req_handler.base.process_request = cmd_channel_linux_bench_process_request;
+	bench->req_handler.is_message_type_supported =
+		cmd_channel_linux_bench_is_message_type_supported;
+
+	status = device_manager_init (&bench->device_mgr, 2, 0, 0, DEVICE_MANAGER_AC_ROT_MODE,
+		DEVICE_MANAGER_SLAVE_BUS_ROLE, 1000, 1000, 1000, 0, 0, 0, 0);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = device_manager_update_not_attestable_device_entry (&bench->device_mgr, 0,
+		MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID, CMD_CHANNEL_LINUX_BENCH_SELF_ADDR,
+		DEVICE_MANAGER_NOT_PCD_COMPONENT);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	status = device_manager_update_not_attestable_device_entry (&bench->device_mgr, 1,
+		MCTP_BASE_PROTOCOL_BMC_EID, CMD_CHANNEL_LINUX_BENCH_REQ_ADDR,
+		DEVICE_MANAGER_NOT_PCD_COMPONENT);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	device_manager_get_device_capabilities (&bench->device_mgr, 0, &capabilities);
+	capabilities.request.hierarchy_role = DEVICE_MANAGER_PA_ROT_MODE;
+
+	status = device_manager_update_device_capabilities (&bench->device_mgr, 0, &capabilities);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	status = mctp_interface_init (&bench->mctp, &bench->mctp_state, &bench->req_handler,
+		&bench->device_mgr, NULL, NULL, NULL, NULL);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	status = cmd_channel_linux_init (&bench->channel, &bench->channel_state, 0,
+		CMD_CHANNEL_LINUX_BENCH_SELF_ADDR, NULL);
+	if (status != 0) {
+		goto release_mctp;
+	}
+
+	for (bench->clients = 0; bench->clients < clients; bench->clients++) {
+		if (socketpair (AF_UNIX, SOCK_SEQPACKET, 0, fd) != 0) {
+			status = CMD_CHANNEL_NO_MEMORY;
+			goto release_channel;
+		}
+
+		status = cmd_channel_linux_add_client (&bench->channel, fd[0]);
+		if (status != 0) {
+			close (fd[0]);
+			close (fd[1]);
+			goto release_channel;
+		}
+
+		bench->client[bench->clients] = fd[1];
+	}
+
+	cmd_channel_linux_bench_build_request (bench);
+
+	*context = bench;
+
+	return 0;
+
+release_channel:
+	while (bench->clients > 0) {
+		close (bench->client[--bench->clients]);
+	}
+
+	cmd_channel_linux_release (&bench->channel);
+release_mctp:
+	mctp_interface_release (&bench->mctp);
+release_device_mgr:
+	device_manager_release (&bench->device_mgr);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int cmd_channel_linux_bench_setup_one_client (void **context)
+{
+	return cmd_channel_linux_bench_setup (context, 1);
+}
+
+static int cmd_channel_linux_bench_setup_multiple_clients (void **context)
+{
+	return cmd_channel_linux_bench_setup (context, CMD_CHANNEL_LINUX_BENCH_MAX_CLIENTS);
+}
+
+static void cmd_channel_linux_bench_teardown (void *context)
+{
+	struct cmd_channel_linux_bench *bench = context;
+	size_t i;
+
+	for (i = 0; i < bench->clients; i++) {
+		close (bench->client[i]);
+	}
+
+	cmd_channel_linux_release (&bench->channel);
+	mctp_interface_release (&bench->mctp);
+	device_manager_release (&bench->device_mgr);
+	free (bench);
+}
+
+/**
+ * Send one request from the next client, process it through the channel and MCTP layers, and
+ * receive the response.  Clients take turns sending requests, and the response must be delivered
+ * to the client that sent the request.
+ */
+static int cmd_channel_linux_bench_round_trip (void *context)
+{
+	struct cmd_channel_linux_bench *bench = context;
+	int fd = bench->client[bench->next];
+	int status;
+
+	bench->next = (bench->next + 1) % bench->clients;
+
+	if (send (fd, bench->request, bench->request_len, 0) != (ssize_t) bench->request_len) {
+		return CMD_CHANNEL_TX_FAILED;
+	}
+
+	status = cmd_channel_receive_and_process (&bench->channel.base, &bench->mctp, 1000);
+	if (status != 0) {
+		return status;
+	}
+
+	if (recv (fd, bench->response, sizeof (bench->response), MSG_DONTWAIT) <= 0) {
+		return CMD_CHANNEL_RX_FAILED;
+	}
+
+	return 0;
+}
+
+
+static const struct bench_case cmd_channel_linux_bench_cases[] = {
+	{
+		"mctp_round_trip", cmd_channel_linux_bench_setup_one_client,
+		cmd_channel_linux_bench_round_trip, cmd_channel_linux_bench_teardown,
+		CMD_CHANNEL_LINUX_BENCH_MSG_LENGTH
+	},
+	{
+		"mctp_round_trip_16_clients", cmd_channel_linux_bench_setup_multiple_clients,
+		cmd_channel_linux_bench_round_trip, cmd_channel_linux_bench_teardown,
+		CMD_CHANNEL_LINUX_BENCH_MSG_LENGTH
+	},
+};
+
+const struct bench_suite cmd_channel_linux_bench_suite =
+	BENCH_SUITE ("cmd_channel_linux", cmd_channel_linux_bench_cases);
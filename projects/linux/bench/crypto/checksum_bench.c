@@ -0,0 +1,170 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "crypto/checksum.h"
+
+
+/**
+ * Length of the data for SMBus CRC8 calculations.  This is the largest packet that can be
+ * checksummed with a single call.
+ */
+#define	CHECKSUM_BENCH_CRC8_LENGTH		255
+
+/**
+ * Length of the data for CRC-32C calculations.  This is the size of a typical flash sector.
+ */
+#define	CHECKSUM_BENCH_CRC32C_LENGTH	4096
+
+/**
+ * SMBus address used for CRC8 calculations.
+ */
+#define	CHECKSUM_BENCH_SMBUS_ADDR		0x5d
+
+
+/**
+ * Context for checksum benchmarks.
+ */
+struct checksum_bench {
+	uint8_t data[CHECKSUM_BENCH_CRC32C_LENGTH];	/**< Data to checksum. */
+	uint32_t crc;								/**< Output for the calculated CRC. */
+};
+
+
+/**
+ * Bit-by-bit SMBus CRC8 calculation.  This matches CHECKSUM_CRC_BITWISE and provides a baseline
+ * for the configured implementation.
+ *
+ * @param crc The initial CRC value.
+ * @param data The data to process.
+ * @param len Length of the data.
+ *
+ * @return The updated CRC8.
+ */
+static uint8_t checksum_bench_bitwise_crc8 (uint8_t crc, const uint8_t *data, size_t len)
+{
+	size_t i;
+	int j;
+
+	for (i = 0; i < len; i++) {
+		crc ^= data[i];
+
+		for (j = 0; j < 8; j++) {
+			crc = (crc & 0x80) ? (uint8_t) ((crc << 1) ^ 0x07) : (uint8_t) (crc << 1);
+		}
+	}
+
+	return crc;
+}
+
+/**
+ * Bit-by-bit CRC-32C calculation.  This matches CHECKSUM_CRC_BITWISE and provides a baseline for
+ * the configured implementation.
+ *
+ * @param data The data to process.
+ * @param len Length of the data.
+ *
+ * @return The CRC-32C of the data.
+ */
+static uint32_t checksum_bench_bitwise_crc32c (const uint8_t *data, size_t len)
+{
+	uint32_t crc = 0xffffffff;
+	size_t i;
+	int j;
+
+	for (i = 0; i < len; i++) {
+		crc ^= data[i];
+
+		for (j = 0; j < 8; j++) {
+			crc = (crc & 1) ? ((crc >> 1) ^ 0x82f63b78) : (crc >> 1);
+		}
+	}
+
+	return ~crc;
+}
+
+/**
+ * Context shared by all checksum benchmarks.
+ */
+static struct checksum_bench checksum_bench_context;
+
+
+static int checksum_bench_setup (void **context)
+{
+	uint32_t seed = 0x1234;
+	size_t i;
+
+	for (i = 0; i < sizeof (checksum_bench_context.data); i++) {
+		seed = (seed * 1103515245) + 12345;
+		checksum_bench_context.data[i] = seed >> 16;
+	}
+
+	*context = &checksum_bench_context;
+
+	return 0;
+}
+
+static int checksum_bench_smbus_crc8 (void *context)
+{
+	struct checksum_bench *bench = context;
+
+	bench->crc = checksum_crc8 (CHECKSUM_BENCH_SMBUS_ADDR << 1, bench->data,
+		CHECKSUM_BENCH_CRC8_LENGTH);
+
+	return 0;
+}
+
+static int checksum_bench_smbus_crc8_bitwise (void *context)
+{
+	struct checksum_bench *bench = context;
+	uint8_t addr = CHECKSUM_BENCH_SMBUS_ADDR << 1;
+	uint8_t crc;
+
+	crc = checksum_bench_bitwise_crc8 (0, &addr, 1);
+	bench->crc = checksum_bench_bitwise_crc8 (crc, bench->data, CHECKSUM_BENCH_CRC8_LENGTH);
+
+	return 0;
+}
+
+static int checksum_bench_crc32c (void *context)
+{
+	struct checksum_bench *bench = context;
+
+	bench->crc = checksum_crc32c (bench->data, CHECKSUM_BENCH_CRC32C_LENGTH);
+
+	return 0;
+}
+
+static int checksum_bench_crc32c_bitwise (void *context)
+{
+	struct checksum_bench *bench = context;
+
+	bench->crc = checksum_bench_bitwise_crc32c (bench->data, CHECKSUM_BENCH_CRC32C_LENGTH);
+
+	return 0;
+}
+
+
+static const struct bench_case checksum_bench_cases[] = {
+	{
+		"smbus_crc8_255", checksum_bench_setup, checksum_bench_smbus_crc8, NULL,
+		CHECKSUM_BENCH_CRC8_LENGTH
+	},
+	{
+		"smbus_crc8_255_bitwise", checksum_bench_setup, checksum_bench_smbus_crc8_bitwise,
+		NULL, CHECKSUM_BENCH_CRC8_LENGTH
+	},
+	{
+		"crc32c_4k", checksum_bench_setup, checksum_bench_crc32c, NULL,
+		CHECKSUM_BENCH_CRC32C_LENGTH
+	},
+	{
+		"crc32c_4k_bitwise", checksum_bench_setup, checksum_bench_crc32c_bitwise,
+		NULL, CHECKSUM_BENCH_CRC32C_LENGTH
+	},
+};
+
+const struct bench_suite checksum_bench_suite =
+	BENCH_SUITE ("checksum", checksum_bench_cases);
@@ -0,0 +1,190 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "crypto/hash.h"
+#include "testing/engines/hash_testing_engine.h"
+
+
+/**
+ * Size of the chunks used for incremental hashing.
+ */
+#define	HASH_BENCH_CHUNK_SIZE		64
+
+
+/**
+ * Context for hash benchmarks.
+ */
+struct hash_bench {
+	HASH_TESTING_ENGINE engine;			/**< The hash engine being measured. */
+	uint8_t *data;						/**< Data to hash. */
+	size_t length;						/**< Length of the data. */
+	uint8_t digest[HASH_MAX_HASH_LEN];	/**< Output for the calculated digest. */
+};
+
+
+/**
+ * Create the context for a hash benchmark.
+ *
+ * @param context Output for the benchmark context.
+ * @param length Length of the data that will be hashed.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int hash_bench_setup (void **context, size_t length)
+{
+	struct hash_bench *bench;
+	size_t i;
+	int status;
+
+	bench = calloc (1, sizeof (struct hash_bench));
+	if (bench == NULL) {
+		return HASH_ENGINE_NO_MEMORY;
+	}
+
+	bench->data = malloc (length);
+	if (bench->data == NULL) {
+		free (bench);
+
+		return HASH_ENGINE_NO_MEMORY;
+	}
+
+	for (i = 0; i < length; i++) {
+		bench->data[i] = i;
+	}
+
+	bench->length = length;
+
+	status = HASH_TESTING_ENGINE_INIT (&bench->engine);
+	if (status != 0) {
+		free (bench->data);
+		free (bench);
+
+		return status;
+	}
+
+	*context = bench;
+
+	return 0;
+}
+
+static int hash_bench_setup_64 (void **context)
+{
+	return hash_bench_setup (context, 64);
+}
+
+static int hash_bench_setup_1k (void **context)
+{
+	return hash_bench_setup (context, 1024);
+}
+
+static int hash_bench_setup_16k (void **context)
+{
+	return hash_bench_setup (context, 16 * 1024);
+}
+
+static void hash_bench_teardown (void *context)
+{
+	struct hash_bench *bench = context;
+
+	HASH_TESTING_ENGINE_RELEASE (&bench->engine);
+	free (bench->data);
+	free (bench);
+}
+
+#ifdef HASH_ENABLE_SHA1
+static int hash_bench_sha1 (void *context)
+{
+	struct hash_bench *bench = context;
+
+	return bench->engine.base.calculate_sha1 (&bench->engine.base, bench->data, bench->length,
+		bench->digest, sizeof (bench->digest));
+}
+#endif
+
+static int hash_bench_sha256 (void *context)
+{
+	struct hash_bench *bench = context;
+
+	return bench->engine.base.calculate_sha256 (&bench->engine.base, bench->data, bench->length,
+		bench->digest, sizeof (bench->digest));
+}
+
+static int hash_bench_sha256_incremental (void *context)
+{
+	struct hash_bench *bench = context;
+	size_t offset;
+	int status;
+
+	status = bench->engine.base.start_sha256 (&bench->engine.base);
+	if (status != 0) {
+		return status;
+	}
+
+	for (offset = 0; offset < bench->length; offset += HASH_BENCH_CHUNK_SIZE) {
+		status = bench->engine.base.update (&bench->engine.base, &bench->data[offset],
+			HASH_BENCH_CHUNK_SIZE);
+		if (status != 0) {
+			bench->engine.base.cancel (&bench->engine.base);
+
+			return status;
+		}
+	}
+
+	return bench->engine.base.finish (&bench->engine.base, bench->digest, sizeof (bench->digest));
+}
+
+#ifdef HASH_ENABLE_SHA384
+static int hash_bench_sha384 (void *context)
+{
+	struct hash_bench *bench = context;
+
+	return bench->engine.base.calculate_sha384 (&bench->engine.base, bench->data, bench->length,
+		bench->digest, sizeof (bench->digest));
+}
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+static int hash_bench_sha512 (void *context)
+{
+	struct hash_bench *bench = context;
+
+	return bench->engine.base.calculate_sha512 (&bench->engine.base, bench->data, bench->length,
+		bench->digest, sizeof (bench->digest));
+}
+#endif
+
+static int hash_bench_hmac_sha256 (void *context)
+{
+	struct hash_bench *bench = context;
+	const uint8_t key[SHA256_HASH_LENGTH] = {0};
+
+	return hash_generate_hmac (&bench->engine.base, key, sizeof (key), bench->data, bench->length,
+		HMAC_SHA256, bench->digest, SHA256_HASH_LENGTH);
+}
+
+
+static const struct bench_case hash_bench_cases[] = {
+#ifdef HASH_ENABLE_SHA1
+	{"sha1_1k", hash_bench_setup_1k, hash_bench_sha1, hash_bench_teardown, 1024},
+#endif
+	{"sha256_64", hash_bench_setup_64, hash_bench_sha256, hash_bench_teardown, 64},
+	{"sha256_1k", hash_bench_setup_1k, hash_bench_sha256, hash_bench_teardown, 1024},
+	{"sha256_16k", hash_bench_setup_16k, hash_bench_sha256, hash_bench_teardown, 16 * 1024},
+	{"sha256_incremental_16k", hash_bench_setup_16k, hash_bench_sha256_incremental,
+		hash_bench_teardown, 16 * 1024},
+#ifdef HASH_ENABLE_SHA384
+	{"sha384_1k", hash_bench_setup_1k, hash_bench_sha384, hash_bench_teardown, 1024},
+	{"sha384_16k", hash_bench_setup_16k, hash_bench_sha384, hash_bench_teardown, 16 * 1024},
+#endif
+#ifdef HASH_ENABLE_SHA512
+	{"sha512_16k", hash_bench_setup_16k, hash_bench_sha512, hash_bench_teardown, 16 * 1024},
+#endif
+	{"hmac_sha256_64", hash_bench_setup_64, hash_bench_hmac_sha256, hash_bench_teardown, 64},
+};
+
+const struct bench_suite hash_bench_suite = BENCH_SUITE ("hash", hash_bench_cases);
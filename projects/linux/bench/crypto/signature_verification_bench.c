@@ -0,0 +1,161 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "crypto/signature_verification_ecc.h"
+#include "crypto/signature_verification_rsa.h"
+#include "testing/crypto/ecc_testing.h"
+#include "testing/crypto/rsa_testing.h"
+#include "testing/crypto/signature_testing.h"
+#include "testing/engines/ecc_testing_engine.h"
+#include "testing/engines/rsa_testing_engine.h"
+
+
+/**
+ * Context for ECDSA signature verification benchmarks.
+ */
+struct signature_verification_bench_ecc {
+	ECC_TESTING_ENGINE ecc;								/**< The ECC engine being measured. */
+	struct signature_verification_ecc_state state;		/**< Variable context for verification. */
+	struct signature_verification_ecc verification;		/**< The verification context. */
+};
+
+/**
+ * Context for RSA signature verification benchmarks.
+ */
+struct signature_verification_bench_rsa {
+	RSA_TESTING_ENGINE rsa;								/**< The RSA engine being measured. */
+	struct signature_verification_rsa_state state;		/**< Variable context for verification. */
+	struct signature_verification_rsa verification;		/**< The verification context. */
+};
+
+
+static int signature_verification_bench_ecc_setup (void **context)
+{
+	struct signature_verification_bench_ecc *bench;
+	int status;
+
+	bench = calloc (1, sizeof (struct signature_verification_bench_ecc));
+	if (bench == NULL) {
+		return SIG_VERIFICATION_NO_MEMORY;
+	}
+
+	status = ECC_TESTING_ENGINE_INIT (&bench->ecc);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = signature_verification_ecc_init (&bench->verification, &bench->state, &bench->ecc.base,
+		ECC_PUBKEY_DER, ECC_PUBKEY_DER_LEN);
+	if (status != 0) {
+		goto release_ecc;
+	}
+
+	*context = bench;
+
+	return 0;
+
+release_ecc:
+	ECC_TESTING_ENGINE_RELEASE (&bench->ecc);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int signature_verification_bench_ecc_verify (void *context)
+{
+	struct signature_verification_bench_ecc *bench = context;
+
+	return bench->verification.base.verify_signature (&bench->verification.base, SIG_HASH_TEST,
+		SIG_HASH_LEN, ECC_SIGNATURE_TEST, ECC_SIG_TEST_LEN);
+}
+
+static int signature_verification_bench_ecc_set_key (void *context)
+{
+	struct signature_verification_bench_ecc *bench = context;
+
+	return bench->verification.base.set_verification_key (&bench->verification.base,
+		ECC_PUBKEY_DER, ECC_PUBKEY_DER_LEN);
+}
+
+static void signature_verification_bench_ecc_teardown (void *context)
+{
+	struct signature_verification_bench_ecc *bench = context;
+
+	signature_verification_ecc_release (&bench->verification);
+	ECC_TESTING_ENGINE_RELEASE (&bench->ecc);
+	free (bench);
+}
+
+static int signature_verification_bench_rsa_setup (void **context)
+{
+	struct signature_verification_bench_rsa *bench;
+	int status;
+
+	bench = calloc (1, sizeof (struct signature_verification_bench_rsa));
+	if (bench == NULL) {
+		return SIG_VERIFICATION_NO_MEMORY;
+	}
+
+	status = RSA_TESTING_ENGINE_INIT (&bench->rsa);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = signature_verification_rsa_init (&bench->verification, &bench->state, &bench->rsa.base,
+		&RSA_PUBLIC_KEY);
+	if (status != 0) {
+		goto release_rsa;
+	}
+
+	*context = bench;
+
+	return 0;
+
+release_rsa:
+	RSA_TESTING_ENGINE_RELEASE (&bench->rsa);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int signature_verification_bench_rsa_verify (void *context)
+{
+	struct signature_verification_bench_rsa *bench = context;
+
+	return bench->verification.base.verify_signature (&bench->verification.base, SIG_HASH_TEST,
+		SIG_HASH_LEN, RSA_SIGNATURE_TEST, RSA_ENCRYPT_LEN);
+}
+
+static void signature_verification_bench_rsa_teardown (void *context)
+{
+	struct signature_verification_bench_rsa *bench = context;
+
+	signature_verification_rsa_release (&bench->verification);
+	RSA_TESTING_ENGINE_RELEASE (&bench->rsa);
+	free (bench);
+}
+
+
+static const struct bench_case signature_verification_bench_cases[] = {
+	{
+		"ecc_p256_verify", signature_verification_bench_ecc_setup,
+		signature_verification_bench_ecc_verify, signature_verification_bench_ecc_teardown, 0
+	},
+	{
+		"ecc_p256_set_key", signature_verification_bench_ecc_setup,
+		signature_verification_bench_ecc_set_key, signature_verification_bench_ecc_teardown, 0
+	},
+	{
+		"rsa_2048_verify", signature_verification_bench_rsa_setup,
+		signature_verification_bench_rsa_verify, signature_verification_bench_rsa_teardown, 0
+	},
+};
+
+const struct bench_suite signature_verification_bench_suite =
+	BENCH_SUITE ("signature_verification", signature_verification_bench_cases);
@@ -0,0 +1,364 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "flash/flash_common.h"
+#include "flash/flash_master.h"
+#include "flash/flash_updater.h"
+#include "flash/spi_flash.h"
+
+
+/**
+ * Size of the flash device.  The update region covers the entire device.
+ */
+#define	FLASH_UPDATER_BENCH_FLASH_SIZE		(512 * 1024)
+
+/**
+ * Size of the update image written during each operation.
+ */
+#define	FLASH_UPDATER_BENCH_IMAGE_SIZE		(256 * 1024)
+
+/**
+ * Amount of update data received in each request.
+ */
+#define	FLASH_UPDATER_BENCH_CHUNK_SIZE		4096
+
+/**
+ * Number of requests needed to receive the complete update image.
+ */
+#define	FLASH_UPDATER_BENCH_CHUNKS			\
+	(FLASH_UPDATER_BENCH_IMAGE_SIZE / FLASH_UPDATER_BENCH_CHUNK_SIZE)
+
+/**
+ * Maximum number of updates for which latency samples are kept.
+ */
+#define	FLASH_UPDATER_BENCH_SAMPLE_UPDATES	64
+
+/**
+ * Simulated time to program a single flash page, in nanoseconds.  Device timings are a tenth of
+ * typical SPI NOR values to keep each run short while preserving the ratio of erase to program
+ * time.
+ */
+#define	FLASH_UPDATER_BENCH_PROGRAM_NS		(40 * 1000)
+
+/**
+ * Simulated time to erase a 4kB flash sector, in nanoseconds.
+ */
+#define	FLASH_UPDATER_BENCH_SECTOR_ERASE_NS	(4500 * 1000)
+
+/**
+ * Simulated time to erase a 64kB flash block, in nanoseconds.
+ */
+#define	FLASH_UPDATER_BENCH_BLOCK_ERASE_NS	(15 * 1000 * 1000)
+
+
+/**
+ * A SPI master for a flash device backed by RAM that simulates program and erase times.
+ */
+struct flash_updater_bench_flash {
+	struct flash_master base;						/**< Base SPI master. */
+	uint8_t data[FLASH_UPDATER_BENCH_FLASH_SIZE];	/**< Contents of the flash device. */
+};
+
+/**
+ * Context for flash updater benchmarks.
+ */
+struct flash_updater_bench {
+	struct flash_updater_bench_flash spi;		/**< SPI master for the update flash. */
+	struct spi_flash_state flash_state;			/**< Context for the update flash. */
+	struct spi_flash flash;						/**< Flash device for the update. */
+	struct flash_updater updater;				/**< The updater being measured. */
+	bool erase_all;								/**< Flag to erase the entire update region. */
+	bool erase_ahead;							/**< Flag to erase between received requests. */
+	uint64_t updates;							/**< Number of updates completed. */
+	uint64_t update_ns;							/**< Total time spent on all updates. */
+
+	/**
+	 * Update data written for each request.
+	 */
+	uint8_t image[FLASH_UPDATER_BENCH_CHUNK_SIZE];
+
+	/**
+	 * Time from the start of update preparation until the first request has been written, in
+	 * nanoseconds.
+	 */
+	uint64_t first_ack[FLASH_UPDATER_BENCH_SAMPLE_UPDATES];
+
+	/**
+	 * Time taken to handle each write request for the most recent updates, in nanoseconds.
+	 */
+	uint64_t write_ack[FLASH_UPDATER_BENCH_SAMPLE_UPDATES * FLASH_UPDATER_BENCH_CHUNKS];
+};
+
+
+/**
+ * Simulate the time a flash device is busy with a program or erase operation.
+ *
+ * @param ns The time to wait, in nanoseconds.
+ */
+static void flash_updater_bench_flash_busy (uint32_t ns)
+{
+	struct timespec delay;
+
+	delay.tv_sec = ns / 1000000000;
+	delay.tv_nsec = ns % 1000000000;
+
+	nanosleep (&delay, NULL);
+}
+
+static int flash_updater_bench_flash_xfer (const struct flash_master *spi,
+	const struct flash_xfer *xfer)
+{
+	struct flash_updater_bench_flash *flash = (struct flash_updater_bench_flash*) spi;
+	uint32_t erase_len;
+
+	if (flash_xfer_has_no_address (xfer)) {
+		/* Program and erase block for the full operation time, so the device is always idle. */
+		if (!flash_xfer_is_tx (xfer)) {
+			memset (xfer->data, 0, xfer->length);
+		}
+
+		return 0;
+	}
+
+	if ((xfer->cmd == FLASH_CMD_4K_ERASE) || (xfer->cmd == FLASH_CMD_64K_ERASE)) {
+		erase_len = (xfer->cmd == FLASH_CMD_4K_ERASE) ? FLASH_SECTOR_SIZE : FLASH_BLOCK_SIZE;
+		if ((xfer->address + erase_len) > sizeof (flash->data)) {
+			return FLASH_MASTER_XFER_FAILED;
+		}
+
+		memset (&flash->data[xfer->address], 0xff, erase_len);
+		flash_updater_bench_flash_busy ((xfer->cmd == FLASH_CMD_4K_ERASE) ?
+			FLASH_UPDATER_BENCH_SECTOR_ERASE_NS : FLASH_UPDATER_BENCH_BLOCK_ERASE_NS);
+
+		return 0;
+	}
+
+	if ((xfer->address + xfer->length) > sizeof (flash->data)) {
+		return FLASH_MASTER_XFER_FAILED;
+	}
+
+	if (flash_xfer_is_tx (xfer)) {
+		memcpy (&flash->data[xfer->address], xfer->data, xfer->length);
+		flash_updater_bench_flash_busy (FLASH_UPDATER_BENCH_PROGRAM_NS);
+	}
+	else {
+		memcpy (xfer->data, &flash->data[xfer->address], xfer->length);
+	}
+
+	return 0;
+}
+
+static uint32_t flash_updater_bench_flash_capabilities (const struct flash_master *spi)
+{
+	return FLASH_CAP_3BYTE_ADDR;
+}
+
+/**
+ * Set up a flash updater for a flash device that simulates erase and program latency.
+ *
+ * @param context Output for the benchmark context.
+ * @param lazy_erase true to erase flash as update data is received.
+ * @param erase_all true to erase the entire update region for each update.
+ * @param erase_ahead true to erase flash for the next request while waiting for it to arrive.
+ *
+ * @return 0 if setup was successful or an error code.
+ */
+static int flash_updater_bench_setup (void **context, bool lazy_erase, bool erase_all,
+	bool erase_ahead)
+{
+	struct flash_updater_bench *bench;
+	size_t i;
+	int status;
+
+	bench = calloc (1, sizeof (struct flash_updater_bench));
+	if (bench == NULL) {
+		return FLASH_UPDATER_NO_MEMORY;
+	}
+
+	memset (bench->spi.data, 0xff, sizeof (bench->spi.data));
+	bench->spi.base.xfer = flash_updater_bench_flash_xfer;
+	bench->spi.base.capabilities = flash_updater_bench_flash_capabilities;
+
+	status = spi_flash_init (&bench->flash, &bench->flash_state, &bench->spi.base);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = spi_flash_set_device_size (&bench->flash, sizeof (bench->spi.data));
+	if (status != 0) {
+		goto release_flash;
+	}
+
+	status = flash_updater_init (&bench->updater, &bench->flash.base, 0,
+		FLASH_UPDATER_BENCH_FLASH_SIZE);
+	if (status != 0) {
+		goto release_flash;
+	}
+
+	status = flash_updater_set_lazy_erase (&bench->updater, lazy_erase);
+	if (status != 0) {
+		goto release_updater;
+	}
+
+	for (i = 0; i < sizeof (bench->image); i++) {
+		bench->image[i] = i;
+	}
+
+	bench->erase_all = erase_all;
+	bench->erase_ahead = erase_ahead;
+	*context = bench;
+
+	return 0;
+
+release_updater:
+	flash_updater_release (&bench->updater);
+release_flash:
+	spi_flash_release (&bench->flash);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int flash_updater_bench_setup_eager (void **context)
+{
+	return flash_updater_bench_setup (context, false, false, false);
+}
+
+static int flash_updater_bench_setup_lazy (void **context)
+{
+	return flash_updater_bench_setup (context, true, false, false);
+}
+
+static int flash_updater_bench_setup_lazy_erase_ahead (void **context)
+{
+	return flash_updater_bench_setup (context, true, false, true);
+}
+
+static int flash_updater_bench_setup_erase_all_eager (void **context)
+{
+	return flash_updater_bench_setup (context, false, true, false);
+}
+
+static int flash_updater_bench_setup_erase_all_lazy (void **context)
+{
+	return flash_updater_bench_setup (context, true, true, false);
+}
+
+/**
+ * Report the update latency measurements and release the benchmark context.
+ */
+static void flash_updater_bench_teardown (void *context)
+{
+	struct flash_updater_bench *bench = context;
+	size_t updates = bench->updates;
+
+	if (updates > FLASH_UPDATER_BENCH_SAMPLE_UPDATES) {
+		updates = FLASH_UPDATER_BENCH_SAMPLE_UPDATES;
+	}
+
+	if (bench->updates != 0) {
+		bench_report_metric ("total_update", (bench->update_ns / bench->updates) / 1000000.0,
+			"ms");
+	}
+	bench_report_latency ("first_ack", bench->first_ack, updates);
+	bench_report_latency ("write_ack", bench->write_ack, updates * FLASH_UPDATER_BENCH_CHUNKS);
+
+	flash_updater_release (&bench->updater);
+	spi_flash_release (&bench->flash);
+	free (bench);
+}
+
+/**
+ * Receive a complete update image, one request at a time.  Each request is acknowledged once the
+ * data has been written to flash.
+ */
+static int flash_updater_bench_update (void *context)
+{
+	struct flash_updater_bench *bench = context;
+	uint64_t *write_ack;
+	uint64_t start;
+	uint64_t ack;
+	int i;
+	int status;
+
+	write_ack = &bench->write_ack[(bench->updates % FLASH_UPDATER_BENCH_SAMPLE_UPDATES) *
+		FLASH_UPDATER_BENCH_CHUNKS];
+
+	start = bench_get_time_ns ();
+
+	if (bench->erase_all) {
+		status = flash_updater_prepare_for_update_erase_all (&bench->updater,
+			FLASH_UPDATER_BENCH_IMAGE_SIZE);
+	}
+	else {
+		status = flash_updater_prepare_for_update (&bench->updater,
+			FLASH_UPDATER_BENCH_IMAGE_SIZE);
+	}
+	if (status != 0) {
+		return status;
+	}
+
+	for (i = 0; i < FLASH_UPDATER_BENCH_CHUNKS; i++) {
+		ack = bench_get_time_ns ();
+
+		status = flash_updater_write_update_data (&bench->updater, bench->image,
+			sizeof (bench->image));
+		if (status != 0) {
+			return status;
+		}
+
+		write_ack[i] = bench_get_time_ns () - ack;
+		if (i == 0) {
+			bench->first_ack[bench->updates % FLASH_UPDATER_BENCH_SAMPLE_UPDATES] =
+				bench_get_time_ns () - start;
+		}
+
+		/* Use the time waiting for the next request to prepare flash for it. */
+		if (bench->erase_ahead) {
+			status = flash_updater_erase_ahead (&bench->updater, sizeof (bench->image));
+			if (status != 0) {
+				return status;
+			}
+		}
+	}
+
+	bench->update_ns += bench_get_time_ns () - start;
+	bench->updates++;
+
+	return 0;
+}
+
+
+static const struct bench_case flash_updater_bench_cases[] = {
+	{
+		"update_eager", flash_updater_bench_setup_eager, flash_updater_bench_update,
+		flash_updater_bench_teardown, FLASH_UPDATER_BENCH_IMAGE_SIZE
+	},
+	{
+		"update_lazy", flash_updater_bench_setup_lazy, flash_updater_bench_update,
+		flash_updater_bench_teardown, FLASH_UPDATER_BENCH_IMAGE_SIZE
+	},
+	{
+		"update_lazy_erase_ahead", flash_updater_bench_setup_lazy_erase_ahead,
+		flash_updater_bench_update, flash_updater_bench_teardown, FLASH_UPDATER_BENCH_IMAGE_SIZE
+	},
+	{
+		"update_erase_all_eager", flash_updater_bench_setup_erase_all_eager,
+		flash_updater_bench_update, flash_updater_bench_teardown, FLASH_UPDATER_BENCH_IMAGE_SIZE
+	},
+	{
+		"update_erase_all_lazy", flash_updater_bench_setup_erase_all_lazy,
+		flash_updater_bench_update, flash_updater_bench_teardown, FLASH_UPDATER_BENCH_IMAGE_SIZE
+	},
+};
+
+const struct bench_suite flash_updater_bench_suite =
+	BENCH_SUITE ("flash_updater", flash_updater_bench_cases);
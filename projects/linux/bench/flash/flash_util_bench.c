@@ -0,0 +1,176 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "flash/flash_util.h"
+#include "flash/flash_virtual_ram.h"
+#include "testing/engines/hash_testing_engine.h"
+
+
+/**
+ * Size of each virtual flash device.
+ */
+#define	FLASH_UTIL_BENCH_FLASH_SIZE		(256 * 1024)
+
+/**
+ * Size of the flash region processed by each operation.
+ */
+#define	FLASH_UTIL_BENCH_REGION_SIZE	(64 * 1024)
+
+
+/**
+ * Context for flash utility benchmarks.
+ */
+struct flash_util_bench {
+	HASH_TESTING_ENGINE hash;					/**< Hash engine for flash hashing. */
+	struct flash_virtual_ram_state src_state;	/**< Variable context for the source flash. */
+	struct flash_virtual_ram src;				/**< Source flash device. */
+	struct flash_virtual_ram_state dest_state;	/**< Variable context for the destination flash. */
+	struct flash_virtual_ram dest;				/**< Destination flash device. */
+	uint8_t *src_buffer;						/**< Storage for the source flash. */
+	uint8_t *dest_buffer;						/**< Storage for the destination flash. */
+	uint8_t *data;								/**< Copy of the source region contents. */
+	uint8_t digest[SHA256_HASH_LENGTH];			/**< Output for flash hashing. */
+};
+
+
+static void flash_util_bench_teardown (void *context)
+{
+	struct flash_util_bench *bench = context;
+
+	flash_virtual_ram_release (&bench->src);
+	flash_virtual_ram_release (&bench->dest);
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+
+	free (bench->src_buffer);
+	free (bench->dest_buffer);
+	free (bench->data);
+	free (bench);
+}
+
+static int flash_util_bench_setup (void **context)
+{
+	struct flash_util_bench *bench;
+	size_t i;
+	int status;
+
+	bench = calloc (1, sizeof (struct flash_util_bench));
+	if (bench == NULL) {
+		return FLASH_UTIL_NO_MEMORY;
+	}
+
+	bench->src_buffer = malloc (FLASH_UTIL_BENCH_FLASH_SIZE);
+	bench->dest_buffer = malloc (FLASH_UTIL_BENCH_FLASH_SIZE);
+	bench->data = malloc (FLASH_UTIL_BENCH_REGION_SIZE);
+	if ((bench->src_buffer == NULL) || (bench->dest_buffer == NULL) || (bench->data == NULL)) {
+		free (bench->src_buffer);
+		free (bench->dest_buffer);
+		free (bench->data);
+		free (bench);
+
+		return FLASH_UTIL_NO_MEMORY;
+	}
+
+	for (i = 0; i < FLASH_UTIL_BENCH_FLASH_SIZE; i++) {
+		bench->src_buffer[i] = i * 7;
+	}
+
+	memset (bench->dest_buffer, 0xff, FLASH_UTIL_BENCH_FLASH_SIZE);
+	memcpy (bench->data, bench->src_buffer, FLASH_UTIL_BENCH_REGION_SIZE);
+
+	status = HASH_TESTING_ENGINE_INIT (&bench->hash);
+	status |= flash_virtual_ram_init (&bench->src, &bench->src_state, bench->src_buffer,
+		FLASH_UTIL_BENCH_FLASH_SIZE);
+	status |= flash_virtual_ram_init (&bench->dest, &bench->dest_state, bench->dest_buffer,
+		FLASH_UTIL_BENCH_FLASH_SIZE);
+	if (status != 0) {
+		flash_util_bench_teardown (bench);
+
+		return status;
+	}
+
+	*context = bench;
+
+	return 0;
+}
+
+static int flash_util_bench_hash_contents (void *context)
+{
+	struct flash_util_bench *bench = context;
+
+	return flash_hash_contents (&bench->src.base, 0, FLASH_UTIL_BENCH_REGION_SIZE,
+		&bench->hash.base, HASH_TYPE_SHA256, bench->digest, sizeof (bench->digest));
+}
+
+static int flash_util_bench_verify_data (void *context)
+{
+	struct flash_util_bench *bench = context;
+
+	return flash_verify_data (&bench->src.base, 0, bench->data, FLASH_UTIL_BENCH_REGION_SIZE);
+}
+
+static int flash_util_bench_value_check (void *context)
+{
+	struct flash_util_bench *bench = context;
+
+	return flash_value_check (&bench->dest.base, FLASH_UTIL_BENCH_FLASH_SIZE / 2,
+		FLASH_UTIL_BENCH_REGION_SIZE, 0xff);
+}
+
+static int flash_util_bench_copy_ext (void *context)
+{
+	struct flash_util_bench *bench = context;
+
+	return flash_copy_ext (&bench->dest.base, 0, &bench->src.base, 0, FLASH_UTIL_BENCH_REGION_SIZE);
+}
+
+static int flash_util_bench_copy_ext_and_verify (void *context)
+{
+	struct flash_util_bench *bench = context;
+
+	return flash_copy_ext_and_verify (&bench->dest.base, 0, &bench->src.base, 0,
+		FLASH_UTIL_BENCH_REGION_SIZE);
+}
+
+static int flash_util_bench_program_and_verify (void *context)
+{
+	struct flash_util_bench *bench = context;
+
+	return flash_program_and_verify (&bench->dest.base, 0, bench->data,
+		FLASH_UTIL_BENCH_REGION_SIZE);
+}
+
+
+static const struct bench_case flash_util_bench_cases[] = {
+	{
+		"hash_contents_sha256_64k", flash_util_bench_setup, flash_util_bench_hash_contents,
+		flash_util_bench_teardown, FLASH_UTIL_BENCH_REGION_SIZE
+	},
+	{
+		"verify_data_64k", flash_util_bench_setup, flash_util_bench_verify_data,
+		flash_util_bench_teardown, FLASH_UTIL_BENCH_REGION_SIZE
+	},
+	{
+		"value_check_64k", flash_util_bench_setup, flash_util_bench_value_check,
+		flash_util_bench_teardown, FLASH_UTIL_BENCH_REGION_SIZE
+	},
+	{
+		"copy_ext_64k", flash_util_bench_setup, flash_util_bench_copy_ext,
+		flash_util_bench_teardown, FLASH_UTIL_BENCH_REGION_SIZE
+	},
+	{
+		"copy_ext_and_verify_64k", flash_util_bench_setup, flash_util_bench_copy_ext_and_verify,
+		flash_util_bench_teardown, FLASH_UTIL_BENCH_REGION_SIZE
+	},
+	{
+		"program_and_verify_64k", flash_util_bench_setup, flash_util_bench_program_and_verify,
+		flash_util_bench_teardown, FLASH_UTIL_BENCH_REGION_SIZE
+	},
+};
+
+const struct bench_suite flash_util_bench_suite =
+	BENCH_SUITE ("flash_util", flash_util_bench_cases);
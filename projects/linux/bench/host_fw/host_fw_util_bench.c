@@ -0,0 +1,354 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "flash/flash_common.h"
+#include "flash/flash_master.h"
+#include "flash/spi_flash.h"
+#include "host_fw/host_fw_util.h"
+#include "testing/engines/hash_testing_engine.h"
+#include "testing/engines/rsa_testing_engine.h"
+
+
+/**
+ * Number of firmware components described by the PFM.
+ */
+#define	HOST_FW_UTIL_BENCH_FW_COUNT			4
+
+/**
+ * Number of R/W regions defined for each firmware component.
+ */
+#define	HOST_FW_UTIL_BENCH_RW_COUNT			64
+
+/**
+ * Total number of R/W regions across all firmware components.
+ */
+#define	HOST_FW_UTIL_BENCH_REGIONS			\
+	(HOST_FW_UTIL_BENCH_FW_COUNT * HOST_FW_UTIL_BENCH_RW_COUNT)
+
+/**
+ * Number of contiguous R/W regions that make up each range programmed into the SPI filter.
+ */
+#define	HOST_FW_UTIL_BENCH_FILTER_GROUP		16
+
+/**
+ * Number of images in each image list that is compared.
+ */
+#define	HOST_FW_UTIL_BENCH_IMAGE_COUNT		32
+
+/**
+ * Number of flash regions in each image.
+ */
+#define	HOST_FW_UTIL_BENCH_IMG_REGIONS		8
+
+/**
+ * Size of the flash device.
+ */
+#define	HOST_FW_UTIL_BENCH_FLASH_SIZE		(128 * 1024)
+
+
+/**
+ * A SPI master for a blank flash device backed by RAM.
+ */
+struct host_fw_util_bench_flash {
+	struct flash_master base;						/**< Base SPI master. */
+	uint8_t data[HOST_FW_UTIL_BENCH_FLASH_SIZE];	/**< Contents of the flash device. */
+};
+
+/**
+ * A SPI filter that accepts every R/W region.
+ */
+struct host_fw_util_bench_filter {
+	struct spi_filter_interface base;	/**< Base SPI filter. */
+	size_t regions;						/**< Number of R/W regions that have been configured. */
+};
+
+/**
+ * Context for host firmware utility benchmarks.
+ */
+struct host_fw_util_bench {
+	HASH_TESTING_ENGINE hash;																	/**< Hash engine for image verification. */
+	RSA_TESTING_ENGINE rsa;																		/**< RSA engine for image verification. */
+	struct host_fw_util_bench_flash spi;														/**< SPI master for the host flash. */
+	struct spi_flash_state flash_state;															/**< Context for the host flash. */
+	struct spi_flash flash;																		/**< The host flash device. */
+	struct host_fw_util_bench_filter filter;													/**< SPI filter for R/W regions. */
+	struct flash_region rw_region[HOST_FW_UTIL_BENCH_FW_COUNT][HOST_FW_UTIL_BENCH_RW_COUNT];	/**< R/W regions for each component. */
+	struct pfm_read_write rw_prop[HOST_FW_UTIL_BENCH_RW_COUNT];									/**< Properties of the R/W regions. */
+	struct pfm_read_write_regions rw_list[HOST_FW_UTIL_BENCH_FW_COUNT];							/**< R/W regions for all components. */
+	struct pfm_image_list img_list[HOST_FW_UTIL_BENCH_FW_COUNT];								/**< Images for all components. */
+
+	/**
+	 * Regions of the images in the first image list.
+	 */
+	struct flash_region img_region1[HOST_FW_UTIL_BENCH_IMAGE_COUNT][HOST_FW_UTIL_BENCH_IMG_REGIONS];
+
+	/**
+	 * Regions of the images in the second image list.
+	 */
+	struct flash_region img_region2[HOST_FW_UTIL_BENCH_IMAGE_COUNT][HOST_FW_UTIL_BENCH_IMG_REGIONS];
+
+	struct pfm_image_hash img_hash1[HOST_FW_UTIL_BENCH_IMAGE_COUNT];	/**< Images in the first list. */
+	struct pfm_image_hash img_hash2[HOST_FW_UTIL_BENCH_IMAGE_COUNT];	/**< Images in the second list. */
+	struct pfm_image_list compare1;										/**< First image list to compare. */
+	struct pfm_image_list compare2;										/**< Second image list to compare. */
+};
+
+
+static int host_fw_util_bench_flash_xfer (const struct flash_master *spi,
+	const struct flash_xfer *xfer)
+{
+	struct host_fw_util_bench_flash *flash = (struct host_fw_util_bench_flash*) spi;
+
+	if (flash_xfer_has_no_address (xfer)) {
+		/* Status reads report the device is always idle.  Other commands are ignored. */
+		if (!flash_xfer_is_tx (xfer)) {
+			memset (xfer->data, 0, xfer->length);
+		}
+
+		return 0;
+	}
+
+	if ((xfer->address + xfer->length) > sizeof (flash->data)) {
+		return FLASH_MASTER_XFER_FAILED;
+	}
+
+	if (!flash_xfer_is_tx (xfer)) {
+		memcpy (xfer->data, &flash->data[xfer->address], xfer->length);
+	}
+
+	return 0;
+}
+
+static uint32_t host_fw_util_bench_flash_capabilities (const struct flash_master *spi)
+{
+	return FLASH_CAP_3BYTE_ADDR;
+}
+
+static int host_fw_util_bench_filter_clear_rw_regions (const struct spi_filter_interface *filter)
+{
+	struct host_fw_util_bench_filter *bench = (struct host_fw_util_bench_filter*) filter;
+
+	bench->regions = 0;
+
+	return 0;
+}
+
+static int host_fw_util_bench_filter_set_rw_region (const struct spi_filter_interface *filter,
+	uint8_t region, uint32_t start_addr, uint32_t end_addr)
+{
+	struct host_fw_util_bench_filter *bench = (struct host_fw_util_bench_filter*) filter;
+
+	bench->regions++;
+
+	return 0;
+}
+
+static void host_fw_util_bench_teardown (void *context)
+{
+	struct host_fw_util_bench *bench = context;
+
+	spi_flash_release (&bench->flash);
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+	RSA_TESTING_ENGINE_RELEASE (&bench->rsa);
+	free (bench);
+}
+
+/**
+ * Create the context for a host firmware utility benchmark.  Each firmware component has R/W
+ * regions interleaved with the regions of the other components, and each list of regions is in
+ * reverse address order.
+ *
+ * @param context Output for the benchmark context.
+ * @param contiguous Flag to make groups of R/W regions contiguous, instead of leaving unused flash
+ * between every region.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int host_fw_util_bench_setup (void **context, bool contiguous)
+{
+	struct host_fw_util_bench *bench;
+	uint32_t stride = (contiguous) ? 0x100 : 0x200;
+	uint32_t addr;
+	size_t i;
+	size_t j;
+	int status;
+
+	bench = calloc (1, sizeof (struct host_fw_util_bench));
+	if (bench == NULL) {
+		return HOST_FW_UTIL_NO_MEMORY;
+	}
+
+	status = HASH_TESTING_ENGINE_INIT (&bench->hash);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = RSA_TESTING_ENGINE_INIT (&bench->rsa);
+	if (status != 0) {
+		goto release_hash;
+	}
+
+	memset (bench->spi.data, 0xff, sizeof (bench->spi.data));
+	bench->spi.base.xfer = host_fw_util_bench_flash_xfer;
+	bench->spi.base.capabilities = host_fw_util_bench_flash_capabilities;
+
+	status = spi_flash_init (&bench->flash, &bench->flash_state, &bench->spi.base);
+	if (status != 0) {
+		goto release_rsa;
+	}
+
+	status = spi_flash_set_device_size (&bench->flash, sizeof (bench->spi.data));
+	if (status != 0) {
+		goto release_flash;
+	}
+
+	bench->filter.base.clear_filter_rw_regions = host_fw_util_bench_filter_clear_rw_regions;
+	bench->filter.base.set_filter_rw_region = host_fw_util_bench_filter_set_rw_region;
+
+	for (i = 0; i < HOST_FW_UTIL_BENCH_FW_COUNT; i++) {
+		for (j = 0; j < HOST_FW_UTIL_BENCH_RW_COUNT; j++) {
+			addr = ((HOST_FW_UTIL_BENCH_RW_COUNT - 1 - j) * HOST_FW_UTIL_BENCH_FW_COUNT) + i;
+
+			bench->rw_region[i][j].start_addr = addr * stride;
+			if (contiguous) {
+				/* Leave unused flash between each group of contiguous regions. */
+				bench->rw_region[i][j].start_addr += (addr / HOST_FW_UTIL_BENCH_FILTER_GROUP) *
+					0x100;
+			}
+			bench->rw_region[i][j].length = 0x100;
+		}
+
+		bench->rw_list[i].regions = bench->rw_region[i];
+		bench->rw_list[i].properties = bench->rw_prop;
+		bench->rw_list[i].count = HOST_FW_UTIL_BENCH_RW_COUNT;
+	}
+
+	for (j = 0; j < HOST_FW_UTIL_BENCH_RW_COUNT; j++) {
+		bench->rw_prop[j].on_failure = PFM_RW_DO_NOTHING;
+	}
+
+	/* The images in both lists are the same, but the regions in each image of the second list are
+	 * in the opposite order. */
+	for (i = 0; i < HOST_FW_UTIL_BENCH_IMAGE_COUNT; i++) {
+		for (j = 0; j < HOST_FW_UTIL_BENCH_IMG_REGIONS; j++) {
+			addr = ((j * HOST_FW_UTIL_BENCH_IMAGE_COUNT) + i) * 0x200;
+
+			bench->img_region1[i][j].start_addr = addr;
+			bench->img_region1[i][j].length = 0x100;
+			bench->img_region2[i][HOST_FW_UTIL_BENCH_IMG_REGIONS - 1 - j] =
+				bench->img_region1[i][j];
+		}
+
+		bench->img_hash1[i].regions = bench->img_region1[i];
+		bench->img_hash1[i].count = HOST_FW_UTIL_BENCH_IMG_REGIONS;
+		bench->img_hash1[i].hash_length = SHA256_HASH_LENGTH;
+		bench->img_hash1[i].hash_type = HASH_TYPE_SHA256;
+		memset (bench->img_hash1[i].hash, i, SHA256_HASH_LENGTH);
+
+		bench->img_hash2[i] = bench->img_hash1[i];
+		bench->img_hash2[i].regions = bench->img_region2[i];
+	}
+
+	bench->compare1.images_hash = bench->img_hash1;
+	bench->compare1.count = HOST_FW_UTIL_BENCH_IMAGE_COUNT;
+	bench->compare2.images_hash = bench->img_hash2;
+	bench->compare2.count = HOST_FW_UTIL_BENCH_IMAGE_COUNT;
+
+	*context = bench;
+
+	return 0;
+
+release_flash:
+	spi_flash_release (&bench->flash);
+release_rsa:
+	RSA_TESTING_ENGINE_RELEASE (&bench->rsa);
+release_hash:
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int host_fw_util_bench_setup_disjoint (void **context)
+{
+	return host_fw_util_bench_setup (context, false);
+}
+
+static int host_fw_util_bench_setup_contiguous (void **context)
+{
+	return host_fw_util_bench_setup (context, true);
+}
+
+/**
+ * Check that all flash outside the R/W regions is blank.  There are no images to verify.
+ */
+static int host_fw_util_bench_full_flash_verification (void *context)
+{
+	struct host_fw_util_bench *bench = context;
+
+	return host_fw_full_flash_verification_multiple_fw (&bench->flash, bench->img_list,
+		bench->rw_list, HOST_FW_UTIL_BENCH_FW_COUNT, 0xff, &bench->hash.base, &bench->rsa.base);
+}
+
+/**
+ * Program the SPI filter with the merged R/W regions of all firmware components.
+ */
+static int host_fw_util_bench_config_spi_filter (void *context)
+{
+	struct host_fw_util_bench *bench = context;
+	int status;
+
+	status = host_fw_config_spi_filter_read_write_regions_multiple_fw (&bench->filter.base,
+		bench->rw_list, HOST_FW_UTIL_BENCH_FW_COUNT);
+	if (status != 0) {
+		return status;
+	}
+
+	if (bench->filter.regions !=
+		(HOST_FW_UTIL_BENCH_REGIONS / HOST_FW_UTIL_BENCH_FILTER_GROUP)) {
+		return HOST_FW_UTIL_DIFF_REGION_COUNT;
+	}
+
+	return 0;
+}
+
+/**
+ * Compare two lists of identical images whose regions are listed in different orders.
+ */
+static int host_fw_util_bench_images_different (void *context)
+{
+	struct host_fw_util_bench *bench = context;
+
+	if (host_fw_are_images_different (&bench->compare1, &bench->compare2)) {
+		return HOST_FW_UTIL_DIFF_REGION_ADDR;
+	}
+
+	return 0;
+}
+
+
+static const struct bench_case host_fw_util_bench_cases[] = {
+	{
+		"full_flash_verification_256_regions", host_fw_util_bench_setup_disjoint,
+		host_fw_util_bench_full_flash_verification, host_fw_util_bench_teardown,
+		HOST_FW_UTIL_BENCH_REGIONS * 0x100
+	},
+	{
+		"config_spi_filter_256_regions", host_fw_util_bench_setup_contiguous,
+		host_fw_util_bench_config_spi_filter, host_fw_util_bench_teardown, 0
+	},
+	{
+		"are_images_different_256_regions", host_fw_util_bench_setup_disjoint,
+		host_fw_util_bench_images_different, host_fw_util_bench_teardown, 0
+	},
+};
+
+const struct bench_suite host_fw_util_bench_suite =
+	BENCH_SUITE ("host_fw_util", host_fw_util_bench_cases);
@@ -0,0 +1,175 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "flash/flash_virtual_ram.h"
+#include "logging/debug_log.h"
+#include "logging/logging_flash_compressed.h"
+
+
+/**
+ * Sector size of the simulated flash device.
+ */
+#define	LOGGING_FLASH_COMPRESSED_BENCH_SECTOR_SIZE	0x1000
+
+/**
+ * Number of sectors used by the log.
+ */
+#define	LOGGING_FLASH_COMPRESSED_BENCH_SECTORS		16
+
+/**
+ * Number of entries created between each flush of the log.
+ */
+#define	LOGGING_FLASH_COMPRESSED_BENCH_FLUSH_COUNT	32
+
+
+/**
+ * Context for compressed flash log benchmarks.
+ */
+struct logging_flash_compressed_bench {
+	struct flash_virtual_ram_state flash_state;		/**< Context for the virtual flash. */
+	struct flash_virtual_ram flash;					/**< Flash device for the log. */
+	struct logging_flash_compressed_state state;	/**< Context for the log. */
+	struct logging_flash_compressed log;			/**< The log being measured. */
+	struct debug_log_entry_info entry;				/**< Entry to add to the log. */
+	uint32_t count;									/**< Number of entries created. */
+
+	/**
+	 * Memory for the virtual flash device.
+	 */
+	uint8_t flash_data[LOGGING_FLASH_COMPRESSED_BENCH_SECTOR_SIZE *
+		LOGGING_FLASH_COMPRESSED_BENCH_SECTORS];
+
+	/**
+	 * Sector information for the log.
+	 */
+	struct logging_flash_compressed_sector sectors[LOGGING_FLASH_COMPRESSED_BENCH_SECTORS];
+};
+
+
+/**
+ * Report the sector size of a typical SPI flash device instead of the virtual flash block size.
+ */
+static int logging_flash_compressed_bench_get_sector_size (const struct flash *flash,
+	uint32_t *bytes)
+{
+	*bytes = LOGGING_FLASH_COMPRESSED_BENCH_SECTOR_SIZE;
+
+	return 0;
+}
+
+/**
+ * Erase a full sector of the virtual flash.
+ */
+static int logging_flash_compressed_bench_sector_erase (const struct flash *flash,
+	uint32_t sector_addr)
+{
+	uint32_t offset;
+	int status;
+
+	for (offset = 0; offset < LOGGING_FLASH_COMPRESSED_BENCH_SECTOR_SIZE;
+		offset += VIRTUAL_FLASH_BLOCK_SIZE) {
+		status = flash->block_erase (flash, sector_addr + offset);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	return 0;
+}
+
+static int logging_flash_compressed_bench_setup (void **context)
+{
+	struct logging_flash_compressed_bench *bench;
+	int status;
+
+	bench = calloc (1, sizeof (struct logging_flash_compressed_bench));
+	if (bench == NULL) {
+		return LOGGING_NO_MEMORY;
+	}
+
+	memset (bench->flash_data, 0xff, sizeof (bench->flash_data));
+
+	status = flash_virtual_ram_init (&bench->flash, &bench->flash_state, bench->flash_data,
+		sizeof (bench->flash_data));
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	bench->flash.base.get_sector_size = logging_flash_compressed_bench_get_sector_size;
+	bench->flash.base.sector_erase = logging_flash_compressed_bench_sector_erase;
+
+	status = logging_flash_compressed_init (&bench->log, &bench->state, &bench->flash.base, 0,
+		bench->sectors, LOGGING_FLASH_COMPRESSED_BENCH_SECTORS);
+	if (status != 0) {
+		goto release_flash;
+	}
+
+	bench->entry.format = DEBUG_LOG_ENTRY_FORMAT;
+	bench->entry.severity = DEBUG_LOG_SEVERITY_INFO;
+	bench->entry.component = DEBUG_LOG_COMPONENT_SYSTEM;
+	bench->entry.msg_index = 1;
+
+	*context = bench;
+
+	return 0;
+
+release_flash:
+	flash_virtual_ram_release (&bench->flash);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static void logging_flash_compressed_bench_teardown (void *context)
+{
+	struct logging_flash_compressed_bench *bench = context;
+
+	logging_flash_compressed_release (&bench->log);
+	flash_virtual_ram_release (&bench->flash);
+	free (bench);
+}
+
+/**
+ * Add one debug log entry, flushing the log to flash periodically.  Entry arguments change on
+ * every call, the same way a periodic status entry would.
+ */
+static int logging_flash_compressed_bench_create_entry (void *context)
+{
+	struct logging_flash_compressed_bench *bench = context;
+	int status;
+
+	bench->count++;
+	bench->entry.arg1 = bench->count;
+	bench->entry.arg2 = bench->count % 100;
+	bench->entry.time = bench->count * 1000ULL;
+
+	status = bench->log.base.create_entry (&bench->log.base, (uint8_t*) &bench->entry,
+		sizeof (bench->entry));
+	if (status != 0) {
+		return status;
+	}
+
+	if ((bench->count % LOGGING_FLASH_COMPRESSED_BENCH_FLUSH_COUNT) == 0) {
+		status = bench->log.base.flush (&bench->log.base);
+	}
+
+	return status;
+}
+
+
+static const struct bench_case logging_flash_compressed_bench_cases[] = {
+	{
+		"create_entry", logging_flash_compressed_bench_setup,
+		logging_flash_compressed_bench_create_entry, logging_flash_compressed_bench_teardown,
+		sizeof (struct debug_log_entry_info)
+	},
+};
+
+const struct bench_suite logging_flash_compressed_bench_suite =
+	BENCH_SUITE ("logging_flash_compressed", logging_flash_compressed_bench_cases);
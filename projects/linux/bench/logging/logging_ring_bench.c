@@ -0,0 +1,462 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "platform_api.h"
+#include "flash/flash_common.h"
+#include "flash/flash_master.h"
+#include "flash/spi_flash.h"
+#include "logging/debug_log.h"
+#include "logging/log_flush_handler.h"
+#include "logging/logging_flash.h"
+#include "logging/logging_ring.h"
+#include "system/periodic_task_linux.h"
+
+
+/**
+ * Number of tasks concurrently creating log entries, such as the command channel, attestation and
+ * background tasks all reporting errors during a packet storm.
+ */
+#define	LOGGING_RING_BENCH_PRODUCERS		8
+
+/**
+ * Number of entries created by each producer in a single burst.
+ */
+#define	LOGGING_RING_BENCH_BURST			64
+
+/**
+ * Total number of entries created in a single burst.
+ */
+#define	LOGGING_RING_BENCH_BURST_ENTRIES	\
+	(LOGGING_RING_BENCH_PRODUCERS * LOGGING_RING_BENCH_BURST)
+
+/**
+ * Number of bursts for which entry latency samples are kept.
+ */
+#define	LOGGING_RING_BENCH_SAMPLE_BURSTS	64
+
+/**
+ * Number of entries buffered by a ring that can absorb a full burst.
+ */
+#define	LOGGING_RING_BENCH_RING_ENTRIES		1024
+
+/**
+ * Number of entries buffered by a ring that is too small to absorb a burst.
+ */
+#define	LOGGING_RING_BENCH_SMALL_RING		64
+
+/**
+ * Time between log flushes by the flush task, in milliseconds.
+ */
+#define	LOGGING_RING_BENCH_FLUSH_MS			10
+
+/**
+ * Simulated time to program a single flash page, in nanoseconds.
+ */
+#define	LOGGING_RING_BENCH_PROGRAM_NS		(500 * 1000)
+
+/**
+ * Simulated time to erase a 4kB flash sector, in nanoseconds.
+ */
+#define	LOGGING_RING_BENCH_ERASE_NS			(25 * 1000 * 1000)
+
+/**
+ * Maximum time to wait for the flush task to move a burst to the flash log, in milliseconds.
+ */
+#define	LOGGING_RING_BENCH_DRAIN_TIMEOUT_MS	5000
+
+
+/**
+ * A SPI master for a flash device backed by RAM that simulates program and erase times.
+ */
+struct logging_ring_bench_flash {
+	struct flash_master base;				/**< Base SPI master. */
+	uint8_t data[LOGGING_FLASH_AREA_LEN];	/**< Contents of the flash device. */
+};
+
+/**
+ * Context for a single producer task.
+ */
+struct logging_ring_bench_producer {
+	const struct logging *log;	/**< The log to add entries to. */
+	uint32_t id;				/**< Identifier for the producer. */
+	uint32_t seq;				/**< Sequence number for the next entry. */
+	uint64_t *latency;			/**< Output for the time taken to create each entry. */
+	int status;					/**< Result of the first failed entry. */
+};
+
+/**
+ * Context for log contention benchmarks.
+ */
+struct logging_ring_bench {
+	struct logging_ring_bench_flash spi;				/**< SPI master for the log flash. */
+	struct spi_flash_state flash_state;					/**< Context for the log flash. */
+	struct spi_flash flash;								/**< Flash device for the log. */
+	struct logging_flash_state target_state;			/**< Context for the flash log. */
+	struct logging_flash target;						/**< The log that stores entries. */
+	struct logging_ring_state ring_state;				/**< Context for the ring log. */
+	struct logging_ring ring;							/**< Ring log in front of the flash log. */
+	uint8_t *ring_buffer;								/**< Memory for the ring, if used. */
+	const struct logging *log;							/**< The log producers add entries to. */
+	const struct logging *flush_logs[1];				/**< Logs flushed by the handler. */
+	struct log_flush_handler_state flush_state;			/**< Context for the flush handler. */
+	struct log_flush_handler flush;						/**< Handler to flush the log. */
+	const struct periodic_task_handler *handlers[1];	/**< Handlers for the flush task. */
+	struct periodic_task_scheduler_entry entries[1];	/**< Scheduling storage for the task. */
+	struct periodic_task_linux_state task_state;		/**< Context for the flush task. */
+	struct periodic_task_linux task;					/**< Task that flushes the log. */
+	uint32_t first_id;									/**< ID of the first entry created. */
+	uint64_t created;									/**< Number of entries created. */
+	uint64_t bursts;									/**< Number of bursts completed. */
+	uint64_t producer_ns;								/**< Total time spent by producers. */
+
+	/**
+	 * Context for each task creating entries.
+	 */
+	struct logging_ring_bench_producer producer[LOGGING_RING_BENCH_PRODUCERS];
+
+	/**
+	 * Latency of each entry creation for the most recent bursts, in nanoseconds.
+	 */
+	uint64_t latency[LOGGING_RING_BENCH_SAMPLE_BURSTS * LOGGING_RING_BENCH_BURST_ENTRIES];
+};
+
+
+/**
+ * Simulate the time a flash device is busy with a program or erase operation.
+ *
+ * @param ns The time to wait, in nanoseconds.
+ */
+static void logging_ring_bench_flash_busy (uint32_t ns)
+{
+	struct timespec delay;
+
+	delay.tv_sec = ns / 1000000000;
+	delay.tv_nsec = ns % 1000000000;
+
+	nanosleep (&delay, NULL);
+}
+
+static int logging_ring_bench_flash_xfer (const struct flash_master *spi,
+	const struct flash_xfer *xfer)
+{
+	struct logging_ring_bench_flash *flash = (struct logging_ring_bench_flash*) spi;
+
+	if (flash_xfer_has_no_address (xfer)) {
+		/* Program and erase block for the full operation time, so the device is always idle. */
+		if (!flash_xfer_is_tx (xfer)) {
+			memset (xfer->data, 0, xfer->length);
+		}
+
+		return 0;
+	}
+
+	if (xfer->cmd == FLASH_CMD_4K_ERASE) {
+		if ((xfer->address + FLASH_SECTOR_SIZE) > sizeof (flash->data)) {
+			return FLASH_MASTER_XFER_FAILED;
+		}
+
+		memset (&flash->data[xfer->address], 0xff, FLASH_SECTOR_SIZE);
+		logging_ring_bench_flash_busy (LOGGING_RING_BENCH_ERASE_NS);
+
+		return 0;
+	}
+
+	if ((xfer->address + xfer->length) > sizeof (flash->data)) {
+		return FLASH_MASTER_XFER_FAILED;
+	}
+
+	if (flash_xfer_is_tx (xfer)) {
+		memcpy (&flash->data[xfer->address], xfer->data, xfer->length);
+		logging_ring_bench_flash_busy (LOGGING_RING_BENCH_PROGRAM_NS);
+	}
+	else {
+		memcpy (xfer->data, &flash->data[xfer->address], xfer->length);
+	}
+
+	return 0;
+}
+
+static uint32_t logging_ring_bench_flash_capabilities (const struct flash_master *spi)
+{
+	return FLASH_CAP_3BYTE_ADDR;
+}
+
+/**
+ * Set up a flash log that is periodically flushed by a log_flush_handler, optionally with a ring in
+ * front of it.
+ *
+ * @param context Output for the benchmark context.
+ * @param ring_entries Number of entries in the ring.  0 to have producers use the flash log
+ * directly.
+ *
+ * @return 0 if setup was successful or an error code.
+ */
+static int logging_ring_bench_setup (void **context, size_t ring_entries)
+{
+	struct logging_ring_bench *bench;
+	size_t ring_len = LOGGING_RING_BUFFER_LEN (ring_entries, sizeof (struct debug_log_entry_info));
+	int status;
+
+	bench = calloc (1, sizeof (struct logging_ring_bench));
+	if (bench == NULL) {
+		return LOGGING_NO_MEMORY;
+	}
+
+	memset (bench->spi.data, 0xff, sizeof (bench->spi.data));
+	bench->spi.base.xfer = logging_ring_bench_flash_xfer;
+	bench->spi.base.capabilities = logging_ring_bench_flash_capabilities;
+
+	status = spi_flash_init (&bench->flash, &bench->flash_state, &bench->spi.base);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = spi_flash_set_device_size (&bench->flash, sizeof (bench->spi.data));
+	if (status != 0) {
+		goto release_flash;
+	}
+
+	status = logging_flash_init (&bench->target, &bench->target_state, &bench->flash, 0);
+	if (status != 0) {
+		goto release_flash;
+	}
+
+	bench->log = &bench->target.base;
+
+	if (ring_entries != 0) {
+		bench->ring_buffer = malloc (ring_len);
+		if (bench->ring_buffer == NULL) {
+			status = LOGGING_NO_MEMORY;
+			goto release_target;
+		}
+
+		status = logging_ring_init (&bench->ring, &bench->ring_state, &bench->target.base,
+			bench->ring_buffer, ring_len, sizeof (struct debug_log_entry_info));
+		if (status != 0) {
+			goto free_ring;
+		}
+
+		bench->log = &bench->ring.base;
+	}
+
+	bench->flush_logs[0] = bench->log;
+
+	status = log_flush_handler_init (&bench->flush, &bench->flush_state, bench->flush_logs, 1,
+		LOGGING_RING_BENCH_FLUSH_MS);
+	if (status != 0) {
+		goto release_ring;
+	}
+
+	bench->handlers[0] = &bench->flush.base;
+
+	status = periodic_task_linux_init (&bench->task, &bench->task_state, bench->handlers, 1,
+		bench->entries, 0);
+	if (status != 0) {
+		goto release_handler;
+	}
+
+	status = periodic_task_linux_start (&bench->task);
+	if (status != 0) {
+		goto release_task;
+	}
+
+	bench->first_id = bench->target_state.next_entry_id;
+	*context = bench;
+
+	return 0;
+
+release_task:
+	periodic_task_linux_release (&bench->task);
+release_handler:
+	log_flush_handler_release (&bench->flush);
+release_ring:
+	if (ring_entries != 0) {
+		logging_ring_release (&bench->ring);
+	}
+free_ring:
+	free (bench->ring_buffer);
+release_target:
+	logging_flash_release (&bench->target);
+release_flash:
+	spi_flash_release (&bench->flash);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int logging_ring_bench_setup_flash (void **context)
+{
+	return logging_ring_bench_setup (context, 0);
+}
+
+static int logging_ring_bench_setup_ring (void **context)
+{
+	return logging_ring_bench_setup (context, LOGGING_RING_BENCH_RING_ENTRIES);
+}
+
+static int logging_ring_bench_setup_small_ring (void **context)
+{
+	return logging_ring_bench_setup (context, LOGGING_RING_BENCH_SMALL_RING);
+}
+
+/**
+ * Report the producer measurements and release the benchmark context.
+ */
+static void logging_ring_bench_teardown (void *context)
+{
+	struct logging_ring_bench *bench = context;
+	size_t samples = bench->bursts * LOGGING_RING_BENCH_BURST_ENTRIES;
+	uint32_t stored;
+
+	periodic_task_linux_release (&bench->task);
+
+	/* Every entry must reach the flash log. */
+	bench->log->flush (bench->log);
+	stored = bench->target_state.next_entry_id - bench->first_id;
+
+	if (samples > ARRAY_SIZE (bench->latency)) {
+		samples = ARRAY_SIZE (bench->latency);
+	}
+
+	if (bench->producer_ns != 0) {
+		bench_report_metric ("producer_entries_per_sec",
+			(bench->created * 1000000000.0) / bench->producer_ns, "entries/s");
+	}
+	bench_report_latency ("create_entry", bench->latency, samples);
+	bench_report_metric ("lost_entries", (double) (bench->created - stored), "entries");
+
+	log_flush_handler_release (&bench->flush);
+	if (bench->ring_buffer != NULL) {
+		logging_ring_release (&bench->ring);
+		free (bench->ring_buffer);
+	}
+	logging_flash_release (&bench->target);
+	spi_flash_release (&bench->flash);
+	free (bench);
+}
+
+/**
+ * Task to create a burst of debug log entries as fast as possible.
+ *
+ * @param arg The producer context.
+ *
+ * @return Unused.
+ */
+static void* logging_ring_bench_producer_task (void *arg)
+{
+	struct logging_ring_bench_producer *producer = arg;
+	struct debug_log_entry_info entry;
+	uint64_t start;
+	int i;
+	int status;
+
+	memset (&entry, 0, sizeof (entry));
+	entry.format = DEBUG_LOG_ENTRY_FORMAT;
+	entry.severity = DEBUG_LOG_SEVERITY_ERROR;
+	entry.component = DEBUG_LOG_COMPONENT_MCTP;
+	entry.arg1 = producer->id;
+
+	for (i = 0; i < LOGGING_RING_BENCH_BURST; i++) {
+		entry.arg2 = producer->seq++;
+
+		start = bench_get_time_ns ();
+		status = producer->log->create_entry (producer->log, (uint8_t*) &entry, sizeof (entry));
+		producer->latency[i] = bench_get_time_ns () - start;
+
+		if ((status != 0) && (producer->status == 0)) {
+			producer->status = status;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Run one burst of concurrent entry creation, then wait for the flush task to move every entry to
+ * the flash log.  Only the time producers spend creating entries is counted toward the producer
+ * metrics, but the operation time covers the full burst being stored.
+ */
+static int logging_ring_bench_burst (void *context)
+{
+	struct logging_ring_bench *bench = context;
+	pthread_t thread[LOGGING_RING_BENCH_PRODUCERS];
+	uint64_t *latency;
+	uint64_t start;
+	uint32_t expected;
+	int waited = 0;
+	int i;
+	int status;
+
+	latency = &bench->latency[(bench->bursts % LOGGING_RING_BENCH_SAMPLE_BURSTS) *
+		LOGGING_RING_BENCH_BURST_ENTRIES];
+
+	start = bench_get_time_ns ();
+
+	for (i = 0; i < LOGGING_RING_BENCH_PRODUCERS; i++) {
+		bench->producer[i].log = bench->log;
+		bench->producer[i].id = i;
+		bench->producer[i].latency = &latency[i * LOGGING_RING_BENCH_BURST];
+
+		status = pthread_create (&thread[i], NULL, logging_ring_bench_producer_task,
+			&bench->producer[i]);
+		if (status != 0) {
+			return LOGGING_NO_MEMORY;
+		}
+	}
+
+	for (i = 0; i < LOGGING_RING_BENCH_PRODUCERS; i++) {
+		pthread_join (thread[i], NULL);
+	}
+
+	bench->producer_ns += bench_get_time_ns () - start;
+	bench->created += LOGGING_RING_BENCH_BURST_ENTRIES;
+	bench->bursts++;
+
+	for (i = 0; i < LOGGING_RING_BENCH_PRODUCERS; i++) {
+		if (bench->producer[i].status != 0) {
+			return bench->producer[i].status;
+		}
+	}
+
+	/* Entries buffered in the ring are stored by the flush task. */
+	expected = bench->first_id + bench->created;
+	while (platform_atomic_load (&bench->target_state.next_entry_id) != expected) {
+		if (waited++ == LOGGING_RING_BENCH_DRAIN_TIMEOUT_MS) {
+			return LOGGING_INCOMPLETE_FLUSH;
+		}
+
+		platform_msleep (1);
+	}
+
+	return 0;
+}
+
+
+static const struct bench_case logging_ring_bench_cases[] = {
+	{
+		"burst_logging_flash", logging_ring_bench_setup_flash, logging_ring_bench_burst,
+		logging_ring_bench_teardown,
+		LOGGING_RING_BENCH_BURST_ENTRIES * sizeof (struct debug_log_entry_info)
+	},
+	{
+		"burst_ring", logging_ring_bench_setup_ring, logging_ring_bench_burst,
+		logging_ring_bench_teardown,
+		LOGGING_RING_BENCH_BURST_ENTRIES * sizeof (struct debug_log_entry_info)
+	},
+	{
+		"burst_small_ring", logging_ring_bench_setup_small_ring, logging_ring_bench_burst,
+		logging_ring_bench_teardown,
+		LOGGING_RING_BENCH_BURST_ENTRIES * sizeof (struct debug_log_entry_info)
+	},
+};
+
+const struct bench_suite logging_ring_bench_suite =
+	BENCH_SUITE ("logging_ring", logging_ring_bench_cases);
@@ -0,0 +1,248 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "flash/flash_virtual_ram.h"
+#include "manifest/pfm/pfm_flash.h"
+#include "testing/engines/hash_testing_engine.h"
+#include "testing/manifest/pfm/pfm_flash_v2_testing.h"
+
+
+/**
+ * Address of the PFM in flash.
+ */
+#define	PFM_FLASH_BENCH_ADDR			0x10000
+
+/**
+ * Size of the flash that contains the PFM.
+ */
+#define	PFM_FLASH_BENCH_FLASH_SIZE		0x20000
+
+
+/**
+ * Context for PFM parsing benchmarks.
+ */
+struct pfm_flash_bench {
+	HASH_TESTING_ENGINE hash;									/**< Hash engine for manifest validation. */
+	struct signature_verification verification;					/**< Manifest signature verification. */
+	struct flash_virtual_ram_state flash_state;					/**< Variable context for the flash. */
+	struct flash_virtual_ram flash;								/**< Flash that contains the PFM. */
+	uint8_t flash_buffer[PFM_FLASH_BENCH_FLASH_SIZE];			/**< Storage for the flash. */
+	uint8_t signature[512];										/**< Buffer for the manifest signature. */
+	uint8_t platform_id[256];									/**< Cache for the platform ID. */
+	struct manifest_toc_entry toc_cache[MANIFEST_MAX_ENTRIES];	/**< Cache for TOC entries. */
+	uint8_t toc_hash_cache[MANIFEST_MAX_ENTRIES * SHA512_HASH_LENGTH];	/**< Cache for TOC hashes. */
+	struct pfm_flash pfm;										/**< The PFM being measured. */
+};
+
+
+/*
+ * The PFM test data is not signed with a key available to the benchmarks, so signature checks
+ * always pass.  This measures manifest parsing and hashing only.  The cost of the signature itself
+ * is covered by the signature verification benchmarks.
+ */
+
+static int pfm_flash_bench_verify_signature (const struct signature_verification *verification,
+	const uint8_t *digest, size_t length, const uint8_t *signature, size_t sig_length)
+{
+	return 0;
+}
+
+static int pfm_flash_bench_set_verification_key (const struct signature_verification *verification,
+	const uint8_t *key, size_t length)
+{
+	return 0;
+}
+
+static int pfm_flash_bench_is_key_valid (const struct signature_verification *verification,
+	const uint8_t *key, size_t length)
+{
+	return 0;
+}
+
+/**
+ * Create the context for a PFM benchmark.  The PFM will be verified before the benchmark starts.
+ *
+ * @param context Output for the benchmark context.
+ * @param toc_cache Flag to enable the table of contents cache for the PFM.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int pfm_flash_bench_setup (void **context, bool toc_cache)
+{
+	struct pfm_flash_bench *bench;
+	int status;
+
+	bench = calloc (1, sizeof (struct pfm_flash_bench));
+	if (bench == NULL) {
+		return PFM_NO_MEMORY;
+	}
+
+	memset (bench->flash_buffer, 0xff, sizeof (bench->flash_buffer));
+	memcpy (&bench->flash_buffer[PFM_FLASH_BENCH_ADDR], PFM_V2.manifest.raw,
+		PFM_V2.manifest.length);
+
+	bench->verification.verify_signature = pfm_flash_bench_verify_signature;
+	bench->verification.set_verification_key = pfm_flash_bench_set_verification_key;
+	bench->verification.is_key_valid = pfm_flash_bench_is_key_valid;
+
+	status = HASH_TESTING_ENGINE_INIT (&bench->hash);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = flash_virtual_ram_init (&bench->flash, &bench->flash_state, bench->flash_buffer,
+		sizeof (bench->flash_buffer));
+	if (status != 0) {
+		goto release_hash;
+	}
+
+	status = pfm_flash_init (&bench->pfm, &bench->flash.base, &bench->hash.base,
+		PFM_FLASH_BENCH_ADDR, bench->signature, sizeof (bench->signature), bench->platform_id,
+		sizeof (bench->platform_id));
+	if (status != 0) {
+		goto release_flash;
+	}
+
+	if (toc_cache) {
+		status = manifest_flash_enable_toc_cache (&bench->pfm.base_flash, bench->toc_cache,
+			MANIFEST_MAX_ENTRIES, bench->toc_hash_cache, sizeof (bench->toc_hash_cache));
+		if (status != 0) {
+			goto release_pfm;
+		}
+	}
+
+	status = bench->pfm.base.base.verify (&bench->pfm.base.base, &bench->hash.base,
+		&bench->verification, NULL, 0);
+	if (status != 0) {
+		goto release_pfm;
+	}
+
+	*context = bench;
+
+	return 0;
+
+release_pfm:
+	pfm_flash_release (&bench->pfm);
+release_flash:
+	flash_virtual_ram_release (&bench->flash);
+release_hash:
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int pfm_flash_bench_setup_flash (void **context)
+{
+	return pfm_flash_bench_setup (context, false);
+}
+
+static int pfm_flash_bench_setup_toc_cache (void **context)
+{
+	return pfm_flash_bench_setup (context, true);
+}
+
+static void pfm_flash_bench_teardown (void *context)
+{
+	struct pfm_flash_bench *bench = context;
+
+	pfm_flash_release (&bench->pfm);
+	flash_virtual_ram_release (&bench->flash);
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+	free (bench);
+}
+
+static int pfm_flash_bench_verify (void *context)
+{
+	struct pfm_flash_bench *bench = context;
+
+	return bench->pfm.base.base.verify (&bench->pfm.base.base, &bench->hash.base,
+		&bench->verification, NULL, 0);
+}
+
+static int pfm_flash_bench_get_firmware (void *context)
+{
+	struct pfm_flash_bench *bench = context;
+	struct pfm_firmware fw;
+	int status;
+
+	status = bench->pfm.base.get_firmware (&bench->pfm.base, &fw);
+	if (status == 0) {
+		bench->pfm.base.free_firmware (&bench->pfm.base, &fw);
+	}
+
+	return status;
+}
+
+static int pfm_flash_bench_get_supported_versions (void *context)
+{
+	struct pfm_flash_bench *bench = context;
+	struct pfm_firmware_versions versions;
+	int status;
+
+	status = bench->pfm.base.get_supported_versions (&bench->pfm.base, PFM_V2.fw[0].fw_id_str,
+		&versions);
+	if (status == 0) {
+		bench->pfm.base.free_fw_versions (&bench->pfm.base, &versions);
+	}
+
+	return status;
+}
+
+static int pfm_flash_bench_get_firmware_images (void *context)
+{
+	struct pfm_flash_bench *bench = context;
+	struct pfm_image_list img_list;
+	int status;
+
+	status = bench->pfm.base.get_firmware_images (&bench->pfm.base, PFM_V2.fw[0].fw_id_str,
+		PFM_V2.fw[0].version[0].version_str, &img_list);
+	if (status == 0) {
+		bench->pfm.base.free_firmware_images (&bench->pfm.base, &img_list);
+	}
+
+	return status;
+}
+
+
+static const struct bench_case pfm_flash_bench_cases[] = {
+	{
+		"verify", pfm_flash_bench_setup_flash, pfm_flash_bench_verify, pfm_flash_bench_teardown, 0
+	},
+	{
+		"verify_toc_cache", pfm_flash_bench_setup_toc_cache, pfm_flash_bench_verify,
+		pfm_flash_bench_teardown, 0
+	},
+	{
+		"get_firmware", pfm_flash_bench_setup_flash, pfm_flash_bench_get_firmware,
+		pfm_flash_bench_teardown, 0
+	},
+	{
+		"get_firmware_toc_cache", pfm_flash_bench_setup_toc_cache, pfm_flash_bench_get_firmware,
+		pfm_flash_bench_teardown, 0
+	},
+	{
+		"get_supported_versions", pfm_flash_bench_setup_flash,
+		pfm_flash_bench_get_supported_versions, pfm_flash_bench_teardown, 0
+	},
+	{
+		"get_supported_versions_toc_cache", pfm_flash_bench_setup_toc_cache,
+		pfm_flash_bench_get_supported_versions, pfm_flash_bench_teardown, 0
+	},
+	{
+		"get_firmware_images", pfm_flash_bench_setup_flash, pfm_flash_bench_get_firmware_images,
+		pfm_flash_bench_teardown, 0
+	},
+	{
+		"get_firmware_images_toc_cache", pfm_flash_bench_setup_toc_cache,
+		pfm_flash_bench_get_firmware_images, pfm_flash_bench_teardown, 0
+	},
+};
+
+const struct bench_suite pfm_flash_bench_suite = BENCH_SUITE ("pfm_flash", pfm_flash_bench_cases);
@@ -0,0 +1,255 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "cmd_interface/cmd_interface_multi_handler.h"
+#include "cmd_interface/device_manager.h"
+#include "crypto/checksum.h"
+#include "mctp/mctp_base_protocol.h"
+#include "mctp/mctp_interface.h"
+
+
+/**
+ * SMBus address of the device processing packets.
+ */
+#define	MCTP_INTERFACE_BENCH_SELF_ADDR		0x5d
+
+/**
+ * SMBus address of the device sending requests.
+ */
+#define	MCTP_INTERFACE_BENCH_REQ_ADDR		0x55
+
+/**
+ * Payload size for each request packet.
+ */
+#define	MCTP_INTERFACE_BENCH_PKT_PAYLOAD	MCTP_BASE_PROTOCOL_MIN_TRANSMISSION_UNIT
+
+/**
+ * Maximum number of packets in a request.
+ */
+#define	MCTP_INTERFACE_BENCH_MAX_PACKETS	\
+	((MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY + MCTP_INTERFACE_BENCH_PKT_PAYLOAD - 1) / \
+		MCTP_INTERFACE_BENCH_PKT_PAYLOAD)
+
+
+/**
+ * Context for MCTP packet processing benchmarks.
+ */
+struct mctp_interface_bench {
+	struct cmd_interface_multi_handler req_handler;					/**< Handler for request messages. */
+	struct device_manager device_mgr;								/**< Device manager for the interface. */
+	struct mctp_interface_state state;								/**< Variable context for the interface. */
+	struct mctp_interface mctp;										/**< The MCTP interface being measured. */
+	struct cmd_packet request[MCTP_INTERFACE_BENCH_MAX_PACKETS];	/**< Packets for the request message. */
+	size_t packets;													/**< Number of packets in the request. */
+	struct cmd_packet rx;											/**< Buffer for the packet being processed. */
+};
+
+
+/**
+ * Accept all message types.
+ */
+static int mctp_interface_bench_is_message_type_supported (
+	const struct cmd_interface_multi_handler *intf, uint32_t message_type)
+{
+	return 0;
+}
+
+/**
+ * Respond to every request with the same message.  This isolates the cost of message assembly and
+ * response packetization from any command processing.
+ */
+static int mctp_interface_bench_process_request (const struct cmd_interface *intf,
+	struct cmd_interface_msg *request)
+{
+	return 0;
+}
+
+/**
+ * Build the packets for a vendor defined request message.
+ *
+ * @param bench The benchmark context to update with the request packets.
+ * @param length The total length of the MCTP message, including the message type.
+ */
+static void mctp_interface_bench_build_request (struct mctp_interface_bench *bench, size_t length)
+{
+	struct mctp_base_protocol_transport_header *header;
+	struct cmd_packet *packet;
+	size_t offset = 0;
+	size_t payload_len;
+	size_t i;
+
+	bench->packets = (length + MCTP_INTERFACE_BENCH_PKT_PAYLOAD - 1) /
+		MCTP_INTERFACE_BENCH_PKT_PAYLOAD;
+
+	for (i = 0; i < bench->packets; i++, offset += payload_len) {
+		packet = &bench->request[i];
+		header = (struct mctp_base_protocol_transport_header*) packet->data;
+
+		payload_len = length - offset;
+		if (payload_len > MCTP_INTERFACE_BENCH_PKT_PAYLOAD) {
+			payload_len = MCTP_INTERFACE_BENCH_PKT_PAYLOAD;
+		}
+
+		memset (packet, 0, sizeof (*packet));
+
+		header->cmd_code = SMBUS_CMD_CODE_MCTP;
+		header->source_addr = (MCTP_INTERFACE_BENCH_REQ_ADDR << 1) | 1;
+		header->header_version = 1;
+		header->destination_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+		header->source_eid = MCTP_BASE_PROTOCOL_BMC_EID;
+		header->som = (i == 0);
+		header->eom = (i == (bench->packets - 1));
+		header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
+		header->msg_tag = 0;
+		header->packet_seq = i % 4;
+
+		memset (&packet->data[sizeof (*header)], offset, payload_len);
+		if (i == 0) {
+			packet->data[sizeof (*header)] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+		}
+
+		packet->pkt_size = sizeof (*header) + payload_len + MCTP_BASE_PROTOCOL_PEC_SIZE;
+		header->byte_count = packet->pkt_size - MCTP_BASE_PROTOCOL_SMBUS_OVERHEAD;
+		packet->data[packet->pkt_size - 1] = checksum_crc8 (MCTP_INTERFACE_BENCH_SELF_ADDR << 1,
+			packet->data, packet->pkt_size - 1);
+		packet->dest_addr = MCTP_INTERFACE_BENCH_SELF_ADDR;
+	}
+}
+
+/**
+ * Create the context for an MCTP benchmark.
+ *
+ * @param context Output for the benchmark context.
+ * @param length Length of the request message.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int mctp_interface_bench_setup (void **context, size_t length)
+{
+	struct mctp_interface_bench *bench;
+	struct device_manager_full_capabilities capabilities;
+	int status;
+
+	bench = calloc (1, sizeof (struct mctp_interface_bench));
+	if (bench == NULL) {
+		return MCTP_BASE_PROTOCOL_NO_MEMORY;
+	}
+
+	bench->req_handler.base.process_request = mctp_interface_bench_process_request;
+	bench->req_handler.is_message_type_supported = mctp_interface_bench_is_message_type_supported;
+
+	status = device_manager_init (&bench->device_mgr, 2, 0, 0, DEVICE_MANAGER_AC_ROT_MODE,
+		DEVICE_MANAGER_SLAVE_BUS_ROLE, 1000, 1000, 1000, 0, 0, 0, 0);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = device_manager_update_not_attestable_device_entry (&bench->device_mgr, 0,
+		MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID, MCTP_INTERFACE_BENCH_SELF_ADDR,
+		DEVICE_MANAGER_NOT_PCD_COMPONENT);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	status = device_manager_update_not_attestable_device_entry (&bench->device_mgr, 1,
+		MCTP_BASE_PROTOCOL_BMC_EID, MCTP_INTERFACE_BENCH_REQ_ADDR,
+		DEVICE_MANAGER_NOT_PCD_COMPONENT);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	device_manager_get_device_capabilities (&bench->device_mgr, 0, &capabilities);
+	capabilities.request.hierarchy_role = DEVICE_MANAGER_PA_ROT_MODE;
+
+	status = device_manager_update_device_capabilities (&bench->device_mgr, 0, &capabilities);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	status = mctp_interface_init (&bench->mctp, &bench->state, &bench->req_handler,
+		&bench->device_mgr, NULL, NULL, NULL, NULL);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	mctp_interface_bench_build_request (bench, length);
+
+	*context = bench;
+
+	return 0;
+
+release_device_mgr:
+	device_manager_release (&bench->device_mgr);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int mctp_interface_bench_setup_small (void **context)
+{
+	return mctp_interface_bench_setup (context, 16);
+}
+
+static int mctp_interface_bench_setup_1k (void **context)
+{
+	return mctp_interface_bench_setup (context, 1024);
+}
+
+static int mctp_interface_bench_setup_4k (void **context)
+{
+	return mctp_interface_bench_setup (context, MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY);
+}
+
+static void mctp_interface_bench_teardown (void *context)
+{
+	struct mctp_interface_bench *bench = context;
+
+	mctp_interface_release (&bench->mctp);
+	device_manager_release (&bench->device_mgr);
+	free (bench);
+}
+
+static int mctp_interface_bench_process_message (void *context)
+{
+	struct mctp_interface_bench *bench = context;
+	struct cmd_message *tx = NULL;
+	size_t i;
+	int status;
+
+	for (i = 0; i < bench->packets; i++) {
+		/* Packet processing is allowed to modify the received packet. */
+		memcpy (&bench->rx, &bench->request[i], sizeof (bench->rx));
+
+		status = mctp_interface_process_packet (&bench->mctp, &bench->rx, &tx);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	return (tx != NULL) ? 0 : MCTP_BASE_PROTOCOL_INVALID_MSG;
+}
+
+
+static const struct bench_case mctp_interface_bench_cases[] = {
+	{
+		"request_response_16", mctp_interface_bench_setup_small,
+		mctp_interface_bench_process_message, mctp_interface_bench_teardown, 16
+	},
+	{
+		"request_response_1k", mctp_interface_bench_setup_1k, mctp_interface_bench_process_message,
+		mctp_interface_bench_teardown, 1024
+	},
+	{
+		"request_response_4k", mctp_interface_bench_setup_4k, mctp_interface_bench_process_message,
+		mctp_interface_bench_teardown, MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY
+	},
+};
+
+const struct bench_suite mctp_interface_bench_suite =
+	BENCH_SUITE ("mctp_interface", mctp_interface_bench_cases);
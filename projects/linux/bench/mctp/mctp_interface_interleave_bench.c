@@ -0,0 +1,337 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "cmd_interface/cmd_interface_multi_handler.h"
+#include "cmd_interface/device_manager.h"
+#include "crypto/checksum.h"
+#include "mctp/mctp_base_protocol.h"
+#include "mctp/mctp_interface.h"
+
+
+/**
+ * Number of endpoints sending requests at the same time, such as devices behind an MCTP bridge.
+ */
+#define	MCTP_INTERFACE_INTERLEAVE_BENCH_ENDPOINTS	8
+
+/**
+ * Length of each request message.
+ */
+#define	MCTP_INTERFACE_INTERLEAVE_BENCH_MSG_LENGTH	1024
+
+/**
+ * Payload size for each request packet.
+ */
+#define	MCTP_INTERFACE_INTERLEAVE_BENCH_PKT_PAYLOAD	MCTP_BASE_PROTOCOL_MIN_TRANSMISSION_UNIT
+
+/**
+ * Number of packets in each request message.
+ */
+#define	MCTP_INTERFACE_INTERLEAVE_BENCH_PACKETS		\
+	((MCTP_INTERFACE_INTERLEAVE_BENCH_MSG_LENGTH + \
+		MCTP_INTERFACE_INTERLEAVE_BENCH_PKT_PAYLOAD - 1) / \
+		MCTP_INTERFACE_INTERLEAVE_BENCH_PKT_PAYLOAD)
+
+/**
+ * SMBus address of the device processing packets.
+ */
+#define	MCTP_INTERFACE_INTERLEAVE_BENCH_SELF_ADDR	0x5d
+
+/**
+ * SMBus address of the bridge forwarding requests from every endpoint.
+ */
+#define	MCTP_INTERFACE_INTERLEAVE_BENCH_REQ_ADDR	0x55
+
+/**
+ * EID of the first endpoint.  Other endpoints use the following EIDs.
+ */
+#define	MCTP_INTERFACE_INTERLEAVE_BENCH_REQ_EID		0x20
+
+
+/**
+ * Context for MCTP message interleaving benchmarks.
+ */
+struct mctp_interface_interleave_bench {
+	struct cmd_interface_multi_handler req_handler;	/**< Handler for request messages. */
+	struct device_manager device_mgr;				/**< Device manager for the interface. */
+	struct mctp_interface_state state;				/**< Variable context for the interface. */
+	struct mctp_interface mctp;						/**< The MCTP interface being measured. */
+	struct cmd_packet rx;							/**< Buffer for the packet being processed. */
+	bool interleave;								/**< Flag to interleave packets from endpoints. */
+	uint64_t sent;									/**< Number of request messages sent. */
+	uint64_t completed;								/**< Number of request messages processed. */
+	uint64_t elapsed_ns;							/**< Total time spent processing packets. */
+
+	/**
+	 * Packets for the request message sent by each endpoint.
+	 */
+	struct cmd_packet request[MCTP_INTERFACE_INTERLEAVE_BENCH_ENDPOINTS][
+		MCTP_INTERFACE_INTERLEAVE_BENCH_PACKETS];
+};
+
+
+/**
+ * Accept all message types.
+ */
+static int mctp_interface_interleave_bench_is_message_type_supported (
+	const struct cmd_interface_multi_handler *intf, uint32_t message_type)
+{
+	return 0;
+}
+
+/**
+ * Count each complete request and respond with the same message.
+ */
+static int mctp_interface_interleave_bench_process_request (const struct cmd_interface *intf,
+	struct cmd_interface_msg *request)
+{
+	struct mctp_interface_interleave_bench *bench = (struct mctp_interface_interleave_bench*) intf;
+
+	bench->completed++;
+
+	return 0;
+}
+
+/**
+ * Build the packets for a vendor defined request message sent by one endpoint.
+ *
+ * @param packets Output for the request packets.
+ * @param src_eid EID of the endpoint sending the request.
+ */
+static void mctp_interface_interleave_bench_build_request (struct cmd_packet *packets,
+	uint8_t src_eid)
+{
+	struct mctp_base_protocol_transport_header *header;
+	struct cmd_packet *packet;
+	size_t offset = 0;
+	size_t payload_len;
+	size_t i;
+
+	for (i = 0; i < MCTP_INTERFACE_INTERLEAVE_BENCH_PACKETS; i++, offset += payload_len) {
+		packet = &packets[i];
+		header = (struct mctp_base_protocol_transport_header*) packet->data;
+
+		payload_len = MCTP_INTERFACE_INTERLEAVE_BENCH_MSG_LENGTH - offset;
+		if (payload_len > MCTP_INTERFACE_INTERLEAVE_BENCH_PKT_PAYLOAD) {
+			payload_len = MCTP_INTERFACE_INTERLEAVE_BENCH_PKT_PAYLOAD;
+		}
+
+		memset (packet, 0, sizeof (*packet));
+
+		header->cmd_code = SMBUS_CMD_CODE_MCTP;
+		header->source_addr = (MCTP_INTERFACE_INTERLEAVE_BENCH_REQ_ADDR << 1) | 1;
+		header->header_version = 1;
+		header->destination_eid = MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID;
+		header->source_eid = src_eid;
+		header->som = (i == 0);
+		header->eom = (i == (MCTP_INTERFACE_INTERLEAVE_BENCH_PACKETS - 1));
+		header->tag_owner = MCTP_BASE_PROTOCOL_TO_REQUEST;
+		header->msg_tag = 0;
+		header->packet_seq = i % 4;
+
+		memset (&packet->data[sizeof (*header)], offset, payload_len);
+		if (i == 0) {
+			packet->data[sizeof (*header)] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+		}
+
+		packet->pkt_size = sizeof (*header) + payload_len + MCTP_BASE_PROTOCOL_PEC_SIZE;
+		header->byte_count = packet->pkt_size - MCTP_BASE_PROTOCOL_SMBUS_OVERHEAD;
+		packet->data[packet->pkt_size - 1] =
+			checksum_crc8 (MCTP_INTERFACE_INTERLEAVE_BENCH_SELF_ADDR << 1, packet->data,
+			packet->pkt_size - 1);
+		packet->dest_addr = MCTP_INTERFACE_INTERLEAVE_BENCH_SELF_ADDR;
+	}
+}
+
+/**
+ * Create the context for an MCTP interleaving benchmark.
+ *
+ * @param context Output for the benchmark context.
+ * @param interleave true to interleave packets from every endpoint or false to send each message
+ * in full before starting the next one.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int mctp_interface_interleave_bench_setup (void **context, bool interleave)
+{
+	struct mctp_interface_interleave_bench *bench;
+	struct device_manager_full_capabilities capabilities;
+	int i;
+	int status;
+
+	bench = calloc (1, sizeof (struct mctp_interface_interleave_bench));
+	if (bench == NULL) {
+		return MCTP_BASE_PROTOCOL_NO_MEMORY;
+	}
+
+	bench->req_handler.base.process_request = mctp_interface_interleave_bench_process_request;
+	bench->req_handler.is_message_type_supported =
+		mctp_interface_interleave_bench_is_message_type_supported;
+
+	status = device_manager_init (&bench->device_mgr, 2, 0, 0, DEVICE_MANAGER_AC_ROT_MODE,
+		DEVICE_MANAGER_SLAVE_BUS_ROLE, 1000, 1000, 1000, 0, 0, 0, 0);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = device_manager_update_not_attestable_device_entry (&bench->device_mgr, 0,
+		MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID, MCTP_INTERFACE_INTERLEAVE_BENCH_SELF_ADDR,
+		DEVICE_MANAGER_NOT_PCD_COMPONENT);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	status = device_manager_update_not_attestable_device_entry (&bench->device_mgr, 1,
+		MCTP_BASE_PROTOCOL_BMC_EID, MCTP_INTERFACE_INTERLEAVE_BENCH_REQ_ADDR,
+		DEVICE_MANAGER_NOT_PCD_COMPONENT);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	device_manager_get_device_capabilities (&bench->device_mgr, 0, &capabilities);
+	capabilities.request.hierarchy_role = DEVICE_MANAGER_PA_ROT_MODE;
+
+	status = device_manager_update_device_capabilities (&bench->device_mgr, 0, &capabilities);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	status = mctp_interface_init (&bench->mctp, &bench->state, &bench->req_handler,
+		&bench->device_mgr, NULL, NULL, NULL, NULL);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	for (i = 0; i < MCTP_INTERFACE_INTERLEAVE_BENCH_ENDPOINTS; i++) {
+		mctp_interface_interleave_bench_build_request (bench->request[i],
+			MCTP_INTERFACE_INTERLEAVE_BENCH_REQ_EID + i);
+	}
+
+	bench->interleave = interleave;
+	*context = bench;
+
+	return 0;
+
+release_device_mgr:
+	device_manager_release (&bench->device_mgr);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int mctp_interface_interleave_bench_setup_sequential (void **context)
+{
+	return mctp_interface_interleave_bench_setup (context, false);
+}
+
+static int mctp_interface_interleave_bench_setup_interleaved (void **context)
+{
+	return mctp_interface_interleave_bench_setup (context, true);
+}
+
+/**
+ * Report the message drop rate and throughput and release the benchmark context.
+ */
+static void mctp_interface_interleave_bench_teardown (void *context)
+{
+	struct mctp_interface_interleave_bench *bench = context;
+
+	bench_report_metric ("assembly_contexts", MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS, "contexts");
+	if (bench->sent != 0) {
+		bench_report_metric ("drop_rate",
+			((bench->sent - bench->completed) * 100.0) / bench->sent, "%");
+	}
+	if (bench->elapsed_ns != 0) {
+		bench_report_metric ("completed_msgs_per_sec",
+			(bench->completed * 1000000000.0) / bench->elapsed_ns, "msgs/s");
+	}
+
+	mctp_interface_release (&bench->mctp);
+	device_manager_release (&bench->device_mgr);
+	free (bench);
+}
+
+/**
+ * Process a single request packet.
+ *
+ * @param bench The benchmark context.
+ * @param packet The packet to process.
+ *
+ * @return 0 if the packet was processed or an error code.
+ */
+static int mctp_interface_interleave_bench_process_packet (
+	struct mctp_interface_interleave_bench *bench, const struct cmd_packet *packet)
+{
+	struct cmd_message *tx;
+
+	/* Packet processing is allowed to modify the received packet. */
+	memcpy (&bench->rx, packet, sizeof (bench->rx));
+
+	return mctp_interface_process_packet (&bench->mctp, &bench->rx, &tx);
+}
+
+/**
+ * Receive one request message from every endpoint.  Dropped packets are not retried, so any
+ * message that loses a packet is never processed.
+ */
+static int mctp_interface_interleave_bench_receive (void *context)
+{
+	struct mctp_interface_interleave_bench *bench = context;
+	uint64_t start;
+	int i;
+	int j;
+	int status;
+
+	start = bench_get_time_ns ();
+
+	if (bench->interleave) {
+		for (j = 0; j < MCTP_INTERFACE_INTERLEAVE_BENCH_PACKETS; j++) {
+			for (i = 0; i < MCTP_INTERFACE_INTERLEAVE_BENCH_ENDPOINTS; i++) {
+				status = mctp_interface_interleave_bench_process_packet (bench,
+					&bench->request[i][j]);
+				if (status != 0) {
+					return status;
+				}
+			}
+		}
+	}
+	else {
+		for (i = 0; i < MCTP_INTERFACE_INTERLEAVE_BENCH_ENDPOINTS; i++) {
+			for (j = 0; j < MCTP_INTERFACE_INTERLEAVE_BENCH_PACKETS; j++) {
+				status = mctp_interface_interleave_bench_process_packet (bench,
+					&bench->request[i][j]);
+				if (status != 0) {
+					return status;
+				}
+			}
+		}
+	}
+
+	bench->elapsed_ns += bench_get_time_ns () - start;
+	bench->sent += MCTP_INTERFACE_INTERLEAVE_BENCH_ENDPOINTS;
+
+	return 0;
+}
+
+
+static const struct bench_case mctp_interface_interleave_bench_cases[] = {
+	{
+		"sequential_8_endpoints", mctp_interface_interleave_bench_setup_sequential,
+		mctp_interface_interleave_bench_receive, mctp_interface_interleave_bench_teardown,
+		MCTP_INTERFACE_INTERLEAVE_BENCH_ENDPOINTS * MCTP_INTERFACE_INTERLEAVE_BENCH_MSG_LENGTH
+	},
+	{
+		"interleaved_8_endpoints", mctp_interface_interleave_bench_setup_interleaved,
+		mctp_interface_interleave_bench_receive, mctp_interface_interleave_bench_teardown,
+		MCTP_INTERFACE_INTERLEAVE_BENCH_ENDPOINTS * MCTP_INTERFACE_INTERLEAVE_BENCH_MSG_LENGTH
+	},
+};
+
+const struct bench_suite mctp_interface_interleave_bench_suite =
+	BENCH_SUITE ("mctp_interface_interleave", mctp_interface_interleave_bench_cases);
@@ -0,0 +1,542 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "platform_api.h"
+#include "cmd_interface/cmd_channel.h"
+#include "cmd_interface/cmd_interface_multi_handler.h"
+#include "cmd_interface/device_manager.h"
+#include "cmd_interface/msg_transport.h"
+#include "crypto/checksum.h"
+#include "mctp/mctp_base_protocol.h"
+#include "mctp/mctp_interface.h"
+
+
+/**
+ * Number of emulated devices that respond to requests.  This matches the number of requests that
+ * can be outstanding at the same time.
+ */
+#define	MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS		MCTP_INTERFACE_MAX_OUTSTANDING_REQUESTS
+
+/**
+ * Time each emulated device takes to respond to a request, in microseconds.
+ */
+#define	MCTP_INTERFACE_REQUESTER_BENCH_LATENCY_US		500
+
+/**
+ * Length of the MCTP request and response messages.
+ */
+#define	MCTP_INTERFACE_REQUESTER_BENCH_MSG_LENGTH		16
+
+/**
+ * SMBus address of the device sending requests.
+ */
+#define	MCTP_INTERFACE_REQUESTER_BENCH_SELF_ADDR		0x5d
+
+/**
+ * SMBus address of the first responder.  Other responders use the following addresses.
+ */
+#define	MCTP_INTERFACE_REQUESTER_BENCH_RSP_ADDR			0x60
+
+/**
+ * EID of the first responder.  Other responders use the following EIDs.
+ */
+#define	MCTP_INTERFACE_REQUESTER_BENCH_RSP_EID			0x20
+
+
+/**
+ * A command channel that loops requests back as responses.  Responses are delivered to the
+ * requester after a fixed latency, emulating devices that take time to process each request.
+ */
+struct mctp_interface_requester_bench_channel {
+	struct cmd_channel base;			/**< Base command channel. */
+	struct cmd_channel_state state;		/**< Variable context for the channel. */
+	pthread_mutex_t lock;				/**< Synchronization for the response queue. */
+	pthread_cond_t ready;				/**< Signal for new responses. */
+	size_t head;						/**< Next response to deliver. */
+	size_t count;						/**< Number of queued responses. */
+	bool stop;							/**< Flag to stop receiving packets. */
+
+	/**
+	 * Responses waiting for delivery.
+	 */
+	struct cmd_packet rsp[MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS];
+
+	/**
+	 * Delivery time for each queued response.
+	 */
+	uint64_t deliver[MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS];
+};
+
+struct mctp_interface_requester_bench;
+
+/**
+ * A thread sending requests to a single responder.
+ */
+struct mctp_interface_requester_bench_worker {
+	struct mctp_interface_requester_bench *bench;			/**< The benchmark context. */
+	pthread_t thread;										/**< Thread sending requests. */
+	platform_semaphore start;								/**< Signal to send a request. */
+	uint8_t eid;											/**< EID of the responder. */
+	uint8_t request[MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN];	/**< Buffer for the request. */
+	uint8_t response[MCTP_BASE_PROTOCOL_MAX_MESSAGE_LEN];	/**< Buffer for the response. */
+	int status;												/**< Result of the last request. */
+};
+
+/**
+ * Context for benchmarks of an MCTP requester with multiple outstanding requests.
+ */
+struct mctp_interface_requester_bench {
+	struct cmd_interface_multi_handler req_handler;			/**< Handler for request messages. */
+	struct device_manager device_mgr;						/**< Device manager for the interface. */
+	struct mctp_interface_state mctp_state;					/**< Variable context for the interface. */
+	struct mctp_interface mctp;								/**< MCTP layer sending requests. */
+	struct mctp_interface_requester_bench_channel channel;	/**< Loopback channel for requests. */
+	pthread_t receiver;										/**< Thread processing responses. */
+	bool stop;												/**< Flag to stop the worker threads. */
+	platform_semaphore done;								/**< Signal for completed requests. */
+	size_t workers;											/**< Number of running worker threads. */
+
+	/**
+	 * Context for sending requests to each responder.
+	 */
+	struct mctp_interface_requester_bench_worker worker[MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS];
+};
+
+
+/**
+ * Accept all message types.
+ */
+static int mctp_interface_requester_bench_is_message_type_supported (
+	const struct cmd_interface_multi_handler *intf, uint32_t message_type)
+{
+	return 0;
+}
+
+/**
+ * Turn each request into a response from the destination device and queue it for delivery.
+ */
+static int mctp_interface_requester_bench_send_packet (const struct cmd_channel *channel,
+	const struct cmd_packet *packet)
+{
+	struct mctp_interface_requester_bench_channel *loopback =
+		(struct mctp_interface_requester_bench_channel*) channel;
+	struct mctp_base_protocol_transport_header *header;
+	struct cmd_packet *rsp;
+	uint8_t eid;
+
+	pthread_mutex_lock (&loopback->lock);
+
+	if (loopback->count == MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS) {
+		pthread_mutex_unlock (&loopback->lock);
+
+		return CMD_CHANNEL_TX_FAILED;
+	}
+
+	rsp = &loopback->rsp[(loopback->head + loopback->count) %
+		MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS];
+	memcpy (rsp, packet, sizeof (*rsp));
+
+	header = (struct mctp_base_protocol_transport_header*) rsp->data;
+	eid = header->destination_eid;
+
+	header->source_addr = (packet->dest_addr << 1) | 1;
+	header->destination_eid = header->source_eid;
+	header->source_eid = eid;
+	header->tag_owner = MCTP_BASE_PROTOCOL_TO_RESPONSE;
+
+	rsp->dest_addr = MCTP_INTERFACE_REQUESTER_BENCH_SELF_ADDR;
+	rsp->state = CMD_VALID_PACKET;
+	rsp->timeout_valid = false;
+	rsp->data[rsp->pkt_size - 1] = checksum_crc8 (MCTP_INTERFACE_REQUESTER_BENCH_SELF_ADDR << 1,
+		rsp->data, rsp->pkt_size - 1);
+
+	loopback->deliver[(loopback->head + loopback->count) %
+		MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS] =
+		bench_get_time_ns () + (MCTP_INTERFACE_REQUESTER_BENCH_LATENCY_US * 1000ULL);
+	loopback->count++;
+
+	pthread_cond_signal (&loopback->ready);
+	pthread_mutex_unlock (&loopback->lock);
+
+	return 0;
+}
+
+/**
+ * Wait for the next response and deliver it once the response latency has passed.  Every response
+ * has the same latency, so responses are delivered in the order the requests were sent.
+ */
+static int mctp_interface_requester_bench_receive_packet (const struct cmd_channel *channel,
+	struct cmd_packet *packet, int ms_timeout)
+{
+	struct mctp_interface_requester_bench_channel *loopback =
+		(struct mctp_interface_requester_bench_channel*) channel;
+	struct timespec deliver;
+	uint64_t time_ns;
+
+	pthread_mutex_lock (&loopback->lock);
+
+	while ((loopback->count == 0) && !loopback->stop) {
+		pthread_cond_wait (&loopback->ready, &loopback->lock);
+	}
+
+	if (loopback->stop) {
+		pthread_mutex_unlock (&loopback->lock);
+
+		return CMD_CHANNEL_RX_TIMEOUT;
+	}
+
+	time_ns = loopback->deliver[loopback->head];
+	pthread_mutex_unlock (&loopback->lock);
+
+	/* Only a single thread receives packets, so the queue head will not change while waiting. */
+	deliver.tv_sec = time_ns / 1000000000ULL;
+	deliver.tv_nsec = time_ns % 1000000000ULL;
+	while (clock_nanosleep (CLOCK_MONOTONIC, TIMER_ABSTIME, &deliver, NULL) != 0) {
+		/* Keep waiting if the sleep was interrupted. */
+	}
+
+	pthread_mutex_lock (&loopback->lock);
+
+	memcpy (packet, &loopback->rsp[loopback->head], sizeof (*packet));
+	loopback->head = (loopback->head + 1) % MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS;
+	loopback->count--;
+
+	pthread_mutex_unlock (&loopback->lock);
+
+	return 0;
+}
+
+/**
+ * Process responses received by the loopback channel until the benchmark is stopped.
+ *
+ * @param arg The benchmark context.
+ *
+ * @return Always null.
+ */
+static void* mctp_interface_requester_bench_receiver (void *arg)
+{
+	struct mctp_interface_requester_bench *bench = arg;
+	int status;
+
+	do {
+		status = cmd_channel_receive_and_process (&bench->channel.base, &bench->mctp, -1);
+	} while (status != CMD_CHANNEL_RX_TIMEOUT);
+
+	return NULL;
+}
+
+/**
+ * Send a single request to a responder and wait for the response.
+ *
+ * @param worker The context for the responder.
+ *
+ * @return 0 if the response was received or an error code.
+ */
+static int mctp_interface_requester_bench_send_request (
+	struct mctp_interface_requester_bench_worker *worker)
+{
+	const struct msg_transport *transport = &worker->bench->mctp.base;
+	struct cmd_interface_msg request;
+	struct cmd_interface_msg response;
+	int status;
+
+	status = msg_transport_create_empty_request (transport, worker->request,
+		sizeof (worker->request), worker->eid, &request);
+	if (status != 0) {
+		return status;
+	}
+
+	memset (request.payload, 0x55, MCTP_INTERFACE_REQUESTER_BENCH_MSG_LENGTH);
+	request.payload[0] = MCTP_BASE_PROTOCOL_MSG_TYPE_VENDOR_DEF;
+	cmd_interface_msg_set_message_payload_length (&request,
+		MCTP_INTERFACE_REQUESTER_BENCH_MSG_LENGTH);
+
+	status = msg_transport_create_empty_response (worker->response, sizeof (worker->response),
+		&response);
+	if (status != 0) {
+		return status;
+	}
+
+	return transport->send_request_message (transport, &request, 1000, &response);
+}
+
+/**
+ * Send a request each time the worker is started.
+ *
+ * @param arg The worker context.
+ *
+ * @return Always null.
+ */
+static void* mctp_interface_requester_bench_worker (void *arg)
+{
+	struct mctp_interface_requester_bench_worker *worker = arg;
+
+	while (1) {
+		platform_semaphore_wait (&worker->start, 0);
+		if (worker->bench->stop) {
+			break;
+		}
+
+		worker->status = mctp_interface_requester_bench_send_request (worker);
+		platform_semaphore_post (&worker->bench->done);
+	}
+
+	return NULL;
+}
+
+/**
+ * Stop all threads used by the benchmark.
+ *
+ * @param bench The benchmark context.
+ */
+static void mctp_interface_requester_bench_stop_threads (
+	struct mctp_interface_requester_bench *bench)
+{
+	bench->stop = true;
+
+	while (bench->workers > 0) {
+		bench->workers--;
+
+		platform_semaphore_post (&bench->worker[bench->workers].start);
+		pthread_join (bench->worker[bench->workers].thread, NULL);
+	}
+
+	pthread_mutex_lock (&bench->channel.lock);
+	bench->channel.stop = true;
+	pthread_cond_signal (&bench->channel.ready);
+	pthread_mutex_unlock (&bench->channel.lock);
+
+	pthread_join (bench->receiver, NULL);
+}
+
+/**
+ * Free the semaphores used to synchronize the worker threads.
+ *
+ * @param bench The benchmark context.
+ * @param workers The number of worker semaphores that have been initialized.
+ */
+static void mctp_interface_requester_bench_free_semaphores (
+	struct mctp_interface_requester_bench *bench, size_t workers)
+{
+	while (workers > 0) {
+		platform_semaphore_free (&bench->worker[--workers].start);
+	}
+
+	platform_semaphore_free (&bench->done);
+}
+
+/**
+ * Create the context for an MCTP requester benchmark.
+ *
+ * @param context Output for the benchmark context.
+ * @param concurrent true to send a request to each responder from a separate thread or false to
+ * send all requests from the benchmark thread.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int mctp_interface_requester_bench_setup (void **context, bool concurrent)
+{
+	struct mctp_interface_requester_bench *bench;
+	size_t i;
+	int status;
+
+	bench = calloc (1, sizeof (struct mctp_interface_requester_bench));
+	if (bench == NULL) {
+		return MCTP_BASE_PROTOCOL_NO_MEMORY;
+	}
+
+	bench->req_handler.is_message_type_supported =
+		mctp_interface_requester_bench_is_message_type_supported;
+
+	status = platform_semaphore_init (&bench->done);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	for (i = 0; i < MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS; i++) {
+		status = platform_semaphore_init (&bench->worker[i].start);
+		if (status != 0) {
+			mctp_interface_requester_bench_free_semaphores (bench, i);
+			goto free_bench;
+		}
+	}
+
+	status = device_manager_init (&bench->device_mgr, 1,
+		MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS, MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS,
+		DEVICE_MANAGER_PA_ROT_MODE, DEVICE_MANAGER_MASTER_AND_SLAVE_BUS_ROLE, 1000, 1000, 1000, 0,
+		0, 0, 0);
+	if (status != 0) {
+		goto free_semaphores;
+	}
+
+	status = device_manager_update_not_attestable_device_entry (&bench->device_mgr, 0,
+		MCTP_BASE_PROTOCOL_PA_ROT_CTRL_EID, MCTP_INTERFACE_REQUESTER_BENCH_SELF_ADDR,
+		DEVICE_MANAGER_NOT_PCD_COMPONENT);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	for (i = 0; i < MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS; i++) {
+		bench->worker[i].bench = bench;
+		bench->worker[i].eid = MCTP_INTERFACE_REQUESTER_BENCH_RSP_EID + i;
+
+		status = device_manager_update_not_attestable_device_entry (&bench->device_mgr, i + 1,
+			bench->worker[i].eid, MCTP_INTERFACE_REQUESTER_BENCH_RSP_ADDR + i,
+			DEVICE_MANAGER_NOT_PCD_COMPONENT);
+		if (status != 0) {
+			goto release_device_mgr;
+		}
+	}
+
+	bench->channel.base.send_packet = mctp_interface_requester_bench_send_packet;
+	bench->channel.base.receive_packet = mctp_interface_requester_bench_receive_packet;
+
+	status = cmd_channel_init (&bench->channel.base, &bench->channel.state, 0);
+	if (status != 0) {
+		goto release_device_mgr;
+	}
+
+	pthread_mutex_init (&bench->channel.lock, NULL);
+	pthread_cond_init (&bench->channel.ready, NULL);
+
+	status = mctp_interface_init (&bench->mctp, &bench->mctp_state, &bench->req_handler,
+		&bench->device_mgr, &bench->channel.base, NULL, NULL, NULL);
+	if (status != 0) {
+		goto release_channel;
+	}
+
+	if (pthread_create (&bench->receiver, NULL, mctp_interface_requester_bench_receiver,
+		bench) != 0) {
+		status = MCTP_BASE_PROTOCOL_NO_MEMORY;
+		goto release_mctp;
+	}
+
+	if (concurrent) {
+		for (; bench->workers < MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS; bench->workers++) {
+			if (pthread_create (&bench->worker[bench->workers].thread, NULL,
+				mctp_interface_requester_bench_worker, &bench->worker[bench->workers]) != 0) {
+				status = MCTP_BASE_PROTOCOL_NO_MEMORY;
+				goto stop_threads;
+			}
+		}
+	}
+
+	*context = bench;
+
+	return 0;
+
+stop_threads:
+	mctp_interface_requester_bench_stop_threads (bench);
+release_mctp:
+	mctp_interface_release (&bench->mctp);
+release_channel:
+	pthread_cond_destroy (&bench->channel.ready);
+	pthread_mutex_destroy (&bench->channel.lock);
+	cmd_channel_release (&bench->channel.base);
+release_device_mgr:
+	device_manager_release (&bench->device_mgr);
+free_semaphores:
+	mctp_interface_requester_bench_free_semaphores (bench,
+		MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static int mctp_interface_requester_bench_setup_sequential (void **context)
+{
+	return mctp_interface_requester_bench_setup (context, false);
+}
+
+static int mctp_interface_requester_bench_setup_concurrent (void **context)
+{
+	return mctp_interface_requester_bench_setup (context, true);
+}
+
+static void mctp_interface_requester_bench_teardown (void *context)
+{
+	struct mctp_interface_requester_bench *bench = context;
+
+	mctp_interface_requester_bench_stop_threads (bench);
+
+	mctp_interface_release (&bench->mctp);
+	pthread_cond_destroy (&bench->channel.ready);
+	pthread_mutex_destroy (&bench->channel.lock);
+	cmd_channel_release (&bench->channel.base);
+	device_manager_release (&bench->device_mgr);
+	mctp_interface_requester_bench_free_semaphores (bench,
+		MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS);
+	free (bench);
+}
+
+/**
+ * Send one request to every responder.  Requests are sent one at a time, waiting for each response
+ * before sending the next request.
+ */
+static int mctp_interface_requester_bench_request_sequential (void *context)
+{
+	struct mctp_interface_requester_bench *bench = context;
+	size_t i;
+	int status;
+
+	for (i = 0; i < MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS; i++) {
+		status = mctp_interface_requester_bench_send_request (&bench->worker[i]);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Send one request to every responder.  Each request is sent from a different thread, so all
+ * requests are outstanding at the same time.
+ */
+static int mctp_interface_requester_bench_request_concurrent (void *context)
+{
+	struct mctp_interface_requester_bench *bench = context;
+	size_t i;
+
+	for (i = 0; i < MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS; i++) {
+		platform_semaphore_post (&bench->worker[i].start);
+	}
+
+	for (i = 0; i < MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS; i++) {
+		platform_semaphore_wait (&bench->done, 0);
+	}
+
+	for (i = 0; i < MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS; i++) {
+		if (bench->worker[i].status != 0) {
+			return bench->worker[i].status;
+		}
+	}
+
+	return 0;
+}
+
+
+static const struct bench_case mctp_interface_requester_bench_cases[] = {
+	{
+		"request_all_responders_sequential", mctp_interface_requester_bench_setup_sequential,
+		mctp_interface_requester_bench_request_sequential, mctp_interface_requester_bench_teardown,
+		MCTP_INTERFACE_REQUESTER_BENCH_MSG_LENGTH * MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS
+	},
+	{
+		"request_all_responders_concurrent", mctp_interface_requester_bench_setup_concurrent,
+		mctp_interface_requester_bench_request_concurrent, mctp_interface_requester_bench_teardown,
+		MCTP_INTERFACE_REQUESTER_BENCH_MSG_LENGTH * MCTP_INTERFACE_REQUESTER_BENCH_RESPONDERS
+	},
+};
+
+const struct bench_suite mctp_interface_requester_bench_suite =
+	BENCH_SUITE ("mctp_interface_requester", mctp_interface_requester_bench_cases);
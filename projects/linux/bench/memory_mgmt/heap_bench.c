@@ -0,0 +1,233 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "memory_mgmt/heap_tlsf.h"
+#include "memory_mgmt/heap_with_defrag.h"
+
+
+/**
+ * Number of allocations that can be live at the same time during the trace.
+ */
+#define	HEAP_BENCH_SLOTS			64
+
+/**
+ * Number of allocate and free operations in the trace.
+ */
+#define	HEAP_BENCH_TRACE_LENGTH		4096
+
+/**
+ * Largest allocation made by the trace.
+ */
+#define	HEAP_BENCH_MAX_ALLOC		4096
+
+/**
+ * Size of the heap used for the trace.  This is large enough to hold every slot at the maximum
+ * allocation size, so allocations only fail if the allocator is too fragmented.
+ */
+#define	HEAP_BENCH_HEAP_SIZE		((HEAP_BENCH_SLOTS + 2) * HEAP_BENCH_MAX_ALLOC)
+
+
+/**
+ * The heap allocator API used to replay the trace.
+ */
+struct heap_bench_allocator {
+	int (*init) (const void *heap_addr, size_t heap_len);	/**< Initialize the heap. */
+	void* (*allocate) (size_t size);						/**< Allocate a block. */
+	void (*free) (void *addr);								/**< Free a block. */
+};
+
+/**
+ * A single operation in the allocation trace.
+ */
+struct heap_bench_op {
+	uint16_t slot;	/**< The allocation slot to allocate or free. */
+	uint16_t size;	/**< Size to allocate for the slot.  0 to free the slot. */
+};
+
+/**
+ * Context for heap allocator benchmarks.
+ */
+struct heap_bench {
+	const struct heap_bench_allocator *heap;				/**< The allocator being measured. */
+	struct heap_bench_op trace[HEAP_BENCH_TRACE_LENGTH];	/**< The allocation trace to replay. */
+	void *slot[HEAP_BENCH_SLOTS];							/**< Live allocations for each slot. */
+
+	/**
+	 * Memory managed by the heap.
+	 */
+	uint64_t heap_mem[HEAP_BENCH_HEAP_SIZE / sizeof (uint64_t)];
+};
+
+
+/**
+ * API for heap_with_defrag.
+ */
+static const struct heap_bench_allocator heap_bench_with_defrag = {
+	.init = heap_with_defrag_init,
+	.allocate = heap_with_defrag_allocate,
+	.free = heap_with_defrag_free
+};
+
+/**
+ * API for heap_tlsf.
+ */
+static const struct heap_bench_allocator heap_bench_tlsf = {
+	.init = heap_tlsf_init,
+	.allocate = heap_tlsf_allocate,
+	.free = heap_tlsf_free
+};
+
+
+/**
+ * Choose the size of an allocation in the trace.  The distribution approximates the allocations
+ * made while processing SPDM requests and X.509 certificates:  mostly small objects for ASN.1
+ * parsing and key contexts, some message buffers, and occasional full certificate buffers.
+ *
+ * @param seed State of the random sequence.  This will be updated with the next seed.
+ *
+ * @return The size of the allocation.
+ */
+static uint16_t heap_bench_choose_size (uint32_t *seed)
+{
+	uint32_t value;
+
+	*seed = (*seed * 1103515245) + 12345;
+	value = *seed >> 8;
+
+	switch (value % 16) {
+		case 0:
+			return 1024 + (value >> 4) % (HEAP_BENCH_MAX_ALLOC - 1024 + 1);
+
+		case 1:
+		case 2:
+		case 3:
+			return 128 + (value >> 4) % 897;
+
+		default:
+			return 8 + (value >> 4) % 121;
+	}
+}
+
+/**
+ * Create the allocation trace.  Slots are picked at random, so allocation lifetimes vary and the
+ * free blocks get interleaved with live blocks the same way they do in a long-running heap.
+ *
+ * @param bench The benchmark context to fill with the trace.
+ */
+static void heap_bench_build_trace (struct heap_bench *bench)
+{
+	bool live[HEAP_BENCH_SLOTS] = {0};
+	uint32_t seed = 0x5eed;
+	size_t i;
+
+	for (i = 0; i < HEAP_BENCH_TRACE_LENGTH; i++) {
+		seed = (seed * 1103515245) + 12345;
+		bench->trace[i].slot = (seed >> 8) % HEAP_BENCH_SLOTS;
+
+		if (live[bench->trace[i].slot]) {
+			bench->trace[i].size = 0;
+			live[bench->trace[i].slot] = false;
+		}
+		else {
+			bench->trace[i].size = heap_bench_choose_size (&seed);
+			live[bench->trace[i].slot] = true;
+		}
+	}
+}
+
+/**
+ * Create the context for a heap benchmark.
+ *
+ * @param context Output for the benchmark context.
+ * @param heap The allocator to measure.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int heap_bench_setup (void **context, const struct heap_bench_allocator *heap)
+{
+	struct heap_bench *bench;
+
+	bench = calloc (1, sizeof (struct heap_bench));
+	if (bench == NULL) {
+		return HEAP_WITH_DEFRAG_NO_MEMORY;
+	}
+
+	bench->heap = heap;
+	heap_bench_build_trace (bench);
+
+	*context = bench;
+
+	return 0;
+}
+
+static int heap_bench_setup_with_defrag (void **context)
+{
+	return heap_bench_setup (context, &heap_bench_with_defrag);
+}
+
+static int heap_bench_setup_tlsf (void **context)
+{
+	return heap_bench_setup (context, &heap_bench_tlsf);
+}
+
+static void heap_bench_teardown (void *context)
+{
+	free (context);
+}
+
+/**
+ * Replay the full allocation trace on an empty heap, then free every remaining allocation.
+ */
+static int heap_bench_replay (void *context)
+{
+	struct heap_bench *bench = context;
+	const struct heap_bench_op *op;
+	size_t i;
+	int status;
+
+	status = bench->heap->init (bench->heap_mem, sizeof (bench->heap_mem));
+	if (status != 0) {
+		return status;
+	}
+
+	for (i = 0; i < HEAP_BENCH_TRACE_LENGTH; i++) {
+		op = &bench->trace[i];
+
+		if (op->size != 0) {
+			bench->slot[op->slot] = bench->heap->allocate (op->size);
+			if (bench->slot[op->slot] == NULL) {
+				return HEAP_WITH_DEFRAG_NO_MEMORY;
+			}
+		}
+		else {
+			bench->heap->free (bench->slot[op->slot]);
+			bench->slot[op->slot] = NULL;
+		}
+	}
+
+	for (i = 0; i < HEAP_BENCH_SLOTS; i++) {
+		if (bench->slot[i] != NULL) {
+			bench->heap->free (bench->slot[i]);
+			bench->slot[i] = NULL;
+		}
+	}
+
+	return 0;
+}
+
+
+static const struct bench_case heap_bench_cases[] = {
+	{
+		"replay_trace_with_defrag", heap_bench_setup_with_defrag, heap_bench_replay,
+		heap_bench_teardown, 0
+	},
+	{
+		"replay_trace_tlsf", heap_bench_setup_tlsf, heap_bench_replay, heap_bench_teardown, 0
+	},
+};
+
+const struct bench_suite heap_bench_suite = BENCH_SUITE ("heap", heap_bench_cases);
@@ -0,0 +1,718 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "cmd_interface/cmd_background_handler.h"
+#include "common/array_size.h"
+#include "keystore/keystore_null.h"
+#include "mctp/mctp_base_protocol.h"
+#include "mctp/mctp_control_protocol.h"
+#include "mctp/mctp_control_protocol_commands.h"
+#include "riot/riot_key_manager.h"
+#include "spdm/cmd_interface_spdm_responder.h"
+#include "spdm/spdm_commands.h"
+#include "spdm/spdm_transcript_manager.h"
+#include "system/event_task_linux.h"
+#include "system/system.h"
+#include "testing/crypto/ecc_testing.h"
+#include "testing/engines/ecc_testing_engine.h"
+#include "testing/engines/hash_testing_engine.h"
+#include "testing/engines/rng_testing_engine.h"
+#include "testing/engines/x509_testing_engine.h"
+#include "testing/riot/riot_core_testing.h"
+
+
+/**
+ * Number of hash engines needed by the transcript manager.
+ */
+#define	SPDM_COMMANDS_BENCH_TRANSCRIPT_HASH		SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT
+
+/**
+ * Number of certificate chain digests that can be cached by the key manager.
+ */
+#define	SPDM_COMMANDS_BENCH_DIGEST_CACHE		2
+
+/**
+ * Time between receiving the response to an MCTP control request and sending the next one, in
+ * microseconds.
+ */
+#define	SPDM_COMMANDS_BENCH_CONTROL_INTERVAL_US	250
+
+/**
+ * Number of MCTP control request latency measurements that are kept.
+ */
+#define	SPDM_COMMANDS_BENCH_CONTROL_SAMPLES		4096
+
+/**
+ * Longest time the requester waits before retrying a deferred response, in microseconds.  Until a
+ * signature has been timed, the responder reports the maximum cryptographic timeout.
+ */
+#define	SPDM_COMMANDS_BENCH_MAX_RETRY_US		1000
+
+
+/**
+ * An MCTP requester that periodically sends control requests to the device while SPDM requests
+ * are being processed.  Only one control request is outstanding at a time.
+ */
+struct spdm_commands_bench_control {
+	pthread_t thread;			/**< Thread sending control requests. */
+	bool started;				/**< Flag to indicate the requester thread has been created. */
+	bool stop;					/**< Flag to tell the requester to stop sending requests. */
+	pthread_mutex_t lock;		/**< Synchronization with the thread processing requests. */
+	pthread_cond_t received;	/**< Signal for a new control request. */
+	pthread_cond_t responded;	/**< Signal for a completed control request. */
+	bool pending;				/**< Flag for a control request waiting for a response. */
+	size_t length;				/**< Length of the pending control request. */
+	uint64_t arrival;			/**< Time the pending control request was received. */
+	uint64_t count;				/**< Number of control requests that have been completed. */
+
+	/**
+	 * Buffer for the control request and response.
+	 */
+	uint8_t buffer[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];
+
+	/**
+	 * Time from receiving a control request until the response was ready, in nanoseconds.
+	 */
+	uint64_t latency[SPDM_COMMANDS_BENCH_CONTROL_SAMPLES];
+};
+
+
+/**
+ * Context for SPDM command processing benchmarks.
+ */
+struct spdm_commands_bench {
+	HASH_TESTING_ENGINE hash;														/**< Hash engine for the responder. */
+	struct hash_engine *hash_engine;												/**< List of responder hash engines. */
+	HASH_TESTING_ENGINE transcript_hash[SPDM_COMMANDS_BENCH_TRANSCRIPT_HASH];		/**< Hash engines for the transcript. */
+	struct hash_engine *transcript_engine[SPDM_COMMANDS_BENCH_TRANSCRIPT_HASH];		/**< List of transcript hash engines. */
+	X509_TESTING_ENGINE x509;														/**< X.509 engine for the key manager. */
+	ECC_TESTING_ENGINE ecc;															/**< ECC engine for response signatures. */
+	RNG_TESTING_ENGINE rng;															/**< RNG engine for response nonces. */
+	struct keystore_null keystore;													/**< Keystore with no signed certificates. */
+	struct riot_key_manager key_manager;											/**< Manager for the device certificates. */
+	struct riot_key_manager_digest digest_cache[SPDM_COMMANDS_BENCH_DIGEST_CACHE];	/**< Storage for cached digests. */
+	struct spdm_transcript_manager_state transcript_state;							/**< Variable context for the transcript. */
+	struct spdm_transcript_manager transcript;										/**< Transcript manager for the responder. */
+	struct spdm_device_capability capabilities;										/**< Local device capabilities. */
+	struct spdm_state state;														/**< SPDM connection state. */
+	struct cmd_interface_spdm_responder responder;									/**< Responder processing the requests. */
+	struct system system;															/**< Placeholder system manager. */
+	struct cmd_background_handler_state background_state;							/**< Variable context for the background handler. */
+	struct cmd_background_handler background;										/**< Background handler generating signatures. */
+	const struct event_task_handler *task_handlers[1];								/**< Handlers for the background task. */
+	struct event_task_linux_state task_state;										/**< Variable context for the background task. */
+	struct event_task_linux task;													/**< Task executing background operations. */
+	bool async;																		/**< Flag to indicate the background task is running. */
+	struct ecc_engine_thread_safe ecc_async;										/**< ECC engine shared with the background task. */
+	struct spdm_commands_bench_control control;										/**< Requester sending MCTP control requests. */
+	uint8_t deferred[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];							/**< Buffer for responses waiting on a signature. */
+	uint8_t buffer[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];							/**< Buffer for processing messages. */
+};
+
+
+/**
+ * Create the context for a SPDM command benchmark.  The responder uses the RIoT Core test
+ * certificates with a P-384 alias key and has negotiated SHA-384 and ECDSA P-384 with the requester.
+ *
+ * @param context Output for the benchmark context.
+ * @param digest_cache Flag to enable caching of certificate chain digests.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int spdm_commands_bench_setup (void **context, bool digest_cache)
+{
+	struct spdm_commands_bench *bench;
+	struct riot_keys keys;
+	size_t i;
+	int status;
+
+	bench = calloc (1, sizeof (struct spdm_commands_bench));
+	if (bench == NULL) {
+		return CMD_HANDLER_SPDM_RESPONDER_NO_MEMORY;
+	}
+
+	status = HASH_TESTING_ENGINE_INIT (&bench->hash);
+	status |= X509_TESTING_ENGINE_INIT (&bench->x509);
+	status |= ECC_TESTING_ENGINE_INIT (&bench->ecc);
+	status |= RNG_TESTING_ENGINE_INIT (&bench->rng);
+	bench->hash_engine = &bench->hash.base;
+
+	for (i = 0; i < ARRAY_SIZE (bench->transcript_hash); i++) {
+		status |= HASH_TESTING_ENGINE_INIT (&bench->transcript_hash[i]);
+		bench->transcript_engine[i] = &bench->transcript_hash[i].base;
+	}
+
+	if (status != 0) {
+		goto release_engines;
+	}
+
+	status = keystore_null_init (&bench->keystore);
+	if (status != 0) {
+		goto release_engines;
+	}
+
+	keys.devid_csr = RIOT_CORE_DEVID_CSR;
+	keys.devid_csr_length = RIOT_CORE_DEVID_CSR_LEN;
+	keys.devid_cert = RIOT_CORE_DEVID_CERT;
+	keys.devid_cert_length = RIOT_CORE_DEVID_CERT_LEN;
+	keys.alias_key = ECC384_PRIVKEY_DER;
+	keys.alias_key_length = ECC384_PRIVKEY_DER_LEN;
+	keys.alias_cert = RIOT_CORE_ALIAS_CERT;
+	keys.alias_cert_length = RIOT_CORE_ALIAS_CERT_LEN;
+
+	status = riot_key_manager_init_static (&bench->key_manager, &bench->keystore.base, &keys,
+		&bench->x509.base);
+	if (status != 0) {
+		goto release_keystore;
+	}
+
+	if (digest_cache) {
+		status = riot_key_manager_enable_digest_cache (&bench->key_manager, bench->digest_cache,
+			ARRAY_SIZE (bench->digest_cache));
+		if (status != 0) {
+			goto release_key_manager;
+		}
+	}
+
+	status = spdm_transcript_manager_init (&bench->transcript, &bench->transcript_state,
+		bench->transcript_engine, ARRAY_SIZE (bench->transcript_engine));
+	if (status != 0) {
+		goto release_key_manager;
+	}
+
+	status = bench->transcript.set_hash_algo (&bench->transcript, HASH_TYPE_SHA384);
+	if (status != 0) {
+		goto release_transcript;
+	}
+
+	bench->transcript.set_spdm_version (&bench->transcript, SPDM_MAKE_VERSION (1, 2));
+
+	status = spdm_init_state (&bench->state);
+	if (status != 0) {
+		goto release_transcript;
+	}
+
+	bench->state.connection_info.connection_state = SPDM_CONNECTION_STATE_NEGOTIATED;
+	bench->state.connection_info.version.major_version = 1;
+	bench->state.connection_info.version.minor_version = 2;
+	bench->state.connection_info.peer_algorithms.base_hash_algo = SPDM_TPM_ALG_SHA_384;
+	bench->state.connection_info.peer_algorithms.base_asym_algo =
+		SPDM_TPM_ALG_ECDSA_ECC_NIST_P384;
+
+	bench->capabilities.ct_exponent = SPDM_MAX_CT_EXPONENT;
+	bench->capabilities.flags.cert_cap = 1;
+	bench->capabilities.flags.chal_cap = 1;
+	bench->capabilities.data_transfer_size = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	bench->capabilities.max_spdm_msg_size = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	/* Only the dependencies needed for certificate and CHALLENGE requests are provided to the
+	 * responder. */
+	bench->responder.state = &bench->state;
+	bench->responder.hash_engine = &bench->hash_engine;
+	bench->responder.hash_engine_count = 1;
+	bench->responder.transcript_manager = &bench->transcript;
+	bench->responder.key_manager = &bench->key_manager;
+	bench->responder.ecc_engine = &bench->ecc.base;
+	bench->responder.rng_engine = &bench->rng.base;
+	bench->responder.local_capabilities = &bench->capabilities;
+
+	*context = bench;
+
+	return 0;
+
+release_transcript:
+	spdm_transcript_manager_release (&bench->transcript);
+release_key_manager:
+	riot_key_manager_release (&bench->key_manager);
+release_keystore:
+	keystore_null_release (&bench->keystore);
+release_engines:
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+	X509_TESTING_ENGINE_RELEASE (&bench->x509);
+	ECC_TESTING_ENGINE_RELEASE (&bench->ecc);
+	RNG_TESTING_ENGINE_RELEASE (&bench->rng);
+
+	for (i = 0; i < ARRAY_SIZE (bench->transcript_hash); i++) {
+		HASH_TESTING_ENGINE_RELEASE (&bench->transcript_hash[i]);
+	}
+
+	free (bench);
+
+	return status;
+}
+
+static int spdm_commands_bench_setup_no_cache (void **context)
+{
+	return spdm_commands_bench_setup (context, false);
+}
+
+static int spdm_commands_bench_setup_digest_cache (void **context)
+{
+	return spdm_commands_bench_setup (context, true);
+}
+
+/**
+ * Task to send MCTP control requests to the device.  Each request is sent a fixed time after the
+ * response to the previous request, so requests arrive at random points in SPDM processing.
+ *
+ * @param arg The control requester context.
+ *
+ * @return Unused.
+ */
+static void* spdm_commands_bench_control_requester (void *arg)
+{
+	struct spdm_commands_bench_control *control = arg;
+	struct timespec delay;
+	int status;
+
+	delay.tv_sec = 0;
+	delay.tv_nsec = SPDM_COMMANDS_BENCH_CONTROL_INTERVAL_US * 1000;
+
+	pthread_mutex_lock (&control->lock);
+
+	while (!control->stop) {
+		pthread_mutex_unlock (&control->lock);
+		nanosleep (&delay, NULL);
+		pthread_mutex_lock (&control->lock);
+
+		status = mctp_control_protocol_generate_get_message_type_support_request (control->buffer,
+			sizeof (control->buffer));
+		if (status < 0) {
+			break;
+		}
+
+		control->length = status;
+		control->arrival = bench_get_time_ns ();
+		control->pending = true;
+		pthread_cond_signal (&control->received);
+
+		while (control->pending && !control->stop) {
+			pthread_cond_wait (&control->responded, &control->lock);
+		}
+	}
+
+	pthread_mutex_unlock (&control->lock);
+
+	return NULL;
+}
+
+/**
+ * Start sending MCTP control requests to the device.
+ *
+ * @param control The control requester to start.
+ *
+ * @return 0 if the requester was started or an error code.
+ */
+static int spdm_commands_bench_start_control (struct spdm_commands_bench_control *control)
+{
+	pthread_condattr_t attr;
+
+	/* Timed waits for control requests use the same clock as the latency measurements. */
+	pthread_condattr_init (&attr);
+	pthread_condattr_setclock (&attr, CLOCK_MONOTONIC);
+
+	pthread_mutex_init (&control->lock, NULL);
+	pthread_cond_init (&control->received, &attr);
+	pthread_cond_init (&control->responded, NULL);
+	pthread_condattr_destroy (&attr);
+
+	if (pthread_create (&control->thread, NULL, spdm_commands_bench_control_requester,
+		control) != 0) {
+		pthread_cond_destroy (&control->responded);
+		pthread_cond_destroy (&control->received);
+		pthread_mutex_destroy (&control->lock);
+
+		return CMD_HANDLER_SPDM_RESPONDER_NO_MEMORY;
+	}
+
+	control->started = true;
+
+	return 0;
+}
+
+/**
+ * Stop sending MCTP control requests and report the latency of completed requests.
+ *
+ * @param control The control requester to stop.
+ */
+static void spdm_commands_bench_stop_control (struct spdm_commands_bench_control *control)
+{
+	size_t count;
+
+	if (!control->started) {
+		return;
+	}
+
+	pthread_mutex_lock (&control->lock);
+	control->stop = true;
+	pthread_cond_signal (&control->responded);
+	pthread_mutex_unlock (&control->lock);
+
+	pthread_join (control->thread, NULL);
+
+	pthread_cond_destroy (&control->responded);
+	pthread_cond_destroy (&control->received);
+	pthread_mutex_destroy (&control->lock);
+	control->started = false;
+
+	count = control->count;
+	if (count > SPDM_COMMANDS_BENCH_CONTROL_SAMPLES) {
+		count = SPDM_COMMANDS_BENCH_CONTROL_SAMPLES;
+	}
+
+	bench_report_latency ("mctp_control", control->latency, count);
+}
+
+/**
+ * Process MCTP control requests as they are received, until a deadline.  Any request that has
+ * already been received is always processed.
+ *
+ * @param control The control requester sending requests.
+ * @param deadline Time to stop waiting for requests, in nanoseconds.  Zero to only process a
+ * request that has already been received.
+ *
+ * @return 0 if all received requests were processed or an error code.
+ */
+static int spdm_commands_bench_process_control (struct spdm_commands_bench_control *control,
+	uint64_t deadline)
+{
+	struct cmd_interface_msg msg;
+	struct timespec timeout;
+	int status;
+
+	if (!control->started) {
+		return 0;
+	}
+
+	timeout.tv_sec = deadline / 1000000000ULL;
+	timeout.tv_nsec = deadline % 1000000000ULL;
+
+	do {
+		pthread_mutex_lock (&control->lock);
+
+		while (!control->pending && (bench_get_time_ns () < deadline)) {
+			pthread_cond_timedwait (&control->received, &control->lock, &timeout);
+		}
+
+		if (!control->pending) {
+			pthread_mutex_unlock (&control->lock);
+			break;
+		}
+
+		pthread_mutex_unlock (&control->lock);
+
+		/* Only one request is outstanding, so the buffer is not accessed by the requester until
+		 * the response has been completed. */
+		memset (&msg, 0, sizeof (msg));
+		msg.data = control->buffer;
+		msg.length = control->length;
+		msg.payload = control->buffer;
+		msg.payload_length = control->length;
+		msg.max_response = sizeof (control->buffer);
+
+		status = mctp_control_protocol_get_message_type_support (&msg);
+		if (status != 0) {
+			return status;
+		}
+
+		pthread_mutex_lock (&control->lock);
+
+		control->latency[control->count % SPDM_COMMANDS_BENCH_CONTROL_SAMPLES] =
+			bench_get_time_ns () - control->arrival;
+		control->count++;
+		control->pending = false;
+		pthread_cond_signal (&control->responded);
+
+		pthread_mutex_unlock (&control->lock);
+	} while (bench_get_time_ns () < deadline);
+
+	return 0;
+}
+
+static void spdm_commands_bench_teardown (void *context)
+{
+	struct spdm_commands_bench *bench = context;
+	size_t i;
+
+	spdm_commands_bench_stop_control (&bench->control);
+
+	if (bench->async) {
+		cmd_interface_spdm_responder_enable_async_signing (&bench->responder, NULL, NULL, NULL, 0);
+		event_task_linux_release (&bench->task);
+		cmd_background_handler_release (&bench->background);
+	}
+
+	spdm_transcript_manager_release (&bench->transcript);
+	riot_key_manager_release (&bench->key_manager);
+	keystore_null_release (&bench->keystore);
+
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+	X509_TESTING_ENGINE_RELEASE (&bench->x509);
+	ECC_TESTING_ENGINE_RELEASE (&bench->ecc);
+	RNG_TESTING_ENGINE_RELEASE (&bench->rng);
+
+	for (i = 0; i < ARRAY_SIZE (bench->transcript_hash); i++) {
+		HASH_TESTING_ENGINE_RELEASE (&bench->transcript_hash[i]);
+	}
+
+	free (bench);
+}
+
+/**
+ * Start a background task that generates CHALLENGE signatures for the responder.
+ *
+ * @param bench The benchmark context to update.
+ *
+ * @return 0 if asynchronous signing was enabled or an error code.
+ */
+static int spdm_commands_bench_start_background (struct spdm_commands_bench *bench)
+{
+	int status;
+
+	bench->task_handlers[0] = &bench->background.base_event;
+
+	status = event_task_linux_init (&bench->task, &bench->task_state, &bench->system,
+		bench->task_handlers, ARRAY_SIZE (bench->task_handlers));
+	if (status != 0) {
+		return status;
+	}
+
+	status = cmd_background_handler_init (&bench->background, &bench->background_state, NULL,
+		NULL, &bench->key_manager, &bench->task.base);
+	if (status != 0) {
+		goto release_task;
+	}
+
+	status = event_task_linux_start (&bench->task);
+	if (status != 0) {
+		goto release_background;
+	}
+
+	status = cmd_interface_spdm_responder_enable_async_signing (&bench->responder,
+		&bench->background.base_cmd, &bench->ecc_async, bench->deferred,
+		sizeof (bench->deferred));
+	if (status != 0) {
+		goto release_background;
+	}
+
+	bench->async = true;
+
+	return 0;
+
+release_background:
+	cmd_background_handler_release (&bench->background);
+release_task:
+	event_task_linux_release (&bench->task);
+
+	return status;
+}
+
+/**
+ * Create the context for a CHALLENGE benchmark.  MCTP control requests are sent to the device
+ * while CHALLENGE requests are being processed.
+ *
+ * @param context Output for the benchmark context.
+ * @param async Flag to generate signatures on a background task.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int spdm_commands_bench_setup_challenge (void **context, bool async)
+{
+	struct spdm_commands_bench *bench;
+	int status;
+
+	status = spdm_commands_bench_setup (context, true);
+	if (status != 0) {
+		return status;
+	}
+
+	bench = *context;
+
+	if (async) {
+		status = spdm_commands_bench_start_background (bench);
+		if (status != 0) {
+			goto error;
+		}
+	}
+
+	status = spdm_commands_bench_start_control (&bench->control);
+	if (status != 0) {
+		goto error;
+	}
+
+	return 0;
+
+error:
+	spdm_commands_bench_teardown (bench);
+
+	return status;
+}
+
+static int spdm_commands_bench_setup_challenge_inline (void **context)
+{
+	return spdm_commands_bench_setup_challenge (context, false);
+}
+
+static int spdm_commands_bench_setup_challenge_async (void **context)
+{
+	return spdm_commands_bench_setup_challenge (context, true);
+}
+
+/**
+ * Prepare a message for processing a request that has been generated in the message buffer.
+ *
+ * @param bench The benchmark context.
+ * @param msg The message to initialize.
+ * @param length Length of the request.
+ */
+static void spdm_commands_bench_init_msg (struct spdm_commands_bench *bench,
+	struct cmd_interface_msg *msg, size_t length)
+{
+	memset (msg, 0, sizeof (*msg));
+	msg->data = bench->buffer;
+	msg->length = length;
+	msg->payload = bench->buffer;
+	msg->payload_length = length;
+	msg->max_response = sizeof (bench->buffer);
+}
+
+/**
+ * Process one GET_DIGESTS request.
+ */
+static int spdm_commands_bench_get_digests (void *context)
+{
+	struct spdm_commands_bench *bench = context;
+	struct spdm_get_digests_response *rsp;
+	struct cmd_interface_msg msg;
+	int status;
+
+	status = spdm_generate_get_digests_request (bench->buffer, sizeof (bench->buffer), 2);
+	if (status < 0) {
+		return status;
+	}
+
+	spdm_commands_bench_init_msg (bench, &msg, status);
+
+	status = spdm_get_digests (&bench->responder, &msg);
+	if (status != 0) {
+		return status;
+	}
+
+	rsp = (struct spdm_get_digests_response*) msg.payload;
+	if ((msg.payload_length != (sizeof (*rsp) + SHA384_HASH_LENGTH)) ||
+		(rsp->header.req_rsp_code != SPDM_RESPONSE_GET_DIGESTS)) {
+		return CMD_HANDLER_SPDM_RESPONDER_INTERNAL_ERROR;
+	}
+
+	return 0;
+}
+
+/**
+ * Complete one CHALLENGE exchange while MCTP control requests are being received.  Requests are
+ * processed one at a time, so a control request received while the CHALLENGE signature is
+ * generated inline must wait for the CHALLENGE response.  When signing is done on the background
+ * task, the response is ResponseNotReady and control requests are processed while the requester
+ * waits to retrieve the signed response with RESPOND_IF_READY.
+ */
+static int spdm_commands_bench_challenge (void *context)
+{
+	struct spdm_commands_bench *bench = context;
+	struct spdm_error_response *rsp;
+	struct spdm_error_response_not_ready *not_ready;
+	struct cmd_interface_msg msg;
+	uint8_t nonce[SPDM_NONCE_LEN];
+	uint64_t retry_us;
+	int status;
+
+	status = spdm_commands_bench_process_control (&bench->control, 0);
+	if (status != 0) {
+		return status;
+	}
+
+	memset (nonce, 0x55, sizeof (nonce));
+	status = spdm_generate_challenge_request (bench->buffer, sizeof (bench->buffer), 0,
+		SPDM_MEASUREMENT_SUMMARY_HASH_NONE, nonce, 2);
+	if (status < 0) {
+		return status;
+	}
+
+	spdm_commands_bench_init_msg (bench, &msg, status);
+
+	status = spdm_challenge (&bench->responder, &msg);
+	if (status != 0) {
+		return status;
+	}
+
+	rsp = (struct spdm_error_response*) msg.payload;
+	while ((rsp->header.req_rsp_code == SPDM_RESPONSE_ERROR) &&
+		(rsp->error_code == SPDM_ERROR_RESPONSE_NOT_READY)) {
+		not_ready = (struct spdm_error_response_not_ready*)
+			spdm_get_spdm_error_rsp_optional_data (rsp);
+
+		/* Wait the time indicated by the responder before asking for the response again. */
+		retry_us = SPDM_COMMANDS_BENCH_MAX_RETRY_US;
+		if ((not_ready->rdt_exponent <= SPDM_MAX_CT_EXPONENT) &&
+			((1ULL << not_ready->rdt_exponent) < retry_us)) {
+			retry_us = 1ULL << not_ready->rdt_exponent;
+		}
+
+		status = spdm_commands_bench_process_control (&bench->control,
+			bench_get_time_ns () + (retry_us * 1000));
+		if (status != 0) {
+			return status;
+		}
+
+		status = spdm_generate_respond_if_ready_request (bench->buffer, sizeof (bench->buffer),
+			not_ready->request_code, not_ready->token, 2);
+		if (status < 0) {
+			return status;
+		}
+
+		spdm_commands_bench_init_msg (bench, &msg, status);
+
+		status = spdm_respond_if_ready (&bench->responder, &msg);
+		if (status != 0) {
+			return status;
+		}
+
+		rsp = (struct spdm_error_response*) msg.payload;
+	}
+
+	if (rsp->header.req_rsp_code != SPDM_RESPONSE_CHALLENGE) {
+		return CMD_HANDLER_SPDM_RESPONDER_INTERNAL_ERROR;
+	}
+
+	return spdm_commands_bench_process_control (&bench->control, 0);
+}
+
+
+static const struct bench_case spdm_commands_bench_cases[] = {
+	{
+		"get_digests", spdm_commands_bench_setup_no_cache, spdm_commands_bench_get_digests,
+		spdm_commands_bench_teardown, sizeof (struct spdm_get_digests_response) + SHA384_HASH_LENGTH
+	},
+	{
+		"get_digests_digest_cache", spdm_commands_bench_setup_digest_cache,
+		spdm_commands_bench_get_digests, spdm_commands_bench_teardown,
+		sizeof (struct spdm_get_digests_response) + SHA384_HASH_LENGTH
+	},
+	{
+		"challenge", spdm_commands_bench_setup_challenge_inline, spdm_commands_bench_challenge,
+		spdm_commands_bench_teardown, 0
+	},
+	{
+		"challenge_async_signing", spdm_commands_bench_setup_challenge_async,
+		spdm_commands_bench_challenge, spdm_commands_bench_teardown, 0
+	},
+};
+
+const struct bench_suite spdm_commands_bench_suite =
+	BENCH_SUITE ("spdm_commands", spdm_commands_bench_cases);
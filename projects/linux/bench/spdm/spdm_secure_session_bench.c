@@ -0,0 +1,379 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "common/array_size.h"
+#include "mctp/mctp_base_protocol.h"
+#include "spdm/spdm_commands.h"
+#include "spdm/spdm_secure_session_manager.h"
+#include "spdm/spdm_transcript_manager.h"
+#include "testing/engines/aes_testing_engine.h"
+#include "testing/engines/ecc_testing_engine.h"
+#include "testing/engines/hash_testing_engine.h"
+#include "testing/engines/rng_testing_engine.h"
+
+
+/**
+ * Length of the GET_MEASUREMENTS request in each secured message.
+ */
+#define	SPDM_SECURE_SESSION_BENCH_REQUEST_LENGTH	(sizeof (struct spdm_get_measurements_request))
+
+/**
+ * Length of the GET_MEASUREMENTS response in each secured message.  This is sized for a response
+ * containing a handful of SHA-384 measurement blocks.
+ */
+#define	SPDM_SECURE_SESSION_BENCH_RESPONSE_LENGTH	512
+
+/**
+ * Number of AES engines dedicated to session keys.  Each session needs one for each direction.
+ */
+#define	SPDM_SECURE_SESSION_BENCH_KEY_CACHE			(SPDM_MAX_SESSION_COUNT * 2)
+
+/**
+ * Number of hash engines needed by the transcript manager.
+ */
+#define	SPDM_SECURE_SESSION_BENCH_TRANSCRIPT_HASH	\
+	(SPDM_TRANSCRIPT_MANAGER_HASH_ENGINE_REQUIRED_COUNT + \
+		SPDM_TRANSCRIPT_MANAGER_SESSION_HASH_ENGINE_REQUIRED_COUNT)
+
+
+/**
+ * Context for secured message benchmarks.
+ */
+struct spdm_secure_session_bench {
+	HASH_TESTING_ENGINE hash;													/**< Hash engine for the session manager. */
+	HASH_TESTING_ENGINE transcript_hash[SPDM_SECURE_SESSION_BENCH_TRANSCRIPT_HASH];	/**< Hash engines for the transcript. */
+	struct hash_engine *transcript_engine[SPDM_SECURE_SESSION_BENCH_TRANSCRIPT_HASH];	/**< List of transcript hash engines. */
+	ECC_TESTING_ENGINE ecc;														/**< ECC engine for the session manager. */
+	RNG_TESTING_ENGINE rng;														/**< RNG engine for the session manager. */
+	AES_TESTING_ENGINE aes;														/**< Shared AES engine for the session manager. */
+	AES_TESTING_ENGINE key_cache[SPDM_SECURE_SESSION_BENCH_KEY_CACHE];			/**< AES engines dedicated to session keys. */
+	struct aes_engine *key_cache_engine[SPDM_SECURE_SESSION_BENCH_KEY_CACHE];	/**< List of dedicated AES engines. */
+	struct spdm_transcript_manager_state transcript_state;						/**< Variable context for the transcript. */
+	struct spdm_transcript_manager transcript;									/**< Transcript manager for the sessions. */
+	struct spdm_device_capability capabilities;									/**< Local device capabilities. */
+	struct spdm_local_device_algorithms algorithms;								/**< Local device algorithms. */
+	struct spdm_secure_session_manager_state state;								/**< Variable context for the session manager. */
+	struct spdm_secure_session_manager session_manager;							/**< The session manager being measured. */
+	struct spdm_secure_session *session[SPDM_MAX_SESSION_COUNT];				/**< The active sessions. */
+	uint8_t request[SPDM_MAX_SESSION_COUNT][MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];	/**< Encrypted request for each session. */
+	size_t request_length;														/**< Length of each encrypted request. */
+	uint8_t buffer[MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY];						/**< Buffer for processing messages. */
+	size_t sessions;															/**< Number of sessions that receive requests. */
+	size_t next;																/**< Next session to receive a request. */
+};
+
+
+/**
+ * Encrypt the GET_MEASUREMENTS request for a session the way a requester would.  The same request
+ * is replayed for every iteration, with the session sequence numbers reset to match.
+ *
+ * @param bench The benchmark context.
+ * @param index Index of the session to encrypt the request for.
+ *
+ * @return 0 if the request was encrypted or an error code.
+ */
+static int spdm_secure_session_bench_build_request (struct spdm_secure_session_bench *bench,
+	size_t index)
+{
+	struct spdm_secure_session *session = bench->session[index];
+	struct spdm_secured_message_data_header_1 *header_1 = (void*) bench->request[index];
+	struct spdm_secured_message_data_header_2 *header_2 = (void*) (header_1 + 1);
+	struct spdm_secured_message_cipher_header *cipher_header = (void*) (header_2 + 1);
+	struct spdm_get_measurements_request *rq = (void*) (cipher_header + 1);
+	size_t header_length = sizeof (*header_1) + sizeof (*header_2);
+	size_t plaintext_length = sizeof (*cipher_header) + SPDM_SECURE_SESSION_BENCH_REQUEST_LENGTH;
+	uint8_t *tag = (uint8_t*) cipher_header + plaintext_length;
+	int status;
+
+	header_1->session_id = session->session_id;
+	header_2->length = plaintext_length + AES_TAG_LENGTH;
+	cipher_header->application_data_length = SPDM_SECURE_SESSION_BENCH_REQUEST_LENGTH;
+
+	rq->header.spdm_minor_version = 2;
+	rq->header.spdm_major_version = SPDM_MAJOR_VERSION;
+	rq->header.req_rsp_code = SPDM_REQUEST_GET_MEASUREMENTS;
+	rq->measurement_operation = SPDM_MEASUREMENT_OPERATION_GET_ALL_BLOCKS;
+
+	/* Sequence number 0 uses the salt directly as the IV. */
+	status = bench->aes.base.set_key (&bench->aes.base,
+		session->data_secret.request_data_encryption_key, SPDM_MAX_AEAD_KEY_SIZE);
+	if (status != 0) {
+		return status;
+	}
+
+	status = bench->aes.base.encrypt_with_add_data (&bench->aes.base, (uint8_t*) cipher_header,
+		plaintext_length, session->data_secret.request_data_salt, SPDM_MAX_AEAD_IV_SIZE,
+		bench->request[index], header_length, (uint8_t*) cipher_header, plaintext_length, tag,
+		AES_TAG_LENGTH);
+	if (status != 0) {
+		return status;
+	}
+
+	bench->request_length = header_length + plaintext_length + AES_TAG_LENGTH;
+
+	return 0;
+}
+
+/**
+ * Create the context for a secured message benchmark.  Each session is established with unique
+ * data keys.
+ *
+ * @param context Output for the benchmark context.
+ * @param sessions Number of sessions that will receive requests.
+ * @param key_cache Flag to enable dedicated AES engines for session keys.
+ *
+ * @return 0 if the context was created or an error code.
+ */
+static int spdm_secure_session_bench_setup (void **context, size_t sessions, bool key_cache)
+{
+	struct spdm_secure_session_bench *bench;
+	struct spdm_connection_info connection_info;
+	size_t i;
+	int status;
+
+	bench = calloc (1, sizeof (struct spdm_secure_session_bench));
+	if (bench == NULL) {
+		return SPDM_SECURE_SESSION_MANAGER_NO_MEMORY;
+	}
+
+	bench->sessions = sessions;
+
+	status = HASH_TESTING_ENGINE_INIT (&bench->hash);
+	status |= ECC_TESTING_ENGINE_INIT (&bench->ecc);
+	status |= RNG_TESTING_ENGINE_INIT (&bench->rng);
+	status |= AES_TESTING_ENGINE_INIT (&bench->aes);
+
+	for (i = 0; i < ARRAY_SIZE (bench->transcript_hash); i++) {
+		status |= HASH_TESTING_ENGINE_INIT (&bench->transcript_hash[i]);
+		bench->transcript_engine[i] = &bench->transcript_hash[i].base;
+	}
+
+	for (i = 0; i < ARRAY_SIZE (bench->key_cache); i++) {
+		status |= AES_TESTING_ENGINE_INIT (&bench->key_cache[i]);
+		bench->key_cache_engine[i] = &bench->key_cache[i].base;
+	}
+
+	if (status != 0) {
+		goto release_engines;
+	}
+
+	status = spdm_transcript_manager_init (&bench->transcript, &bench->transcript_state,
+		bench->transcript_engine, ARRAY_SIZE (bench->transcript_engine));
+	if (status != 0) {
+		goto release_engines;
+	}
+
+	bench->capabilities.ct_exponent = SPDM_MAX_CT_EXPONENT;
+	bench->capabilities.flags.meas_cap = 1;
+	bench->capabilities.flags.encrypt_cap = 1;
+	bench->capabilities.flags.mac_cap = 1;
+	bench->capabilities.flags.key_ex_cap = 1;
+	bench->capabilities.data_transfer_size = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+	bench->capabilities.max_spdm_msg_size = MCTP_BASE_PROTOCOL_MAX_MESSAGE_BODY;
+
+	bench->algorithms.device_algorithms.base_hash_algo = SPDM_TPM_ALG_SHA_384;
+	bench->algorithms.device_algorithms.aead_cipher_suite = SPDM_ALG_AEAD_CIPHER_SUITE_AES_256_GCM;
+	bench->algorithms.device_algorithms.dhe_named_group = SPDM_ALG_DHE_NAMED_GROUP_SECP_384_R1;
+	bench->algorithms.device_algorithms.key_schedule = SPDM_ALG_KEY_SCHEDULE_HMAC_HASH;
+
+	status = spdm_secure_session_manager_init (&bench->session_manager, &bench->state,
+		&bench->capabilities, (const struct spdm_device_algorithms*) &bench->algorithms,
+		&bench->aes.base, &bench->hash.base, &bench->rng.base, &bench->ecc.base,
+		&bench->transcript);
+	if (status != 0) {
+		goto release_transcript;
+	}
+
+	if (key_cache) {
+		status = spdm_secure_session_manager_enable_key_cache (&bench->session_manager,
+			bench->key_cache_engine, ARRAY_SIZE (bench->key_cache_engine));
+		if (status != 0) {
+			goto release_session_manager;
+		}
+	}
+
+	memset (&connection_info, 0, sizeof (connection_info));
+	connection_info.version.major_version = 1;
+	connection_info.version.minor_version = 2;
+	connection_info.secure_message_version.major_version = 1;
+	connection_info.secure_message_version.minor_version = 2;
+	connection_info.peer_algorithms.base_hash_algo = SPDM_TPM_ALG_SHA_384;
+	connection_info.peer_algorithms.dhe_named_group = SPDM_ALG_DHE_NAMED_GROUP_SECP_384_R1;
+	connection_info.peer_algorithms.aead_cipher_suite = SPDM_ALG_AEAD_CIPHER_SUITE_AES_256_GCM;
+	connection_info.peer_algorithms.key_schedule = SPDM_ALG_KEY_SCHEDULE_HMAC_HASH;
+	connection_info.peer_capabilities.flags.encrypt_cap = 1;
+	connection_info.peer_capabilities.flags.mac_cap = 1;
+	connection_info.peer_capabilities.flags.key_ex_cap = 1;
+
+	for (i = 0; i < sessions; i++) {
+		bench->session[i] = bench->session_manager.create_session (&bench->session_manager,
+			MAKE_SESSION_ID (0x1000 + i, 0xff00 - i), false, &connection_info);
+		if (bench->session[i] == NULL) {
+			status = SPDM_SECURE_SESSION_MANAGER_INTERNAL_ERROR;
+			goto release_session_manager;
+		}
+
+		/* Key exchange is not part of the measurement, so use fixed data keys. */
+		bench->session[i]->session_state = SPDM_SESSION_STATE_ESTABLISHED;
+		memset (bench->session[i]->data_secret.request_data_encryption_key, 0x10 + i,
+			SPDM_MAX_AEAD_KEY_SIZE);
+		memset (bench->session[i]->data_secret.request_data_salt, 0x20 + i,
+			SPDM_MAX_AEAD_IV_SIZE);
+		memset (bench->session[i]->data_secret.response_data_encryption_key, 0x30 + i,
+			SPDM_MAX_AEAD_KEY_SIZE);
+		memset (bench->session[i]->data_secret.response_data_salt, 0x40 + i,
+			SPDM_MAX_AEAD_IV_SIZE);
+
+		status = spdm_secure_session_bench_build_request (bench, i);
+		if (status != 0) {
+			goto release_session_manager;
+		}
+	}
+
+	*context = bench;
+
+	return 0;
+
+release_session_manager:
+	bench->session_manager.reset (&bench->session_manager);
+	spdm_secure_session_manager_release (&bench->session_manager);
+release_transcript:
+	spdm_transcript_manager_release (&bench->transcript);
+release_engines:
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+	ECC_TESTING_ENGINE_RELEASE (&bench->ecc);
+	RNG_TESTING_ENGINE_RELEASE (&bench->rng);
+	AES_TESTING_ENGINE_RELEASE (&bench->aes);
+
+	for (i = 0; i < ARRAY_SIZE (bench->transcript_hash); i++) {
+		HASH_TESTING_ENGINE_RELEASE (&bench->transcript_hash[i]);
+	}
+
+	for (i = 0; i < ARRAY_SIZE (bench->key_cache); i++) {
+		AES_TESTING_ENGINE_RELEASE (&bench->key_cache[i]);
+	}
+
+	free (bench);
+
+	return status;
+}
+
+static int spdm_secure_session_bench_setup_single (void **context)
+{
+	return spdm_secure_session_bench_setup (context, 1, false);
+}
+
+static int spdm_secure_session_bench_setup_single_key_cache (void **context)
+{
+	return spdm_secure_session_bench_setup (context, 1, true);
+}
+
+static int spdm_secure_session_bench_setup_all (void **context)
+{
+	return spdm_secure_session_bench_setup (context, SPDM_MAX_SESSION_COUNT, false);
+}
+
+static int spdm_secure_session_bench_setup_all_key_cache (void **context)
+{
+	return spdm_secure_session_bench_setup (context, SPDM_MAX_SESSION_COUNT, true);
+}
+
+static void spdm_secure_session_bench_teardown (void *context)
+{
+	struct spdm_secure_session_bench *bench = context;
+	size_t i;
+
+	bench->session_manager.reset (&bench->session_manager);
+	spdm_secure_session_manager_release (&bench->session_manager);
+	spdm_transcript_manager_release (&bench->transcript);
+
+	HASH_TESTING_ENGINE_RELEASE (&bench->hash);
+	ECC_TESTING_ENGINE_RELEASE (&bench->ecc);
+	RNG_TESTING_ENGINE_RELEASE (&bench->rng);
+	AES_TESTING_ENGINE_RELEASE (&bench->aes);
+
+	for (i = 0; i < ARRAY_SIZE (bench->transcript_hash); i++) {
+		HASH_TESTING_ENGINE_RELEASE (&bench->transcript_hash[i]);
+	}
+
+	for (i = 0; i < ARRAY_SIZE (bench->key_cache); i++) {
+		AES_TESTING_ENGINE_RELEASE (&bench->key_cache[i]);
+	}
+
+	free (bench);
+}
+
+/**
+ * Process one secured GET_MEASUREMENTS request and encrypt the response.  Sessions receive
+ * requests in turn.
+ */
+static int spdm_secure_session_bench_round_trip (void *context)
+{
+	struct spdm_secure_session_bench *bench = context;
+	struct spdm_secure_session *session = bench->session[bench->next];
+	struct spdm_get_measurements_response *rsp;
+	struct cmd_interface_msg msg;
+	int status;
+
+	memcpy (bench->buffer, bench->request[bench->next], bench->request_length);
+	session->data_secret.request_data_sequence_number = 0;
+	session->data_secret.response_data_sequence_number = 0;
+
+	bench->next = (bench->next + 1) % bench->sessions;
+
+	memset (&msg, 0, sizeof (msg));
+	msg.data = bench->buffer;
+	msg.length = bench->request_length;
+	msg.payload = bench->buffer;
+	msg.payload_length = bench->request_length;
+	msg.max_response = sizeof (bench->buffer);
+
+	status = bench->session_manager.decode_secure_message (&bench->session_manager, &msg);
+	if (status != 0) {
+		return status;
+	}
+
+	if ((msg.payload_length != SPDM_SECURE_SESSION_BENCH_REQUEST_LENGTH) ||
+		(((struct spdm_protocol_header*) msg.payload)->req_rsp_code !=
+			SPDM_REQUEST_GET_MEASUREMENTS)) {
+		return SPDM_SECURE_SESSION_MANAGER_INVALID_MESSAGE_SIZE;
+	}
+
+	rsp = (struct spdm_get_measurements_response*) msg.payload;
+	rsp->header.req_rsp_code = SPDM_RESPONSE_GET_MEASUREMENTS;
+	msg.payload_length = SPDM_SECURE_SESSION_BENCH_RESPONSE_LENGTH;
+
+	return bench->session_manager.encode_secure_message (&bench->session_manager, &msg);
+}
+
+
+static const struct bench_case spdm_secure_session_bench_cases[] = {
+	{
+		"get_measurements", spdm_secure_session_bench_setup_single,
+		spdm_secure_session_bench_round_trip, spdm_secure_session_bench_teardown,
+		SPDM_SECURE_SESSION_BENCH_RESPONSE_LENGTH
+	},
+	{
+		"get_measurements_key_cache", spdm_secure_session_bench_setup_single_key_cache,
+		spdm_secure_session_bench_round_trip, spdm_secure_session_bench_teardown,
+		SPDM_SECURE_SESSION_BENCH_RESPONSE_LENGTH
+	},
+	{
+		"get_measurements_all_sessions", spdm_secure_session_bench_setup_all,
+		spdm_secure_session_bench_round_trip, spdm_secure_session_bench_teardown,
+		SPDM_SECURE_SESSION_BENCH_RESPONSE_LENGTH
+	},
+	{
+		"get_measurements_all_sessions_key_cache", spdm_secure_session_bench_setup_all_key_cache,
+		spdm_secure_session_bench_round_trip, spdm_secure_session_bench_teardown,
+		SPDM_SECURE_SESSION_BENCH_RESPONSE_LENGTH
+	},
+};
+
+const struct bench_suite spdm_secure_session_bench_suite =
+	BENCH_SUITE ("spdm_secure_session", spdm_secure_session_bench_cases);
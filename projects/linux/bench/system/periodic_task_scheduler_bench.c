@@ -0,0 +1,171 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "bench_all.h"
+#include "platform_api.h"
+#include "system/periodic_task.h"
+#include "system/periodic_task_scheduler.h"
+
+
+/**
+ * Number of handlers registered with the task.
+ */
+#define	PERIODIC_TASK_SCHEDULER_BENCH_HANDLERS		32
+
+
+/**
+ * A periodic handler that is always ready to execute.
+ */
+struct periodic_task_scheduler_bench_handler {
+	struct periodic_task_handler base;	/**< The base handler instance. */
+	platform_clock next;				/**< Execution time that has already expired. */
+	uint32_t executions;				/**< Number of times the handler was executed. */
+};
+
+/**
+ * Context for periodic task scheduling benchmarks.
+ */
+struct periodic_task_scheduler_bench {
+	struct periodic_task_scheduler_state state;		/**< Variable context for the scheduler. */
+	struct periodic_task_scheduler scheduler;		/**< The scheduler being measured. */
+
+	/**
+	 * Handlers executed by the task.
+	 */
+	struct periodic_task_scheduler_bench_handler handler[PERIODIC_TASK_SCHEDULER_BENCH_HANDLERS];
+
+	/**
+	 * List of handlers for the task.
+	 */
+	const struct periodic_task_handler *list[PERIODIC_TASK_SCHEDULER_BENCH_HANDLERS];
+
+	/**
+	 * Storage for the scheduling heap.
+	 */
+	struct periodic_task_scheduler_entry entries[PERIODIC_TASK_SCHEDULER_BENCH_HANDLERS];
+};
+
+
+static const platform_clock* periodic_task_scheduler_bench_get_next_execution (
+	const struct periodic_task_handler *handler)
+{
+	const struct periodic_task_scheduler_bench_handler *bench =
+		(const struct periodic_task_scheduler_bench_handler*) handler;
+
+	return &bench->next;
+}
+
+static void periodic_task_scheduler_bench_execute (const struct periodic_task_handler *handler)
+{
+	struct periodic_task_scheduler_bench_handler *bench =
+		(struct periodic_task_scheduler_bench_handler*) handler;
+
+	bench->executions++;
+}
+
+static int periodic_task_scheduler_bench_setup (void **context)
+{
+	struct periodic_task_scheduler_bench *bench;
+	size_t i;
+	int status;
+
+	bench = calloc (1, sizeof (struct periodic_task_scheduler_bench));
+	if (bench == NULL) {
+		return PERIODIC_TASK_NO_MEMORY;
+	}
+
+	for (i = 0; i < PERIODIC_TASK_SCHEDULER_BENCH_HANDLERS; i++) {
+		bench->handler[i].base.get_next_execution = periodic_task_scheduler_bench_get_next_execution;
+		bench->handler[i].base.execute = periodic_task_scheduler_bench_execute;
+
+		status = platform_init_current_tick (&bench->handler[i].next);
+		if (status != 0) {
+			goto free_bench;
+		}
+
+		bench->list[i] = &bench->handler[i].base;
+	}
+
+	status = periodic_task_scheduler_init (&bench->scheduler, &bench->state, bench->list,
+		PERIODIC_TASK_SCHEDULER_BENCH_HANDLERS, bench->entries);
+	if (status != 0) {
+		goto free_bench;
+	}
+
+	status = periodic_task_scheduler_prepare (&bench->scheduler);
+	if (status != 0) {
+		goto release_scheduler;
+	}
+
+	*context = bench;
+
+	return 0;
+
+release_scheduler:
+	periodic_task_scheduler_release (&bench->scheduler);
+free_bench:
+	free (bench);
+
+	return status;
+}
+
+static void periodic_task_scheduler_bench_teardown (void *context)
+{
+	struct periodic_task_scheduler_bench *bench = context;
+
+	periodic_task_scheduler_release (&bench->scheduler);
+	free (bench);
+}
+
+/**
+ * Execute every handler once using the deadline scheduler.  All handlers are due, so a single call
+ * executes the full handler list.
+ */
+static int periodic_task_scheduler_bench_execute_due_handlers (void *context)
+{
+	struct periodic_task_scheduler_bench *bench = context;
+
+	return periodic_task_scheduler_execute_due_handlers (&bench->scheduler);
+}
+
+/**
+ * Execute every handler once using the linear search over the handler list.  Each call queries all
+ * handlers to execute just one of them.
+ */
+static int periodic_task_scheduler_bench_execute_next_handler (void *context)
+{
+	struct periodic_task_scheduler_bench *bench = context;
+	size_t i;
+	int status;
+
+	for (i = 0; i < PERIODIC_TASK_SCHEDULER_BENCH_HANDLERS; i++) {
+		status = periodic_task_execute_next_handler (bench->list,
+			PERIODIC_TASK_SCHEDULER_BENCH_HANDLERS);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	return 0;
+}
+
+
+static const struct bench_case periodic_task_scheduler_bench_cases[] = {
+	{
+		"execute_due_handlers_32_handlers", periodic_task_scheduler_bench_setup,
+		periodic_task_scheduler_bench_execute_due_handlers, periodic_task_scheduler_bench_teardown,
+		0
+	},
+	{
+		"execute_next_handler_32_handlers", periodic_task_scheduler_bench_setup,
+		periodic_task_scheduler_bench_execute_next_handler, periodic_task_scheduler_bench_teardown,
+		0
+	},
+};
+
+const struct bench_suite periodic_task_scheduler_bench_suite =
+	BENCH_SUITE ("periodic_task_scheduler", periodic_task_scheduler_bench_cases);
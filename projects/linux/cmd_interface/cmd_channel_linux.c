@@ -0,0 +1,466 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "cmd_channel_linux.h"
+#include "cmd_channel_linux_static.h"
+
+
+/**
+ * Epoll identifier for the listening socket.
+ */
+#define	CMD_CHANNEL_LINUX_LISTEN_ID			0xffffffff
+
+/**
+ * Epoll identifier for the wake event.
+ */
+#define	CMD_CHANNEL_LINUX_WAKE_ID			0xfffffffe
+
+
+/**
+ * Stop monitoring a client and close the connection.  The client table must be locked.
+ *
+ * @param state The channel state.
+ * @param index Index of the client to remove.
+ */
+static void cmd_channel_linux_remove_client (struct cmd_channel_linux_state *state, int index)
+{
+	epoll_ctl (state->epoll_fd, EPOLL_CTL_DEL, state->client[index], NULL);
+	close (state->client[index]);
+	state->client[index] = -1;
+
+	/* Don't send responses to a different client that reuses the same slot. */
+	if (state->reply_client == index) {
+		state->reply_client = -1;
+	}
+}
+
+/**
+ * Read a single packet from a client connection.
+ *
+ * @param channel The channel receiving the packet.
+ * @param index Index of the client to read from.
+ * @param packet Output for the received packet.
+ *
+ * @return 0 if a packet was received, 1 if no packet was available, or an error code.
+ */
+static int cmd_channel_linux_read_client (const struct cmd_channel_linux *channel, int index,
+	struct cmd_packet *packet)
+{
+	struct cmd_channel_linux_state *state = channel->state;
+	ssize_t bytes;
+	int fd;
+
+	platform_mutex_lock (&state->lock);
+
+	fd = state->client[index];
+	if (fd < 0) {
+		platform_mutex_unlock (&state->lock);
+
+		return 1;
+	}
+
+	bytes = recv (fd, packet->data, sizeof (packet->data), MSG_DONTWAIT | MSG_TRUNC);
+	if (bytes <= 0) {
+		if ((bytes == 0) || ((errno != EAGAIN) && (errno != EINTR))) {
+			/* The client has disconnected. */
+			cmd_channel_linux_remove_client (state, index);
+		}
+
+		platform_mutex_unlock (&state->lock);
+
+		return 1;
+	}
+
+	if ((size_t) bytes > sizeof (packet->data)) {
+		/* Packets are never split across socket messages, so there is nothing to be done with an
+		 * oversized packet except drop it. */
+		platform_mutex_unlock (&state->lock);
+
+		return 1;
+	}
+
+	state->reply_client = index;
+
+	platform_mutex_unlock (&state->lock);
+
+	packet->pkt_size = bytes;
+	packet->dest_addr = channel->address;
+	packet->state = CMD_VALID_PACKET;
+	packet->timeout_valid = false;
+
+	return 0;
+}
+
+int cmd_channel_linux_receive_packet (const struct cmd_channel *channel, struct cmd_packet *packet,
+	int ms_timeout)
+{
+	const struct cmd_channel_linux *linux_channel = (const struct cmd_channel_linux*) channel;
+	struct cmd_channel_linux_state *state;
+	struct epoll_event event;
+	platform_clock timeout;
+	uint32_t remaining;
+	uint64_t value;
+	int wait = -1;
+	int status;
+
+	if ((linux_channel == NULL) || (packet == NULL)) {
+		return CMD_CHANNEL_INVALID_ARGUMENT;
+	}
+
+	state = linux_channel->state;
+
+	if (ms_timeout >= 0) {
+		status = platform_init_timeout (ms_timeout, &timeout);
+		if (status != 0) {
+			return CMD_CHANNEL_RX_FAILED;
+		}
+	}
+
+	while (1) {
+		if (ms_timeout >= 0) {
+			platform_get_timeout_remaining (&timeout, &remaining);
+			wait = remaining;
+		}
+
+		status = epoll_wait (state->epoll_fd, &event, 1, wait);
+		if (status < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return CMD_CHANNEL_RX_FAILED;
+		}
+		else if (status == 0) {
+			return CMD_CHANNEL_RX_TIMEOUT;
+		}
+
+		if (event.data.u32 == CMD_CHANNEL_LINUX_WAKE_ID) {
+			if (read (state->wake_fd, &value, sizeof (value)) < 0) {
+				return CMD_CHANNEL_RX_FAILED;
+			}
+
+			return CMD_CHANNEL_RX_TIMEOUT;
+		}
+		else if (event.data.u32 == CMD_CHANNEL_LINUX_LISTEN_ID) {
+			int fd = accept (state->listen_fd, NULL, NULL);
+
+			if (fd >= 0) {
+				status = cmd_channel_linux_add_client (linux_channel, fd);
+				if (status != 0) {
+					close (fd);
+				}
+			}
+		}
+		else if (event.data.u32 < CMD_CHANNEL_LINUX_MAX_CLIENTS) {
+			status = cmd_channel_linux_read_client (linux_channel, event.data.u32, packet);
+			if (status != 1) {
+				return status;
+			}
+		}
+
+		if (ms_timeout == 0) {
+			return CMD_CHANNEL_RX_TIMEOUT;
+		}
+	}
+}
+
+int cmd_channel_linux_send_packet (const struct cmd_channel *channel,
+	const struct cmd_packet *packet)
+{
+	const struct cmd_channel_linux *linux_channel = (const struct cmd_channel_linux*) channel;
+	struct cmd_channel_linux_state *state;
+	int index;
+	int status = 0;
+
+	if ((linux_channel == NULL) || (packet == NULL)) {
+		return CMD_CHANNEL_INVALID_ARGUMENT;
+	}
+
+	if ((packet->pkt_size == 0) || (packet->pkt_size > sizeof (packet->data))) {
+		return CMD_CHANNEL_INVALID_PKT_SIZE;
+	}
+
+	state = linux_channel->state;
+
+	/* Keep the table locked while sending so the socket can't be closed and reused. */
+	platform_mutex_lock (&state->lock);
+
+	index = state->reply_client;
+	if ((index < 0) ||
+		(send (state->client[index], packet->data, packet->pkt_size, MSG_NOSIGNAL) !=
+			(ssize_t) packet->pkt_size)) {
+		status = CMD_CHANNEL_TX_FAILED;
+	}
+
+	platform_mutex_unlock (&state->lock);
+
+	return status;
+}
+
+/**
+ * Initialize a command channel for communicating with local clients.
+ *
+ * @param channel The channel to initialize.
+ * @param state Variable context for the channel.  This must be uninitialized.
+ * @param id An ID to associate with the command channel.
+ * @param address SMBus address of the device using the channel.  This will be used as the
+ * destination address for all received packets.
+ * @param path Path for a socket that will accept client connections.  Any existing file at this
+ * path will be removed.  Set this to null if clients will only be added directly.
+ *
+ * @return 0 if the channel was initialized successfully or an error code.
+ */
+int cmd_channel_linux_init (struct cmd_channel_linux *channel,
+	struct cmd_channel_linux_state *state, int id, uint8_t address, const char *path)
+{
+	if ((channel == NULL) || (state == NULL)) {
+		return CMD_CHANNEL_INVALID_ARGUMENT;
+	}
+
+	memset (channel, 0, sizeof (struct cmd_channel_linux));
+
+	channel->base.receive_packet = cmd_channel_linux_receive_packet;
+	channel->base.send_packet = cmd_channel_linux_send_packet;
+	channel->base.state = &state->base;
+	channel->base.id = id;
+
+	channel->state = state;
+	channel->path = path;
+	channel->address = address;
+
+	return cmd_channel_linux_init_state (channel);
+}
+
+/**
+ * Create the socket that will accept client connections.
+ *
+ * @param channel The channel to listen for connections.
+ *
+ * @return 0 if the socket was created successfully or an error code.
+ */
+static int cmd_channel_linux_listen (const struct cmd_channel_linux *channel)
+{
+	struct cmd_channel_linux_state *state = channel->state;
+	struct sockaddr_un addr;
+	struct epoll_event event;
+
+	if (strlen (channel->path) >= sizeof (addr.sun_path)) {
+		return CMD_CHANNEL_INVALID_ARGUMENT;
+	}
+
+	memset (&addr, 0, sizeof (addr));
+	addr.sun_family = AF_UNIX;
+	strcpy (addr.sun_path, channel->path);
+
+	state->listen_fd = socket (AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+	if (state->listen_fd < 0) {
+		return CMD_CHANNEL_NO_MEMORY;
+	}
+
+	unlink (channel->path);
+
+	if ((bind (state->listen_fd, (struct sockaddr*) &addr, sizeof (addr)) != 0) ||
+		(listen (state->listen_fd, CMD_CHANNEL_LINUX_MAX_CLIENTS) != 0)) {
+		goto error;
+	}
+
+	event.events = EPOLLIN;
+	event.data.u64 = 0;
+	event.data.u32 = CMD_CHANNEL_LINUX_LISTEN_ID;
+	if (epoll_ctl (state->epoll_fd, EPOLL_CTL_ADD, state->listen_fd, &event) != 0) {
+		goto error;
+	}
+
+	return 0;
+
+error:
+	close (state->listen_fd);
+	state->listen_fd = -1;
+
+	return CMD_CHANNEL_CONNECTION_FAILED;
+}
+
+/**
+ * Initialize only the variable state for a Linux command channel.  The rest of the channel is
+ * assumed to have already been initialized.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param channel The channel that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int cmd_channel_linux_init_state (const struct cmd_channel_linux *channel)
+{
+	struct cmd_channel_linux_state *state;
+	struct epoll_event event;
+	int status;
+
+	if ((channel == NULL) || (channel->state == NULL)) {
+		return CMD_CHANNEL_INVALID_ARGUMENT;
+	}
+
+	state = channel->state;
+
+	memset (state, 0, sizeof (struct cmd_channel_linux_state));
+	memset (state->client, 0xff, sizeof (state->client));
+	state->reply_client = -1;
+	state->listen_fd = -1;
+
+	status = cmd_channel_init_state (&channel->base);
+	if (status != 0) {
+		return status;
+	}
+
+	status = platform_mutex_init (&state->lock);
+	if (status != 0) {
+		goto release_channel;
+	}
+
+	state->epoll_fd = epoll_create1 (EPOLL_CLOEXEC);
+	if (state->epoll_fd < 0) {
+		status = CMD_CHANNEL_NO_MEMORY;
+		goto release_lock;
+	}
+
+	state->wake_fd = eventfd (0, EFD_CLOEXEC);
+	if (state->wake_fd < 0) {
+		status = CMD_CHANNEL_NO_MEMORY;
+		goto release_epoll;
+	}
+
+	event.events = EPOLLIN;
+	event.data.u64 = 0;
+	event.data.u32 = CMD_CHANNEL_LINUX_WAKE_ID;
+	if (epoll_ctl (state->epoll_fd, EPOLL_CTL_ADD, state->wake_fd, &event) != 0) {
+		status = CMD_CHANNEL_NO_MEMORY;
+		goto release_wake;
+	}
+
+	if (channel->path) {
+		status = cmd_channel_linux_listen (channel);
+		if (status != 0) {
+			goto release_wake;
+		}
+	}
+
+	return 0;
+
+release_wake:
+	close (state->wake_fd);
+release_epoll:
+	close (state->epoll_fd);
+release_lock:
+	platform_mutex_free (&state->lock);
+release_channel:
+	cmd_channel_release (&channel->base);
+
+	return status;
+}
+
+/**
+ * Release the resources used by a Linux command channel.  All client connections will be closed.
+ *
+ * @param channel The channel to release.
+ */
+void cmd_channel_linux_release (const struct cmd_channel_linux *channel)
+{
+	int i;
+
+	if (channel) {
+		for (i = 0; i < CMD_CHANNEL_LINUX_MAX_CLIENTS; i++) {
+			if (channel->state->client[i] >= 0) {
+				close (channel->state->client[i]);
+			}
+		}
+
+		if (channel->state->listen_fd >= 0) {
+			close (channel->state->listen_fd);
+			unlink (channel->path);
+		}
+
+		close (channel->state->wake_fd);
+		close (channel->state->epoll_fd);
+		platform_mutex_free (&channel->state->lock);
+		cmd_channel_release (&channel->base);
+	}
+}
+
+/**
+ * Add a connected client to the channel.  The channel takes ownership of the socket, which will be
+ * closed when the client disconnects or the channel is released.
+ *
+ * @param channel The channel to add the client to.
+ * @param fd A connected sequenced packet socket for the client.
+ *
+ * @return 0 if the client was added successfully or an error code.  If the client could not be
+ * added, the socket will not be closed.
+ */
+int cmd_channel_linux_add_client (const struct cmd_channel_linux *channel, int fd)
+{
+	struct cmd_channel_linux_state *state;
+	struct epoll_event event;
+	int i;
+	int status = CMD_CHANNEL_NO_MEMORY;
+
+	if ((channel == NULL) || (fd < 0)) {
+		return CMD_CHANNEL_INVALID_ARGUMENT;
+	}
+
+	state = channel->state;
+
+	platform_mutex_lock (&state->lock);
+
+	for (i = 0; i < CMD_CHANNEL_LINUX_MAX_CLIENTS; i++) {
+		if (state->client[i] < 0) {
+			event.events = EPOLLIN;
+			event.data.u64 = 0;
+			event.data.u32 = i;
+
+			if (epoll_ctl (state->epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0) {
+				state->client[i] = fd;
+				status = 0;
+			}
+			else {
+				status = CMD_CHANNEL_CONNECTION_FAILED;
+			}
+
+			break;
+		}
+	}
+
+	platform_mutex_unlock (&state->lock);
+
+	return status;
+}
+
+/**
+ * Interrupt a thread that is waiting to receive a packet.  The receive call will return
+ * CMD_CHANNEL_RX_TIMEOUT.  If no thread is waiting, the next receive call will be interrupted.
+ *
+ * @param channel The channel to wake.
+ *
+ * @return 0 if the channel was signaled successfully or an error code.
+ */
+int cmd_channel_linux_wake (const struct cmd_channel_linux *channel)
+{
+	uint64_t value = 1;
+
+	if (channel == NULL) {
+		return CMD_CHANNEL_INVALID_ARGUMENT;
+	}
+
+	if (write (channel->state->wake_fd, &value, sizeof (value)) != sizeof (value)) {
+		return CMD_CHANNEL_TX_FAILED;
+	}
+
+	return 0;
+}
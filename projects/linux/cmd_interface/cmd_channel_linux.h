@@ -0,0 +1,60 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef CMD_CHANNEL_LINUX_H_
+#define CMD_CHANNEL_LINUX_H_
+
+#include <stdint.h>
+#include "platform_api.h"
+#include "cmd_interface/cmd_channel.h"
+
+
+/**
+ * The maximum number of clients that can be connected to a channel at the same time.
+ */
+#ifndef CMD_CHANNEL_LINUX_MAX_CLIENTS
+#define	CMD_CHANNEL_LINUX_MAX_CLIENTS		64
+#endif
+
+
+/**
+ * Variable context for a Linux command channel.
+ */
+struct cmd_channel_linux_state {
+	struct cmd_channel_state base;				/**< Variable context for the base channel. */
+	platform_mutex lock;						/**< Synchronization for the client table. */
+	int epoll_fd;								/**< Descriptor to wait for channel activity. */
+	int wake_fd;								/**< Event descriptor to interrupt a receive. */
+	int listen_fd;								/**< Socket accepting new clients. */
+	int client[CMD_CHANNEL_LINUX_MAX_CLIENTS];	/**< Socket for each connected client. */
+	int reply_client;							/**< Client that sent the last received packet. */
+};
+
+/**
+ * A command channel that exchanges MCTP packets with local clients over UNIX sequenced packet
+ * sockets.  Each socket message contains a single packet without the SMBus destination address.
+ *
+ * Any number of clients can be connected at the same time, either by connecting to a listening
+ * socket or by being added directly, such as with one end of a socketpair.  Packets are received
+ * from whichever client has data available.  Packets are processed one at a time, so every packet
+ * sent on the channel is routed to the client socket that sent the last received packet.  The SMBus
+ * addresses used by clients don't affect routing, so clients are free to share an address.
+ */
+struct cmd_channel_linux {
+	struct cmd_channel base;				/**< The base channel instance. */
+	struct cmd_channel_linux_state *state;	/**< Variable context for the channel. */
+	const char *path;						/**< Path for the listening socket.  Null for none. */
+	uint8_t address;						/**< SMBus address of the device using the channel. */
+};
+
+
+int cmd_channel_linux_init (struct cmd_channel_linux *channel,
+	struct cmd_channel_linux_state *state, int id, uint8_t address, const char *path);
+int cmd_channel_linux_init_state (const struct cmd_channel_linux *channel);
+void cmd_channel_linux_release (const struct cmd_channel_linux *channel);
+
+int cmd_channel_linux_add_client (const struct cmd_channel_linux *channel, int fd);
+int cmd_channel_linux_wake (const struct cmd_channel_linux *channel);
+
+
+#endif /* CMD_CHANNEL_LINUX_H_ */
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef CMD_CHANNEL_LINUX_STATIC_H_
+#define CMD_CHANNEL_LINUX_STATIC_H_
+
+#include "cmd_channel_linux.h"
+
+
+/* Internal functions declared to allow for static initialization. */
+int cmd_channel_linux_receive_packet (const struct cmd_channel *channel, struct cmd_packet *packet,
+	int ms_timeout);
+int cmd_channel_linux_send_packet (const struct cmd_channel *channel,
+	const struct cmd_packet *packet);
+
+
+/**
+ * Initialize a static instance of a Linux command channel.  This does not initialize the channel
+ * state.  This can be a constant instance.
+ *
+ * There is no validation done on the arguments.
+ *
+ * @param state_ptr Variable context for the channel.
+ * @param channel_id An ID to associate with the command channel.
+ * @param smbus_addr SMBus address of the device using the channel.
+ * @param path_ptr Path for the socket that will accept client connections.  Set this to null if
+ * clients will only be added directly.
+ */
+#define	cmd_channel_linux_static_init(state_ptr, channel_id, smbus_addr, path_ptr)	{ \
+		.base = { \
+			.receive_packet = cmd_channel_linux_receive_packet, \
+			.send_packet = cmd_channel_linux_send_packet, \
+			.state = &(state_ptr)->base, \
+			.id = channel_id, \
+		}, \
+		.state = state_ptr, \
+		.path = path_ptr, \
+		.address = smbus_addr, \
+	}
+
+
+#endif /* CMD_CHANNEL_LINUX_STATIC_H_ */
@@ -17,6 +17,10 @@ static int aes_openssl_set_key (struct aes_engine *engine, const uint8_t *key, s
 		return AES_ENGINE_INVALID_ARGUMENT;
 	}
 
+	if (openssl->stream != AES_STREAM_NONE) {
+		return AES_ENGINE_OPERATION_IN_PROGRESS;
+	}
+
 	switch (length) {
 		case (128 / 8):
 		case (192 / 8):
@@ -78,8 +82,37 @@ static int aes_openssl_init_iv (struct aes_engine_openssl *openssl, const uint8_
 	return 0;
 }
 
-static int aes_openssl_encrypt_data (struct aes_engine *engine, const uint8_t *plaintext,
-	size_t length, const uint8_t *iv, size_t iv_length, uint8_t *ciphertext, size_t out_length,
+/**
+ * Add additional authenticated data to the active AES-GCM operation.
+ *
+ * @param openssl The AES instance to update.
+ * @param additional_data The additional data to authenticate.  Null if there is no data.
+ * @param length Length of the additional data.
+ *
+ * @return 0 if the additional data was added successfully or an error code.
+ */
+static int aes_openssl_add_data (struct aes_engine_openssl *openssl,
+	const uint8_t *additional_data, size_t length)
+{
+	int status;
+	int add_length;
+
+	if ((additional_data == NULL) || (length == 0)) {
+		return 0;
+	}
+
+	status = EVP_CipherUpdate (openssl->context, NULL, &add_length, additional_data, length);
+	if (status != 1) {
+		status = ERR_get_error ();
+		return -status;
+	}
+
+	return 0;
+}
+
+static int aes_openssl_encrypt_with_add_data (struct aes_engine *engine, const uint8_t *plaintext,
+	size_t length, const uint8_t *iv, size_t iv_length, const uint8_t *additional_data,
+	size_t additional_data_length, uint8_t *ciphertext, size_t out_length,
 	uint8_t *tag, size_t tag_length)
 {
 	struct aes_engine_openssl *openssl = (struct aes_engine_openssl*) engine;
@@ -99,6 +132,10 @@ static int aes_openssl_encrypt_data (struct aes_engine *engine, const uint8_t *p
 		return AES_ENGINE_OUT_BUFFER_TOO_SMALL;
 	}
 
+	if (openssl->stream != AES_STREAM_NONE) {
+		return AES_ENGINE_OPERATION_IN_PROGRESS;
+	}
+
 	if (EVP_CIPHER_CTX_key_length (openssl->context) == 0) {
 		return AES_ENGINE_NO_KEY;
 	}
@@ -110,6 +147,11 @@ static int aes_openssl_encrypt_data (struct aes_engine *engine, const uint8_t *p
 		return status;
 	}
 
+	status = aes_openssl_add_data (openssl, additional_data, additional_data_length);
+	if (status != 0) {
+		return status;
+	}
+
 	status = EVP_EncryptUpdate (openssl->context, ciphertext, &enc_length, plaintext, length);
 	if (status != 1) {
 		status = ERR_get_error ();
@@ -133,17 +175,17 @@ static int aes_openssl_encrypt_data (struct aes_engine *engine, const uint8_t *p
 	return 0;
 }
 
-static int aes_openssl_encrypt_with_add_data (struct aes_engine *engine, const uint8_t *plaintext,
-	size_t length, const uint8_t *iv, size_t iv_length, const uint8_t *additional_data,
-	size_t additional_data_length, uint8_t *ciphertext, size_t out_length,
+static int aes_openssl_encrypt_data (struct aes_engine *engine, const uint8_t *plaintext,
+	size_t length, const uint8_t *iv, size_t iv_length, uint8_t *ciphertext, size_t out_length,
 	uint8_t *tag, size_t tag_length)
 {
-	/* [TODO] Reminder to implement this later. */
-	return AES_UNSUPPORTED_OPERATION;
+	return aes_openssl_encrypt_with_add_data (engine, plaintext, length, iv, iv_length, NULL, 0,
+		ciphertext, out_length, tag, tag_length);
 }
 
-static int aes_openssl_decrypt_data (struct aes_engine *engine, const uint8_t *ciphertext,
-	size_t length, const uint8_t *tag, const uint8_t *iv, size_t iv_length, uint8_t *plaintext,
+static int aes_openssl_decrypt_with_add_data (struct aes_engine *engine, const uint8_t *ciphertext,
+	size_t length, const uint8_t *tag, const uint8_t *iv, size_t iv_length,
+	const uint8_t *additional_data, size_t additional_data_length, uint8_t *plaintext,
 	size_t out_length)
 {
 	struct aes_engine_openssl *openssl = (struct aes_engine_openssl*) engine;
@@ -159,6 +201,10 @@ static int aes_openssl_decrypt_data (struct aes_engine *engine, const uint8_t *c
 		return AES_ENGINE_OUT_BUFFER_TOO_SMALL;
 	}
 
+	if (openssl->stream != AES_STREAM_NONE) {
+		return AES_ENGINE_OPERATION_IN_PROGRESS;
+	}
+
 	if (EVP_CIPHER_CTX_key_length (openssl->context) == 0) {
 		return AES_ENGINE_NO_KEY;
 	}
@@ -170,6 +216,11 @@ static int aes_openssl_decrypt_data (struct aes_engine *engine, const uint8_t *c
 		return status;
 	}
 
+	status = aes_openssl_add_data (openssl, additional_data, additional_data_length);
+	if (status != 0) {
+		return status;
+	}
+
 	status = EVP_DecryptUpdate (openssl->context, plaintext, &dec_length, ciphertext, length);
 	if (status != 1) {
 		status = ERR_get_error ();
@@ -194,13 +245,201 @@ static int aes_openssl_decrypt_data (struct aes_engine *engine, const uint8_t *c
 	}
 }
 
-static int aes_openssl_decrypt_with_add_data (struct aes_engine *engine, const uint8_t *ciphertext,
-	size_t length, const uint8_t *tag, const uint8_t *iv, size_t iv_length,
-	const uint8_t *additional_data, size_t additional_data_length, uint8_t *plaintext,
+static int aes_openssl_decrypt_data (struct aes_engine *engine, const uint8_t *ciphertext,
+	size_t length, const uint8_t *tag, const uint8_t *iv, size_t iv_length, uint8_t *plaintext,
 	size_t out_length)
 {
-	/* [TODO] Reminder to implement this later. */
-	return AES_UNSUPPORTED_OPERATION;
+	return aes_openssl_decrypt_with_add_data (engine, ciphertext, length, tag, iv, iv_length, NULL,
+		0, plaintext, out_length);
+}
+
+/**
+ * Start a streaming AES-GCM operation.
+ *
+ * @param engine The AES engine to start.
+ * @param iv The IV for the operation.
+ * @param iv_length Length of the IV.
+ * @param type The type of operation to start.
+ *
+ * @return 0 if the operation was started successfully or an error code.
+ */
+static int aes_openssl_start (struct aes_engine *engine, const uint8_t *iv, size_t iv_length,
+	enum aes_stream_type type)
+{
+	struct aes_engine_openssl *openssl = (struct aes_engine_openssl*) engine;
+	int status;
+
+	if ((openssl == NULL) || (iv == NULL) || (iv_length == 0)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (openssl->stream != AES_STREAM_NONE) {
+		return AES_ENGINE_OPERATION_IN_PROGRESS;
+	}
+
+	if (EVP_CIPHER_CTX_key_length (openssl->context) == 0) {
+		return AES_ENGINE_NO_KEY;
+	}
+
+	ERR_clear_error ();
+
+	status = aes_openssl_init_iv (openssl, iv, iv_length, (type == AES_STREAM_ENCRYPT));
+	if (status != 0) {
+		return status;
+	}
+
+	openssl->stream = type;
+	openssl->stream_data = false;
+
+	return 0;
+}
+
+static int aes_openssl_start_encrypt (struct aes_engine *engine, const uint8_t *iv,
+	size_t iv_length)
+{
+	return aes_openssl_start (engine, iv, iv_length, AES_STREAM_ENCRYPT);
+}
+
+static int aes_openssl_start_decrypt (struct aes_engine *engine, const uint8_t *iv,
+	size_t iv_length)
+{
+	return aes_openssl_start (engine, iv, iv_length, AES_STREAM_DECRYPT);
+}
+
+static int aes_openssl_update_add_data (struct aes_engine *engine, const uint8_t *additional_data,
+	size_t length)
+{
+	struct aes_engine_openssl *openssl = (struct aes_engine_openssl*) engine;
+
+	if ((openssl == NULL) || (additional_data == NULL)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (openssl->stream == AES_STREAM_NONE) {
+		return AES_ENGINE_NO_ACTIVE_OPERATION;
+	}
+
+	if (openssl->stream_data) {
+		return AES_UNSUPPORTED_OPERATION;
+	}
+
+	ERR_clear_error ();
+
+	return aes_openssl_add_data (openssl, additional_data, length);
+}
+
+static int aes_openssl_update (struct aes_engine *engine, const uint8_t *input, size_t length,
+	uint8_t *output, size_t out_length)
+{
+	struct aes_engine_openssl *openssl = (struct aes_engine_openssl*) engine;
+	int status;
+	int update_length;
+
+	if ((openssl == NULL) || (input == NULL) || (output == NULL)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (out_length < length) {
+		return AES_ENGINE_OUT_BUFFER_TOO_SMALL;
+	}
+
+	if (openssl->stream == AES_STREAM_NONE) {
+		return AES_ENGINE_NO_ACTIVE_OPERATION;
+	}
+
+	if (length == 0) {
+		return 0;
+	}
+
+	ERR_clear_error ();
+
+	status = EVP_CipherUpdate (openssl->context, output, &update_length, input, length);
+	if (status != 1) {
+		status = ERR_get_error ();
+		return -status;
+	}
+
+	openssl->stream_data = true;
+
+	return 0;
+}
+
+static int aes_openssl_finish_encrypt (struct aes_engine *engine, uint8_t *tag, size_t tag_length)
+{
+	struct aes_engine_openssl *openssl = (struct aes_engine_openssl*) engine;
+	uint8_t final[AES_BLOCK_SIZE];
+	int final_length;
+	int status;
+
+	if ((openssl == NULL) || (tag == NULL)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (tag_length < AES_TAG_LENGTH) {
+		return AES_ENGINE_OUT_BUFFER_TOO_SMALL;
+	}
+
+	if (openssl->stream != AES_STREAM_ENCRYPT) {
+		return AES_ENGINE_NO_ACTIVE_OPERATION;
+	}
+
+	openssl->stream = AES_STREAM_NONE;
+
+	ERR_clear_error ();
+
+	status = EVP_EncryptFinal_ex (openssl->context, final, &final_length);
+	if (status != 1) {
+		status = ERR_get_error ();
+		return -status;
+	}
+
+	status = EVP_CIPHER_CTX_ctrl (openssl->context, EVP_CTRL_GCM_GET_TAG, AES_TAG_LENGTH, tag);
+	if (status != 1) {
+		status = ERR_get_error ();
+		return -status;
+	}
+
+	return 0;
+}
+
+static int aes_openssl_finish_decrypt (struct aes_engine *engine, const uint8_t *tag)
+{
+	struct aes_engine_openssl *openssl = (struct aes_engine_openssl*) engine;
+	uint8_t final[AES_BLOCK_SIZE];
+	int final_length;
+	int status;
+
+	if ((openssl == NULL) || (tag == NULL)) {
+		return AES_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (openssl->stream != AES_STREAM_DECRYPT) {
+		return AES_ENGINE_NO_ACTIVE_OPERATION;
+	}
+
+	openssl->stream = AES_STREAM_NONE;
+
+	ERR_clear_error ();
+
+	status = EVP_CIPHER_CTX_ctrl (openssl->context, EVP_CTRL_GCM_SET_TAG, AES_TAG_LENGTH,
+		(void*) tag);
+	if (status != 1) {
+		status = ERR_get_error ();
+		return -status;
+	}
+
+	status = EVP_DecryptFinal_ex (openssl->context, final, &final_length);
+
+	return (status == 1) ? 0 : AES_ENGINE_GCM_AUTH_FAILED;
+}
+
+static void aes_openssl_cancel (struct aes_engine *engine)
+{
+	struct aes_engine_openssl *openssl = (struct aes_engine_openssl*) engine;
+
+	if (openssl) {
+		openssl->stream = AES_STREAM_NONE;
+	}
 }
 
 /**
@@ -230,6 +469,13 @@ int aes_openssl_init (struct aes_engine_openssl *engine)
 	engine->base.decrypt_data = aes_openssl_decrypt_data;
 	engine->base.encrypt_with_add_data = aes_openssl_encrypt_with_add_data;
 	engine->base.decrypt_with_add_data = aes_openssl_decrypt_with_add_data;
+	engine->base.start_encrypt = aes_openssl_start_encrypt;
+	engine->base.start_decrypt = aes_openssl_start_decrypt;
+	engine->base.update_add_data = aes_openssl_update_add_data;
+	engine->base.update = aes_openssl_update;
+	engine->base.finish_encrypt = aes_openssl_finish_encrypt;
+	engine->base.finish_decrypt = aes_openssl_finish_decrypt;
+	engine->base.cancel = aes_openssl_cancel;
 
 	return 0;
 }
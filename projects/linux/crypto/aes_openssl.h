@@ -4,6 +4,7 @@
 #ifndef AES_OPENSSL_H_
 #define AES_OPENSSL_H_
 
+#include <stdbool.h>
 #include <openssl/evp.h>
 #include "crypto/aes.h"
 
@@ -14,6 +15,8 @@
 struct aes_engine_openssl {
 	struct aes_engine base;			/**< The base AES engine. */
 	EVP_CIPHER_CTX *context;		/**< Context to use for AES operations. */
+	enum aes_stream_type stream;	/**< The type of active streaming operation. */
+	bool stream_data;				/**< Flag indicating data has been added to the active stream. */
 };
 
 
@@ -3,10 +3,54 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <openssl/crypto.h>
 #include <openssl/sha.h>
 #include "hash_openssl.h"
 
 
+_Static_assert (sizeof (((struct hash_engine_openssl*) 0)->context) <= HASH_MAX_CONTEXT_STATE_LENGTH,
+	"Saved hash state is too small for OpenSSL hash contexts");
+
+
+/**
+ * Get the length of the hash context for a type of hash.
+ *
+ * @param active The type of hash context.
+ *
+ * @return Length of the context or 0 if the hash type is not supported.
+ */
+static size_t hash_openssl_get_context_length (int active)
+{
+	switch (active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			return sizeof (SHA_CTX);
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			return sizeof (SHA256_CTX);
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+			return sizeof (SHA512_CTX);
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+			return sizeof (SHA512_CTX);
+#endif
+
+		default:
+			return 0;
+	}
+}
+
+/* The low-level SHA context APIs are deprecated in OpenSSL 3.0, but they are the only way to access
+ * the hash state directly for saving and restoring contexts.  Don't report the deprecation for the
+ * functions that use them. */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+
 #ifdef HASH_ENABLE_SHA1
 static int hash_openssl_calculate_sha1 (struct hash_engine *engine, const uint8_t *data,
 	size_t length, uint8_t *hash, size_t hash_length)
@@ -42,7 +86,7 @@ static int hash_openssl_start_sha1 (struct hash_engine *engine)
 		return HASH_ENGINE_HASH_IN_PROGRESS;
 	}
 
-	if (EVP_DigestInit (openssl->sha, EVP_sha1 ()) == 1) {
+	if (SHA1_Init (&openssl->context.sha1) == 1) {
 		openssl->active = HASH_ACTIVE_SHA1;
 		return 0;
 	}
@@ -86,7 +130,7 @@ static int hash_openssl_start_sha256 (struct hash_engine *engine)
 		return HASH_ENGINE_HASH_IN_PROGRESS;
 	}
 
-	if (EVP_DigestInit (openssl->sha, EVP_sha256 ()) == 1) {
+	if (SHA256_Init (&openssl->context.sha256) == 1) {
 		openssl->active = HASH_ACTIVE_SHA256;
 		return 0;
 	}
@@ -130,7 +174,7 @@ static int hash_openssl_start_sha384 (struct hash_engine *engine)
 		return HASH_ENGINE_HASH_IN_PROGRESS;
 	}
 
-	if (EVP_DigestInit (openssl->sha, EVP_sha384 ()) == 1) {
+	if (SHA384_Init (&openssl->context.sha512) == 1) {
 		openssl->active = HASH_ACTIVE_SHA384;
 		return 0;
 	}
@@ -175,7 +219,7 @@ static int hash_openssl_start_sha512 (struct hash_engine *engine)
 		return HASH_ENGINE_HASH_IN_PROGRESS;
 	}
 
-	if (EVP_DigestInit (openssl->sha, EVP_sha512 ()) == 1) {
+	if (SHA512_Init (&openssl->context.sha512) == 1) {
 		openssl->active = HASH_ACTIVE_SHA512;
 		return 0;
 	}
@@ -194,11 +238,33 @@ static int hash_openssl_update (struct hash_engine *engine, const uint8_t *data,
 		return HASH_ENGINE_INVALID_ARGUMENT;
 	}
 
-	if (openssl->active == HASH_ACTIVE_NONE) {
-		return HASH_ENGINE_NO_ACTIVE_HASH;
+	switch (openssl->active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			status = SHA1_Update (&openssl->context.sha1, data, length);
+			break;
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			status = SHA256_Update (&openssl->context.sha256, data, length);
+			break;
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+			status = SHA384_Update (&openssl->context.sha512, data, length);
+			break;
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+			status = SHA512_Update (&openssl->context.sha512, data, length);
+			break;
+#endif
+
+		default:
+			return HASH_ENGINE_NO_ACTIVE_HASH;
 	}
 
-	status = EVP_DigestUpdate (openssl->sha, data, length);
 	if (status == 1) {
 		return 0;
 	}
@@ -256,37 +322,63 @@ static int hash_openssl_check_output_buffer_length (const struct hash_engine_ope
 	return 0;
 }
 
+/**
+ * Complete the hash calculation for a hash context.
+ *
+ * @param context The hash context to finish.
+ * @param active The type of hash context.
+ * @param hash Output for the calculated hash.  This must be large enough for the hash type.
+ *
+ * @return 1 if the hash was calculated successfully or 0 if not.
+ */
+static int hash_openssl_finish_context (void *context, int active, uint8_t *hash)
+{
+	switch (active) {
+#ifdef HASH_ENABLE_SHA1
+		case HASH_ACTIVE_SHA1:
+			return SHA1_Final (hash, (SHA_CTX*) context);
+#endif
+
+		case HASH_ACTIVE_SHA256:
+			return SHA256_Final (hash, (SHA256_CTX*) context);
+
+#ifdef HASH_ENABLE_SHA384
+		case HASH_ACTIVE_SHA384:
+			return SHA384_Final (hash, (SHA512_CTX*) context);
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+		case HASH_ACTIVE_SHA512:
+			return SHA512_Final (hash, (SHA512_CTX*) context);
+#endif
+
+		default:
+			return 0;
+	}
+}
+
+#pragma GCC diagnostic pop
+
 static int hash_openssl_get_hash (struct hash_engine *engine, uint8_t *hash, size_t hash_length)
 {
 	struct hash_engine_openssl *openssl = (struct hash_engine_openssl*) engine;
-	EVP_MD_CTX *clone;
+	struct hash_engine_openssl clone;
 	int status;
 
 	if ((openssl == NULL) || (hash == NULL)) {
 		return HASH_ENGINE_INVALID_ARGUMENT;
 	}
 
-	if (openssl->active == HASH_ACTIVE_NONE) {
-		return HASH_ENGINE_NO_ACTIVE_HASH;
-	}
-
 	status = hash_openssl_check_output_buffer_length (openssl, hash_length);
 	if (status != 0) {
 		return status;
 	}
 
-	clone = EVP_MD_CTX_new ();
-	if (clone == NULL) {
-		return HASH_ENGINE_NO_MEMORY;
-	}
-
-	status = EVP_MD_CTX_copy (clone, openssl->sha);
-	if (status == 0) {
-		status = HASH_ENGINE_GET_HASH_FAILED;
-		goto exit;
-	}
+	/* The low-level OpenSSL contexts contain no pointers, so finish a copy of the active context to
+	 * get the current digest. */
+	memcpy (&clone.context, &openssl->context, sizeof (clone.context));
 
-	status = EVP_DigestFinal (clone, hash, NULL);
+	status = hash_openssl_finish_context (&clone.context, openssl->active, hash);
 	if (status == 1) {
 		status = 0;
 	}
@@ -294,8 +386,8 @@ static int hash_openssl_get_hash (struct hash_engine *engine, uint8_t *hash, siz
 		status = HASH_ENGINE_GET_HASH_FAILED;
 	}
 
-exit:
-	EVP_MD_CTX_free (clone);
+	OPENSSL_cleanse (&clone.context, sizeof (clone.context));
+
 	return status;
 }
 
@@ -313,12 +405,12 @@ static int hash_openssl_finish (struct hash_engine *engine, uint8_t *hash, size_
 		return status;
 	}
 
-	status = EVP_DigestFinal (openssl->sha, hash, NULL);
+	status = hash_openssl_finish_context (&openssl->context, openssl->active, hash);
 	if (status == 1) {
 		openssl->active = HASH_ACTIVE_NONE;
 		status = 0;
 	}
-	else if (status == 0) {
+	else {
 		status = HASH_ENGINE_FINISH_FAILED;
 	}
 
@@ -334,6 +426,52 @@ static void hash_openssl_cancel (struct hash_engine *engine)
 	}
 }
 
+static int hash_openssl_save_context (struct hash_engine *engine, struct hash_context *context)
+{
+	struct hash_engine_openssl *openssl = (struct hash_engine_openssl*) engine;
+	size_t length;
+
+	if ((openssl == NULL) || (context == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	length = hash_openssl_get_context_length (openssl->active);
+	if (length == 0) {
+		return HASH_ENGINE_NO_ACTIVE_HASH;
+	}
+
+	context->active = openssl->active;
+	context->length = length;
+	memcpy (context->state, &openssl->context, length);
+
+	return 0;
+}
+
+static int hash_openssl_restore_context (struct hash_engine *engine,
+	const struct hash_context *context)
+{
+	struct hash_engine_openssl *openssl = (struct hash_engine_openssl*) engine;
+	size_t length;
+
+	if ((openssl == NULL) || (context == NULL)) {
+		return HASH_ENGINE_INVALID_ARGUMENT;
+	}
+
+	if (openssl->active != HASH_ACTIVE_NONE) {
+		return HASH_ENGINE_HASH_IN_PROGRESS;
+	}
+
+	length = hash_openssl_get_context_length (context->active);
+	if ((length == 0) || (context->length != length)) {
+		return HASH_ENGINE_INVALID_CONTEXT;
+	}
+
+	memcpy (&openssl->context, context->state, length);
+	openssl->active = context->active;
+
+	return 0;
+}
+
 /**
  * Initialize an OpenSSL engine for calculating hashes.
  *
@@ -349,11 +487,6 @@ int hash_openssl_init (struct hash_engine_openssl *engine)
 
 	memset (engine, 0, sizeof (struct hash_engine_openssl));
 
-	engine->sha = EVP_MD_CTX_new ();
-	if (engine->sha == NULL) {
-		return HASH_ENGINE_NO_MEMORY;
-	}
-
 #ifdef HASH_ENABLE_SHA1
 	engine->base.calculate_sha1 = hash_openssl_calculate_sha1;
 	engine->base.start_sha1 = hash_openssl_start_sha1;
@@ -372,6 +505,8 @@ int hash_openssl_init (struct hash_engine_openssl *engine)
 	engine->base.get_hash = hash_openssl_get_hash;
 	engine->base.finish = hash_openssl_finish;
 	engine->base.cancel = hash_openssl_cancel;
+	engine->base.save_context = hash_openssl_save_context;
+	engine->base.restore_context = hash_openssl_restore_context;
 
 	engine->active = HASH_ACTIVE_NONE;
 
@@ -386,6 +521,6 @@ int hash_openssl_init (struct hash_engine_openssl *engine)
 void hash_openssl_release (struct hash_engine_openssl *engine)
 {
 	if (engine != NULL) {
-		EVP_MD_CTX_free (engine->sha);
+		OPENSSL_cleanse (&engine->context, sizeof (engine->context));
 	}
 }
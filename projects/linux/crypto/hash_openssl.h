@@ -4,7 +4,6 @@
 #ifndef HASH_OPENSSL_H_
 #define HASH_OPENSSL_H_
 
-#include <openssl/evp.h>
 #include <openssl/sha.h>
 #include "crypto/hash.h"
 
@@ -13,9 +12,17 @@
  * An OpenSSL context for calculating hashes.
  */
 struct hash_engine_openssl {
-	struct hash_engine base;	/**< The base hash engine. */
-	EVP_MD_CTX *sha;			/**< The context for calculating incremental hashes. */
-	int active;					/**< The type of initialized context. */
+	struct hash_engine base;		/**< The base hash engine. */
+	union {
+#ifdef HASH_ENABLE_SHA1
+		SHA_CTX sha1;				/**< Context for SHA1 hashes. */
+#endif
+		SHA256_CTX sha256;			/**< Context for SHA256 hashes. */
+#if defined HASH_ENABLE_SHA384 || defined HASH_ENABLE_SHA512
+		SHA512_CTX sha512;			/**< Context for SHA384 and SHA512 hashes. */
+#endif
+	} context;						/**< The contexts for calculating incremental hashes. */
+	int active;						/**< The type of initialized context. */
 };
 
 
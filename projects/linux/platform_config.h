@@ -117,6 +117,12 @@
  */
 // #define CERBERUS_VID_SET_RESPONSE							0xFF
 
+/**
+ * Maximum number of MCTP messages that can be assembled at the same time.  Each context after the
+ * first needs a buffer for a maximum sized message body.
+ */
+// #define MCTP_INTERFACE_MAX_ASSEMBLY_CONTEXTS					1
+
 
 /********************
  * DOE protocol
@@ -135,7 +141,7 @@
 /**
  * Maximum number of SPDM sessions supported.
  */
-// #define SPDM_MAX_SESSION_COUNT							1
+// #define SPDM_MAX_SESSION_COUNT							8
 
 /**
  * Buffer size for storing Version, Capabilities, Algorithms SPDM messages.
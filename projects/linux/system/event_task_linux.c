@@ -0,0 +1,303 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include "event_task_linux.h"
+
+
+/**
+ * Wake the event processing thread.
+ *
+ * @param task The task to wake.
+ *
+ * @return 0 if the thread was signaled or an error code.
+ */
+static int event_task_linux_wake (const struct event_task_linux *task)
+{
+	uint64_t value = 1;
+
+	if (write (task->state->event_fd, &value, sizeof (value)) != sizeof (value)) {
+		return EVENT_TASK_NOTIFY_FAILED;
+	}
+
+	return 0;
+}
+
+int event_task_linux_lock (const struct event_task *task)
+{
+	const struct event_task_linux *linux_task = (const struct event_task_linux*) task;
+
+	if (linux_task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	return platform_mutex_lock (&linux_task->state->lock);
+}
+
+int event_task_linux_unlock (const struct event_task *task)
+{
+	const struct event_task_linux *linux_task = (const struct event_task_linux*) task;
+
+	if (linux_task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	return platform_mutex_unlock (&linux_task->state->lock);
+}
+
+int event_task_linux_get_event_context (const struct event_task *task,
+	struct event_task_context **context)
+{
+	const struct event_task_linux *linux_task = (const struct event_task_linux*) task;
+	int status;
+
+	if ((linux_task == NULL) || (context == NULL)) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	if (linux_task->state->started) {
+		platform_mutex_lock (&linux_task->state->lock);
+		if (!linux_task->state->notifying && (linux_task->state->running < 0)) {
+			linux_task->state->notifying = true;
+			*context = &linux_task->state->context;
+			status = 0;
+		}
+		else {
+			platform_mutex_unlock (&linux_task->state->lock);
+			status = EVENT_TASK_BUSY;
+		}
+	}
+	else {
+		status = EVENT_TASK_NO_TASK;
+	}
+
+	return status;
+}
+
+int event_task_linux_notify (const struct event_task *task, const struct event_task_handler *handler)
+{
+	const struct event_task_linux *linux_task = (const struct event_task_linux*) task;
+	int status;
+
+	if (task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	if (linux_task->state->started) {
+		if (linux_task->state->running < 0) {
+			if (linux_task->state->notifying) {
+				/* Make sure the requested handler is registered with the task. */
+				status = event_task_find_handler (handler, linux_task->handlers,
+					linux_task->num_handlers);
+				if (!ROT_IS_ERROR (status)) {
+					linux_task->state->running = status;
+					status = 0;
+				}
+
+				linux_task->state->notifying = false;
+				platform_mutex_unlock (&linux_task->state->lock);
+				if (status == 0) {
+					/* If the handler is valid, notify the task to process the event. */
+					status = event_task_linux_wake (linux_task);
+				}
+			}
+			else {
+				status = EVENT_TASK_NOT_READY;
+			}
+		}
+		else {
+			status = EVENT_TASK_BUSY;
+		}
+	}
+	else {
+		status = EVENT_TASK_NO_TASK;
+	}
+
+	return status;
+}
+
+/**
+ * Initialize an event handler task.  The processing thread will not be created until the task is
+ * started.
+ *
+ * @param task The event handler task to initialize.
+ * @param state Variable context for the task.  This must be uninitialized.
+ * @param system The manager for system operations.
+ * @param handlers The list of event handlers that can be used with this task instance.
+ * @param num_handlers The number of event handlers in the list.
+ *
+ * @return 0 if the task was initialized or an error code
+ */
+int event_task_linux_init (struct event_task_linux *task, struct event_task_linux_state *state,
+	struct system *system, const struct event_task_handler **handlers, size_t num_handlers)
+{
+	if (task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (task, 0, sizeof (struct event_task_linux));
+
+	task->base.lock = event_task_linux_lock;
+	task->base.unlock = event_task_linux_unlock;
+	task->base.get_event_context = event_task_linux_get_event_context;
+	task->base.notify = event_task_linux_notify;
+
+	task->state = state;
+	task->system = system;
+	task->handlers = handlers;
+	task->num_handlers = num_handlers;
+
+	return event_task_linux_init_state (task);
+}
+
+/**
+ * Initialize only the variable state for an event handler task.  The rest of the task instance is
+ * assumed to have already been initialized.  The processing thread will not be created until the
+ * task is started.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param task The task instance that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int event_task_linux_init_state (const struct event_task_linux *task)
+{
+	int status;
+
+	if ((task == NULL) || (task->state == NULL) || (task->system == NULL) ||
+		(task->handlers == NULL) || (task->num_handlers == 0)) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (task->state, 0, sizeof (struct event_task_linux_state));
+
+	task->state->event_fd = eventfd (0, EFD_CLOEXEC);
+	if (task->state->event_fd < 0) {
+		return EVENT_TASK_NO_MEMORY;
+	}
+
+	/* Leave the running handler set to 0 initially.  This will get cleared after the handlers have
+	 * been initialized for execution within the task context. */
+
+	status = platform_mutex_init (&task->state->lock);
+	if (status != 0) {
+		close (task->state->event_fd);
+	}
+
+	return status;
+}
+
+/**
+ * Stop the event task and release all resources used by the task.  No handlers will be released.
+ *
+ * If a handler is currently executing, this will block until the handler has completed.
+ *
+ * @param task The task to release.
+ */
+void event_task_linux_release (const struct event_task_linux *task)
+{
+	if (task) {
+		if (task->state->started) {
+			task->state->stop = true;
+			event_task_linux_wake (task);
+
+			pthread_join (task->state->thread, NULL);
+			task->state->started = false;
+		}
+
+		close (task->state->event_fd);
+		platform_mutex_free (&task->state->lock);
+	}
+}
+
+/**
+ * Thread routine to handle notifications for registered handlers.
+ *
+ * @param arg The task to process event notifications.
+ *
+ * @return Nothing.
+ */
+static void* event_task_linux_process_notification (void *arg)
+{
+	const struct event_task_linux *task = arg;
+	uint64_t value;
+	bool reset = false;
+
+	event_task_prepare_handlers (task->handlers, task->num_handlers);
+
+	/* Indicate that the handlers have been initialized and the task is ready to process
+	 * notifications. */
+	platform_mutex_lock (&task->state->lock);
+	task->state->running = -1;
+	platform_mutex_unlock (&task->state->lock);
+
+	while (1) {
+		/* Wait for notification that an event should be processed. */
+		if ((read (task->state->event_fd, &value, sizeof (value)) < 0) && (errno == EINTR)) {
+			continue;
+		}
+
+		if (task->state->stop) {
+			break;
+		}
+
+		/* Sanity check the handler index before using it. */
+		if ((task->state->running >= 0) && ((size_t) task->state->running < task->num_handlers)) {
+			/* Execute the selected handler for the event. */
+			task->handlers[task->state->running]->execute (task->handlers[task->state->running],
+				&task->state->context, &reset);
+		}
+
+		if (reset) {
+			/* If the event requires it, reset the system.  We need to wait a bit before triggering
+			 * the reset to allow time for any execution status to be reported. */
+			platform_msleep (5000);
+			system_reset (task->system);
+			reset = false;	/* We should never get here, but clear the flag if the reset fails. */
+		}
+
+		/* Clear the running handler to be ready for the next event notification. */
+		platform_mutex_lock (&task->state->lock);
+		task->state->running = -1;
+		platform_mutex_unlock (&task->state->lock);
+	}
+
+	return NULL;
+}
+
+/**
+ * Create the thread for an event handler task and start processing events.  Handlers are prepared
+ * from the context of the new thread before any events are processed.
+ *
+ * @param task The event task to start.
+ *
+ * @return 0 if the task was started or an error code.
+ */
+int event_task_linux_start (const struct event_task_linux *task)
+{
+	int status;
+
+	if (task == NULL) {
+		return EVENT_TASK_INVALID_ARGUMENT;
+	}
+
+	if (task->state->started) {
+		return 0;
+	}
+
+	status = pthread_create (&task->state->thread, NULL, event_task_linux_process_notification,
+		(void*) task);
+	if (status != 0) {
+		return EVENT_TASK_NO_MEMORY;
+	}
+
+	task->state->started = true;
+
+	return 0;
+}
@@ -0,0 +1,50 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef EVENT_TASK_LINUX_H_
+#define EVENT_TASK_LINUX_H_
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "platform_api.h"
+#include "system/event_task.h"
+#include "system/system.h"
+
+
+/**
+ * Variable context for the task.
+ */
+struct event_task_linux_state {
+	struct event_task_context context;	/**< Context for handlers to use for event processing. */
+	pthread_t thread;					/**< The thread that will execute event handlers. */
+	bool started;						/**< Flag to indicate the thread has been created. */
+	bool stop;							/**< Flag to tell the thread to exit. */
+	int event_fd;						/**< Event descriptor used to wake the thread. */
+	platform_mutex lock;				/**< Synchronization with the execution thread. */
+	bool notifying;						/**< Flag to indicate when an event is being triggered. */
+	int running;						/**< Index of the active handler for event processing. */
+};
+
+/**
+ * Linux implementation for a task to handle event processing.  Events are processed by a dedicated
+ * thread that sleeps on an eventfd until notified.
+ */
+struct event_task_linux {
+	struct event_task base;						/**< Base interface to the task. */
+	struct event_task_linux_state *state;		/**< Variable context for the task. */
+	struct system *system;						/**< The system manager. */
+	const struct event_task_handler **handlers;	/**< List of registered event handlers. */
+	size_t num_handlers;						/**< Number of registered handlers in the list. */
+};
+
+
+int event_task_linux_init (struct event_task_linux *task, struct event_task_linux_state *state,
+	struct system *system, const struct event_task_handler **handlers, size_t num_handlers);
+int event_task_linux_init_state (const struct event_task_linux *task);
+void event_task_linux_release (const struct event_task_linux *task);
+
+int event_task_linux_start (const struct event_task_linux *task);
+
+
+#endif /* EVENT_TASK_LINUX_H_ */
@@ -0,0 +1,173 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "periodic_task_linux.h"
+#include "logging/debug_log.h"
+#include "system/system_logging.h"
+
+
+/**
+ * Initialize a periodic handler task.  The execution thread will not be created until the task is
+ * started.
+ *
+ * @param task The periodic handler task to initialize.
+ * @param state Variable context for the task.  This must be uninitialized.
+ * @param handlers The list of handlers that can be used with this task instance.
+ * @param num_handlers The number of handlers in the list.
+ * @param entries Storage for scheduling the handlers.  This must have space for the same number of
+ * entries as the handler list.
+ * @param log_id Identifier for this task in log messages.
+ *
+ * @return 0 if the task was initialized or an error code
+ */
+int periodic_task_linux_init (struct periodic_task_linux *task,
+	struct periodic_task_linux_state *state, const struct periodic_task_handler **handlers,
+	size_t num_handlers, struct periodic_task_scheduler_entry *entries, int log_id)
+{
+	if ((task == NULL) || (state == NULL)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (task, 0, sizeof (struct periodic_task_linux));
+
+	task->state = state;
+	task->scheduler.state = &state->scheduler;
+	task->scheduler.handlers = handlers;
+	task->scheduler.num_handlers = num_handlers;
+	task->scheduler.entries = entries;
+	task->id = log_id;
+
+	return periodic_task_linux_init_state (task);
+}
+
+/**
+ * Initialize only the variable state for a periodic handler task.  The rest of the task instance is
+ * assumed to have already been initialized.  The execution thread will not be created until the
+ * task is started.
+ *
+ * This would generally be used with a statically initialized instance.
+ *
+ * @param task The task instance that contains the state to initialize.
+ *
+ * @return 0 if the state was successfully initialized or an error code.
+ */
+int periodic_task_linux_init_state (const struct periodic_task_linux *task)
+{
+	if ((task == NULL) || (task->state == NULL)) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	memset (task->state, 0, sizeof (struct periodic_task_linux_state));
+
+	return periodic_task_scheduler_init_state (&task->scheduler);
+}
+
+/**
+ * Stop the periodic task and release all resources used by the task.  No handlers will be released.
+ *
+ * If a handler is currently executing, this will block until the handler has completed.
+ *
+ * @param task The task to release.
+ */
+void periodic_task_linux_release (const struct periodic_task_linux *task)
+{
+	if (task) {
+		if (task->state->started) {
+			task->state->stop = true;
+			periodic_task_scheduler_notify (&task->scheduler);
+
+			pthread_join (task->state->thread, NULL);
+			task->state->started = false;
+		}
+
+		periodic_task_scheduler_release (&task->scheduler);
+	}
+}
+
+/**
+ * Thread routine to call periodic actions for registered handlers.
+ *
+ * @param arg The task context for executing handlers.
+ *
+ * @return Nothing.
+ */
+static void* periodic_task_linux_loop (void *arg)
+{
+	const struct periodic_task_linux *task = arg;
+	int status;
+	int last_error = 0;
+
+	status = periodic_task_scheduler_prepare (&task->scheduler);
+	if (status != 0) {
+		debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
+			SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
+
+		if (status == PERIODIC_TASK_NO_HANDLERS) {
+			return NULL;
+		}
+
+		last_error = status;
+	}
+
+	while (!task->state->stop) {
+		status = periodic_task_scheduler_execute_due_handlers (&task->scheduler);
+		if ((status != 0) && (status != last_error)) {
+			debug_log_create_entry (DEBUG_LOG_SEVERITY_ERROR, DEBUG_LOG_COMPONENT_SYSTEM,
+				SYSTEM_LOGGING_PERIODIC_FAILED, task->id, status);
+		}
+
+		last_error = status;
+	}
+
+	return NULL;
+}
+
+/**
+ * Create the thread for a periodic handler task and start executing handlers.  Handlers are
+ * prepared from the context of the new thread.
+ *
+ * @param task The periodic task to start.
+ *
+ * @return 0 if the task was started or an error code.
+ */
+int periodic_task_linux_start (const struct periodic_task_linux *task)
+{
+	int status;
+
+	if (task == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	if (task->state->started) {
+		return 0;
+	}
+
+	status = pthread_create (&task->state->thread, NULL, periodic_task_linux_loop, (void*) task);
+	if (status != 0) {
+		return PERIODIC_TASK_NO_MEMORY;
+	}
+
+	task->state->started = true;
+
+	return 0;
+}
+
+/**
+ * Notify the task that the execution time for one or more handlers has changed outside of handler
+ * execution.  The task will refresh its schedule and run any handlers that are now due.
+ *
+ * @param task The periodic task to notify.
+ *
+ * @return 0 if the task was notified or an error code.
+ */
+int periodic_task_linux_notify (const struct periodic_task_linux *task)
+{
+	if (task == NULL) {
+		return PERIODIC_TASK_INVALID_ARGUMENT;
+	}
+
+	return periodic_task_scheduler_notify (&task->scheduler);
+}
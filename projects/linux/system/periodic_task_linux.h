@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef PERIODIC_TASK_LINUX_H_
+#define PERIODIC_TASK_LINUX_H_
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "system/periodic_task.h"
+#include "system/periodic_task_scheduler.h"
+
+
+/**
+ * Variable context for the task.
+ */
+struct periodic_task_linux_state {
+	struct periodic_task_scheduler_state scheduler;	/**< Variable context for handler scheduling. */
+	pthread_t thread;								/**< The thread that will execute handlers. */
+	bool started;									/**< Flag to indicate the thread has been created. */
+	bool stop;										/**< Flag to tell the thread to exit. */
+};
+
+/**
+ * Linux implementation for a task to execute periodic handlers.  Handlers are run from a dedicated
+ * thread using a deadline scheduler.
+ */
+struct periodic_task_linux {
+	struct periodic_task_linux_state *state;		/**< Variable context for the task. */
+	struct periodic_task_scheduler scheduler;		/**< Scheduler for the registered handlers. */
+	int id;											/**< Logging identifier. */
+};
+
+
+int periodic_task_linux_init (struct periodic_task_linux *task,
+	struct periodic_task_linux_state *state, const struct periodic_task_handler **handlers,
+	size_t num_handlers, struct periodic_task_scheduler_entry *entries, int log_id);
+int periodic_task_linux_init_state (const struct periodic_task_linux *task);
+void periodic_task_linux_release (const struct periodic_task_linux *task);
+
+int periodic_task_linux_start (const struct periodic_task_linux *task);
+int periodic_task_linux_notify (const struct periodic_task_linux *task);
+
+
+#endif /* PERIODIC_TASK_LINUX_H_ */
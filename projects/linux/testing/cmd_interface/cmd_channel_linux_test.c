@@ -0,0 +1,723 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "cmd_interface/cmd_channel_linux.h"
+#include "cmd_interface/cmd_channel_linux_static.h"
+
+
+TEST_SUITE_LABEL ("cmd_channel_linux");
+
+
+/**
+ * Path for the listening socket used in testing.
+ */
+#define	CMD_CHANNEL_LINUX_TESTING_PATH			"/tmp/cerberus_cmd_channel_linux_test"
+
+/**
+ * SMBus address of the device using the channel.
+ */
+#define	CMD_CHANNEL_LINUX_TESTING_ADDRESS		0x41
+
+/**
+ * SMBus address used by all clients.
+ */
+#define	CMD_CHANNEL_LINUX_TESTING_CLIENT_ADDRESS	0x10
+
+/**
+ * Number of concurrent clients for the stress test.
+ */
+#define	CMD_CHANNEL_LINUX_TESTING_CLIENTS		16
+
+/**
+ * Number of requests sent by each client in the stress test.
+ */
+#define	CMD_CHANNEL_LINUX_TESTING_REQUESTS		100
+
+
+/**
+ * Context for a client thread.
+ */
+struct cmd_channel_linux_testing_client {
+	uint8_t id;		/**< Identifier to include in the requests from the client. */
+	int failures;	/**< Number of requests that did not get the expected response. */
+};
+
+/**
+ * Context for a server thread that echoes packets back to the sender.
+ */
+struct cmd_channel_linux_testing_server {
+	const struct cmd_channel_linux *channel;	/**< The channel to serve. */
+	volatile int done;							/**< Flag to stop the server. */
+	int packets;								/**< Number of packets handled. */
+	int failures;								/**< Number of packets that could not be sent. */
+};
+
+
+/**
+ * Build an SMBus-encapsulated packet.
+ *
+ * @param buffer Output for the packet data.
+ * @param source_addr SMBus address of the sender.
+ * @param payload Payload byte to fill the packet with.
+ * @param length Total length of the packet.
+ */
+static void cmd_channel_linux_testing_build_packet (uint8_t *buffer, uint8_t source_addr,
+	uint8_t payload, size_t length)
+{
+	memset (buffer, payload, length);
+	buffer[0] = 0x0f;
+	buffer[1] = length - 3;
+	buffer[2] = (source_addr << 1) | 1;
+}
+
+/**
+ * Connect a client to the listening socket.
+ *
+ * @return The connected socket or -1 on failure.
+ */
+static int cmd_channel_linux_testing_connect (void)
+{
+	struct sockaddr_un addr;
+	int fd;
+
+	fd = socket (AF_UNIX, SOCK_SEQPACKET, 0);
+	if (fd < 0) {
+		return -1;
+	}
+
+	memset (&addr, 0, sizeof (addr));
+	addr.sun_family = AF_UNIX;
+	strcpy (addr.sun_path, CMD_CHANNEL_LINUX_TESTING_PATH);
+
+	if (connect (fd, (struct sockaddr*) &addr, sizeof (addr)) != 0) {
+		close (fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+/**
+ * Server thread that sends every received packet back to its source.
+ *
+ * @param arg The server context.
+ *
+ * @return Nothing.
+ */
+static void* cmd_channel_linux_testing_server_task (void *arg)
+{
+	struct cmd_channel_linux_testing_server *server = arg;
+	struct cmd_packet packet;
+	int status;
+
+	while (!server->done) {
+		status = server->channel->base.receive_packet (&server->channel->base, &packet, -1);
+		if (status == 0) {
+			packet.dest_addr = packet.data[2] >> 1;
+			packet.data[2] = (CMD_CHANNEL_LINUX_TESTING_ADDRESS << 1) | 1;
+
+			status = server->channel->base.send_packet (&server->channel->base, &packet);
+			if (status != 0) {
+				server->failures++;
+			}
+
+			server->packets++;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Client thread that sends requests and checks that each response comes back to the same client.
+ *
+ * @param arg The client context.
+ *
+ * @return Nothing.
+ */
+static void* cmd_channel_linux_testing_client_task (void *arg)
+{
+	struct cmd_channel_linux_testing_client *client = arg;
+	uint8_t tx[64];
+	uint8_t rx[CMD_MAX_PACKET_SIZE];
+	ssize_t bytes;
+	size_t length;
+	int fd;
+	int i;
+
+	fd = cmd_channel_linux_testing_connect ();
+	if (fd < 0) {
+		client->failures = CMD_CHANNEL_LINUX_TESTING_REQUESTS;
+		return NULL;
+	}
+
+	for (i = 0; i < CMD_CHANNEL_LINUX_TESTING_REQUESTS; i++) {
+		length = 8 + (i % (sizeof (tx) - 8));
+		cmd_channel_linux_testing_build_packet (tx, CMD_CHANNEL_LINUX_TESTING_CLIENT_ADDRESS,
+			client->id + i, length);
+
+		if (send (fd, tx, length, 0) != (ssize_t) length) {
+			client->failures++;
+			continue;
+		}
+
+		bytes = recv (fd, rx, sizeof (rx), 0);
+		if ((bytes != (ssize_t) length) || (memcmp (&rx[3], &tx[3], length - 3) != 0)) {
+			client->failures++;
+		}
+	}
+
+	close (fd);
+
+	return NULL;
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void cmd_channel_linux_test_init (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, channel.base.receive_packet);
+	CuAssertPtrNotNull (test, channel.base.send_packet);
+
+	CuAssertIntEquals (test, 2, cmd_channel_get_id (&channel.base));
+
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_init_with_path (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct stat info;
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS,
+		CMD_CHANNEL_LINUX_TESTING_PATH);
+	CuAssertIntEquals (test, 0, status);
+
+	status = stat (CMD_CHANNEL_LINUX_TESTING_PATH, &info);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, S_ISSOCK (info.st_mode));
+
+	cmd_channel_linux_release (&channel);
+
+	status = stat (CMD_CHANNEL_LINUX_TESTING_PATH, &info);
+	CuAssertTrue (test, (status != 0));
+}
+
+static void cmd_channel_linux_test_init_null (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (NULL, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+
+	status = cmd_channel_linux_init (&channel, NULL, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+}
+
+static void cmd_channel_linux_test_init_bad_path (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS,
+		"/nonexistent/directory/socket");
+	CuAssertIntEquals (test, CMD_CHANNEL_CONNECTION_FAILED, status);
+}
+
+static void cmd_channel_linux_test_static_init (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel = cmd_channel_linux_static_init (&state, 3,
+		CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	struct cmd_packet packet;
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init_state (&channel);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 3, cmd_channel_get_id (&channel.base));
+
+	status = channel.base.receive_packet (&channel.base, &packet, 0);
+	CuAssertIntEquals (test, CMD_CHANNEL_RX_TIMEOUT, status);
+
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_static_init_null (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel = cmd_channel_linux_static_init (&state, 3,
+		CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init_state (NULL);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+
+	channel.state = NULL;
+	status = cmd_channel_linux_init_state (&channel);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+}
+
+static void cmd_channel_linux_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	cmd_channel_linux_release (NULL);
+}
+
+static void cmd_channel_linux_test_receive_and_send (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct cmd_packet packet;
+	uint8_t tx[32];
+	uint8_t rx[CMD_MAX_PACKET_SIZE];
+	int fd[2];
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = socketpair (AF_UNIX, SOCK_SEQPACKET, 0, fd);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_channel_linux_add_client (&channel, fd[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_channel_linux_testing_build_packet (tx, 0x10, 0x55, sizeof (tx));
+	status = send (fd[1], tx, sizeof (tx), 0);
+	CuAssertIntEquals (test, sizeof (tx), status);
+
+	status = channel.base.receive_packet (&channel.base, &packet, 1000);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, sizeof (tx), packet.pkt_size);
+	CuAssertIntEquals (test, CMD_CHANNEL_LINUX_TESTING_ADDRESS, packet.dest_addr);
+	CuAssertIntEquals (test, CMD_VALID_PACKET, packet.state);
+	CuAssertIntEquals (test, false, packet.timeout_valid);
+
+	status = testing_validate_array (tx, packet.data, sizeof (tx));
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_channel_linux_testing_build_packet (packet.data, CMD_CHANNEL_LINUX_TESTING_ADDRESS, 0xaa,
+		16);
+	packet.pkt_size = 16;
+	packet.dest_addr = 0x10;
+
+	status = channel.base.send_packet (&channel.base, &packet);
+	CuAssertIntEquals (test, 0, status);
+
+	status = recv (fd[1], rx, sizeof (rx), 0);
+	CuAssertIntEquals (test, 16, status);
+
+	status = testing_validate_array (packet.data, rx, 16);
+	CuAssertIntEquals (test, 0, status);
+
+	close (fd[1]);
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_receive_multiple_clients (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct cmd_packet packet;
+	uint8_t tx[16];
+	uint8_t rx[CMD_MAX_PACKET_SIZE];
+	int fd[4][2];
+	int client;
+	int status;
+	int i;
+	int j;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < 4; i++) {
+		status = socketpair (AF_UNIX, SOCK_SEQPACKET, 0, fd[i]);
+		CuAssertIntEquals (test, 0, status);
+
+		status = cmd_channel_linux_add_client (&channel, fd[i][0]);
+		CuAssertIntEquals (test, 0, status);
+
+		/* Every client uses the same address, so routing depends only on the socket. */
+		cmd_channel_linux_testing_build_packet (tx, CMD_CHANNEL_LINUX_TESTING_CLIENT_ADDRESS, i,
+			sizeof (tx));
+		status = send (fd[i][1], tx, sizeof (tx), 0);
+		CuAssertIntEquals (test, sizeof (tx), status);
+	}
+
+	for (i = 0; i < 4; i++) {
+		status = channel.base.receive_packet (&channel.base, &packet, 1000);
+		CuAssertIntEquals (test, 0, status);
+
+		client = packet.data[3];
+		CuAssertTrue (test, (client < 4));
+
+		/* The response must be routed back to the client that sent the request. */
+		cmd_channel_linux_testing_build_packet (packet.data, CMD_CHANNEL_LINUX_TESTING_ADDRESS,
+			0x80 + client, 12);
+		packet.pkt_size = 12;
+		packet.dest_addr = CMD_CHANNEL_LINUX_TESTING_CLIENT_ADDRESS;
+
+		status = channel.base.send_packet (&channel.base, &packet);
+		CuAssertIntEquals (test, 0, status);
+
+		for (j = 0; j < 4; j++) {
+			status = recv (fd[j][1], rx, sizeof (rx), MSG_DONTWAIT);
+			if (j == client) {
+				CuAssertIntEquals (test, 12, status);
+				CuAssertIntEquals (test, 0x80 + client, rx[3]);
+			}
+			else {
+				CuAssertIntEquals (test, -1, status);
+			}
+		}
+	}
+
+	status = channel.base.receive_packet (&channel.base, &packet, 0);
+	CuAssertIntEquals (test, CMD_CHANNEL_RX_TIMEOUT, status);
+
+	for (i = 0; i < 4; i++) {
+		close (fd[i][1]);
+	}
+
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_receive_timeout (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct cmd_packet packet;
+	platform_clock start;
+	platform_clock end;
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_init_current_tick (&start);
+
+	status = channel.base.receive_packet (&channel.base, &packet, 100);
+	CuAssertIntEquals (test, CMD_CHANNEL_RX_TIMEOUT, status);
+
+	platform_init_current_tick (&end);
+	CuAssertTrue (test, (platform_get_duration (&start, &end) >= 100));
+	CuAssertTrue (test, (platform_get_duration (&start, &end) < 200));
+
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_receive_wake (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct cmd_packet packet;
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_channel_linux_wake (&channel);
+	CuAssertIntEquals (test, 0, status);
+
+	/* This would block forever without the wake signal. */
+	status = channel.base.receive_packet (&channel.base, &packet, -1);
+	CuAssertIntEquals (test, CMD_CHANNEL_RX_TIMEOUT, status);
+
+	status = channel.base.receive_packet (&channel.base, &packet, 0);
+	CuAssertIntEquals (test, CMD_CHANNEL_RX_TIMEOUT, status);
+
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_receive_oversized_packet (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct cmd_packet packet;
+	uint8_t tx[CMD_MAX_PACKET_SIZE + 16];
+	int fd[2];
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = socketpair (AF_UNIX, SOCK_SEQPACKET, 0, fd);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_channel_linux_add_client (&channel, fd[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_channel_linux_testing_build_packet (tx, 0x10, 0x11, sizeof (tx));
+	status = send (fd[1], tx, sizeof (tx), 0);
+	CuAssertIntEquals (test, sizeof (tx), status);
+
+	cmd_channel_linux_testing_build_packet (tx, 0x10, 0x22, 20);
+	status = send (fd[1], tx, 20, 0);
+	CuAssertIntEquals (test, 20, status);
+
+	status = channel.base.receive_packet (&channel.base, &packet, 1000);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 20, packet.pkt_size);
+	CuAssertIntEquals (test, 0x22, packet.data[3]);
+
+	close (fd[1]);
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_client_disconnect (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct cmd_packet packet;
+	uint8_t tx[16];
+	int fd[2];
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	status = socketpair (AF_UNIX, SOCK_SEQPACKET, 0, fd);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_channel_linux_add_client (&channel, fd[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_channel_linux_testing_build_packet (tx, 0x10, 0x55, sizeof (tx));
+	status = send (fd[1], tx, sizeof (tx), 0);
+	CuAssertIntEquals (test, sizeof (tx), status);
+
+	status = channel.base.receive_packet (&channel.base, &packet, 1000);
+	CuAssertIntEquals (test, 0, status);
+
+	close (fd[1]);
+
+	status = channel.base.receive_packet (&channel.base, &packet, 10);
+	CuAssertIntEquals (test, CMD_CHANNEL_RX_TIMEOUT, status);
+
+	/* A new client using the same slot must not get the response for the disconnected client. */
+	status = socketpair (AF_UNIX, SOCK_SEQPACKET, 0, fd);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_channel_linux_add_client (&channel, fd[0]);
+	CuAssertIntEquals (test, 0, status);
+
+	packet.dest_addr = 0x10;
+	status = channel.base.send_packet (&channel.base, &packet);
+	CuAssertIntEquals (test, CMD_CHANNEL_TX_FAILED, status);
+
+	status = recv (fd[1], tx, sizeof (tx), MSG_DONTWAIT);
+	CuAssertIntEquals (test, -1, status);
+
+	close (fd[1]);
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_send_no_client (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct cmd_packet packet;
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	cmd_channel_linux_testing_build_packet (packet.data, CMD_CHANNEL_LINUX_TESTING_ADDRESS, 0, 16);
+	packet.pkt_size = 16;
+	packet.dest_addr = 0x10;
+
+	status = channel.base.send_packet (&channel.base, &packet);
+	CuAssertIntEquals (test, CMD_CHANNEL_TX_FAILED, status);
+
+	packet.pkt_size = 0;
+	status = channel.base.send_packet (&channel.base, &packet);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_PKT_SIZE, status);
+
+	status = channel.base.send_packet (&channel.base, NULL);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+
+	status = channel.base.receive_packet (&channel.base, NULL, 0);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_add_client_full (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	int fd[CMD_CHANNEL_LINUX_MAX_CLIENTS + 1][2];
+	int status;
+	int i;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS, NULL);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < CMD_CHANNEL_LINUX_MAX_CLIENTS; i++) {
+		status = socketpair (AF_UNIX, SOCK_SEQPACKET, 0, fd[i]);
+		CuAssertIntEquals (test, 0, status);
+
+		status = cmd_channel_linux_add_client (&channel, fd[i][0]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	status = socketpair (AF_UNIX, SOCK_SEQPACKET, 0, fd[i]);
+	CuAssertIntEquals (test, 0, status);
+
+	status = cmd_channel_linux_add_client (&channel, fd[i][0]);
+	CuAssertIntEquals (test, CMD_CHANNEL_NO_MEMORY, status);
+
+	close (fd[i][0]);
+	for (i = 0; i <= CMD_CHANNEL_LINUX_MAX_CLIENTS; i++) {
+		close (fd[i][1]);
+	}
+
+	status = cmd_channel_linux_add_client (NULL, 0);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+
+	status = cmd_channel_linux_add_client (&channel, -1);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_concurrent_clients (CuTest *test)
+{
+	struct cmd_channel_linux_state state;
+	struct cmd_channel_linux channel;
+	struct cmd_channel_linux_testing_server server;
+	struct cmd_channel_linux_testing_client client[CMD_CHANNEL_LINUX_TESTING_CLIENTS];
+	pthread_t server_thread;
+	pthread_t client_thread[CMD_CHANNEL_LINUX_TESTING_CLIENTS];
+	int status;
+	int i;
+
+	TEST_START;
+
+	status = cmd_channel_linux_init (&channel, &state, 2, CMD_CHANNEL_LINUX_TESTING_ADDRESS,
+		CMD_CHANNEL_LINUX_TESTING_PATH);
+	CuAssertIntEquals (test, 0, status);
+
+	server.channel = &channel;
+	server.done = 0;
+	server.packets = 0;
+	server.failures = 0;
+
+	status = pthread_create (&server_thread, NULL, cmd_channel_linux_testing_server_task, &server);
+	CuAssertIntEquals (test, 0, status);
+
+	for (i = 0; i < CMD_CHANNEL_LINUX_TESTING_CLIENTS; i++) {
+		client[i].id = i * 16;
+		client[i].failures = 0;
+
+		status = pthread_create (&client_thread[i], NULL, cmd_channel_linux_testing_client_task,
+			&client[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	for (i = 0; i < CMD_CHANNEL_LINUX_TESTING_CLIENTS; i++) {
+		pthread_join (client_thread[i], NULL);
+		CuAssertIntEquals (test, 0, client[i].failures);
+	}
+
+	server.done = 1;
+	cmd_channel_linux_wake (&channel);
+	pthread_join (server_thread, NULL);
+
+	CuAssertIntEquals (test, 0, server.failures);
+	CuAssertIntEquals (test, CMD_CHANNEL_LINUX_TESTING_CLIENTS * CMD_CHANNEL_LINUX_TESTING_REQUESTS,
+		server.packets);
+
+	cmd_channel_linux_release (&channel);
+}
+
+static void cmd_channel_linux_test_wake_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = cmd_channel_linux_wake (NULL);
+	CuAssertIntEquals (test, CMD_CHANNEL_INVALID_ARGUMENT, status);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (cmd_channel_linux);
+
+TEST (cmd_channel_linux_test_init);
+TEST (cmd_channel_linux_test_init_with_path);
+TEST (cmd_channel_linux_test_init_null);
+TEST (cmd_channel_linux_test_init_bad_path);
+TEST (cmd_channel_linux_test_static_init);
+TEST (cmd_channel_linux_test_static_init_null);
+TEST (cmd_channel_linux_test_release_null);
+TEST (cmd_channel_linux_test_receive_and_send);
+TEST (cmd_channel_linux_test_receive_multiple_clients);
+TEST (cmd_channel_linux_test_receive_timeout);
+TEST (cmd_channel_linux_test_receive_wake);
+TEST (cmd_channel_linux_test_receive_oversized_packet);
+TEST (cmd_channel_linux_test_client_disconnect);
+TEST (cmd_channel_linux_test_send_no_client);
+TEST (cmd_channel_linux_test_add_client_full);
+TEST (cmd_channel_linux_test_concurrent_clients);
+TEST (cmd_channel_linux_test_wake_null);
+
+TEST_SUITE_END;
+// *INDENT-ON*
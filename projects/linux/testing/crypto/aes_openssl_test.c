@@ -32,6 +32,13 @@ static void aes_openssl_test_init (CuTest *test)
 	CuAssertPtrNotNull (test, engine.base.decrypt_data);
 	CuAssertPtrNotNull (test, engine.base.encrypt_with_add_data);
 	CuAssertPtrNotNull (test, engine.base.decrypt_with_add_data);
+	CuAssertPtrNotNull (test, engine.base.start_encrypt);
+	CuAssertPtrNotNull (test, engine.base.start_decrypt);
+	CuAssertPtrNotNull (test, engine.base.update_add_data);
+	CuAssertPtrNotNull (test, engine.base.update);
+	CuAssertPtrNotNull (test, engine.base.finish_encrypt);
+	CuAssertPtrNotNull (test, engine.base.finish_decrypt);
+	CuAssertPtrNotNull (test, engine.base.cancel);
 
 	aes_openssl_release (&engine);
 }
@@ -653,6 +660,644 @@ static void aes_openssl_test_encrypt_with_different_keys (CuTest *test)
 }
 
 
+static void aes_openssl_test_encrypt_with_add_data (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.encrypt_with_add_data (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN,
+		AES_IV, AES_IV_LEN, AES_ADD_DATA, AES_ADD_DATA_LEN, ciphertext, sizeof (ciphertext), tag,
+		sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_CIPHERTEXT, ciphertext, AES_PLAINTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_ADD_DATA_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_encrypt_with_add_data_no_additional_data (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.encrypt_with_add_data (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN,
+		AES_IV, AES_IV_LEN, NULL, 0, ciphertext, sizeof (ciphertext), tag, sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_CIPHERTEXT, ciphertext, AES_PLAINTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_decrypt_with_add_data (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t plaintext[AES_PLAINTEXT_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.decrypt_with_add_data (&engine.base, AES_CIPHERTEXT, AES_CIPHERTEXT_LEN,
+		AES_GCM_ADD_DATA_TAG, AES_IV, AES_IV_LEN, AES_ADD_DATA, AES_ADD_DATA_LEN, plaintext,
+		sizeof (plaintext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_PLAINTEXT, plaintext, AES_CIPHERTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_decrypt_with_add_data_bad_add_data (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t plaintext[AES_PLAINTEXT_LEN * 2];
+	uint8_t add_data[AES_ADD_DATA_LEN];
+
+	TEST_START;
+
+	memcpy (add_data, AES_ADD_DATA, AES_ADD_DATA_LEN);
+	add_data[0] ^= 0x55;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.decrypt_with_add_data (&engine.base, AES_CIPHERTEXT, AES_CIPHERTEXT_LEN,
+		AES_GCM_ADD_DATA_TAG, AES_IV, AES_IV_LEN, add_data, sizeof (add_data), plaintext,
+		sizeof (plaintext));
+	CuAssertIntEquals (test, AES_ENGINE_GCM_AUTH_FAILED, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_encrypt (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (&engine.base, AES_ADD_DATA, AES_ADD_DATA_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, 32, ciphertext, sizeof (ciphertext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, &AES_PLAINTEXT[32], AES_PLAINTEXT_LEN - 32,
+		&ciphertext[32], sizeof (ciphertext) - 32);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_CIPHERTEXT, ciphertext, AES_PLAINTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_ADD_DATA_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_encrypt_no_additional_data (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, ciphertext,
+		sizeof (ciphertext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_CIPHERTEXT, ciphertext, AES_PLAINTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_encrypt_multiple_add_data (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (&engine.base, AES_ADD_DATA, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (&engine.base, &AES_ADD_DATA[2], AES_ADD_DATA_LEN - 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, ciphertext,
+		sizeof (ciphertext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_CIPHERTEXT, ciphertext, AES_PLAINTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_ADD_DATA_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_encrypt_same_buffer (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	memcpy (ciphertext, AES_PLAINTEXT, AES_PLAINTEXT_LEN);
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (&engine.base, AES_ADD_DATA, AES_ADD_DATA_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, ciphertext, 64, ciphertext, sizeof (ciphertext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, &ciphertext[64], AES_PLAINTEXT_LEN - 64,
+		&ciphertext[64], sizeof (ciphertext) - 64);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_CIPHERTEXT, ciphertext, AES_PLAINTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_ADD_DATA_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_decrypt (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t plaintext[AES_PLAINTEXT_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_decrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (&engine.base, AES_ADD_DATA, AES_ADD_DATA_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, AES_CIPHERTEXT, 48, plaintext, sizeof (plaintext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, &AES_CIPHERTEXT[48], AES_CIPHERTEXT_LEN - 48,
+		&plaintext[48], sizeof (plaintext) - 48);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_decrypt (&engine.base, AES_GCM_ADD_DATA_TAG);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_PLAINTEXT, plaintext, AES_CIPHERTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_decrypt_bad_tag (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t plaintext[AES_PLAINTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN];
+
+	TEST_START;
+
+	memcpy (tag, AES_GCM_ADD_DATA_TAG, AES_GCM_TAG_LEN);
+	tag[0] ^= 0x55;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_decrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (&engine.base, AES_ADD_DATA, AES_ADD_DATA_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, AES_CIPHERTEXT, AES_CIPHERTEXT_LEN, plaintext,
+		sizeof (plaintext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_decrypt (&engine.base, tag);
+	CuAssertIntEquals (test, AES_ENGINE_GCM_AUTH_FAILED, status);
+
+	/* The failed operation is no longer active. */
+	status = engine.base.decrypt_with_add_data (&engine.base, AES_CIPHERTEXT, AES_CIPHERTEXT_LEN,
+		AES_GCM_ADD_DATA_TAG, AES_IV, AES_IV_LEN, AES_ADD_DATA, AES_ADD_DATA_LEN, plaintext,
+		sizeof (plaintext));
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_cancel (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, 32, ciphertext, sizeof (ciphertext));
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, AES_ENGINE_NO_ACTIVE_OPERATION, status);
+
+	status = engine.base.encrypt_data (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, AES_IV,
+		AES_IV_LEN, ciphertext, sizeof (ciphertext), tag, sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_CIPHERTEXT, ciphertext, AES_PLAINTEXT_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_cancel_null (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (NULL);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_null (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (NULL, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.start_encrypt (&engine.base, NULL, AES_IV_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, 0);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.start_decrypt (NULL, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.start_decrypt (&engine.base, NULL, AES_IV_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.start_decrypt (&engine.base, AES_IV, 0);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (NULL, AES_ADD_DATA, AES_ADD_DATA_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.update_add_data (&engine.base, NULL, AES_ADD_DATA_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.update (NULL, AES_PLAINTEXT, AES_PLAINTEXT_LEN, ciphertext,
+		sizeof (ciphertext));
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.update (&engine.base, NULL, AES_PLAINTEXT_LEN, ciphertext,
+		sizeof (ciphertext));
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, NULL,
+		sizeof (ciphertext));
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.finish_encrypt (NULL, tag, sizeof (tag));
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.finish_encrypt (&engine.base, NULL, sizeof (tag));
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.finish_decrypt (NULL, AES_GCM_TAG);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.finish_decrypt (&engine.base, NULL);
+	CuAssertIntEquals (test, AES_ENGINE_INVALID_ARGUMENT, status);
+
+	/* The operation is still active after argument errors. */
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, ciphertext,
+		sizeof (ciphertext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_small_buffer (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, ciphertext,
+		AES_PLAINTEXT_LEN - 1);
+	CuAssertIntEquals (test, AES_ENGINE_OUT_BUFFER_TOO_SMALL, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, ciphertext,
+		sizeof (ciphertext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, AES_GCM_TAG_LEN - 1);
+	CuAssertIntEquals (test, AES_ENGINE_OUT_BUFFER_TOO_SMALL, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (AES_GCM_TAG, tag, AES_GCM_TAG_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_no_active_operation (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (&engine.base, AES_ADD_DATA, AES_ADD_DATA_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_NO_ACTIVE_OPERATION, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, ciphertext,
+		sizeof (ciphertext));
+	CuAssertIntEquals (test, AES_ENGINE_NO_ACTIVE_OPERATION, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, AES_ENGINE_NO_ACTIVE_OPERATION, status);
+
+	status = engine.base.finish_decrypt (&engine.base, AES_GCM_TAG);
+	CuAssertIntEquals (test, AES_ENGINE_NO_ACTIVE_OPERATION, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_finish_wrong_type (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_decrypt (&engine.base, AES_GCM_TAG);
+	CuAssertIntEquals (test, AES_ENGINE_NO_ACTIVE_OPERATION, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = engine.base.start_decrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish_encrypt (&engine.base, tag, sizeof (tag));
+	CuAssertIntEquals (test, AES_ENGINE_NO_ACTIVE_OPERATION, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_operation_in_progress (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+	uint8_t tag[AES_GCM_TAG_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_OPERATION_IN_PROGRESS, status);
+
+	status = engine.base.start_decrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_OPERATION_IN_PROGRESS, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, AES_ENGINE_OPERATION_IN_PROGRESS, status);
+
+	status = engine.base.encrypt_data (&engine.base, AES_PLAINTEXT, AES_PLAINTEXT_LEN, AES_IV,
+		AES_IV_LEN, ciphertext, sizeof (ciphertext), tag, sizeof (tag));
+	CuAssertIntEquals (test, AES_ENGINE_OPERATION_IN_PROGRESS, status);
+
+	status = engine.base.decrypt_data (&engine.base, AES_CIPHERTEXT, AES_CIPHERTEXT_LEN,
+		AES_GCM_TAG, AES_IV, AES_IV_LEN, ciphertext, sizeof (ciphertext));
+	CuAssertIntEquals (test, AES_ENGINE_OPERATION_IN_PROGRESS, status);
+
+	aes_openssl_release (&engine);
+}
+
+static void aes_openssl_test_stream_add_data_after_data (CuTest *test)
+{
+	struct aes_engine_openssl engine;
+	int status;
+	uint8_t ciphertext[AES_CIPHERTEXT_LEN * 2];
+
+	TEST_START;
+
+	status = aes_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.set_key (&engine.base, AES_KEY, AES_KEY_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_encrypt (&engine.base, AES_IV, AES_IV_LEN);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, AES_PLAINTEXT, 32, ciphertext, sizeof (ciphertext));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update_add_data (&engine.base, AES_ADD_DATA, AES_ADD_DATA_LEN);
+	CuAssertIntEquals (test, AES_UNSUPPORTED_OPERATION, status);
+
+	aes_openssl_release (&engine);
+}
+
 TEST_SUITE_START (aes_openssl);
 
 TEST (aes_openssl_test_init);
@@ -680,5 +1325,23 @@ TEST (aes_openssl_test_encrypt_and_decrypt);
 TEST (aes_openssl_test_encrypt_with_longer_iv);
 TEST (aes_openssl_test_encrypt_with_shorter_iv);
 TEST (aes_openssl_test_encrypt_with_different_keys);
+TEST (aes_openssl_test_encrypt_with_add_data);
+TEST (aes_openssl_test_encrypt_with_add_data_no_additional_data);
+TEST (aes_openssl_test_decrypt_with_add_data);
+TEST (aes_openssl_test_decrypt_with_add_data_bad_add_data);
+TEST (aes_openssl_test_stream_encrypt);
+TEST (aes_openssl_test_stream_encrypt_no_additional_data);
+TEST (aes_openssl_test_stream_encrypt_multiple_add_data);
+TEST (aes_openssl_test_stream_encrypt_same_buffer);
+TEST (aes_openssl_test_stream_decrypt);
+TEST (aes_openssl_test_stream_decrypt_bad_tag);
+TEST (aes_openssl_test_stream_cancel);
+TEST (aes_openssl_test_stream_cancel_null);
+TEST (aes_openssl_test_stream_null);
+TEST (aes_openssl_test_stream_small_buffer);
+TEST (aes_openssl_test_stream_no_active_operation);
+TEST (aes_openssl_test_stream_finish_wrong_type);
+TEST (aes_openssl_test_stream_operation_in_progress);
+TEST (aes_openssl_test_stream_add_data_after_data);
 
 TEST_SUITE_END;
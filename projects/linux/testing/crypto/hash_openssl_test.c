@@ -4705,6 +4705,454 @@ static void hash_openssl_test_incremental_get_hash_no_start (CuTest *test)
 	hash_openssl_release (&engine);
 }
 
+#ifdef HASH_ENABLE_SHA1
+static void hash_openssl_test_sha1_save_and_restore_context (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA1_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha1 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, HASH_ACTIVE_SHA1, context.active);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA1_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA1_TEST_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The saved context can be restored again. */
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA1_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_openssl_release (&engine);
+}
+#endif
+
+static void hash_openssl_test_sha256_save_and_restore_context (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, HASH_ACTIVE_SHA256, context.active);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The saved context can be restored again. */
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_openssl_release (&engine);
+}
+
+#ifdef HASH_ENABLE_SHA384
+static void hash_openssl_test_sha384_save_and_restore_context (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA384_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha384 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, HASH_ACTIVE_SHA384, context.active);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA384_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA384_TEST_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The saved context can be restored again. */
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA384_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_openssl_release (&engine);
+}
+#endif
+
+#ifdef HASH_ENABLE_SHA512
+static void hash_openssl_test_sha512_save_and_restore_context (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA512_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha512 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, HASH_ACTIVE_SHA512, context.active);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA512_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA512_TEST_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	/* The saved context can be restored again. */
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA512_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_openssl_release (&engine);
+}
+#endif
+
+static void hash_openssl_test_restore_context_different_engine (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_engine_openssl engine2;
+	struct hash_context context;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_openssl_init (&engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine2.base.restore_context (&engine2.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine2.base.update (&engine2.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine2.base.finish (&engine2.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_openssl_release (&engine);
+	hash_openssl_release (&engine2);
+}
+
+static void hash_openssl_test_clone_context (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_engine_openssl engine2;
+	int status;
+	char *message = "Test";
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_openssl_init (&engine2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = hash_clone_context (&engine.base, &engine2.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.update (&engine.base, (uint8_t*) message, strlen (message));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine2.base.finish (&engine2.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	status = testing_validate_array (SHA256_TEST_HASH, hash, sizeof (hash));
+	CuAssertIntEquals (test, 0, status);
+
+	hash_openssl_release (&engine);
+	hash_openssl_release (&engine2);
+}
+
+static void hash_openssl_test_save_context_null (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (NULL, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.save_context (&engine.base, NULL);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	engine.base.cancel (&engine.base);
+
+	hash_openssl_release (&engine);
+}
+
+static void hash_openssl_test_save_context_no_start (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	hash_openssl_release (&engine);
+}
+
+static void hash_openssl_test_restore_context_null (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	status = engine.base.restore_context (NULL, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	status = engine.base.restore_context (&engine.base, NULL);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_ARGUMENT, status);
+
+	hash_openssl_release (&engine);
+}
+
+static void hash_openssl_test_restore_context_hash_in_progress (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_HASH_IN_PROGRESS, status);
+
+	engine.base.cancel (&engine.base);
+
+	hash_openssl_release (&engine);
+}
+
+static void hash_openssl_test_restore_context_invalid_context (CuTest *test)
+{
+	struct hash_engine_openssl engine;
+	struct hash_context context;
+	int status;
+	uint8_t hash[SHA256_HASH_LENGTH];
+
+	TEST_START;
+
+	status = hash_openssl_init (&engine);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.start_sha256 (&engine.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = engine.base.save_context (&engine.base, &context);
+	CuAssertIntEquals (test, 0, status);
+
+	engine.base.cancel (&engine.base);
+
+	context.length--;
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_CONTEXT, status);
+
+	context.length++;
+	context.active = HASH_ACTIVE_NONE;
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_CONTEXT, status);
+
+	context.active = HASH_TYPE_INVALID;
+	status = engine.base.restore_context (&engine.base, &context);
+	CuAssertIntEquals (test, HASH_ENGINE_INVALID_CONTEXT, status);
+
+	status = engine.base.finish (&engine.base, hash, sizeof (hash));
+	CuAssertIntEquals (test, HASH_ENGINE_NO_ACTIVE_HASH, status);
+
+	hash_openssl_release (&engine);
+}
+
 #ifdef HASH_ENABLE_SHA1
 static void hash_openssl_test_calculate_sha1 (CuTest *test)
 {
@@ -5524,6 +5972,23 @@ TEST (hash_openssl_test_incremental_cancel_no_start);
 TEST (hash_openssl_test_incremental_get_hash_null);
 TEST (hash_openssl_test_incremental_get_hash_no_start);
 #ifdef HASH_ENABLE_SHA1
+TEST (hash_openssl_test_sha1_save_and_restore_context);
+#endif
+TEST (hash_openssl_test_sha256_save_and_restore_context);
+#ifdef HASH_ENABLE_SHA384
+TEST (hash_openssl_test_sha384_save_and_restore_context);
+#endif
+#ifdef HASH_ENABLE_SHA512
+TEST (hash_openssl_test_sha512_save_and_restore_context);
+#endif
+TEST (hash_openssl_test_restore_context_different_engine);
+TEST (hash_openssl_test_clone_context);
+TEST (hash_openssl_test_save_context_null);
+TEST (hash_openssl_test_save_context_no_start);
+TEST (hash_openssl_test_restore_context_null);
+TEST (hash_openssl_test_restore_context_hash_in_progress);
+TEST (hash_openssl_test_restore_context_invalid_context);
+#ifdef HASH_ENABLE_SHA1
 TEST (hash_openssl_test_calculate_sha1);
 TEST (hash_openssl_test_calculate_sha1_full_hash_block);
 TEST (hash_openssl_test_calculate_sha1_multiple_hash_blocks_not_aligned);
@@ -0,0 +1,571 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "flash/flash_virtual_ram.h"
+#include "flash/spi_flash.h"
+#include "host_fw/host_flash_manager_dual.h"
+#include "host_fw/host_fw_util.h"
+#include "host_fw/host_state_manager.h"
+#include "system/event_task_linux.h"
+#include "testing/mock/manifest/pfm/pfm_mock.h"
+#include "testing/mock/spi_filter/spi_filter_interface_mock.h"
+#include "testing/mock/spi_filter/flash_mfg_filter_handler_mock.h"
+#include "testing/engines/hash_testing_engine.h"
+#include "testing/engines/rsa_testing_engine.h"
+
+
+TEST_SUITE_LABEL ("host_flash_manager_dual_linux");
+
+
+/**
+ * Size of each host flash device.
+ */
+#define	HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_FLASH_SIZE		0x10000
+
+/**
+ * Length of the firmware image at the start of each flash device.
+ */
+#define	HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_IMAGE_LENGTH		0x8000
+
+/**
+ * Time needed to read a single byte from flash, in nanoseconds.  This is roughly a 16MHz single SPI
+ * bus, which makes flash reads the dominant cost of validation.
+ */
+#define	HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_NS_PER_BYTE		500
+
+/**
+ * Address of the version string in the firmware image.
+ */
+#define	HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_VERSION_ADDR		0x123
+
+/**
+ * Size of the flash used to store host state.
+ */
+#define	HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_STATE_SIZE		(VIRTUAL_FLASH_BLOCK_SIZE * 2)
+
+
+/**
+ * SPI master for a host flash device.  Reads are served from memory and take the amount of time
+ * the transfer would take on the SPI bus.
+ */
+struct host_flash_manager_dual_linux_testing_spi {
+	struct flash_master base;												/**< Base SPI master. */
+	uint8_t data[HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_FLASH_SIZE];			/**< Flash contents. */
+};
+
+/**
+ * Dependencies for testing parallel flash validation.
+ */
+struct host_flash_manager_dual_linux_testing {
+	HASH_TESTING_ENGINE hash;									/**< Hash engine for the caller. */
+	RSA_TESTING_ENGINE rsa;										/**< RSA engine for the caller. */
+	HASH_TESTING_ENGINE hash_task;								/**< Hash engine for the task. */
+	RSA_TESTING_ENGINE rsa_task;								/**< RSA engine for the task. */
+	struct host_flash_manager_dual_linux_testing_spi spi0;		/**< SPI master for CS0 flash. */
+	struct host_flash_manager_dual_linux_testing_spi spi1;		/**< SPI master for CS1 flash. */
+	struct spi_flash_state state0;								/**< CS0 flash context. */
+	struct spi_flash flash0;									/**< CS0 flash device. */
+	struct spi_flash_state state1;								/**< CS1 flash context. */
+	struct spi_flash flash1;									/**< CS1 flash device. */
+	struct flash_virtual_ram_state state_flash_ctx;				/**< Host state flash context. */
+	struct flash_virtual_ram state_flash;						/**< Host state flash device. */
+	struct host_state_manager host_state;						/**< Host state. */
+	struct spi_filter_interface_mock filter;					/**< Mock for the SPI filter. */
+	struct flash_mfg_filter_handler_mock handler;				/**< Mock for device config. */
+	struct pfm_mock pfm;										/**< Mock PFM for testing. */
+	struct system system;										/**< Placeholder system manager. */
+	const struct event_task_handler *list[1];					/**< Handlers for the task. */
+	struct event_task_linux_state task_state;					/**< Variable context for the task. */
+	struct event_task_linux task;								/**< Task for parallel validation. */
+	struct host_flash_manager_dual test;						/**< Flash manager under test. */
+
+	/**
+	 * Memory for the host state flash.
+	 */
+	uint8_t state_data[HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_STATE_SIZE];
+
+	/* PFM contents describing the firmware on flash. */
+	const char *fw_id;							/**< Firmware identifier. */
+	struct pfm_firmware fw_list;				/**< List of firmware components. */
+	struct pfm_firmware_version version;		/**< Firmware version entry. */
+	struct pfm_firmware_versions version_list;	/**< List of firmware versions. */
+	struct flash_region img_region;				/**< Flash region for the firmware image. */
+	struct pfm_image_hash img_hash;				/**< Hash of the firmware image. */
+	struct pfm_image_list img_list;				/**< List of firmware images. */
+	struct flash_region rw_region;				/**< Read/write region on flash. */
+	struct pfm_read_write rw_prop;				/**< Properties of the read/write region. */
+	struct pfm_read_write_regions rw_list;		/**< List of read/write regions. */
+};
+
+
+/**
+ * Version string stored on flash.
+ */
+static const char *HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_VERSION = "1234";
+
+
+/**
+ * Wait for the amount of time a flash transfer would take.
+ *
+ * @param length The number of bytes transferred.
+ */
+static void host_flash_manager_dual_linux_testing_xfer_delay (uint32_t length)
+{
+	uint64_t ns = (uint64_t) length * HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_NS_PER_BYTE;
+	struct timespec delay;
+
+	delay.tv_sec = ns / 1000000000ULL;
+	delay.tv_nsec = ns % 1000000000ULL;
+
+	nanosleep (&delay, NULL);
+}
+
+static int host_flash_manager_dual_linux_testing_xfer (const struct flash_master *spi,
+	const struct flash_xfer *xfer)
+{
+	struct host_flash_manager_dual_linux_testing_spi *flash =
+		(struct host_flash_manager_dual_linux_testing_spi*) spi;
+
+	if (flash_xfer_is_tx (xfer)) {
+		return FLASH_MASTER_XFER_FAILED;
+	}
+
+	if (flash_xfer_has_no_address (xfer)) {
+		/* Register reads report an idle device. */
+		memset (xfer->data, 0, xfer->length);
+		return 0;
+	}
+
+	if ((xfer->address + xfer->length) > sizeof (flash->data)) {
+		return FLASH_MASTER_XFER_FAILED;
+	}
+
+	memcpy (xfer->data, &flash->data[xfer->address], xfer->length);
+	host_flash_manager_dual_linux_testing_xfer_delay (xfer->length);
+
+	return 0;
+}
+
+static uint32_t host_flash_manager_dual_linux_testing_capabilities (const struct flash_master *spi)
+{
+	return FLASH_CAP_3BYTE_ADDR;
+}
+
+/**
+ * Initialize a host flash device with a valid firmware image.
+ *
+ * @param test The testing framework.
+ * @param spi The SPI master for the flash device.
+ * @param flash The flash device to initialize.
+ * @param state Variable context for the flash device.
+ */
+static void host_flash_manager_dual_linux_testing_init_flash (CuTest *test,
+	struct host_flash_manager_dual_linux_testing_spi *spi, struct spi_flash *flash,
+	struct spi_flash_state *state)
+{
+	size_t i;
+	int status;
+
+	memset (spi, 0, sizeof (*spi));
+	spi->base.xfer = host_flash_manager_dual_linux_testing_xfer;
+	spi->base.capabilities = host_flash_manager_dual_linux_testing_capabilities;
+
+	for (i = 0; i < HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_IMAGE_LENGTH; i++) {
+		spi->data[i] = i * 7;
+	}
+
+	memcpy (&spi->data[HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_VERSION_ADDR],
+		HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_VERSION,
+		strlen (HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_VERSION));
+
+	memset (&spi->data[HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_IMAGE_LENGTH], 0xff,
+		sizeof (spi->data) - HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_IMAGE_LENGTH);
+
+	status = spi_flash_init (flash, state, &spi->base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (flash, HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_FLASH_SIZE);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Initialize the PFM contents describing the firmware on flash.
+ *
+ * @param test The testing framework.
+ * @param manager The testing components.
+ */
+static void host_flash_manager_dual_linux_testing_init_pfm_data (CuTest *test,
+	struct host_flash_manager_dual_linux_testing *manager)
+{
+	int status;
+
+	manager->fw_id = NULL;
+	manager->fw_list.ids = &manager->fw_id;
+	manager->fw_list.count = 1;
+
+	manager->version.fw_version_id = HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_VERSION;
+	manager->version.version_addr = HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_VERSION_ADDR;
+	manager->version.blank_byte = 0xff;
+
+	manager->version_list.versions = &manager->version;
+	manager->version_list.count = 1;
+
+	manager->img_region.start_addr = 0;
+	manager->img_region.length = HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_IMAGE_LENGTH;
+
+	memset (&manager->img_hash, 0, sizeof (manager->img_hash));
+	manager->img_hash.regions = &manager->img_region;
+	manager->img_hash.count = 1;
+	manager->img_hash.hash_length = SHA256_HASH_LENGTH;
+	manager->img_hash.hash_type = HASH_TYPE_SHA256;
+	manager->img_hash.always_validate = 1;
+
+	status = manager->hash.base.calculate_sha256 (&manager->hash.base, manager->spi0.data,
+		HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_IMAGE_LENGTH, manager->img_hash.hash,
+		sizeof (manager->img_hash.hash));
+	CuAssertIntEquals (test, 0, status);
+
+	manager->img_list.images_sig = NULL;
+	manager->img_list.images_hash = &manager->img_hash;
+	manager->img_list.count = 1;
+
+	manager->rw_region.start_addr = HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_IMAGE_LENGTH;
+	manager->rw_region.length = 0x1000;
+
+	manager->rw_prop.on_failure = PFM_RW_DO_NOTHING;
+
+	manager->rw_list.regions = &manager->rw_region;
+	manager->rw_list.properties = &manager->rw_prop;
+	manager->rw_list.count = 1;
+}
+
+/**
+ * Initialize a dual flash manager with parallel validation running on a Linux event task.
+ *
+ * @param test The testing framework.
+ * @param manager The testing components to initialize.
+ */
+static void host_flash_manager_dual_linux_testing_init (CuTest *test,
+	struct host_flash_manager_dual_linux_testing *manager)
+{
+	int status;
+
+	status = HASH_TESTING_ENGINE_INIT (&manager->hash);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&manager->rsa);
+	CuAssertIntEquals (test, 0, status);
+
+	status = HASH_TESTING_ENGINE_INIT (&manager->hash_task);
+	CuAssertIntEquals (test, 0, status);
+
+	status = RSA_TESTING_ENGINE_INIT (&manager->rsa_task);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_linux_testing_init_flash (test, &manager->spi0, &manager->flash0,
+		&manager->state0);
+	host_flash_manager_dual_linux_testing_init_flash (test, &manager->spi1, &manager->flash1,
+		&manager->state1);
+
+	memset (manager->state_data, 0xff, sizeof (manager->state_data));
+
+	status = flash_virtual_ram_init (&manager->state_flash, &manager->state_flash_ctx,
+		manager->state_data, sizeof (manager->state_data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_state_manager_init (&manager->host_state, &manager->state_flash.base, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_filter_interface_mock_init (&manager->filter);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mfg_filter_handler_mock_init (&manager->handler);
+	CuAssertIntEquals (test, 0, status);
+
+	status = pfm_mock_init (&manager->pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_linux_testing_init_pfm_data (test, manager);
+
+	status = host_flash_manager_dual_init (&manager->test, &manager->flash0, &manager->flash1,
+		&manager->host_state, &manager->filter.base, &manager->handler.base);
+	CuAssertIntEquals (test, 0, status);
+
+	manager->list[0] = &manager->test.base_event;
+
+	status = event_task_linux_init (&manager->task, &manager->task_state, &manager->system,
+		manager->list, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = host_flash_manager_dual_enable_parallel_validation (&manager->test,
+		&manager->task.base, &manager->hash_task.base, &manager->rsa_task.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_linux_start (&manager->task);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release all testing components and validate all mocks.
+ *
+ * @param test The testing framework.
+ * @param manager The testing components to release.
+ */
+static void host_flash_manager_dual_linux_testing_release (CuTest *test,
+	struct host_flash_manager_dual_linux_testing *manager)
+{
+	int status;
+
+	event_task_linux_release (&manager->task);
+	host_flash_manager_dual_release (&manager->test);
+
+	status = pfm_mock_validate_and_release (&manager->pfm);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_filter_interface_mock_validate_and_release (&manager->filter);
+	CuAssertIntEquals (test, 0, status);
+
+	status = flash_mfg_filter_handler_mock_validate_and_release (&manager->handler);
+	CuAssertIntEquals (test, 0, status);
+
+	host_state_manager_release (&manager->host_state);
+	flash_virtual_ram_release (&manager->state_flash);
+
+	spi_flash_release (&manager->flash0);
+	spi_flash_release (&manager->flash1);
+
+	HASH_TESTING_ENGINE_RELEASE (&manager->hash);
+	RSA_TESTING_ENGINE_RELEASE (&manager->rsa);
+	HASH_TESTING_ENGINE_RELEASE (&manager->hash_task);
+	RSA_TESTING_ENGINE_RELEASE (&manager->rsa_task);
+}
+
+/**
+ * Set up the expectations for querying the PFM before validating one flash device.
+ *
+ * @param manager The testing components.
+ * @param saved Starting index for the saved PFM arguments.  Four indexes are used.
+ *
+ * @return 0 if the expectations were added successfully or non-zero if not.
+ */
+static int host_flash_manager_dual_linux_testing_expect_prepare (
+	struct host_flash_manager_dual_linux_testing *manager, int saved)
+{
+	const char *version = HOST_FLASH_MANAGER_DUAL_LINUX_TESTING_VERSION;
+	int status;
+
+	status = mock_expect (&manager->pfm.mock, manager->pfm.base.get_firmware, &manager->pfm, 0,
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager->pfm.mock, 0, &manager->fw_list,
+		sizeof (manager->fw_list), -1);
+	status |= mock_expect_save_arg (&manager->pfm.mock, 0, saved);
+
+	status |= mock_expect (&manager->pfm.mock, manager->pfm.base.get_supported_versions,
+		&manager->pfm, 0, MOCK_ARG_PTR (NULL), MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager->pfm.mock, 1, &manager->version_list,
+		sizeof (manager->version_list), -1);
+	status |= mock_expect_save_arg (&manager->pfm.mock, 1, saved + 1);
+
+	status |= mock_expect (&manager->pfm.mock, manager->pfm.base.get_firmware_images,
+		&manager->pfm, 0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version, strlen (version) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager->pfm.mock, 2, &manager->img_list,
+		sizeof (manager->img_list), -1);
+	status |= mock_expect_save_arg (&manager->pfm.mock, 2, saved + 2);
+
+	status |= mock_expect (&manager->pfm.mock, manager->pfm.base.get_read_write_regions,
+		&manager->pfm, 0, MOCK_ARG_PTR (NULL), MOCK_ARG_PTR_CONTAINS (version, strlen (version) + 1),
+		MOCK_ARG_NOT_NULL);
+	status |= mock_expect_output (&manager->pfm.mock, 2, &manager->rw_list,
+		sizeof (manager->rw_list), -1);
+	status |= mock_expect_save_arg (&manager->pfm.mock, 2, saved + 3);
+
+	status |= mock_expect (&manager->pfm.mock, manager->pfm.base.free_fw_versions, &manager->pfm,
+		0, MOCK_ARG_SAVED_ARG (saved + 1));
+
+	return status;
+}
+
+/**
+ * Set up the expectations for releasing PFM data after validating one flash device.
+ *
+ * @param manager The testing components.
+ * @param saved Starting index for the saved PFM arguments used during preparation.
+ *
+ * @return 0 if the expectations were added successfully or non-zero if not.
+ */
+static int host_flash_manager_dual_linux_testing_expect_finish (
+	struct host_flash_manager_dual_linux_testing *manager, int saved)
+{
+	int status;
+
+	status = mock_expect (&manager->pfm.mock, manager->pfm.base.free_firmware_images,
+		&manager->pfm, 0, MOCK_ARG_SAVED_ARG (saved + 2));
+	status |= mock_expect (&manager->pfm.mock, manager->pfm.base.free_firmware, &manager->pfm, 0,
+		MOCK_ARG_SAVED_ARG (saved));
+
+	return status;
+}
+
+/**
+ * Release the read/write regions returned by flash validation.
+ *
+ * @param test The testing framework.
+ * @param manager The testing components.
+ * @param host_rw The read/write regions to release.
+ * @param saved Starting index for the saved PFM arguments used during preparation.
+ */
+static void host_flash_manager_dual_linux_testing_free_rw (CuTest *test,
+	struct host_flash_manager_dual_linux_testing *manager,
+	struct host_flash_manager_rw_regions *host_rw, int saved)
+{
+	int status;
+
+	status = mock_expect (&manager->pfm.mock, manager->pfm.base.free_read_write_regions,
+		&manager->pfm, 0, MOCK_ARG_SAVED_ARG (saved + 3));
+	CuAssertIntEquals (test, 0, status);
+
+	manager->test.base.free_read_write_regions (&manager->test.base, host_rw);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void host_flash_manager_dual_linux_test_validate_flash_parallel_speedup (CuTest *test)
+{
+	struct host_flash_manager_dual_linux_testing *manager;
+	struct host_flash_manager_rw_regions rw_output;
+	struct host_flash_manager_rw_regions ro_output;
+	platform_clock start;
+	platform_clock end;
+	uint32_t sequential;
+	uint32_t parallel;
+	int ro_status;
+	int status;
+
+	TEST_START;
+
+	manager = platform_malloc (sizeof (struct host_flash_manager_dual_linux_testing));
+	CuAssertPtrNotNull (test, manager);
+
+	host_flash_manager_dual_linux_testing_init (test, manager);
+
+	/* Validate each flash device one after the other. */
+	status = host_flash_manager_dual_linux_testing_expect_prepare (manager, 0);
+	status |= host_flash_manager_dual_linux_testing_expect_finish (manager, 0);
+	status |= host_flash_manager_dual_linux_testing_expect_prepare (manager, 4);
+	status |= host_flash_manager_dual_linux_testing_expect_finish (manager, 4);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_init_current_tick (&start);
+
+	status = manager->test.base.validate_read_write_flash (&manager->test.base,
+		&manager->pfm.base, &manager->hash.base, &manager->rsa.base, &rw_output);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager->test.base.validate_read_only_flash (&manager->test.base,
+		&manager->pfm.base, NULL, &manager->hash.base, &manager->rsa.base, true, &ro_output);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_init_current_tick (&end);
+	sequential = platform_get_duration (&start, &end);
+
+	status = mock_validate (&manager->pfm.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_linux_testing_free_rw (test, manager, &rw_output, 0);
+	host_flash_manager_dual_linux_testing_free_rw (test, manager, &ro_output, 4);
+
+	/* Validate both flash devices at the same time.  All PFM accesses happen from this context. */
+	status = host_flash_manager_dual_linux_testing_expect_prepare (manager, 8);
+	status |= host_flash_manager_dual_linux_testing_expect_prepare (manager, 12);
+	status |= host_flash_manager_dual_linux_testing_expect_finish (manager, 12);
+	status |= host_flash_manager_dual_linux_testing_expect_finish (manager, 8);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_init_current_tick (&start);
+
+	status = manager->test.base.validate_flash_parallel (&manager->test.base, &manager->pfm.base,
+		NULL, &manager->hash.base, &manager->rsa.base, true, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 0, ro_status);
+
+	platform_init_current_tick (&end);
+	parallel = platform_get_duration (&start, &end);
+
+	status = mock_validate (&manager->pfm.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 1, rw_output.count);
+	CuAssertIntEquals (test, 1, ro_output.count);
+
+	host_flash_manager_dual_linux_testing_free_rw (test, manager, &rw_output, 8);
+	host_flash_manager_dual_linux_testing_free_rw (test, manager, &ro_output, 12);
+
+	/* Both devices take the same amount of time to validate, so running them in parallel should
+	 * take close to half the time.  Leave margin for a loaded build host. */
+	CuAssertTrue (test, (sequential > 0));
+	CuAssertTrue (test, ((parallel * 4) < (sequential * 3)));
+
+	host_flash_manager_dual_linux_testing_release (test, manager);
+	platform_free (manager);
+}
+
+static void host_flash_manager_dual_linux_test_validate_flash_parallel_rw_verify_error (
+	CuTest *test)
+{
+	struct host_flash_manager_dual_linux_testing *manager;
+	struct host_flash_manager_rw_regions rw_output;
+	struct host_flash_manager_rw_regions ro_output;
+	int ro_status;
+	int status;
+
+	TEST_START;
+
+	manager = platform_malloc (sizeof (struct host_flash_manager_dual_linux_testing));
+	CuAssertPtrNotNull (test, manager);
+
+	host_flash_manager_dual_linux_testing_init (test, manager);
+
+	/* Corrupt the image on the read/write flash. */
+	manager->spi1.data[0] ^= 0x55;
+
+	status = host_flash_manager_dual_linux_testing_expect_prepare (manager, 0);
+	status |= host_flash_manager_dual_linux_testing_expect_prepare (manager, 4);
+	status |= host_flash_manager_dual_linux_testing_expect_finish (manager, 4);
+	status |= mock_expect (&manager->pfm.mock, manager->pfm.base.free_read_write_regions,
+		&manager->pfm, 0, MOCK_ARG_SAVED_ARG (3));
+	status |= host_flash_manager_dual_linux_testing_expect_finish (manager, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = manager->test.base.validate_flash_parallel (&manager->test.base, &manager->pfm.base,
+		NULL, &manager->hash.base, &manager->rsa.base, true, &rw_output, &ro_output, &ro_status);
+	CuAssertIntEquals (test, HOST_FW_UTIL_BAD_IMAGE_HASH, status);
+	CuAssertIntEquals (test, 0, ro_status);
+
+	status = mock_validate (&manager->pfm.mock);
+	CuAssertIntEquals (test, 0, status);
+
+	host_flash_manager_dual_linux_testing_free_rw (test, manager, &ro_output, 4);
+
+	host_flash_manager_dual_linux_testing_release (test, manager);
+	platform_free (manager);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (host_flash_manager_dual_linux);
+
+TEST (host_flash_manager_dual_linux_test_validate_flash_parallel_speedup);
+TEST (host_flash_manager_dual_linux_test_validate_flash_parallel_rw_verify_error);
+
+TEST_SUITE_END;
+// *INDENT-ON*
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef HOST_FW_LINUX_ALL_TESTS_H_
+#define HOST_FW_LINUX_ALL_TESTS_H_
+
+#include "testing.h"
+#include "platform_all_tests.h"
+#include "common/unused.h"
+
+
+/**
+ * Add all tests for components in the 'host_fw' directory.
+ *
+ * Be sure to keep the test suites in alphabetical order for easier management.
+ *
+ * @param suite Suite to add the tests to.
+ */
+static void add_all_linux_host_fw_tests (CuSuite *suite)
+{
+	/* This is unused when no tests will be executed. */
+	UNUSED (suite);
+
+#if (defined TESTING_RUN_HOST_FLASH_MANAGER_DUAL_LINUX_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_HOST_FLASH_MANAGER_DUAL_LINUX_SUITE
+	TESTING_RUN_SUITE (host_flash_manager_dual_linux);
+#endif
+}
+
+
+#endif /* HOST_FW_LINUX_ALL_TESTS_H_ */
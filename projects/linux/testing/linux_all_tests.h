@@ -8,7 +8,10 @@
 #include "testing.h"
 #include "platform_all_tests.h"
 #include "asn1/linux_asn1_all_tests.h"
+#include "cmd_interface/linux_cmd_interface_all_tests.h"
 #include "crypto/linux_crypto_all_tests.h"
+#include "host_fw/linux_host_fw_all_tests.h"
+#include "logging/linux_logging_all_tests.h"
 #include "system/linux_system_all_tests.h"
 
 
@@ -34,7 +37,10 @@ void add_all_linux_tests (CuSuite *suite)
 	OpenSSL_add_all_algorithms ();
 
 	add_all_linux_asn1_tests (suite);
+	add_all_linux_cmd_interface_tests (suite);
 	add_all_linux_crypto_tests (suite);
+	add_all_linux_host_fw_tests (suite);
+	add_all_linux_logging_tests (suite);
 	add_all_linux_system_tests (suite);
 
 	SUITE_ADD_TEST (suite, linux_teardown);
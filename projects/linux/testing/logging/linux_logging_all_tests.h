@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#ifndef LOGGING_LINUX_ALL_TESTS_H_
+#define LOGGING_LINUX_ALL_TESTS_H_
+
+#include "testing.h"
+#include "platform_all_tests.h"
+#include "common/unused.h"
+
+
+/**
+ * Add all tests for components in the 'logging' directory.
+ *
+ * Be sure to keep the test suites in alphabetical order for easier management.
+ *
+ * @param suite Suite to add the tests to.
+ */
+static void add_all_linux_logging_tests (CuSuite *suite)
+{
+	/* This is unused when no tests will be executed. */
+	UNUSED (suite);
+
+#if (defined TESTING_RUN_LOGGING_FLASH_COMPRESSED_LINUX_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_LOGGING_FLASH_COMPRESSED_LINUX_SUITE
+	TESTING_RUN_SUITE (logging_flash_compressed_linux);
+#endif
+#if (defined TESTING_RUN_LOGGING_RING_LINUX_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_LOGGING_RING_LINUX_SUITE
+	TESTING_RUN_SUITE (logging_ring_linux);
+#endif
+}
+
+
+#endif /* LOGGING_LINUX_ALL_TESTS_H_ */
@@ -0,0 +1,326 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "flash/flash_virtual_ram.h"
+#include "logging/debug_log.h"
+#include "logging/logging_flash_compressed.h"
+
+
+TEST_SUITE_LABEL ("logging_flash_compressed_linux");
+
+
+/**
+ * Sector size of the simulated flash device.
+ */
+#define	LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTOR_SIZE	0x1000
+
+/**
+ * Number of sectors used by the log.  This is the same amount of flash used by logging_flash.
+ */
+#define	LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTORS		16
+
+/**
+ * Length of the simulated workload, in milliseconds.
+ */
+#define	LOGGING_FLASH_COMPRESSED_LINUX_TESTING_DURATION		(7ULL * 24 * 60 * 60 * 1000)
+
+/**
+ * Interval between log flushes, in milliseconds.
+ */
+#define	LOGGING_FLASH_COMPRESSED_LINUX_TESTING_FLUSH_MS		(10 * 1000)
+
+/**
+ * Interval between device resets, in milliseconds.
+ */
+#define	LOGGING_FLASH_COMPRESSED_LINUX_TESTING_RESET_MS		(24ULL * 60 * 60 * 1000)
+
+
+/**
+ * Context for the simulated workload.
+ */
+struct logging_flash_compressed_linux_testing {
+	struct flash_virtual_ram_state flash_state;		/**< Context for the virtual flash. */
+	struct flash_virtual_ram flash;					/**< Flash device for the log. */
+	struct logging_flash_compressed_state state;	/**< Context for the log. */
+	struct logging_flash_compressed log;			/**< The log being tested. */
+	struct debug_log_entry_info last;				/**< The last entry added to the log. */
+	uint32_t entries;								/**< Total number of entries created. */
+	uint32_t boot_count;							/**< Number of simulated resets. */
+	uint32_t random;								/**< State for generating workload variation. */
+
+	/**
+	 * Memory for the virtual flash device.
+	 */
+	uint8_t flash_data[LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTOR_SIZE *
+		LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTORS];
+
+	/**
+	 * Sector information for the log.
+	 */
+	struct logging_flash_compressed_sector sectors[LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTORS];
+};
+
+
+/**
+ * Report the sector size of a typical SPI flash device instead of the virtual flash block size.
+ */
+static int logging_flash_compressed_linux_testing_get_sector_size (const struct flash *flash,
+	uint32_t *bytes)
+{
+	if ((flash == NULL) || (bytes == NULL)) {
+		return FLASH_INVALID_ARGUMENT;
+	}
+
+	*bytes = LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTOR_SIZE;
+
+	return 0;
+}
+
+/**
+ * Erase a full sector of the virtual flash.
+ */
+static int logging_flash_compressed_linux_testing_sector_erase (const struct flash *flash,
+	uint32_t sector_addr)
+{
+	uint32_t offset;
+	int status;
+
+	for (offset = 0; offset < LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTOR_SIZE;
+		offset += VIRTUAL_FLASH_BLOCK_SIZE) {
+		status = flash->block_erase (flash, sector_addr + offset);
+		if (status != 0) {
+			return status;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * Get a pseudo-random value for the workload.
+ *
+ * @param workload The workload context.
+ *
+ * @return A random value.
+ */
+static uint32_t logging_flash_compressed_linux_testing_random (
+	struct logging_flash_compressed_linux_testing *workload)
+{
+	workload->random = (workload->random * 1103515245) + 12345;
+
+	return workload->random >> 8;
+}
+
+/**
+ * Add a debug log entry.
+ *
+ * @param test The testing framework.
+ * @param workload The workload context.
+ * @param severity Severity of the entry.
+ * @param component Component generating the entry.
+ * @param msg_index Message identifier for the entry.
+ * @param arg1 The first entry argument.
+ * @param arg2 The second entry argument.
+ * @param time Time since the last reset, in milliseconds.
+ */
+static void logging_flash_compressed_linux_testing_add_entry (CuTest *test,
+	struct logging_flash_compressed_linux_testing *workload, uint8_t severity, uint8_t component,
+	uint8_t msg_index, uint32_t arg1, uint32_t arg2, uint64_t time)
+{
+	int status;
+
+	workload->last.format = DEBUG_LOG_ENTRY_FORMAT;
+	workload->last.severity = severity;
+	workload->last.component = component;
+	workload->last.msg_index = msg_index;
+	workload->last.arg1 = arg1;
+	workload->last.arg2 = arg2;
+	workload->last.time = time;
+
+	status = workload->log.base.create_entry (&workload->log.base, (uint8_t*) &workload->last,
+		sizeof (workload->last));
+	CuAssertIntEquals (test, 0, status);
+
+	workload->entries++;
+}
+
+/**
+ * Simulate a device reset by reloading the log from flash.
+ *
+ * @param test The testing framework.
+ * @param workload The workload context.
+ */
+static void logging_flash_compressed_linux_testing_reset (CuTest *test,
+	struct logging_flash_compressed_linux_testing *workload)
+{
+	int status;
+
+	status = workload->log.base.flush (&workload->log.base);
+	CuAssertIntEquals (test, 0, status);
+
+	logging_flash_compressed_release (&workload->log);
+
+	status = logging_flash_compressed_init (&workload->log, &workload->state,
+		&workload->flash.base, 0, workload->sectors, LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTORS);
+	CuAssertIntEquals (test, 0, status);
+
+	workload->boot_count++;
+	logging_flash_compressed_linux_testing_add_entry (test, workload, DEBUG_LOG_SEVERITY_INFO,
+		DEBUG_LOG_COMPONENT_INIT, 0, workload->boot_count, 0, 0);
+}
+
+/**
+ * Run one second of the simulated workload.  The entry rates approximate a system that is
+ * periodically attesting devices and reporting health status, with occasional errors and host
+ * events.
+ *
+ * @param test The testing framework.
+ * @param workload The workload context.
+ * @param seconds The number of seconds since the last reset.
+ */
+static void logging_flash_compressed_linux_testing_run_second (CuTest *test,
+	struct logging_flash_compressed_linux_testing *workload, uint32_t seconds)
+{
+	uint64_t time = (seconds * 1000ULL) + (logging_flash_compressed_linux_testing_random (workload) %
+		1000);
+	uint32_t i;
+
+	if ((seconds % 60) == 0) {
+		logging_flash_compressed_linux_testing_add_entry (test, workload, DEBUG_LOG_SEVERITY_INFO,
+			DEBUG_LOG_COMPONENT_SYSTEM, 1, seconds / 60,
+			logging_flash_compressed_linux_testing_random (workload) % 100, time);
+	}
+
+	if ((seconds % 300) == 0) {
+		for (i = 0; i < 4; i++) {
+			logging_flash_compressed_linux_testing_add_entry (test, workload,
+				DEBUG_LOG_SEVERITY_INFO, DEBUG_LOG_COMPONENT_ATTESTATION, 2, 0x10 + i, 0,
+				time + i);
+		}
+	}
+
+	if ((logging_flash_compressed_linux_testing_random (workload) % 1200) == 0) {
+		logging_flash_compressed_linux_testing_add_entry (test, workload, DEBUG_LOG_SEVERITY_ERROR,
+			DEBUG_LOG_COMPONENT_MCTP, 3, 0x80000000 |
+			(logging_flash_compressed_linux_testing_random (workload) & 0xffffff),
+			logging_flash_compressed_linux_testing_random (workload) & 0xff, time);
+	}
+
+	if ((logging_flash_compressed_linux_testing_random (workload) % 1800) == 0) {
+		logging_flash_compressed_linux_testing_add_entry (test, workload,
+			DEBUG_LOG_SEVERITY_WARNING, DEBUG_LOG_COMPONENT_CMD_INTERFACE, 4,
+			logging_flash_compressed_linux_testing_random (workload) & 0xffff, 0, time);
+	}
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void logging_flash_compressed_linux_test_week_workload (CuTest *test)
+{
+	struct logging_flash_compressed_linux_testing *workload;
+	struct logging_flash_compressed_stats stats;
+	struct debug_log_entry *entry;
+	uint8_t *contents;
+	uint64_t elapsed;
+	uint32_t seconds;
+	uint32_t flash_entries;
+	uint32_t flash_erases;
+	uint32_t i;
+	int length;
+	int status;
+
+	TEST_START;
+
+	workload = calloc (1, sizeof (struct logging_flash_compressed_linux_testing));
+	CuAssertPtrNotNull (test, workload);
+
+	memset (workload->flash_data, 0xff, sizeof (workload->flash_data));
+	workload->random = 1;
+
+	status = flash_virtual_ram_init (&workload->flash, &workload->flash_state, workload->flash_data,
+		sizeof (workload->flash_data));
+	CuAssertIntEquals (test, 0, status);
+
+	workload->flash.base.get_sector_size = logging_flash_compressed_linux_testing_get_sector_size;
+	workload->flash.base.sector_erase = logging_flash_compressed_linux_testing_sector_erase;
+
+	status = logging_flash_compressed_init (&workload->log, &workload->state,
+		&workload->flash.base, 0, workload->sectors, LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTORS);
+	CuAssertIntEquals (test, 0, status);
+
+	seconds = 0;
+	for (elapsed = 0; elapsed < LOGGING_FLASH_COMPRESSED_LINUX_TESTING_DURATION; elapsed += 1000) {
+		if ((elapsed != 0) && ((elapsed % LOGGING_FLASH_COMPRESSED_LINUX_TESTING_RESET_MS) == 0)) {
+			logging_flash_compressed_linux_testing_reset (test, workload);
+			seconds = 0;
+		}
+
+		logging_flash_compressed_linux_testing_run_second (test, workload, seconds++);
+
+		if ((elapsed % LOGGING_FLASH_COMPRESSED_LINUX_TESTING_FLUSH_MS) == 0) {
+			status = workload->log.base.flush (&workload->log.base);
+			CuAssertIntEquals (test, 0, status);
+		}
+	}
+
+	logging_flash_compressed_linux_testing_reset (test, workload);
+
+	status = logging_flash_compressed_get_stats (&workload->log, &stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertTrue (test, (stats.entries != 0));
+	CuAssertTrue (test, (stats.max_erase_count - stats.min_erase_count) <= 1);
+
+	/* The log must contain the newest entries in the standard format with sequential IDs. */
+	contents = malloc (stats.log_length);
+	CuAssertPtrNotNull (test, contents);
+
+	length = workload->log.base.read_contents (&workload->log.base, 0, contents, stats.log_length);
+	CuAssertIntEquals (test, stats.log_length, length);
+	CuAssertIntEquals (test, sizeof (struct debug_log_entry) * stats.entries, length);
+
+	for (i = 0; i < stats.entries; i++) {
+		entry = (struct debug_log_entry*) &contents[sizeof (struct debug_log_entry) * i];
+
+		CuAssertIntEquals (test, LOGGING_MAGIC_START, entry->header.log_magic);
+		CuAssertIntEquals (test, sizeof (struct debug_log_entry), entry->header.length);
+		CuAssertIntEquals (test, workload->entries - stats.entries + i, entry->header.entry_id);
+		CuAssertIntEquals (test, DEBUG_LOG_ENTRY_FORMAT, entry->entry.format);
+	}
+
+	status = testing_validate_array ((uint8_t*) &workload->last, (uint8_t*) &entry->entry,
+		sizeof (workload->last));
+	CuAssertIntEquals (test, 0, status);
+
+	/* logging_flash stores every entry with the full header and cannot split entries across
+	 * sectors, so estimate how it would handle the same workload.  The compressed log must retain
+	 * more entries in the same flash while erasing less often. */
+	flash_entries = (LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTOR_SIZE -
+		sizeof (struct logging_entry_header)) / sizeof (struct debug_log_entry);
+	flash_erases = (workload->entries + flash_entries - 1) / flash_entries;
+
+	CuAssertTrue (test, (stats.stored_length < (sizeof (struct debug_log_entry) * stats.entries)));
+	CuAssertTrue (test,
+		(stats.entries > (flash_entries * LOGGING_FLASH_COMPRESSED_LINUX_TESTING_SECTORS)));
+	CuAssertTrue (test, (stats.total_erase_count < flash_erases));
+
+	free (contents);
+	logging_flash_compressed_release (&workload->log);
+	flash_virtual_ram_release (&workload->flash);
+	free (workload);
+}
+
+
+TEST_SUITE_START (logging_flash_compressed_linux);
+
+TEST (logging_flash_compressed_linux_test_week_workload);
+
+TEST_SUITE_END;
@@ -0,0 +1,333 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "flash/flash_common.h"
+#include "flash/flash_master.h"
+#include "flash/spi_flash.h"
+#include "logging/debug_log.h"
+#include "logging/log_flush_handler.h"
+#include "logging/logging_flash.h"
+#include "logging/logging_ring.h"
+#include "system/periodic_task_linux.h"
+
+
+TEST_SUITE_LABEL ("logging_ring_linux");
+
+
+/**
+ * Number of tasks concurrently creating log entries.
+ */
+#define	LOGGING_RING_LINUX_TESTING_PRODUCERS		8
+
+/**
+ * Number of entries created by each producer task.  All entries must fit in the flash log without
+ * wrapping.
+ */
+#define	LOGGING_RING_LINUX_TESTING_ENTRIES			200
+
+/**
+ * Total number of entries created during a test run.
+ */
+#define	LOGGING_RING_LINUX_TESTING_TOTAL_ENTRIES	\
+	(LOGGING_RING_LINUX_TESTING_PRODUCERS * LOGGING_RING_LINUX_TESTING_ENTRIES)
+
+/**
+ * Number of entries that can be buffered in a ring large enough to hold all entries created
+ * between flushes.
+ */
+#define	LOGGING_RING_LINUX_TESTING_RING_ENTRIES		2048
+
+/**
+ * Number of entries that can be buffered in a ring that is too small to hold all entries created
+ * between flushes.
+ */
+#define	LOGGING_RING_LINUX_TESTING_SMALL_RING_ENTRIES	16
+
+/**
+ * Time between flushes of the ring, in milliseconds.
+ */
+#define	LOGGING_RING_LINUX_TESTING_FLUSH_MS			1
+
+
+/**
+ * A SPI master for a flash device backed by RAM.
+ */
+struct logging_ring_linux_testing_flash {
+	struct flash_master base;					/**< Base SPI master. */
+	uint8_t data[LOGGING_FLASH_AREA_LEN];		/**< Contents of the flash device. */
+};
+
+/**
+ * Context for a single producer task.
+ */
+struct logging_ring_linux_testing_producer {
+	const struct logging *log;	/**< The log to add entries to. */
+	uint32_t id;				/**< Identifier for the producer. */
+	int failures;				/**< Number of entries that could not be created. */
+};
+
+/**
+ * Dependencies for testing.
+ */
+struct logging_ring_linux_testing {
+	struct logging_ring_linux_testing_flash spi;		/**< SPI master for the log flash. */
+	struct spi_flash_state flash_state;					/**< Context for the log flash. */
+	struct spi_flash flash;								/**< Flash device for the log. */
+	struct logging_flash_state target_state;			/**< Context for the flash log. */
+	struct logging_flash target;						/**< The log that stores entries. */
+	struct logging_ring_state ring_state;				/**< Context for the ring log. */
+	struct logging_ring ring;							/**< The log being tested. */
+	uint8_t *ring_buffer;								/**< Memory for the ring. */
+	const struct logging *flush_logs[1];				/**< Logs flushed by the handler. */
+	struct log_flush_handler_state flush_state;			/**< Context for the flush handler. */
+	struct log_flush_handler flush;						/**< Handler to flush the ring. */
+	const struct periodic_task_handler *handlers[1];	/**< Handlers for the flush task. */
+	struct periodic_task_scheduler_entry entries[1];	/**< Scheduling storage for the task. */
+	struct periodic_task_linux_state task_state;		/**< Context for the flush task. */
+	struct periodic_task_linux task;					/**< Task that flushes the ring. */
+};
+
+
+static int logging_ring_linux_testing_xfer (const struct flash_master *spi,
+	const struct flash_xfer *xfer)
+{
+	struct logging_ring_linux_testing_flash *flash =
+		(struct logging_ring_linux_testing_flash*) spi;
+
+	if (flash_xfer_has_no_address (xfer)) {
+		/* Status reads report the device is always idle.  Other commands are ignored. */
+		if (!flash_xfer_is_tx (xfer)) {
+			memset (xfer->data, 0, xfer->length);
+		}
+
+		return 0;
+	}
+
+	if (xfer->cmd == FLASH_CMD_4K_ERASE) {
+		if ((xfer->address + FLASH_SECTOR_SIZE) > sizeof (flash->data)) {
+			return FLASH_MASTER_XFER_FAILED;
+		}
+
+		memset (&flash->data[xfer->address], 0xff, FLASH_SECTOR_SIZE);
+
+		return 0;
+	}
+
+	if ((xfer->address + xfer->length) > sizeof (flash->data)) {
+		return FLASH_MASTER_XFER_FAILED;
+	}
+
+	if (flash_xfer_is_tx (xfer)) {
+		memcpy (&flash->data[xfer->address], xfer->data, xfer->length);
+	}
+	else {
+		memcpy (xfer->data, &flash->data[xfer->address], xfer->length);
+	}
+
+	return 0;
+}
+
+static uint32_t logging_ring_linux_testing_capabilities (const struct flash_master *spi)
+{
+	return FLASH_CAP_3BYTE_ADDR;
+}
+
+/**
+ * Initialize a ring log with a flash log target and a task to periodically flush the ring.
+ *
+ * @param test The testing framework.
+ * @param log The testing components to initialize.
+ * @param ring_entries The number of entries the ring can hold.
+ */
+static void logging_ring_linux_testing_init (CuTest *test, struct logging_ring_linux_testing *log,
+	size_t ring_entries)
+{
+	size_t ring_len = LOGGING_RING_BUFFER_LEN (ring_entries, sizeof (struct debug_log_entry_info));
+	int status;
+
+	memset (log, 0, sizeof (*log));
+
+	memset (log->spi.data, 0xff, sizeof (log->spi.data));
+	log->spi.base.xfer = logging_ring_linux_testing_xfer;
+	log->spi.base.capabilities = logging_ring_linux_testing_capabilities;
+
+	status = spi_flash_init (&log->flash, &log->flash_state, &log->spi.base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = spi_flash_set_device_size (&log->flash, sizeof (log->spi.data));
+	CuAssertIntEquals (test, 0, status);
+
+	status = logging_flash_init (&log->target, &log->target_state, &log->flash, 0);
+	CuAssertIntEquals (test, 0, status);
+
+	log->ring_buffer = platform_malloc (ring_len);
+	CuAssertPtrNotNull (test, log->ring_buffer);
+
+	status = logging_ring_init (&log->ring, &log->ring_state, &log->target.base, log->ring_buffer,
+		ring_len, sizeof (struct debug_log_entry_info));
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, ring_entries, log->ring.entry_count);
+
+	log->flush_logs[0] = &log->ring.base;
+
+	status = log_flush_handler_init (&log->flush, &log->flush_state, log->flush_logs, 1,
+		LOGGING_RING_LINUX_TESTING_FLUSH_MS);
+	CuAssertIntEquals (test, 0, status);
+
+	log->handlers[0] = &log->flush.base;
+
+	status = periodic_task_linux_init (&log->task, &log->task_state, log->handlers, 1, log->entries,
+		0);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_linux_start (&log->task);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release the test components.
+ *
+ * @param log The testing components to release.
+ */
+static void logging_ring_linux_testing_release (struct logging_ring_linux_testing *log)
+{
+	periodic_task_linux_release (&log->task);
+	log_flush_handler_release (&log->flush);
+	logging_ring_release (&log->ring);
+	logging_flash_release (&log->target);
+	spi_flash_release (&log->flash);
+	platform_free (log->ring_buffer);
+}
+
+/**
+ * Task to create log entries as fast as possible.
+ *
+ * @param arg The producer context.
+ *
+ * @return Unused.
+ */
+static void* logging_ring_linux_testing_producer_task (void *arg)
+{
+	struct logging_ring_linux_testing_producer *producer = arg;
+	struct debug_log_entry_info entry;
+	uint32_t i;
+	int status;
+
+	memset (&entry, 0, sizeof (entry));
+	entry.format = DEBUG_LOG_ENTRY_FORMAT;
+	entry.severity = DEBUG_LOG_SEVERITY_ERROR;
+	entry.arg1 = producer->id;
+
+	for (i = 0; i < LOGGING_RING_LINUX_TESTING_ENTRIES; i++) {
+		entry.arg2 = i;
+
+		status = producer->log->create_entry (producer->log, (uint8_t*) &entry, sizeof (entry));
+		if (status != 0) {
+			producer->failures++;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Run multiple concurrent producers against a ring log while the ring is being flushed to flash.
+ * Check that the flash log contains every entry, with sequential entry IDs and the entries from
+ * each producer in the order they were created.
+ *
+ * @param test The testing framework.
+ * @param ring_entries The number of entries the ring can hold.
+ */
+static void logging_ring_linux_testing_run (CuTest *test, size_t ring_entries)
+{
+	struct logging_ring_linux_testing log;
+	struct logging_ring_linux_testing_producer producer[LOGGING_RING_LINUX_TESTING_PRODUCERS];
+	pthread_t producer_thread[LOGGING_RING_LINUX_TESTING_PRODUCERS];
+	uint32_t next_seq[LOGGING_RING_LINUX_TESTING_PRODUCERS];
+	struct debug_log_entry *entry;
+	uint8_t *contents;
+	size_t log_len = sizeof (struct debug_log_entry) * LOGGING_RING_LINUX_TESTING_TOTAL_ENTRIES;
+	size_t i;
+	int status;
+
+	logging_ring_linux_testing_init (test, &log, ring_entries);
+
+	for (i = 0; i < LOGGING_RING_LINUX_TESTING_PRODUCERS; i++) {
+		producer[i].log = &log.ring.base;
+		producer[i].id = i;
+		producer[i].failures = 0;
+
+		status = pthread_create (&producer_thread[i], NULL,
+			logging_ring_linux_testing_producer_task, &producer[i]);
+		CuAssertIntEquals (test, 0, status);
+	}
+
+	for (i = 0; i < LOGGING_RING_LINUX_TESTING_PRODUCERS; i++) {
+		pthread_join (producer_thread[i], NULL);
+		CuAssertIntEquals (test, 0, producer[i].failures);
+	}
+
+	status = log.ring.base.flush (&log.ring.base);
+	CuAssertIntEquals (test, 0, status);
+
+	contents = platform_malloc (log_len + sizeof (struct debug_log_entry));
+	CuAssertPtrNotNull (test, contents);
+
+	/* Ask for more data than expected to detect any extra entries. */
+	status = log.ring.base.read_contents (&log.ring.base, 0, contents,
+		log_len + sizeof (struct debug_log_entry));
+	CuAssertIntEquals (test, log_len, status);
+
+	memset (next_seq, 0, sizeof (next_seq));
+
+	for (i = 0; i < LOGGING_RING_LINUX_TESTING_TOTAL_ENTRIES; i++) {
+		entry = (struct debug_log_entry*) &contents[i * sizeof (struct debug_log_entry)];
+
+		CuAssertIntEquals (test, LOGGING_MAGIC_START, entry->header.log_magic);
+		CuAssertIntEquals (test, sizeof (struct debug_log_entry), entry->header.length);
+		CuAssertIntEquals (test, i, entry->header.entry_id);
+
+		CuAssertTrue (test, (entry->entry.arg1 < LOGGING_RING_LINUX_TESTING_PRODUCERS));
+		CuAssertIntEquals (test, next_seq[entry->entry.arg1], entry->entry.arg2);
+		next_seq[entry->entry.arg1]++;
+	}
+
+	platform_free (contents);
+	logging_ring_linux_testing_release (&log);
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void logging_ring_linux_test_concurrent_producers (CuTest *test)
+{
+	TEST_START;
+
+	logging_ring_linux_testing_run (test, LOGGING_RING_LINUX_TESTING_RING_ENTRIES);
+}
+
+static void logging_ring_linux_test_concurrent_producers_small_ring (CuTest *test)
+{
+	TEST_START;
+
+	logging_ring_linux_testing_run (test, LOGGING_RING_LINUX_TESTING_SMALL_RING_ENTRIES);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (logging_ring_linux);
+
+TEST (logging_ring_linux_test_concurrent_producers);
+TEST (logging_ring_linux_test_concurrent_producers_small_ring);
+
+TEST_SUITE_END;
+// *INDENT-ON*
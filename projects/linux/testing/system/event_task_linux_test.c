@@ -0,0 +1,435 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "system/event_task_linux.h"
+#include "system/event_task_linux_static.h"
+
+
+TEST_SUITE_LABEL ("event_task_linux");
+
+
+/**
+ * An event handler that records how it was executed.
+ */
+struct event_task_linux_testing_handler {
+	struct event_task_handler base;	/**< The base handler instance. */
+	platform_semaphore done;		/**< Signal that the handler has been executed. */
+	int prepared;					/**< Number of times the handler was prepared. */
+	int executed;					/**< Number of times the handler was executed. */
+	uint32_t action;				/**< The last action that was executed. */
+	pthread_t thread;				/**< The thread that executed the handler. */
+};
+
+/**
+ * Dependencies for testing.
+ */
+struct event_task_linux_testing {
+	struct event_task_linux_testing_handler handler[2];	/**< Handlers for the task. */
+	const struct event_task_handler *list[2];			/**< List of task handlers. */
+	struct system system;								/**< Placeholder system manager. */
+	struct event_task_linux_state state;				/**< Variable context for the task. */
+	struct event_task_linux test;						/**< The task under test. */
+};
+
+
+static void event_task_linux_testing_prepare (const struct event_task_handler *handler)
+{
+	struct event_task_linux_testing_handler *testing =
+		(struct event_task_linux_testing_handler*) handler;
+
+	testing->prepared++;
+}
+
+static void event_task_linux_testing_execute (const struct event_task_handler *handler,
+	struct event_task_context *context, bool *reset)
+{
+	struct event_task_linux_testing_handler *testing =
+		(struct event_task_linux_testing_handler*) handler;
+
+	testing->action = context->action;
+	testing->thread = pthread_self ();
+	testing->executed++;
+
+	platform_semaphore_post (&testing->done);
+}
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to initialize.
+ */
+static void event_task_linux_testing_init_dependencies (CuTest *test,
+	struct event_task_linux_testing *task)
+{
+	int status;
+	int i;
+
+	memset (task, 0, sizeof (*task));
+
+	for (i = 0; i < 2; i++) {
+		task->handler[i].base.prepare = event_task_linux_testing_prepare;
+		task->handler[i].base.execute = event_task_linux_testing_execute;
+
+		status = platform_semaphore_init (&task->handler[i].done);
+		CuAssertIntEquals (test, 0, status);
+
+		task->list[i] = &task->handler[i].base;
+	}
+}
+
+/**
+ * Release testing dependencies.
+ *
+ * @param task The testing components to release.
+ */
+static void event_task_linux_testing_release_dependencies (struct event_task_linux_testing *task)
+{
+	platform_semaphore_free (&task->handler[0].done);
+	platform_semaphore_free (&task->handler[1].done);
+}
+
+/**
+ * Initialize and start a task for testing.
+ *
+ * @param test The testing framework.
+ * @param task The testing components to initialize.
+ */
+static void event_task_linux_testing_init (CuTest *test, struct event_task_linux_testing *task)
+{
+	int status;
+
+	event_task_linux_testing_init_dependencies (test, task);
+
+	status = event_task_linux_init (&task->test, &task->state, &task->system, task->list, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_linux_start (&task->test);
+	CuAssertIntEquals (test, 0, status);
+}
+
+/**
+ * Release a test instance.
+ *
+ * @param task The testing components to release.
+ */
+static void event_task_linux_testing_release (struct event_task_linux_testing *task)
+{
+	event_task_linux_release (&task->test);
+	event_task_linux_testing_release_dependencies (task);
+}
+
+/**
+ * Get the event context from the task, waiting for the task to be ready.
+ *
+ * @param test The testing framework.
+ * @param task The task to query.
+ *
+ * @return The event context.
+ */
+static struct event_task_context* event_task_linux_testing_get_context (CuTest *test,
+	struct event_task_linux *task)
+{
+	struct event_task_context *context = NULL;
+	int status;
+	int retries = 1000;
+
+	do {
+		status = task->base.get_event_context (&task->base, &context);
+		if (status == EVENT_TASK_BUSY) {
+			platform_msleep (1);
+		}
+	} while ((status == EVENT_TASK_BUSY) && (--retries > 0));
+
+	CuAssertIntEquals (test, 0, status);
+	CuAssertPtrNotNull (test, context);
+
+	return context;
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void event_task_linux_test_init (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, task.list, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertPtrNotNull (test, task.test.base.lock);
+	CuAssertPtrNotNull (test, task.test.base.unlock);
+	CuAssertPtrNotNull (test, task.test.base.get_event_context);
+	CuAssertPtrNotNull (test, task.test.base.notify);
+
+	event_task_linux_testing_release (&task);
+}
+
+static void event_task_linux_test_init_null (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init (NULL, &task.state, &task.system, task.list, 2);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init (&task.test, NULL, &task.system, task.list, 2);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init (&task.test, &task.state, NULL, task.list, 2);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, NULL, 2);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, task.list, 0);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+
+	event_task_linux_testing_release_dependencies (&task);
+}
+
+static void event_task_linux_test_static_init (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	struct event_task_linux test_static = event_task_linux_static_init (&task.state, &task.system,
+		task.list, 2);
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	status = event_task_linux_start (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	context = event_task_linux_testing_get_context (test, &test_static);
+	context->action = 5;
+
+	status = test_static.base.notify (&test_static.base, &task.handler[0].base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_semaphore_wait (&task.handler[0].done, 1000);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, 5, task.handler[0].action);
+
+	event_task_linux_release (&test_static);
+	event_task_linux_testing_release_dependencies (&task);
+}
+
+static void event_task_linux_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	event_task_linux_release (NULL);
+}
+
+static void event_task_linux_test_release_not_started (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, task.list, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_linux_testing_release (&task);
+	CuAssertIntEquals (test, 0, task.handler[0].prepared);
+}
+
+static void event_task_linux_test_start_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = event_task_linux_start (NULL);
+	CuAssertIntEquals (test, EVENT_TASK_INVALID_ARGUMENT, status);
+}
+
+static void event_task_linux_test_notify (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init (test, &task);
+
+	context = event_task_linux_testing_get_context (test, &task.test);
+	CuAssertIntEquals (test, 1, task.handler[0].prepared);
+	CuAssertIntEquals (test, 1, task.handler[1].prepared);
+
+	context->action = 10;
+
+	status = task.test.base.notify (&task.test.base, &task.handler[1].base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_semaphore_wait (&task.handler[1].done, 1000);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 0, task.handler[0].executed);
+	CuAssertIntEquals (test, 1, task.handler[1].executed);
+	CuAssertIntEquals (test, 10, task.handler[1].action);
+	CuAssertTrue (test, !pthread_equal (pthread_self (), task.handler[1].thread));
+
+	context = event_task_linux_testing_get_context (test, &task.test);
+	context->action = 11;
+
+	status = task.test.base.notify (&task.test.base, &task.handler[0].base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_semaphore_wait (&task.handler[0].done, 1000);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 1, task.handler[0].executed);
+	CuAssertIntEquals (test, 11, task.handler[0].action);
+
+	event_task_linux_testing_release (&task);
+}
+
+static void event_task_linux_test_notify_many (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	struct event_task_context *context;
+	int status;
+	int i;
+
+	TEST_START;
+
+	event_task_linux_testing_init (test, &task);
+
+	for (i = 0; i < 1000; i++) {
+		context = event_task_linux_testing_get_context (test, &task.test);
+		context->action = i;
+
+		status = task.test.base.notify (&task.test.base, &task.handler[i & 1].base);
+		CuAssertIntEquals (test, 0, status);
+
+		status = platform_semaphore_wait (&task.handler[i & 1].done, 1000);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, i, task.handler[i & 1].action);
+	}
+
+	CuAssertIntEquals (test, 500, task.handler[0].executed);
+	CuAssertIntEquals (test, 500, task.handler[1].executed);
+
+	event_task_linux_testing_release (&task);
+}
+
+static void event_task_linux_test_notify_unknown_handler (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	struct event_task_linux_testing_handler unknown;
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	memset (&unknown, 0, sizeof (unknown));
+
+	event_task_linux_testing_init (test, &task);
+
+	context = event_task_linux_testing_get_context (test, &task.test);
+	CuAssertPtrNotNull (test, context);
+
+	status = task.test.base.notify (&task.test.base, &unknown.base);
+	CuAssertIntEquals (test, EVENT_TASK_UNKNOWN_HANDLER, status);
+
+	/* The task should still be available for new events. */
+	context = event_task_linux_testing_get_context (test, &task.test);
+	CuAssertPtrNotNull (test, context);
+
+	status = task.test.base.notify (&task.test.base, &task.handler[0].base);
+	CuAssertIntEquals (test, 0, status);
+
+	status = platform_semaphore_wait (&task.handler[0].done, 1000);
+	CuAssertIntEquals (test, 0, status);
+
+	event_task_linux_testing_release (&task);
+}
+
+static void event_task_linux_test_notify_not_started (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	struct event_task_context *context;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init_dependencies (test, &task);
+
+	status = event_task_linux_init (&task.test, &task.state, &task.system, task.list, 2);
+	CuAssertIntEquals (test, 0, status);
+
+	status = task.test.base.get_event_context (&task.test.base, &context);
+	CuAssertIntEquals (test, EVENT_TASK_NO_TASK, status);
+
+	status = task.test.base.notify (&task.test.base, &task.handler[0].base);
+	CuAssertIntEquals (test, EVENT_TASK_NO_TASK, status);
+
+	event_task_linux_testing_release (&task);
+}
+
+static void event_task_linux_test_notify_without_context (CuTest *test)
+{
+	struct event_task_linux_testing task;
+	int status;
+
+	TEST_START;
+
+	event_task_linux_testing_init (test, &task);
+
+	/* Wait for the task to be ready. */
+	event_task_linux_testing_get_context (test, &task.test);
+	task.test.base.notify (&task.test.base, NULL);
+
+	status = task.test.base.notify (&task.test.base, &task.handler[0].base);
+	CuAssertIntEquals (test, EVENT_TASK_NOT_READY, status);
+
+	event_task_linux_testing_release (&task);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (event_task_linux);
+
+TEST (event_task_linux_test_init);
+TEST (event_task_linux_test_init_null);
+TEST (event_task_linux_test_static_init);
+TEST (event_task_linux_test_release_null);
+TEST (event_task_linux_test_release_not_started);
+TEST (event_task_linux_test_start_null);
+TEST (event_task_linux_test_notify);
+TEST (event_task_linux_test_notify_many);
+TEST (event_task_linux_test_notify_unknown_handler);
+TEST (event_task_linux_test_notify_not_started);
+TEST (event_task_linux_test_notify_without_context);
+
+TEST_SUITE_END;
+// *INDENT-ON*
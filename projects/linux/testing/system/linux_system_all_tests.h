@@ -21,6 +21,24 @@ static void add_all_linux_system_tests (CuSuite *suite)
 	/* This is unused when no tests will be executed. */
 	UNUSED (suite);
 
+#if (defined TESTING_RUN_EVENT_TASK_LINUX_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_EVENT_TASK_LINUX_SUITE
+	TESTING_RUN_SUITE (event_task_linux);
+#endif
+#if (defined TESTING_RUN_PERIODIC_TASK_LINUX_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_PERIODIC_TASK_LINUX_SUITE
+	TESTING_RUN_SUITE (periodic_task_linux);
+#endif
+#if (defined TESTING_RUN_PERIODIC_TASK_SCHEDULER_LINUX_SUITE || \
+		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
+		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
+	!defined TESTING_SKIP_PERIODIC_TASK_SCHEDULER_LINUX_SUITE
+	TESTING_RUN_SUITE (periodic_task_scheduler_linux);
+#endif
 #if (defined TESTING_RUN_REAL_TIME_CLOCK_LINUX_SUITE || \
 		defined TESTING_RUN_ALL_TESTS || defined TESTING_RUN_ALL_CORE_TESTS || \
 		(!defined TESTING_SKIP_ALL_TESTS && !defined TESTING_SKIP_ALL_CORE_TESTS)) && \
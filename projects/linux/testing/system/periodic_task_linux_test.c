@@ -0,0 +1,321 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "system/periodic_task_linux.h"
+#include "system/periodic_task_linux_static.h"
+
+
+TEST_SUITE_LABEL ("periodic_task_linux");
+
+
+/**
+ * A periodic handler that counts executions.
+ */
+struct periodic_task_linux_testing_handler {
+	struct periodic_task_handler base;	/**< The base handler instance. */
+	platform_clock next;				/**< The next execution time. */
+	uint32_t period;					/**< Time between executions, in milliseconds. */
+	int prepared;						/**< Number of times the handler was prepared. */
+	volatile int executed;				/**< Number of times the handler was executed. */
+};
+
+/**
+ * Dependencies for testing.
+ */
+struct periodic_task_linux_testing {
+	struct periodic_task_linux_testing_handler handler[2];	/**< Handlers for the task. */
+	const struct periodic_task_handler *list[2];			/**< List of task handlers. */
+	struct periodic_task_scheduler_entry entries[2];		/**< Scheduling storage. */
+	struct periodic_task_linux_state state;					/**< Variable context for the task. */
+	struct periodic_task_linux test;						/**< The task under test. */
+};
+
+
+static void periodic_task_linux_testing_prepare (const struct periodic_task_handler *handler)
+{
+	struct periodic_task_linux_testing_handler *testing =
+		(struct periodic_task_linux_testing_handler*) handler;
+
+	testing->prepared++;
+	platform_init_timeout (testing->period, &testing->next);
+}
+
+static const platform_clock* periodic_task_linux_testing_get_next_execution (
+	const struct periodic_task_handler *handler)
+{
+	struct periodic_task_linux_testing_handler *testing =
+		(struct periodic_task_linux_testing_handler*) handler;
+
+	return &testing->next;
+}
+
+static void periodic_task_linux_testing_execute (const struct periodic_task_handler *handler)
+{
+	struct periodic_task_linux_testing_handler *testing =
+		(struct periodic_task_linux_testing_handler*) handler;
+
+	testing->executed++;
+	platform_init_timeout (testing->period, &testing->next);
+}
+
+/**
+ * Initialize testing dependencies.
+ *
+ * @param task The testing components to initialize.
+ * @param period1 Execution period for the first handler.
+ * @param period2 Execution period for the second handler.
+ */
+static void periodic_task_linux_testing_init_dependencies (struct periodic_task_linux_testing *task,
+	uint32_t period1, uint32_t period2)
+{
+	int i;
+
+	memset (task, 0, sizeof (*task));
+
+	for (i = 0; i < 2; i++) {
+		task->handler[i].base.prepare = periodic_task_linux_testing_prepare;
+		task->handler[i].base.get_next_execution = periodic_task_linux_testing_get_next_execution;
+		task->handler[i].base.execute = periodic_task_linux_testing_execute;
+
+		task->list[i] = &task->handler[i].base;
+	}
+
+	task->handler[0].period = period1;
+	task->handler[1].period = period2;
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void periodic_task_linux_test_init (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (&task, 10, 20);
+
+	status = periodic_task_linux_init (&task.test, &task.state, task.list, 2, task.entries, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	CuAssertIntEquals (test, 1, task.test.id);
+
+	periodic_task_linux_release (&task.test);
+
+	CuAssertIntEquals (test, 0, task.handler[0].prepared);
+}
+
+static void periodic_task_linux_test_init_null (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (&task, 10, 20);
+
+	status = periodic_task_linux_init (NULL, &task.state, task.list, 2, task.entries, 1);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_linux_init (&task.test, NULL, task.list, 2, task.entries, 1);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_linux_init (&task.test, &task.state, NULL, 2, task.entries, 1);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_linux_init (&task.test, &task.state, task.list, 0, task.entries, 1);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+
+	status = periodic_task_linux_init (&task.test, &task.state, task.list, 2, NULL, 1);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_linux_test_static_init (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	struct periodic_task_linux test_static = periodic_task_linux_static_init (&task.state,
+		task.list, 2, task.entries, 3);
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (&task, 10, 20);
+
+	status = periodic_task_linux_init_state (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_linux_start (&test_static);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (205);
+
+	periodic_task_linux_release (&test_static);
+
+	CuAssertIntEquals (test, 1, task.handler[0].prepared);
+	CuAssertIntEquals (test, 1, task.handler[1].prepared);
+	CuAssertTrue (test, (task.handler[0].executed >= 15));
+	CuAssertTrue (test, (task.handler[0].executed <= 21));
+	CuAssertTrue (test, (task.handler[1].executed >= 8));
+	CuAssertTrue (test, (task.handler[1].executed <= 11));
+}
+
+static void periodic_task_linux_test_static_init_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_linux_init_state (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_linux_test_release_null (CuTest *test)
+{
+	TEST_START;
+
+	periodic_task_linux_release (NULL);
+}
+
+static void periodic_task_linux_test_start (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	struct periodic_task_scheduler_stats stats;
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (&task, 10, 50);
+
+	status = periodic_task_linux_init (&task.test, &task.state, task.list, 2, task.entries, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_linux_start (&task.test);
+	CuAssertIntEquals (test, 0, status);
+
+	/* Starting a running task has no effect. */
+	status = periodic_task_linux_start (&task.test);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (205);
+
+	periodic_task_linux_release (&task.test);
+
+	CuAssertIntEquals (test, 1, task.handler[0].prepared);
+	CuAssertIntEquals (test, 1, task.handler[1].prepared);
+	CuAssertTrue (test, (task.handler[0].executed >= 15));
+	CuAssertTrue (test, (task.handler[1].executed >= 3));
+	CuAssertTrue (test, (task.handler[1].executed <= 5));
+
+	status = periodic_task_scheduler_get_stats (&task.test.scheduler, &task.handler[1].base,
+		&stats);
+	CuAssertIntEquals (test, 0, status);
+	CuAssertIntEquals (test, task.handler[1].executed, stats.executions);
+}
+
+static void periodic_task_linux_test_start_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_linux_start (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+static void periodic_task_linux_test_release_long_period (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	platform_clock start;
+	platform_clock end;
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (&task, 10000, 20000);
+
+	status = periodic_task_linux_init (&task.test, &task.state, task.list, 2, task.entries, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_linux_start (&task.test);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (20);
+
+	/* Stopping the task must not wait for the next handler to be ready. */
+	platform_init_current_tick (&start);
+	periodic_task_linux_release (&task.test);
+	platform_init_current_tick (&end);
+
+	CuAssertTrue (test, (platform_get_duration (&start, &end) < 100));
+	CuAssertIntEquals (test, 0, task.handler[0].executed);
+	CuAssertIntEquals (test, 0, task.handler[1].executed);
+}
+
+static void periodic_task_linux_test_notify (CuTest *test)
+{
+	struct periodic_task_linux_testing task;
+	int status;
+
+	TEST_START;
+
+	periodic_task_linux_testing_init_dependencies (&task, 10000, 20000);
+
+	status = periodic_task_linux_init (&task.test, &task.state, task.list, 2, task.entries, 1);
+	CuAssertIntEquals (test, 0, status);
+
+	status = periodic_task_linux_start (&task.test);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (20);
+
+	/* Make the second handler ready immediately. */
+	task.handler[1].period = 10000;
+	platform_init_timeout (0, &task.handler[1].next);
+
+	status = periodic_task_linux_notify (&task.test);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (20);
+
+	periodic_task_linux_release (&task.test);
+
+	CuAssertIntEquals (test, 0, task.handler[0].executed);
+	CuAssertIntEquals (test, 1, task.handler[1].executed);
+}
+
+static void periodic_task_linux_test_notify_null (CuTest *test)
+{
+	int status;
+
+	TEST_START;
+
+	status = periodic_task_linux_notify (NULL);
+	CuAssertIntEquals (test, PERIODIC_TASK_INVALID_ARGUMENT, status);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (periodic_task_linux);
+
+TEST (periodic_task_linux_test_init);
+TEST (periodic_task_linux_test_init_null);
+TEST (periodic_task_linux_test_static_init);
+TEST (periodic_task_linux_test_static_init_null);
+TEST (periodic_task_linux_test_release_null);
+TEST (periodic_task_linux_test_start);
+TEST (periodic_task_linux_test_start_null);
+TEST (periodic_task_linux_test_release_long_period);
+TEST (periodic_task_linux_test_notify);
+TEST (periodic_task_linux_test_notify_null);
+
+TEST_SUITE_END;
+// *INDENT-ON*
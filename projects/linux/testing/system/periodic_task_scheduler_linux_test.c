@@ -0,0 +1,380 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "testing.h"
+#include "platform_api.h"
+#include "system/periodic_task.h"
+#include "system/periodic_task_scheduler.h"
+
+
+TEST_SUITE_LABEL ("periodic_task_scheduler_linux");
+
+
+/**
+ * Number of handlers executed by the task.
+ */
+#define	PERIODIC_TASK_SCHEDULER_LINUX_TESTING_HANDLERS		32
+
+/**
+ * Amount of time to run the handlers for each measurement, in milliseconds.
+ */
+#define	PERIODIC_TASK_SCHEDULER_LINUX_TESTING_RUN_TIME		2000
+
+/**
+ * Shortest execution period of any handler, in milliseconds.
+ */
+#define	PERIODIC_TASK_SCHEDULER_LINUX_TESTING_MIN_PERIOD	10
+
+/**
+ * Maximum number of executions recorded for a single handler.
+ */
+#define	PERIODIC_TASK_SCHEDULER_LINUX_TESTING_MAX_SAMPLES	\
+	((PERIODIC_TASK_SCHEDULER_LINUX_TESTING_RUN_TIME / \
+		PERIODIC_TASK_SCHEDULER_LINUX_TESTING_MIN_PERIOD) + 16)
+
+/**
+ * Amount of time each handler spends executing, in microseconds.
+ */
+#define	PERIODIC_TASK_SCHEDULER_LINUX_TESTING_WORK_US		50
+
+
+/**
+ * A periodic handler that records how far from the scheduled time each execution happened.
+ */
+struct periodic_task_scheduler_linux_testing_handler {
+	struct periodic_task_handler base;	/**< The base handler instance. */
+	platform_clock next;				/**< The next scheduled execution time. */
+	uint32_t period;					/**< Time between executions, in milliseconds. */
+	uint32_t executions;				/**< Number of times the handler was executed. */
+
+	/**
+	 * Difference between the actual and scheduled time for each execution, in nanoseconds.
+	 */
+	int64_t jitter[PERIODIC_TASK_SCHEDULER_LINUX_TESTING_MAX_SAMPLES];
+};
+
+/**
+ * Context for the task executing the handlers.
+ */
+struct periodic_task_scheduler_linux_testing_task {
+	const struct periodic_task_scheduler *scheduler;	/**< The scheduler to run. */
+	volatile int done;									/**< Flag to stop the task. */
+	int status;											/**< Error reported by the task. */
+};
+
+/**
+ * Scheduling jitter measured during a run.  All times are in microseconds.
+ */
+struct periodic_task_scheduler_linux_testing_result {
+	uint32_t executions;	/**< Total number of handler executions. */
+	uint64_t max;			/**< Maximum jitter. */
+};
+
+
+/**
+ * Get the difference between two times.
+ *
+ * @param start The start time.
+ * @param end The end time.
+ *
+ * @return The time from start to end, in nanoseconds.
+ */
+static int64_t periodic_task_scheduler_linux_testing_diff (const struct timespec *start,
+	const struct timespec *end)
+{
+	return ((int64_t) (end->tv_sec - start->tv_sec) * 1000000000LL) +
+		(end->tv_nsec - start->tv_nsec);
+}
+
+/**
+ * Busy wait for a period of time to simulate the work done by a handler.
+ *
+ * @param usec The amount of time to wait, in microseconds.
+ */
+static void periodic_task_scheduler_linux_testing_work (uint32_t usec)
+{
+	struct timespec start;
+	struct timespec now;
+
+	clock_gettime (CLOCK_MONOTONIC, &start);
+	do {
+		clock_gettime (CLOCK_MONOTONIC, &now);
+	} while (periodic_task_scheduler_linux_testing_diff (&start, &now) < (usec * 1000LL));
+}
+
+static void periodic_task_scheduler_linux_testing_prepare (
+	const struct periodic_task_handler *handler)
+{
+	struct periodic_task_scheduler_linux_testing_handler *periodic =
+		(struct periodic_task_scheduler_linux_testing_handler*) handler;
+
+	platform_init_timeout (periodic->period, &periodic->next);
+}
+
+static const platform_clock* periodic_task_scheduler_linux_testing_get_next_execution (
+	const struct periodic_task_handler *handler)
+{
+	struct periodic_task_scheduler_linux_testing_handler *periodic =
+		(struct periodic_task_scheduler_linux_testing_handler*) handler;
+
+	return &periodic->next;
+}
+
+static void periodic_task_scheduler_linux_testing_execute (const struct periodic_task_handler *handler)
+{
+	struct periodic_task_scheduler_linux_testing_handler *periodic =
+		(struct periodic_task_scheduler_linux_testing_handler*) handler;
+	struct timespec now;
+
+	clock_gettime (CLOCK_MONOTONIC, &now);
+
+	if (periodic->executions < PERIODIC_TASK_SCHEDULER_LINUX_TESTING_MAX_SAMPLES) {
+		periodic->jitter[periodic->executions] =
+			periodic_task_scheduler_linux_testing_diff (&periodic->next, &now);
+	}
+	periodic->executions++;
+
+	periodic_task_scheduler_linux_testing_work (PERIODIC_TASK_SCHEDULER_LINUX_TESTING_WORK_US);
+
+	/* Schedule from the previous deadline so lateness does not accumulate. */
+	platform_increase_timeout (periodic->period, &periodic->next);
+}
+
+/**
+ * Initialize a handler for testing.
+ *
+ * @param handler The handler to initialize.
+ * @param period Time between executions, in milliseconds.
+ */
+static void periodic_task_scheduler_linux_testing_init_handler (
+	struct periodic_task_scheduler_linux_testing_handler *handler, uint32_t period)
+{
+	memset (handler, 0, sizeof (*handler));
+
+	handler->base.prepare = periodic_task_scheduler_linux_testing_prepare;
+	handler->base.get_next_execution = periodic_task_scheduler_linux_testing_get_next_execution;
+	handler->base.execute = periodic_task_scheduler_linux_testing_execute;
+	handler->period = period;
+}
+
+/**
+ * Task that executes the handlers until told to stop.
+ *
+ * @param arg The task context.
+ *
+ * @return Nothing.
+ */
+static void* periodic_task_scheduler_linux_testing_task (void *arg)
+{
+	struct periodic_task_scheduler_linux_testing_task *task = arg;
+	int status;
+
+	status = periodic_task_scheduler_prepare (task->scheduler);
+	while (!task->done && (status == 0)) {
+		status = periodic_task_scheduler_execute_due_handlers (task->scheduler);
+	}
+
+	task->status = status;
+
+	return NULL;
+}
+
+/**
+ * Execute a set of handlers for a fixed amount of time and measure the scheduling jitter.
+ *
+ * @param test The testing framework.
+ * @param scheduler The scheduler to use to execute the handlers.
+ * @param handler The handlers to execute.
+ * @param list List of handlers for the task.
+ * @param result Output for the measured jitter.
+ */
+static void periodic_task_scheduler_linux_testing_run (CuTest *test,
+	const struct periodic_task_scheduler *scheduler,
+	struct periodic_task_scheduler_linux_testing_handler *handler,
+	const struct periodic_task_handler **list,
+	struct periodic_task_scheduler_linux_testing_result *result)
+{
+	struct periodic_task_scheduler_linux_testing_task task;
+	pthread_t thread;
+	uint64_t jitter;
+	uint32_t expected;
+	uint32_t samples;
+	int status;
+	int i;
+
+	for (i = 0; i < PERIODIC_TASK_SCHEDULER_LINUX_TESTING_HANDLERS; i++) {
+		periodic_task_scheduler_linux_testing_init_handler (&handler[i],
+			PERIODIC_TASK_SCHEDULER_LINUX_TESTING_MIN_PERIOD * ((i % 4) + 1));
+		list[i] = &handler[i].base;
+	}
+
+	task.scheduler = scheduler;
+	task.done = 0;
+	task.status = 0;
+
+	status = pthread_create (&thread, NULL, periodic_task_scheduler_linux_testing_task, &task);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (PERIODIC_TASK_SCHEDULER_LINUX_TESTING_RUN_TIME);
+
+	task.done = 1;
+	periodic_task_scheduler_notify (scheduler);
+
+	pthread_join (thread, NULL);
+	CuAssertIntEquals (test, 0, task.status);
+
+	memset (result, 0, sizeof (*result));
+
+	for (i = 0; i < PERIODIC_TASK_SCHEDULER_LINUX_TESTING_HANDLERS; i++) {
+		uint32_t j;
+
+		expected = PERIODIC_TASK_SCHEDULER_LINUX_TESTING_RUN_TIME / handler[i].period;
+		CuAssertTrue (test, (handler[i].executions + 2) >= expected);
+		CuAssertTrue (test, handler[i].executions <= (expected + 2));
+
+		samples = handler[i].executions;
+		if (samples > PERIODIC_TASK_SCHEDULER_LINUX_TESTING_MAX_SAMPLES) {
+			samples = PERIODIC_TASK_SCHEDULER_LINUX_TESTING_MAX_SAMPLES;
+		}
+
+		for (j = 0; j < samples; j++) {
+			if (handler[i].jitter[j] < 0) {
+				jitter = -handler[i].jitter[j] / 1000;
+			}
+			else {
+				jitter = handler[i].jitter[j] / 1000;
+			}
+
+			if (jitter > result->max) {
+				result->max = jitter;
+			}
+		}
+
+		result->executions += handler[i].executions;
+	}
+
+	CuAssertTrue (test, (result->executions > 0));
+}
+
+
+/*******************
+ * Test cases
+ *******************/
+
+static void periodic_task_scheduler_linux_test_jitter (CuTest *test)
+{
+	struct periodic_task_scheduler_linux_testing_handler *handler;
+	const struct periodic_task_handler *list[PERIODIC_TASK_SCHEDULER_LINUX_TESTING_HANDLERS];
+	struct periodic_task_scheduler_entry entries[PERIODIC_TASK_SCHEDULER_LINUX_TESTING_HANDLERS];
+	struct periodic_task_scheduler_state state;
+	struct periodic_task_scheduler scheduler;
+	struct periodic_task_scheduler_linux_testing_result result;
+	struct periodic_task_scheduler_stats stats;
+	uint32_t max_lateness = 0;
+	int status;
+	int i;
+
+	TEST_START;
+
+	handler = platform_malloc (sizeof (*handler) * PERIODIC_TASK_SCHEDULER_LINUX_TESTING_HANDLERS);
+	CuAssertPtrNotNull (test, handler);
+
+	status = periodic_task_scheduler_init (&scheduler, &state, list,
+		PERIODIC_TASK_SCHEDULER_LINUX_TESTING_HANDLERS, entries);
+	CuAssertIntEquals (test, 0, status);
+
+	periodic_task_scheduler_linux_testing_run (test, &scheduler, handler, list, &result);
+
+	for (i = 0; i < PERIODIC_TASK_SCHEDULER_LINUX_TESTING_HANDLERS; i++) {
+		status = periodic_task_scheduler_get_stats (&scheduler, &handler[i].base, &stats);
+		CuAssertIntEquals (test, 0, status);
+		CuAssertIntEquals (test, handler[i].executions, stats.executions);
+
+		if (stats.max_lateness > max_lateness) {
+			max_lateness = stats.max_lateness;
+		}
+	}
+
+	/* Leave plenty of margin for an unloaded build host. */
+	CuAssertTrue (test, (result.max < 50000));
+	CuAssertTrue (test, (max_lateness < 50));
+
+	periodic_task_scheduler_release (&scheduler);
+	platform_free (handler);
+}
+
+static void periodic_task_scheduler_linux_test_notify_latency (CuTest *test)
+{
+	struct periodic_task_scheduler_linux_testing_handler *handler;
+	const struct periodic_task_handler *list[2];
+	struct periodic_task_scheduler_entry entries[2];
+	struct periodic_task_scheduler_state state;
+	struct periodic_task_scheduler scheduler;
+	struct periodic_task_scheduler_linux_testing_task task;
+	pthread_t thread;
+	struct timespec notified;
+	int64_t latency;
+	int status;
+
+	TEST_START;
+
+	handler = platform_malloc (sizeof (*handler) * 2);
+	CuAssertPtrNotNull (test, handler);
+
+	periodic_task_scheduler_linux_testing_init_handler (&handler[0], 10000);
+	periodic_task_scheduler_linux_testing_init_handler (&handler[1], 1000);
+	list[0] = &handler[0].base;
+	list[1] = &handler[1].base;
+
+	status = periodic_task_scheduler_init (&scheduler, &state, list, 2, entries);
+	CuAssertIntEquals (test, 0, status);
+
+	task.scheduler = &scheduler;
+	task.done = 0;
+	task.status = 0;
+
+	status = pthread_create (&thread, NULL, periodic_task_scheduler_linux_testing_task, &task);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (100);
+
+	/* Move the first handler from 10 seconds in the future to now. */
+	clock_gettime (CLOCK_MONOTONIC, &notified);
+	handler[0].next = notified;
+
+	status = periodic_task_scheduler_notify (&scheduler);
+	CuAssertIntEquals (test, 0, status);
+
+	platform_msleep (100);
+
+	task.done = 1;
+	periodic_task_scheduler_notify (&scheduler);
+
+	pthread_join (thread, NULL);
+	CuAssertIntEquals (test, 0, task.status);
+
+	CuAssertIntEquals (test, 1, handler[0].executions);
+	CuAssertIntEquals (test, 0, handler[1].executions);
+
+	latency = handler[0].jitter[0];
+	CuAssertTrue (test, (latency < 50000000LL));
+
+	periodic_task_scheduler_release (&scheduler);
+	platform_free (handler);
+}
+
+
+// *INDENT-OFF*
+TEST_SUITE_START (periodic_task_scheduler_linux);
+
+TEST (periodic_task_scheduler_linux_test_jitter);
+TEST (periodic_task_scheduler_linux_test_notify_latency);
+
+TEST_SUITE_END;
+// *INDENT-ON*